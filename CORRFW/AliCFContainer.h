@@ -87,6 +87,8 @@ class AliCFContainer : public AliCFFrame
   virtual AliCFGridSparse * GetGrid(Int_t istep) const {return fGrid[istep];};
 
   virtual void  Scale(Double_t factor) const;
+  virtual void  SetDenseThreshold(Float_t threshold) ; // adaptive dense storage of all steps, see AliCFGridSparse::SetDenseThreshold
+  virtual void  SetProjectionCacheSize(Long64_t size) ; // projection cache of each step (size in bytes per step), see AliCFGridSparse::SetProjectionCacheSize
 
   /****   TO BE REMOVED SOON ******/
   virtual TH1D* ShowProjection( Int_t ivar,  Int_t istep)                          const {return (TH1D*)Project(istep,ivar);}
@@ -144,16 +146,26 @@ inline void  AliCFContainer::Scale(Double_t factor) const {
   for (Int_t iStep=0; iStep<fNStep; iStep++) fGrid[iStep]->Scale(fact);
 }
 
+inline void AliCFContainer::SetDenseThreshold(Float_t threshold) {
+  for (Int_t iStep=0; iStep<fNStep; iStep++) fGrid[iStep]->SetDenseThreshold(threshold);
+}
+
+inline void AliCFContainer::SetProjectionCacheSize(Long64_t size) {
+  for (Int_t iStep=0; iStep<fNStep; iStep++) fGrid[iStep]->SetProjectionCacheSize(size);
+}
+
 inline void AliCFContainer::SetBinContent(Int_t* bin, Int_t step, Double_t value) {
   // sets the content 'value' to the current container, at step 'step'
   // 'bin' is the array of the bin coordinates
   GetGrid(step)->GetGrid()->SetBinContent(bin,value);
+  GetGrid(step)->ContentChanged();
 }
 
 inline void AliCFContainer::SetBinError(Int_t* bin, Int_t step, Double_t value) {
   // sets the error 'value' to the current container, at step 'step'
   // 'bin' is the array of the bin coordinates
   GetGrid(step)->GetGrid()->SetBinError(bin,value);
+  GetGrid(step)->ContentChanged();
 }
 
 #endif
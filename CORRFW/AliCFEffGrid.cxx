@@ -166,6 +166,19 @@ TH1* AliCFEffGrid::Project(Int_t ivar1, Int_t ivar2, Int_t ivar3) const
     AliError("You must call CalculateEfficiency() first !");
     return 0x0;
   }
+
+  // the projection depends on the content and the axis ranges of numerator and denominator
+  TString cacheKey;
+  if (GetProjectionCacheSize()>0) {
+    cacheKey.Form("eff_%d_%d_%d_%d_%d_%u_%u",ivar1,ivar2,ivar3,fSelNum,fSelDen,GetNum()->GetContentVersion(),GetDen()->GetContentVersion());
+    for (Int_t iVar=0; iVar<GetNum()->GetNVar(); iVar++) {
+      TAxis *axisNum = GetNum()->GetAxis(iVar), *axisDen = GetDen()->GetAxis(iVar);
+      cacheKey.Append(Form(":%d_%d_%d_%d",axisNum->GetFirst(),axisNum->GetLast(),axisDen->GetFirst(),axisDen->GetLast()));
+    }
+    TH1* cached = FindCachedProjection(cacheKey);
+    if (cached) return cached;
+  }
+
   const Int_t nDim = 3 ;
   Int_t dim[nDim] = {ivar1,ivar2,ivar3} ;
   
@@ -197,6 +210,7 @@ TH1* AliCFEffGrid::Project(Int_t ivar1, Int_t ivar2, Int_t ivar3) const
   }
 
   delete hNum; delete hDen; delete ratio;
+  if (GetProjectionCacheSize()>0) AddCachedProjection(cacheKey,h);
   return h ;
 } 
 //___________________________________________________________________
@@ -33,6 +33,10 @@
 #include "TH2D.h"
 #include "TH3D.h"
 #include "TAxis.h"
+#include "TArrayF.h"
+#include "TObjArray.h"
+#include "TBuffer.h"
+#include "TList.h"
 #include "AliCFUnfolding.h"
 
 //____________________________________________________________________
@@ -42,7 +46,15 @@ ClassImp(AliCFGridSparse)
 AliCFGridSparse::AliCFGridSparse() : 
   AliCFFrame(),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fDenseThreshold(0.),
+  fDensePages(0x0),
+  fDenseErrors(0x0),
+  fDenseEntries(0.),
+  fProjCacheSize(0),
+  fProjCacheUsed(0),
+  fProjCache(0x0),
+  fContentVersion(0)
 {
   // default constructor
 }
@@ -50,7 +62,15 @@ AliCFGridSparse::AliCFGridSparse() :
 AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title) : 
   AliCFFrame(name,title),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fDenseThreshold(0.),
+  fDensePages(0x0),
+  fDenseErrors(0x0),
+  fDenseEntries(0.),
+  fProjCacheSize(0),
+  fProjCacheUsed(0),
+  fProjCache(0x0),
+  fContentVersion(0)
 {
   // default constructor
 }
@@ -58,7 +78,15 @@ AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title) :
 AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title, Int_t nVarIn, const Int_t * nBinIn) :  
   AliCFFrame(name,title),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fDenseThreshold(0.),
+  fDensePages(0x0),
+  fDenseErrors(0x0),
+  fDenseEntries(0.),
+  fProjCacheSize(0),
+  fProjCacheUsed(0),
+  fProjCache(0x0),
+  fContentVersion(0)
 {
   //
   // main constructor
@@ -73,6 +101,9 @@ AliCFGridSparse::~AliCFGridSparse()
   //
   // destructor
   //
+  DeleteDensePages();
+  ClearProjectionCache();
+  delete fProjCache;
   if (fData) delete fData;
 }
 
@@ -80,7 +111,15 @@ AliCFGridSparse::~AliCFGridSparse()
 AliCFGridSparse::AliCFGridSparse(const AliCFGridSparse& c) :
   AliCFFrame(c),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fDenseThreshold(0.),
+  fDensePages(0x0),
+  fDenseErrors(0x0),
+  fDenseEntries(0.),
+  fProjCacheSize(0),
+  fProjCacheUsed(0),
+  fProjCache(0x0),
+  fContentVersion(0)
 {
   //
   // copy constructor
@@ -101,6 +140,7 @@ AliCFGridSparse& AliCFGridSparse::operator=(const AliCFGridSparse &c)
 //____________________________________________________________________
 void AliCFGridSparse::SetBinLimits(Int_t ivar, Double_t min, Double_t max)
 {
+  ContentChanged();
   //
   // set a uniform binning for variable ivar
   //
@@ -114,6 +154,7 @@ void AliCFGridSparse::SetBinLimits(Int_t ivar, Double_t min, Double_t max)
 //____________________________________________________________________
 void AliCFGridSparse::SetBinLimits(Int_t ivar, const Double_t *array)
 {
+  ContentChanged();
   //
   // setting the arrays containing the bin limits 
   //
@@ -123,12 +164,201 @@ void AliCFGridSparse::SetBinLimits(Int_t ivar, const Double_t *array)
 //____________________________________________________________________
 void AliCFGridSparse::Fill(const Double_t *var, Double_t weight)
 {
+  ContentChanged();
   //
   // Fill the grid,
   // given a set of values of the input variable, 
   // with weight (by default w=1)
   //
+  if (fDensePages) {
+    FillDense(var,weight);
+    return;
+  }
   fData->Fill(var,weight);
+  if (fDenseThreshold>0 && fData->GetNbins() > fDenseThreshold * GetNBinsTotal()) SwitchToDense();
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::SetDenseThreshold(Float_t threshold)
+{
+  //
+  // Adaptive storage: once the fraction of filled bins (GetNFilledBins()/GetNBinsTotal())
+  // exceeds threshold, the content is moved into pages of dense arrays and further
+  // fills go directly into the pages, which avoids the hash lookup of THnSparse.
+  // The pages (including under/overflow bins) are allocated only when a bin inside is filled.
+  // The content is moved back into the THnSparse whenever the grid is accessed
+  // (GetGrid(), projections, arithmetics, Merge, writing), so the pages are transparent
+  // to the user. threshold<=0 (default) disables the dense mode
+  //
+  fDenseThreshold = threshold;
+  if (fDenseThreshold<=0) {
+    FlushDensePages();
+    DeleteDensePages();
+  }
+  else if (fData && fData->GetNbins() > fDenseThreshold * GetNBinsTotal()) SwitchToDense();
+}
+
+//____________________________________________________________________
+Long64_t AliCFGridSparse::GetDenseIndex(const Int_t *bin) const
+{
+  //
+  // global index of a bin in the dense pages, under/overflow bins included
+  //
+  Long64_t index = 0;
+  for (Int_t iVar=0; iVar<GetNVar(); iVar++) {
+    index = index * (fData->GetAxis(iVar)->GetNbins()+2) + bin[iVar];
+  }
+  return index;
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::SwitchToDense()
+{
+  //
+  // move the content of the THnSparse into the dense pages
+  //
+  if (fDensePages || !fData) return;
+
+  Long64_t nBins = 1;
+  for (Int_t iVar=0; iVar<GetNVar(); iVar++) nBins *= fData->GetAxis(iVar)->GetNbins()+2;
+  Int_t nPages = (Int_t) ((nBins + fgkDensePageSize - 1) / fgkDensePageSize);
+
+  fDensePages = new TObjArray(nPages);
+  fDensePages->SetOwner();
+  if (fSumW2 || fData->GetCalculateErrors()) {
+    fDenseErrors = new TObjArray(nPages);
+    fDenseErrors->SetOwner();
+  }
+
+  Int_t *bin = new Int_t[GetNVar()];
+  for (Long64_t i = 0; i < fData->GetNbins(); i++) {
+    Double_t v = fData->GetBinContent(i, bin);
+    AddDenseContent(GetDenseIndex(bin),v,(fDenseErrors ? fData->GetBinError2(i) : 0.));
+  }
+  delete [] bin;
+
+  fDenseEntries = fData->GetEntries();
+  fData->Reset();
+
+  AliInfo(Form("%s: switched to dense storage (%d pages of %d bins)",GetName(),nPages,fgkDensePageSize));
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::AddDenseContent(Long64_t index, Double_t val, Double_t err2)
+{
+  //
+  // add val (and squared error err2) to the dense bin index, create the page if needed
+  //
+  Int_t page = (Int_t) (index / fgkDensePageSize);
+  Int_t offset = (Int_t) (index % fgkDensePageSize);
+  TArrayF *values = (TArrayF*) fDensePages->UncheckedAt(page);
+  if (!values) {
+    values = new TArrayF(fgkDensePageSize);
+    fDensePages->AddAt(values,page);
+  }
+  values->GetArray()[offset] += val;
+
+  if (fDenseErrors) {
+    TArrayF *errors = (TArrayF*) fDenseErrors->UncheckedAt(page);
+    if (!errors) {
+      errors = new TArrayF(fgkDensePageSize);
+      fDenseErrors->AddAt(errors,page);
+    }
+    errors->GetArray()[offset] += err2;
+  }
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::FillDense(const Double_t *var, Double_t weight)
+{
+  //
+  // fill the dense pages, same bin finding as THnSparse::Fill
+  //
+  Long64_t index = 0;
+  for (Int_t iVar=0; iVar<GetNVar(); iVar++) {
+    TAxis *axis = fData->GetAxis(iVar);
+    index = index * (axis->GetNbins()+2) + axis->FindBin(var[iVar]);
+  }
+  AddDenseContent(index,weight,weight*weight);
+  fDenseEntries++;
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::FlushDensePages() const
+{
+  //
+  // move the content of the dense pages back into the THnSparse.
+  // The pages are kept (set to zero), further fills go again into the pages
+  //
+  if (!fDensePages) return;
+
+  AliCFGridSparse *me = const_cast<AliCFGridSparse*>(this);
+  const Int_t nVar = GetNVar();
+  Int_t *bin = new Int_t[nVar];
+  Bool_t filled = kFALSE;
+
+  for (Int_t page = 0; page < fDensePages->GetSize(); page++) {
+    TArrayF *values = (TArrayF*) fDensePages->UncheckedAt(page);
+    if (!values) continue;
+    TArrayF *errors = fDenseErrors ? (TArrayF*) fDenseErrors->UncheckedAt(page) : 0x0;
+    for (Int_t offset = 0; offset < fgkDensePageSize; offset++) {
+      Float_t v = values->GetArray()[offset];
+      Float_t e2 = errors ? errors->GetArray()[offset] : 0.;
+      if (v == 0 && e2 == 0) continue;
+
+      // decode the bin coordinates, the last variable runs fastest
+      Long64_t index = (Long64_t) page * fgkDensePageSize + offset;
+      for (Int_t iVar=nVar-1; iVar>=0; iVar--) {
+	Int_t nBins = fData->GetAxis(iVar)->GetNbins()+2;
+	bin[iVar] = (Int_t) (index % nBins);
+	index /= nBins;
+      }
+
+      Long64_t sparseBin = fData->GetBin(bin);
+      fData->AddBinContent(sparseBin,v);
+      if (errors) fData->AddBinError2(sparseBin,e2);
+      filled = kTRUE;
+    }
+    values->Reset();
+    if (errors) errors->Reset();
+  }
+  delete [] bin;
+
+  if (filled || me->fDenseEntries>0) {
+    fData->SetEntries(fData->GetEntries() + me->fDenseEntries);
+    me->fDenseEntries = 0.;
+  }
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::DeleteDensePages()
+{
+  //
+  // delete the dense pages (without moving the content)
+  //
+  delete fDensePages;
+  delete fDenseErrors;
+  fDensePages = 0x0;
+  fDenseErrors = 0x0;
+  fDenseEntries = 0.;
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::Streamer(TBuffer &R__b)
+{
+  //
+  // stream the object: the content of the dense pages is moved into the THnSparse before writing,
+  // so the output is identical to the one of the sparse mode
+  //
+  if (R__b.IsReading()) {
+    DeleteDensePages();
+    R__b.ReadClassBuffer(AliCFGridSparse::Class(),this);
+    ContentChanged();
+  }
+  else {
+    FlushDensePages();
+    R__b.WriteClassBuffer(AliCFGridSparse::Class(),this);
+  }
 }
 
 //___________________________________________________________________
@@ -150,7 +380,7 @@ AliCFGridSparse* AliCFGridSparse::MakeSlice(Int_t nVars, const Int_t* vars, cons
   AliCFGridSparse* out = new AliCFGridSparse(fName,fTitle,nVars,bins);
 
   //set the range in the THnSparse to project
-  THnSparse* clone = ((THnSparse*)fData->Clone());
+  THnSparse* clone = ((THnSparse*)GetGrid()->Clone());
   if (varMin && varMax) {
     for (Int_t iAxis=0; iAxis<GetNVar(); iAxis++) {
       SetAxisRange(clone->GetAxis(iAxis),varMin[iAxis],varMax[iAxis],useBins);
@@ -172,7 +402,7 @@ Float_t AliCFGridSparse::GetBinCenter(Int_t ivar, Int_t ibin) const
   // Returns the center of specified bin for variable axis ivar
   // 
   
-  return (Float_t) fData->GetAxis(ivar)->GetBinCenter(ibin);
+  return (Float_t) GetGrid()->GetAxis(ivar)->GetBinCenter(ibin);
 }
 
 //____________________________________________________________________
@@ -182,7 +412,7 @@ Float_t AliCFGridSparse::GetBinSize(Int_t ivar, Int_t ibin) const
   // Returns the size of specified bin for variable axis ivar
   // 
   
-  return (Float_t) fData->GetAxis(ivar)->GetBinUpEdge(ibin) - fData->GetAxis(ivar)->GetBinLowEdge(ibin);
+  return (Float_t) GetGrid()->GetAxis(ivar)->GetBinUpEdge(ibin) - GetGrid()->GetAxis(ivar)->GetBinLowEdge(ibin);
 }
 
 //____________________________________________________________________
@@ -192,7 +422,7 @@ Float_t AliCFGridSparse::GetEntries() const
   // total entries (including overflows and underflows)
   //
 
-  return fData->GetEntries();
+  return GetGrid()->GetEntries();
 }
 
 //____________________________________________________________________
@@ -202,7 +432,7 @@ Float_t AliCFGridSparse::GetElement(Long_t index) const
   // Returns content of grid element index 
   //
   
-  return fData->GetBinContent(index);
+  return GetGrid()->GetBinContent(index);
 }
 //____________________________________________________________________
 Float_t AliCFGridSparse::GetElement(const Int_t *bin) const
@@ -210,7 +440,7 @@ Float_t AliCFGridSparse::GetElement(const Int_t *bin) const
   //
   // Get the content in a bin corresponding to a set of bin indexes
   //
-  return fData->GetBinContent(bin);
+  return GetGrid()->GetBinContent(bin);
 
 }  
 //____________________________________________________________________
@@ -220,9 +450,9 @@ Float_t AliCFGridSparse::GetElement(const Double_t *var) const
   // Get the content in a bin corresponding to a set of input variables
   //
 
-  Long_t index = fData->GetBin(var,kFALSE);
+  Long_t index = GetGrid()->GetBin(var,kFALSE);
   if (index<0) return 0.;
-  return fData->GetBinContent(index);
+  return GetGrid()->GetBinContent(index);
 } 
 
 //____________________________________________________________________
@@ -232,7 +462,7 @@ Float_t AliCFGridSparse::GetElementError(Long_t index) const
   // Returns the error on the content 
   //
 
-  return fData->GetBinError(index);
+  return GetGrid()->GetBinError(index);
 }
 //____________________________________________________________________
 Float_t AliCFGridSparse::GetElementError(const Int_t *bin) const
@@ -240,7 +470,7 @@ Float_t AliCFGridSparse::GetElementError(const Int_t *bin) const
  //
   // Get the error in a bin corresponding to a set of bin indexes
   //
-  return fData->GetBinError(bin);
+  return GetGrid()->GetBinError(bin);
 
 }  
 //____________________________________________________________________
@@ -250,19 +480,20 @@ Float_t AliCFGridSparse::GetElementError(const Double_t *var) const
   // Get the error in a bin corresponding to a set of input variables
   //
 
-  Long_t index=fData->GetBin(var,kFALSE); //this is the THnSparse index (do not allocate new cells if content is empy)
+  Long_t index=GetGrid()->GetBin(var,kFALSE); //this is the THnSparse index (do not allocate new cells if content is empy)
   if (index<0) return 0.;
-  return fData->GetBinError(index);
+  return GetGrid()->GetBinError(index);
 } 
 
 //____________________________________________________________________
 void AliCFGridSparse::SetElement(Long_t index, Float_t val)
 {
+  ContentChanged();
   //
   // Sets grid element value
   //
   Int_t* bin = new Int_t[GetNVar()];
-  fData->GetBinContent(index,bin); //affects the bin coordinates
+  GetGrid()->GetBinContent(index,bin); //affects the bin coordinates
   SetElement(bin,val);
   delete [] bin ;
 }
@@ -270,20 +501,22 @@ void AliCFGridSparse::SetElement(Long_t index, Float_t val)
 //____________________________________________________________________
 void AliCFGridSparse::SetElement(const Int_t *bin, Float_t val)
 {
+  ContentChanged();
   //
   // Sets grid element of bin indeces bin to val
   //
-  fData->SetBinContent(bin,val);
+  GetGrid()->SetBinContent(bin,val);
 }
 //____________________________________________________________________
 void AliCFGridSparse::SetElement(const Double_t *var, Float_t val) 
 {
+  ContentChanged();
   //
   // Set the content in a bin to value val corresponding to a set of input variables
   //
-  Long_t index=fData->GetBin(var,kTRUE); //THnSparse index: allocate the cell
+  Long_t index=GetGrid()->GetBin(var,kTRUE); //THnSparse index: allocate the cell
   Int_t *bin = new Int_t[GetNVar()];
-  fData->GetBinContent(index,bin); //trick to access the array of bins
+  GetGrid()->GetBinContent(index,bin); //trick to access the array of bins
   SetElement(bin,val);
   delete [] bin;
 }
@@ -291,11 +524,12 @@ void AliCFGridSparse::SetElement(const Double_t *var, Float_t val)
 //____________________________________________________________________
 void AliCFGridSparse::SetElementError(Long_t index, Float_t val)
 {
+  ContentChanged();
   //
   // Sets grid element iel error to val (linear indexing) in AliCFFrame
   //
   Int_t *bin = new Int_t[GetNVar()];
-  fData->GetBinContent(index,bin);
+  GetGrid()->GetBinContent(index,bin);
   SetElementError(bin,val);
   delete [] bin;
 }
@@ -303,20 +537,22 @@ void AliCFGridSparse::SetElementError(Long_t index, Float_t val)
 //____________________________________________________________________
 void AliCFGridSparse::SetElementError(const Int_t *bin, Float_t val)
 {
+  ContentChanged();
   //
   // Sets grid element error of bin indeces bin to val
   //
-  fData->SetBinError(bin,val);
+  GetGrid()->SetBinError(bin,val);
 }
 //____________________________________________________________________
 void AliCFGridSparse::SetElementError(const Double_t *var, Float_t val) 
 {
+  ContentChanged();
   //
   // Set the error in a bin to value val corresponding to a set of input variables
   //
-  Long_t index=fData->GetBin(var); //THnSparse index
+  Long_t index=GetGrid()->GetBin(var); //THnSparse index
   Int_t *bin = new Int_t[GetNVar()];
-  fData->GetBinContent(index,bin); //trick to access the array of bins
+  GetGrid()->GetBinContent(index,bin); //trick to access the array of bins
   SetElementError(bin,val);
   delete [] bin;
 }
@@ -324,11 +560,16 @@ void AliCFGridSparse::SetElementError(const Double_t *var, Float_t val)
 //____________________________________________________________________
 void AliCFGridSparse::SumW2()
 {
+  ContentChanged();
   //
   //set calculation of the squared sum of the weighted entries
   //
   if(!fSumW2){
-    fData->CalculateErrors(kTRUE); 
+    GetGrid()->CalculateErrors(kTRUE); 
+    if (fDensePages && !fDenseErrors) {
+      fDenseErrors = new TObjArray(fDensePages->GetSize());
+      fDenseErrors->SetOwner();
+    }
   }
   fSumW2=kTRUE;
 }
@@ -336,6 +577,7 @@ void AliCFGridSparse::SumW2()
 //____________________________________________________________________
 void AliCFGridSparse::Add(const AliCFGridSparse* aGrid, Double_t c)
 {
+  ContentChanged();
   //
   //add aGrid to the current one
   //
@@ -346,12 +588,13 @@ void AliCFGridSparse::Add(const AliCFGridSparse* aGrid, Double_t c)
   } 
   
   if (!fSumW2  && aGrid->GetSumW2()) SumW2();
-  fData->Add(aGrid->GetGrid(),c);
+  GetGrid()->Add(aGrid->GetGrid(),c);
 }
 
 //____________________________________________________________________
 void AliCFGridSparse::Add(const AliCFGridSparse* aGrid1, const AliCFGridSparse* aGrid2, Double_t c1,Double_t c2)
 {
+  ContentChanged();
   //
   //Add aGrid1 and aGrid2 and deposit the result into the current one
   //
@@ -363,14 +606,15 @@ void AliCFGridSparse::Add(const AliCFGridSparse* aGrid1, const AliCFGridSparse*
   
   if (!fSumW2  && (aGrid1->GetSumW2() || aGrid2->GetSumW2())) SumW2();
 
-  fData->Reset();
-  fData->Add(aGrid1->GetGrid(),c1);
-  fData->Add(aGrid2->GetGrid(),c2);
+  GetGrid()->Reset();
+  GetGrid()->Add(aGrid1->GetGrid(),c1);
+  GetGrid()->Add(aGrid2->GetGrid(),c2);
 }
 
 //____________________________________________________________________
 void AliCFGridSparse::Multiply(const AliCFGridSparse* aGrid, Double_t c)
 {
+  ContentChanged();
   //
   // Multiply aGrid to the current one
   //
@@ -382,13 +626,14 @@ void AliCFGridSparse::Multiply(const AliCFGridSparse* aGrid, Double_t c)
   
   if(!fSumW2  && aGrid->GetSumW2()) SumW2();
   THnSparse *h = aGrid->GetGrid();
-  fData->Multiply(h);
-  fData->Scale(c);
+  GetGrid()->Multiply(h);
+  GetGrid()->Scale(c);
 }
 
 //____________________________________________________________________
 void AliCFGridSparse::Multiply(const AliCFGridSparse* aGrid1, const AliCFGridSparse* aGrid2, Double_t c1,Double_t c2)
 {
+  ContentChanged();
   //
   //Multiply aGrid1 and aGrid2 and deposit the result into the current one
   //
@@ -400,17 +645,18 @@ void AliCFGridSparse::Multiply(const AliCFGridSparse* aGrid1, const AliCFGridSpa
   
   if(!fSumW2  && (aGrid1->GetSumW2() || aGrid2->GetSumW2())) SumW2();
 
-  fData->Reset();
+  GetGrid()->Reset();
   THnSparse *h1 = aGrid1->GetGrid();
   THnSparse *h2 = aGrid2->GetGrid();
   h2->Multiply(h1);
   h2->Scale(c1*c2);
-  fData->Add(h2);
+  GetGrid()->Add(h2);
 }
 
 //____________________________________________________________________
 void AliCFGridSparse::Divide(const AliCFGridSparse* aGrid, Double_t c)
 {
+  ContentChanged();
   //
   // Divide aGrid to the current one
   //
@@ -423,14 +669,15 @@ void AliCFGridSparse::Divide(const AliCFGridSparse* aGrid, Double_t c)
   if (!fSumW2  && aGrid->GetSumW2()) SumW2();
 
   THnSparse *h1 = aGrid->GetGrid();
-  THnSparse *h2 = (THnSparse*)fData->Clone();
-  fData->Divide(h2,h1);
-  fData->Scale(c);
+  THnSparse *h2 = (THnSparse*)GetGrid()->Clone();
+  GetGrid()->Divide(h2,h1);
+  GetGrid()->Scale(c);
 }
 
 //____________________________________________________________________
 void AliCFGridSparse::Divide(const AliCFGridSparse* aGrid1, const AliCFGridSparse* aGrid2, Double_t c1,Double_t c2, Option_t *option)
 {
+  ContentChanged();
   //
   //Divide aGrid1 and aGrid2 and deposit the result into the current one
   //binomial errors are supported
@@ -445,13 +692,14 @@ void AliCFGridSparse::Divide(const AliCFGridSparse* aGrid1, const AliCFGridSpars
 
   THnSparse *h1= aGrid1->GetGrid();
   THnSparse *h2= aGrid2->GetGrid();
-  fData->Divide(h1,h2,c1,c2,option);
+  GetGrid()->Divide(h1,h2,c1,c2,option);
 }
 
 
 //____________________________________________________________________
 void AliCFGridSparse::Rebin(const Int_t* group)
 {
+  ContentChanged();
   //
   // rebin the grid according to Rebin() as in THnSparse
   // Please notice that the original number of bins on
@@ -462,13 +710,15 @@ void AliCFGridSparse::Rebin(const Int_t* group)
     if (group[i]!=1) AliInfo(Form(" merging bins along dimension %i in groups of %i bins", i,group[i]));
   }
 
-  THnSparse *rebinned =fData->Rebin(group);
-  fData->Reset();
+  THnSparse *rebinned =GetGrid()->Rebin(group);
+  GetGrid()->Reset();
   fData = rebinned;
+  DeleteDensePages(); // the page layout refers to the old binning
 }
 //____________________________________________________________________
 void AliCFGridSparse::Scale(Long_t index, const Double_t *fact)
 {
+  ContentChanged();
   //
   //scale content of a certain cell by (positive) fact (with error)
   //
@@ -485,6 +735,7 @@ void AliCFGridSparse::Scale(Long_t index, const Double_t *fact)
 //____________________________________________________________________
 void AliCFGridSparse::Scale(const Int_t *bin, const Double_t *fact)
 {
+  ContentChanged();
   //
   //scale content of a certain cell by (positive) fact (with error)
   //
@@ -501,6 +752,7 @@ void AliCFGridSparse::Scale(const Int_t *bin, const Double_t *fact)
 //____________________________________________________________________
 void AliCFGridSparse::Scale(const Double_t *var, const Double_t *fact) 
 {
+  ContentChanged();
   //
   //scale content of a certain cell by (positive) fact (with error)
   //
@@ -517,6 +769,7 @@ void AliCFGridSparse::Scale(const Double_t *var, const Double_t *fact)
 //____________________________________________________________________
 void AliCFGridSparse::Scale(const Double_t* fact)
 {
+  ContentChanged();
   //
   //scale contents of the whole grid by fact
   //
@@ -553,7 +806,7 @@ Double_t AliCFGridSparse::GetIntegral() const
   //
   // Get full Integral
   //
-  return fData->ComputeIntegral();  
+  return GetGrid()->ComputeIntegral();  
 } 
 
 //____________________________________________________________________
@@ -606,8 +859,11 @@ void AliCFGridSparse::Copy(TObject& c) const
   AliCFFrame::Copy(c);
   AliCFGridSparse& target = (AliCFGridSparse &) c;
   target.fSumW2 = fSumW2 ;
+  target.fDenseThreshold = fDenseThreshold ;
+  target.DeleteDensePages();
+  target.ContentChanged();
   if (fData) {
-    target.fData = (THnSparse*)fData->Clone();
+    target.fData = (THnSparse*)GetGrid()->Clone();
   }
 }
 
@@ -620,8 +876,16 @@ TH1* AliCFGridSparse::Slice(Int_t iVar1, Int_t iVar2, Int_t iVar3, const Double_
   // therefore varMin and varMax must have their dimensions equal to GetNVar()
   // If useBins=true, varMin and varMax are taken as bin numbers
   // if varmin or varmax point to null, all the range is taken, including over- and underflows
+  // if the projection cache is enabled (see SetProjectionCacheSize) a copy of a cached projection is returned
 
-  THnSparse* clone = (THnSparse*)fData->Clone();
+  TString cacheKey;
+  if (fProjCacheSize>0) {
+    cacheKey = GetProjectionCacheKey(iVar1,iVar2,iVar3,varMin,varMax,useBins);
+    TH1* cached = FindCachedProjection(cacheKey);
+    if (cached) return cached;
+  }
+
+  THnSparse* clone = (THnSparse*)GetGrid()->Clone();
   if (varMin != 0x0 && varMax != 0x0) {
     for (Int_t iAxis=0; iAxis<GetNVar(); iAxis++) SetAxisRange(clone->GetAxis(iAxis),varMin[iAxis],varMax[iAxis],useBins);
   }
@@ -693,9 +957,136 @@ TH1* AliCFGridSparse::Slice(Int_t iVar1, Int_t iVar2, Int_t iVar3, const Double_
   projection->SetTitle(title.Data());
 
   delete clone;
+  if (fProjCacheSize>0) AddCachedProjection(cacheKey,projection);
   return projection ;
 }
 
+//____________________________________________________________________
+void AliCFGridSparse::SetProjectionCacheSize(Long64_t size)
+{
+  //
+  // Enable a cache of the projections (Project/Slice) with a memory budget of size bytes (0 disables the cache).
+  // Projections are identified by the projected variables and the ranges of all axes,
+  // a copy of the cached histogram is returned. If the budget is exceeded, the least recently
+  // used projections are removed. The cache is cleared whenever the content of the grid changes
+  // through the functions of this class; call ClearProjectionCache() after modifying GetGrid() directly
+  //
+  fProjCacheSize = size;
+  if (fProjCacheSize<=0) {
+    fProjCacheSize = 0;
+    ClearProjectionCache();
+  }
+  else ShrinkProjectionCache();
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::ClearProjectionCache() const
+{
+  //
+  // remove all cached projections
+  //
+  if (!fProjCache) return;
+  AliCFGridSparse *me = const_cast<AliCFGridSparse*>(this);
+  me->fProjCache->Delete(); // deletes the entries, which own the histograms
+  me->fProjCacheUsed = 0;
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::ContentChanged()
+{
+  //
+  // to be called whenever the content of the grid changes
+  //
+  fContentVersion++;
+  if (fProjCache && fProjCache->GetEntries()) ClearProjectionCache();
+}
+
+//____________________________________________________________________
+TString AliCFGridSparse::GetProjectionCacheKey(Int_t iVar1, Int_t iVar2, Int_t iVar3, const Double_t *varMin, const Double_t *varMax, Bool_t useBins) const
+{
+  //
+  // identifier of a projection: projected variables and range of all axes
+  //
+  TString key;
+  key.Form("%d_%d_%d",iVar1,iVar2,iVar3);
+  for (Int_t iVar=0; iVar<GetNVar(); iVar++) {
+    if (varMin && varMax) key.Append(Form(":%d_%.17g_%.17g",useBins,varMin[iVar],varMax[iVar]));
+    else {
+      TAxis *axis = fData->GetAxis(iVar);
+      key.Append(Form(":%d_%d_%d",axis->TestBit(TAxis::kAxisRange),axis->GetFirst(),axis->GetLast()));
+    }
+  }
+  return key;
+}
+
+//____________________________________________________________________
+TH1* AliCFGridSparse::FindCachedProjection(const TString& key) const
+{
+  //
+  // returns a copy of the cached projection identified by key (0 if not cached)
+  //
+  if (!fProjCache) return 0x0;
+  TList *entry = (TList*) fProjCache->FindObject(key);
+  if (!entry) return 0x0;
+
+  // most recently used entries are kept at the front
+  fProjCache->Remove(entry);
+  fProjCache->AddFirst(entry);
+  return (TH1*) entry->First()->Clone();
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::AddCachedProjection(const TString& key, const TH1* projection) const
+{
+  //
+  // adds a copy of projection to the cache
+  //
+  Long64_t size = GetProjectionSize(projection);
+  if (size > fProjCacheSize) return;
+
+  AliCFGridSparse *me = const_cast<AliCFGridSparse*>(this);
+  if (!me->fProjCache) me->fProjCache = new TList();
+
+  Bool_t addStatus = TH1::AddDirectoryStatus();
+  TH1::AddDirectory(kFALSE);
+  TH1* copy = (TH1*) projection->Clone();
+  TH1::AddDirectory(addStatus);
+
+  // each entry is a list named after the key, holding the histogram
+  TList *entry = new TList();
+  entry->SetName(key);
+  entry->SetOwner();
+  entry->Add(copy);
+  me->fProjCache->AddFirst(entry);
+  me->fProjCacheUsed += size;
+  me->ShrinkProjectionCache();
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::ShrinkProjectionCache()
+{
+  //
+  // removes the least recently used projections until the cache fits in its memory budget
+  //
+  if (!fProjCache) return;
+  while (fProjCacheUsed > fProjCacheSize && fProjCache->GetEntries()>0) {
+    TList *entry = (TList*) fProjCache->Last();
+    fProjCache->Remove(entry);
+    fProjCacheUsed -= GetProjectionSize((TH1*)entry->First());
+    delete entry;
+  }
+}
+
+//____________________________________________________________________
+Long64_t AliCFGridSparse::GetProjectionSize(const TH1* projection) const
+{
+  //
+  // approximate memory used by a projection (TH1D/TH2D/TH3D) in bytes
+  //
+  Long64_t nCells = projection->GetNcells();
+  return nCells * sizeof(Double_t) * (projection->GetSumw2N() ? 2 : 1);
+}
+
 //____________________________________________________________________
 void AliCFGridSparse::SetAxisRange(TAxis* axis, Double_t min, Double_t max, Bool_t useBins) const {
   //
@@ -712,9 +1103,9 @@ void AliCFGridSparse::SetRangeUser(Int_t iVar, Double_t varMin, Double_t varMax,
   //
   // set range of axis iVar. 
   //
-  SetAxisRange(fData->GetAxis(iVar),varMin,varMax,useBins);
+  SetAxisRange(GetGrid()->GetAxis(iVar),varMin,varMax,useBins);
 	//AliInfo(Form("AliCFGridSparse axis %d range has been modified",iVar));
-	TAxis* currAxis = fData->GetAxis(iVar);
+	TAxis* currAxis = GetGrid()->GetAxis(iVar);
   TString outString = Form("%s new range: %.1f < %s < %.1f", GetName(), currAxis->GetBinLowEdge(currAxis->GetFirst()), currAxis->GetTitle(), currAxis->GetBinUpEdge(currAxis->GetLast()));
   TString binLabel = currAxis->GetBinLabel(currAxis->GetFirst());
   if ( ! binLabel.IsNull() ) {
@@ -749,8 +1140,8 @@ Float_t AliCFGridSparse::GetOverFlows(Int_t ivar, Bool_t exclusive) const
   Int_t* bin = new Int_t[GetNVar()];
   memset(bin, 0, sizeof(Int_t) * GetNVar());
   Float_t ovfl=0.;
-  for (Long64_t i = 0; i < fData->GetNbins(); i++) {
-    Double_t v = fData->GetBinContent(i, bin);
+  for (Long64_t i = 0; i < GetGrid()->GetNbins(); i++) {
+    Double_t v = GetGrid()->GetBinContent(i, bin);
     Bool_t add=kTRUE;
     if (exclusive) {
       for(Int_t j=0;j<GetNVar();j++){
@@ -775,8 +1166,8 @@ Float_t AliCFGridSparse::GetUnderFlows(Int_t ivar, Bool_t exclusive) const
   Int_t* bin = new Int_t[GetNVar()];
   memset(bin, 0, sizeof(Int_t) * GetNVar());
   Float_t unfl=0.;
-  for (Long64_t i = 0; i < fData->GetNbins(); i++) {
-    Double_t v = fData->GetBinContent(i, bin);
+  for (Long64_t i = 0; i < GetGrid()->GetNbins(); i++) {
+    Double_t v = GetGrid()->GetBinContent(i, bin);
     Bool_t add=kTRUE;
     if (exclusive) {
       for(Int_t j=0;j<GetNVar();j++){
@@ -794,6 +1185,7 @@ Float_t AliCFGridSparse::GetUnderFlows(Int_t ivar, Bool_t exclusive) const
 
 //____________________________________________________________________
 void AliCFGridSparse::Smooth() {
+  ContentChanged();
   //
   // smoothing function: TO USE WITH CARE
   //
@@ -801,5 +1193,5 @@ void AliCFGridSparse::Smooth() {
   AliInfo("Your GridSparse is going to be smoothed");
   AliInfo(Form("N TOTAL  BINS : %li",GetNBinsTotal()));
   AliInfo(Form("N FILLED BINS : %li",GetNFilledBins()));
-  AliCFUnfolding::SmoothUsingNeighbours(fData);
+  AliCFUnfolding::SmoothUsingNeighbours(GetGrid());
 }
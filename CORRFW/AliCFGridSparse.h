@@ -5,6 +5,7 @@
 // AliCFGridSparse.cxx Class                                          //
 // Class to handle N-dim maps for the correction Framework            // 
 // uses a THnSparse to store the grid                                 //
+// (optionally dense pages during filling, see SetDenseThreshold)     //
 // Author:S.Arcelli, silvia.arcelli@cern.ch
 //--------------------------------------------------------------------//
 
@@ -13,6 +14,10 @@
 #include "AliLog.h"
 #include "TAxis.h"
 
+class TObjArray;
+class TList;
+class TH1;
+
 class TH1D;
 class TH2D;
 class TH3D;
@@ -37,7 +42,7 @@ class AliCFGridSparse : public AliCFFrame
   virtual void       GetBinLimits(Int_t ivar, Double_t * array) const ;
   virtual Double_t * GetBinLimits(Int_t ivar) const ;
   virtual Long_t     GetNBinsTotal() const ;
-  virtual Long_t     GetNFilledBins() const {return fData->GetNbins();}
+  virtual Long_t     GetNFilledBins() const {return GetGrid()->GetNbins();}
   virtual Int_t      GetNBins(Int_t ivar) const {return fData->GetAxis(ivar)->GetNbins();}
   virtual Int_t *    GetNBins() const ;
   virtual Float_t    GetBinCenter(Int_t ivar,Int_t ibin) const ;
@@ -99,8 +104,20 @@ class AliCFGridSparse : public AliCFFrame
   //virtual Double_t GetIntegral(const Double_t *varMin, const Double_t *varMax) const;
   virtual Long64_t Merge(TCollection* list);
 
-  virtual void     SetGrid(THnSparse* grid) {if (fData) delete fData ; fData=grid;}
-  THnSparse   *    GetGrid() const {return fData;}
+  virtual void     SetGrid(THnSparse* grid) {DeleteDensePages(); if (fData) delete fData ; fData=grid;}
+  THnSparse   *    GetGrid() const {FlushDensePages(); return fData;}
+
+  // adaptive storage: fill dense pages once the occupancy exceeds threshold (<=0 : disabled)
+  virtual void     SetDenseThreshold(Float_t threshold);
+  Float_t          GetDenseThreshold() const {return fDenseThreshold;}
+  Bool_t           IsDense() const {return fDensePages!=0x0;}
+
+  // LRU cache of projections with a memory budget in bytes (0 : disabled)
+  virtual void     SetProjectionCacheSize(Long64_t size);
+  Long64_t         GetProjectionCacheSize() const {return fProjCacheSize;}
+  virtual void     ClearProjectionCache() const;
+  UInt_t           GetContentVersion() const {return fContentVersion;} // changes whenever the content changes
+  void             ContentChanged(); // to be called after modifying GetGrid() directly
 
   virtual Float_t GetOverFlows (Int_t var, Bool_t excl=kFALSE) const;
   virtual Float_t GetUnderFlows(Int_t var, Bool_t excl=kFALSE) const;
@@ -118,10 +135,31 @@ class AliCFGridSparse : public AliCFFrame
   void     SetAxisRange(TAxis* axis, Double_t min, Double_t max, Bool_t useBins) const;
   void     GetProjectionName (TString& s,Int_t var0, Int_t var1=-1, Int_t var2=-1) const;
   void     GetProjectionTitle(TString& s,Int_t var0, Int_t var1=-1, Int_t var2=-1) const;
+  void     SwitchToDense();
+  void     FillDense(const Double_t *var, Double_t weight);
+  void     AddDenseContent(Long64_t index, Double_t val, Double_t err2);
+  Long64_t GetDenseIndex(const Int_t *bin) const;
+  void     FlushDensePages() const;
+  void     DeleteDensePages();
+  TString  GetProjectionCacheKey(Int_t iVar1, Int_t iVar2, Int_t iVar3, const Double_t *varMin, const Double_t *varMax, Bool_t useBins) const;
+  TH1*     FindCachedProjection(const TString& key) const;
+  void     AddCachedProjection(const TString& key, const TH1* projection) const;
+  void     ShrinkProjectionCache();
+  Long64_t GetProjectionSize(const TH1* projection) const;
+
+  static const Int_t fgkDensePageSize = 16384; // number of bins per dense page
 
   // data members:
   Bool_t      fSumW2    ; // Flag to check if calculation of squared weights enabled
   THnSparse  *fData     ; // The data Container: a THnSparse  
+  Float_t     fDenseThreshold ; //! occupancy above which fills go to the dense pages (<=0: disabled)
+  TObjArray  *fDensePages     ; //! pages (TArrayF) of bin contents not yet moved into fData, 0 in sparse mode
+  TObjArray  *fDenseErrors    ; //! pages (TArrayF) of squared errors, only with errors enabled
+  Double_t    fDenseEntries   ; //! entries filled into the pages not yet moved into fData
+  Long64_t    fProjCacheSize  ; //! memory budget of the projection cache in bytes (0: disabled)
+  Long64_t    fProjCacheUsed  ; //! memory used by the cached projections
+  TList      *fProjCache      ; //! cached projections (TList named after the key, holding the histogram), most recently used first
+  UInt_t      fContentVersion ; //! incremented whenever the content changes
 
   ClassDef(AliCFGridSparse,3);
 };
@@ -21,6 +21,8 @@
 // efficiency calculation.
 // prototype version by S.Arcelli silvia.arcelli@cern.ch
 ///////////////////////////////////////////////////////////////////////////
+#include <vector>
+
 #include "AliCFCutBase.h"
 #include "AliCFManager.h"
 
@@ -115,6 +117,51 @@ Bool_t AliCFManager::CheckParticleCuts(Int_t isel, TObject *obj, const TString
   return kTRUE;
 }
 
+//_____________________________________________________________________________
+Int_t AliCFManager::CheckParticleSteps(TObject *obj, const TString  &selcuts) const {
+  //
+  // returns the highest particle-level selection step passed by obj, i.e.
+  // obj passes the cuts of all the steps up to it (same as calling
+  // CheckParticleCuts for the steps 0,1,.. until it fails), -1 if none.
+  // The result of each cut object is kept, so that a cut shared by several
+  // steps is evaluated (and fills its QA histograms) only once.
+  //
+  if(!fPartCutList)return fNStepPart-1;
+  std::vector<const AliCFCutBase*> evaluated;
+  std::vector<Bool_t> selected;
+  for(Int_t isel=0;isel<fNStepPart;isel++){
+    if(!fPartCutList[isel])continue;
+    TObjArrayIter iter(fPartCutList[isel]);
+    AliCFCutBase *cut = 0;
+    while ( (cut = (AliCFCutBase*)iter.Next()) ) {
+      TString cutName=cut->GetName();
+      if(!CompareStrings(cutName,selcuts))continue;
+      UInt_t icut=0;
+      while(icut<evaluated.size() && evaluated[icut]!=cut)icut++;
+      if(icut==evaluated.size()){
+	evaluated.push_back(cut);
+	selected.push_back(cut->IsSelected(obj));
+      }
+      if(!selected[icut])return isel-1;
+    }
+  }
+  return fNStepPart-1;
+}
+//_____________________________________________________________________________
+Int_t AliCFManager::FillParticleSteps(TObject *obj, const Double_t *var, Double_t weight, const TString  &selcuts) const {
+  //
+  // checks the particle-level selection steps as CheckParticleSteps and
+  // fills the particle container with var for all the steps passed.
+  // Returns the highest step passed, -1 if none.
+  //
+  Int_t lastStep=CheckParticleSteps(obj,selcuts);
+  if(!fPartContainer){
+    if(lastStep>=0)AliWarning("No particle container defined");
+    return lastStep;
+  }
+  for(Int_t isel=0;isel<=lastStep;isel++)fPartContainer->Fill(var,isel,weight);
+  return lastStep;
+}
 //_____________________________________________________________________________
 Bool_t AliCFManager::CheckEventCuts(Int_t isel, TObject *obj, const TString  &selcuts) const{
   //
@@ -116,6 +116,15 @@ class AliCFManager : public TNamed
   virtual Bool_t CheckEventCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
   virtual Bool_t CheckParticleCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
 
+  //Checks all the particle-level selection steps in sequence and returns the
+  //highest step passed by obj (the cuts of all the lower steps are passed
+  //as well), -1 if not even the first one. A cut object used in several
+  //steps is evaluated only once.
+  virtual Int_t  CheckParticleSteps(TObject *obj, const TString &selcuts="all") const;
+  //Same as CheckParticleSteps, in addition the particle container is
+  //filled with var for all the steps passed
+  virtual Int_t  FillParticleSteps(TObject *obj, const Double_t *var, Double_t weight=1., const TString &selcuts="all") const;
+
  private:
   
   //number of steps
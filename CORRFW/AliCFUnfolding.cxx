@@ -130,7 +130,24 @@ AliCFUnfolding::AliCFUnfolding() :
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(0)
+  fRandomSeed(0),
+  fCompact(kFALSE),
+  fNBinsM(),
+  fNBinsT(),
+  fCondValue(),
+  fCondM(),
+  fCondT(),
+  fCondInv(),
+  fInvM(),
+  fInvT(),
+  fPriorTimesEffT(),
+  fEfficiencyT(),
+  fMeasuredM(),
+  fEstMeasuredM(),
+  fUnfoldedSumT(),
+  fUnfoldedLastT(),
+  fFilledM(),
+  fFilledT()
 {
   //
   // default constructor
@@ -174,7 +191,24 @@ AliCFUnfolding::AliCFUnfolding(const Char_t* name, const Char_t* title, const In
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(randomSeed)
+  fRandomSeed(randomSeed),
+  fCompact(kFALSE),
+  fNBinsM(),
+  fNBinsT(),
+  fCondValue(),
+  fCondM(),
+  fCondT(),
+  fCondInv(),
+  fInvM(),
+  fInvT(),
+  fPriorTimesEffT(),
+  fEfficiencyT(),
+  fMeasuredM(),
+  fEstMeasuredM(),
+  fUnfoldedSumT(),
+  fUnfoldedLastT(),
+  fFilledM(),
+  fFilledT()
 {
   //
   // named constructor
@@ -274,6 +308,8 @@ void AliCFUnfolding::Init() {
   fDeltaUnfoldedN->SetTitle("");
   fDeltaUnfoldedN->Reset();
 
+  // flat arrays for the bayes iterations
+  InitCompact();
 
 }
 
@@ -355,9 +391,12 @@ void AliCFUnfolding::Unfold() {
 
   for (iIterBayes=0; iIterBayes<fMaxNumIterations; iIterBayes++) { // bayes iterations
 
-    CreateEstMeasured(); // create measured estimate from prior
-    CreateInvResponse(); // create inverse response  from prior
-    CreateUnfolded();    // create unfoled spectrum  from measured and inverse response
+    if (fCompact) IterateCompact(); // same as below, on flat arrays
+    else {
+      CreateEstMeasured(); // create measured estimate from prior
+      CreateInvResponse(); // create inverse response  from prior
+      CreateUnfolded();    // create unfoled spectrum  from measured and inverse response
+    }
 
     convergence = GetConvergence();
     AliDebug(0,Form("convergence at iteration %d is %e",iIterBayes,convergence));
@@ -443,6 +482,189 @@ void AliCFUnfolding::CreateUnfolded() {
 
 //______________________________________________________________
 
+void AliCFUnfolding::InitCompact() {
+  //
+  // Builds the compact representation of the bayes iterations :
+  // the content and the (measured,true) cells of the bins of the conditional matrix,
+  // which does not change, and the cells of the bins of the inverse response matrix
+  // are stored in flat arrays, the spectra are copied to flat arrays over all the cells
+  // (including under/overflows) of the measured and true spaces.
+  // An iteration is then a loop over these arrays, with one access per cell to the THnSparse.
+  // Not used if the measured or true space has too many cells.
+  //
+
+  const Double_t kMaxCells = 1.e7 ;
+
+  fCompact = kFALSE ;
+  fNBinsM.Set(fNVariables);
+  fNBinsT.Set(fNVariables);
+  Double_t nCellsM = 1., nCellsT = 1. ;
+  for (Int_t iVar=0; iVar<fNVariables; iVar++) {
+    fNBinsM[iVar] = fMeasured->GetAxis(iVar)->GetNbins() + 2 ;
+    fNBinsT[iVar] = fPrior   ->GetAxis(iVar)->GetNbins() + 2 ;
+    nCellsM *= fNBinsM[iVar] ;
+    nCellsT *= fNBinsT[iVar] ;
+  }
+  if (nCellsM > kMaxCells || nCellsT > kMaxCells || fConditional->GetNbins() > kMaxInt || fInverseResponse->GetNbins() > kMaxInt) {
+    AliInfo(Form("%e measured and %e true cells : the iterations are done on the THnSparse",nCellsM,nCellsT));
+    return;
+  }
+
+  const Int_t nCond = fConditional->GetNbins();
+  fCondValue.Set(nCond);
+  fCondM    .Set(nCond);
+  fCondT    .Set(nCond);
+  fCondInv  .Set(nCond);
+  for (Int_t iBin=0; iBin<nCond; iBin++) {
+    fCondValue[iBin] = fConditional->GetBinContent(iBin,fCoordinates2N);
+    GetCoordinates();
+    fCondM[iBin]   = GetCell(fCoordinatesN_M,fNBinsM);
+    fCondT[iBin]   = GetCell(fCoordinatesN_T,fNBinsT);
+    fCondInv[iBin] = fInverseResponse->GetBin(fCoordinates2N,kFALSE);
+    if (fCondInv[iBin]<0) {
+      AliInfo("inverse response and conditional matrix have different bins : the iterations are done on the THnSparse");
+      return;
+    }
+  }
+
+  const Int_t nInv = fInverseResponse->GetNbins();
+  fInvM.Set(nInv);
+  fInvT.Set(nInv);
+  for (Int_t iBin=0; iBin<nInv; iBin++) {
+    fInverseResponse->GetBinContent(iBin,fCoordinates2N);
+    GetCoordinates();
+    fInvM[iBin] = GetCell(fCoordinatesN_M,fNBinsM);
+    fInvT[iBin] = GetCell(fCoordinatesN_T,fNBinsT);
+  }
+
+  fPriorTimesEffT.Set((Int_t)nCellsT);
+  fEfficiencyT   .Set((Int_t)nCellsT);
+  fUnfoldedSumT  .Set((Int_t)nCellsT);
+  fUnfoldedLastT .Set((Int_t)nCellsT);
+  fFilledT       .Set((Int_t)nCellsT);
+  fMeasuredM     .Set((Int_t)nCellsM);
+  fEstMeasuredM  .Set((Int_t)nCellsM);
+  fFilledM       .Set((Int_t)nCellsM);
+
+  fCompact = kTRUE ;
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::IterateCompact() {
+  //
+  // One bayes iteration on the compact representation built in InitCompact :
+  // same as CreateEstMeasured(), CreateInvResponse() and CreateUnfolded(), in the same order.
+  // The sums over the bins of the matrices are done in double precision on the flat arrays,
+  // and are then written once per cell to fMeasuredEstimate and fUnfolded.
+  //
+
+  THnSparse* priorTimesEff = (THnSparse*) fPrior->Clone();
+  priorTimesEff->Multiply(fEfficiency);
+  FillCells(priorTimesEff,fNBinsT,fPriorTimesEffT);
+  delete priorTimesEff ;
+
+  // --> M(i) = SUM_k { COND(i,k) * T(k) * E (k)}
+  fEstMeasuredM.Reset();
+  Int_t nFilledM = 0 ;
+  const Int_t nCond = fCondValue.GetSize();
+  for (Int_t iBin=0; iBin<nCond; iBin++) {
+    Double_t fill = fCondValue[iBin] * fPriorTimesEffT[fCondT[iBin]] ;
+    if (fill>0.) {
+      Int_t cellM = fCondM[iBin] ;
+      if (fEstMeasuredM[cellM]==0.) fFilledM[nFilledM++] = cellM ;
+      fEstMeasuredM[cellM] += fill ;
+    }
+  }
+  fMeasuredEstimate->Reset();
+  for (Int_t iCell=0; iCell<nFilledM; iCell++) {
+    GetCellCoordinates(fFilledM[iCell],fNBinsM,fCoordinatesN_M);
+    fMeasuredEstimate->AddBinContent(fCoordinatesN_M,fEstMeasuredM[fFilledM[iCell]]);
+    fMeasuredEstimate->SetBinError(fCoordinatesN_M,0.);
+  }
+  FillCells(fMeasuredEstimate,fNBinsM,fEstMeasuredM); // values as stored
+
+  // --> INV(i,j) = COND(i,j) * T(j) * E(j)   / SUM_k { COND(i,k) * T(k) }
+  for (Int_t iBin=0; iBin<nCond; iBin++) {
+    Double_t estMeasuredValue = fEstMeasuredM[fCondM[iBin]] ;
+    Double_t fill = (estMeasuredValue>0. ? fCondValue[iBin] * fPriorTimesEffT[fCondT[iBin]] / estMeasuredValue : 0. ) ;
+    Long64_t bin = fCondInv[iBin] ;
+    if (fill>0. || fInverseResponse->GetBinContent(bin)>0.) {
+      fInverseResponse->SetBinContent(bin,fill);
+      fInverseResponse->SetBinError2 (bin,0.);
+    }
+  }
+
+  // --> T(i) = SUM_k { INV(i,k) * M(k) }
+  FillCells(fEfficiency,fNBinsT,fEfficiencyT);
+  FillCells(fMeasured,fNBinsM,fMeasuredM);
+  fUnfoldedSumT .Reset();
+  fUnfoldedLastT.Reset();
+  Int_t nFilledT = 0 ;
+  const Int_t nInv = fInvM.GetSize();
+  for (Int_t iBin=0; iBin<nInv; iBin++) {
+    Int_t cellT = fInvT[iBin] ;
+    Double_t effValue = fEfficiencyT[cellT] ;
+    Double_t fill = (effValue>0. ? fInverseResponse->GetBinContent(iBin) * fMeasuredM[fInvM[iBin]] / effValue : 0.) ;
+    if (fill>0.) {
+      if (fUnfoldedLastT[cellT]>0.) fUnfoldedSumT[cellT] += fUnfoldedLastT[cellT] ;
+      else fFilledT[nFilledT++] = cellT ;
+      fUnfoldedLastT[cellT] = fill ;
+    }
+  }
+  // as in CreateUnfolded, the error of a cell is the one set with its last contribution
+  fUnfolded->Reset();
+  for (Int_t iCell=0; iCell<nFilledT; iCell++) {
+    Int_t cellT = fFilledT[iCell] ;
+    GetCellCoordinates(cellT,fNBinsT,fCoordinatesN_T);
+    if (fUnfoldedSumT[cellT]>0.) {
+      fUnfolded->SetBinError  (fCoordinatesN_T,0.);
+      fUnfolded->AddBinContent(fCoordinatesN_T,fUnfoldedSumT[cellT]);
+    }
+    fUnfolded->SetBinError  (fCoordinatesN_T,0.);
+    fUnfolded->AddBinContent(fCoordinatesN_T,fUnfoldedLastT[cellT]);
+  }
+}
+
+//______________________________________________________________
+
+Int_t AliCFUnfolding::GetCell(const Int_t* coord, const TArrayI& nbins) const {
+  //
+  // returns the cell of the coordinates coord in a flat array over all the cells
+  // (nbins = number of bins + 2 of each variable)
+  //
+  Int_t cell = 0 ;
+  for (Int_t iVar=fNVariables-1; iVar>=0; iVar--) cell = cell * nbins[iVar] + coord[iVar] ;
+  return cell ;
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::GetCellCoordinates(Int_t cell, const TArrayI& nbins, Int_t* coord) const {
+  //
+  // inverse of GetCell
+  //
+  for (Int_t iVar=0; iVar<fNVariables; iVar++) {
+    coord[iVar] = cell % nbins[iVar] ;
+    cell /= nbins[iVar] ;
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::FillCells(const THnSparse* h, const TArrayI& nbins, TArrayD& cells) {
+  //
+  // copies the content of the N-dim. spectrum h to the flat array cells (empty cells are 0)
+  //
+  cells.Reset();
+  for (Long_t iBin=0; iBin<h->GetNbins(); iBin++) {
+    Double_t value = h->GetBinContent(iBin,fCoordinatesN_M);
+    cells[GetCell(fCoordinatesN_M,nbins)] = value ;
+  }
+}
+
+//______________________________________________________________
+
 void AliCFUnfolding::CalculateCorrelatedErrors() {
 
   // Step 1: Create randomized distribution (fRandomXXXX) of each bin of 
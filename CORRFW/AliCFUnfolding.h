@@ -12,6 +12,9 @@
 
 #include "TNamed.h"
 #include "THnSparse.h"
+#include "TArrayD.h"
+#include "TArrayI.h"
+#include "TArrayL64.h"
 #include "AliLog.h"
 
 class TF1;
@@ -112,6 +115,25 @@ class AliCFUnfolding : public TNamed {
   Short_t        fNCalcCorrErrors;   // Book-keeping to prevend infinite loop
   UInt_t         fRandomSeed;        // Random seed
 
+  /* compact representation of the bayes iterations, built once in Init */
+  Bool_t         fCompact;           //! iterations done on the arrays below instead of THnSparse lookups
+  TArrayI        fNBinsM;            //! number of bins + 2 of each variable in measured space
+  TArrayI        fNBinsT;            //! number of bins + 2 of each variable in true space
+  TArrayD        fCondValue;         //! content of each bin of the conditional matrix
+  TArrayI        fCondM;             //! measured cell of each bin of the conditional matrix
+  TArrayI        fCondT;             //! true cell of each bin of the conditional matrix
+  TArrayL64      fCondInv;           //! bin of the inverse response matrix with the coordinates of each bin of the conditional matrix
+  TArrayI        fInvM;              //! measured cell of each bin of the inverse response matrix
+  TArrayI        fInvT;              //! true cell of each bin of the inverse response matrix
+  TArrayD        fPriorTimesEffT;    //! prior x efficiency per true cell
+  TArrayD        fEfficiencyT;       //! efficiency per true cell
+  TArrayD        fMeasuredM;         //! measured spectrum per measured cell
+  TArrayD        fEstMeasuredM;      //! measured estimate per measured cell
+  TArrayD        fUnfoldedSumT;      //! unfolded spectrum per true cell, without the last contribution
+  TArrayD        fUnfoldedLastT;     //! last contribution to the unfolded spectrum per true cell
+  TArrayI        fFilledM;           //! measured cells of the estimate, in the order they are filled
+  TArrayI        fFilledT;           //! true cells of the unfolded spectrum, in the order they are filled
+
 
   // functions
   void     Init();                  // initialisation of the internal settings
@@ -120,6 +142,11 @@ class AliCFUnfolding : public TNamed {
   void     CreateEstMeasured();     // creates the measured spectrum estimation from the conditional matrix and the prior distribution
   void     CreateInvResponse();     // creates the inverse response function (Bayes Theorem) from the conditional matrix and the prior distribution
   void     CreateUnfolded();        // creates the unfolded spectrum from the inverse response matrix and the measured distribution
+  void     InitCompact();           // builds the compact representation of the bayes iterations
+  void     IterateCompact();        // CreateEstMeasured, CreateInvResponse and CreateUnfolded on the compact representation
+  Int_t    GetCell(const Int_t* coord, const TArrayI& nbins) const; // cell of coordinates coord in a flat array
+  void     GetCellCoordinates(Int_t cell, const TArrayI& nbins, Int_t* coord) const; // coordinates of a cell
+  void     FillCells(const THnSparse* h, const TArrayI& nbins, TArrayD& cells); // copies the content of h to a flat array
   void     CreateFlatPrior();       // creates a flat a priori distribution in case the one given in the constructor is null
   Double_t GetChi2();               // returns the chi2 between unfolded and prior spectra
   Short_t  Smooth();                // function calling smoothing methods
@@ -132,7 +159,7 @@ class AliCFUnfolding : public TNamed {
   void     FillDeltaUnfoldedProfile();  // Fills the fDeltaUnfoldedP profile
   void     SetMaxConvergencePerDOF (Double_t val);
 
-  ClassDef(AliCFUnfolding,1);
+  ClassDef(AliCFUnfolding,2);
 };
 
 #endif
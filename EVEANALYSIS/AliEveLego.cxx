@@ -30,6 +30,7 @@
 #include "TEveProjectionAxes.h"
 #include "TGLWidget.h"
 #include "TStopwatch.h"
+#include "TTree.h"
 
 //______________________________________________________________________________
 // This class provides the following features:
@@ -99,7 +100,17 @@ AliEveLego::AliEveLego(const char* name) :
   fAl(0),
   fHisto2dLegoOverlay(0),
   fHisto2dAllEventsLegoOverlay(0),
-  fHisto2dAllEventsSlot(0)
+  fHisto2dAllEventsSlot(0),
+  fCachedTreeAE(0),
+  fEventFirstTrackAE(),
+  fEventFirstPrimaryAE(),
+  fEventSelectedAE(),
+  fTrackEtaAE(),
+  fTrackPhiAE(),
+  fTrackPtAE(),
+  fTrackSignAE(),
+  fTrackTypeAE(),
+  fPrimaryTrackAE()
 {
   // Constructor.
   gEve->AddToListTree(this,0);
@@ -303,57 +314,9 @@ TEveCaloDataHist* AliEveLego::LoadData()
 TEveCaloDataHist* AliEveLego::LoadAllData()
 {
    // Load data from all events ESD
-   fHistoposAllEvents->Reset();
-   fHistonegAllEvents->Reset();
-   fHistoElectronsAllEvents->Reset();
-   fHistoMuonsAllEvents->Reset();
-   fHistoPionsAllEvents->Reset();
-   fHistoKaonsAllEvents->Reset();
-   fHistoProtonsAllEvents->Reset();
-
-   TTree* t = AliEveEventManager::GetMaster()->GetESDTree();
 
    // Getting current tracks for each event, filling histograms
-   Int_t fAcceptedEvents = 0;
-   for (int event = 0; event < t->GetEntries(); event++) {
-      t->GetEntry(event);
-
-      if (fCollisionCandidatesOnly == kTRUE)
-        if (fPhysicsSelection->IsCollisionCandidate(fEsd) == kFALSE) continue;
-
-      fAcceptedEvents++;
-
-      for (int n = 0; n < fEsd->GetNumberOfTracks(); ++n) {
-
-           AliESDtrack *track = fEsd->GetTrack(n);
-           const Double_t sign = track->GetSign();
-           const Int_t prob = GetParticleType(track);
-
-           if (sign > 0)
-             fHistoposAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-           if (sign < 0)
-             fHistonegAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-           if (prob == 0)
-             fHistoElectronsAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-           if (prob == 1)
-             fHistoMuonsAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-           if (prob == 2)
-             fHistoPionsAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-           if (prob == 3)
-             fHistoKaonsAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-           if (prob == 4)
-             fHistoProtonsAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-        }
-   }
-
-   // Setting the current view to the first event
-   t->GetEntry(0);
+   Int_t fAcceptedEvents = FillAllEventsHistograms(kFALSE);
 
    // Usefull information,
    // with this we can estimate the event efficiency
@@ -460,57 +423,8 @@ TEveCaloDataHist* AliEveLego::FilterAllData()
    // Tracks selection
    if ( fTracksIdAE == 2 )
    {
-      fHistoposAllEvents->Reset();
-      fHistonegAllEvents->Reset();
-      fHistoElectronsAllEvents->Reset();
-      fHistoMuonsAllEvents->Reset();
-      fHistoPionsAllEvents->Reset();
-      fHistoKaonsAllEvents->Reset();
-      fHistoProtonsAllEvents->Reset();
-
-      TTree* t = AliEveEventManager::GetMaster()->GetESDTree();
-
       // Getting current tracks for each event, filling histograms
-      Int_t fAcceptedEvents = 0;
-      for (int event = 0; event < t->GetEntries(); event++) {
-
-        t->GetEntry(event);
-        const AliESDVertex *pv  = fEsd->GetPrimaryVertex();
-
-        if (fCollisionCandidatesOnly == kTRUE)
-          if (fPhysicsSelection->IsCollisionCandidate(fEsd) == kFALSE) continue;
-
-        fAcceptedEvents++;
-
-        for (Int_t n = 0; n < pv->GetNIndices(); n++ )
-        {
-          AliESDtrack *at = fEsd->GetTrack(pv->GetIndices()[n]);
-          const Double_t sign = at->GetSign();
-          const Int_t prob = GetParticleType(at);
-
-          if (sign > 0)
-            fHistoposAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-          if (sign < 0)
-            fHistonegAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-          if (prob == 0)
-            fHistoElectronsAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-          if (prob == 1)
-            fHistoMuonsAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-          if (prob == 2)
-            fHistoPionsAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-          if (prob == 3)
-            fHistoKaonsAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-          if (prob == 4)
-            fHistoProtonsAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-        }
-      }
-      t->GetEntry(0);
+      Int_t fAcceptedEvents = FillAllEventsHistograms(kTRUE);
       printf("Number of events loaded: %i, with AliPhysicsSelection: %i\n",fAcceptedEvents,fCollisionCandidatesOnly);
 
    } else {
@@ -566,6 +480,108 @@ TEveCaloDataHist* AliEveLego::FilterAllData()
    return fDataAllEvents;
 }
 
+//______________________________________________________________________________
+void AliEveLego::CacheAllEvents()
+{
+   // Read the tracks of all events once from the ESD tree, the all events
+   // histograms are then refilled from the cache on any change of the settings
+   TTree* t = AliEveEventManager::GetMaster()->GetESDTree();
+   if (t == fCachedTreeAE && Long64_t(fEventSelectedAE.size()) == t->GetEntries()) return;
+
+   fCachedTreeAE = t;
+   fEventFirstTrackAE.assign(1, 0);
+   fEventFirstPrimaryAE.assign(1, 0);
+   fEventSelectedAE.clear();
+   fTrackEtaAE.clear();
+   fTrackPhiAE.clear();
+   fTrackPtAE.clear();
+   fTrackSignAE.clear();
+   fTrackTypeAE.clear();
+   fPrimaryTrackAE.clear();
+
+   for (int event = 0; event < t->GetEntries(); event++) {
+      t->GetEntry(event);
+
+      const Int_t first = fTrackEtaAE.size();
+      for (int n = 0; n < fEsd->GetNumberOfTracks(); ++n) {
+         AliESDtrack *track = fEsd->GetTrack(n);
+         const Double_t sign = track->GetSign();
+         fTrackEtaAE.push_back(track->Eta());
+         fTrackPhiAE.push_back(getphi(track->Phi()));
+         fTrackPtAE.push_back(fabs(track->Pt()));
+         fTrackSignAE.push_back(sign > 0 ? 1 : (sign < 0 ? -1 : 0));
+         fTrackTypeAE.push_back(GetParticleType(track));
+      }
+
+      const AliESDVertex *pv  = fEsd->GetPrimaryVertex();
+      for (Int_t n = 0; n < pv->GetNIndices(); n++ )
+         fPrimaryTrackAE.push_back(first + pv->GetIndices()[n]);
+
+      fEventFirstTrackAE.push_back(fTrackEtaAE.size());
+      fEventFirstPrimaryAE.push_back(fPrimaryTrackAE.size());
+      fEventSelectedAE.push_back(-1);
+   }
+
+   // Setting the current view to the first event
+   t->GetEntry(0);
+}
+
+//______________________________________________________________________________
+Int_t AliEveLego::FillAllEventsHistograms(Bool_t primaryTracks)
+{
+   // Fill the all events histograms from the cached tracks, all tracks or
+   // only the primary vertex ones, returns the number of accepted events
+   CacheAllEvents();
+
+   fHistoposAllEvents->Reset();
+   fHistonegAllEvents->Reset();
+   fHistoElectronsAllEvents->Reset();
+   fHistoMuonsAllEvents->Reset();
+   fHistoPionsAllEvents->Reset();
+   fHistoKaonsAllEvents->Reset();
+   fHistoProtonsAllEvents->Reset();
+
+   TH2F* histoType[5] = { fHistoElectronsAllEvents, fHistoMuonsAllEvents, fHistoPionsAllEvents,
+                          fHistoKaonsAllEvents, fHistoProtonsAllEvents };
+
+   Bool_t reread = kFALSE;
+   Int_t fAcceptedEvents = 0;
+   const Int_t nEvents = fEventSelectedAE.size();
+   for (Int_t event = 0; event < nEvents; event++) {
+
+      if (fCollisionCandidatesOnly == kTRUE) {
+         // the physics selection needs the full event, evaluated once per event
+         if (fEventSelectedAE[event] < 0) {
+            fCachedTreeAE->GetEntry(event);
+            reread = kTRUE;
+            fEventSelectedAE[event] = fPhysicsSelection->IsCollisionCandidate(fEsd) ? 1 : 0;
+         }
+         if (fEventSelectedAE[event] == 0) continue;
+      }
+
+      fAcceptedEvents++;
+
+      const Int_t first = primaryTracks ? fEventFirstPrimaryAE[event] : fEventFirstTrackAE[event];
+      const Int_t last  = primaryTracks ? fEventFirstPrimaryAE[event+1] : fEventFirstTrackAE[event+1];
+      for (Int_t i = first; i < last; i++) {
+         const Int_t n = primaryTracks ? fPrimaryTrackAE[i] : i;
+
+         if (fTrackSignAE[n] > 0)
+           fHistoposAllEvents->Fill(fTrackEtaAE[n], fTrackPhiAE[n], fTrackPtAE[n]);
+
+         if (fTrackSignAE[n] < 0)
+           fHistonegAllEvents->Fill(fTrackEtaAE[n], fTrackPhiAE[n], fTrackPtAE[n]);
+
+         histoType[Int_t(fTrackTypeAE[n])]->Fill(fTrackEtaAE[n], fTrackPhiAE[n], fTrackPtAE[n]);
+      }
+   }
+
+   // Setting the current view to the first event
+   if (reread) fCachedTreeAE->GetEntry(0);
+
+   return fAcceptedEvents;
+}
+
 //______________________________________________________________________________
 void AliEveLego::Update()
 {
@@ -955,6 +971,9 @@ void AliEveLego::SwitchDataType(Bool_t status)
   fPhysicsSelection = new AliPhysicsSelection();
   fPhysicsSelection->SetAnalyzeMC(fIsMC);
   fPhysicsSelection->Initialize(fEsd);
+
+  // The collision candidates have to be evaluated again
+  fEventSelectedAE.assign(fEventSelectedAE.size(), -1);
   FilterAllData();
 }
 
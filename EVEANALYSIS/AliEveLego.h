@@ -10,6 +10,8 @@
 #ifndef ALIEVELEGO_H
 #define ALIEVELEGO_H
 
+#include <vector>
+
 #include "TEveElement.h"
 
 class AliESDEvent;
@@ -28,6 +30,7 @@ class TEveWindowSlot;
 class TGLOverlayButton;
 class TGLViewer;
 class TH2F;
+class TTree;
 
 //______________________________________________________________________________
 // 2D & 3D calorimeter like histograms from the ESD data.
@@ -81,6 +84,9 @@ public:
 
 
 private:
+  void                CacheAllEvents();
+  Int_t               FillAllEventsHistograms(Bool_t primaryTracks);
+
   Bool_t              fIsMC;                    // Switch to MC mode for AliPhysicsSelection
   Bool_t              fCollisionCandidatesOnly; // Activate flag when loading all events
   Bool_t              *fParticleTypeId;         // Determine how particles to show
@@ -128,6 +134,18 @@ private:
   TEveCaloLegoOverlay *fHisto2dAllEventsLegoOverlay; // Overlay for calo lego all events
   TEveWindowSlot      *fHisto2dAllEventsSlot;   // Window slot for 2d all events histogram
 
+  // Tracks of all events, read once from the ESD tree for the all events histograms
+  TTree               *fCachedTreeAE;           //! ESD tree of the cached tracks
+  std::vector<Int_t>   fEventFirstTrackAE;      //! first cached track of each event, one more entry for the end
+  std::vector<Int_t>   fEventFirstPrimaryAE;    //! first primary vertex track of each event, one more entry for the end
+  std::vector<Char_t>  fEventSelectedAE;        //! collision candidate flag of each event, -1 if not evaluated
+  std::vector<Double_t> fTrackEtaAE;            //! eta of the cached tracks
+  std::vector<Double_t> fTrackPhiAE;            //! phi of the cached tracks, in [-pi, pi]
+  std::vector<Double_t> fTrackPtAE;             //! |pT| of the cached tracks
+  std::vector<Char_t>  fTrackSignAE;            //! sign of the charge of the cached tracks
+  std::vector<Char_t>  fTrackTypeAE;            //! particle type of the cached tracks (GetParticleType)
+  std::vector<Int_t>   fPrimaryTrackAE;         //! cached tracks used for the primary vertex
+
   AliEveLego(const AliEveLego&);                // Not implemented
   AliEveLego& operator=(const AliEveLego&);     // Not implemented
 
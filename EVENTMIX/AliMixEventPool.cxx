@@ -8,7 +8,11 @@
 //        Martin Vala (martin.vala@cern.ch)
 //
 
+#include <algorithm>
+#include <utility>
+
 #include <TEntryList.h>
+#include <TMath.h>
 
 #include "AliLog.h"
 #include "AliMixEventCutObj.h"
@@ -23,7 +27,14 @@ AliMixEventPool::AliMixEventPool(const char *name, const char *title) : TNamed(n
    fListOfEventCuts(),
    fBinNumber(0),
    fBufferSize(0),
-   fMixNumber(0)
+   fMixNumber(0),
+   fNearestWindow(0),
+   fNearestNumber(0),
+   fWindowEntries(),
+   fWindowValues(),
+   fWindowNext(0),
+   fLastEntry(-1),
+   fNearestEntryList()
 {
    //
    // Default constructor.
@@ -37,7 +48,14 @@ AliMixEventPool::AliMixEventPool(const AliMixEventPool &obj) : TNamed(obj),
    fListOfEventCuts(obj.fListOfEventCuts),
    fBinNumber(obj.fBinNumber),
    fBufferSize(obj.fBufferSize),
-   fMixNumber(obj.fMixNumber)
+   fMixNumber(obj.fMixNumber),
+   fNearestWindow(obj.fNearestWindow),
+   fNearestNumber(obj.fNearestNumber),
+   fWindowEntries(),
+   fWindowValues(),
+   fWindowNext(0),
+   fLastEntry(-1),
+   fNearestEntryList()
 {
    //
    // Copy constructor
@@ -59,6 +77,12 @@ AliMixEventPool &AliMixEventPool::operator=(const AliMixEventPool &obj)
       fBinNumber = obj.fBinNumber;
       fBufferSize = obj.fBufferSize;
       fMixNumber = obj.fMixNumber;
+      fNearestWindow = obj.fNearestWindow;
+      fNearestNumber = obj.fNearestNumber;
+      fWindowEntries.clear();
+      fWindowValues.clear();
+      fWindowNext = 0;
+      fLastEntry = -1;
    }
    return *this;
 }
@@ -93,6 +117,7 @@ void AliMixEventPool::Print(const Option_t *option) const
    while ((cut = (AliMixEventCutObj *) next())) {
       cut->Print(option);
    }
+   if (IsNearestEventMixing()) AliInfo(Form("Nearest event mixing: %d nearest of last %d events", fNearestNumber, fNearestWindow));
    AliDebug(AliLog::kDebug, Form("NumOfEntryList %d", fListOfEntryList.GetEntries()));
    TEntryList *el;
    for (Int_t i = 0; i < fListOfEntryList.GetEntries(); i++) {
@@ -174,6 +199,27 @@ Bool_t AliMixEventPool::AddEntry(Long64_t entry, AliVEvent *ev)
       return kFALSE;
    }
    Int_t idEntryList = -1;
+   if (IsNearestEventMixing()) {
+      // keep the event in the window of recent events
+      if (!FindBinEntryList(ev, idEntryList)) {
+         AliDebug(AliLog::kDebug, Form("Entry %lld was NOT added !!!", entry));
+         return kFALSE;
+      }
+      Int_t numCuts = fListOfEventCuts.GetEntriesFast();
+      if ((Int_t)fWindowEntries.size() < fNearestWindow) {
+         fWindowEntries.push_back(entry);
+         fWindowValues.resize(fWindowEntries.size() * numCuts);
+         fWindowNext = fWindowEntries.size() % fNearestWindow;
+         GetScaledCutValues(ev, &fWindowValues[(fWindowEntries.size() - 1) * numCuts]);
+      } else {
+         fWindowEntries[fWindowNext] = entry;
+         GetScaledCutValues(ev, &fWindowValues[fWindowNext * numCuts]);
+         fWindowNext = (fWindowNext + 1) % fNearestWindow;
+      }
+      fLastEntry = entry;
+      AliDebug(AliLog::kDebug, Form("Entry %lld was added to window (%d events) !!!", entry, (Int_t)fWindowEntries.size()));
+      return kTRUE;
+   }
    TEntryList *el =  FindEntryList(ev, idEntryList);
    if (el) {
       el->Enter(entry);
@@ -187,6 +233,65 @@ Bool_t AliMixEventPool::AddEntry(Long64_t entry, AliVEvent *ev)
 
 //_________________________________________________________________________________________________
 TEntryList *AliMixEventPool::FindEntryList(AliVEvent *ev, Int_t &idEntryList)
+{
+   //
+   // Find entry list of mixing partners (same bin or nearest events)
+   //
+   if (IsNearestEventMixing()) return FindNearestEntryList(ev, idEntryList);
+   return FindBinEntryList(ev, idEntryList);
+}
+
+//_________________________________________________________________________________________________
+void AliMixEventPool::GetScaledCutValues(AliVEvent *ev, Double_t *values)
+{
+   //
+   // Cut values of event in units of the cut steps
+   //
+   Int_t num = fListOfEventCuts.GetEntriesFast();
+   for (Int_t i = 0; i < num; i++) {
+      AliMixEventCutObj *cut = (AliMixEventCutObj *) fListOfEventCuts.At(i);
+      Double_t step = cut->GetStep();
+      values[i] = cut->GetValue(ev) / (step > 0 ? step : 1.);
+   }
+}
+
+//_________________________________________________________________________________________________
+TEntryList *AliMixEventPool::FindNearestEntryList(AliVEvent *ev, Int_t &idEntryList)
+{
+   //
+   // Entry list with the fNearestNumber events of the window closest to ev,
+   // followed by the current event (last added entry). The window is small,
+   // so a linear scan with partial sort is used. The bin index of ev is kept
+   // in idEntryList for the bookkeeping of the tasks.
+   //
+   if (!FindBinEntryList(ev, idEntryList)) return 0;
+
+   Int_t numCuts = fListOfEventCuts.GetEntriesFast();
+   std::vector<Double_t> values(numCuts);
+   GetScaledCutValues(ev, &values[0]);
+
+   std::vector<std::pair<Double_t, Long64_t> > candidates;
+   candidates.reserve(fWindowEntries.size());
+   for (UInt_t i = 0; i < fWindowEntries.size(); i++) {
+      if (fWindowEntries[i] == fLastEntry) continue;
+      const Double_t *v = &fWindowValues[i * numCuts];
+      Double_t dist2 = 0;
+      for (Int_t j = 0; j < numCuts; j++) dist2 += (v[j] - values[j]) * (v[j] - values[j]);
+      candidates.push_back(std::make_pair(dist2, fWindowEntries[i]));
+   }
+   UInt_t numNearest = TMath::Min((UInt_t) fNearestNumber, (UInt_t) candidates.size());
+   std::partial_sort(candidates.begin(), candidates.begin() + numNearest, candidates.end());
+
+   // TEntryList keeps the entries ordered, the current event is the newest one
+   fNearestEntryList.Reset();
+   for (UInt_t i = 0; i < numNearest; i++) fNearestEntryList.Enter(candidates[i].second);
+   if (fLastEntry >= 0) fNearestEntryList.Enter(fLastEntry);
+   AliDebug(AliLog::kDebug, Form("idEntryList %d nearest %d", idEntryList - 1, numNearest));
+   return &fNearestEntryList;
+}
+
+//_________________________________________________________________________________________________
+TEntryList *AliMixEventPool::FindBinEntryList(AliVEvent *ev, Int_t &idEntryList)
 {
    //
    // Find entrlist in list of entrlist
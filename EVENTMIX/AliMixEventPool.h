@@ -11,10 +11,12 @@
 #ifndef ALIMIXEVENTPOOL_H
 #define ALIMIXEVENTPOOL_H
 
+#include <vector>
+
 #include <TObjArray.h>
 #include <TNamed.h>
+#include <TEntryList.h>
 
-class TEntryList;
 class AliMixEventCutObj;
 class AliVEvent;
 class AliMixEventPool : public TNamed {
@@ -49,16 +51,34 @@ public:
    Int_t       GetBufferSize() const { return fBufferSize; }
    Int_t       GetMixNumber() const { return fMixNumber; }
 
+   // nearest event mixing: instead of using the events of the same bin, the
+   // partners are the numNearest events closest to the current one among the
+   // last windowSize accepted events (distance in units of the cut steps)
+   void        SetNearestEventMixing(Int_t windowSize, Int_t numNearest) { fNearestWindow = windowSize; fNearestNumber = numNearest; }
+   Bool_t      IsNearestEventMixing() const { return (fNearestWindow > 0 && fNearestNumber > 0); }
+
 private:
 
+   TEntryList *FindBinEntryList(AliVEvent *ev, Int_t &idEntryList);
+   TEntryList *FindNearestEntryList(AliVEvent *ev, Int_t &idEntryList);
+   void        GetScaledCutValues(AliVEvent *ev, Double_t *values);
+
    TObjArray   fListOfEntryList;       // list of entry lists
    TObjArray   fListOfEventCuts;       // list of entry lists
 
    Int_t       fBinNumber;             // bin number
    Int_t       fBufferSize;            // buffer size
    Int_t       fMixNumber;             // mixing number
+   Int_t       fNearestWindow;         // number of recent events searched for nearest partners
+   Int_t       fNearestNumber;         // number of nearest partners
+
+   std::vector<Long64_t> fWindowEntries; //! entries of the recent events (ring buffer)
+   std::vector<Double_t> fWindowValues;  //! their cut values in units of the cut steps
+   Int_t       fWindowNext;            //! next slot of the ring buffer
+   Long64_t    fLastEntry;             //! entry added last (the current event)
+   TEntryList  fNearestEntryList;      //! nearest partners of the current event and the event itself
 
-   ClassDef(AliMixEventPool, 1)
+   ClassDef(AliMixEventPool, 2)
 };
 
 #endif
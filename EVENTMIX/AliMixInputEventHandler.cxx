@@ -11,6 +11,7 @@
 #include <TChain.h>
 #include <TChainElement.h>
 #include <TSystem.h>
+#include <TMath.h>
 
 #include "AliLog.h"
 #include "AliAnalysisManager.h"
@@ -37,6 +38,8 @@ AliMixInputEventHandler::AliMixInputEventHandler(const Int_t size, const Int_t m
    fDoMixExtra(kTRUE),
    fDoMixIfNotEnoughEvents(kTRUE),
    fDoMixEventGetEntryAuto(kTRUE),
+   fReadAheadSize(0),
+   fAsyncPrefetch(kFALSE),
    fCurrentEntry(0),
    fCurrentEntryMain(0),
    fCurrentEntryMix(0),
@@ -153,6 +156,7 @@ Bool_t AliMixInputEventHandler::Notify(const char *path)
    for (Int_t i = 0; i < fInputHandlers.GetEntries(); i++) {
       AliDebug(AliLog::kDebug + 5, Form("fInputHandlers[%d]", i));
       mixIHI = new AliMixInputHandlerInfo(fMixIntupHandlerInfoTmp->GetName(), fMixIntupHandlerInfoTmp->GetTitle());
+      if (fReadAheadSize > 0) mixIHI->SetReadAhead(fReadAheadSize, fAsyncPrefetch);
       if (doPrepareEntry) mixIHI->PrepareEntry(che, -1, (AliInputEventHandler *)InputEventHandler(i), fAnalysisType);
       AliDebug(AliLog::kDebug + 5, Form("chain[%d]->GetEntries() = %lld", i, mixIHI->GetChain()->GetEntries()));
       fMixTrees.Add(mixIHI);
@@ -248,6 +252,10 @@ Bool_t AliMixInputEventHandler::MixStd()
    AliMixInputHandlerInfo *mihi = 0;
    Long64_t entryMix = 0, entryMixReal = 0;
    Int_t counter = 0;
+   if (fReadAheadSize > 0) {
+      mihi = (AliMixInputHandlerInfo *) fMixTrees.At(0);
+      if (mihi) mihi->PredictEntries(TMath::Max(fEntryCounter - mixNum, (Long64_t)0), fEntryCounter - 1);
+   }
    for (counter = 0; counter < mixNum; counter++) {
       entryMix = fEntryCounter - 1 - counter ;
       AliDebug(AliLog::kDebug + 5, Form("Handler[%d] entryMix %lld ", counter, entryMix));
@@ -456,6 +464,11 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithOneEvent()
    Long64_t entryMix = 0, entryMixReal = 0;
    Int_t counter = 0;
    mihi = (AliMixInputHandlerInfo *) fMixTrees.At(0);
+   if (fReadAheadSize > 0 && mihi && elNum >= 2) {
+      // partners are taken backwards from the entry before the current one
+      Long64_t firstInList = TMath::Max(elNum - 1 - mixNum, (Long64_t)0);
+      mihi->PredictEntries(el->GetEntry(firstInList), el->GetEntry(elNum - 2));
+   }
    // fills num for main events
    for (counter = 0; counter < mixNum; counter++) {
       fCurrentMixEntry.Reset();
@@ -11,6 +11,7 @@
 #include <TChain.h>
 #include <TFile.h>
 #include <TChainElement.h>
+#include <TEnv.h>
 
 #include "AliLog.h"
 #include "AliInputEventHandler.h"
@@ -24,7 +25,9 @@ AliMixInputHandlerInfo::AliMixInputHandlerInfo(const char *name, const char *tit
    fChain(0),
    fChainEntriesArray(),
    fZeroEntryNumber(0),
-   fNeedNotify(kFALSE)
+   fNeedNotify(kFALSE),
+   fReadAheadSize(0),
+   fAsyncPrefetch(kFALSE)
 {
    //
    // Default constructor.
@@ -131,6 +134,7 @@ void AliMixInputHandlerInfo::PrepareEntry(TChainElement *te, Long64_t entry, Ali
          fChain = new TChain(te->GetName());
          fChain->AddFile(te->GetTitle());
          fChain->GetEntry(0);
+         ConfigureReadAhead();
          eh->Init(opt);
          eh->Init(fChain->GetTree(), opt);
       }
@@ -149,6 +153,7 @@ void AliMixInputHandlerInfo::PrepareEntry(TChainElement *te, Long64_t entry, Ali
          fChain = new TChain(te->GetName());
          fChain->AddFile(te->GetTitle());
          fChain->GetEntry(0);
+         ConfigureReadAhead();
          eh->Init(opt);
          eh->Init(fChain->GetTree(), opt);
          eh->Notify(te->GetTitle());
@@ -180,3 +185,46 @@ Long64_t AliMixInputHandlerInfo::GetEntries()
    if (fChain) return fChain->GetEntries();
    return -1;
 }
+
+//_____________________________________________________________________________
+void AliMixInputHandlerInfo::SetReadAhead(Long64_t cacheSize, Bool_t asyncPrefetch)
+{
+   //
+   // Sets read-ahead of partner events. Asynchronous prefetching is a global
+   // ROOT setting, it is switched on here before the partner files are opened
+   //
+   fReadAheadSize = cacheSize;
+   fAsyncPrefetch = asyncPrefetch;
+   if (fReadAheadSize > 0 && fAsyncPrefetch) gEnv->SetValue("TFile.AsyncPrefetching", 1);
+}
+
+//_____________________________________________________________________________
+void AliMixInputHandlerInfo::ConfigureReadAhead()
+{
+   //
+   // Attaches tree cache to the chain of the current partner file
+   //
+   if (!fChain || fReadAheadSize <= 0) return;
+   fChain->SetCacheSize(fReadAheadSize);
+   fChain->AddBranchToCache("*", kTRUE);
+   AliDebug(AliLog::kDebug, Form("Tree cache of %lld bytes (async=%d)", fReadAheadSize, fAsyncPrefetch));
+}
+
+//_____________________________________________________________________________
+void AliMixInputHandlerInfo::PredictEntries(Long64_t firstEntry, Long64_t lastEntry)
+{
+   //
+   // Restricts tree cache to the range of upcoming partner entries (entries in
+   // full chain), so the baskets of all of them are fetched in one go. Only done
+   // when the range lies in the file which is currently open
+   //
+   if (!fChain || !fChain->GetTree() || fReadAheadSize <= 0 || firstEntry > lastEntry) return;
+   Long64_t first = firstEntry, last = lastEntry;
+   TChainElement *teFirst = GetEntryInTree(first);
+   TChainElement *teLast = GetEntryInTree(last);
+   if (!teFirst || teFirst != teLast || first < 0 || last < 0) return;
+   TFile *file = fChain->GetTree()->GetCurrentFile();
+   if (!file || TString(file->GetName()).CompareTo(teFirst->GetTitle())) return;
+   fChain->SetCacheEntryRange(first, last);
+   AliDebug(AliLog::kDebug + 1, Form("Tree cache range [%lld,%lld]", first, last));
+}
@@ -29,6 +29,11 @@ public:
 
    void PrepareEntry(TChainElement *te, Long64_t entry, AliInputEventHandler *eh, Option_t *opt);
 
+   // read-ahead of mixing partners through a TTreeCache of cacheSize bytes,
+   // filled by a background thread when asyncPrefetch is set
+   void SetReadAhead(Long64_t cacheSize, Bool_t asyncPrefetch = kTRUE);
+   void PredictEntries(Long64_t firstEntry, Long64_t lastEntry);
+
    void SetZeroEntryNumber(Long64_t num) { fZeroEntryNumber = num; }
    TChainElement *GetEntryInTree(Long64_t &entry);
    Long64_t      GetEntries();
@@ -38,11 +43,15 @@ private:
    TArrayI   fChainEntriesArray;   // array of entries of every chaing
    Long64_t  fZeroEntryNumber;     // zero entry number (will be used when we will delete not needed chains)
    Bool_t    fNeedNotify;          // flag if Notify is needed for current input handler
+   Long64_t  fReadAheadSize;       // size of the tree cache for partner events (0 = off)
+   Bool_t    fAsyncPrefetch;       // fill the tree cache asynchronously
+
+   void ConfigureReadAhead();
 
    AliMixInputHandlerInfo(const AliMixInputHandlerInfo &handler);
    AliMixInputHandlerInfo &operator=(const AliMixInputHandlerInfo &handler);
 
-   ClassDef(AliMixInputHandlerInfo, 1); // Mix Input Handler info
+   ClassDef(AliMixInputHandlerInfo, 2); // Mix Input Handler info
 };
 
 #endif // ALIMIXINPUTHANDLERINFO_H
@@ -379,6 +379,8 @@ Bool_t AliHLTJETReader::FillVectorESD() {
 
   Int_t nTracks = 0;
 
+  fMomentumVector->reserve(fESD->GetNumberOfTracks());
+
   // -- Loop over particles
   // ------------------------
   for ( Int_t iter = 0; iter < fESD->GetNumberOfTracks() && bResult; iter++ ) {
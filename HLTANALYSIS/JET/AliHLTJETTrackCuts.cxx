@@ -86,8 +86,6 @@ Bool_t AliHLTJETTrackCuts::IsSelected( TObject *obj ) {
     HLTError("Unknown object type %s", obj->ClassName() );
     bResult = kFALSE;
   }
-  
-   HLTError("Unknown object dd type %s", obj->ClassName() );
 
   return bResult;
 }
@@ -104,55 +102,56 @@ Bool_t AliHLTJETTrackCuts::IsSelected( TParticle *particle ) {
   //   particle->GetNDaughters() == 0
   // ----------------------------------
 
-  Bool_t bResult = kTRUE;
+  // -- The first failing cut rejects the particle
 
   Int_t   status  = particle->GetStatusCode();
   Int_t   pdgCode = TMath::Abs( particle->GetPdgCode() );
   
   // -- Skip non-final state particles (status != 1), neutrinos (12,14,16)
   if ( (status != 1) || (pdgCode == 12 || pdgCode == 14 || pdgCode == 16) )
-    bResult = kFALSE;
+    return kFALSE;
 
   // -- Charged particles only
-  if ( ! particle->GetPDG() )
-    bResult = kFALSE;
-  else {
-    if ( fChargedOnly && !particle->GetPDG()->Charge() )
-      bResult = kFALSE;
-  }
+  TParticlePDG* particlePDG = particle->GetPDG();
+  if ( ! particlePDG )
+    return kFALSE;
+  if ( fChargedOnly && !particlePDG->Charge() )
+    return kFALSE;
 
   // -- cut on min Pt
   if ( particle->Pt() < fPtMin )
-    bResult = kFALSE;
+    return kFALSE;
 
   // -- cut on eta acceptance
-  if ( ( particle->Eta() < fEtaMin ) || ( particle->Eta() > fEtaMax ) )
-    bResult = kFALSE;
+  Double_t eta = particle->Eta();
+  if ( ( eta < fEtaMin ) || ( eta > fEtaMax ) )
+    return kFALSE;
 
   // -- cut on phi acceptance
-  if ( ( particle->Phi() < fPhiMin ) || ( particle->Phi() > fPhiMax ) )
-    bResult = kFALSE;
+  Double_t phi = particle->Phi();
+  if ( ( phi < fPhiMin ) || ( phi > fPhiMax ) )
+    return kFALSE;
 
-  return bResult;
+  return kTRUE;
 }
 
 // #################################################################################
 Bool_t AliHLTJETTrackCuts::IsSelected( AliESDtrack *esdTrack ) {
   // see header file for class documentation
 
-  Bool_t bResult = kTRUE;
-
   // -- cut on min Pt
   if ( esdTrack->Pt() < fPtMin )
-    bResult = kFALSE;
+    return kFALSE;
 
   // -- cut on eta acceptance
-  if ( ( esdTrack->Eta() < fEtaMin ) || ( esdTrack->Eta() > fEtaMax ) )
-    bResult = kFALSE;
+  Double_t eta = esdTrack->Eta();
+  if ( ( eta < fEtaMin ) || ( eta > fEtaMax ) )
+    return kFALSE;
 
   // -- cut on phi acceptance
-  if ( ( esdTrack->Phi() < fPhiMin ) || ( esdTrack->Phi() > fPhiMax ) )
-    bResult = kFALSE;
+  Double_t phi = esdTrack->Phi();
+  if ( ( phi < fPhiMin ) || ( phi > fPhiMax ) )
+    return kFALSE;
 
-  return bResult;
+  return kTRUE;
 }
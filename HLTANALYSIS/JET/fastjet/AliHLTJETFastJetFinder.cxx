@@ -251,9 +251,6 @@ Int_t AliHLTJETFastJetFinder::FindFastJets() {
 					  (*header->GetJetDefinition()),
 					  (*header->GetAreaDefinition()) );
 
-  // -- Extract the inclusive jets with pt > ptmin, sorted by pt
-  vector<fastjet::PseudoJet> inclusive_jets = clust_seq.inclusive_jets(header->GetPtMin());
-  
   // -- Subtract background 
   vector<fastjet::PseudoJet> sub_jets = clust_seq.subtracted_jets((*header->GetRangeDefinition()),
 								  header->GetPtMin());  
@@ -138,7 +138,11 @@ Bool_t AliJetReader::CreateTasks()
   fDebug = fReaderHeader->GetDebug();
 
   fFillEvent = new AliJetFillCalTrkEvent();
-  if (fOpt>0) {
+  if (fFillEventwTrks) {
+    // track filling given from outside, see SetFillEventTracks()
+    fFillEventwTrks->SetReaderHeader(fReaderHeader);
+  }
+  else if (fOpt>0) {
     // Tracks
     if(fOpt%2==!0 && fOpt!=0){
       fFillEventwTrks = new AliJetFillCalTrkTrack();
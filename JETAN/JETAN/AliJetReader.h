@@ -32,6 +32,7 @@ class AliJetReader : public TObject
   
   // Setters
   void                      SetReaderHeader(AliJetReaderHeader* header)      {fReaderHeader = header;}  
+  void                      SetFillEventTracks(AliJetFillCalTrkEvent* fill)  {fFillEventwTrks = fill;}   // replaces the default track filling, owned by the reader
 
   // Others
   void                      SetInputEvent(const TObject* esd, const TObject* aod, const AliMCEvent* mc);
@@ -10,11 +10,65 @@
 #include <TMath.h>
 #include "AliVMultiplicity.h"
 #include "AliPPVsMultUtils.h"
+#include "AliAnalysisManager.h"
+
+#include <vector>
 
 #include "AliAnalysisUtils.h"
 
 ClassImp(AliAnalysisUtils)
 
+namespace {
+  // pileup decisions of the current event, shared by all the AliAnalysisUtils instances of the process
+  enum { kDecisionMV = 0, kDecisionSPD, kDecisionOutOfBunch, kDecisionSPDClusterVsTracklet };
+  const Int_t kNDecisionPars = 6; // maximum number of settings a decision depends on
+  const Int_t kNMVPars = 4;       // settings of the MV pileup selection
+
+  struct PileUpDecision {
+    Int_t    fType;                   // kDecisionMV, ...
+    Double_t fPars[kNDecisionPars];   // settings of the decision, unused ones are 0
+    Bool_t   fFilled;                 // decided for the current event
+    Bool_t   fResult;                 // decision
+  };
+
+  const AliVEvent*            gDecisionEvent = 0;    // event of the decisions
+  Long64_t                    gDecisionEntry = -1;   // analysis manager entry of the decisions
+  ULong64_t                   gDecisionEventId = 0;  // bunch crossing and time stamp of the decisions
+  std::vector<PileUpDecision> gDecisions;            // decisions, one per type and settings
+  std::vector<Double_t>       gMVVariants;           // settings added with AliAnalysisUtils::AddPileUpMVVariant, kNMVPars each
+
+  // decision of this type and settings in the current event, the decisions of the previous event are dropped
+  // outside an analysis train loop the event can not be identified and nothing is cached
+  PileUpDecision* FindPileUpDecision(AliVEvent *event, Int_t type, const Double_t *pars) {
+    AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+    const Long64_t entry = (mgr) ? mgr->GetCurrentEntry() : -1;
+    if (entry < 0) return 0;
+
+    const ULong64_t evid = (((ULong64_t) event->GetBunchCrossNumber()) << 32) + event->GetTimeStamp();
+    if (event != gDecisionEvent || entry != gDecisionEntry || evid != gDecisionEventId) {
+      gDecisionEvent = event;
+      gDecisionEntry = entry;
+      gDecisionEventId = evid;
+      for (UInt_t i=0; i<gDecisions.size(); i++) gDecisions[i].fFilled = kFALSE;
+    }
+
+    for (UInt_t i=0; i<gDecisions.size(); i++) {
+      if (gDecisions[i].fType != type) continue;
+      Bool_t same = kTRUE;
+      for (Int_t ip=0; ip<kNDecisionPars && same; ip++) same = (gDecisions[i].fPars[ip] == pars[ip]);
+      if (same) return &gDecisions[i];
+    }
+
+    PileUpDecision decision;
+    decision.fType = type;
+    for (Int_t ip=0; ip<kNDecisionPars; ip++) decision.fPars[ip] = pars[ip];
+    decision.fFilled = kFALSE;
+    decision.fResult = kFALSE;
+    gDecisions.push_back(decision);
+    return &gDecisions.back();
+  }
+}
+
 //______________________________________________________________________
 AliAnalysisUtils::AliAnalysisUtils():TObject(),
   fisAOD(kTRUE),
@@ -35,6 +89,7 @@ AliAnalysisUtils::AliAnalysisUtils():TObject(),
   fUseSPDCutInMultBins(kFALSE),
   fASPDCvsTCut(65.),
   fBSPDCvsTCut(4.),
+  fCachePileUpDecisions(kTRUE),
   fPPVsMultUtils(0x0)
 {
   // Default contructor
@@ -144,12 +199,52 @@ Bool_t AliAnalysisUtils::IsPileUpEvent(AliVEvent *event)
 Bool_t AliAnalysisUtils::IsPileUpMV(AliVEvent *event)
 {
   // check for multi-vertexer pile-up
+  // with the caching on, the variants added with AddPileUpMVVariant are decided in the same pass
+  Double_t pars[kNDecisionPars] = { Double_t(fMinPlpContribMV), fMaxPlpChi2MV, fMinWDistMV, Double_t(fCheckPlpFromDifferentBCMV), 0., 0. };
+  PileUpDecision *decision = (fCachePileUpDecisions) ? FindPileUpDecision(event, kDecisionMV, pars) : 0;
+  if (decision && decision->fFilled) return decision->fResult;
+  //
+  std::vector<Double_t> configs(pars, pars + kNMVPars);
+  if (decision) {
+    for (UInt_t iv=0; iv<gMVVariants.size(); iv+=kNMVPars) {
+      Double_t parsVariant[kNDecisionPars] = { gMVVariants[iv], gMVVariants[iv+1], gMVVariants[iv+2], gMVVariants[iv+3], 0., 0. };
+      if (FindPileUpDecision(event, kDecisionMV, parsVariant)->fFilled) continue;
+      configs.insert(configs.end(), parsVariant, parsVariant + kNMVPars);
+    }
+  }
+  //
+  const Int_t nConfigs = configs.size() / kNMVPars;
+  Bool_t *results = new Bool_t[nConfigs];
+  EvaluatePileUpMV(event, nConfigs, &configs[0], results);
+  const Bool_t isPileUp = results[0];
+  //
+  if (decision) {
+    // the decisions are stored after the evaluation, the vector of the decisions may grow meanwhile
+    for (Int_t ic=0; ic<nConfigs; ic++) {
+      Double_t parsConfig[kNDecisionPars] = { configs[ic*kNMVPars], configs[ic*kNMVPars+1], configs[ic*kNMVPars+2], configs[ic*kNMVPars+3], 0., 0. };
+      PileUpDecision *stored = FindPileUpDecision(event, kDecisionMV, parsConfig);
+      stored->fFilled = kTRUE;
+      stored->fResult = results[ic];
+    }
+  }
+  delete [] results;
+  //
+  return isPileUp;
+}
+
+//______________________________________________________________________
+void AliAnalysisUtils::EvaluatePileUpMV(AliVEvent *event, Int_t nConfigs, const Double_t *configs, Bool_t *results)
+{
+  // multi-vertexer pile-up for nConfigs settings (min. contributors, max. chi2, min. weighted distance,
+  // check of the BC, kNMVPars values each in configs) in one loop over the pile-up vertices
   const AliAODEvent *aod = dynamic_cast<const AliAODEvent*>(event);
   const AliESDEvent *esd = dynamic_cast<const AliESDEvent*>(event);
   //
+  for (Int_t ic=0; ic<nConfigs; ic++) results[ic] = kFALSE;
+  //
   if (!aod && !esd) {
     AliFatal("Event is neither of AOD nor ESD type");
-    return kFALSE;
+    return;
   }
   //
   const AliVVertex* vtPrm = 0;
@@ -157,42 +252,82 @@ Bool_t AliAnalysisUtils::IsPileUpMV(AliVEvent *event)
   Int_t nPlp = 0;
   //
   if (aod) {
-    if ( !(nPlp=aod->GetNumberOfPileupVerticesTracks()) ) return kFALSE;
+    if ( !(nPlp=aod->GetNumberOfPileupVerticesTracks()) ) return;
     vtPrm = aod->GetPrimaryVertex();
-    if (vtPrm == aod->GetPrimaryVertexSPD()) return kTRUE; // there are pile-up vertices but no primary
+    if (vtPrm == aod->GetPrimaryVertexSPD()) { // there are pile-up vertices but no primary
+      for (Int_t ic=0; ic<nConfigs; ic++) results[ic] = kTRUE;
+      return;
+    }
   }
   else {
-    if ( !(nPlp=esd->GetNumberOfPileupVerticesTracks())) return kFALSE;
+    if ( !(nPlp=esd->GetNumberOfPileupVerticesTracks())) return;
     vtPrm = esd->GetPrimaryVertexTracks();
-    if (((AliESDVertex*)vtPrm)->GetStatus()!=1) return kTRUE; // there are pile-up vertices but no primary
+    if (((AliESDVertex*)vtPrm)->GetStatus()!=1) { // there are pile-up vertices but no primary
+      for (Int_t ic=0; ic<nConfigs; ic++) results[ic] = kTRUE;
+      return;
+    }
   }
   Int_t bcPrim = vtPrm->GetBC();
   //
-  for (Int_t ipl=0;ipl<nPlp;ipl++) {
+  Int_t nOpen = nConfigs; // settings without decision
+  std::vector<Bool_t> decided(nConfigs, kFALSE);
+  for (Int_t ipl=0;ipl<nPlp && nOpen>0;ipl++) {
     vtPlp = aod ? (const AliVVertex*)aod->GetPileupVertexTracks(ipl) : (const AliVVertex*)esd->GetPileupVertexTracks(ipl);
     //
-    if (vtPlp->GetNContributors() < fMinPlpContribMV) continue;
-    if (vtPlp->GetChi2perNDF() > fMaxPlpChi2MV) continue;
-    if(fCheckPlpFromDifferentBCMV)
-      {
-	Int_t bcPlp = vtPlp->GetBC();
-	if (bcPlp!=AliVTrack::kTOFBCNA && TMath::Abs(bcPlp-bcPrim)>2) return kTRUE; // pile-up from other BC
-      }
-    //
-    Double_t wDst = GetWDist(vtPrm,vtPlp);
-    if (wDst<fMinWDistMV) continue;
+    const Int_t nContrib = vtPlp->GetNContributors();
+    const Double_t chi2 = vtPlp->GetChi2perNDF();
+    Double_t wDst = 0;
+    Bool_t wDstDone = kFALSE; // the weighted distance is computed once per pile-up vertex, when needed
     //
-    return kTRUE; // pile-up: well separated vertices
+    for (Int_t ic=0; ic<nConfigs; ic++) {
+      if (decided[ic]) continue;
+      const Double_t *config = configs + ic*kNMVPars;
+      if (nContrib < config[0]) continue;
+      if (chi2 > config[1]) continue;
+      if (config[3])
+	{
+	  Int_t bcPlp = vtPlp->GetBC();
+	  if (bcPlp!=AliVTrack::kTOFBCNA && TMath::Abs(bcPlp-bcPrim)>2) { // pile-up from other BC
+	    results[ic] = kTRUE; decided[ic] = kTRUE; nOpen--;
+	    continue;
+	  }
+	}
+      //
+      if (!wDstDone) { wDst = GetWDist(vtPrm,vtPlp); wDstDone = kTRUE; }
+      if (wDst<config[2]) continue;
+      //
+      results[ic] = kTRUE; decided[ic] = kTRUE; nOpen--; // pile-up: well separated vertices
+    }
   }
   //
-  return kFALSE;
-  //
+}
+
+//______________________________________________________________________
+void AliAnalysisUtils::AddPileUpMVVariant(Int_t minPlpContribMV, Float_t maxPlpChi2MV, Float_t minWDistMV, Bool_t checkPlpFromDifferentBCMV)
+{
+  // adds MV pileup settings which are decided together with the ones requested in IsPileUpMV,
+  // for trains where several wagons use different settings
+  gMVVariants.push_back(minPlpContribMV);
+  gMVVariants.push_back(maxPlpChi2MV);
+  gMVVariants.push_back(minWDistMV);
+  gMVVariants.push_back(checkPlpFromDifferentBCMV);
+}
+
+//______________________________________________________________________
+void AliAnalysisUtils::ClearPileUpMVVariants()
+{
+  // removes the settings added with AddPileUpMVVariant
+  gMVVariants.clear();
 }
 
 //______________________________________________________________________
 Bool_t AliAnalysisUtils::IsPileUpSPD(AliVEvent *event)
 {
   // check for SPD pile-up
+  Double_t pars[kNDecisionPars] = { Double_t(fUseSPDCutInMultBins), Double_t(fMinPlpContribSPD), fMinPlpZdistSPD, fnSigmaPlpZdistSPD, fnSigmaPlpDiamXYSPD, fnSigmaPlpDiamZSPD };
+  PileUpDecision *decision = (fCachePileUpDecisions) ? FindPileUpDecision(event, kDecisionSPD, pars) : 0;
+  if (decision && decision->fFilled) return decision->fResult;
+  //
   const AliAODEvent *aod = dynamic_cast<const AliAODEvent*>(event);
   const AliESDEvent *esd = dynamic_cast<const AliESDEvent*>(event);
   //
@@ -201,14 +336,25 @@ Bool_t AliAnalysisUtils::IsPileUpSPD(AliVEvent *event)
     return kFALSE;
   }
   //
-  if (aod) return (fUseSPDCutInMultBins)?aod->IsPileupFromSPDInMultBins():aod->IsPileupFromSPD(fMinPlpContribSPD,fMinPlpZdistSPD,fnSigmaPlpZdistSPD,fnSigmaPlpDiamXYSPD,fnSigmaPlpDiamZSPD);
-  else return (fUseSPDCutInMultBins)?esd->IsPileupFromSPDInMultBins():esd->IsPileupFromSPD(fMinPlpContribSPD,fMinPlpZdistSPD,fnSigmaPlpZdistSPD,fnSigmaPlpDiamXYSPD,fnSigmaPlpDiamZSPD);
+  Bool_t isPileUp = kFALSE;
+  if (aod) isPileUp = (fUseSPDCutInMultBins)?aod->IsPileupFromSPDInMultBins():aod->IsPileupFromSPD(fMinPlpContribSPD,fMinPlpZdistSPD,fnSigmaPlpZdistSPD,fnSigmaPlpDiamXYSPD,fnSigmaPlpDiamZSPD);
+  else isPileUp = (fUseSPDCutInMultBins)?esd->IsPileupFromSPDInMultBins():esd->IsPileupFromSPD(fMinPlpContribSPD,fMinPlpZdistSPD,fnSigmaPlpZdistSPD,fnSigmaPlpDiamXYSPD,fnSigmaPlpDiamZSPD);
+  //
+  if (decision) {
+    decision->fFilled = kTRUE;
+    decision->fResult = isPileUp;
+  }
+  return isPileUp;
 }
 
 //______________________________________________________________________
 Bool_t AliAnalysisUtils::IsOutOfBunchPileUp(AliVEvent *event)
 {
   // check for SPD pile-up
+  Double_t pars[kNDecisionPars] = { 0., 0., 0., 0., 0., 0. };
+  PileUpDecision *decision = (fCachePileUpDecisions) ? FindPileUpDecision(event, kDecisionOutOfBunch, pars) : 0;
+  if (decision && decision->fFilled) return decision->fResult;
+  //
   const AliAODEvent *aod = dynamic_cast<const AliAODEvent*>(event);
   const AliESDEvent *esd = dynamic_cast<const AliESDEvent*>(event);
   //
@@ -216,25 +362,41 @@ Bool_t AliAnalysisUtils::IsOutOfBunchPileUp(AliVEvent *event)
     AliFatal("Event is neither of AOD nor ESD type");
     return kFALSE;
   }
+  Bool_t isPileUp = kFALSE;
   Int_t bc2 = (aod)?((AliVAODHeader*)aod->GetHeader())->GetIRInt2ClosestInteractionMap():esd->GetHeader()->GetIRInt2ClosestInteractionMap();
   if (bc2 != 0)
-    return kTRUE;
+    isPileUp = kTRUE;
   
-  Int_t bc1 = (aod)?((AliVAODHeader*)aod->GetHeader())->GetIRInt1ClosestInteractionMap():esd->GetHeader()->GetIRInt1ClosestInteractionMap();
-  if (bc1 != 0)
-    return kTRUE;
+  if (!isPileUp) {
+    Int_t bc1 = (aod)?((AliVAODHeader*)aod->GetHeader())->GetIRInt1ClosestInteractionMap():esd->GetHeader()->GetIRInt1ClosestInteractionMap();
+    if (bc1 != 0)
+      isPileUp = kTRUE;
+  }
   
-  return kFALSE;
+  if (decision) {
+    decision->fFilled = kTRUE;
+    decision->fResult = isPileUp;
+  }
+  return isPileUp;
 }
 
 
 //______________________________________________________________________
 Bool_t AliAnalysisUtils::IsSPDClusterVsTrackletBG(AliVEvent *event){
+  Double_t pars[kNDecisionPars] = { fASPDCvsTCut, fBSPDCvsTCut, 0., 0., 0., 0. };
+  PileUpDecision *decision = (fCachePileUpDecisions) ? FindPileUpDecision(event, kDecisionSPDClusterVsTracklet, pars) : 0;
+  if (decision && decision->fFilled) return decision->fResult;
+  
   Int_t nClustersLayer0 = event->GetNumberOfITSClusters(0);
   Int_t nClustersLayer1 = event->GetNumberOfITSClusters(1);
   Int_t nTracklets      = event->GetMultiplicity()->GetNumberOfTracklets();
-  if (nClustersLayer0 + nClustersLayer1 > fASPDCvsTCut + nTracklets*fBSPDCvsTCut) return kTRUE;
-  return kFALSE;
+  Bool_t isBG = (nClustersLayer0 + nClustersLayer1 > fASPDCvsTCut + nTracklets*fBSPDCvsTCut);
+  
+  if (decision) {
+    decision->fFilled = kTRUE;
+    decision->fResult = isBG;
+  }
+  return isBG;
 }
 
 
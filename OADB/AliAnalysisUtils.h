@@ -61,10 +61,17 @@ class AliAnalysisUtils : public TObject {
   void SetASPDCvsTCut(Float_t a) { fASPDCvsTCut = a; }
   void SetBSPDCvsTCut(Float_t b) { fBSPDCvsTCut = b; }
   
+  //per event caching of the pileup decisions, shared by all the instances with the same settings
+  void SetCachePileUpDecisions(Bool_t cache = kTRUE) { fCachePileUpDecisions = cache; }
+  //further MV settings evaluated in the same loop over the pileup vertices (with the caching on)
+  static void AddPileUpMVVariant(Int_t minPlpContribMV, Float_t maxPlpChi2MV, Float_t minWDistMV, Bool_t checkPlpFromDifferentBCMV = kFALSE);
+  static void ClearPileUpMVVariants();
+  
   //multiplicity selection in pp
   Float_t GetMultiplicityPercentile(AliVEvent *event, TString lMethod = "V0M", Bool_t lEmbedEventSelection = kTRUE);
     
  private:
+  friend class AliEventCuts; // reads the pile-up settings for its configuration key
   
   Bool_t fisAOD; // flag for AOD:1 or ESD:0
   
@@ -91,12 +98,16 @@ class AliAnalysisUtils : public TObject {
   Float_t fASPDCvsTCut; // constant for the linear cut in SPD clusters vs tracklets
   Float_t fBSPDCvsTCut; // slope for the linear cut in SPD  clusters vs tracklets
   
+  Bool_t fCachePileUpDecisions; // reuse the pileup decisions of the current event
+  
   AliPPVsMultUtils *fPPVsMultUtils; //! multiplicity selection in pp
 
+  void EvaluatePileUpMV(AliVEvent *event, Int_t nConfigs, const Double_t *configs, Bool_t *results); // MV pileup for several settings
+
   AliAnalysisUtils(const AliAnalysisUtils& obj); // copy constructor
   AliAnalysisUtils& operator=(const AliAnalysisUtils& other); // assignment
     
-  ClassDef(AliAnalysisUtils,3) // base helper class
+  ClassDef(AliAnalysisUtils,4) // base helper class
 };
 #endif
  
@@ -0,0 +1,107 @@
+/**************************************************************************
+ * Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+//-------------------------------------------------------------------------
+//     Per run lookup tables of the centrality calibration histograms
+//-------------------------------------------------------------------------
+
+#include <TH1.h>
+#include <TMath.h>
+#include "AliCentralityLookupTable.h"
+
+ClassImp(AliCentralityLookupTable);
+
+//______________________________________________________________________________
+AliCentralityLookupTable::AliCentralityLookupTable() :
+  TObject(),
+  fNBins(),
+  fXmin(),
+  fXmax(),
+  fEdgeOffset(),
+  fContentOffset(),
+  fEdges(),
+  fContents()
+{
+  // Default constructor
+}
+
+//______________________________________________________________________________
+void AliCentralityLookupTable::Clear(Option_t* /*option*/)
+{
+  // Remove all the estimators, e.g. at run change
+  fNBins.clear();
+  fXmin.clear();
+  fXmax.clear();
+  fEdgeOffset.clear();
+  fContentOffset.clear();
+  fEdges.clear();
+  fContents.clear();
+}
+
+//______________________________________________________________________________
+Int_t AliCentralityLookupTable::AddEstimator(const TH1* hist)
+{
+  // Copy the axis and the contents of the calibration histogram of the next estimator,
+  // hist can be 0 for an estimator without calibration. Returns the estimator index.
+  Int_t iEst = fNBins.size();
+  if (!hist) {
+    fNBins.push_back(-1);
+    fXmin.push_back(0.);
+    fXmax.push_back(0.);
+    fEdgeOffset.push_back(-1);
+    fContentOffset.push_back(-1);
+    return iEst;
+  }
+
+  const TAxis* axis = hist->GetXaxis();
+  Int_t nBins = axis->GetNbins();
+  fNBins.push_back(nBins);
+  fXmin.push_back(axis->GetXmin());
+  fXmax.push_back(axis->GetXmax());
+
+  const TArrayD* edges = axis->GetXbins();
+  if (edges->GetSize()) {
+    fEdgeOffset.push_back(fEdges.size());
+    fEdges.insert(fEdges.end(), edges->GetArray(), edges->GetArray()+edges->GetSize());
+  } else fEdgeOffset.push_back(-1);
+
+  fContentOffset.push_back(fContents.size());
+  for (Int_t bin=0; bin<=nBins+1; bin++) fContents.push_back(hist->GetBinContent(bin));
+
+  return iEst;
+}
+
+//______________________________________________________________________________
+Int_t AliCentralityLookupTable::FindBin(Int_t iEst, Double_t value) const
+{
+  // Same bin as TAxis::FindFixBin(): 0 below the axis, nBins+1 above
+  if (value < fXmin[iEst])     return 0;
+  if (!(value < fXmax[iEst]))  return fNBins[iEst]+1;
+  if (fEdgeOffset[iEst] < 0)
+    return 1 + Int_t(fNBins[iEst]*(value-fXmin[iEst])/(fXmax[iEst]-fXmin[iEst]));
+  return 1 + TMath::BinarySearch(fNBins[iEst]+1, &fEdges[fEdgeOffset[iEst]], value);
+}
+
+//______________________________________________________________________________
+void AliCentralityLookupTable::GetPercentiles(const Double_t* values, Double_t* percentiles, Double_t noCalib) const
+{
+  // Percentiles of all the estimators for their values in this event,
+  // noCalib for the estimators without calibration
+  Int_t nEst = fNBins.size();
+  for (Int_t iEst=0; iEst<nEst; iEst++)
+    percentiles[iEst] = (fNBins[iEst] < 0) ? noCalib : GetPercentile(iEst, values[iEst]);
+}
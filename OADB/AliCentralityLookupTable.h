@@ -0,0 +1,52 @@
+#ifndef ALICENTRALITYLOOKUPTABLE_H
+#define ALICENTRALITYLOOKUPTABLE_H
+/* Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//-------------------------------------------------------------------------
+//     Per run lookup tables of the centrality calibration histograms
+//     (percentile vs estimator value), built once when the run changes.
+//     The axis and contents of each histogram are copied to flat arrays,
+//     GetPercentile() gives the same value as
+//     hist->GetBinContent(hist->FindBin(value)) without the TH1 calls,
+//     GetPercentiles() evaluates all the estimators in one call.
+//-------------------------------------------------------------------------
+
+#include <vector>
+#include <TObject.h>
+
+class TH1;
+
+class AliCentralityLookupTable : public TObject {
+
+ public :
+  AliCentralityLookupTable();
+  virtual ~AliCentralityLookupTable() {}
+
+  virtual void Clear(Option_t* option="");
+  Int_t    AddEstimator(const TH1* hist);
+
+  Int_t    GetNEstimators()         const {return fNBins.size();}
+  Bool_t   HasEstimator(Int_t iEst) const {return fNBins[iEst] >= 0;}
+
+  Double_t GetPercentile(Int_t iEst, Double_t value) const
+    {return fContents[fContentOffset[iEst] + FindBin(iEst, value)];}
+  void     GetPercentiles(const Double_t* values, Double_t* percentiles, Double_t noCalib) const;
+
+ private:
+  Int_t    FindBin(Int_t iEst, Double_t value) const;
+
+  std::vector<Int_t>    fNBins;          // number of bins of each estimator, -1 without calibration
+  std::vector<Double_t> fXmin;           // lower edge of the axis
+  std::vector<Double_t> fXmax;           // upper edge of the axis
+  std::vector<Int_t>    fEdgeOffset;     // first edge in fEdges for variable bins, -1 for fixed bins
+  std::vector<Int_t>    fContentOffset;  // underflow bin of the estimator in fContents
+  std::vector<Double_t> fEdges;          // bin edges of the estimators with variable bins
+  std::vector<Double_t> fContents;       // bin contents, underflow and overflow included
+
+  ClassDef(AliCentralityLookupTable, 1);
+};
+
+#endif
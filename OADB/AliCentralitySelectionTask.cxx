@@ -50,8 +50,10 @@
 #include "AliESDtrackCuts.h"
 #include "AliESDVertex.h"
 #include "AliCentrality.h"
+#include "AliCentralityLookupTable.h"
 #include "AliOADBCentrality.h"
 #include "AliOADBContainer.h"
+#include "AliOADBContainerCache.h"
 #include "AliMultiplicity.h"
 #include "AliAODHandler.h"
 #include "AliAODHeader.h"
@@ -211,6 +213,7 @@ AliAnalysisTaskSE(),
   fHtempZNCtrue(0),
   fHtempZPAtrue(0),
   fHtempZPCtrue(0),
+  fCentLookup(0),
   fOutputList(0),
   fHOutCentV0M(0),
   fHOutCentV0A(0),
@@ -481,6 +484,7 @@ AliCentralitySelectionTask::AliCentralitySelectionTask(const char *name):
   fHtempZNCtrue(0),
   fHtempZPAtrue(0),
   fHtempZPCtrue(0),
+  fCentLookup(0),
   fOutputList(0),
   fHOutCentV0M(0),
   fHOutCentV0A(0),
@@ -761,6 +765,7 @@ AliCentralitySelectionTask::AliCentralitySelectionTask(const AliCentralitySelect
   fHtempZNCtrue(ana.fHtempZNCtrue),
   fHtempZPAtrue(ana.fHtempZPAtrue),
   fHtempZPCtrue(ana.fHtempZPCtrue),
+  fCentLookup(0),
   fOutputList(ana.fOutputList),
   fHOutCentV0M(ana.fHOutCentV0M),
   fHOutCentV0A(ana.fHOutCentV0A),
@@ -901,6 +906,7 @@ AliCentralitySelectionTask::~AliCentralitySelectionTask()
   if (fEsdTrackCuts) delete fEsdTrackCuts;
   if (fEsdTrackCutsExtra1) delete fEsdTrackCutsExtra1;
   if (fEsdTrackCutsExtra2) delete fEsdTrackCutsExtra2;
+  delete fCentLookup;
 }  
 
 //________________________________________________________________________
@@ -1699,60 +1705,60 @@ void AliCentralitySelectionTask::UserExec(Option_t */*option*/)
   }
 
   // ***** Centrality Selection
-  if(fHtempV0M) fCentV0M = fHtempV0M->GetBinContent(fHtempV0M->FindBin((v0Corr)));
-  if(fHtempV0A) fCentV0A = fHtempV0A->GetBinContent(fHtempV0A->FindBin((multV0ACorr)));
-  if(fHtempV0A0) fCentV0A0 = fHtempV0A0->GetBinContent(fHtempV0A0->FindBin((multV0A0Corr)));
-  if(fHtempV0A123) fCentV0A123 = fHtempV0A123->GetBinContent(fHtempV0A123->FindBin((multV0A123Corr)));
-  if(fHtempV0C) fCentV0C = fHtempV0C->GetBinContent(fHtempV0C->FindBin((multV0CCorr)));
-  if(fHtempV0A23) fCentV0A23 = fHtempV0A23->GetBinContent(fHtempV0A23->FindBin((multV0A23Corr)));
-  if(fHtempV0C01) fCentV0C01 = fHtempV0C01->GetBinContent(fHtempV0C01->FindBin((multV0C01Corr)));
-  if(fHtempV0S)  fCentV0S = fHtempV0S->GetBinContent(fHtempV0S->FindBin((multV0SCorr)));
-  if(fHtempV0MEq) fCentV0MEq = fHtempV0MEq->GetBinContent(fHtempV0MEq->FindBin((multV0AEq+multV0CEq)));
-  if(fHtempV0AEq) fCentV0AEq = fHtempV0AEq->GetBinContent(fHtempV0AEq->FindBin((multV0AEq)));
-  if(fHtempV0CEq) fCentV0CEq = fHtempV0CEq->GetBinContent(fHtempV0CEq->FindBin((multV0CEq)));
-  if(fHtempFMD) fCentFMD = fHtempFMD->GetBinContent(fHtempFMD->FindBin((multFMDA+multFMDC)));
-  if(fHtempTRK) fCentTRK = fHtempTRK->GetBinContent(fHtempTRK->FindBin(nTracks));
-  if(fHtempTKL) fCentTKL = fHtempTKL->GetBinContent(fHtempTKL->FindBin(nTracklets));
-  if(fHtempCL0) fCentCL0 = fHtempCL0->GetBinContent(fHtempCL0->FindBin(nClusters[0]));
-  if(fHtempCL1) fCentCL1 = fHtempCL1->GetBinContent(fHtempCL1->FindBin(spdCorr));
-  if(fHtempCND) fCentCND = fHtempCND->GetBinContent(fHtempCND->FindBin(multCND));
+  if(fHtempV0M) fCentV0M = fCentLookup->GetPercentile(kLookupV0M, (v0Corr));
+  if(fHtempV0A) fCentV0A = fCentLookup->GetPercentile(kLookupV0A, (multV0ACorr));
+  if(fHtempV0A0) fCentV0A0 = fCentLookup->GetPercentile(kLookupV0A0, (multV0A0Corr));
+  if(fHtempV0A123) fCentV0A123 = fCentLookup->GetPercentile(kLookupV0A123, (multV0A123Corr));
+  if(fHtempV0C) fCentV0C = fCentLookup->GetPercentile(kLookupV0C, (multV0CCorr));
+  if(fHtempV0A23) fCentV0A23 = fCentLookup->GetPercentile(kLookupV0A23, (multV0A23Corr));
+  if(fHtempV0C01) fCentV0C01 = fCentLookup->GetPercentile(kLookupV0C01, (multV0C01Corr));
+  if(fHtempV0S)  fCentV0S = fCentLookup->GetPercentile(kLookupV0S, (multV0SCorr));
+  if(fHtempV0MEq) fCentV0MEq = fCentLookup->GetPercentile(kLookupV0MEq, (multV0AEq+multV0CEq));
+  if(fHtempV0AEq) fCentV0AEq = fCentLookup->GetPercentile(kLookupV0AEq, (multV0AEq));
+  if(fHtempV0CEq) fCentV0CEq = fCentLookup->GetPercentile(kLookupV0CEq, (multV0CEq));
+  if(fHtempFMD) fCentFMD = fCentLookup->GetPercentile(kLookupFMD, (multFMDA+multFMDC));
+  if(fHtempTRK) fCentTRK = fCentLookup->GetPercentile(kLookupTRK, nTracks);
+  if(fHtempTKL) fCentTKL = fCentLookup->GetPercentile(kLookupTKL, nTracklets);
+  if(fHtempCL0) fCentCL0 = fCentLookup->GetPercentile(kLookupCL0, nClusters[0]);
+  if(fHtempCL1) fCentCL1 = fCentLookup->GetPercentile(kLookupCL1, spdCorr);
+  if(fHtempCND) fCentCND = fCentLookup->GetPercentile(kLookupCND, multCND);
   if(fHtempZNA) {
-    if(znaFired) fCentZNA = fHtempZNA->GetBinContent(fHtempZNA->FindBin(znaTower));
+    if(znaFired) fCentZNA = fCentLookup->GetPercentile(kLookupZNA, znaTower);
     else fCentZNA = 101;
   }
   if(fHtempZNC) {
-    if(zncFired) fCentZNC = fHtempZNC->GetBinContent(fHtempZNC->FindBin(zncTower));
+    if(zncFired) fCentZNC = fCentLookup->GetPercentile(kLookupZNC, zncTower);
     else fCentZNC = 101;
   }
   if(fHtempZPA) {
-    if(znaFired) fCentZPA = fHtempZPA->GetBinContent(fHtempZPA->FindBin(zpaTower));
+    if(znaFired) fCentZPA = fCentLookup->GetPercentile(kLookupZPA, zpaTower);
     else fCentZPA = 101;
   }
   if(fHtempZPC) {
-    if(zpcFired) fCentZPC = fHtempZPC->GetBinContent(fHtempZPC->FindBin(zpcTower));
+    if(zpcFired) fCentZPC = fCentLookup->GetPercentile(kLookupZPC, zpcTower);
     else fCentZPC = 101;
   }
 
 
-  if(fHtempV0MvsFMD) fCentV0MvsFMD = fHtempV0MvsFMD->GetBinContent(fHtempV0MvsFMD->FindBin((multV0A+multV0C)));
-  if(fHtempTKLvsV0M) fCentTKLvsV0M = fHtempTKLvsV0M->GetBinContent(fHtempTKLvsV0M->FindBin(nTracklets));
+  if(fHtempV0MvsFMD) fCentV0MvsFMD = fCentLookup->GetPercentile(kLookupV0MvsFMD, (multV0A+multV0C));
+  if(fHtempTKLvsV0M) fCentTKLvsV0M = fCentLookup->GetPercentile(kLookupTKLvsV0M, nTracklets);
   if(fHtempZEMvsZDC) fCentZEMvsZDC = fHtempZEMvsZDC->GetBinContent(fHtempZEMvsZDC->FindBin(zem1Energy+zem2Energy,zncEnergy+znaEnergy+zpcEnergy+zpaEnergy));
 
-  if(fHtempNPA) fCentNPA = fHtempNPA->GetBinContent(fHtempNPA->FindBin(Npart));
-  if(fHtempV0Mtrue) fCentV0Mtrue = fHtempV0Mtrue->GetBinContent(fHtempV0Mtrue->FindBin((multV0ACorr+multV0CCorr)));
-  if(fHtempV0Atrue) fCentV0Atrue = fHtempV0Atrue->GetBinContent(fHtempV0Atrue->FindBin((multV0ACorr)));
-  if(fHtempV0Ctrue) fCentV0Ctrue = fHtempV0Ctrue->GetBinContent(fHtempV0Ctrue->FindBin((multV0CCorr)));
-  if(fHtempV0MEqtrue) fCentV0MEqtrue = fHtempV0MEqtrue->GetBinContent(fHtempV0MEqtrue->FindBin((multV0AEq+multV0CEq)));
-  if(fHtempV0AEqtrue) fCentV0AEqtrue = fHtempV0AEqtrue->GetBinContent(fHtempV0AEqtrue->FindBin((multV0AEq)));
-  if(fHtempV0CEqtrue) fCentV0CEqtrue = fHtempV0CEqtrue->GetBinContent(fHtempV0CEqtrue->FindBin((multV0CEq)));
-  if(fHtempFMDtrue) fCentFMDtrue = fHtempFMDtrue->GetBinContent(fHtempFMDtrue->FindBin((multFMDA+multFMDC)));
-  if(fHtempTRKtrue) fCentTRKtrue = fHtempTRKtrue->GetBinContent(fHtempTRKtrue->FindBin(nTracks));
-  if(fHtempTKLtrue) fCentTKLtrue = fHtempTKLtrue->GetBinContent(fHtempTKLtrue->FindBin(nTracklets));
-  if(fHtempCL0true) fCentCL0true = fHtempCL0true->GetBinContent(fHtempCL0true->FindBin(nClusters[0]));
-  if(fHtempCL1true) fCentCL1true = fHtempCL1true->GetBinContent(fHtempCL1true->FindBin(spdCorr));
-  if(fHtempCNDtrue) fCentCNDtrue = fHtempCNDtrue->GetBinContent(fHtempCNDtrue->FindBin(multCND));
-  if(fHtempZNAtrue) fCentZNAtrue = fHtempZNAtrue->GetBinContent(fHtempZNAtrue->FindBin(znaTower));
-  if(fHtempZNCtrue) fCentZNCtrue = fHtempZNCtrue->GetBinContent(fHtempZNCtrue->FindBin(zncTower));
+  if(fHtempNPA) fCentNPA = fCentLookup->GetPercentile(kLookupNPA, Npart);
+  if(fHtempV0Mtrue) fCentV0Mtrue = fCentLookup->GetPercentile(kLookupV0Mtrue, (multV0ACorr+multV0CCorr));
+  if(fHtempV0Atrue) fCentV0Atrue = fCentLookup->GetPercentile(kLookupV0Atrue, (multV0ACorr));
+  if(fHtempV0Ctrue) fCentV0Ctrue = fCentLookup->GetPercentile(kLookupV0Ctrue, (multV0CCorr));
+  if(fHtempV0MEqtrue) fCentV0MEqtrue = fCentLookup->GetPercentile(kLookupV0MEqtrue, (multV0AEq+multV0CEq));
+  if(fHtempV0AEqtrue) fCentV0AEqtrue = fCentLookup->GetPercentile(kLookupV0AEqtrue, (multV0AEq));
+  if(fHtempV0CEqtrue) fCentV0CEqtrue = fCentLookup->GetPercentile(kLookupV0CEqtrue, (multV0CEq));
+  if(fHtempFMDtrue) fCentFMDtrue = fCentLookup->GetPercentile(kLookupFMDtrue, (multFMDA+multFMDC));
+  if(fHtempTRKtrue) fCentTRKtrue = fCentLookup->GetPercentile(kLookupTRKtrue, nTracks);
+  if(fHtempTKLtrue) fCentTKLtrue = fCentLookup->GetPercentile(kLookupTKLtrue, nTracklets);
+  if(fHtempCL0true) fCentCL0true = fCentLookup->GetPercentile(kLookupCL0true, nClusters[0]);
+  if(fHtempCL1true) fCentCL1true = fCentLookup->GetPercentile(kLookupCL1true, spdCorr);
+  if(fHtempCNDtrue) fCentCNDtrue = fCentLookup->GetPercentile(kLookupCNDtrue, multCND);
+  if(fHtempZNAtrue) fCentZNAtrue = fCentLookup->GetPercentile(kLookupZNAtrue, znaTower);
+  if(fHtempZNCtrue) fCentZNCtrue = fCentLookup->GetPercentile(kLookupZNCtrue, zncTower);
    
 
   // ***** Cleaning
@@ -2000,7 +2006,7 @@ Int_t AliCentralitySelectionTask::SetupRun(const AliVEvent* const esd)
     return -1;
 
   // check if something to be done
-  if (fCurrentRun == esd->GetRunNumber())
+  if (fCurrentRun == esd->GetRunNumber() && fCentLookup)
     return 0;
   else
     fCurrentRun = esd->GetRunNumber();
@@ -2008,8 +2014,8 @@ Int_t AliCentralitySelectionTask::SetupRun(const AliVEvent* const esd)
   TString fileName =(Form("%s/COMMON/CENTRALITY/data/centrality.root", AliAnalysisManager::GetOADBPath()));
   AliInfo(Form("Setup Centrality Selection for run %d with file %s\n",fCurrentRun,fileName.Data()));
 
-  AliOADBContainer *con = new AliOADBContainer("OADB");
-  con->InitFromFile(fileName,"Centrality");
+  // read once per process and shared with the other tasks, not per run
+  AliOADBContainer *con = AliOADBContainerCache::Instance()->GetContainer(fileName,"Centrality");
 
   AliOADBCentrality*  centOADB = 0;
   centOADB = (AliOADBCentrality*)(con->GetObject(fCurrentRun));
@@ -2132,6 +2138,19 @@ Int_t AliCentralitySelectionTask::SetupRun(const AliVEvent* const esd)
   if (!fHtempZPCtrue) AliWarning(Form("Calibration for ZPCtrue does not exist in %s", path.Data()));
   if (!fHtempFMDtrue) AliWarning(Form("Calibration for FMDtrue does not exist in %s", path.Data()));
 
+  // lookup tables of the 1D histograms, filled in the order of ELookup
+  if (!fCentLookup) fCentLookup = new AliCentralityLookupTable();
+  else fCentLookup->Clear();
+  TH1F *lookupHist[kNLookup] = {
+    fHtempV0M, fHtempV0A, fHtempV0A0, fHtempV0A123, fHtempV0C, fHtempV0A23, fHtempV0C01,
+    fHtempV0S, fHtempV0MEq, fHtempV0AEq, fHtempV0CEq, fHtempFMD, fHtempTRK, fHtempTKL,
+    fHtempCL0, fHtempCL1, fHtempCND, fHtempZNA, fHtempZNC, fHtempZPA, fHtempZPC,
+    fHtempV0MvsFMD, fHtempTKLvsV0M, fHtempNPA, fHtempV0Mtrue, fHtempV0Atrue,
+    fHtempV0Ctrue, fHtempV0MEqtrue, fHtempV0AEqtrue, fHtempV0CEqtrue, fHtempFMDtrue,
+    fHtempTRKtrue, fHtempTKLtrue, fHtempCL0true, fHtempCL1true, fHtempCNDtrue,
+    fHtempZNAtrue, fHtempZNCtrue, fHtempZPAtrue, fHtempZPCtrue};
+  for (Int_t i = 0; i < kNLookup; i++) fCentLookup->AddEstimator(lookupHist[i]);
+
 
   // scale factors
   fV0MScaleFactor    = centOADB->V0MScaleFactor();
@@ -14,6 +14,7 @@
 class TFile;
 class TH1F;
 class TH2F;
+class AliCentralityLookupTable;
 class TList;
 class TString;
 
@@ -44,6 +45,16 @@ class AliCentralitySelectionTask : public AliAnalysisTaskSE {
 
  private:
 
+  // index of the 1D calibration histograms in fCentLookup
+  enum ELookup { kLookupV0M, kLookupV0A, kLookupV0A0, kLookupV0A123, kLookupV0C, kLookupV0A23,
+                 kLookupV0C01, kLookupV0S, kLookupV0MEq, kLookupV0AEq, kLookupV0CEq, kLookupFMD,
+                 kLookupTRK, kLookupTKL, kLookupCL0, kLookupCL1, kLookupCND, kLookupZNA,
+                 kLookupZNC, kLookupZPA, kLookupZPC, kLookupV0MvsFMD, kLookupTKLvsV0M, kLookupNPA,
+                 kLookupV0Mtrue, kLookupV0Atrue, kLookupV0Ctrue, kLookupV0MEqtrue,
+                 kLookupV0AEqtrue, kLookupV0CEqtrue, kLookupFMDtrue, kLookupTRKtrue,
+                 kLookupTKLtrue, kLookupCL0true, kLookupCL1true, kLookupCNDtrue, kLookupZNAtrue,
+                 kLookupZNCtrue, kLookupZPAtrue, kLookupZPCtrue, kNLookup };
+
   Int_t SetupRun(const AliVEvent* const esd);
   Bool_t IsOutlierV0MSPD(Float_t spd, Float_t v0, Int_t cent) const;
   Bool_t IsOutlierV0MTPC(Int_t tracks, Float_t v0, Int_t cent) const;
@@ -191,6 +202,7 @@ class AliCentralitySelectionTask : public AliAnalysisTaskSE {
   TH1F    *fHtempZNCtrue;       // histogram with centrality true (sim) vs multiplicity using ZNC
   TH1F    *fHtempZPAtrue;       // histogram with centrality true (sim) vs multiplicity using ZPA
   TH1F    *fHtempZPCtrue;       // histogram with centrality true (sim) vs multiplicity using ZPC
+  AliCentralityLookupTable *fCentLookup; //! flat copies of the 1D calibration histograms of the run
 
   TList   *fOutputList; // output list
   
@@ -326,7 +338,7 @@ class AliCentralitySelectionTask : public AliAnalysisTaskSE {
   TH1F *fHOutVertex ;           //control histogram for vertex SPD
   TH1F *fHOutVertexT0 ;         //control histogram for vertex T0
 
-  ClassDef(AliCentralitySelectionTask, 31); 
+  ClassDef(AliCentralitySelectionTask, 32); 
 };
 
 #endif
@@ -0,0 +1,247 @@
+/**************************************************************************
+ * Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+//-------------------------------------------------------------------------
+//     Process wide per event table of the TPC dE/dx variables of the tracks
+//-------------------------------------------------------------------------
+
+#include "AliAnalysisManager.h"
+#include "AliAnalysisFilter.h"
+#include "AliESDEvent.h"
+#include "AliESDtrack.h"
+#include "AliAODEvent.h"
+#include "AliAODTrack.h"
+#include "AliAODPid.h"
+#include "AliPIDResponseCache.h"
+#include "AliDeDxTrackTable.h"
+
+ClassImp(AliDeDxTrackTable);
+
+AliDeDxTrackTable* AliDeDxTrackTable::fgInstance = 0;
+
+//______________________________________________________________________________
+AliDeDxTrackTable::AliDeDxTrackTable() :
+  TObject(),
+  fEvent(0),
+  fEntry(-1),
+  fNTracks(0),
+  fTrack(),
+  fCharge(),
+  fP(),
+  fPt(),
+  fEta(),
+  fPhi(),
+  fPTPC(),
+  fHasTPCsignal(),
+  fDeDx(),
+  fNcl(),
+  fBeta(),
+  fLabel(),
+  fFilters()
+{
+  // Private constructor, use Instance()
+}
+
+//______________________________________________________________________________
+AliDeDxTrackTable::~AliDeDxTrackTable()
+{
+  // Destructor
+  if (fgInstance == this) fgInstance = 0;
+}
+
+//______________________________________________________________________________
+AliDeDxTrackTable* AliDeDxTrackTable::Instance()
+{
+  // The table of this process
+  if (!fgInstance) fgInstance = new AliDeDxTrackTable();
+  return fgInstance;
+}
+
+//______________________________________________________________________________
+void AliDeDxTrackTable::Clear(Option_t* /*option*/)
+{
+  // Empty the table, the storage is kept
+  fEvent = 0;
+  fEntry = -1;
+  fNTracks = 0;
+  for (UInt_t f = 0; f < fFilters.size(); f++) fFilters[f].fDone.assign(fFilters[f].fDone.size(), 0);
+}
+
+//______________________________________________________________________________
+Bool_t AliDeDxTrackTable::Update(const AliVEvent* ev)
+{
+  // Fill the table with the tracks of ev, unless it already holds them.
+  // Outside of an analysis manager event loop the table is refilled at each call.
+  if (!ev) {
+    Clear();
+    return kFALSE;
+  }
+  AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+  const Long64_t entry = (mgr) ? mgr->GetCurrentEntry() : -1;
+  if (entry >= 0 && entry == fEntry && ev == fEvent) return kTRUE;
+
+  Clear();
+  if (ev->IsA() == AliESDEvent::Class()) FillESD(static_cast<const AliESDEvent*>(ev));
+  else if (ev->IsA() == AliAODEvent::Class()) FillAOD(static_cast<const AliAODEvent*>(ev));
+  else return kFALSE;
+  fEvent = ev;
+  fEntry = entry;
+  return kTRUE;
+}
+
+//______________________________________________________________________________
+void AliDeDxTrackTable::Resize(Int_t n)
+{
+  // Make room for n tracks
+  fNTracks = n;
+  for (UInt_t f = 0; f < fFilters.size(); f++) {
+    if ((Int_t)fFilters[f].fDone.size() < n) {
+      fFilters[f].fMask.resize(n);
+      fFilters[f].fDone.resize(n, 0);
+    }
+  }
+  if ((Int_t)fTrack.size() >= n) return;
+  fTrack.resize(n);
+  fCharge.resize(n);
+  fP.resize(n);
+  fPt.resize(n);
+  fEta.resize(n);
+  fPhi.resize(n);
+  fPTPC.resize(n);
+  fHasTPCsignal.resize(n);
+  fDeDx.resize(n);
+  fNcl.resize(n);
+  fBeta.resize(n);
+  fLabel.resize(n);
+}
+
+//______________________________________________________________________________
+void AliDeDxTrackTable::SetKinematics(Int_t i, const AliVTrack* track)
+{
+  // Kinematics at the vertex and MC label
+  fCharge[i] = track->Charge();
+  fP[i] = track->P();
+  fPt[i] = track->Pt();
+  fEta[i] = track->Eta();
+  fPhi[i] = track->Phi();
+  fLabel[i] = track->GetLabel();
+}
+
+//______________________________________________________________________________
+void AliDeDxTrackTable::FillESD(const AliESDEvent* esd)
+{
+  // dE/dx variables of the ESD tracks
+  const Int_t n = esd->GetNumberOfTracks();
+  Resize(n);
+
+  for (Int_t i = 0; i < n; i++) {
+    AliESDtrack* track = esd->GetTrack(i);
+    fTrack[i] = track;
+    SetKinematics(i, track);
+    fPTPC[i] = track->GetTPCmomentum();
+    fHasTPCsignal[i] = kTRUE;
+    fDeDx[i] = track->GetTPCsignal();
+    fNcl[i] = track->GetTPCsignalN();
+
+    fBeta[i] = -99;
+    if (track->GetStatus() & AliESDtrack::kTOFout) {
+      const Float_t timeTOF = track->GetTOFsignal();
+      if (track->GetIntegratedLength() != 0 && timeTOF != 0) {
+        Double_t inttime[5] = {0, 0, 0, 0, 0};
+        track->GetIntegratedTimes(inttime);
+        fBeta[i] = inttime[0] / timeTOF;
+      }
+    }
+  }
+}
+
+//______________________________________________________________________________
+void AliDeDxTrackTable::FillAOD(const AliAODEvent* aod)
+{
+  // dE/dx variables of the AOD tracks, the TPC and TOF signals come from AliAODPid
+  const Int_t n = aod->GetNumberOfTracks();
+  Resize(n);
+
+  for (Int_t i = 0; i < n; i++) {
+    AliAODTrack* track = dynamic_cast<AliAODTrack*>(aod->GetTrack(i));
+    fTrack[i] = track;
+    fHasTPCsignal[i] = kFALSE;
+    fDeDx[i] = -10;
+    fNcl[i] = -10;
+    fBeta[i] = -99;
+    if (!track) {
+      fCharge[i] = 0;
+      fP[i] = fPt[i] = fEta[i] = fPhi[i] = fPTPC[i] = 0;
+      fLabel[i] = -1;
+      continue;
+    }
+    SetKinematics(i, track);
+    fPTPC[i] = track->GetTPCmomentum();
+
+    AliAODPid* pid = track->GetDetPid();
+    if (!pid) continue;
+    fHasTPCsignal[i] = kTRUE;
+    fDeDx[i] = pid->GetTPCsignal();
+    fNcl[i] = pid->GetTPCsignalN();
+    // No track length in the AOD, the time is enough
+    const Float_t timeTOF = pid->GetTOFsignal();
+    if ((track->GetStatus() & AliESDtrack::kTOFout) && timeTOF != 0) {
+      Double_t inttime[5] = {0, 0, 0, 0, 0};
+      pid->GetIntegratedTimes(inttime);
+      fBeta[i] = inttime[0] / timeTOF;
+    }
+  }
+}
+
+//______________________________________________________________________________
+UInt_t AliDeDxTrackTable::IsSelected(AliAnalysisFilter* filter, Int_t i)
+{
+  // Decision of filter for track i, evaluated at the first request of the event
+  if (!filter || !fTrack[i]) return 0;
+  FilterEntry* entry = 0;
+  for (UInt_t f = 0; f < fFilters.size() && !entry; f++) {
+    if (fFilters[f].fFilter == filter) entry = &fFilters[f];
+  }
+  if (!entry) {
+    fFilters.push_back(FilterEntry());
+    entry = &fFilters.back();
+    entry->fFilter = filter;
+    entry->fMask.resize(fNTracks);
+    entry->fDone.assign(fNTracks, 0);
+  }
+  if (!entry->fDone[i]) {
+    entry->fMask[i] = filter->IsSelected(fTrack[i]);
+    entry->fDone[i] = 1;
+  }
+  return entry->fMask[i];
+}
+
+//______________________________________________________________________________
+Float_t AliDeDxTrackTable::GetNSigmaTPC(const AliPIDResponse* pid, Int_t i, AliPID::EParticleType type) const
+{
+  // TPC n-sigma of a track, evaluated once per event for the whole train
+  if (!pid || !fTrack[i]) return -999.;
+  return AliPIDResponseCache::Instance()->NumberOfSigmasTPC(pid, fTrack[i], type);
+}
+
+//______________________________________________________________________________
+Float_t AliDeDxTrackTable::GetNSigmaTOF(const AliPIDResponse* pid, Int_t i, AliPID::EParticleType type) const
+{
+  // TOF n-sigma of a track, evaluated once per event for the whole train
+  if (!pid || !fTrack[i]) return -999.;
+  return AliPIDResponseCache::Instance()->NumberOfSigmasTOF(pid, fTrack[i], type);
+}
@@ -0,0 +1,101 @@
+#ifndef ALIDEDXTRACKTABLE_H
+#define ALIDEDXTRACKTABLE_H
+/* Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//-------------------------------------------------------------------------
+//     Process wide per event table of the TPC dE/dx variables of the
+//     tracks of the input event (ESD or AOD), filled once per event and
+//     shared by the high pT dE/dx QA and spectra wagons.
+//     Track i of the table is track i of the event. The variables are
+//     stored in one array per variable. The decisions of the track
+//     filters are evaluated at the first request and kept per filter
+//     object, so the wagons given the same AliAnalysisFilter evaluate
+//     the cuts once per track. The n-sigmas come from AliPIDResponseCache.
+//-------------------------------------------------------------------------
+
+#include <vector>
+#include <TObject.h>
+#include "AliPID.h"
+
+class AliVEvent;
+class AliVTrack;
+class AliESDEvent;
+class AliAODEvent;
+class AliPIDResponse;
+class AliAnalysisFilter;
+
+class AliDeDxTrackTable : public TObject {
+
+ public :
+  static AliDeDxTrackTable* Instance();
+  virtual ~AliDeDxTrackTable();
+
+  // Fill the table for the current event, a no-op if the event is already filled
+  Bool_t   Update(const AliVEvent* ev);
+  virtual void Clear(Option_t* option="");
+
+  Int_t    GetNTracks()                    const {return fNTracks;}
+  AliVTrack* GetTrack(Int_t i)             const {return fTrack[i];}
+  Short_t  GetCharge(Int_t i)              const {return fCharge[i];}
+  Double_t GetP(Int_t i)                   const {return fP[i];}
+  Double_t GetPt(Int_t i)                  const {return fPt[i];}
+  Double_t GetEta(Int_t i)                 const {return fEta[i];}
+  Double_t GetPhi(Int_t i)                 const {return fPhi[i];}
+  Double_t GetTPCmomentum(Int_t i)         const {return fPTPC[i];}
+  Bool_t   HasTPCsignal(Int_t i)           const {return fHasTPCsignal[i];}
+  Float_t  GetTPCsignal(Int_t i)           const {return fDeDx[i];}
+  Short_t  GetTPCsignalN(Int_t i)          const {return fNcl[i];}
+  Float_t  GetTOFBeta(Int_t i)             const {return fBeta[i];}
+  Int_t    GetLabel(Int_t i)               const {return fLabel[i];}
+
+  UInt_t   IsSelected(AliAnalysisFilter* filter, Int_t i);
+  Float_t  GetNSigmaTPC(const AliPIDResponse* pid, Int_t i, AliPID::EParticleType type) const;
+  Float_t  GetNSigmaTOF(const AliPIDResponse* pid, Int_t i, AliPID::EParticleType type) const;
+
+  const Double_t* GetEtas()                const {return fNTracks ? &fEta[0] : 0;}
+  const Float_t* GetTPCsignals()           const {return fNTracks ? &fDeDx[0] : 0;}
+  const Short_t* GetTPCsignalNs()          const {return fNTracks ? &fNcl[0] : 0;}
+
+ private:
+  // Decisions of one track filter, fDone tells which tracks were evaluated
+  struct FilterEntry {
+    AliAnalysisFilter*   fFilter;
+    std::vector<UInt_t>  fMask;
+    std::vector<UChar_t> fDone;
+  };
+
+  AliDeDxTrackTable();
+  AliDeDxTrackTable(const AliDeDxTrackTable& table); // not implemented
+  AliDeDxTrackTable& operator=(const AliDeDxTrackTable& table); // not implemented
+
+  void     Resize(Int_t n);
+  void     FillESD(const AliESDEvent* esd);
+  void     FillAOD(const AliAODEvent* aod);
+  void     SetKinematics(Int_t i, const AliVTrack* track);
+
+  const AliVEvent*     fEvent;           //! event of the table
+  Long64_t             fEntry;           //! analysis manager entry of the table
+  Int_t                fNTracks;         //! number of tracks in the table
+  std::vector<AliVTrack*> fTrack;        //! tracks of the event
+  std::vector<Short_t> fCharge;          //! charge
+  std::vector<Double_t> fP;              //! momentum at the vertex
+  std::vector<Double_t> fPt;             //! transverse momentum
+  std::vector<Double_t> fEta;            //! pseudorapidity
+  std::vector<Double_t> fPhi;            //! azimuth
+  std::vector<Double_t> fPTPC;           //! momentum at the inner wall of the TPC
+  std::vector<Bool_t>  fHasTPCsignal;    //! TPC PID information available (AOD tracks without AliAODPid have none)
+  std::vector<Float_t> fDeDx;            //! TPC dE/dx, -10 without PID information
+  std::vector<Short_t> fNcl;             //! number of clusters of the TPC dE/dx, -10 without PID information
+  std::vector<Float_t> fBeta;            //! as in the QA task: electron integrated time over TOF time if kTOFout, else -99
+  std::vector<Int_t>   fLabel;           //! MC label
+  std::vector<FilterEntry> fFilters;     //! decisions of the track filters asked for in this event
+
+  static AliDeDxTrackTable* fgInstance; //! the table of this process
+
+  ClassDef(AliDeDxTrackTable, 0);
+};
+
+#endif
@@ -89,6 +89,8 @@ AliAnalysisTaskSE(),
   fQyContainer(0),
   fSparseDist(0),
   fHruns(0),
+  fPhiDistMode(-1),
+  fQDistTable(),
   fQVector(0),
   fQContributionX(0),
   fQContributionY(0),
@@ -140,6 +142,8 @@ AliEPSelectionTask::AliEPSelectionTask(const char *name):
   fQyContainer(0),
   fSparseDist(0),
   fHruns(0),
+  fPhiDistMode(-1),
+  fQDistTable(),
   fQVector(0),
   fQContributionX(0),
   fQContributionY(0),
@@ -277,19 +281,13 @@ void AliEPSelectionTask::UserExec(Option_t */*option*/)
       }
 
       esdEP = esd->GetEventplane();
-      if (fSaveTrackContribution) {
-	esdEP->GetQContributionXArray()->Set(esd->GetNumberOfTracks());
-	esdEP->GetQContributionYArray()->Set(esd->GetNumberOfTracks());
-        esdEP->GetQContributionXArraysub1()->Set(esd->GetNumberOfTracks());
-	esdEP->GetQContributionYArraysub1()->Set(esd->GetNumberOfTracks());
-        esdEP->GetQContributionXArraysub2()->Set(esd->GetNumberOfTracks());
-	esdEP->GetQContributionYArraysub2()->Set(esd->GetNumberOfTracks());
-      }
+      if (fSaveTrackContribution) PrepareQContributions(esdEP, esd->GetNumberOfTracks());
 
-      TObjArray* tracklist = new TObjArray;
+      TObjArray* tracklist = 0;
       if (fTrackType.CompareTo("GLOBAL")==0) tracklist = fESDtrackCuts->GetAcceptedTracks(esd,kFALSE);
       if (fTrackType.CompareTo("TPC")==0 && fPeriod.CompareTo("LHC10h")==0) tracklist = fESDtrackCuts->GetAcceptedTracks(esd,kTRUE);
       else if (fTrackType.CompareTo("TPC")==0 && fPeriod.CompareTo("LHC11h")==0) tracklist = GetTracksForLHC11h(esd);
+      if (!tracklist) tracklist = new TObjArray;
       const int nt = tracklist->GetEntries();
 
       if (nt>4){
@@ -375,14 +373,7 @@ void AliEPSelectionTask::UserExec(Option_t */*option*/)
       Int_t maxID = 0;
       TObjArray* tracklist = GetAODTracksAndMaxID(aod,maxID);
 
-      if (fSaveTrackContribution) {
-	esdEP->GetQContributionXArray()->Set(maxID+1);
-	esdEP->GetQContributionYArray()->Set(maxID+1);
-	esdEP->GetQContributionXArraysub1()->Set(maxID+1);
-	esdEP->GetQContributionYArraysub1()->Set(maxID+1);
-	esdEP->GetQContributionXArraysub2()->Set(maxID+1);
-	esdEP->GetQContributionYArraysub2()->Set(maxID+1);
-      }
+      if (fSaveTrackContribution) PrepareQContributions(esdEP, maxID+1);
 
       const int NT = tracklist->GetEntries();
 
@@ -456,7 +447,7 @@ TVector2 AliEPSelectionTask::GetQ(AliEventplane* EP, TObjArray* tracklist)
   TVector2 mQ;
   float mQx=0, mQy=0;
   AliVTrack* track;
-  Double_t weight;
+  Double_t weight, qx, qy;
   Int_t idtemp = -1;
   // get recentering values
   Double_t mean[2], rms[2];
@@ -470,14 +461,16 @@ TVector2 AliEPSelectionTask::GetQ(AliEventplane* EP, TObjArray* tracklist)
     track = dynamic_cast<AliVTrack*> (tracklist->At(i));
     if (track) {
       weight = GetWeight(track);
+      qx = weight*cos(2*track->Phi())/rms[0];
+      qy = weight*sin(2*track->Phi())/rms[1];
     if (fSaveTrackContribution){
       idtemp = track->GetID();
       if ((fAnalysisInput.CompareTo("AOD")==0) && (fAODfilterbit == 128)) idtemp = idtemp*(-1) - 1;
-      EP->GetQContributionXArray()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-      EP->GetQContributionYArray()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+      EP->GetQContributionXArray()->AddAt(qx,idtemp);
+      EP->GetQContributionYArray()->AddAt(qy,idtemp);
      }
-     mQx += (weight*cos(2*track->Phi())/rms[0]);
-     mQy += (weight*sin(2*track->Phi())/rms[1]);
+     mQx += qx;
+     mQy += qy;
     }
   }
   mQ.Set(mQx-(mean[0]/rms[0]), mQy-(mean[1]/rms[1]));
@@ -490,7 +483,7 @@ void AliEPSelectionTask::GetQsub(TVector2 &Q1, TVector2 &Q2, TObjArray* tracklis
   // Get Qsub
   TVector2 mQ[2];
   float mQx1=0, mQy1=0, mQx2=0, mQy2=0;
-  Double_t weight;
+  Double_t weight, qx, qy;
   // get recentering values
   Double_t mean[2], rms[2];
   Recenter(0, mean);
@@ -510,6 +503,8 @@ void AliEPSelectionTask::GetQsub(TVector2 &Q1, TVector2 &Q2, TObjArray* tracklis
       track = dynamic_cast<AliVTrack*> (tracklist->At(i));
       if (!track) continue;
       weight = GetWeight(track);
+      qx = weight*cos(2*track->Phi())/rms[0];
+      qy = weight*sin(2*track->Phi())/rms[1];
       idtemp = track->GetID();
       if ((fAnalysisInput.CompareTo("AOD")==0) && (fAODfilterbit == 128)) idtemp = idtemp*(-1) - 1;
 
@@ -517,39 +512,39 @@ void AliEPSelectionTask::GetQsub(TVector2 &Q1, TVector2 &Q2, TObjArray* tracklis
       if( trackcounter1 < int(nt/2.) && trackcounter2 < int(nt/2.)){
         float random = rn.Rndm();
         if(random < .5){
-          mQx1 += (weight*cos(2*track->Phi())/rms[0]);
-          mQy1 += (weight*sin(2*track->Phi())/rms[1]);
+          mQx1 += qx;
+          mQy1 += qy;
           if (fSaveTrackContribution){
-            EP->GetQContributionXArraysub1()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-            EP->GetQContributionYArraysub1()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+            EP->GetQContributionXArraysub1()->AddAt(qx,idtemp);
+            EP->GetQContributionYArraysub1()->AddAt(qy,idtemp);
           }
           trackcounter1++;
         }
         else {
-          mQx2 += (weight*cos(2*track->Phi())/rms[0]);
-          mQy2 += (weight*sin(2*track->Phi())/rms[1]);
+          mQx2 += qx;
+          mQy2 += qy;
           if (fSaveTrackContribution){
-            EP->GetQContributionXArraysub2()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-            EP->GetQContributionYArraysub2()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+            EP->GetQContributionXArraysub2()->AddAt(qx,idtemp);
+            EP->GetQContributionYArraysub2()->AddAt(qy,idtemp);
           }
           trackcounter2++;
         }
       }
       else if( trackcounter1 >= int(nt/2.)){
-        mQx2 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy2 += (weight*sin(2*track->Phi())/rms[1]);
+        mQx2 += qx;
+        mQy2 += qy;
         if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub2()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub2()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+          EP->GetQContributionXArraysub2()->AddAt(qx,idtemp);
+          EP->GetQContributionYArraysub2()->AddAt(qy,idtemp);
         }
         trackcounter2++;
       }
       else {
-        mQx1 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy1 += (weight*sin(2*track->Phi())/rms[1]);
+        mQx1 += qx;
+        mQy1 += qy;
         if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub1()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub1()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+          EP->GetQContributionXArraysub1()->AddAt(qx,idtemp);
+          EP->GetQContributionYArraysub1()->AddAt(qy,idtemp);
         }
         trackcounter1++;
       }
@@ -561,23 +556,25 @@ void AliEPSelectionTask::GetQsub(TVector2 &Q1, TVector2 &Q2, TObjArray* tracklis
       track = dynamic_cast<AliVTrack*> (tracklist->At(i));
       if (!track) continue;
       weight = GetWeight(track);
+      qx = weight*cos(2*track->Phi())/rms[0];
+      qy = weight*sin(2*track->Phi())/rms[1];
       Double_t eta = track->Eta();
       idtemp = track->GetID();
       if ((fAnalysisInput.CompareTo("AOD")==0) && (fAODfilterbit == 128)) idtemp = idtemp*(-1) - 1;
 
       if (eta > fEtaGap/2.) {
-        mQx1 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy1 += (weight*sin(2*track->Phi())/rms[1]);
+        mQx1 += qx;
+        mQy1 += qy;
         if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub1()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub1()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+          EP->GetQContributionXArraysub1()->AddAt(qx,idtemp);
+          EP->GetQContributionYArraysub1()->AddAt(qy,idtemp);
         }
       } else if (eta < -1.*fEtaGap/2.) {
-        mQx2 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy2 += (weight*sin(2*track->Phi())/rms[1]);
+        mQx2 += qx;
+        mQy2 += qy;
         if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub2()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub2()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+          EP->GetQContributionXArraysub2()->AddAt(qx,idtemp);
+          EP->GetQContributionYArraysub2()->AddAt(qy,idtemp);
         }
       }
     }
@@ -588,23 +585,25 @@ void AliEPSelectionTask::GetQsub(TVector2 &Q1, TVector2 &Q2, TObjArray* tracklis
       track = dynamic_cast<AliVTrack*> (tracklist->At(i));
       if (!track) continue;
       weight = GetWeight(track);
+      qx = weight*cos(2*track->Phi())/rms[0];
+      qy = weight*sin(2*track->Phi())/rms[1];
       Short_t cha = track->Charge();
       idtemp = track->GetID();
       if ((fAnalysisInput.CompareTo("AOD")==0) && (fAODfilterbit == 128)) idtemp = idtemp*(-1) - 1;
 
       if (cha > 0) {
-        mQx1 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy1 += (weight*sin(2*track->Phi())/rms[1]);
+        mQx1 += qx;
+        mQy1 += qy;
         if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub1()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub1()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+          EP->GetQContributionXArraysub1()->AddAt(qx,idtemp);
+          EP->GetQContributionYArraysub1()->AddAt(qy,idtemp);
         }
       } else if (cha < 0) {
-        mQx2 += (weight*cos(2*track->Phi())/rms[0]);
-        mQy2 += (weight*sin(2*track->Phi())/rms[1]);
+        mQx2 += qx;
+        mQy2 += qy;
         if (fSaveTrackContribution){
-          EP->GetQContributionXArraysub2()->AddAt(weight*cos(2*track->Phi())/rms[0],idtemp);
-          EP->GetQContributionYArraysub2()->AddAt(weight*sin(2*track->Phi())/rms[1],idtemp);
+          EP->GetQContributionXArraysub2()->AddAt(qx,idtemp);
+          EP->GetQContributionYArraysub2()->AddAt(qy,idtemp);
         }
       }
     }
@@ -692,24 +691,41 @@ Double_t AliEPSelectionTask::GetPhiWeight(TObject* track1)
 {
   Double_t phiweight=1;
   AliVTrack* track = dynamic_cast<AliVTrack*>(track1);
+  if (!fUsePhiWeight || !track) return phiweight;
 
-  TH1F *phiDist = 0x0;
-  if(track) phiDist = SelectPhiDist(track);
-
-  if (fUsePhiWeight && phiDist && track) {
-    Double_t nParticles = phiDist->Integral();
-    Double_t nPhibins = phiDist->GetNbinsX();
-
-    Double_t Phi = track->Phi();
+  Int_t idist = SelectPhiDistIndex(track);
+  if (idist < 0 || !fPhiDist[idist]) return phiweight;
+  if (!fPhiWeights[idist].GetSize()) FillPhiWeights();
 
-    while (Phi<0) Phi += TMath::TwoPi();
-    while (Phi>TMath::TwoPi()) Phi -= TMath::TwoPi();
+  // the weights are tabulated once per run, the bin lookup is the one of TH1::GetBinContent
+  const TArrayD &weights = fPhiWeights[idist];
+  Double_t nPhibins = weights.GetSize()-2;
+  Int_t phibin = 1+TMath::FloorNint((track->Phi())*nPhibins/TMath::TwoPi());
+  if (phibin < 0) phibin = 0;
+  if (phibin > weights.GetSize()-1) phibin = weights.GetSize()-1;
+  phiweight = weights[phibin];
 
-    Double_t PhiDistValue = phiDist->GetBinContent(1+TMath::FloorNint((track->Phi())*nPhibins/TMath::TwoPi()));
+  return phiweight;
+}
 
-    if (PhiDistValue > 0) phiweight = nParticles/nPhibins/PhiDistValue;
+//________________________________________________________________________
+void AliEPSelectionTask::FillPhiWeights()
+{
+  // Tabulate the phi weights of the current phi distributions,
+  // bins 0 and n+1 are the under- and overflow
+  for (Int_t i = 0; i<4; i++){
+    if (!fPhiDist[i]) {
+      fPhiWeights[i].Set(0);
+      continue;
+    }
+    Double_t nParticles = fPhiDist[i]->Integral();
+    Double_t nPhibins = fPhiDist[i]->GetNbinsX();
+    fPhiWeights[i].Set(fPhiDist[i]->GetNbinsX()+2);
+    for (Int_t ibin = 0; ibin<fPhiWeights[i].GetSize(); ibin++){
+      Double_t PhiDistValue = fPhiDist[i]->GetBinContent(ibin);
+      fPhiWeights[i][ibin] = (PhiDistValue > 0) ? nParticles/nPhibins/PhiDistValue : 1.;
+    }
   }
-  return phiweight;
 }
 
 //________________________________________________________________________
@@ -719,7 +735,11 @@ void AliEPSelectionTask::Recenter(Int_t var, Double_t * values)
   if (fUseRecentering && fQDist[0] && fQDist[1] && fCentrality!=-1.) {
     Int_t centbin = fQDist[0]->FindBin(fCentrality);
 
-    if(var==0) { // fill mean
+    if (centbin >= 0 && 4*centbin < fQDistTable.GetSize() && (var==0 || var==1)) { // values of the run tabulated in SetQvectorDist
+      values[0] = fQDistTable[4*centbin+2*var];
+      values[1] = fQDistTable[4*centbin+2*var+1];
+    }
+    else if(var==0) { // fill mean
       values[0] = fQDist[0]->GetBinContent(centbin);
       values[1] = fQDist[1]->GetBinContent(centbin);
     }
@@ -741,6 +761,7 @@ void AliEPSelectionTask::Recenter(Int_t var, Double_t * values)
 //__________________________________________________________________________
 void AliEPSelectionTask::SetPhiDist()
 {
+  fPhiDistMode = -1;
   if(!fUserphidist && (fPeriod.CompareTo("LHC10h") == 0 || fPeriod.CompareTo("LHC11h") == 0)) { // if it's already set and custom class is required, we use the one provided by the user
 
     if (fPeriod.CompareTo("LHC10h")==0)
@@ -814,11 +835,13 @@ void AliEPSelectionTask::SetPhiDist()
   AliInfo("No Phi-weights available. All Phi weights set to 1");
   SetUsePhiWeight(kFALSE);
   }
+  FillPhiWeights();
 }
 
 //__________________________________________________________________________
 void AliEPSelectionTask::SetQvectorDist()
 {
+  fQDistTable.Set(0);
   if(!fUseRecentering) return;
   AliInfo(Form("Setting q vector distributions"));
   fQDist[0] = (TProfile*) fQxContainer->GetObject(fRunNumber, "Default");
@@ -852,6 +875,19 @@ void AliEPSelectionTask::SetQvectorDist()
   if (emptybins) {
     AliError("After Maximum of rebinning still empty Qxy-bins!!!");
   }
+
+  // tabulate mean and rms per centrality bin for the run, as read in Recenter
+  fQDistTable.Set(4*(fQDist[0]->GetNbinsX()+2));
+  for (Int_t i = 0; 4*i<fQDistTable.GetSize(); i++){
+    Double_t *values = fQDistTable.GetArray()+4*i;
+    values[0] = fQDist[0]->GetBinContent(i);
+    values[1] = fQDist[1]->GetBinContent(i);
+    values[2] = fQDist[0]->GetBinError(i);
+    values[3] = fQDist[1]->GetBinError(i);
+    // protection against division by zero
+    if(values[2]==0.0) values[2]=1.0;
+    if(values[3]==0.0) values[3]=1.0;
+  }
 }
 
 //__________________________________________________________________________
@@ -864,6 +900,8 @@ void AliEPSelectionTask::SetPersonalPhiDistribution(const char* infilename, char
   TObject* list = f.Get(listname);
   fPhiDist[0] = (TH1F*)list->FindObject("fHOutPhi");
   if (!fPhiDist[0]) AliFatal("Phi Distribution not found!!!");
+  fPhiDistMode = -1;
+  FillPhiWeights();
 
   f.Close();
 }
@@ -965,22 +1003,51 @@ void AliEPSelectionTask::SetOADBandPeriod()
 //_________________________________________________________________________
 TH1F* AliEPSelectionTask::SelectPhiDist(AliVTrack *track)
 {
-  if (fPeriod.CompareTo("LHC10h")==0  || fUserphidist) return fPhiDist[0];
-  else if(fPeriod.CompareTo("LHC11h")==0)
+  Int_t idist = SelectPhiDistIndex(track);
+  if (idist < 0) return 0;
+  return fPhiDist[idist];
+}
+
+//_________________________________________________________________________
+Int_t AliEPSelectionTask::SelectPhiDistIndex(AliVTrack *track)
+{
+  // Index in fPhiDist of the phi distribution of the track, -1 if none;
+  // the period dependence is resolved once per run
+  if (fPhiDistMode < 0) {
+    if (fPeriod.CompareTo("LHC10h")==0  || fUserphidist) fPhiDistMode = 0;
+    else if(fPeriod.CompareTo("LHC11h")==0) fPhiDistMode = 1;
+    else fPhiDistMode = 2;
+  }
+  if (fPhiDistMode == 0) return 0;
+  else if (fPhiDistMode == 1)
     {
      if (track->Charge() < 0)
        {
-        if(track->Eta() < 0.)       return fPhiDist[0];
-        else if (track->Eta() > 0.) return fPhiDist[2];
+        if(track->Eta() < 0.)       return 0;
+        else if (track->Eta() > 0.) return 2;
        }
       else if (track->Charge() > 0)
        {
-        if(track->Eta() < 0.)       return fPhiDist[1];
-        else if (track->Eta() > 0.) return fPhiDist[3];
+        if(track->Eta() < 0.)       return 1;
+        else if (track->Eta() > 0.) return 3;
        }
 
     }
-  return 0;
+  return -1;
+}
+
+//_________________________________________________________________________
+void AliEPSelectionTask::PrepareQContributions(AliEventplane* EP, Int_t ntracks)
+{
+  // The contribution arrays are zeroed and only grown: they are not
+  // reallocated in every event, their size is at least ntracks
+  TArrayF* arrays[6] = { EP->GetQContributionXArray(), EP->GetQContributionYArray(),
+                         EP->GetQContributionXArraysub1(), EP->GetQContributionYArraysub1(),
+                         EP->GetQContributionXArraysub2(), EP->GetQContributionYArraysub2() };
+  for (Int_t i = 0; i<6; i++){
+    arrays[i]->Reset();
+    if (arrays[i]->GetSize() < ntracks) arrays[i]->Set(ntracks);
+  }
 }
 
 TObjArray* AliEPSelectionTask::GetTracksForLHC11h(AliESDEvent* esd)
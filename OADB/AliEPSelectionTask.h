@@ -9,6 +9,8 @@
 //   author: Alberica Toia, Johanna Gramling
 //*****************************************************
 
+#include <TArrayD.h>
+
 #include "AliAnalysisTaskSE.h"
 
 class TFile;
@@ -17,6 +19,7 @@ class TH2F;
 class TList;
 class TString;
 class TVector2;
+class TArrayF;
 
 class AliESDEvent;
 class AliESDtrackCuts;
@@ -54,7 +57,7 @@ class AliEPSelectionTask : public AliAnalysisTaskSE {
   void SetUsePhiWeight(Bool_t usephi = kTRUE){fUsePhiWeight = usephi;}
   void SetUsePtWeight()			     {fUsePtWeight = kTRUE;}
   void SetUseRecentering()		     {fUseRecentering = kTRUE;}
-  void SetSaveTrackContribution()	     {fSaveTrackContribution = kTRUE;}
+  void SetSaveTrackContribution(Bool_t save = kTRUE) {fSaveTrackContribution = save;}
   void SetTrackType(TString tracktype);
   void SetPhiDist();
   void SetQvectorDist();
@@ -72,6 +75,9 @@ class AliEPSelectionTask : public AliAnalysisTaskSE {
   TObjArray* GetAODTracksAndMaxID(AliAODEvent* aod, Int_t& maxid);
   void SetOADBandPeriod();
   TH1F* SelectPhiDist(AliVTrack *track);
+  Int_t SelectPhiDistIndex(AliVTrack *track);
+  void FillPhiWeights();
+  void PrepareQContributions(AliEventplane* EP, Int_t ntracks);
   TObjArray* GetTracksForLHC11h(AliESDEvent* esd);
 
   TString  fAnalysisInput; 		// "ESD", "AOD"
@@ -100,6 +106,9 @@ class AliEPSelectionTask : public AliAnalysisTaskSE {
   THnSparse *fSparseDist;               //! THn for eta-charge phi-weighting
   TProfile* fQDist[2];			// array of TProfiles with mean+rms for recentering
   TH1F *fHruns;                         // information about runwise statistics of phi-weights
+  TArrayD fPhiWeights[4];		//! phi weights of the run per bin of fPhiDist, with under- and overflow
+  Int_t fPhiDistMode;			//! 0: one phi distribution, 1: charge and eta dependent, 2: none, -1: to be determined
+  TArrayD fQDistTable;			//! mean x, mean y, rms x, rms y of the run per centrality bin of fQDist
 
   TVector2* fQVector;			//! Q-Vector of the event  
   Double_t* fQContributionX;		//! array of the tracks' contributions to X component of Q-Vector - index = track ID
@@ -119,7 +128,7 @@ class AliEPSelectionTask : public AliAnalysisTaskSE {
   TH2F*	 fHOutDiff;			//! control histogram: Difference of MC RP and EP - only filled if fUseMCRP is true!
   TH2F*  fHOutleadPTPsi;		//! control histogram: emission angle of leading pT track vs EP angle
 
-  ClassDef(AliEPSelectionTask,4); 
+  ClassDef(AliEPSelectionTask,5); 
 };
 
 #endif
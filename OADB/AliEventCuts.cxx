@@ -29,6 +29,67 @@ using std::vector;
 ClassImp(AliEventCutsContainer);
 ClassImp(AliEventCuts);
 
+namespace {
+  /// Selection of the current event for one configuration of the cuts, shared by
+  /// all the AliEventCuts instances of the process with this configuration.
+  struct SharedResult {
+    string        fConfig;                ///< Configuration key, see AliEventCuts::ConfigurationKey()
+    bool          fFilled;                ///< The selection of the current event is stored
+    unsigned long fFlag;                  ///< Flag of the passed cuts
+    float         fCentPercentiles[2];    ///< Centrality percentiles
+    AliVVertex   *fPrimaryVertex;         ///< Primary vertex pointer
+    double        fDeltaVtz;              ///< Difference between the track and the SPD vertex z
+    int           fNtrkl;                 ///< Number of SPD tracklets
+    AliEventCutsContainer fContainer;     ///< Track multiplicities
+    unsigned int  fQAfilled;              ///< QA histograms already filled for the event by an instance, see EQAplots
+  };
+
+  /// Groups of QA histograms, an instance books the correlation plots only on request
+  enum EQAplots { kBasicQA = BIT(0), kCorrelationQA = BIT(1) };
+
+  const AliVEvent*     gSharedEvent = nullptr;   ///< Event of the shared results
+  Long64_t             gSharedEntry = -1;        ///< Analysis manager entry of the shared results
+  unsigned long        gSharedEventId = 0ul;     ///< Bunch crossing and time stamp of the shared results
+  vector<SharedResult> gSharedResults;          ///< Shared results, one per configuration
+
+  /// Result for this configuration in the current event, the results of the previous event are dropped.
+  /// Outside an analysis train loop the event can not be identified and nothing is shared.
+  SharedResult* FindSharedResult(AliVEvent *ev, const string &config) {
+    AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+    const Long64_t entry = (mgr) ? mgr->GetCurrentEntry() : -1;
+    if (entry < 0) return nullptr;
+
+    const unsigned long evid = ((unsigned long)(ev->GetBunchCrossNumber()) << 32) + ev->GetTimeStamp();
+    if (ev != gSharedEvent || entry != gSharedEntry || evid != gSharedEventId) {
+      gSharedEvent = ev;
+      gSharedEntry = entry;
+      gSharedEventId = evid;
+      for (auto& res : gSharedResults) {
+        res.fFilled = false;
+        res.fQAfilled = 0u;
+      }
+    }
+
+    for (auto& res : gSharedResults)
+      if (res.fConfig == config) return &res;
+
+    gSharedResults.emplace_back();
+    gSharedResults.back().fConfig = config;
+    gSharedResults.back().fFilled = false;
+    gSharedResults.back().fQAfilled = 0u;
+    return &gSharedResults.back();
+  }
+
+  template<typename T> void AppendToKey(string &key, const T &val) {
+    key.append(reinterpret_cast<const char*>(&val), sizeof(T));
+  }
+
+  void AppendToKey(string &key, const string &val) {
+    AppendToKey(key, val.size());
+    key.append(val);
+  }
+}
+
 
 
 /// Standard constructor with null selection
@@ -68,6 +129,9 @@ AliEventCuts::AliEventCuts(bool saveplots) : TList(),
   fFB128vsTrklLinearCut{1.e8,0.},
   fRequireExactTriggerMask{false},
   fTriggerMask{AliVEvent::kAny},
+  fShareResults{true},
+  fQAdownscale{1u},
+  fShareQA{false},
   fContainer{},
   fkLabels{"raw","selected"},
   fManualMode{false},
@@ -107,6 +171,95 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
     AddQAplotsToList();
   }
 
+  /// The selection of this event by an identically configured instance is reused, the QA is filled by each instance.
+  double dz = 0.;
+  int ntrkl = 0;
+  SharedResult *shared = (fShareResults) ? FindSharedResult(ev, ConfigurationKey()) : nullptr;
+  if (shared && shared->fFilled) {
+    fFlag = shared->fFlag;
+    fCentPercentiles[0] = shared->fCentPercentiles[0];
+    fCentPercentiles[1] = shared->fCentPercentiles[1];
+    fPrimaryVertex = shared->fPrimaryVertex;
+    dz = shared->fDeltaVtz;
+    ntrkl = shared->fNtrkl;
+    if (fUseVariablesCorrelationCuts && !fMC) fContainer = shared->fContainer;
+  } else {
+    ComputeSelection(ev, dz, ntrkl);
+    if (shared) {
+      shared->fFilled = true;
+      shared->fFlag = fFlag;
+      shared->fCentPercentiles[0] = fCentPercentiles[0];
+      shared->fCentPercentiles[1] = fCentPercentiles[1];
+      shared->fPrimaryVertex = fPrimaryVertex;
+      shared->fDeltaVtz = dz;
+      shared->fNtrkl = ntrkl;
+      if (fUseVariablesCorrelationCuts && !fMC) shared->fContainer = fContainer;
+    }
+  }
+
+  const AliVVertex* vtx = fPrimaryVertex;
+  bool allcuts = fFlag & BIT(kAllCuts);
+  if (fCutStats) {
+    for (int iCut = kNoCuts; iCut <= kAllCuts; ++iCut) {
+      if (TESTBIT(fFlag,iCut))
+        fCutStats->Fill(iCut);
+    }
+  }
+
+
+  /// Sampled QA: one event out of fQAdownscale, weighted. With fShareQA each group of plots is filled
+  /// by the first instance of this configuration that processes the event and has booked it.
+  bool fillBasic = (fQAdownscale <= 1u || IsSampledEvent(ev, fQAdownscale));
+  bool fillCorr = fillBasic;
+  const double qaWeight = (fQAdownscale > 1u) ? double(fQAdownscale) : 1.;
+  if (fillBasic && fShareQA && shared) {
+    fillBasic = !(shared->fQAfilled & kBasicQA);
+    fillCorr = !(shared->fQAfilled & kCorrelationQA);
+    if (fillBasic && fVtz[0]) shared->fQAfilled |= kBasicQA;
+    if (fillCorr && fTOFvsFB32[0]) shared->fQAfilled |= kCorrelationQA;
+  }
+
+  /// Filling the monitoring histograms (first iteration always filled, second iteration only for selected events.
+  for (int befaft = 0; befaft < 2; ++befaft) {
+    if (fillBasic) {
+      if (fCentrality[befaft]) fCentrality[befaft]->Fill(fCentPercentiles[0],qaWeight);
+      if (fEstimCorrelation[befaft]) fEstimCorrelation[befaft]->Fill(fCentPercentiles[1],fCentPercentiles[0],qaWeight);
+      if (fMultCentCorrelation[befaft]) fMultCentCorrelation[befaft]->Fill(fCentPercentiles[0],ntrkl,qaWeight);
+      if (fVtz[befaft]) fVtz[befaft]->Fill(vtx->GetZ(),qaWeight);
+      if (fDeltaTrackSPDvtz[befaft]) fDeltaTrackSPDvtz[befaft]->Fill(dz,qaWeight);
+    }
+    if (fillCorr) {
+      if (fTOFvsFB32[befaft]) fTOFvsFB32[befaft]->Fill(fContainer.fMultTrkFB32,fContainer.fMultTrkFB32TOF,qaWeight);
+      if (fTPCvsAll[befaft])  fTPCvsAll[befaft]->Fill(fContainer.fMultTrkTPC,float(fContainer.fMultESD) - fESDvsTPConlyLinearCut[1] * fContainer.fMultTrkTPC,qaWeight);
+      if (fMultvsV0M[befaft]) fMultvsV0M[befaft]->Fill(GetCentrality(),fContainer.fMultTrkFB32Acc,qaWeight);
+      if (fTPCvsTrkl[befaft]) fTPCvsTrkl[befaft]->Fill(ntrkl,fContainer.fMultTrkTPC,qaWeight);
+    }
+    if (!allcuts) return false; /// Do not fill the "after" histograms if the event does not pass the cuts.
+  }
+
+  return true;
+}
+
+bool AliEventCuts::IsSampledEvent(const AliVEvent *ev, unsigned int downscale) {
+  /// Deterministic 1 in downscale selection on a hash of the event id, the same events for all the
+  /// wagons and for any splitting of the input. Without event id (MC) the train entry is used.
+  if (downscale <= 1u) return true;
+  unsigned long long id = ((unsigned long long)ev->GetPeriodNumber() << 36) ^ ((unsigned long long)ev->GetOrbitNumber() << 12) ^ ev->GetBunchCrossNumber();
+  if (id == 0ull) {
+    AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+    id = (mgr) ? (unsigned long long)mgr->GetCurrentEntry() : 0ull;
+  }
+  id ^= (unsigned long long)ev->GetRunNumber() << 40;
+  /// splitmix64 finaliser: the regular patterns of the ids do not bias the sample
+  id += 0x9e3779b97f4a7c15ull;
+  id = (id ^ (id >> 30)) * 0xbf58476d1ce4e5b9ull;
+  id = (id ^ (id >> 27)) * 0x94d049bb133111ebull;
+  id ^= id >> 31;
+  return (id % downscale) == 0ull;
+}
+
+void AliEventCuts::ComputeSelection(AliVEvent *ev, double &dz, int &ntrkl) {
+  /// Evaluate all the cuts on this event, dz and ntrkl are filled for the QA plots
   /// Event selection flag, as soon as the event does not pass one cut this becomes false.
   fFlag = BIT(kNoCuts);
 
@@ -131,7 +284,7 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
   double covTrc[6],covSPD[6];
   vtTrc->GetCovarianceMatrix(covTrc);
   vtSPD->GetCovarianceMatrix(covSPD);
-  double dz = vtTrc->GetZ() - vtSPD->GetZ();
+  dz = vtTrc->GetZ() - vtSPD->GetZ();
   double errTot = TMath::Sqrt(covTrc[5]+covSPD[5]);
   double errTrc = TMath::Sqrt(covTrc[5]);
   double nsigTot = TMath::Abs(dz) / errTot, nsigTrc = TMath::Abs(dz) / errTrc;
@@ -157,7 +310,7 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
   /// * Check for min and max centrality
   /// * Cross check correlation between two centrality estimators
   AliVMultiplicity* mult = ev->GetMultiplicity();
-  const int ntrkl = mult->GetNumberOfTracklets();
+  ntrkl = mult->GetNumberOfTracklets();
   if (fCentralityFramework) {
     if (fCentralityFramework == 2) {
       AliCentrality* cent = ev->GetCentrality();
@@ -194,31 +347,7 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
       fFlag |= BIT(kCorrelations);
   } else fFlag |= BIT(kCorrelations);
 
-  bool allcuts = (fFlag == (BIT(kAllCuts) - 1));
-  if (allcuts) fFlag |= BIT(kAllCuts);
-  if (fCutStats) {
-    for (int iCut = kNoCuts; iCut <= kAllCuts; ++iCut) {
-      if (TESTBIT(fFlag,iCut))
-        fCutStats->Fill(iCut);
-    }
-  }
-
-
-  /// Filling the monitoring histograms (first iteration always filled, second iteration only for selected events.
-  for (int befaft = 0; befaft < 2; ++befaft) {
-    if (fCentrality[befaft]) fCentrality[befaft]->Fill(fCentPercentiles[0]);
-    if (fEstimCorrelation[befaft]) fEstimCorrelation[befaft]->Fill(fCentPercentiles[1],fCentPercentiles[0]);
-    if (fMultCentCorrelation[befaft]) fMultCentCorrelation[befaft]->Fill(fCentPercentiles[0],ntrkl);
-    if (fVtz[befaft]) fVtz[befaft]->Fill(vtx->GetZ());
-    if (fDeltaTrackSPDvtz[befaft]) fDeltaTrackSPDvtz[befaft]->Fill(dz);
-    if (fTOFvsFB32[befaft]) fTOFvsFB32[befaft]->Fill(fContainer.fMultTrkFB32,fContainer.fMultTrkFB32TOF);
-    if (fTPCvsAll[befaft])  fTPCvsAll[befaft]->Fill(fContainer.fMultTrkTPC,float(fContainer.fMultESD) - fESDvsTPConlyLinearCut[1] * fContainer.fMultTrkTPC);
-    if (fMultvsV0M[befaft]) fMultvsV0M[befaft]->Fill(GetCentrality(),fContainer.fMultTrkFB32Acc);
-    if (fTPCvsTrkl[befaft]) fTPCvsTrkl[befaft]->Fill(ntrkl,fContainer.fMultTrkTPC);
-    if (!allcuts) return false; /// Do not fill the "after" histograms if the event does not pass the cuts.
-  }
-
-  return true;
+  if (fFlag == (BIT(kAllCuts) - 1)) fFlag |= BIT(kAllCuts);
 }
 
 void AliEventCuts::AddQAplotsToList(TList *qaList, bool addCorrelationPlots) {
@@ -313,6 +442,62 @@ string AliEventCuts::GetCentralityEstimator (unsigned int estimator) const {
 }
 
 
+string AliEventCuts::ConfigurationKey() const {
+  /// All the settings the selection depends on, compared byte by byte
+  string key;
+  AppendToKey(key, fMC);
+  AppendToKey(key, fRequireTrackVertex);
+  AppendToKey(key, fMinVtz);
+  AppendToKey(key, fMaxVtz);
+  AppendToKey(key, fMaxDeltaSpdTrackAbsolute);
+  AppendToKey(key, fMaxDeltaSpdTrackNsigmaSPD);
+  AppendToKey(key, fMaxDeltaSpdTrackNsigmaTrack);
+  AppendToKey(key, fMaxResolutionSPDvertex);
+  AppendToKey(key, fRejectDAQincomplete);
+  AppendToKey(key, fRequiredSolenoidPolarity);
+  AppendToKey(key, fSPDpileupMinContributors);
+  AppendToKey(key, fSPDpileupMinZdist);
+  AppendToKey(key, fSPDpileupNsigmaZdist);
+  AppendToKey(key, fSPDpileupNsigmaDiamXY);
+  AppendToKey(key, fSPDpileupNsigmaDiamZ);
+  AppendToKey(key, fTrackletBGcut);
+  if (fTrackletBGcut) {
+    AppendToKey(key, fUtils.fASPDCvsTCut);
+    AppendToKey(key, fUtils.fBSPDCvsTCut);
+  }
+  AppendToKey(key, fPileUpCutMV);
+  if (fPileUpCutMV) {
+    AppendToKey(key, fUtils.fMinPlpContribMV);
+    AppendToKey(key, fUtils.fMaxPlpChi2MV);
+    AppendToKey(key, fUtils.fMinWDistMV);
+    AppendToKey(key, fUtils.fCheckPlpFromDifferentBCMV);
+  }
+  AppendToKey(key, fCentralityFramework);
+  AppendToKey(key, fMinCentrality);
+  AppendToKey(key, fMaxCentrality);
+  AppendToKey(key, fCentEstimators[0]);
+  AppendToKey(key, fCentEstimators[1]);
+  AppendToKey(key, fUseVariablesCorrelationCuts);
+  AppendToKey(key, fUseEstimatorsCorrelationCut);
+  AppendToKey(key, fEstimatorsCorrelationCoef);
+  AppendToKey(key, fEstimatorsSigmaPars);
+  AppendToKey(key, fDeltaEstimatorNsigma);
+  AppendToKey(key, fTOFvsFB32correlationPars);
+  AppendToKey(key, fTOFvsFB32sigmaPars);
+  AppendToKey(key, fTOFvsFB32nSigmaCut);
+  AppendToKey(key, fESDvsTPConlyLinearCut);
+  AppendToKey(key, fFB128vsTrklLinearCut);
+  AppendToKey(key, fMultiplicityV0McorrCut != nullptr);
+  if (fMultiplicityV0McorrCut) {
+    AppendToKey(key, string(fMultiplicityV0McorrCut->GetTitle()));
+    for (int iP = 0; iP < fMultiplicityV0McorrCut->GetNpar(); ++iP)
+      AppendToKey(key, fMultiplicityV0McorrCut->GetParameter(iP));
+  }
+  AppendToKey(key, fRequireExactTriggerMask);
+  AppendToKey(key, fTriggerMask);
+  return key;
+}
+
 void AliEventCuts::ComputeTrackMultiplicity(AliVEvent *ev) {
   AliEventCutsContainer* tmp_cont = static_cast<AliEventCutsContainer*>(ev->FindListObject("AliEventCutsContainer"));
   if (tmp_cont) {
@@ -59,6 +59,8 @@ class AliEventCuts : public TList {
     void   AddQAplotsToList(TList *qaList = 0x0, bool addCorrelationPlots = false);
     void   OverrideAutomaticTriggerSelection(unsigned long tr, bool ov = true) { fTriggerMask = tr; fOverrideAutoTriggerMask = ov; }
     void   SetManualMode (bool man = true) { fManualMode = man; }
+    void   SetQAdownscale (unsigned int n, bool shareQA = false) { fQAdownscale = n; fShareQA = shareQA; }
+    static bool IsSampledEvent (const AliVEvent *ev, unsigned int downscale);
     void   SetupLHC11h();
     void   SetupLHC15o();
     void   SetupRun2pp();
@@ -118,12 +120,18 @@ class AliEventCuts : public TList {
     bool          fRequireExactTriggerMask;       ///< If true the event selection mask is required to be equal to fTriggerMask
     unsigned long fTriggerMask;                   ///< Trigger mask
 
+    bool          fShareResults;                  ///< If true the selection of the event is shared with the identically configured instances, which evaluate it once per event
+    unsigned int  fQAdownscale;                   ///< The QA histograms (but fCutStats) are filled for one event out of fQAdownscale, with weight fQAdownscale. The events are the same for all the instances, see IsSampledEvent()
+    bool          fShareQA;                       ///< If true (and fShareResults) only the first identically configured instance processing the event fills the QA histograms (but fCutStats)
+
     AliEventCutsContainer fContainer;       //!<! Local copy of the event cuts container (safe against user changes)
     const string  fkLabels[2];                    ///< Histograms labels (raw/selected)
 
   private:
     void          AutomaticSetup (AliVEvent *ev);
     void          ComputeTrackMultiplicity(AliVEvent *ev);
+    void          ComputeSelection(AliVEvent *ev, double &dz, int &ntrkl);
+    string        ConfigurationKey() const;
     template<typename F> F PolN(F x, F* coef, int n);
 
     bool          fManualMode;                    ///< if true the cuts are not loaded automatically looking at the run number
@@ -153,7 +161,7 @@ class AliEventCuts : public TList {
     TH2F* fMultvsV0M[2];           //!<!
     TH2F* fTPCvsTrkl[2];           //!<!
 
-    ClassDef(AliEventCuts,1)
+    ClassDef(AliEventCuts,3)
 };
 
 template<typename F> F AliEventCuts::PolN(F x,F* coef, int n) {
@@ -0,0 +1,95 @@
+/**************************************************************************
+ * Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+//-------------------------------------------------------------------------
+//     Process wide cache of OADB containers, one read per file and
+//     container name, shared read only by all tasks of the train
+//-------------------------------------------------------------------------
+
+#include <TString.h>
+#include <TSystem.h>
+#include "AliOADBContainer.h"
+#include "AliLog.h"
+#include "AliOADBContainerCache.h"
+
+ClassImp(AliOADBContainerCache);
+
+AliOADBContainerCache* AliOADBContainerCache::fgInstance = 0;
+
+//______________________________________________________________________________
+AliOADBContainerCache::AliOADBContainerCache() :
+  TObject(),
+  fContainers(),
+  fNFileOpens(0)
+{
+  // Private constructor, use Instance()
+}
+
+//______________________________________________________________________________
+AliOADBContainerCache::~AliOADBContainerCache()
+{
+  // Destructor
+  Clear();
+  if (fgInstance == this) fgInstance = 0;
+}
+
+//______________________________________________________________________________
+AliOADBContainerCache* AliOADBContainerCache::Instance()
+{
+  // The cache of this process
+  if (!fgInstance) fgInstance = new AliOADBContainerCache();
+  return fgInstance;
+}
+
+//______________________________________________________________________________
+std::string AliOADBContainerCache::Key(const char* fileName, const char* containerName) const
+{
+  // Expand the file name so that $ALICE_PHYSICS/OADB/... and the
+  // AliAnalysisManager::GetOADBPath() spellings share the same entry
+  TString file(fileName);
+  gSystem->ExpandPathName(file);
+  return std::string(Form("%s#%s", file.Data(), containerName));
+}
+
+//______________________________________________________________________________
+AliOADBContainer* AliOADBContainerCache::GetContainer(const char* fileName, const char* containerName)
+{
+  // Container with this name in this file, read from file the first time only.
+  // The container is owned by the cache and kept for the next runs,
+  // it must not be modified or deleted by the caller.
+  std::string key = Key(fileName, containerName);
+  std::map<std::string, AliOADBContainer*>::iterator it = fContainers.find(key);
+  if (it != fContainers.end()) return it->second;
+
+  AliInfo(Form("Read container %s from %s", containerName, fileName));
+  AliOADBContainer* cont = new AliOADBContainer("OADB");
+  if (cont->InitFromFile(fileName, containerName))
+    AliError(Form("Container %s not read from %s", containerName, fileName));
+  fNFileOpens++;
+
+  fContainers[key] = cont;
+  return cont;
+}
+
+//______________________________________________________________________________
+void AliOADBContainerCache::Clear(Option_t* /*option*/)
+{
+  // Delete all the containers, the pointers given by GetContainer() become invalid
+  std::map<std::string, AliOADBContainer*>::iterator it;
+  for (it = fContainers.begin(); it != fContainers.end(); ++it) delete it->second;
+  fContainers.clear();
+}
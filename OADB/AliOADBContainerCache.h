@@ -0,0 +1,50 @@
+#ifndef ALIOADBCONTAINERCACHE_H
+#define ALIOADBCONTAINERCACHE_H
+/* Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//-------------------------------------------------------------------------
+//     Process wide cache of OADB containers.
+//     Each (file, container name) pair is read once per process and
+//     shared by all tasks asking for it, instead of one
+//     AliOADBContainer::InitFromFile per task and per run.
+//     The shared containers and the objects they hold are read only:
+//     clone an object before modifying it or handing its ownership.
+//-------------------------------------------------------------------------
+
+#include <map>
+#include <string>
+#include <TObject.h>
+
+class AliOADBContainer;
+
+class AliOADBContainerCache : public TObject {
+
+ public :
+  static AliOADBContainerCache* Instance();
+  virtual ~AliOADBContainerCache();
+
+  AliOADBContainer* GetContainer(const char* fileName, const char* containerName);
+  void              Clear(Option_t* option="");
+
+  Int_t             GetNContainers() const {return fContainers.size();}
+  Int_t             GetNFileOpens()  const {return fNFileOpens;}
+
+ private:
+  AliOADBContainerCache();
+  AliOADBContainerCache(const AliOADBContainerCache& cont); // not implemented
+  AliOADBContainerCache& operator=(const AliOADBContainerCache& cont); // not implemented
+
+  std::string Key(const char* fileName, const char* containerName) const;
+
+  std::map<std::string, AliOADBContainer*> fContainers; //! containers per expanded file name and container name
+  Int_t                                    fNFileOpens; //! number of containers read from file
+
+  static AliOADBContainerCache* fgInstance; //! the cache of this process
+
+  ClassDef(AliOADBContainerCache, 0);
+};
+
+#endif
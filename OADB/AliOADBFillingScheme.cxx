@@ -15,12 +15,12 @@ using namespace std;
 ClassImp(AliOADBFillingScheme)
 
 
-AliOADBFillingScheme::AliOADBFillingScheme() : TNamed("AliOADBFillingScheme", "OADB object storing filling scheme infos"), fFSName(""), fBXIds(0){
+AliOADBFillingScheme::AliOADBFillingScheme() : TNamed("AliOADBFillingScheme", "OADB object storing filling scheme infos"), fFSName(""), fBXIds(0), fBunchClass(){
   // default ctor
 
   
 }
-AliOADBFillingScheme::AliOADBFillingScheme(char* name) : TNamed(name, "OADB object storing filling scheme infos"), fFSName(""), fBXIds(0){
+AliOADBFillingScheme::AliOADBFillingScheme(char* name) : TNamed(name, "OADB object storing filling scheme infos"), fFSName(""), fBXIds(0), fBunchClass(){
   // ctor
   Init();
 }
@@ -79,6 +79,35 @@ const char *  AliOADBFillingScheme::GetBXIDs(const char * beamSide) const
   
 }
 
+UChar_t AliOADBFillingScheme::GetBunchClass(Int_t bc) const
+{
+  // Returns the beam sides (EBeamSide bits) of the bunch crossing number bc, 0 if it is in none.
+  // The bunch crossing ids are parsed into a table of all the bunch crossings at the first call,
+  // such that the classification of an event is a single lookup
+
+  if (bc < 0 || bc >= kNBunchCrossings) return 0;
+
+  if (!fBunchClass.GetSize()) {
+    fBunchClass.Set(kNBunchCrossings);
+    const char * sides[4] = { "B", "A", "C", "E" };
+    const UChar_t bits[4] = { kBeamB, kBeamA, kBeamC, kBeamE };
+    for (Int_t iside = 0; fBXIds && iside < 4; iside++) {
+      TObjString * value = (TObjString*) fBXIds->GetValue(sides[iside]);
+      if (!value) continue;
+      TObjArray * tokens = value->String().Tokenize(" ");
+      for (Int_t itok = 0; itok < tokens->GetEntries(); itok++) {
+        TString bxNum(((TObjString*) tokens->At(itok))->String());
+        if (bxNum[0] == '#') bxNum.Remove(0, 1);
+        if (!bxNum.IsDigit()) continue;
+        Int_t ibc = bxNum.Atoi();
+        if (ibc >= 0 && ibc < kNBunchCrossings) fBunchClass[ibc] |= bits[iside];
+      }
+      delete tokens;
+    }
+  }
+  return fBunchClass[bc];
+}
+
 void AliOADBFillingScheme::Browse(TBrowser *b)
 {
    // Browse this object.
@@ -13,11 +13,15 @@
 #include <TNamed.h>
 #include "TMap.h"
 #include "TObjString.h"
+#include "TArrayC.h"
 
 
 class AliOADBFillingScheme : public TNamed {
 
  public :
+  enum { kNBunchCrossings = 3564 }; // bunch crossing numbers of an LHC orbit
+  enum EBeamSide { kBeamB = BIT(0), kBeamA = BIT(1), kBeamC = BIT(2), kBeamE = BIT(3) }; // bits of GetBunchClass()
+
   AliOADBFillingScheme();
   AliOADBFillingScheme(char* name);
   virtual ~AliOADBFillingScheme();
@@ -26,8 +30,9 @@ class AliOADBFillingScheme : public TNamed {
   // Getters
   const char * GetBXIDs(const char * beamSide) const; 
   const char * GetFillingSchemeName() const { return fFSName; } 
+  UChar_t GetBunchClass(Int_t bc) const;
   // Setters
-  void SetBXIDs(const char * beamSide, const char * bxids) { fBXIds->Add(new TObjString(beamSide), new TObjString(bxids)); }
+  void SetBXIDs(const char * beamSide, const char * bxids) { fBXIds->Add(new TObjString(beamSide), new TObjString(bxids)); fBunchClass.Set(0); }
   void SetFillingSchemeName(const char * name) { fFSName = name; }
   // Browse
   virtual Bool_t	IsFolder() const { return kTRUE; }
@@ -42,8 +47,9 @@ class AliOADBFillingScheme : public TNamed {
   
   TString fFSName               ; // Name of the filling scheme 
   TMap * fBXIds              ; // Map from the beam side bunch crossing number. Beam side is "B", "A", "C", "E".
+  mutable TArrayC fBunchClass; //! EBeamSide bits of each bunch crossing number, filled from fBXIds at the first GetBunchClass()
 
-  ClassDef(AliOADBFillingScheme, 1);
+  ClassDef(AliOADBFillingScheme, 2);
 };
 
 #endif
@@ -0,0 +1,127 @@
+/**************************************************************************
+ * Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+//-------------------------------------------------------------------------
+//     Process wide per event cache of the AliPIDResponse n-sigmas
+//-------------------------------------------------------------------------
+
+#include "AliAnalysisManager.h"
+#include "AliInputEventHandler.h"
+#include "AliVEvent.h"
+#include "AliVParticle.h"
+#include "AliPIDResponseCache.h"
+
+ClassImp(AliPIDResponseCache);
+
+AliPIDResponseCache* AliPIDResponseCache::fgInstance = 0;
+
+//______________________________________________________________________________
+AliPIDResponseCache::AliPIDResponseCache() :
+  TObject(),
+  fPIDResponse(0),
+  fEvent(0),
+  fEntry(-1),
+  fIndex(),
+  fTracks(),
+  fNTracks(0),
+  fNRequests(0),
+  fNEvaluated(0)
+{
+  // Private constructor, use Instance()
+}
+
+//______________________________________________________________________________
+AliPIDResponseCache::~AliPIDResponseCache()
+{
+  // Destructor
+  if (fgInstance == this) fgInstance = 0;
+}
+
+//______________________________________________________________________________
+AliPIDResponseCache* AliPIDResponseCache::Instance()
+{
+  // The cache of this process
+  if (!fgInstance) fgInstance = new AliPIDResponseCache();
+  return fgInstance;
+}
+
+//______________________________________________________________________________
+void AliPIDResponseCache::Clear(Option_t* /*option*/)
+{
+  // Forget the values of the current event, the storage is kept
+  fIndex.clear();
+  fNTracks = 0;
+  fPIDResponse = 0;
+  fEvent = 0;
+  fEntry = -1;
+}
+
+//______________________________________________________________________________
+Bool_t AliPIDResponseCache::CheckEvent(const AliPIDResponse* pid)
+{
+  // Bind the cache to the current event, emptying it on a new event.
+  // Outside of an analysis manager event loop nothing is cached.
+  AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+  const Long64_t entry = (mgr) ? mgr->GetCurrentEntry() : -1;
+  if (entry < 0) return kFALSE;
+  const AliVEvent* ev = (mgr->GetInputEventHandler()) ? mgr->GetInputEventHandler()->GetEvent() : 0;
+  if (entry != fEntry || ev != fEvent || pid != fPIDResponse) {
+    Clear();
+    fPIDResponse = pid;
+    fEvent = ev;
+    fEntry = entry;
+  }
+  return kTRUE;
+}
+
+//______________________________________________________________________________
+Float_t AliPIDResponseCache::NumberOfSigmas(const AliPIDResponse* pid, AliPIDResponse::EDetector det,
+                                            const AliVParticle* track, AliPID::EParticleType type)
+{
+  // Same value as pid->NumberOfSigmas(det, track, type), evaluated once per event
+  fNRequests++;
+  Int_t iDet = -1;
+  switch (det) {
+    case AliPIDResponse::kITS: iDet = kCachedITS; break;
+    case AliPIDResponse::kTPC: iDet = kCachedTPC; break;
+    case AliPIDResponse::kTOF: iDet = kCachedTOF; break;
+    default: break;
+  }
+  if (iDet < 0 || type < 0 || type >= AliPID::kSPECIESC || !CheckEvent(pid)) {
+    fNEvaluated++;
+    return pid->NumberOfSigmas(det, track, type);
+  }
+
+  std::map<const AliVParticle*, Int_t>::iterator it = fIndex.find(track);
+  Int_t index = 0;
+  if (it == fIndex.end()) {
+    index = fNTracks++;
+    if (index >= (Int_t)fTracks.size()) fTracks.resize(index + 1);
+    for (Int_t i = 0; i < kNCached; i++) fTracks[index].fDone[i] = 0;
+    fIndex[track] = index;
+  }
+  else index = it->second;
+
+  TrackEntry& entry = fTracks[index];
+  const UShort_t bit = 1 << type;
+  if (!(entry.fDone[iDet] & bit)) {
+    fNEvaluated++;
+    entry.fNSigma[iDet][type] = pid->NumberOfSigmas(det, track, type);
+    entry.fDone[iDet] |= bit;
+  }
+  return entry.fNSigma[iDet][type];
+}
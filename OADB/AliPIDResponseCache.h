@@ -0,0 +1,75 @@
+#ifndef ALIPIDRESPONSECACHE_H
+#define ALIPIDRESPONSECACHE_H
+/* Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//-------------------------------------------------------------------------
+//     Process wide per event cache of the ITS, TPC and TOF n-sigmas of
+//     AliPIDResponse, shared by all the PID helpers of the train.
+//     Each (track, detector, species) is evaluated once per event, the
+//     next requests of any wagon return the stored value.
+//     The cache is bound to the input event and the entry of the
+//     analysis manager, it is emptied when either changes.
+//-------------------------------------------------------------------------
+
+#include <map>
+#include <vector>
+#include <TObject.h>
+#include "AliPID.h"
+#include "AliPIDResponse.h"
+
+class AliVEvent;
+class AliVParticle;
+
+class AliPIDResponseCache : public TObject {
+
+ public :
+  static AliPIDResponseCache* Instance();
+  virtual ~AliPIDResponseCache();
+
+  Float_t NumberOfSigmas(const AliPIDResponse* pid, AliPIDResponse::EDetector det,
+                         const AliVParticle* track, AliPID::EParticleType type);
+  Float_t NumberOfSigmasITS(const AliPIDResponse* pid, const AliVParticle* track, AliPID::EParticleType type)
+    {return NumberOfSigmas(pid, AliPIDResponse::kITS, track, type);}
+  Float_t NumberOfSigmasTPC(const AliPIDResponse* pid, const AliVParticle* track, AliPID::EParticleType type)
+    {return NumberOfSigmas(pid, AliPIDResponse::kTPC, track, type);}
+  Float_t NumberOfSigmasTOF(const AliPIDResponse* pid, const AliVParticle* track, AliPID::EParticleType type)
+    {return NumberOfSigmas(pid, AliPIDResponse::kTOF, track, type);}
+
+  virtual void Clear(Option_t* option="");
+
+  Long64_t GetNRequests()   const {return fNRequests;}
+  Long64_t GetNEvaluated()  const {return fNEvaluated;}
+
+ private:
+  enum { kCachedITS = 0, kCachedTPC, kCachedTOF, kNCached };
+
+  // n-sigmas of one track, fDone has one bit per species and detector
+  struct TrackEntry {
+    Float_t  fNSigma[kNCached][AliPID::kSPECIESC];
+    UShort_t fDone[kNCached];
+  };
+
+  AliPIDResponseCache();
+  AliPIDResponseCache(const AliPIDResponseCache& cache); // not implemented
+  AliPIDResponseCache& operator=(const AliPIDResponseCache& cache); // not implemented
+
+  Bool_t  CheckEvent(const AliPIDResponse* pid);
+
+  const AliPIDResponse*                 fPIDResponse; //! response the cached values come from
+  const AliVEvent*                      fEvent;       //! input event of the cached values
+  Long64_t                              fEntry;       //! analysis manager entry of the cached values
+  std::map<const AliVParticle*, Int_t>  fIndex;       //! entry of each track in fTracks
+  std::vector<TrackEntry>               fTracks;      //! cached values, reused from event to event
+  Int_t                                 fNTracks;     //! tracks of the current event in fTracks
+  Long64_t                              fNRequests;   //! number of n-sigma requests
+  Long64_t                              fNEvaluated;  //! number of n-sigmas evaluated by AliPIDResponse
+
+  static AliPIDResponseCache* fgInstance; //! the cache of this process
+
+  ClassDef(AliPIDResponseCache, 0);
+};
+
+#endif
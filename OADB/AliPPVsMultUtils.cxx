@@ -45,9 +45,24 @@ AliPPVsMultUtils::AliPPVsMultUtils():TObject(),
     fBoundaryHisto_V0Cpartial(0),
     fBoundaryHisto_V0S(0),
     fBoundaryHisto_V0SB(0),
-    fAverageAmplitudes(0)
+    fAverageAmplitudes(0),
+    fEventCached(kFALSE),
+    fCachedEvent(0),
+    fCachedPeriod(0),
+    fCachedOrbit(0),
+    fCachedBunchCross(0),
+    fCachedNTracks(0),
+    fCachedMultV0A(0),
+    fCachedMultV0C(0),
+    fSelectionCode(1)
 {
     // Default contructor
+    for( Int_t i = 0; i < 4; i++ ) fAverageAmplitude[i] = 0;
+    for( Int_t i = 0; i < kNEstimators; i++ ) {
+        fEstimator[i] = 0;
+        fPercentile[i] = 0;
+        fPercentileCached[i] = kFALSE;
+    }
 }
 
 
@@ -66,11 +81,26 @@ AliPPVsMultUtils::AliPPVsMultUtils(const AliPPVsMultUtils &c) : TObject(c),
     fBoundaryHisto_V0Cpartial(0),
     fBoundaryHisto_V0S(0),
     fBoundaryHisto_V0SB(0),
-    fAverageAmplitudes(0)
+    fAverageAmplitudes(0),
+    fEventCached(kFALSE),
+    fCachedEvent(0),
+    fCachedPeriod(0),
+    fCachedOrbit(0),
+    fCachedBunchCross(0),
+    fCachedNTracks(0),
+    fCachedMultV0A(0),
+    fCachedMultV0C(0),
+    fSelectionCode(1)
 {
     //
     // copy constructor - untested
     //
+    for( Int_t i = 0; i < 4; i++ ) fAverageAmplitude[i] = 0;
+    for( Int_t i = 0; i < kNEstimators; i++ ) {
+        fEstimator[i] = 0;
+        fPercentile[i] = 0;
+        fPercentileCached[i] = kFALSE;
+    }
     ((AliPPVsMultUtils &) c).Copy(*this);
 }
 
@@ -140,8 +170,6 @@ Float_t AliPPVsMultUtils::GetMultiplicityPercentile(AliVEvent *event, TString lM
         return -1000; //Return absurd value (hopefully noone will use this...)
     }
 
-    Float_t lreturnval = -1;
-
     //Get VZERO Information for multiplicity later
     AliVVZERO* esdV0 = event->GetVZEROData();
     if (!esdV0) {
@@ -149,44 +177,74 @@ Float_t AliPPVsMultUtils::GetMultiplicityPercentile(AliVEvent *event, TString lM
         return -1;
     }
 
+    //Everything is evaluated once per event: further calls for other
+    //estimators (or with/without event selection) only read the cache
+    if( !IsCachedEvent( event, esdV0->GetMTotV0A(), esdV0->GetMTotV0C() ) ) CacheEstimators( event, esdV0 );
+
+    Float_t lreturnval = -1;
+    Int_t lEstimator = GetEstimatorIndex( lMethod );
+    if ( lEstimator >= 0 ) lreturnval = GetCachedPercentile( lEstimator );
+
+    if ( lEmbedEventSelection ) {
+        if ( fSelectionCode == 1 ) {
+            //Same order as the checks used to be applied: last failure wins
+            fSelectionCode = 0;
+            if(IsSelectedTrigger                        ( event ) == kFALSE ) fSelectionCode = -200;
+            if(IsINELgtZERO                         ( event ) == kFALSE ) fSelectionCode = -201;
+            if(IsAcceptedVertexPosition             ( event ) == kFALSE ) fSelectionCode = -202;
+            if(IsNotPileupSPDInMultBins             ( event ) == kFALSE ) fSelectionCode = -203;
+            if(HasNoInconsistentSPDandTrackVertices ( event ) == kFALSE ) fSelectionCode = -204;
+        }
+        if ( fSelectionCode != 0 ) lreturnval = fSelectionCode;
+    }
+
+    return lreturnval;
+}
+
+//______________________________________________________________________
+Int_t AliPPVsMultUtils::GetEstimatorIndex(const TString &lMethod)
+// Position of estimator lMethod in the percentile cache, -1 if unknown
+{
+    static const char *lNames[kNEstimators] = {
+        "V0M", "V0A", "V0C", "V0MEq", "V0AEq", "V0CEq", "V0B", "V0Apartial", "V0Cpartial", "V0S", "V0SB"
+    };
+    for( Int_t i = 0; i < kNEstimators; i++ ) if ( lMethod == lNames[i] ) return i;
+    return -1;
+}
+
+//______________________________________________________________________
+Bool_t AliPPVsMultUtils::IsCachedEvent(AliVEvent *event, Float_t multV0A, Float_t multV0C) const
+// The event object is reused by the input handler: compare the trigger
+// identifiers and a few cheap quantities to recognize the cached event
+{
+    return fEventCached &&
+           event == fCachedEvent &&
+           event->GetPeriodNumber() == fCachedPeriod &&
+           event->GetOrbitNumber() == fCachedOrbit &&
+           event->GetBunchCrossNumber() == fCachedBunchCross &&
+           event->GetNumberOfTracks() == fCachedNTracks &&
+           multV0A == fCachedMultV0A &&
+           multV0C == fCachedMultV0C;
+}
+
+//______________________________________________________________________
+void AliPPVsMultUtils::CacheEstimators(AliVEvent *event, AliVVZERO *esdV0)
+// Compute the values of all the estimators of this event, the
+// percentiles and the event selection are evaluated on demand
+{
     // VZERO PART
     Float_t  multV0A  = 0;            //  multiplicity from V0 reco side A
     Float_t  multV0C  = 0;            //  multiplicity from V0 reco side C
     Float_t  multV0AEq  = 0;          //  multiplicity from V0 reco side A
     Float_t  multV0CEq  = 0;          //  multiplicity from V0 reco side C
-    Float_t  multV0ACorr  = 0;            //  multiplicity from V0 reco side A
-    Float_t  multV0CCorr  = 0;            //  multiplicity from V0 reco side C
     Float_t multV0Apartial = 0;
     Float_t multV0Cpartial = 0;
 
-
     //Non-Equalized Signal: copy of multV0ACorr and multV0CCorr from AliCentralitySelectionTask
     //Getters for uncorrected multiplicity
     multV0A=esdV0->GetMTotV0A();
     multV0C=esdV0->GetMTotV0C();
 
-    //Getting around to the SPD vertex -> typecast to ESD/AOD
-    const AliVVertex *lPrimarySPDVtx = NULL;
-    /* get ESD vertex SPD */
-    if (event->InheritsFrom("AliESDEvent")) {
-        AliESDEvent *esdevent = dynamic_cast<AliESDEvent *>(event);
-        if (!esdevent) return kFALSE;
-        lPrimarySPDVtx = esdevent->GetPrimaryVertexSPD();
-    }
-    /* get AOD vertex SPD */
-    else if (event->InheritsFrom("AliAODEvent")) {
-        AliAODEvent *aodevent = dynamic_cast<AliAODEvent *>(event);
-        if (!aodevent) return kFALSE;
-        lPrimarySPDVtx = aodevent->GetPrimaryVertexSPD();
-    }
-
-    //Get Z vertex position of SPD vertex (why not Tracking if available?)
-    Float_t zvtx = lPrimarySPDVtx->GetZ();
-
-    //Acquire Corrected multV0A
-    multV0ACorr = AliESDUtils::GetCorrV0A(multV0A,zvtx);
-    multV0CCorr = AliESDUtils::GetCorrV0C(multV0C,zvtx);
-
     // Equalized signals // From AliCentralitySelectionTask // Updated
     for(Int_t iCh = 32; iCh < 64; ++iCh) {
         Double_t mult = event->GetVZEROEqMultiplicity(iCh);
@@ -206,46 +264,58 @@ Float_t AliPPVsMultUtils::GetMultiplicityPercentile(AliVEvent *event, TString lM
         multV0Cpartial += mult;
     }
 
-    if ( lMethod == "V0M" ) lreturnval =
-            fBoundaryHisto_V0M -> GetBinContent( fBoundaryHisto_V0M->FindBin(multV0A+multV0C) );
-    if ( lMethod == "V0A" ) lreturnval =
-            fBoundaryHisto_V0A -> GetBinContent( fBoundaryHisto_V0A->FindBin(multV0A) );
-    if ( lMethod == "V0C" ) lreturnval =
-            fBoundaryHisto_V0C -> GetBinContent( fBoundaryHisto_V0C->FindBin(multV0C) );
+    fEstimator[kV0M] = multV0A+multV0C;
+    fEstimator[kV0A] = multV0A;
+    fEstimator[kV0C] = multV0C;
     //equalized
-    if ( lMethod == "V0MEq" ) lreturnval =
-            fBoundaryHisto_V0MEq -> GetBinContent( fBoundaryHisto_V0MEq->FindBin(multV0AEq+multV0CEq) );
-    if ( lMethod == "V0AEq" ) lreturnval =
-            fBoundaryHisto_V0AEq -> GetBinContent( fBoundaryHisto_V0AEq->FindBin(multV0AEq) );
-    if ( lMethod == "V0CEq" ) lreturnval =
-            fBoundaryHisto_V0CEq -> GetBinContent( fBoundaryHisto_V0CEq->FindBin(multV0CEq) );
+    fEstimator[kV0MEq] = multV0AEq+multV0CEq;
+    fEstimator[kV0AEq] = multV0AEq;
+    fEstimator[kV0CEq] = multV0CEq;
     //extra stuff
-    if ( lMethod == "V0B" ) lreturnval =
-            fBoundaryHisto_V0B -> GetBinContent( fBoundaryHisto_V0B->FindBin( MinVal( multV0A / fAverageAmplitudes->GetBinContent(1) , multV0C / fAverageAmplitudes->GetBinContent(2) ) ) );
-    if ( lMethod == "V0Apartial" ) lreturnval =
-            fBoundaryHisto_V0Apartial -> GetBinContent( fBoundaryHisto_V0Apartial->FindBin( multV0Apartial ) );
-    if ( lMethod == "V0Cpartial" ) lreturnval =
-            fBoundaryHisto_V0Cpartial -> GetBinContent( fBoundaryHisto_V0Cpartial->FindBin( multV0Cpartial ) );
-    if ( lMethod == "V0S" ) lreturnval =
-            fBoundaryHisto_V0S -> GetBinContent( fBoundaryHisto_V0S->FindBin( (multV0Apartial/fAverageAmplitudes->GetBinContent(3)) + (multV0Cpartial/fAverageAmplitudes->GetBinContent(4)) ) );
-    if ( lMethod == "V0SB" ) lreturnval =
-            fBoundaryHisto_V0SB -> GetBinContent( fBoundaryHisto_V0SB->FindBin( MinVal( multV0Apartial / fAverageAmplitudes->GetBinContent(3) , multV0Cpartial / fAverageAmplitudes->GetBinContent(4) ) ) );
-
-    if ( lEmbedEventSelection ) {
-        if(IsSelectedTrigger                        ( event ) == kFALSE ) lreturnval = -200;
-        if(IsINELgtZERO                         ( event ) == kFALSE ) lreturnval = -201;
-        if(IsAcceptedVertexPosition             ( event ) == kFALSE ) lreturnval = -202;
-        if(IsNotPileupSPDInMultBins             ( event ) == kFALSE ) lreturnval = -203;
-        if(HasNoInconsistentSPDandTrackVertices ( event ) == kFALSE ) lreturnval = -204;
-    }
+    fEstimator[kV0B] = MinVal( multV0A / fAverageAmplitude[0] , multV0C / fAverageAmplitude[1] );
+    fEstimator[kV0Apartial] = multV0Apartial;
+    fEstimator[kV0Cpartial] = multV0Cpartial;
+    fEstimator[kV0S] = (multV0Apartial/fAverageAmplitude[2]) + (multV0Cpartial/fAverageAmplitude[3]);
+    fEstimator[kV0SB] = MinVal( multV0Apartial / fAverageAmplitude[2] , multV0Cpartial / fAverageAmplitude[3] );
+
+    for( Int_t i = 0; i < kNEstimators; i++ ) fPercentileCached[i] = kFALSE;
+    fSelectionCode = 1;
+
+    fCachedEvent = event;
+    fCachedPeriod = event->GetPeriodNumber();
+    fCachedOrbit = event->GetOrbitNumber();
+    fCachedBunchCross = event->GetBunchCrossNumber();
+    fCachedNTracks = event->GetNumberOfTracks();
+    fCachedMultV0A = multV0A;
+    fCachedMultV0C = multV0C;
+    fEventCached = kTRUE;
+}
 
-    return lreturnval;
+//______________________________________________________________________
+Float_t AliPPVsMultUtils::GetCachedPercentile(Int_t lEstimator)
+// Percentile of estimator lEstimator for the cached event
+{
+    if ( !fPercentileCached[lEstimator] ) {
+        TH1F *lBoundaries[kNEstimators] = {
+            fBoundaryHisto_V0M, fBoundaryHisto_V0A, fBoundaryHisto_V0C,
+            fBoundaryHisto_V0MEq, fBoundaryHisto_V0AEq, fBoundaryHisto_V0CEq,
+            fBoundaryHisto_V0B, fBoundaryHisto_V0Apartial, fBoundaryHisto_V0Cpartial,
+            fBoundaryHisto_V0S, fBoundaryHisto_V0SB
+        };
+        TH1F *lHisto = lBoundaries[lEstimator];
+        fPercentile[lEstimator] = lHisto->GetBinContent( lHisto->FindBin( fEstimator[lEstimator] ) );
+        fPercentileCached[lEstimator] = kTRUE;
+    }
+    return fPercentile[lEstimator];
 }
 
 //______________________________________________________________________
 Bool_t AliPPVsMultUtils::LoadCalibration(Int_t lLoadThisCalibration)
 //To be called if starting analysis on a new run
 {
+    //New calibration: the cached event values are not valid anymore
+    fEventCached = kFALSE;
+
     //If Histograms exist, de-allocate to prevent memory leakage
     if( fBoundaryHisto_V0M ) {
         fBoundaryHisto_V0M->Delete();
@@ -497,6 +567,9 @@ Bool_t AliPPVsMultUtils::LoadCalibration(Int_t lLoadThisCalibration)
         delete lCalibFile_Averages;
     }
 
+    //Averages used by the V0B, V0S and V0SB estimators
+    for( Int_t i = 0; i < 4; i++ ) fAverageAmplitude[i] = fAverageAmplitudes->GetBinContent(i+1);
+
     fRunNumber = lLoadThisCalibration; //Loaded!
     AliInfo(Form("Finished loading calibration for run %i",lLoadThisCalibration));
     return kTRUE;
@@ -8,6 +8,7 @@ class AliVEvent;
 class AliVVertex;
 class AliESDEvent;
 class AliAODEvent;
+class AliVVZERO;
 
 class AliPPVsMultUtils : public TObject {
 
@@ -45,6 +46,15 @@ public:
 
 private:
 
+    //Estimators, in the order of the percentile cache
+    enum { kV0M = 0, kV0A, kV0C, kV0MEq, kV0AEq, kV0CEq, kV0B, kV0Apartial, kV0Cpartial, kV0S, kV0SB, kNEstimators };
+    static Int_t GetEstimatorIndex( const TString &lMethod );
+
+    //Per-event cache
+    Bool_t IsCachedEvent( AliVEvent *event, Float_t multV0A, Float_t multV0C ) const;
+    void CacheEstimators( AliVEvent *event, AliVVZERO *esdV0 );
+    Float_t GetCachedPercentile( Int_t lEstimator );
+
     Int_t fRunNumber; // for control of run changes
     Bool_t fCalibrationLoaded; // control flag
 
@@ -63,6 +73,23 @@ private:
 
     //To Store <V0A>, <V0C>, <V0Apartial> and <V0Cpartial> on a run-per-run basis
     TH1D *fAverageAmplitudes; 
+
+    //Per-event cache of the estimators and of their percentiles, so that
+    //several calls for the same event (different estimators, with or
+    //without event selection) only read the boundary histograms
+    Float_t fAverageAmplitude[4];                //! content of fAverageAmplitudes bins 1-4 for the current run
+    Bool_t fEventCached;                         //! cache below filled
+    AliVEvent *fCachedEvent;                     //! event of the cache
+    UInt_t fCachedPeriod;                        //! period number of the cached event
+    UInt_t fCachedOrbit;                         //! orbit number of the cached event
+    UShort_t fCachedBunchCross;                  //! bunch crossing number of the cached event
+    Int_t fCachedNTracks;                        //! number of tracks of the cached event
+    Float_t fCachedMultV0A;                      //! total V0A amplitude of the cached event
+    Float_t fCachedMultV0C;                      //! total V0C amplitude of the cached event
+    Float_t fEstimator[kNEstimators];            //! estimator values of the cached event
+    Float_t fPercentile[kNEstimators];           //! percentiles of the cached event
+    Bool_t fPercentileCached[kNEstimators];      //! percentile already looked up
+    Int_t fSelectionCode;                        //! embedded event selection result (0: accepted, 1: not evaluated)
     
     ClassDef(AliPPVsMultUtils,3) // base helper class
 };
@@ -79,8 +79,10 @@
 
 #if ROOT_VERSION_CODE >= ROOT_VERSION(6,3,0)
 #include <v5/TFormula.h>
+typedef ROOT::v5::TFormula TriggerLogicFormula_t;
 #else
 #include <TFormula.h>
+typedef TFormula TriggerLogicFormula_t;
 #endif
 
 #include "AliPhysicsSelection.h"
@@ -128,10 +130,17 @@ fPSOADB(0),
 fFillOADB(0),
 fTriggerOADB(0),
 fRegexp(new TPRegexp("([[:alpha:]]\\w*)")),
-fCashedTokens(NULL)
+fCashedTokens(NULL),
+fCompiledClasses(),
+fTriggerClassNames(),
+fTriggerClassFired(),
+fLogicFormulas(),
+fLogicBits(),
+fTriggerDecisions()
 {
   // constructor
   fCollTrigClasses.SetOwner(1);
+  fLogicFormulas.SetOwner(1);
   fBGTrigClasses.SetOwner(1);
   fTriggerAnalysis.SetOwner(1);
   fHistList.SetOwner(1);
@@ -245,19 +254,7 @@ Bool_t AliPhysicsSelection::EvaluateTriggerLogic(const AliVEvent* event, AliTrig
     
     TString token(trigger(pos[0], pos[1]-pos[0]+1));
 
-    TParameter<Int_t>* param = dynamic_cast<TParameter<Int_t> *>(fCashedTokens->FindObject(token));
-    if (!param) {
-      TInterpreter::EErrorCode error;
-      Int_t bit = gInterpreter->ProcessLine(Form("AliTriggerAnalysis::k%s;", token.Data()), &error);
-      
-      if (error > 0) AliFatal(Form("Trigger token %s unknown", token.Data()));
-      
-      param = new TParameter<Int_t>(token, bit);
-      fCashedTokens->Add(param);
-      AliDebug(AliLog::kDebug, "Added token");
-    }
-    
-    Long64_t bit = param->GetVal();
+    Long64_t bit = GetTriggerTokenBit(token);
     
     AliDebug(AliLog::kDebug, Form("Tok %d %d %s %lld", pos[0], pos[1], token.Data(), bit));
     
@@ -285,6 +282,172 @@ Bool_t AliPhysicsSelection::EvaluateTriggerLogic(const AliVEvent* event, AliTrig
   return result;
 }
 
+//______________________________________________________________________________
+Int_t AliPhysicsSelection::GetTriggerTokenBit(const TString& token){
+  // AliTriggerAnalysis bit of a trigger logic token, looked up in the interpreter the first time only
+  TParameter<Int_t>* param = dynamic_cast<TParameter<Int_t> *>(fCashedTokens->FindObject(token));
+  if (!param) {
+    TInterpreter::EErrorCode error;
+    Int_t bit = gInterpreter->ProcessLine(Form("AliTriggerAnalysis::k%s;", token.Data()), &error);
+    
+    if (error > 0) AliFatal(Form("Trigger token %s unknown", token.Data()));
+    
+    param = new TParameter<Int_t>(token, bit);
+    fCashedTokens->Add(param);
+    AliDebug(AliLog::kDebug, "Added token");
+  }
+  return param->GetVal();
+}
+
+//______________________________________________________________________________
+Int_t AliPhysicsSelection::GetTriggerClassNameIndex(const TString& name){
+  // index of the trigger class name in fTriggerClassNames, added if not there
+  for (UInt_t j=0; j<fTriggerClassNames.size(); j++) if (fTriggerClassNames[j] == name) return j;
+  fTriggerClassNames.push_back(name);
+  return fTriggerClassNames.size()-1;
+}
+
+//______________________________________________________________________________
+void AliPhysicsSelection::CompileTriggerClasses(){
+  // parses the strings of fCollTrigClasses and fBGTrigClasses once instead of at every event,
+  // see CheckTriggerClass() for the format, and drops the trigger logic formulas of the previous run
+  fCompiledClasses.clear();
+  fTriggerClassNames.clear();
+  
+  Int_t nColl = fCollTrigClasses.GetEntries();
+  Int_t nBG   = fBGTrigClasses.GetEntries();
+  for (Int_t i=0; i<nColl+nBG; i++) {
+    const char* trigger = i<nColl ? fCollTrigClasses.At(i)->GetName() : fBGTrigClasses.At(i-nColl)->GetName();
+    
+    CompiledTriggerClass trig;
+    trig.fReturnCode = AliVEvent::kUserDefined;
+    trig.fTriggerLogic = 0;
+    
+    TString str(trigger);
+    TObjArray* tokens = str.Tokenize(" ");
+    for (Int_t j=0; j < tokens->GetEntries(); j++) {
+      TString str2(((TObjString*) tokens->At(j))->String());
+      if (str2[0] == '+' || str2[0] == '-') {
+        Bool_t flag = (str2[0] == '+');
+        str2.Remove(0, 1);
+        TObjArray* tokens2 = str2.Tokenize(",");
+        std::vector<Int_t> group;
+        for (Int_t k=0; k < tokens2->GetEntries(); k++) {
+          Int_t index = GetTriggerClassNameIndex(((TObjString*) tokens2->At(k))->String());
+          if (flag) group.push_back(index);
+          else      trig.fRejected.push_back(index);
+        }
+        delete tokens2;
+        if (flag) trig.fRequired.push_back(group);
+      }
+      else if (str2[0] == '#') {
+        str2.Remove(0, 1);
+        Int_t bc = str2.Atoi();
+        if (trig.fBunchCrossings.empty()) trig.fBunchCrossings.assign(AliOADBFillingScheme::kNBunchCrossings, 0);
+        if (bc >= 0 && bc < AliOADBFillingScheme::kNBunchCrossings) trig.fBunchCrossings[bc] = 1;
+      }
+      else if (str2[0] == '&') { str2.Remove(0, 1); trig.fReturnCode = str2.Atoll();  }
+      else if (str2[0] == '*') { str2.Remove(0, 1); trig.fTriggerLogic = str2.Atoi(); }
+      else AliFatal(Form("Invalid trigger syntax: %s", trigger));
+    }
+    delete tokens;
+    
+    fCompiledClasses.push_back(trig);
+  }
+  
+  fTriggerClassFired.assign(fTriggerClassNames.size(), 0);
+  fLogicFormulas.Delete();
+  fLogicFormulas.Expand(2*(nColl+nBG));
+  fLogicBits.assign(2*(nColl+nBG), std::vector<Long64_t>());
+}
+
+//______________________________________________________________________________
+UInt_t AliPhysicsSelection::CheckCompiledTriggerClass(const AliVEvent* event, Int_t i, Int_t& triggerLogic) const {
+  // same as CheckTriggerClass() for the i-th parsed trigger class,
+  // fTriggerClassFired must be filled for the event
+  const CompiledTriggerClass& trig = fCompiledClasses[i];
+  triggerLogic = trig.fTriggerLogic;
+  
+  for (UInt_t j=0; j<trig.fRejected.size(); j++) {
+    if (fTriggerClassFired[trig.fRejected[j]]) {
+      AliDebug(AliLog::kDebug+1, Form("Rejecting event because trigger class %s is present", fTriggerClassNames[trig.fRejected[j]].Data()));
+      return kFALSE;
+    }
+  }
+  
+  for (UInt_t g=0; g<trig.fRequired.size(); g++) {
+    Bool_t foundTriggerClass = kFALSE;
+    for (UInt_t j=0; j<trig.fRequired[g].size() && !foundTriggerClass; j++) foundTriggerClass = fTriggerClassFired[trig.fRequired[g][j]];
+    if (!foundTriggerClass) return kFALSE;
+  }
+  
+  if (trig.fBunchCrossings.size()) {
+    Int_t bcNumber = event->GetBunchCrossNumber();
+    if (bcNumber < 0 || bcNumber >= (Int_t) trig.fBunchCrossings.size() || !trig.fBunchCrossings[bcNumber]) return kFALSE;
+  }
+  
+  return trig.fReturnCode;
+}
+
+//______________________________________________________________________________
+Bool_t AliPhysicsSelection::EvaluateCompiledTriggerLogic(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, Int_t iFormula, const char* triggerLogic, Bool_t offline){
+  // same as EvaluateTriggerLogic(), but the expression is compiled at the first call with one parameter
+  // per token, and in data the decisions of AliTriggerAnalysis are shared by all trigger classes of the event,
+  // all AliTriggerAnalysis objects being configured alike. In MC each class evaluates its own decisions,
+  // the SPD FO efficiency is applied with random numbers.
+  TriggerLogicFormula_t* formula = (TriggerLogicFormula_t*) fLogicFormulas.At(iFormula);
+  std::vector<Long64_t>& bits = fLogicBits[iFormula];
+  
+  if (!formula) {
+    TString trigger(triggerLogic);
+    
+    // add space after each token (to use ReplaceAll later)
+    fRegexp->Substitute(trigger, "$1 ", "g");
+    
+    while (1) {
+      TArrayI pos;
+      Int_t nMatches = fRegexp->Match(trigger, "", 0, 2, &pos);
+      
+      if (nMatches <= 0) break;
+      
+      TString token(trigger(pos[0], pos[1]-pos[0]+1));
+      
+      Long64_t bit = GetTriggerTokenBit(token);
+      if (offline) 
+        bit |= AliTriggerAnalysis::kOfflineFlag;
+      
+      trigger.ReplaceAll(token, Form("[%d]", (Int_t) bits.size()));
+      bits.push_back(bit);
+    }
+    
+    formula = new TriggerLogicFormula_t(Form("formula%d", iFormula), trigger);
+    if (formula->Compile() > 0)
+      AliFatal(Form("Could not evaluate trigger logic %s (evaluated to %s)", triggerLogic, trigger.Data()));
+    fLogicFormulas.AddAt(formula, iFormula);
+  }
+  
+  for (UInt_t k=0; k<bits.size(); k++) {
+    Int_t decision = 0;
+    if (fMC) decision = triggerAnalysis->EvaluateTrigger(event, (AliTriggerAnalysis::Trigger) bits[k]);
+    else {
+      std::map<Long64_t, Int_t>::iterator it = fTriggerDecisions.find(bits[k]);
+      if (it != fTriggerDecisions.end()) decision = it->second;
+      else {
+        decision = triggerAnalysis->EvaluateTrigger(event, (AliTriggerAnalysis::Trigger) bits[k]);
+        fTriggerDecisions[bits[k]] = decision;
+      }
+    }
+    formula->SetParameter(k, decision);
+  }
+  
+  Bool_t result = formula->Eval(0);
+  
+  AliDebug(AliLog::kDebug, Form("%s --> %d", triggerLogic, result));
+  
+  return result;
+}
+
+
 //______________________________________________________________________________
 UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
   // checks if the given event is a collision candidate
@@ -304,6 +467,13 @@ UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
   UInt_t accept = 0;
   Int_t nColl = fCollTrigClasses.GetEntries();
   Int_t nBG   = fBGTrigClasses.GetEntries();
+  if ((Int_t) fCompiledClasses.size() != nColl+nBG) CompileTriggerClasses();
+  
+  // fired classes and offline decisions are evaluated once for all trigger classes
+  TString classes = event->GetFiredTriggerClasses();
+  for (UInt_t j=0; j<fTriggerClassNames.size(); j++) fTriggerClassFired[j] = classes.Contains(fTriggerClassNames[j]);
+  fTriggerDecisions.clear();
+  
   for (Int_t i=0; i<nColl+nBG; i++) {
     const char* triggerClass = i<nColl ? fCollTrigClasses.At(i)->GetName() : fBGTrigClasses.At(i-nColl)->GetName();
     AliDebug(AliLog::kDebug+1, Form("Processing trigger class %s", triggerClass));
@@ -312,10 +482,10 @@ UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
     triggerAnalysis->FillTriggerClasses(event);
     
     Int_t triggerLogic = 0;
-    UInt_t singleTriggerResult = CheckTriggerClass(event, triggerClass, triggerLogic);
+    UInt_t singleTriggerResult = CheckCompiledTriggerClass(event, i, triggerLogic);
     if (!singleTriggerResult) continue;
-    Bool_t onlineDecision  = EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetHardwareTrigger(triggerLogic), kFALSE);
-    Bool_t offlineDecision = EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetOfflineTrigger(triggerLogic), kTRUE);
+    Bool_t onlineDecision  = EvaluateCompiledTriggerLogic(event, triggerAnalysis, 2*i,   fPSOADB->GetHardwareTrigger(triggerLogic), kFALSE);
+    Bool_t offlineDecision = EvaluateCompiledTriggerLogic(event, triggerAnalysis, 2*i+1, fPSOADB->GetOfflineTrigger(triggerLogic), kTRUE);
     triggerAnalysis->FillHistograms(event,onlineDecision,offlineDecision);
     if (!onlineDecision) continue;
     if (!offlineDecision) continue;
@@ -490,6 +660,9 @@ Bool_t AliPhysicsSelection::Initialize(Int_t runNumber){
     fCashedTokens->SetOwner();
   }
   
+  // the trigger logic of the classes can change with the OADB object of the run
+  CompileTriggerClasses();
+  
   fCurrentRun = runNumber;
 
   TH1::AddDirectory(oldStatus);
@@ -16,8 +16,11 @@
 //           Michele Floris, CERN
 //-------------------------------------------------------------------------
 
+#include <vector>
+#include <map>
 #include <AliAnalysisCuts.h>
 #include <TList.h>
+#include <TObjArray.h>
 #include "TObjString.h"
 #include "AliVEvent.h"
 #include "AliESDEvent.h"
@@ -87,6 +90,11 @@ public:
 protected:
   UInt_t CheckTriggerClass(const AliVEvent* event, const char* trigger, Int_t& triggerLogic) const;
   Bool_t EvaluateTriggerLogic(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, const char* triggerLogic, Bool_t offline);
+  Int_t  GetTriggerTokenBit(const TString& token);
+  void   CompileTriggerClasses();
+  Int_t  GetTriggerClassNameIndex(const TString& name);
+  UInt_t CheckCompiledTriggerClass(const AliVEvent* event, Int_t i, Int_t& triggerLogic) const;
+  Bool_t EvaluateCompiledTriggerLogic(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, Int_t iFormula, const char* triggerLogic, Bool_t offline);
   const char * GetTriggerString(TObjString * obj);
 
   TString fPassName;          // pass name for current run
@@ -110,7 +118,23 @@ protected:
   TPRegexp* fRegexp;        //! regular expression for trigger tokens
   TList* fCashedTokens;     //! trigger token lookup list
 
-  ClassDef(AliPhysicsSelection, 22)
+  // trigger class string parsed by CompileTriggerClasses(), see CheckTriggerClass() for the format
+  struct CompiledTriggerClass {
+    std::vector< std::vector<Int_t> > fRequired; // groups of indexes in fTriggerClassNames, one class of each group must be fired
+    std::vector<Int_t> fRejected;                // indexes in fTriggerClassNames of the classes that must not be fired
+    std::vector<Char_t> fBunchCrossings;         // 1 for the accepted bunch crossing numbers, one entry per bunch crossing of the orbit, any if empty
+    UInt_t fReturnCode;                          // offline trigger bits of the class
+    Int_t  fTriggerLogic;                        // trigger logic index in fPSOADB
+  };
+
+  std::vector<CompiledTriggerClass> fCompiledClasses;  //! fCollTrigClasses then fBGTrigClasses, parsed
+  std::vector<TString>  fTriggerClassNames;            //! distinct trigger class names of the definitions
+  std::vector<Char_t>   fTriggerClassFired;            //! fTriggerClassNames fired in the current event
+  TObjArray             fLogicFormulas;                //! online and offline trigger logic formula of each trigger class, compiled at first use
+  std::vector< std::vector<Long64_t> > fLogicBits;     //! AliTriggerAnalysis bit of each parameter of fLogicFormulas
+  std::map<Long64_t, Int_t> fTriggerDecisions;         //! AliTriggerAnalysis decisions of the current event, data only
+
+  ClassDef(AliPhysicsSelection, 23)
 private:
   AliPhysicsSelection(const AliPhysicsSelection&);
   AliPhysicsSelection& operator=(const AliPhysicsSelection&);
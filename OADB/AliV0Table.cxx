@@ -0,0 +1,262 @@
+/**************************************************************************
+ * Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+//-------------------------------------------------------------------------
+//     Process wide per event table of the V0s of the input event
+//-------------------------------------------------------------------------
+
+#include <algorithm>
+#include <TMath.h>
+#include "AliAnalysisManager.h"
+#include "AliESDEvent.h"
+#include "AliESDv0.h"
+#include "AliESDtrack.h"
+#include "AliESDVertex.h"
+#include "AliAODEvent.h"
+#include "AliAODv0.h"
+#include "AliAODTrack.h"
+#include "AliAODVertex.h"
+#include "AliPIDResponseCache.h"
+#include "AliV0Table.h"
+
+ClassImp(AliV0Table);
+
+AliV0Table* AliV0Table::fgInstance = 0;
+
+//______________________________________________________________________________
+AliV0Table::AliV0Table() :
+  TObject(),
+  fEvent(0),
+  fEntry(-1),
+  fNV0s(0),
+  fOnFly(),
+  fCosPA(),
+  fDcaDaughters(),
+  fRadius(),
+  fDecayLength(),
+  fAlpha(),
+  fQt(),
+  fPt(),
+  fEta(),
+  fMassK0s(),
+  fMassLambda(),
+  fMassAntiLambda()
+{
+  // Private constructor, use Instance()
+}
+
+//______________________________________________________________________________
+AliV0Table::~AliV0Table()
+{
+  // Destructor
+  if (fgInstance == this) fgInstance = 0;
+}
+
+//______________________________________________________________________________
+AliV0Table* AliV0Table::Instance()
+{
+  // The table of this process
+  if (!fgInstance) fgInstance = new AliV0Table();
+  return fgInstance;
+}
+
+//______________________________________________________________________________
+void AliV0Table::Clear(Option_t* /*option*/)
+{
+  // Empty the table, the storage is kept
+  fEvent = 0;
+  fEntry = -1;
+  fNV0s = 0;
+}
+
+//______________________________________________________________________________
+Bool_t AliV0Table::Update(const AliVEvent* ev)
+{
+  // Fill the table with the V0s of ev, unless it already holds them.
+  // Outside of an analysis manager event loop the table is refilled at each call.
+  if (!ev) {
+    Clear();
+    return kFALSE;
+  }
+  AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+  const Long64_t entry = (mgr) ? mgr->GetCurrentEntry() : -1;
+  if (entry >= 0 && entry == fEntry && ev == fEvent) return kTRUE;
+
+  Clear();
+  if (ev->IsA() == AliESDEvent::Class()) FillESD(static_cast<const AliESDEvent*>(ev));
+  else if (ev->IsA() == AliAODEvent::Class()) FillAOD(static_cast<const AliAODEvent*>(ev));
+  else return kFALSE;
+  fEvent = ev;
+  fEntry = entry;
+  return kTRUE;
+}
+
+//______________________________________________________________________________
+void AliV0Table::Resize(Int_t n)
+{
+  // Make room for n V0s
+  fNV0s = n;
+  if ((Int_t)fCosPA.size() >= n) return;
+  fOnFly.resize(n);
+  fDaughter[kPositive].resize(n);
+  fDaughter[kNegative].resize(n);
+  fCosPA.resize(n);
+  fDcaDaughters.resize(n);
+  fDcaToPV[kPositive].resize(n);
+  fDcaToPV[kNegative].resize(n);
+  fRadius.resize(n);
+  fDecayLength.resize(n);
+  fAlpha.resize(n);
+  fQt.resize(n);
+  fPt.resize(n);
+  fEta.resize(n);
+  fMassK0s.resize(n);
+  fMassLambda.resize(n);
+  fMassAntiLambda.resize(n);
+}
+
+//______________________________________________________________________________
+void AliV0Table::SetKinematics(Int_t i, const Double_t* pPos, const Double_t* pNeg)
+{
+  // V0 momentum, Armenteros variables and invariant masses from the daughter momenta
+  const Double_t p[3] = {pPos[0]+pNeg[0], pPos[1]+pNeg[1], pPos[2]+pNeg[2]};
+  const Double_t p2 = p[0]*p[0] + p[1]*p[1] + p[2]*p[2];
+  const Double_t pt = TMath::Sqrt(p[0]*p[0] + p[1]*p[1]);
+  fPt[i] = pt;
+  fEta[i] = (pt > 0.) ? TMath::ASinH(p[2]/pt) : 0.;
+
+  const Double_t p2Pos = pPos[0]*pPos[0] + pPos[1]*pPos[1] + pPos[2]*pPos[2];
+  const Double_t p2Neg = pNeg[0]*pNeg[0] + pNeg[1]*pNeg[1] + pNeg[2]*pNeg[2];
+  if (p2 > 0.) {
+    const Double_t pMod = TMath::Sqrt(p2);
+    const Double_t plPos = (pPos[0]*p[0] + pPos[1]*p[1] + pPos[2]*p[2])/pMod;
+    const Double_t plNeg = (pNeg[0]*p[0] + pNeg[1]*p[1] + pNeg[2]*p[2])/pMod;
+    fAlpha[i] = (plPos + plNeg != 0.) ? (plPos - plNeg)/(plPos + plNeg) : 0.;
+    fQt[i] = TMath::Sqrt(TMath::Max(p2Pos - plPos*plPos, 0.));
+  }
+  else {
+    fAlpha[i] = 0.;
+    fQt[i] = 0.;
+  }
+
+  const Double_t mPi = AliPID::ParticleMass(AliPID::kPion);
+  const Double_t mPr = AliPID::ParticleMass(AliPID::kProton);
+  const Double_t ePiPos = TMath::Sqrt(p2Pos + mPi*mPi), ePrPos = TMath::Sqrt(p2Pos + mPr*mPr);
+  const Double_t ePiNeg = TMath::Sqrt(p2Neg + mPi*mPi), ePrNeg = TMath::Sqrt(p2Neg + mPr*mPr);
+  fMassK0s[i]        = TMath::Sqrt(TMath::Max((ePiPos+ePiNeg)*(ePiPos+ePiNeg) - p2, 0.));
+  fMassLambda[i]     = TMath::Sqrt(TMath::Max((ePrPos+ePiNeg)*(ePrPos+ePiNeg) - p2, 0.));
+  fMassAntiLambda[i] = TMath::Sqrt(TMath::Max((ePiPos+ePrNeg)*(ePiPos+ePrNeg) - p2, 0.));
+}
+
+//______________________________________________________________________________
+void AliV0Table::FillESD(const AliESDEvent* esd)
+{
+  // Topological variables of the ESD V0s
+  const Int_t n = esd->GetNumberOfV0s();
+  Resize(n);
+  Double_t pv[3] = {0., 0., 0.};
+  if (esd->GetPrimaryVertex()) esd->GetPrimaryVertex()->GetXYZ(pv);
+  const Double_t b = esd->GetMagneticField();
+
+  for (Int_t i = 0; i < n; i++) {
+    AliESDv0* v0 = esd->GetV0(i);
+    AliESDtrack* pos = (v0) ? esd->GetTrack(v0->GetPindex()) : 0;
+    AliESDtrack* neg = (v0) ? esd->GetTrack(v0->GetNindex()) : 0;
+    if (!pos || !neg) {
+      fOnFly[i] = (v0) ? v0->GetOnFlyStatus() : kFALSE;
+      fDaughter[kPositive][i] = fDaughter[kNegative][i] = 0;
+      fCosPA[i] = (v0) ? v0->GetV0CosineOfPointingAngle() : -2.;
+      continue;
+    }
+    Double_t pPos[3], pNeg[3];
+    v0->GetPPxPyPz(pPos[0], pPos[1], pPos[2]);
+    v0->GetNPxPyPz(pNeg[0], pNeg[1], pNeg[2]);
+    if (pos->GetSign() < 0) {
+      std::swap(pos, neg);
+      for (Int_t k = 0; k < 3; k++) std::swap(pPos[k], pNeg[k]);
+    }
+    fOnFly[i] = v0->GetOnFlyStatus();
+    fDaughter[kPositive][i] = pos;
+    fDaughter[kNegative][i] = neg;
+    fCosPA[i] = v0->GetV0CosineOfPointingAngle();
+    fDcaDaughters[i] = v0->GetDcaV0Daughters();
+    fDcaToPV[kPositive][i] = TMath::Abs(pos->GetD(pv[0], pv[1], b));
+    fDcaToPV[kNegative][i] = TMath::Abs(neg->GetD(pv[0], pv[1], b));
+    Double_t x, y, z;
+    v0->GetXYZ(x, y, z);
+    fRadius[i] = TMath::Sqrt(x*x + y*y);
+    fDecayLength[i] = TMath::Sqrt((x-pv[0])*(x-pv[0]) + (y-pv[1])*(y-pv[1]) + (z-pv[2])*(z-pv[2]));
+    SetKinematics(i, pPos, pNeg);
+  }
+}
+
+//______________________________________________________________________________
+void AliV0Table::FillAOD(const AliAODEvent* aod)
+{
+  // Topological variables of the AOD V0s
+  const Int_t n = aod->GetNumberOfV0s();
+  Resize(n);
+  AliAODVertex* vertex = aod->GetPrimaryVertex();
+  Double_t pv[3] = {0., 0., 0.};
+  if (vertex) vertex->GetXYZ(pv);
+
+  for (Int_t i = 0; i < n; i++) {
+    AliAODv0* v0 = aod->GetV0(i);
+    AliAODTrack* pos = (v0) ? (AliAODTrack*)v0->GetDaughter(0) : 0;
+    AliAODTrack* neg = (v0) ? (AliAODTrack*)v0->GetDaughter(1) : 0;
+    if (!pos || !neg || !vertex) {
+      fOnFly[i] = (v0) ? v0->GetOnFlyStatus() : kFALSE;
+      fDaughter[kPositive][i] = fDaughter[kNegative][i] = 0;
+      fCosPA[i] = (v0 && vertex) ? v0->CosPointingAngle(vertex) : -2.;
+      continue;
+    }
+    Double_t pPos[3] = {v0->MomPosX(), v0->MomPosY(), v0->MomPosZ()};
+    Double_t pNeg[3] = {v0->MomNegX(), v0->MomNegY(), v0->MomNegZ()};
+    Double_t dcaPos = v0->DcaPosToPrimVertex(), dcaNeg = v0->DcaNegToPrimVertex();
+    if (pos->Charge() < 0) {
+      std::swap(pos, neg);
+      std::swap(dcaPos, dcaNeg);
+      for (Int_t k = 0; k < 3; k++) std::swap(pPos[k], pNeg[k]);
+    }
+    fOnFly[i] = v0->GetOnFlyStatus();
+    fDaughter[kPositive][i] = pos;
+    fDaughter[kNegative][i] = neg;
+    fCosPA[i] = v0->CosPointingAngle(vertex);
+    fDcaDaughters[i] = v0->DcaV0Daughters();
+    fDcaToPV[kPositive][i] = dcaPos;
+    fDcaToPV[kNegative][i] = dcaNeg;
+    fRadius[i] = v0->RadiusV0();
+    fDecayLength[i] = v0->DecayLengthV0(pv);
+    SetKinematics(i, pPos, pNeg);
+  }
+}
+
+//______________________________________________________________________________
+Float_t AliV0Table::GetNSigmaTPC(const AliPIDResponse* pid, Int_t i, EDaughter d, AliPID::EParticleType type) const
+{
+  // TPC n-sigma of a daughter, evaluated once per event for the whole train
+  if (!pid || !fDaughter[d][i]) return -999.;
+  return AliPIDResponseCache::Instance()->NumberOfSigmasTPC(pid, fDaughter[d][i], type);
+}
+
+//______________________________________________________________________________
+Float_t AliV0Table::GetNSigmaTOF(const AliPIDResponse* pid, Int_t i, EDaughter d, AliPID::EParticleType type) const
+{
+  // TOF n-sigma of a daughter, evaluated once per event for the whole train
+  if (!pid || !fDaughter[d][i]) return -999.;
+  return AliPIDResponseCache::Instance()->NumberOfSigmasTOF(pid, fDaughter[d][i], type);
+}
@@ -0,0 +1,97 @@
+#ifndef ALIV0TABLE_H
+#define ALIV0TABLE_H
+/* Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//-------------------------------------------------------------------------
+//     Process wide per event table of the V0s of the input event (ESD or
+//     AOD), filled once per event and shared by the strangeness wagons.
+//     V0 i of the table is V0 i of the event. The daughters are ordered
+//     by charge (positive, negative) and the topological variables are
+//     stored in one array per variable, so that a selection is a loop
+//     over plain arrays instead of a loop calling the V0 and track getters.
+//     The daughter n-sigmas come from AliPIDResponseCache.
+//-------------------------------------------------------------------------
+
+#include <vector>
+#include <TObject.h>
+#include "AliPID.h"
+
+class AliVEvent;
+class AliVTrack;
+class AliESDEvent;
+class AliAODEvent;
+class AliPIDResponse;
+
+class AliV0Table : public TObject {
+
+ public :
+  enum EDaughter { kPositive = 0, kNegative };
+
+  static AliV0Table* Instance();
+  virtual ~AliV0Table();
+
+  // Fill the table for the current event, a no-op if the event is already filled
+  Bool_t   Update(const AliVEvent* ev);
+  virtual void Clear(Option_t* option="");
+
+  Int_t    GetNV0s()                       const {return fNV0s;}
+  Bool_t   GetOnFlyStatus(Int_t i)         const {return fOnFly[i];}
+  Bool_t   HasDaughters(Int_t i)           const {return fDaughter[kPositive][i] && fDaughter[kNegative][i];}
+  AliVTrack* GetDaughter(Int_t i, EDaughter d) const {return fDaughter[d][i];}
+  Double_t GetCosPointingAngle(Int_t i)    const {return fCosPA[i];}
+  Float_t  GetDcaV0Daughters(Int_t i)      const {return fDcaDaughters[i];}
+  Float_t  GetDcaDaughterToPV(Int_t i, EDaughter d) const {return fDcaToPV[d][i];}
+  Float_t  GetRadius(Int_t i)              const {return fRadius[i];}
+  Float_t  GetDecayLength(Int_t i)         const {return fDecayLength[i];}
+  Float_t  GetAlpha(Int_t i)               const {return fAlpha[i];}
+  Float_t  GetQt(Int_t i)                  const {return fQt[i];}
+  Float_t  GetPt(Int_t i)                  const {return fPt[i];}
+  Float_t  GetEta(Int_t i)                 const {return fEta[i];}
+  Float_t  GetMassK0s(Int_t i)             const {return fMassK0s[i];}
+  Float_t  GetMassLambda(Int_t i)          const {return fMassLambda[i];}
+  Float_t  GetMassAntiLambda(Int_t i)      const {return fMassAntiLambda[i];}
+
+  Float_t  GetNSigmaTPC(const AliPIDResponse* pid, Int_t i, EDaughter d, AliPID::EParticleType type) const;
+  Float_t  GetNSigmaTOF(const AliPIDResponse* pid, Int_t i, EDaughter d, AliPID::EParticleType type) const;
+
+  const Double_t* GetCosPointingAngles()   const {return fNV0s ? &fCosPA[0] : 0;}
+  const Float_t* GetRadii()                const {return fNV0s ? &fRadius[0] : 0;}
+  const Float_t* GetDcasV0Daughters()      const {return fNV0s ? &fDcaDaughters[0] : 0;}
+
+ private:
+  AliV0Table();
+  AliV0Table(const AliV0Table& table); // not implemented
+  AliV0Table& operator=(const AliV0Table& table); // not implemented
+
+  void     Resize(Int_t n);
+  void     FillESD(const AliESDEvent* esd);
+  void     FillAOD(const AliAODEvent* aod);
+  void     SetKinematics(Int_t i, const Double_t* pPos, const Double_t* pNeg);
+
+  const AliVEvent*     fEvent;           //! event of the table
+  Long64_t             fEntry;           //! analysis manager entry of the table
+  Int_t                fNV0s;            //! number of V0s in the table
+  std::vector<Bool_t>  fOnFly;           //! on the fly V0 finder
+  std::vector<AliVTrack*> fDaughter[2];  //! positive and negative daughters
+  std::vector<Double_t> fCosPA;          //! cosine of pointing angle (as the V0 getters: stored value for ESD, w.r.t. the primary vertex for AOD), double as the cuts are close to 1
+  std::vector<Float_t> fDcaDaughters;    //! DCA between the daughters
+  std::vector<Float_t> fDcaToPV[2];      //! DCA of the positive and negative daughters to the primary vertex
+  std::vector<Float_t> fRadius;          //! transverse decay radius
+  std::vector<Float_t> fDecayLength;     //! decay length w.r.t. the primary vertex
+  std::vector<Float_t> fAlpha;           //! Armenteros alpha
+  std::vector<Float_t> fQt;              //! Armenteros qT
+  std::vector<Float_t> fPt;              //! V0 transverse momentum
+  std::vector<Float_t> fEta;             //! V0 pseudorapidity
+  std::vector<Float_t> fMassK0s;         //! invariant mass as pi+ pi-
+  std::vector<Float_t> fMassLambda;      //! invariant mass as p pi-
+  std::vector<Float_t> fMassAntiLambda;  //! invariant mass as pi+ pbar
+
+  static AliV0Table* fgInstance; //! the table of this process
+
+  ClassDef(AliV0Table, 0);
+};
+
+#endif
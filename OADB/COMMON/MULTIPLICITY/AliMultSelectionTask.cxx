@@ -35,6 +35,7 @@ class AliAODVertex;
 class AliESDAD; //AD
 
 
+#include <vector>
 #include <AliVAD.h> //AD
 #include <Riostream.h>
 #include "TList.h"
@@ -81,6 +82,7 @@ class AliESDAD; //AD
 //For MultSelection Framework
 #include "AliOADBContainer.h"
 #include "AliOADBMultSelection.h"
+#include "AliCentralityLookupTable.h"
 #include "AliMultEstimator.h"
 #include "AliMultVariable.h"
 #include "AliMultInput.h"
@@ -1431,21 +1433,35 @@ void AliMultSelectionTask::UserExec(Option_t *)
         TH1F *lThisCalibHisto = 0x0;
         TString lThisCalibHistoName;
         Float_t lThisQuantile = -1;
-        for(Long_t iEst=0; iEst<lSelection->GetNEstimators(); iEst++) {
-            //Changed: no need for run number, object already matches required one
-            lThisCalibHistoName = Form("hCalib_%s",lSelection->GetEstimator(iEst)->GetName());
-            lThisCalibHisto = 0x0;
-            lThisCalibHisto = fOadbMultSelection->GetCalibHisto( lThisCalibHistoName );
-            if ( ! lThisCalibHisto ) {
-                lThisQuantile = AliMultSelectionCuts::kNoCalib;
+        //Lookup tables built by AliOADBMultSelection::Setup(): all estimators at once, no histogram search
+        const AliCentralityLookupTable *lLookup = fOadbMultSelection->GetLookupTable();
+        if ( lLookup && lLookup->GetNEstimators() == lSelection->GetNEstimators() ) {
+            Long_t lNEst = lSelection->GetNEstimators();
+            std::vector<Double_t> lValues(lNEst+1), lQuantiles(lNEst+1);
+            for(Long_t iEst=0; iEst<lNEst; iEst++) lValues[iEst] = lSelection->GetEstimator(iEst)->GetValue();
+            lLookup->GetPercentiles(&lValues[0], &lQuantiles[0], AliMultSelectionCuts::kNoCalib);
+            for(Long_t iEst=0; iEst<lNEst; iEst++) {
+                lThisQuantile = lQuantiles[iEst];
                 if( iEst < fNDebug ) fQuantiles[iEst] = lThisQuantile;
                 lSelection->GetEstimator(iEst)->SetPercentile(lThisQuantile);
-            } else {
-                lThisQuantile = lThisCalibHisto->GetBinContent( lThisCalibHisto->FindBin( lSelection->GetEstimator(iEst)->GetValue() ));
-                if( iEst < fNDebug ) {
-                    fQuantiles[iEst] = lThisQuantile; //Debug, please
+            }
+        } else {
+            for(Long_t iEst=0; iEst<lSelection->GetNEstimators(); iEst++) {
+                //Changed: no need for run number, object already matches required one
+                lThisCalibHistoName = Form("hCalib_%s",lSelection->GetEstimator(iEst)->GetName());
+                lThisCalibHisto = 0x0;
+                lThisCalibHisto = fOadbMultSelection->GetCalibHisto( lThisCalibHistoName );
+                if ( ! lThisCalibHisto ) {
+                    lThisQuantile = AliMultSelectionCuts::kNoCalib;
+                    if( iEst < fNDebug ) fQuantiles[iEst] = lThisQuantile;
+                    lSelection->GetEstimator(iEst)->SetPercentile(lThisQuantile);
+                } else {
+                    lThisQuantile = lThisCalibHisto->GetBinContent( lThisCalibHisto->FindBin( lSelection->GetEstimator(iEst)->GetValue() ));
+                    if( iEst < fNDebug ) {
+                        fQuantiles[iEst] = lThisQuantile; //Debug, please
+                    }
+                    lSelection->GetEstimator(iEst)->SetPercentile(lThisQuantile);
                 }
-                lSelection->GetEstimator(iEst)->SetPercentile(lThisQuantile);
             }
         }
 
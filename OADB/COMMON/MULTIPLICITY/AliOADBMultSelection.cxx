@@ -6,6 +6,7 @@
 #include "AliMultInput.h"
 #include "AliMultSelection.h"
 #include "AliMultSelectionCuts.h"
+#include "AliCentralityLookupTable.h"
 #include "TFolder.h"
 #include "TObjString.h"
 #include "TBrowser.h"
@@ -17,7 +18,7 @@ ClassImp(AliOADBMultSelection);
 //________________________________________________________________
 //Constructors/Destructor
 AliOADBMultSelection::AliOADBMultSelection() :
-TNamed("multSel",""), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0)
+TNamed("multSel",""), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0), fLookup(0)
 {
     // constructor
     // fCalibList = new TList();
@@ -29,7 +30,8 @@ AliOADBMultSelection::AliOADBMultSelection(const AliOADBMultSelection& o)
 fCalibList(0),
 fEventCuts(0),
 fSelection(0),
-fMap(0)
+fMap(0),
+fLookup(0)
 {
     fCalibList = new TList();
     fCalibList->SetOwner (kTRUE);
@@ -41,7 +43,7 @@ fMap(0)
 }
 //________________________________________________________________
 AliOADBMultSelection::AliOADBMultSelection(const char * name, const char * title) :
-TNamed(name, title), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0)
+TNamed(name, title), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0), fLookup(0)
 {
     // constructor
     fCalibList = new TList();
@@ -61,6 +63,10 @@ AliOADBMultSelection& AliOADBMultSelection::operator=(const AliOADBMultSelection
         delete fMap;
         fMap = 0;
     }
+    if (fLookup) {
+        delete fLookup;
+        fLookup = 0;
+    }
     fCalibList = new TList();
     fCalibList->SetOwner (kTRUE);
     TIter next(o.fCalibList);
@@ -75,6 +81,7 @@ AliOADBMultSelection::~AliOADBMultSelection(){
     // Destructor
     if(fEventCuts)     delete fEventCuts;
     if(fSelection)     delete fSelection;
+    if(fLookup)        delete fLookup;
     
     //if( fCalibList) {
     //    fCalibList -> Delete();
@@ -231,18 +238,24 @@ void AliOADBMultSelection::Setup()
         delete fMap;
         fMap = 0;
     }
+    if (fLookup) {
+        delete fLookup;
+        fLookup = 0;
+    }
     AliMultSelection* sel = GetMultSelection();
     if (!sel) return;
     
     fMap = new TMap;
     fMap->SetOwner(false);
+    fLookup = new AliCentralityLookupTable();
     
     for(Long_t iEst=0; iEst<sel->GetNEstimators(); iEst++) {
         AliMultEstimator* e = sel->GetEstimator(iEst);
-        if (!e) continue;
+        TH1F*   h = 0;
+        if (e) h = GetCalibHisto(TString(Form("hCalib_%s", e->GetName())));
         
-        TString name(Form("hCalib_%s", e->GetName()));
-        TH1F*   h = GetCalibHisto(name);
+        // one entry per estimator, also without calibration
+        fLookup->AddEstimator(h);
         if (!h) continue;
         
         fMap->Add(e, h);
@@ -9,6 +9,7 @@ class TList;
 class AliMultSelectionCuts;
 class AliMultEstimator;
 class TMap;
+class AliCentralityLookupTable;
 
 class AliOADBMultSelection : public TNamed {
     
@@ -39,6 +40,7 @@ public:
     //Use internal map
     void Setup();
     TH1F* FindHisto(AliMultEstimator* e);
+    const AliCentralityLookupTable* GetLookupTable() const { return fLookup; }
     void Print(Option_t* option="") const;
     
 private:
@@ -46,7 +48,8 @@ private:
     AliMultSelectionCuts * fEventCuts; // EventCuts
     AliMultSelection     * fSelection; // Definition of Estimators
     TMap*                  fMap; //! Map estimator to histogram
-    ClassDef(AliOADBMultSelection, 1)
+    AliCentralityLookupTable* fLookup; //! Calibration histogram of each estimator as lookup table, filled by Setup()
+    ClassDef(AliOADBMultSelection, 2)
     
     
 };
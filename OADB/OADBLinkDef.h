@@ -6,14 +6,19 @@
 #pragma link off all classes;
 #pragma link off all functions;
 
+#pragma link C++ class AliCentralityLookupTable+;
 #pragma link C++ class AliOADBCentrality+;
+#pragma link C++ class AliOADBContainerCache+;
 #pragma link C++ class AliOADBPhysicsSelection+;
 #pragma link C++ class AliOADBFillingScheme+;
 #pragma link C++ class AliOADBTriggerAnalysis+;
 #pragma link C++ class AliOADBTrackFix+;
 
 #pragma link C++ class AliAnalysisUtils+;
+#pragma link C++ class AliPIDResponseCache+;
 #pragma link C++ class AliPPVsMultUtils+;
+#pragma link C++ class AliV0Table+;
+#pragma link C++ class AliDeDxTrackTable+;
 #pragma link C++ class AliBackgroundSelection+;
 #pragma link C++ class AliCentralitySelectionTask+;
 #pragma link C++ class AliEPSelectionTask+;
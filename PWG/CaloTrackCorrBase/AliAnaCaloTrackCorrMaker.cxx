@@ -31,6 +31,7 @@
 #include "AliAnaCaloTrackCorrMaker.h"
 #include "AliLog.h"
 #include "AliGenPythiaEventHeader.h"
+#include "AliTaskTimingProfile.h"
 
 /// \cond CLASSIMP
 ClassImp(AliAnaCaloTrackCorrMaker) ;
@@ -49,6 +50,7 @@ fAnaDebug(0),                 fCuts(new TList),
 fScaleFactor(-1),
 fFillDataControlHisto(kTRUE), fSumw2(0),
 fCheckPtHard(0),
+fDoTiming(0),                 fTimingProfile(0),
 // Control histograms
 fhNEventsIn(0),               fhNEvents(0),
 fhNExoticEvents(0),           fhNEventsNoTriggerFound(0),
@@ -101,6 +103,8 @@ fScaleFactor(maker.fScaleFactor),
 fFillDataControlHisto(maker.fFillDataControlHisto),
 fSumw2(maker.fSumw2),
 fCheckPtHard(maker.fCheckPtHard),
+fDoTiming(maker.fDoTiming),
+fTimingProfile(0),
 fhNEventsIn(maker.fhNEventsIn),
 fhNEvents(maker.fhNEvents),
 fhNExoticEvents(maker.fhNExoticEvents),
@@ -183,6 +187,8 @@ AliAnaCaloTrackCorrMaker::~AliAnaCaloTrackCorrMaker()
 	  fCuts->Delete();
 	  delete fCuts;
   }
+
+  delete fTimingProfile ;
 }
 
 //__________________________________________________________________
@@ -877,6 +883,20 @@ TList *AliAnaCaloTrackCorrMaker::GetOutputContainer()
   
   delete templist;
   
+  // Real time of the reader and of each analysis, in hTimingRealTime
+  if ( fDoTiming && fAnalysisContainer )
+  {
+    fTimingProfile = new AliTaskTimingProfile("Timing");
+    fTimingProfile->AddRegion("ProcessEvent");
+    fTimingProfile->AddRegion("Reader");
+    for(Int_t iana = 0; iana <  fAnalysisContainer->GetEntries(); iana++)
+    {
+      AliAnaCaloTrackCorrBaseClass * ana =  ((AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(iana)) ;
+      fTimingProfile->AddRegion(Form("%s%s",(ana->GetAddedHistogramsStringToName()).Data(),ana->ClassName()));
+    }
+    fTimingProfile->Init(fOutputContainer);
+  }
+  
   // ------------------------
   // Add analysis histograms
   // ------------------------
@@ -1027,6 +1047,8 @@ void AliAnaCaloTrackCorrMaker::ProcessEvent(Int_t iEntry, const char * currentFi
   if(fMakeHisto && !fOutputContainer)
     AliFatal("Histograms not initialized");
   
+  AliTaskTimingProfile::Scope timingEvent(fTimingProfile, kTimingProcessEvent);
+  
   AliDebug(1,Form("***  AliAnaCaloTrackCorrMaker::ProcessEvent() Event %d   ***",iEntry));
   AliDebug(2,Form("Current File Name : %s", currentFileName));
   //printf("fAODBranchList %p, entries %d\n",fAODBranchList,fAODBranchList->GetEntries());
@@ -1047,7 +1069,9 @@ void AliAnaCaloTrackCorrMaker::ProcessEvent(Int_t iEntry, const char * currentFi
   fCaloUtils->AccessOADB(fReader->GetInputEvent());
   
   // Tell the reader to fill the data in the 3 detector lists
+  if ( fTimingProfile ) fTimingProfile->Start(kTimingReader);
   Bool_t ok = fReader->FillInputEvent(iEntry, currentFileName);
+  if ( fTimingProfile ) fTimingProfile->Stop(kTimingReader);
   
   // Access pointers, and trigger mask check needed in mixing case
   AliAnalysisManager   *manager      = AliAnalysisManager::GetAnalysisManager();
@@ -1095,6 +1119,8 @@ void AliAnaCaloTrackCorrMaker::ProcessEvent(Int_t iEntry, const char * currentFi
   {
     AliAnaCaloTrackCorrBaseClass * ana = ((AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(iana)) ;
     
+    AliTaskTimingProfile::Scope timingAna(fTimingProfile, kTimingAnalysis+iana);
+    
     ana->ConnectInputOutputAODBranches(); // Sets branches for each analysis
     
     //Fill pool for mixed event for the analysis that need it
@@ -26,6 +26,7 @@ class TList;
 class TClonesArray;
 #include<TObject.h>
 class TH1F;
+class AliTaskTimingProfile;
 
 // --- Analysis system ---
 #include "AliCaloTrackReader.h" 
@@ -77,6 +78,9 @@ class AliAnaCaloTrackCorrMaker : public TObject {
   void    SwitchOnPtHardHistogram()        { fCheckPtHard = kTRUE  ; }
   void    SwitchOffPtHardHistogram()       { fCheckPtHard = kFALSE ; }
 
+  void    SwitchOnTiming()                 { fDoTiming = kTRUE     ; }
+  void    SwitchOffTiming()                { fDoTiming = kFALSE    ; }
+
   void    SetScaleFactor(Double_t scale)   { fScaleFactor = scale  ; } 
 
   void    SetCaloUtils(AliCalorimeterUtils * cu) { fCaloUtils = cu ; }
@@ -129,6 +133,13 @@ class AliAnaCaloTrackCorrMaker : public TObject {
   Bool_t   fSumw2 ;                                  ///<  Call the histograms method Sumw2() after initialization, off by default, too large memory booking, use carefully
     
   Bool_t   fCheckPtHard ;                            ///< For MC done in pT-Hard bins, plot specific histogram
+
+  Bool_t   fDoTiming ;                               ///< Fill the real time per event of the reader and of each analysis, off by default
+
+  /// Timed regions of ProcessEvent, the analysis i is region kTimingAnalysis+i.
+  enum ETimingRegion { kTimingProcessEvent = 0, kTimingReader, kTimingAnalysis } ;
+
+  AliTaskTimingProfile * fTimingProfile ;            //!<! Timing of ProcessEvent, only with fDoTiming.
   
   // Control histograms
   
@@ -200,7 +211,7 @@ class AliAnaCaloTrackCorrMaker : public TObject {
   AliAnaCaloTrackCorrMaker & operator = (const AliAnaCaloTrackCorrMaker & ) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliAnaCaloTrackCorrMaker,26) ;
+  ClassDef(AliAnaCaloTrackCorrMaker,27) ;
   /// \endcond
 
 } ;
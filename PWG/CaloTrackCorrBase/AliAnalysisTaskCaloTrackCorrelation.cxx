@@ -165,7 +165,23 @@ void AliAnalysisTaskCaloTrackCorrelation::Init()
 	
   // Initialise analysis
   fAna->Init();
-  
+
+  // Take the selected tracks and clusters from the reader of another task, if requested
+  TString inputTaskName = (fAna->GetReader())->GetInputReaderTaskName();
+  if ( inputTaskName.Length() )
+  {
+    AliAnalysisTaskCaloTrackCorrelation * inputTask = dynamic_cast<AliAnalysisTaskCaloTrackCorrelation*>
+      ((AliAnalysisManager::GetAnalysisManager())->GetTask(inputTaskName));
+
+    if ( !inputTask || !inputTask->GetAnalysisMaker() )
+    {
+      AliFatal(Form("Input reader task <%s> not found, it must be added to the train before this one, STOP!",inputTaskName.Data()));
+      return; // coverity
+    }
+
+    (fAna->GetReader())->SetInputReader((inputTask->GetAnalysisMaker())->GetReader());
+  }
+
   // Delta AOD
   if((fAna->GetReader())->GetDeltaAODFileName()!="")
     AliAnalysisManager::GetAnalysisManager()->RegisterExtraFile((fAna->GetReader())->GetDeltaAODFileName());
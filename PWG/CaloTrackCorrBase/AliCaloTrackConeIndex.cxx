@@ -0,0 +1,118 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// --- ROOT system ---
+#include <TMath.h>
+
+// --- Standard library ---
+#include <algorithm>
+
+// --- CaloTrackCorrelations ---
+#include "AliCaloTrackConeIndex.h"
+
+/// \cond CLASSIMP
+ClassImp(AliCaloTrackConeIndex) ;
+/// \endcond
+
+//____________________________________________
+/// Default constructor.
+//____________________________________________
+AliCaloTrackConeIndex::AliCaloTrackConeIndex() :
+TObject(),
+fNEntries(0),  fSorted(kFALSE),
+fPt(),         fEta(),         fPhi(),       fID(),
+fEtaOrder(),   fPhiOrder(),    fEtaSorted(), fPhiSorted()
+{
+}
+
+//____________________________________________________________________________
+/// Add one particle, entries must be added in the order of the list.
+//____________________________________________________________________________
+void AliCaloTrackConeIndex::Add(Float_t pt, Float_t eta, Float_t phi, Int_t id)
+{
+  if ( fNEntries >= fPt.GetSize() )
+  {
+    Int_t size = TMath::Max(2*fPt.GetSize(), 64);
+    fPt .Set(size);
+    fEta.Set(size);
+    fPhi.Set(size);
+    fID .Set(size);
+  }
+
+  fPt [fNEntries] = pt  ;
+  fEta[fNEntries] = eta ;
+  fPhi[fNEntries] = phi ;
+  fID [fNEntries] = id  ;
+
+  fNEntries++;
+  fSorted = kFALSE;
+}
+
+//____________________________________________________________________________
+/// Get the entries with etaMin <= eta <= etaMax or phiMin <= phi <= phiMax.
+/// \param entries: output, the entries in increasing order, without duplicates.
+/// \return number of entries found.
+//____________________________________________________________________________
+Int_t AliCaloTrackConeIndex::FindInWindow(Float_t etaMin, Float_t etaMax,
+                                          Float_t phiMin, Float_t phiMax, TArrayI & entries)
+{
+  if ( fNEntries == 0 ) return 0;
+
+  if ( !fSorted ) Sort();
+
+  if ( entries.GetSize() < 2*fNEntries ) entries.Set(2*fNEntries);
+
+  Int_t   * list = entries.GetArray();
+  Int_t     n    = 0;
+
+  const Float_t * etaSorted = fEtaSorted.GetArray();
+  for(Int_t i = std::lower_bound(etaSorted, etaSorted+fNEntries, etaMin) - etaSorted;
+      i < fNEntries && etaSorted[i] <= etaMax; i++)
+    list[n++] = fEtaOrder[i];
+
+  const Float_t * phiSorted = fPhiSorted.GetArray();
+  for(Int_t i = std::lower_bound(phiSorted, phiSorted+fNEntries, phiMin) - phiSorted;
+      i < fNEntries && phiSorted[i] <= phiMax; i++)
+    list[n++] = fPhiOrder[i];
+
+  std::sort(list, list+n);
+
+  return std::unique(list, list+n) - list;
+}
+
+//____________________________________________
+/// Order the entries in eta and in phi.
+//____________________________________________
+void AliCaloTrackConeIndex::Sort()
+{
+  if ( fEtaOrder.GetSize() < fNEntries )
+  {
+    fEtaOrder .Set(fPt.GetSize());
+    fPhiOrder .Set(fPt.GetSize());
+    fEtaSorted.Set(fPt.GetSize());
+    fPhiSorted.Set(fPt.GetSize());
+  }
+
+  TMath::Sort(fNEntries, fEta.GetArray(), fEtaOrder.GetArray(), kFALSE);
+  TMath::Sort(fNEntries, fPhi.GetArray(), fPhiOrder.GetArray(), kFALSE);
+
+  for(Int_t i = 0; i < fNEntries; i++)
+  {
+    fEtaSorted[i] = fEta[fEtaOrder[i]];
+    fPhiSorted[i] = fPhi[fPhiOrder[i]];
+  }
+
+  fSorted = kTRUE;
+}
@@ -0,0 +1,82 @@
+#ifndef ALICALOTRACKCONEINDEX_H
+#define ALICALOTRACKCONEINDEX_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice     */
+
+//_________________________________________________________________________
+/// \class AliCaloTrackConeIndex
+/// \brief Per event table of pT, eta and phi of a list of tracks or clusters.
+///
+/// Filled once per event by AliCaloTrackReader for its CTS, EMCal and PHOS lists,
+/// so that the analysis looking around a candidate (isolation cone, UE bands)
+/// do not recalculate the kinematics of every particle for every candidate.
+/// The entries are sorted in eta and in phi, the particles in an eta or a phi
+/// window are found with a binary search instead of a loop on the full list.
+///
+/// Entry i corresponds to entry i of the list it was filled from.
+//_________________________________________________________________________
+
+// --- ROOT system ---
+#include <TObject.h>
+#include <TArrayF.h>
+#include <TArrayI.h>
+
+class AliCaloTrackConeIndex : public TObject {
+
+ public:
+
+  AliCaloTrackConeIndex() ;
+
+  /// Virtual destructor.
+  virtual ~AliCaloTrackConeIndex() { ; }
+
+  void       Reset()                       { fNEntries = 0 ; fSorted = kFALSE ; }
+
+  void       Add(Float_t pt, Float_t eta, Float_t phi, Int_t id) ;
+
+  Int_t      FindInWindow(Float_t etaMin, Float_t etaMax,
+                          Float_t phiMin, Float_t phiMax, TArrayI & entries) ;
+
+  Int_t      GetNEntries()           const { return fNEntries    ; }
+  Float_t    GetPt (Int_t i)         const { return fPt .At(i)   ; }
+  Float_t    GetEta(Int_t i)         const { return fEta.At(i)   ; }
+  Float_t    GetPhi(Int_t i)         const { return fPhi.At(i)   ; }
+  Int_t      GetID (Int_t i)         const { return fID .At(i)   ; }
+
+ private:
+
+  void       Sort() ;
+
+  Int_t      fNEntries ;         ///< Number of entries filled in this event.
+
+  Bool_t     fSorted ;           ///< Eta and phi orders are up to date.
+
+  TArrayF    fPt ;               ///< pT of the entries.
+
+  TArrayF    fEta ;              ///< Eta of the entries.
+
+  TArrayF    fPhi ;              ///< Phi of the entries, in [0, 2pi].
+
+  TArrayI    fID ;               ///< Track ID or cluster ID of the entries.
+
+  TArrayI    fEtaOrder ;         ///< Entries sorted in eta.
+
+  TArrayI    fPhiOrder ;         ///< Entries sorted in phi.
+
+  TArrayF    fEtaSorted ;        ///< Eta of the entries in fEtaOrder.
+
+  TArrayF    fPhiSorted ;        ///< Phi of the entries in fPhiOrder.
+
+  /// Copy constructor not implemented.
+  AliCaloTrackConeIndex(              const AliCaloTrackConeIndex & i) ;
+
+  /// Assignment operator not implemented.
+  AliCaloTrackConeIndex & operator = (const AliCaloTrackConeIndex & i) ;
+
+  /// \cond CLASSIMP
+  ClassDef(AliCaloTrackConeIndex,1) ;
+  /// \endcond
+
+} ;
+
+#endif //ALICALOTRACKCONEINDEX_H
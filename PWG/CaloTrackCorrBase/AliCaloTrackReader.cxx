@@ -17,6 +17,7 @@
 #include <TFile.h>
 #include <TGeoManager.h>
 #include <TStreamerInfo.h>
+#include <TVector3.h>
 
 // ---- ANALYSIS system ----
 #include "AliMCEvent.h"
@@ -133,7 +134,12 @@ fNonStandardJets(new TClonesArray("AliAODJet",100)),          fInputNonStandardJ
 fFillInputBackgroundJetBranch(kFALSE), 
 fBackgroundJets(0x0),fInputBackgroundJetBranchName("jets"),
 fAcceptEventsWithBit(0),     fRejectEventsWithBit(0),         fRejectEMCalTriggerEventsWith2Tresholds(0),
-fMomentum(),                 fOutputContainer(0x0),           fEnergyHistogramNbins(0),
+fMomentum(),
+fCTSConeIndex(),             fEMCALConeIndex(),               fPHOSConeIndex(),
+fCTSConeIndexFilled(0),      fEMCALConeIndexFilled(0),        fPHOSConeIndexFilled(0),
+fInputReaderTaskName(""),    fInputReader(0x0),
+fKeepListsForOtherReaders(0), fListsFilled(0),
+fOutputContainer(0x0),           fEnergyHistogramNbins(0),
 fhNEventsAfterCut(0),        fNMCGenerToAccept(0),            fMCGenerEventHeaderToAccept("")
 {
   for(Int_t i = 0; i < 8; i++) fhEMCALClusterCutsE [i]= 0x0 ;    
@@ -1292,6 +1298,10 @@ Bool_t AliCaloTrackReader::FillInputEvent(Int_t iEntry, const char * /*curFileNa
   fIsTriggerMatchOpenCut[1] = kFALSE ;
   fIsTriggerMatchOpenCut[2] = kFALSE ;
   
+  // Lists kept for other readers during the previous event
+  if(fKeepListsForOtherReaders) ClearInputLists();
+  fListsFilled = kFALSE;
+  
   //fCurrentFileName = TString(currentFileName);
   if(!fInputEvent)
   {
@@ -1461,9 +1471,20 @@ Bool_t AliCaloTrackReader::FillInputEvent(Int_t iEntry, const char * /*curFileNa
   // Fill the arrays with cluster/tracks/cells data
   //-----------------------------------------------
   
+  // Lists of other reader must correspond to this event
+  if(fInputReader && (!fInputReader->AreListsFilled() || fInputReader->GetInputEvent() != fInputEvent))
+  {
+    AliDebug(1,Form("Event rejected by input reader of task <%s>",fInputReaderTaskName.Data()));
+    return kFALSE;
+  }
+  
+  if(fInputReader)
+    FillInputFromReader();
+  
   if(fFillCTS)
   {
-    FillInputCTS();
+    if(!fInputReader) FillInputCTS();
+    
     //Accept events with at least one track
     if(fTrackMult == 0 && fDoRejectNoTrackEvents) return kFALSE ;
     
@@ -1487,11 +1508,14 @@ Bool_t AliCaloTrackReader::FillInputEvent(Int_t iEntry, const char * /*curFileNa
   if(fFillPHOSCells)
     FillInputPHOSCells();
   
-  if(fFillEMCAL || fFillDCAL)
-    FillInputEMCAL();
-  
-  if(fFillPHOS)
-    FillInputPHOS();
+  if(!fInputReader)
+  {
+    if(fFillEMCAL || fFillDCAL)
+      FillInputEMCAL();
+    
+    if(fFillPHOS)
+      FillInputPHOS();
+  }
   
   FillInputVZERO();
   
@@ -1503,6 +1527,8 @@ Bool_t AliCaloTrackReader::FillInputEvent(Int_t iEntry, const char * /*curFileNa
 
   AliDebug(1,"Event accepted for analysis");
 
+  fListsFilled = kTRUE;
+  
   return kTRUE ;
 }
 
@@ -2369,6 +2395,114 @@ void AliCaloTrackReader::FillInputPHOS()
   AliDebug(1,Form("AOD entries %d",fPHOSClusters->GetEntriesFast())) ;  
 }
 
+//___________________________________________________________________________
+/// Set the reader of another task, whose selected tracks and clusters
+/// are used as input of this one. Its lists are then kept until the next event.
+//___________________________________________________________________________
+void AliCaloTrackReader::SetInputReader(AliCaloTrackReader * reader)
+{
+  if ( reader == this ) 
+  {
+    AliWarning("Input reader cannot be this reader, not set");
+    return;
+  }
+  
+  fInputReader = reader;
+  
+  if ( fInputReader ) fInputReader->SwitchOnKeepListsForOtherReaders();
+}
+
+//___________________________________________________________________________
+/// Fill the CTS, EMCal and PHOS arrays from the arrays of the input reader
+/// instead of looping on the input event, see SetInputReaderTaskName().
+/// The particles are already selected by the input reader, only the
+/// kinematic and fiducial cuts of this reader are applied. The track
+/// multiplicity, vertex BC and cluster pile-up counters are the ones
+/// of the input reader.
+//___________________________________________________________________________
+void AliCaloTrackReader::FillInputFromReader()
+{
+  AliDebug(1,"Begin");
+  
+  if(fFillCTS)
+  {
+    fTrackMult = fInputReader->GetTrackMultiplicity();
+    fVertexBC  = fInputReader->GetVertexBC();
+    
+    for(Int_t i = 0; i < 19; i++)
+    {
+      fTrackBCEvent   [i] = fInputReader->GetTrackEventBC(i);
+      fTrackBCEventCut[i] = fInputReader->GetTrackEventBCcut(i);
+    }
+    
+    TObjArray * tracks = fInputReader->GetCTSTracks();
+    for(Int_t itrack = 0; itrack < tracks->GetEntriesFast(); itrack++)
+    {
+      AliVTrack * track = (AliVTrack*) tracks->At(itrack);
+      
+      fMomentum.SetPxPyPzE(track->Px(),track->Py(),track->Pz(),0);
+      
+      if(fCTSPtMin > fMomentum.Pt() || fCTSPtMax < fMomentum.Pt()) continue ;
+      
+      if(fCheckFidCut && !fFiducialCut->IsInFiducialCut(fMomentum.Eta(),fMomentum.Phi(),kCTS)) continue;
+      
+      fhCTSTrackCutsPt[5]->Fill(track->Pt());
+      
+      fCTSTracks->Add(track);
+    }
+  }
+  
+  if(fFillEMCAL || fFillDCAL)
+  {
+    fNPileUpClusters    = fInputReader->GetNPileUpClusters();
+    fNNonPileUpClusters = fInputReader->GetNNonPileUpClusters();
+    
+    for(Int_t i = 0; i < 19; i++)
+    {
+      fEMCalBCEvent   [i] = fInputReader->GetEMCalEventBC(i);
+      fEMCalBCEventCut[i] = fInputReader->GetEMCalEventBCcut(i);
+    }
+    
+    TObjArray * clusters = fInputReader->GetEMCALClusters();
+    for(Int_t iclus = 0; iclus < clusters->GetEntriesFast(); iclus++)
+    {
+      AliVCluster * clus = (AliVCluster*) clusters->At(iclus);
+      
+      if(fEMCALPtMin > clus->E() || fEMCALPtMax < clus->E()) continue ;
+      
+      clus->GetMomentum(fMomentum, fVertex[0]);
+      
+      if(fCheckFidCut && !fFiducialCut->IsInFiducialCut(fMomentum.Eta(),fMomentum.Phi(),kEMCAL)) continue ;
+      
+      if(fFillEMCAL) fhEMCALClusterCutsE[7]->Fill(clus->E());
+      
+      fEMCALClusters->Add(clus);
+    }
+  }
+  
+  if(fFillPHOS)
+  {
+    TObjArray * clusters = fInputReader->GetPHOSClusters();
+    for(Int_t iclus = 0; iclus < clusters->GetEntriesFast(); iclus++)
+    {
+      AliVCluster * clus = (AliVCluster*) clusters->At(iclus);
+      
+      clus->GetMomentum(fMomentum, fVertex[0]);
+      
+      if (fCheckFidCut && !fFiducialCut->IsInFiducialCut(fMomentum.Eta(),fMomentum.Phi(),kPHOS) ) continue ;
+      
+      if (fPHOSPtMin > fMomentum.E() || fPHOSPtMax < fMomentum.E() ) continue ;
+      
+      fhPHOSClusterCutsE[6]->Fill(clus->E());
+      
+      fPHOSClusters->Add(clus);
+    }
+  }
+  
+  AliDebug(1,Form("Entries from reader of task <%s>: CTS %d, EMCal %d, PHOS %d",fInputReaderTaskName.Data(),
+                  fCTSTracks->GetEntriesFast(),fEMCALClusters->GetEntriesFast(),fPHOSClusters->GetEntriesFast()));
+}
+
 //____________________________________________
 /// Connects the array with EMCAL cells and the pointer.
 //____________________________________________
@@ -3108,9 +3242,13 @@ void AliCaloTrackReader::RemapMCLabelForAODs(Int_t & label)
 //___________________________________
 void AliCaloTrackReader::ResetLists()
 {  
-  if(fCTSTracks)       fCTSTracks     -> Clear();
-  if(fEMCALClusters)   fEMCALClusters -> Clear("C");
-  if(fPHOSClusters)    fPHOSClusters  -> Clear("C");
+  // Other readers use the lists after this one is done,
+  // clear them at the beginning of next event
+  if(!fKeepListsForOtherReaders) ClearInputLists();
+  
+  fCTSConeIndexFilled   = kFALSE;
+  fEMCALConeIndexFilled = kFALSE;
+  fPHOSConeIndexFilled  = kFALSE;
   
   fV0ADC[0] = 0;   fV0ADC[1] = 0;
   fV0Mul[0] = 0;   fV0Mul[1] = 0;
@@ -3119,6 +3257,82 @@ void AliCaloTrackReader::ResetLists()
   fBackgroundJets->Reset();
 }
 
+//___________________________________
+/// Clear the track and cluster lists.
+//___________________________________
+void AliCaloTrackReader::ClearInputLists()
+{
+  if(fCTSTracks)       fCTSTracks     -> Clear();
+  if(fEMCALClusters)   fEMCALClusters -> Clear("C");
+  if(fPHOSClusters)    fPHOSClusters  -> Clear("C");
+  
+  fListsFilled = kFALSE;
+}
+
+//___________________________________________________________________________
+/// Get the pT, eta and phi table of one of the track or cluster lists
+/// of this reader, filled the first time it is requested in the event.
+/// The kinematics are calculated as in AliIsolationCut, tracks from the
+/// momentum vector and clusters assuming they come from the vertex.
+/// \param list: CTS, EMCal or PHOS list of this reader.
+/// \return NULL if the list is not one of the reader lists or in mixed events.
+//___________________________________________________________________________
+AliCaloTrackConeIndex* AliCaloTrackReader::GetConeIndex(TObjArray * list)
+{
+  if ( !list || fMixedEvent ) return 0x0;
+  
+  if ( list == fCTSTracks )
+  {
+    if ( !fCTSConeIndexFilled )
+    {
+      fCTSConeIndex.Reset();
+      
+      for(Int_t itrack = 0; itrack < fCTSTracks->GetEntriesFast(); itrack++)
+      {
+        AliVTrack * track = dynamic_cast<AliVTrack*>(fCTSTracks->At(itrack));
+        if ( !track ) return 0x0;
+        
+        TVector3 trackVector(track->Px(),track->Py(),track->Pz());
+        Float_t phi = trackVector.Phi();
+        if ( phi < 0 ) phi+=TMath::TwoPi();
+        
+        fCTSConeIndex.Add(trackVector.Pt(), trackVector.Eta(), phi, GetTrackID(track));
+      }
+      
+      fCTSConeIndexFilled = kTRUE;
+    }
+    
+    return &fCTSConeIndex;
+  }
+  
+  AliCaloTrackConeIndex * index  = 0x0;
+  Bool_t                * filled = 0x0;
+  if      ( list == fEMCALClusters ) { index = &fEMCALConeIndex; filled = &fEMCALConeIndexFilled; }
+  else if ( list == fPHOSClusters  ) { index = &fPHOSConeIndex ; filled = &fPHOSConeIndexFilled ; }
+  else return 0x0;
+  
+  if ( !(*filled) )
+  {
+    index->Reset();
+    
+    for(Int_t iclus = 0; iclus < list->GetEntriesFast(); iclus++)
+    {
+      AliVCluster * calo = dynamic_cast<AliVCluster*>(list->At(iclus));
+      if ( !calo ) return 0x0;
+      
+      calo->GetMomentum(fMomentum,fVertex[0]);
+      Float_t phi = fMomentum.Phi();
+      if ( phi < 0 ) phi+=TMath::TwoPi();
+      
+      index->Add(fMomentum.Pt(), fMomentum.Eta(), phi, calo->GetID());
+    }
+    
+    *filled = kTRUE;
+  }
+  
+  return index;
+}
+
 //___________________________________________
 /// Tag event depending on trigger name.
 /// Set also the L1 bit defining the EGA or EJE triggers.
@@ -50,6 +50,7 @@ class AliVCluster;
 // --- CaloTrackCorr / EMCAL ---
 #include "AliFiducialCut.h"
 class AliCalorimeterUtils;
+#include "AliCaloTrackConeIndex.h"
 #include "AliAnaWeights.h"
 
 // Jets
@@ -74,6 +75,8 @@ public:
   virtual void    Print(const Option_t * opt) const;
   
   virtual void    ResetLists();
+  
+  void            ClearInputLists();
 
   virtual Int_t   GetDebug()                         const { return fDebug                 ; }
   virtual void    SetDebug(Int_t d)                        { fDebug = d                    ; }
@@ -88,6 +91,29 @@ public:
   
   TString         GetTaskName()                      const { return fTaskName              ; }
   void            SetTaskName(TString name)                { fTaskName = name              ; }
+
+  //---------------------------------------
+  // Input taken from the reader of another task
+  //---------------------------------------
+  
+  /// Take the selected tracks and clusters from the reader of the
+  /// AliAnalysisTaskCaloTrackCorrelation with this name, executed before in the train,
+  /// instead of looping again on the input event. Only the kinematic and fiducial
+  /// cuts of this reader are applied on top, the rest of the track and cluster
+  /// selection (quality, time, bad channels, ...) is the one of the other reader.
+  /// The event selection is done as usual.
+  void            SetInputReaderTaskName(TString name)     { fInputReaderTaskName = name   ; }
+  TString         GetInputReaderTaskName()           const { return fInputReaderTaskName   ; }
+  
+  void            SetInputReader(AliCaloTrackReader * reader) ;
+  AliCaloTrackReader * GetInputReader()              const { return fInputReader           ; }
+  
+  /// Do not clear the track and cluster lists in ResetLists(), but at the beginning
+  /// of the next event, so that other readers can use them.
+  void            SwitchOnKeepListsForOtherReaders()       { fKeepListsForOtherReaders = kTRUE ; }
+  
+  /// \return kTRUE if the lists contain the selected particles of the current event.
+  Bool_t          AreListsFilled()                   const { return fListsFilled           ; }
     
   //---------------------------------------
   // Input/output event setters and getters
@@ -281,6 +307,7 @@ public:
   virtual void     FillInputEMCAL() ;
   virtual void     FillInputEMCALAlgorithm(AliVCluster * clus, Int_t iclus) ;
   virtual void     FillInputPHOS() ;
+  virtual void     FillInputFromReader() ;
   virtual void     FillInputEMCALCells() ;
   virtual void     FillInputPHOSCells() ;
   virtual void     FillInputVZERO() ;  
@@ -299,6 +326,8 @@ public:
   virtual TObjArray*     GetPHOSClusters()           const { return fPHOSClusters           ; }
   virtual AliVCaloCells* GetEMCALCells()             const { return fEMCALCells             ; }
   virtual AliVCaloCells* GetPHOSCells()              const { return fPHOSCells              ; }
+
+  AliCaloTrackConeIndex* GetConeIndex(TObjArray * list) ;
   
   //-------------------------------------
   // Event/track selection methods
@@ -932,6 +961,18 @@ public:
   Bool_t           fRejectEMCalTriggerEventsWith2Tresholds; ///< Reject events EG2 also triggered by EG1 or EJ2 also triggered by EJ1.
   
   TLorentzVector   fMomentum;                      //!<! Temporal TLorentzVector container, avoid declaration of TLorentzVectors per event.
+
+  AliCaloTrackConeIndex fCTSConeIndex;             //!<! pT, eta, phi of fCTSTracks, filled on demand by GetConeIndex().
+  AliCaloTrackConeIndex fEMCALConeIndex;           //!<! pT, eta, phi of fEMCALClusters, filled on demand by GetConeIndex().
+  AliCaloTrackConeIndex fPHOSConeIndex;            //!<! pT, eta, phi of fPHOSClusters, filled on demand by GetConeIndex().
+  Bool_t           fCTSConeIndexFilled;            //!<! fCTSConeIndex corresponds to this event.
+  Bool_t           fEMCALConeIndexFilled;          //!<! fEMCALConeIndex corresponds to this event.
+  Bool_t           fPHOSConeIndexFilled;           //!<! fPHOSConeIndex corresponds to this event.
+  
+  TString          fInputReaderTaskName;           ///<  Name of the task whose reader lists are used as input, see SetInputReaderTaskName().
+  AliCaloTrackReader * fInputReader;               //!<! Reader of task fInputReaderTaskName, set by AliAnalysisTaskCaloTrackCorrelation.
+  Bool_t           fKeepListsForOtherReaders;      //!<! Clear the lists at the beginning of the next event, not in ResetLists().
+  Bool_t           fListsFilled;                   //!<! The lists contain the selected particles of the current event.
     
   // cut control histograms
   
@@ -960,7 +1001,7 @@ public:
   AliCaloTrackReader & operator = (const AliCaloTrackReader & r) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliCaloTrackReader,76) ;
+  ClassDef(AliCaloTrackReader,78) ;
   /// \endcond
 
 } ;
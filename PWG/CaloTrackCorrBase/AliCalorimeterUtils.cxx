@@ -73,7 +73,8 @@ fOADBForEMCAL(kFALSE),            fOADBForPHOS(kFALSE),
 fOADBFilePathEMCAL(""),           fOADBFilePathPHOS(""),
 fImportGeometryFromFile(0),       fImportGeometryFilePath(""),
 fNSuperModulesUsed(0),            fRunNumber(0),
-fMCECellClusFracCorrOn(0),        fMCECellClusFracCorrParam()
+fMCECellClusFracCorrOn(0),        fMCECellClusFracCorrParam(),
+fEMCALCellIndexes()
 {
   InitParameters();
   for(Int_t i = 0; i < 22; i++) fEMCALMatrix[i] = 0 ;
@@ -1193,6 +1194,9 @@ Int_t AliCalorimeterUtils::GetModuleNumber(AliVCluster * cluster) const
   
   if( cluster->IsEMCAL() )
   {
+    if ( absId < fEMCALCellIndexes.GetSize() && fEMCALCellIndexes[absId] >= 0 )
+      return fEMCALCellIndexes[absId] & 0xFF ;
+    
     AliDebug(2,Form("EMCAL absid %d, SuperModule %d",absId, fEMCALGeo->GetSuperModuleNumber(absId)));
     
     return fEMCALGeo->GetSuperModuleNumber(absId) ;
@@ -1224,47 +1228,23 @@ Int_t AliCalorimeterUtils::GetModuleNumberCellIndexes(Int_t absId, Int_t calo,
   
   if ( calo == AliFiducialCut::kEMCAL )
   {
-    Int_t iTower = -1, iIphi = -1, iIeta = -1;
-    fEMCALGeo->GetCellIndex(absId,imod,iTower,iIphi,iIeta);
-    fEMCALGeo->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,irow,icol);
-    
-    if(imod < 0 || irow < 0 || icol < 0 )
+    // Indexes tabulated when the geometry was initialized
+    if ( absId < fEMCALCellIndexes.GetSize() && fEMCALCellIndexes[absId] >= 0 )
     {
-      AliFatal(Form("Negative value for super module: %d, or cell icol: %d, or cell irow: %d, check EMCAL geometry name",imod,icol,irow));
+      Int_t indexes = fEMCALCellIndexes[absId];
+      imod =  indexes        & 0xFF;
+      irow = (indexes >>  8) & 0xFF;
+      icol = (indexes >> 16) & 0xFF;
+      iRCU = (indexes >> 24) & 0xFF;
+      
+      return imod ;
     }
     
-    // In case of DCal C side, shift columns to match offline/online numbering
-    // when calculating the DDL for Run2
-    // See AliEMCALRawUtils::Digits2Raw and Raw2Digits.
-    Int_t ico2 = icol ;
-    if ( imod == 13 || imod == 15 || imod == 17 ) ico2 += 16; 
-
-    // RCU / DDL
-    if(imod < 10 || (imod > 11 && imod < 18)) // (EMCAL Full || DCAL 2/3)
+    if ( !CalculateEMCALCellIndexes(absId, imod, icol, irow, iRCU) )
     {
-      // RCU0 / DDL0
-      if      ( 0 <= irow && irow <  8 ) iRCU = 0; // first cable row
-      else if ( 8 <= irow && irow < 16 &&  
-                0 <= ico2 && ico2 < 24 ) iRCU = 0; // first half;
-      //second cable row
-      
-      // RCU1 / DDL1
-      else if (  8 <= irow && irow < 16 && 
-                24 <= ico2 && ico2 < 48 ) iRCU = 1; // second half;
-      //second cable row
-      else if ( 16 <= irow && irow < 24 ) iRCU = 1; // third cable row
-      
-      if ( imod%2 == 1 ) iRCU = 1 - iRCU; // swap for odd=C side, to allow us to cable both sides the same
-    }
-    else
-    {
-      // 1/3 SM have one single SRU, just assign RCU/DDL 0
-      iRCU = 0 ;
+      AliFatal(Form("Negative value for super module: %d, or cell icol: %d, or cell irow: %d, check EMCAL geometry name",imod,icol,irow));
     }
     
-    if ( iRCU < 0 )
-      AliFatal(Form("Wrong EMCAL RCU number = %d", iRCU));
-    
     return imod ;
   } // EMCAL
   else // PHOS
@@ -1290,6 +1270,78 @@ Int_t AliCalorimeterUtils::GetModuleNumberCellIndexes(Int_t absId, Int_t calo,
   return -1;
 }
 
+//___________________________________________________________________________________________________
+/// Calculate with the geometry the EMCAL super module, column, row and RCU/DDL number of this absId.
+/// \return kFALSE if the super module, column or row are negative.
+//___________________________________________________________________________________________________
+Bool_t AliCalorimeterUtils::CalculateEMCALCellIndexes(Int_t absId, Int_t & imod,
+                                                      Int_t & icol, Int_t & irow, Int_t & iRCU) const
+{
+  Int_t iTower = -1, iIphi = -1, iIeta = -1;
+  fEMCALGeo->GetCellIndex(absId,imod,iTower,iIphi,iIeta);
+  fEMCALGeo->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,irow,icol);
+  
+  if(imod < 0 || irow < 0 || icol < 0 ) return kFALSE;
+  
+  // In case of DCal C side, shift columns to match offline/online numbering
+  // when calculating the DDL for Run2
+  // See AliEMCALRawUtils::Digits2Raw and Raw2Digits.
+  Int_t ico2 = icol ;
+  if ( imod == 13 || imod == 15 || imod == 17 ) ico2 += 16; 
+
+  // RCU / DDL
+  if(imod < 10 || (imod > 11 && imod < 18)) // (EMCAL Full || DCAL 2/3)
+  {
+    // RCU0 / DDL0
+    if      ( 0 <= irow && irow <  8 ) iRCU = 0; // first cable row
+    else if ( 8 <= irow && irow < 16 &&  
+              0 <= ico2 && ico2 < 24 ) iRCU = 0; // first half;
+    //second cable row
+    
+    // RCU1 / DDL1
+    else if (  8 <= irow && irow < 16 && 
+              24 <= ico2 && ico2 < 48 ) iRCU = 1; // second half;
+    //second cable row
+    else if ( 16 <= irow && irow < 24 ) iRCU = 1; // third cable row
+    
+    if ( imod%2 == 1 ) iRCU = 1 - iRCU; // swap for odd=C side, to allow us to cable both sides the same
+  }
+  else
+  {
+    // 1/3 SM have one single SRU, just assign RCU/DDL 0
+    iRCU = 0 ;
+  }
+  
+  if ( iRCU < 0 )
+    AliFatal(Form("Wrong EMCAL RCU number = %d", iRCU));
+  
+  return kTRUE;
+}
+
+//___________________________________________________________________________________________________
+/// Tabulate per absId the EMCAL super module, column, row and RCU/DDL number,
+/// called once the geometry is set, so that GetModuleNumberCellIndexes()
+/// and GetModuleNumber() do not go through the geometry for each cell.
+//___________________________________________________________________________________________________
+void AliCalorimeterUtils::FillEMCALCellIndexes()
+{
+  Int_t nCells = fEMCALGeo->GetNCells();
+  
+  fEMCALCellIndexes.Set(nCells);
+  
+  Int_t imod = -1, icol = -1, irow = -1, iRCU = -1;
+  for(Int_t absId = 0; absId < nCells; absId++)
+  {
+    iRCU = -1;
+    if ( fEMCALGeo->CheckAbsCellId(absId) && CalculateEMCALCellIndexes(absId, imod, icol, irow, iRCU) )
+      fEMCALCellIndexes[absId] = imod | (irow << 8) | (icol << 16) | (iRCU << 24);
+    else
+      fEMCALCellIndexes[absId] = -1; // calculate it when requested
+  }
+  
+  AliDebug(1,Form("EMCAL cell indexes tabulated for %d cells",nCells));
+}
+
 //___________________________________________________________________________________________________
 /// Same as GetModuleCellIndexes, but add an additional shift in col/row to have continuous 
 /// cell distribution from supermodule to supermodule.
@@ -1685,6 +1737,8 @@ void AliCalorimeterUtils::InitEMCALGeometry()
     TGeoManager::Import(fImportGeometryFilePath) ; // default need file "geometry.root" in local dir!!!!
   }
   else if (!gGeoManager) AliInfo("Careful!, gGeoManager not loaded, load misalign matrices");
+  
+  FillEMCALCellIndexes();
 }
 
 ///
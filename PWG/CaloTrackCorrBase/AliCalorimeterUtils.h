@@ -21,6 +21,7 @@
 #include <TObject.h> 
 #include <TString.h>
 #include <TObjArray.h>
+#include <TArrayI.h>
 class TArrayF;  
 #include <TH2I.h>
 #include <TGeoMatrix.h>
@@ -465,6 +466,12 @@ class AliCalorimeterUtils : public TObject {
   
   Float_t            fMCECellClusFracCorrParam[4]; ///<  Parameters for the function correcting the weight of the cells in the cluster.
   
+  TArrayI            fEMCALCellIndexes;         //!<! Per absId, SM | row << 8 | col << 16 | RCU << 24, set with the geometry, -1 if not tabulated.
+  
+  Bool_t             CalculateEMCALCellIndexes(Int_t absId, Int_t & imod, Int_t & icol, Int_t & irow, Int_t & iRCU) const ;
+  
+  void               FillEMCALCellIndexes() ;
+  
   /// Copy constructor not implemented.
   AliCalorimeterUtils(              const AliCalorimeterUtils & cu) ;
   
@@ -472,7 +479,7 @@ class AliCalorimeterUtils : public TObject {
   AliCalorimeterUtils & operator = (const AliCalorimeterUtils & cu) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliCalorimeterUtils,19) ;
+  ClassDef(AliCalorimeterUtils,20) ;
   /// \endcond
 
 } ;
@@ -27,6 +27,7 @@
 
 // --- CaloTrackCorrelations --- 
 #include "AliCaloTrackReader.h"
+#include "AliCaloTrackConeIndex.h"
 #include "AliCalorimeterUtils.h"
 #include "AliCaloPID.h"
 #include "AliFiducialCut.h"
@@ -54,7 +55,9 @@ fFracIsThresh(1),
 fIsTMClusterInConeRejected(1),
 fDistMinToTrigger(-1.),
 fMomentum(),
-fTrackVector()
+fTrackVector(),
+fUseConeIndex(1),
+fConeIndexEntries()
 {
   InitParameters();
 }
@@ -453,6 +456,14 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
   Int_t       ntrackrefs   = 0;
   Int_t       nclusterrefs = 0;
   
+  // Particles contributing to the cone or to the UE bands are all in the eta band
+  // (|eta-etaC| < R) or in the phi band (|phi-phiC| < R). For the reader lists, take
+  // them from the reader eta-phi table, with a small margin, instead of looping on all.
+  Float_t indexEtaMin = etaC - fConeSize - 0.01;
+  Float_t indexEtaMax = etaC + fConeSize + 0.01;
+  Float_t indexPhiMin = phiC - fConeSize - 0.01;
+  Float_t indexPhiMax = phiC + fConeSize + 0.01;
+  
   // --------------------------------
   // Check charged tracks in cone.
   // --------------------------------
@@ -460,8 +471,16 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
   if(plCTS &&
      (fPartInCone==kOnlyCharged || fPartInCone==kNeutralAndCharged))
   {
-    for(Int_t ipr = 0;ipr < plCTS->GetEntries() ; ipr ++ )
+    AliCaloTrackConeIndex * trackIndex = 0x0;
+    if ( fUseConeIndex ) trackIndex = reader->GetConeIndex(plCTS);
+    
+    Int_t nTracks = plCTS->GetEntries();
+    if ( trackIndex ) nTracks = trackIndex->FindInWindow(indexEtaMin, indexEtaMax, indexPhiMin, indexPhiMax, fConeIndexEntries);
+    
+    for(Int_t itr = 0;itr < nTracks ; itr ++ )
     {
+      Int_t ipr = trackIndex ? fConeIndexEntries[itr] : itr;
+      
       AliVTrack* track = dynamic_cast<AliVTrack*>(plCTS->At(ipr)) ;
       
       if(track)
@@ -471,7 +490,7 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
         // in the isolation conte
         if ( pCandidate->GetDetectorTag() == AliFiducialCut::kCTS ) // make sure conversions are tagged as kCTS!!!
         {
-          Int_t  trackID   = reader->GetTrackID(track) ; // needed instead of track->GetID() since AOD needs some manipulations
+          Int_t  trackID   = trackIndex ? trackIndex->GetID(ipr) : reader->GetTrackID(track) ; // needed instead of track->GetID() since AOD needs some manipulations
           Bool_t contained = kFALSE;
           
           for(Int_t i = 0; i < 4; i++) 
@@ -482,10 +501,19 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
           if ( contained ) continue ;
         }
         
-        fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
-        pt  = fTrackVector.Pt();
-        eta = fTrackVector.Eta();
-        phi = fTrackVector.Phi() ;
+        if ( trackIndex )
+        {
+          pt  = trackIndex->GetPt (ipr);
+          eta = trackIndex->GetEta(ipr);
+          phi = trackIndex->GetPhi(ipr);
+        }
+        else
+        {
+          fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+          pt  = fTrackVector.Pt();
+          eta = fTrackVector.Eta();
+          phi = fTrackVector.Phi() ;
+        }
       }
       else
       {// Mixed event stored in AliAODPWG4Particles
@@ -606,8 +634,16 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
      (fPartInCone==kOnlyNeutral || fPartInCone==kNeutralAndCharged))
   {
     
-    for(Int_t ipr = 0;ipr < plNe->GetEntries() ; ipr ++ )
+    AliCaloTrackConeIndex * caloIndex = 0x0;
+    if ( fUseConeIndex ) caloIndex = reader->GetConeIndex(plNe);
+    
+    Int_t nClusters = plNe->GetEntries();
+    if ( caloIndex ) nClusters = caloIndex->FindInWindow(indexEtaMin, indexEtaMax, indexPhiMin, indexPhiMax, fConeIndexEntries);
+    
+    for(Int_t icl = 0;icl < nClusters ; icl ++ )
     {
+      Int_t ipr = caloIndex ? fConeIndexEntries[icl] : icl;
+      
       AliVCluster * calo = dynamic_cast<AliVCluster *>(plNe->At(ipr)) ;
       
       if(calo)
@@ -629,12 +665,21 @@ void  AliIsolationCut::MakeIsolationCut(TObjArray * plCTS,
              pid->IsTrackMatched(calo,reader->GetCaloUtils(),reader->GetInputEvent()) ) continue ;
         }
         
-        // Assume that come from vertex in straight line
-        calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
-        
-        pt  = fMomentum.Pt()  ;
-        eta = fMomentum.Eta() ;
-        phi = fMomentum.Phi() ;
+        if ( caloIndex )
+        {
+          pt  = caloIndex->GetPt (ipr);
+          eta = caloIndex->GetEta(ipr);
+          phi = caloIndex->GetPhi(ipr);
+        }
+        else
+        {
+          // Assume that come from vertex in straight line
+          calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
+          
+          pt  = fMomentum.Pt()  ;
+          eta = fMomentum.Eta() ;
+          phi = fMomentum.Phi() ;
+        }
       }
       else
       {// Mixed event stored in AliAODPWG4Particles
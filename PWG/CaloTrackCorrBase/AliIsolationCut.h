@@ -21,6 +21,7 @@
 #include <TObject.h>
 class TObjArray ;
 #include <TLorentzVector.h>
+#include <TArrayI.h>
 
 // --- ANALYSIS system ---
 class AliAODPWG4ParticleCorrelation ;
@@ -108,6 +109,9 @@ class AliIsolationCut : public TObject {
   void       SetFracIsThresh(Bool_t f )                        { fFracIsThresh      = f    ; }
   void       SetTrackMatchedClusterRejectionInCone(Bool_t tm)  { fIsTMClusterInConeRejected = tm ; }
   void       SetMinDistToTrigger(Float_t md)                   { fDistMinToTrigger  = md   ; }
+
+  void       SwitchOnConeIndex()                               { fUseConeIndex      = kTRUE  ; }
+  void       SwitchOffConeIndex()                              { fUseConeIndex      = kFALSE ; }
     
  private:
 
@@ -139,6 +143,10 @@ class AliIsolationCut : public TObject {
 
   TVector3   fTrackVector;       //!<! Track moment, temporal object.
 
+  Bool_t     fUseConeIndex;      ///<  Use the reader eta-phi tables to loop only on particles around the candidate.
+
+  TArrayI    fConeIndexEntries;  //!<! Entries of the reader eta-phi table around the candidate, temporal array.
+
   /// Copy constructor not implemented.
   AliIsolationCut(              const AliIsolationCut & g) ;
 
@@ -146,7 +154,7 @@ class AliIsolationCut : public TObject {
   AliIsolationCut & operator = (const AliIsolationCut & g) ; 
 
   /// \cond CLASSIMP
-  ClassDef(AliIsolationCut,11) ;
+  ClassDef(AliIsolationCut,12) ;
   /// \endcond
 
 } ;
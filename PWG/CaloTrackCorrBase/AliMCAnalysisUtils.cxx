@@ -43,7 +43,10 @@ fJetsList(new TList),
 fMCGenerator(kPythia),
 fMCGeneratorString("PYTHIA"),
 fDaughMom(),  fDaughMom2(),
-fMotherMom(), fGMotherMom()
+fMotherMom(), fGMotherMom(),
+fUseOriginCache(kTRUE),
+fOriginCacheEvent(-1),   fOriginCacheMC(0x0),   fOriginCacheNMC(0),
+fOriginCache(),          fOriginCacheKey()
 {}
 
 //_______________________________________
@@ -230,6 +233,8 @@ Int_t AliMCAnalysisUtils::CheckOrigin(const Int_t * label, Int_t nlabels,
   if      ( calorimeter == AliCaloTrackReader::kEMCAL ) arrayCluster = reader->GetEMCALClusters();
   else if ( calorimeter == AliCaloTrackReader::kPHOS  ) arrayCluster = reader->GetPHOSClusters ();
   
+  if ( fUseOriginCache ) return CheckOriginWithCache(label, nlabels, reader, calorimeter, arrayCluster);
+  
   //Select where the information is, ESD-galice stack or AOD mcparticles branch
   if(reader->ReadStack())
   {
@@ -265,6 +270,8 @@ Int_t AliMCAnalysisUtils::CheckOrigin(Int_t label, const AliCaloTrackReader* rea
     
   Int_t labels[]={label};
   
+  if ( fUseOriginCache ) return CheckOriginWithCache(labels, 1, reader, calorimeter, arrayCluster);
+  
   //Select where the information is, ESD-galice stack or AOD mcparticles branch
   if(reader->ReadStack()){
     tag = CheckOriginInStack(labels, 1,reader->GetStack(),arrayCluster);
@@ -276,6 +283,60 @@ Int_t AliMCAnalysisUtils::CheckOrigin(Int_t label, const AliCaloTrackReader* rea
   return tag ;
 }	
 
+//_____________________________________________________________________________________________________
+/// Same as CheckOrigin(), but keep the tag of the calorimeter and list of labels 
+/// during the event, and return it directly when the same labels are checked again,
+/// as done for the same cluster by several analysis or several times in one analysis.
+/// The cache is emptied when the event number or the MC particles container change.
+//_____________________________________________________________________________________________________
+Int_t AliMCAnalysisUtils::CheckOriginWithCache(const Int_t *labels, Int_t nlabels, const AliCaloTrackReader* reader,
+                                               Int_t calorimeter, TObjArray * arrayCluster)
+{
+  const TObject * mc  = 0x0;
+  Int_t           nmc = 0;
+  if      ( reader->ReadStack()          && reader->GetStack() )
+  {
+    mc  = reader->GetStack();
+    nmc = reader->GetStack()->GetNtrack();
+  }
+  else if ( reader->ReadAODMCParticles() && reader->GetAODMCParticles() )
+  {
+    mc  = reader->GetAODMCParticles();
+    nmc = reader->GetAODMCParticles()->GetEntriesFast();
+  }
+  
+  if ( fOriginCacheEvent != reader->GetEventNumber() || fOriginCacheMC != mc || fOriginCacheNMC != nmc )
+  {
+    fOriginCache.clear();
+    fOriginCacheEvent = reader->GetEventNumber();
+    fOriginCacheMC    = mc;
+    fOriginCacheNMC   = nmc;
+  }
+  
+  fOriginCacheKey.resize(nlabels+1);
+  fOriginCacheKey[0] = calorimeter;
+  for(Int_t ilab = 0; ilab < nlabels; ilab++) fOriginCacheKey[ilab+1] = labels[ilab];
+  
+  std::map< std::vector<Int_t>, Int_t >::const_iterator it = fOriginCache.find(fOriginCacheKey);
+  if ( it != fOriginCache.end() ) return it->second;
+  
+  Int_t tag = 0;
+  
+  //Select where the information is, ESD-galice stack or AOD mcparticles branch
+  if(reader->ReadStack())
+  {
+    tag = CheckOriginInStack(labels, nlabels, reader->GetStack(), arrayCluster);
+  }
+  else if(reader->ReadAODMCParticles())
+  {
+    tag = CheckOriginInAOD(labels, nlabels, reader->GetAODMCParticles(),arrayCluster);
+  }
+  
+  fOriginCache[fOriginCacheKey] = tag;
+  
+  return tag ;
+}
+
 //__________________________________________________________________________________________
 /// \return tag with primary particle(S) at the origin of the cluster/track.
 /// Do this for ESDs, same things as in CheckOriginInAOD.
@@ -2092,6 +2153,7 @@ void AliMCAnalysisUtils::Print(const Option_t * opt) const
   
   printf("Debug level    = %d\n",fDebug);
   printf("MC Generator   = %s\n",fMCGeneratorString.Data());
+  printf("Origin cache   = %d\n",fUseOriginCache);
   printf(" \n");
 } 
 
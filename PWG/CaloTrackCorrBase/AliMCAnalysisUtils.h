@@ -22,6 +22,10 @@
 #include <TObject.h>
 #include <TString.h>
 #include <TLorentzVector.h>
+
+// --- Standard library ---
+#include <map>
+#include <vector>
 class TList ;
 class TVector3;
 class TClonesArray;
@@ -71,6 +75,11 @@ class AliMCAnalysisUtils : public TObject {
   Int_t   CheckOriginInStack(const Int_t *labels, Int_t nlabels, AliStack * stack               , const TObjArray *arrayCluster) ; // ESD
   Int_t   CheckOriginInAOD  (const Int_t *labels, Int_t nlabels, const TClonesArray* mcparticles, const TObjArray *arrayCluster) ; // AOD
   
+  /// Keep per event the tags found by CheckOrigin(label(s),reader,calorimeter), so
+  /// that the same labels checked again in the event do not walk the mother chain again.
+  void    SwitchOnOriginCache()         { fUseOriginCache = kTRUE  ; }
+  void    SwitchOffOriginCache()        { fUseOriginCache = kFALSE ; }
+  
   void    CheckOverlapped2GammaDecay(const Int_t *labels, Int_t nlabels, Int_t mesonIndex, AliStack * stack,                Int_t & tag); // ESD
   void    CheckOverlapped2GammaDecay(const Int_t *labels, Int_t nlabels, Int_t mesonIndex, const TClonesArray* mcparticles, Int_t & tag); // AOD
   
@@ -148,6 +157,21 @@ class AliMCAnalysisUtils : public TObject {
   
   TLorentzVector fGMotherMom;          //!<! particle momentum
   
+  Bool_t         fUseOriginCache;      ///<  Keep the CheckOrigin tags of the event, see SwitchOnOriginCache().
+  
+  Int_t          fOriginCacheEvent;    //!<! Event number of the tags in fOriginCache.
+  
+  const TObject* fOriginCacheMC;       //!<! MC stack or AOD MC particles array of the tags in fOriginCache.
+  
+  Int_t          fOriginCacheNMC;      //!<! Number of MC particles of the event of the tags in fOriginCache.
+  
+  std::map< std::vector<Int_t>, Int_t > fOriginCache; //!<! CheckOrigin tag per calorimeter and list of labels.
+  
+  std::vector<Int_t> fOriginCacheKey;  //!<! Temporal key container, avoid allocation per call.
+  
+  Int_t          CheckOriginWithCache(const Int_t *labels, Int_t nlabels, const AliCaloTrackReader * reader,
+                                      Int_t calorimeter, TObjArray * arrayCluster) ;
+  
   /// Copy constructor not implemented.
   AliMCAnalysisUtils & operator = (const AliMCAnalysisUtils & mcu) ; 
   
@@ -155,7 +179,7 @@ class AliMCAnalysisUtils : public TObject {
   AliMCAnalysisUtils(              const AliMCAnalysisUtils & mcu) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliMCAnalysisUtils,6) ;
+  ClassDef(AliMCAnalysisUtils,7) ;
   /// \endcond
 
 } ;
@@ -22,5 +22,6 @@
 #pragma link C++ class AliAnalysisTaskCaloTrackCorrelationM+;
 #pragma link C++ class AliHistogramRanges+;
 #pragma link C++ class AliAnaWeights+;
+#pragma link C++ class AliCaloTrackConeIndex+;
 
 #endif
@@ -152,7 +152,12 @@ Double_t AliGenEMlibV2::PtExponential(const Double_t *px, const Double_t *c){
 // Hagedorn with additional Powerlaw
 Double_t AliGenEMlibV2::PtModifiedHagedornPowerlaw(const Double_t *px, const Double_t *c){
   const double &pt=px[0];
-  Double_t invYield = c[0]*pow(c[1]+pt*c[2],-c[3])*CrossOverLc(c[5],c[4],pt)+CrossOverRc(c[7],c[6],pt)*c[8]*pow(pt+0.001,-c[9]); //pt+0.001: prevent powerlaw from exploding for pt->0
+  // the pow() of a part is only evaluated where its cross over weight is not 0
+  Double_t lc = CrossOverLc(c[5],c[4],pt);
+  Double_t rc = CrossOverRc(c[7],c[6],pt);
+  Double_t invYield = 0;
+  if(lc!=0) invYield += c[0]*pow(c[1]+pt*c[2],-c[3])*lc;
+  if(rc!=0) invYield += rc*c[8]*pow(pt+0.001,-c[9]); //pt+0.001: prevent powerlaw from exploding for pt->0
   
   return invYield*(2*TMath::Pi()*pt+0.001); //+0.001: be sure to be > 0
 }
@@ -938,7 +943,12 @@ Double_t AliGenEMlibV2::V2Param(const Double_t *px, const Double_t *par)
   // Very general parametrization of the v2
   
   const double &pt=px[0];
-  double val=CrossOverLc(par[4],par[3],pt)*(2*par[0]/(1+TMath::Exp(par[1]*(par[2]-pt)))-par[0])+CrossOverRc(par[4],par[3],pt)*((par[8]-par[5])/(1+TMath::Exp(par[6]*(pt-par[7])))+par[5]);
+  // both parts share the cross over, the exp() of a part is only evaluated where its weight is not 0
+  double lc=CrossOverLc(par[4],par[3],pt);
+  double rc=1-lc;
+  double val=0;
+  if(lc!=0) val+=lc*(2*par[0]/(1+TMath::Exp(par[1]*(par[2]-pt)))-par[0]);
+  if(rc!=0) val+=rc*((par[8]-par[5])/(1+TMath::Exp(par[6]*(pt-par[7])))+par[5]);
   double sys=0;
   if(fgSelectedV2Systematic){
     double syspt=((pt>par[15])&(fgSelectedV2Systematic>0))?par[15]:pt;
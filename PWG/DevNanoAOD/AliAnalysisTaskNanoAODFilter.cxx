@@ -57,7 +57,11 @@ AliAnalysisTaskNanoAODFilter::AliAnalysisTaskNanoAODFilter() // All data members
   fEvtCuts(0),
   fTrkCuts(0),
   fSetter(0),
-  fSaveCutsFlag(0)
+  fSaveCutsFlag(0),
+  fColumnar(kFALSE),
+  fColumnPrecision(""),
+  fColumnCompression(""),
+  fCompressionSet(kFALSE)
 {
   // Dummy constructor ALWAYS needed for I/O.
 }
@@ -71,7 +75,11 @@ AliAnalysisTaskNanoAODFilter::AliAnalysisTaskNanoAODFilter(const char *name, Boo
    fEvtCuts(0),
    fTrkCuts(0),
    fSetter(0),
-   fSaveCutsFlag(saveCutsFlag)
+   fSaveCutsFlag(saveCutsFlag),
+   fColumnar(kFALSE),
+   fColumnPrecision(""),
+   fColumnCompression(""),
+   fCompressionSet(kFALSE)
      
 {
   // Constructor
@@ -125,6 +133,10 @@ void AliAnalysisTaskNanoAODFilter::AddFilteredAOD(const char* aodfilename, const
      
   cout<<"rep: "<<rep<<endl;
   rep->SetCustomSetter(fSetter);
+  rep->SetColumnar(fColumnar);
+  rep->SetColumnPrecision(fColumnPrecision);
+  rep->SetColumnCompression(fColumnCompression);
+  fTrkrep = rep;
   std::cout << "SETTER: " << fSetter << " " << rep->GetCustomSetter() << std::endl;
   
   ext->DropUnspecifiedBranches(); // all branches not part of a FilterBranch call (below) will be dropped
@@ -172,6 +184,10 @@ void AliAnalysisTaskNanoAODFilter::UserExec(Option_t *)
   if ( handler ){
     AliAODExtension *extNanoAOD = handler->GetFilteredAOD("AliAOD.NanoAOD.root");
    if ( extNanoAOD ) {				
+     if (fColumnar && !fCompressionSet && fTrkrep) {
+       fTrkrep->SetBranchCompression(extNanoAOD->GetTree());
+       fCompressionSet = kTRUE;
+     }
      extNanoAOD->SetEvent(lAODevent);
      extNanoAOD->SelectEvent();
      extNanoAOD->FinishEvent();
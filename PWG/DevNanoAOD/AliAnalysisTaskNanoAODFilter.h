@@ -53,6 +53,10 @@ public:
   void  SetSetter      (AliNanoAODCustomSetter * var    ) { fSetter = var;}
   void  SetVarList     (TString var                     ) { fVarList = var;}
   void  SetVarListHead (TString var                     ) { fVarListHead = var;}
+  // Columnar output, see AliNanoAODReplicator::SetColumnar. Must be set before Init()
+  void  SetColumnar          (Bool_t  var = kTRUE          ) { fColumnar = var;}
+  void  SetColumnPrecision   (TString var                  ) { fColumnPrecision = var;}
+  void  SetColumnCompression (TString var                  ) { fColumnCompression = var;}
     
 private:
   Int_t fMCMode; // true if processing monte carlo. if > 1 not all MC particles are filtered
@@ -66,11 +70,16 @@ private:
   
   Bool_t fSaveCutsFlag; // If true, the event and track cuts are saved to disk. Can only be set in the constructor.
 
+  Bool_t  fColumnar;          // one branch per track variable instead of the tracks array
+  TString fColumnPrecision;   // mantissa bits per column ("var:bits,...")
+  TString fColumnCompression; // compression settings per column branch ("var:settings,...")
+  Bool_t  fCompressionSet;    //! column compression applied to the output tree
+
   
   AliAnalysisTaskNanoAODFilter(const AliAnalysisTaskNanoAODFilter&); // not implemented
   AliAnalysisTaskNanoAODFilter& operator=(const AliAnalysisTaskNanoAODFilter&); // not implemented
     
-  ClassDef(AliAnalysisTaskNanoAODFilter, 1); // example of analysis
+  ClassDef(AliAnalysisTaskNanoAODFilter, 2); // example of analysis
 };
 
 #endif
@@ -0,0 +1,91 @@
+#include "AliNanoAODColumn.h"
+
+#include <cstring>
+
+ClassImp(AliNanoAODColumn)
+
+//_____________________________________________________________________________
+AliNanoAODColumn::AliNanoAODColumn() :
+  TNamed(),
+  fIsInteger(kFALSE),
+  fMantissaBits(23),
+  fN(0),
+  fValues(0),
+  fNInt(0),
+  fIntValues(0),
+  fCapacity(0),
+  fCompression(-1)
+{
+  // default ctor
+}
+
+//_____________________________________________________________________________
+AliNanoAODColumn::AliNanoAODColumn(const char * name, Bool_t isInteger, Int_t mantissaBits, Int_t compression) :
+  TNamed(name, name),
+  fIsInteger(isInteger),
+  fMantissaBits(23),
+  fN(0),
+  fValues(0),
+  fNInt(0),
+  fIntValues(0),
+  fCapacity(0),
+  fCompression(compression)
+{
+  // ctor
+  SetMantissaBits(mantissaBits);
+}
+
+//_____________________________________________________________________________
+AliNanoAODColumn::~AliNanoAODColumn()
+{
+  // dtor
+  delete [] fValues;
+  delete [] fIntValues;
+}
+
+//_____________________________________________________________________________
+void AliNanoAODColumn::Clear(Option_t * /*opt*/)
+{
+  // drop the values of the previous event, the storage is kept
+  fN = 0;
+  fNInt = 0;
+}
+
+//_____________________________________________________________________________
+void AliNanoAODColumn::Add(Double_t value)
+{
+  // append the value of the next track
+  Int_t n = GetN();
+  if (n >= fCapacity) {
+    Int_t capacity = fCapacity > 0 ? 2*fCapacity : 256;
+    if (fIsInteger) {
+      Int_t * values = new Int_t[capacity];
+      if (n) memcpy(values, fIntValues, n*sizeof(Int_t));
+      delete [] fIntValues;
+      fIntValues = values;
+    } else {
+      Float_t * values = new Float_t[capacity];
+      if (n) memcpy(values, fValues, n*sizeof(Float_t));
+      delete [] fValues;
+      fValues = values;
+    }
+    fCapacity = capacity;
+  }
+  if (fIsInteger) fIntValues[fNInt++] = (Int_t)value;
+  else fValues[fN++] = Truncate(value, fMantissaBits);
+}
+
+//_____________________________________________________________________________
+Float_t AliNanoAODColumn::Truncate(Float_t value, Int_t mantissaBits)
+{
+  // round the value to mantissaBits bits of mantissa, the other bits are set to zero
+  if (mantissaBits >= 23) return value;
+  UInt_t bits = 0;
+  memcpy(&bits, &value, sizeof(bits));
+  if ((bits & 0x7f800000) == 0x7f800000) return value; // inf and nan are kept
+  const Int_t dropped = 23 - (mantissaBits < 0 ? 0 : mantissaBits);
+  bits += 1u << (dropped - 1);
+  bits &= ~((1u << dropped) - 1);
+  memcpy(&value, &bits, sizeof(bits));
+  return value;
+}
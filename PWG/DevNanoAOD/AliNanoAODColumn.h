@@ -0,0 +1,55 @@
+#ifndef _ALINANOAODCOLUMN_H_
+#define _ALINANOAODCOLUMN_H_
+
+// AliNanoAODColumn
+
+// One variable of the selected tracks of an event, written as its own
+// branch by AliNanoAODReplicator in columnar mode. A reader can then
+// enable only the branches of the variables it uses.
+// Float columns can be stored with a reduced number of mantissa bits:
+// the dropped bits are zero and cost almost nothing after compression.
+// The compression settings of the branch are kept with the column and
+// applied by AliNanoAODReplicator::SetBranchCompression.
+
+#include "TNamed.h"
+
+class AliNanoAODColumn : public TNamed
+{
+public:
+  AliNanoAODColumn();
+  AliNanoAODColumn(const char * name, Bool_t isInteger = kFALSE, Int_t mantissaBits = 23, Int_t compression = -1);
+  virtual ~AliNanoAODColumn();
+
+  virtual void Clear(Option_t * opt = "");
+
+  void     Add(Double_t value);
+  Int_t    GetN() const { return fIsInteger ? fNInt : fN; }
+  Double_t GetValue(Int_t i) const { return fIsInteger ? fIntValues[i] : fValues[i]; }
+  const Float_t * GetValues()    const { return fValues; }
+  const Int_t   * GetIntValues() const { return fIntValues; }
+
+  Bool_t   IsInteger()       const { return fIsInteger; }
+  Int_t    GetMantissaBits() const { return fMantissaBits; }
+  Int_t    GetCompression()  const { return fCompression; }
+  void     SetMantissaBits(Int_t bits) { fMantissaBits = bits < 0 ? 0 : (bits > 23 ? 23 : bits); }
+  void     SetCompression(Int_t settings) { fCompression = settings; }
+
+  static Float_t Truncate(Float_t value, Int_t mantissaBits);
+
+private:
+  AliNanoAODColumn(const AliNanoAODColumn&); // not implemented
+  AliNanoAODColumn& operator=(const AliNanoAODColumn&); // not implemented
+
+  Bool_t    fIsInteger;     // values are stored in fIntValues
+  Int_t     fMantissaBits;  // mantissa bits kept for the float values (23 = full precision)
+  Int_t     fN;             // number of float values
+  Float_t * fValues;        // [fN] float values
+  Int_t     fNInt;          // number of integer values
+  Int_t   * fIntValues;     // [fNInt] integer values
+  Int_t     fCapacity;      //! allocated size of the value array
+  Int_t     fCompression;   //! compression settings of the branch, -1 for the tree default
+
+  ClassDef(AliNanoAODColumn, 1)
+};
+
+#endif /* _ALINANOAODCOLUMN_H_ */
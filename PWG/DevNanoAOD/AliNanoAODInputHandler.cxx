@@ -0,0 +1,223 @@
+#include "AliNanoAODInputHandler.h"
+
+#include "TTree.h"
+#include "TObjArray.h"
+#include "TObjString.h"
+#include "TClonesArray.h"
+#include "AliAODEvent.h"
+#include "AliLog.h"
+#include "AliNanoAODColumn.h"
+#include "AliNanoAODTrack.h"
+
+ClassImp(AliNanoAODInputHandler)
+
+//_____________________________________________________________________________
+AliNanoAODInputHandler::AliNanoAODInputHandler() :
+  AliAODInputHandler(),
+  fColumnList(""),
+  fNanoTree(0),
+  fColumns(0),
+  fConnected(kFALSE),
+  fNTracks(0),
+  fIndexCharge(-1),
+  fIndexLabel(-1),
+  fVarList(""),
+  fVarIndex(),
+  fProxies(0),
+  fProxyIndex()
+{
+  // default ctor
+}
+
+//_____________________________________________________________________________
+AliNanoAODInputHandler::AliNanoAODInputHandler(const char* name, const char* title) :
+  AliAODInputHandler(name, title),
+  fColumnList(""),
+  fNanoTree(0),
+  fColumns(0),
+  fConnected(kFALSE),
+  fNTracks(0),
+  fIndexCharge(-1),
+  fIndexLabel(-1),
+  fVarList(""),
+  fVarIndex(),
+  fProxies(0),
+  fProxyIndex()
+{
+  // ctor
+}
+
+//_____________________________________________________________________________
+AliNanoAODInputHandler::~AliNanoAODInputHandler()
+{
+  // dtor
+  delete fColumns;
+  delete fProxies;
+}
+
+//_____________________________________________________________________________
+Bool_t AliNanoAODInputHandler::Init(TTree* tree, Option_t* opt)
+{
+  // Connect the tree and switch off the track columns which are not requested
+
+  if (!AliAODInputHandler::Init(tree, opt)) return kFALSE;
+  fNanoTree = tree;
+  fConnected = kFALSE;
+  if (!tree || fColumnList.IsNull()) return kTRUE;
+
+  tree->SetBranchStatus("tracks_*", 0);
+  TObjArray * vars = fColumnList.Tokenize(",");
+  TIter next(vars);
+  TObjString * var = 0;
+  while ((var = static_cast<TObjString*>(next()))) {
+    TString name = Form("tracks_%s", var->String().Strip(TString::kBoth).Data());
+    if (!tree->GetBranch(name)) AliWarning(Form("Column %s not found in the input", name.Data()));
+    else tree->SetBranchStatus(name, 1);
+  }
+  delete vars;
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+Bool_t AliNanoAODInputHandler::Notify(const char* path)
+{
+  // New input file: the columns are searched again in the input event
+  fConnected = kFALSE;
+  return AliAODInputHandler::Notify(path);
+}
+
+//_____________________________________________________________________________
+Bool_t AliNanoAODInputHandler::BeginEvent(Long64_t entry)
+{
+  // Find the number of tracks of the event and forget the tracks built in the previous one
+
+  Bool_t ok = AliAODInputHandler::BeginEvent(entry);
+  if (!fConnected) ConnectColumns();
+
+  fNTracks = 0;
+  if (fColumns && fColumns->GetEntriesFast()) 
+    fNTracks = static_cast<AliNanoAODColumn*>(fColumns->UncheckedAt(0))->GetN();
+
+  if (fProxies) fProxies->Clear("C");
+  if (fProxyIndex.GetSize() < fNTracks) fProxyIndex.Set(fNTracks);
+  fProxyIndex.Reset(-1);
+  return ok;
+}
+
+//_____________________________________________________________________________
+void AliNanoAODInputHandler::ConnectColumns()
+{
+  // Collect the enabled columns of the input event, in the order they were written
+
+  if (!fColumns) fColumns = new TObjArray();
+  fColumns->Clear();
+  fVarList = "";
+  fIndexCharge = -1;
+  fIndexLabel = -1;
+
+  AliAODEvent * aod = dynamic_cast<AliAODEvent*>(GetEvent());
+  TList * objects = aod ? aod->GetList() : 0;
+  if (!objects) return;
+
+  TObjArray * vars = fColumnList.Tokenize(",");
+  fVarIndex.Set(objects->GetEntries());
+  Int_t nvars = 0;
+  TIter nextObject(objects);
+  TObject * object = 0;
+  while ((object = nextObject())) {
+    AliNanoAODColumn * column = dynamic_cast<AliNanoAODColumn*>(object);
+    if (!column) continue;
+    TString var = column->GetName();
+    if (!var.BeginsWith("tracks_")) continue;
+    var.Remove(0, 7);
+
+    Int_t varIndex = -1;
+    if (var != "charge" && var != "label") {
+      if (!fVarList.IsNull()) fVarList += ",";
+      fVarList += var;
+      varIndex = nvars++;
+    }
+
+    Bool_t enabled = fColumnList.IsNull();
+    TIter nextVar(vars);
+    TObjString * wanted = 0;
+    while (!enabled && (wanted = static_cast<TObjString*>(nextVar())))
+      enabled = (wanted->String().Strip(TString::kBoth) == var);
+    if (!enabled) continue;
+
+    if (var == "charge") fIndexCharge = fColumns->GetEntriesFast();
+    if (var == "label" ) fIndexLabel  = fColumns->GetEntriesFast();
+    fVarIndex[fColumns->GetEntriesFast()] = varIndex;
+    fColumns->Add(column);
+  }
+  delete vars;
+
+  if (!fColumns->GetEntriesFast()) AliWarning("No NanoAOD track columns in the input event");
+  fConnected = kTRUE;
+}
+
+//_____________________________________________________________________________
+Int_t AliNanoAODInputHandler::GetNColumns() const
+{
+  // Number of enabled columns
+  return fColumns ? fColumns->GetEntriesFast() : 0;
+}
+
+//_____________________________________________________________________________
+Int_t AliNanoAODInputHandler::GetColumnIndex(const char * var) const
+{
+  // Index of the column of var, -1 if it is not read
+
+  if (!fColumns) return -1;
+  TString name = Form("tracks_%s", var);
+  for (Int_t icol = 0; icol < fColumns->GetEntriesFast(); icol++) {
+    if (name == fColumns->UncheckedAt(icol)->GetName()) return icol;
+  }
+  return -1;
+}
+
+//_____________________________________________________________________________
+const AliNanoAODColumn * AliNanoAODInputHandler::GetColumn(Int_t icol) const
+{
+  // Column icol, NULL if not read
+  if (!fColumns || icol < 0 || icol >= fColumns->GetEntriesFast()) return 0;
+  return static_cast<const AliNanoAODColumn*>(fColumns->UncheckedAt(icol));
+}
+
+//_____________________________________________________________________________
+const Float_t * AliNanoAODInputHandler::GetFloatColumn(Int_t icol) const
+{
+  // Values of a float column for the tracks of the current event
+  const AliNanoAODColumn * column = GetColumn(icol);
+  return (column && !column->IsInteger()) ? column->GetValues() : 0;
+}
+
+//_____________________________________________________________________________
+const Int_t * AliNanoAODInputHandler::GetIntColumn(Int_t icol) const
+{
+  // Values of an integer column (charge, label) for the tracks of the current event
+  const AliNanoAODColumn * column = GetColumn(icol);
+  return (column && column->IsInteger()) ? column->GetIntValues() : 0;
+}
+
+//_____________________________________________________________________________
+AliNanoAODTrack * AliNanoAODInputHandler::GetTrack(Int_t i)
+{
+  // Track i of the event as an AliNanoAODTrack, for tasks using the track interface.
+  // Built from the columns at the first request in the event.
+
+  if (i < 0 || i >= fNTracks) return 0;
+  if (fProxyIndex[i] >= 0) return static_cast<AliNanoAODTrack*>(fProxies->UncheckedAt(fProxyIndex[i]));
+
+  if (!fProxies) fProxies = new TClonesArray("AliNanoAODTrack", 1000);
+  Int_t index = fProxies->GetEntriesFast();
+  AliNanoAODTrack * track = new ((*fProxies)[index]) AliNanoAODTrack(fVarList);
+  for (Int_t icol = 0; icol < fColumns->GetEntriesFast(); icol++) {
+    const AliNanoAODColumn * column = static_cast<const AliNanoAODColumn*>(fColumns->UncheckedAt(icol));
+    if (icol == fIndexCharge)     track->SetCharge(column->GetValue(i));
+    else if (icol == fIndexLabel) track->SetLabel(column->GetValue(i));
+    else if (fVarIndex[icol] >= 0) track->SetVar(fVarIndex[icol], column->GetValue(i));
+  }
+  fProxyIndex[i] = index;
+  return track;
+}
@@ -0,0 +1,77 @@
+#ifndef _ALINANOAODINPUTHANDLER_H_
+#define _ALINANOAODINPUTHANDLER_H_
+
+// AliNanoAODInputHandler
+
+// Input handler for NanoAODs written in columnar mode (see
+// AliNanoAODReplicator::SetColumnar). Only the columns enabled with
+// SetColumns are read from the file, the other track branches are
+// switched off. The values of the current event are accessed as
+// contiguous arrays, without building any track object:
+//
+//   Int_t ipt = handler->GetColumnIndex("pt");
+//   const Float_t * pt = handler->GetFloatColumn(ipt);
+//   for (Int_t i = 0; i < handler->GetNTracks(); i++) ... pt[i] ...
+//
+// For tasks which need an AliVTrack, GetTrack(i) builds an
+// AliNanoAODTrack from the columns, once per track and event. The
+// variables of the columns which are not read are not filled.
+
+#include "AliAODInputHandler.h"
+#include "TString.h"
+#include "TArrayI.h"
+
+class TTree;
+class TObjArray;
+class TClonesArray;
+class AliNanoAODColumn;
+class AliNanoAODTrack;
+
+class AliNanoAODInputHandler : public AliAODInputHandler
+{
+public:
+  AliNanoAODInputHandler();
+  AliNanoAODInputHandler(const char* name, const char* title);
+  virtual ~AliNanoAODInputHandler();
+
+  virtual Bool_t Init(Option_t* opt) { return AliAODInputHandler::Init(opt); }
+  virtual Bool_t Init(TTree* tree, Option_t* opt);
+  virtual Bool_t BeginEvent(Long64_t entry);
+  virtual Bool_t Notify() { return AliAODInputHandler::Notify(); }
+  virtual Bool_t Notify(const char* path);
+
+  // Comma separated list of the variables to read ("pt,phi,theta,charge"), all if empty. Must be set before Init
+  void   SetColumns(const char * vars) { fColumnList = vars; }
+  const char * GetColumns() const { return fColumnList; }
+
+  Int_t  GetNColumns() const;
+  Int_t  GetColumnIndex(const char * var) const;
+  const AliNanoAODColumn * GetColumn(Int_t icol) const;
+  const Float_t * GetFloatColumn(Int_t icol) const;
+  const Int_t   * GetIntColumn(Int_t icol) const;
+  Int_t  GetNTracks() const { return fNTracks; }
+
+  AliNanoAODTrack * GetTrack(Int_t i);
+
+private:
+  AliNanoAODInputHandler(const AliNanoAODInputHandler&); // not implemented
+  AliNanoAODInputHandler& operator=(const AliNanoAODInputHandler&); // not implemented
+
+  void   ConnectColumns();
+
+  TString        fColumnList;   // variables to read, all if empty
+  TTree        * fNanoTree;     //! input tree
+  TObjArray    * fColumns;      //! enabled columns of the input event, not owned
+  Bool_t         fConnected;    //! fColumns is up to date with the input event
+  Int_t          fNTracks;      //! number of tracks in the current event
+  Int_t          fIndexCharge;  //! column of the charges, -1 if not read
+  Int_t          fIndexLabel;   //! column of the labels, -1 if not read
+  TString        fVarList;      //! var list of the proxy tracks, all the float columns of the file
+  TArrayI        fVarIndex;     //! index in fVarList of each enabled column, -1 for charge and label
+  TClonesArray * fProxies;      //! tracks built from the columns in the current event
+  TArrayI        fProxyIndex;   //! entry of each track in fProxies, -1 if not built
+
+  ClassDef(AliNanoAODInputHandler, 1)
+};
+
+#endif /* _ALINANOAODINPUTHANDLER_H_ */
@@ -74,6 +74,12 @@ class AliAODRecoDecay;
 #include "TCanvas.h"
 #include "AliNanoAODHeader.h"
 #include "AliNanoAODCustomSetter.h"
+#include "AliNanoAODColumn.h"
+#include "AliNanoAODTrackMapping.h"
+#include "TObjArray.h"
+#include "TObjString.h"
+#include "TTree.h"
+#include "TBranch.h"
 
 using std::cout;
 using std::endl;
@@ -93,7 +99,11 @@ AliAODBranchReplicator(),
   fParticleSelected(),
   fVarList(""),
   fVarListHeader(""),
-  fCustomSetter(0){
+  fCustomSetter(0),
+  fColumnar(kFALSE),
+  fColumnPrecision(""),
+  fColumnCompression(""),
+  fColumns(0){
   // Default ctor. we need it to avoid instantiating a wrong mapping when reading from file 
   }
 
@@ -114,7 +124,11 @@ AliNanoAODReplicator::AliNanoAODReplicator(const char* name, const char* title,
   fParticleSelected(),
   fVarList(varlist),
   fVarListHeader(""),// FIXME: this should be set to a meaningful value: add an arg to the constructor
-  fCustomSetter(0)
+  fCustomSetter(0),
+  fColumnar(kFALSE),
+  fColumnPrecision(""),
+  fColumnCompression(""),
+  fColumns(0)
 {
   // default ctor
   AliNanoAODTrackMapping * tm =new AliNanoAODTrackMapping(fVarList);
@@ -127,6 +141,8 @@ AliNanoAODReplicator::~AliNanoAODReplicator()
 {
   // dtor
   delete fTrackCut;
+  if (fColumnar) delete fTracks; // not in fList in columnar mode
+  delete fColumns;
   delete fList;
 }
 
@@ -407,7 +423,24 @@ TList* AliNanoAODReplicator::GetList() const
 
       fTracks = new TClonesArray("AliNanoAODTrack");      
       fTracks->SetName("tracks"); // TODO: consider the possibility to use a different name to distinguish in AliAODEvent
-      fList->Add(fTracks);    
+      if (!fColumnar) {
+	fList->Add(fTracks);    
+      } else {
+	// the tracks are still built, for the MC filtering, but only the columns are written
+	AliNanoAODTrackMapping * tm = AliNanoAODTrackMapping::GetInstance(fVarList);
+	fColumns = new TObjArray(tm->GetSize()+2);
+	for (Int_t ivar = 0; ivar < tm->GetSize(); ivar++) {
+	  TString var = tm->GetVarName(ivar);
+	  fColumns->Add(new AliNanoAODColumn(Form("tracks_%s", var.Data()), kFALSE,
+					     GetColumnSetting(fColumnPrecision, var, 23),
+					     GetColumnSetting(fColumnCompression, var, -1)));
+	}
+	fColumns->Add(new AliNanoAODColumn("tracks_charge", kTRUE, 23, GetColumnSetting(fColumnCompression, "charge", -1)));
+	fColumns->Add(new AliNanoAODColumn("tracks_label" , kTRUE, 23, GetColumnSetting(fColumnCompression, "label" , -1)));
+	TIter nextColumn(fColumns);
+	TObject * column = 0;
+	while ((column = nextColumn())) fList->Add(column);
+      }
 
       fHeader = new AliNanoAODHeader(3);// TODO: to be customized
       fHeader->SetName("header"); // TODO: consider the possibility to use a different name to distinguish in AliAODEvent
@@ -445,6 +478,9 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
   
 
   fTracks->Clear("C");			
+  if (fColumns) {
+    for (Int_t icol = 0; icol < fColumns->GetEntriesFast(); icol++) fColumns->UncheckedAt(icol)->Clear();
+  }
   assert(fVertices!=0x0);
   fVertices->Clear("C");
   if (fMCMode > 0){
@@ -510,7 +546,70 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
     FilterMC(source);      
   }
   
+  if ( fColumnar ) {
+    FillColumns();
+  }
+
+}
+
+//_____________________________________________________________________________
+void AliNanoAODReplicator::FillColumns()
+{
+  // Copy the variables of the selected tracks to the columns, after the MC label remapping
+
+  const Int_t nvars = fColumns->GetEntriesFast() - 2;
+  AliNanoAODColumn * charge = static_cast<AliNanoAODColumn*>(fColumns->UncheckedAt(nvars));
+  AliNanoAODColumn * label  = static_cast<AliNanoAODColumn*>(fColumns->UncheckedAt(nvars+1));
+
+  TIter nextTrack(fTracks);
+  AliNanoAODTrack * track = 0;
+  while ((track = static_cast<AliNanoAODTrack*>(nextTrack()))) {
+    for (Int_t ivar = 0; ivar < nvars; ivar++) 
+      static_cast<AliNanoAODColumn*>(fColumns->UncheckedAt(ivar))->Add(track->GetVar(ivar));
+    charge->Add(track->Charge());
+    label ->Add(track->GetLabel());
+  }
+}
 
+//_____________________________________________________________________________
+Int_t AliNanoAODReplicator::GetColumnSetting(const TString & list, const char * var, Int_t def)
+{
+  // Value of var in a comma separated list of var:value, def if var is not in the list
+
+  TObjArray * tokens = list.Tokenize(",");
+  Int_t value = def;
+  TIter next(tokens);
+  TObjString * token = 0;
+  while ((token = static_cast<TObjString*>(next()))) {
+    TString item = token->String().Strip(TString::kBoth);
+    Int_t colon = item.Index(":");
+    if (colon < 0) continue;
+    if (TString(item(0, colon)).Strip(TString::kBoth) == var) {
+      value = TString(item(colon+1, item.Length())).Atoi();
+      break;
+    }
+  }
+  delete tokens;
+  return value;
+}
+
+//_____________________________________________________________________________
+void AliNanoAODReplicator::SetBranchCompression(TTree * tree) const
+{
+  // Apply the compression settings of the columns to their branches
+
+  if (!tree || !fColumns) return;
+  TIter nextColumn(fColumns);
+  AliNanoAODColumn * column = 0;
+  while ((column = static_cast<AliNanoAODColumn*>(nextColumn()))) {
+    if (column->GetCompression() < 0) continue;
+    TBranch * branch = tree->GetBranch(column->GetName());
+    if (!branch) {
+      AliWarning(Form("No branch for column %s", column->GetName()));
+      continue;
+    }
+    branch->SetCompressionSettings(column->GetCompression());
+  }
 }
 
 
@@ -56,6 +56,8 @@ class AliAnalysisTaskSE;
 class AliNanoAODTrack;
 class AliAODTrack;
 class AliNanoAODCustomSetter;
+class TTree;
+class TObjArray;
 
 class TH1F;
 
@@ -88,6 +90,18 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   AliNanoAODCustomSetter * GetCustomSetter() { return fCustomSetter; }
   void  SetCustomSetter (AliNanoAODCustomSetter * var) { fCustomSetter = var;  }
 
+  // Columnar mode: instead of the "tracks" array of AliNanoAODTrack,
+  // one branch "tracks_<var>" per variable of the var list (AliNanoAODColumn),
+  // plus "tracks_charge" and "tracks_label". Must be set before GetList() is called.
+  Bool_t GetColumnar() const { return fColumnar; }
+  void  SetColumnar (Bool_t var = kTRUE) { fColumnar = var; }
+  // Comma separated "var:bits" list of the mantissa bits kept for each column (default 23, full float precision)
+  void  SetColumnPrecision (const char * var) { fColumnPrecision = var; }
+  // Comma separated "var:settings" list of the compression settings of each column branch (default: the tree settings)
+  void  SetColumnCompression (const char * var) { fColumnCompression = var; }
+  // Apply the compression settings of the columns to their branches in tree
+  void  SetBranchCompression(TTree * tree) const;
+
 
  private:
 
@@ -96,6 +110,8 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   void CreateLabelMap(const AliAODEvent& source);
   Int_t GetNewLabel(Int_t i);
   void FilterMC(const AliAODEvent& source);
+  void FillColumns();
+  static Int_t GetColumnSetting(const TString & list, const char * var, Int_t def);
  
 
  private:
@@ -121,13 +137,18 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
 
   AliNanoAODCustomSetter * fCustomSetter;  // Setter class for custom variables
 
+  Bool_t fColumnar; // write one branch per track variable instead of the tracks array
+  TString fColumnPrecision; // mantissa bits per column ("var:bits,...")
+  TString fColumnCompression; // compression settings per column branch ("var:settings,...")
+  mutable TObjArray* fColumns; //! internal array of the columns (columnar mode), owned by fList
+
  private:
 
   
   AliNanoAODReplicator(const AliNanoAODReplicator&);
   AliNanoAODReplicator& operator=(const AliNanoAODReplicator&);
   
-  ClassDef(AliNanoAODReplicator,1) // Branch replicator for ESD to muon AOD.
+  ClassDef(AliNanoAODReplicator,2) // Branch replicator for ESD to muon AOD.
 };
 
 #endif
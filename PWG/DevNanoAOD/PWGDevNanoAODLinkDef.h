@@ -7,6 +7,8 @@
 #pragma link C++ class AliAnalysisTaskNanoAODFilter+;
 #pragma link C++ class AliNanoAODTrack+;
 #pragma link C++ class AliNanoAODCustomSetter+;
+#pragma link C++ class AliNanoAODColumn+;
+#pragma link C++ class AliNanoAODInputHandler+;
 #pragma link C++ class AliAnalysisNanoAODTrackCuts+;
 #pragma link C++ class AliAnalysisNanoAODEventCuts+;
 #pragma link C++ class AliNanoAODSimpleSetter+;         
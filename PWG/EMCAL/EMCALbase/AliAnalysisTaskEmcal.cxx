@@ -35,10 +35,12 @@
 #include "AliEmcalDownscaleFactorsOCDB.h"
 #include "AliEMCALGeometry.h"
 #include "AliEmcalPythiaInfo.h"
+#include "AliEmcalPythiaCrossSectionCache.h"
 #include "AliEMCALTriggerPatchInfo.h"
 #include "AliESDEvent.h"
 #include "AliAODInputHandler.h"
 #include "AliESDInputHandler.h"
+#include "AliEventCuts.h"
 #include "AliEventplane.h"
 #include "AliGenPythiaEventHeader.h"
 #include "AliInputEventHandler.h"
@@ -48,6 +50,7 @@
 #include "AliMultiInputEventHandler.h"
 #include "AliMultSelection.h"
 #include "AliStack.h"
+#include "AliTaskTimingProfile.h"
 #include "AliVCaloTrigger.h"
 #include "AliVCluster.h"
 #include "AliVEventHandler.h"
@@ -57,6 +60,12 @@ Double_t AliAnalysisTaskEmcal::fgkEMCalDCalPhiDivide = 4.;
 
 /// \cond CLASSIMP
 ClassImp(AliAnalysisTaskEmcal);
+
+const TClonesArray *AliAnalysisTaskEmcal::fgTriggerListPatches = nullptr;
+const AliVEvent *AliAnalysisTaskEmcal::fgTriggerListEvent = nullptr;
+Long64_t AliAnalysisTaskEmcal::fgTriggerListEntry = -1;
+Int_t AliAnalysisTaskEmcal::fgTriggerListNPatches = -1;
+ULong_t AliAnalysisTaskEmcal::fgTriggerList = 0;
 /// \endcond
 
 /**
@@ -67,6 +76,7 @@ AliAnalysisTaskEmcal::AliAnalysisTaskEmcal() :
   fPythiaInfoName(""),
   fForceBeamType(kNA),
   fGeneralHistograms(kFALSE),
+  fGeneralHistogramsDownscale(1),
   fLocalInitialized(kFALSE),
   fCreateHisto(kTRUE),
   fCaloCellsName(),
@@ -108,12 +118,15 @@ AliAnalysisTaskEmcal::AliAnalysisTaskEmcal() :
   fUseNewCentralityEstimation(kFALSE),
   fGeneratePythiaInfoObject(kFALSE),
   fUsePtHardBinScaling(kFALSE),
+  fNumberOfMergeThreads(1),
   fMCRejectFilter(kFALSE),
   fCountDownscaleCorrectedEvents(kFALSE),
+  fDoTiming(kFALSE),
   fPtHardAndJetPtFactor(0.),
   fPtHardAndClusterPtFactor(0.),
   fPtHardAndTrackPtFactor(0.),
   fRunNumber(-1),
+  fQASampledEvent(kTRUE),
   fAliAnalysisUtils(nullptr),
   fIsEsd(kFALSE),
   fGeom(nullptr),
@@ -150,7 +163,10 @@ AliAnalysisTaskEmcal::AliAnalysisTaskEmcal() :
   fHistEventPlane(nullptr),
   fHistEventRejection(nullptr),
   fHistTriggerClasses(nullptr),
-  fHistTriggerClassesCorr(nullptr)
+  fHistTriggerClassesCorr(nullptr),
+  fTimingProfile(nullptr),
+  fTrigClassTokens(nullptr),
+  fTrigClassTokenized()
 {
   fVertex[0] = 0;
   fVertex[1] = 0;
@@ -178,6 +194,7 @@ AliAnalysisTaskEmcal::AliAnalysisTaskEmcal(const char *name, Bool_t histo) :
   fPythiaInfoName(""),
   fForceBeamType(kNA),
   fGeneralHistograms(kFALSE),
+  fGeneralHistogramsDownscale(1),
   fLocalInitialized(kFALSE),
   fCreateHisto(histo),
   fCaloCellsName(),
@@ -219,12 +236,15 @@ AliAnalysisTaskEmcal::AliAnalysisTaskEmcal(const char *name, Bool_t histo) :
   fUseNewCentralityEstimation(kFALSE),
   fGeneratePythiaInfoObject(kFALSE),
   fUsePtHardBinScaling(kFALSE),
+  fNumberOfMergeThreads(1),
   fMCRejectFilter(kFALSE),
   fCountDownscaleCorrectedEvents(kFALSE),
+  fDoTiming(kFALSE),
   fPtHardAndJetPtFactor(0.),
   fPtHardAndClusterPtFactor(0.),
   fPtHardAndTrackPtFactor(0.),
   fRunNumber(-1),
+  fQASampledEvent(kTRUE),
   fAliAnalysisUtils(nullptr),
   fIsEsd(kFALSE),
   fGeom(nullptr),
@@ -261,7 +281,10 @@ AliAnalysisTaskEmcal::AliAnalysisTaskEmcal(const char *name, Bool_t histo) :
   fHistEventPlane(nullptr),
   fHistEventRejection(nullptr),
   fHistTriggerClasses(nullptr),
-  fHistTriggerClassesCorr(nullptr)
+  fHistTriggerClassesCorr(nullptr),
+  fTimingProfile(nullptr),
+  fTrigClassTokens(nullptr),
+  fTrigClassTokenized()
 {
   fVertex[0] = 0;
   fVertex[1] = 0;
@@ -282,6 +305,8 @@ AliAnalysisTaskEmcal::AliAnalysisTaskEmcal(const char *name, Bool_t histo) :
  */
 AliAnalysisTaskEmcal::~AliAnalysisTaskEmcal()
 {
+  delete fTimingProfile;
+  delete fTrigClassTokens;
 }
 
 /**
@@ -400,8 +425,19 @@ void AliAnalysisTaskEmcal::UserCreateOutputObjects()
   OpenFile(1);
   fOutput = new AliEmcalList();
   fOutput->SetUseScaling(fUsePtHardBinScaling);
+  fOutput->SetNumberOfMergeThreads(fNumberOfMergeThreads);
   fOutput->SetOwner();
 
+  if (fDoTiming) {
+    // the order of the regions is the one of ETimingRegion_t
+    fTimingProfile = new AliTaskTimingProfile("Timing");
+    fTimingProfile->AddRegion("UserExec");
+    fTimingProfile->AddRegion("RetrieveEventObjects");
+    fTimingProfile->AddRegion("Run");
+    fTimingProfile->AddRegion("FillHistograms");
+    fTimingProfile->Init(fOutput);
+  }
+
   if (fForceBeamType == kpp)
     fNcentBins = 1;
 
@@ -535,6 +571,15 @@ void AliAnalysisTaskEmcal::UserCreateOutputObjects()
  * In any case the vertex distribution is filled as general
  * histograms. For heavy ion collisions also the centrality
  * distribution and the event plane distribution are filled.
+ *
+ * With SetGeneralHistogramsDownscale(n) the QA distributions (vertex,
+ * centrality, event plane, pt hard, trigger classes) are filled for
+ * one event out of n, weighted by n. The events are chosen on a hash
+ * of the event id, the same for all the wagons of the train (see
+ * AliEventCuts::IsSampledEvent). The normalisation histograms (events,
+ * trials and cross section after selection, downscale-corrected
+ * trigger classes) are filled for all the events. Derived classes
+ * can skip their own QA in the same events with IsQASampledEvent().
  * @return Always true
  */
 Bool_t AliAnalysisTaskEmcal::FillGeneralHistograms()
@@ -543,21 +588,25 @@ Bool_t AliAnalysisTaskEmcal::FillGeneralHistograms()
     fHistEventsAfterSel->Fill(fPtHardBin, 1);
     fHistTrialsAfterSel->Fill(fPtHardBin, fNTrials);
     fHistXsectionAfterSel->Fill(fPtHardBin, fXsection);
-    fHistPtHard->Fill(fPtHard);
   }
 
-  fHistZVertex->Fill(fVertex[2]);
+  if (fQASampledEvent) {
+    const Double_t w = GetQAWeight();
+    if (fIsPythia) fHistPtHard->Fill(fPtHard, w);
 
-  if (fForceBeamType != kpp) {
-    fHistCentrality->Fill(fCent);
-    fHistEventPlane->Fill(fEPV0);
-  }
+    fHistZVertex->Fill(fVertex[2], w);
+
+    if (fForceBeamType != kpp) {
+      fHistCentrality->Fill(fCent, w);
+      fHistEventPlane->Fill(fEPV0, w);
+    }
 
-  std::unique_ptr<TObjArray> triggerClasses(InputEvent()->GetFiredTriggerClasses().Tokenize(" "));
-  TObjString* triggerClass(nullptr);
-  for(auto trg : *triggerClasses){
-    triggerClass = static_cast<TObjString*>(trg);
-    fHistTriggerClasses->Fill(triggerClass->GetString(), 1);
+    std::unique_ptr<TObjArray> triggerClasses(InputEvent()->GetFiredTriggerClasses().Tokenize(" "));
+    TObjString* triggerClass(nullptr);
+    for(auto trg : *triggerClasses){
+      triggerClass = static_cast<TObjString*>(trg);
+      fHistTriggerClasses->Fill(triggerClass->GetString(), w);
+    }
   }
 
   if(fCountDownscaleCorrectedEvents){
@@ -566,9 +615,9 @@ Bool_t AliAnalysisTaskEmcal::FillGeneralHistograms()
     if(InputEvent()->GetFiredTriggerClasses().Contains(fMinBiasRefTrigger)){
       AliEmcalDownscaleFactorsOCDB *downscalefactors = AliEmcalDownscaleFactorsOCDB::Instance();
       Double_t downscaleref = downscalefactors->GetDownscaleFactorForTriggerClass(fMinBiasRefTrigger);
-      for(auto t : downscalefactors->GetTriggerClasses()){
-        Double_t downscaletrg = downscalefactors->GetDownscaleFactorForTriggerClass(t);
-        fHistTriggerClassesCorr->Fill(t, downscaletrg/downscaleref);
+      for(Int_t itrg = 0; itrg < downscalefactors->GetNumberOfTriggerClasses(); itrg++){
+        Double_t downscaletrg = downscalefactors->GetDownscaleFactorForIndex(itrg);
+        fHistTriggerClassesCorr->Fill(downscalefactors->GetTriggerClassName(itrg), downscaletrg/downscaleref);
       }
     }
   }
@@ -593,10 +642,15 @@ Bool_t AliAnalysisTaskEmcal::FillGeneralHistograms()
  * in the functions ExecOnce. Note that this is only done for the first event
  * and only for properties which need the presence of an input event.
  *
+ * With SetDoTiming() the real time of the full UserExec, of RetrieveEventObjects,
+ * Run and FillHistograms is filled in the profile hTimingRealTime of the output.
+ *
  * @param[in] option Not used
  */
 void AliAnalysisTaskEmcal::UserExec(Option_t *option)
 {
+  AliTaskTimingProfile::Scope timingUserExec(fTimingProfile, kTimingUserExec);
+
   if (!fLocalInitialized){
     ExecOnce();
     UserExecOnce();
@@ -605,7 +659,12 @@ void AliAnalysisTaskEmcal::UserExec(Option_t *option)
   if (!fLocalInitialized)
     return;
 
-  if (!RetrieveEventObjects())
+  Bool_t retrieved = kFALSE;
+  {
+    AliTaskTimingProfile::Scope timing(fTimingProfile, kTimingRetrieveEventObjects);
+    retrieved = RetrieveEventObjects();
+  }
+  if (!retrieved)
     return;
 
   if(InputEvent()->GetRunNumber() != fRunNumber){
@@ -622,16 +681,28 @@ void AliAnalysisTaskEmcal::UserExec(Option_t *option)
     return;
   }
 
+  fQASampledEvent = (fGeneralHistogramsDownscale <= 1 || AliEventCuts::IsSampledEvent(InputEvent(), fGeneralHistogramsDownscale));
+
   if (fGeneralHistograms && fCreateHisto) {
     if (!FillGeneralHistograms())
       return;
   }
 
-  if (!Run())
+  Bool_t selected = kFALSE;
+  {
+    AliTaskTimingProfile::Scope timing(fTimingProfile, kTimingRun);
+    selected = Run();
+  }
+  if (!selected)
     return;
 
   if (fCreateHisto) {
-    if (!FillHistograms())
+    Bool_t filled = kFALSE;
+    {
+      AliTaskTimingProfile::Scope timing(fTimingProfile, kTimingFillHistograms);
+      filled = FillHistograms();
+    }
+    if (!filled)
       return;
   }
 
@@ -728,34 +799,8 @@ Bool_t AliAnalysisTaskEmcal::PythiaInfoFromFile(const char* currFile, Float_t &f
   else 
     AliWarning(Form("Could not extract file number from path %s", strPthard.Data()));
 
-  // problem that we cannot really test the existance of a file in a archive so we have to live with open error message from root
-  std::unique_ptr<TFile> fxsec(TFile::Open(Form("%s%s",file.Data(),"pyxsec.root")));
-
-  if (!fxsec) {
-    // next trial fetch the histgram file
-    fxsec = std::unique_ptr<TFile>(TFile::Open(Form("%s%s",file.Data(),"pyxsec_hists.root")));
-    if (!fxsec) return kFALSE; // not a severe condition but inciate that we have no information
-    else {
-      // find the tlist we want to be independtent of the name so use the Tkey
-      TKey* key = (TKey*)fxsec->GetListOfKeys()->At(0); 
-      if (!key) return kFALSE;
-      TList *list = dynamic_cast<TList*>(key->ReadObj());
-      if (!list) return kFALSE;
-      fXsec = ((TProfile*)list->FindObject("h1Xsec"))->GetBinContent(1);
-      fTrials  = ((TH1F*)list->FindObject("h1Trials"))->GetBinContent(1);
-    }
-  } else { // no tree pyxsec.root
-    TTree *xtree = (TTree*)fxsec->Get("Xsection");
-    if (!xtree) return kFALSE;
-    UInt_t   ntrials  = 0;
-    Double_t  xsection  = 0;
-    xtree->SetBranchAddress("xsection",&xsection);
-    xtree->SetBranchAddress("ntrials",&ntrials);
-    xtree->GetEntry(0);
-    fTrials = ntrials;
-    fXsec = xsection;
-  }
-  return kTRUE;
+  // The cross section file is shared by all tasks in the train, read it only once
+  return AliEmcalPythiaCrossSectionCache::Instance()->GetCrossSectionAndTrials(file, fXsec, fTrials);
 }
 
 /**
@@ -968,6 +1013,15 @@ ULong_t AliAnalysisTaskEmcal::GetTriggerList()
   //number of patches in event
   Int_t nPatch = fTriggerPatchInfo->GetEntries();
 
+  // The list depends only on the patches: it is shared by the tasks
+  // reading the same patch array in the same event
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  Long64_t entry = mgr ? mgr->GetCurrentEntry() : -1;
+  if (entry >= 0 && fgTriggerListPatches == fTriggerPatchInfo && fgTriggerListEvent == InputEvent() &&
+      fgTriggerListEntry == entry && fgTriggerListNPatches == nPatch) {
+    return fgTriggerList;
+  }
+
   //loop over patches to define trigger type of event
   Int_t nG1 = 0;
   Int_t nG2 = 0;
@@ -995,6 +1049,14 @@ ULong_t AliAnalysisTaskEmcal::GetTriggerList()
   if (nG2>0) SETBIT(triggers, kG2);
   if (nJ1>0) SETBIT(triggers, kJ1);
   if (nJ2>0) SETBIT(triggers, kJ2);
+
+  if (entry >= 0) {
+    fgTriggerListPatches = fTriggerPatchInfo;
+    fgTriggerListEvent = InputEvent();
+    fgTriggerListEntry = entry;
+    fgTriggerListNPatches = nPatch;
+    fgTriggerList = triggers;
+  }
   return triggers;
 }
 
@@ -1074,7 +1136,13 @@ Bool_t AliAnalysisTaskEmcal::IsEventSelected()
       return kFALSE;
     }
 
-    std::unique_ptr<TObjArray> arr(fTrigClass.Tokenize("|"));
+    // the requested classes are tokenized once, not in each event
+    if (!fTrigClassTokens || fTrigClassTokenized != fTrigClass) {
+      delete fTrigClassTokens;
+      fTrigClassTokens = fTrigClass.Tokenize("|");
+      fTrigClassTokenized = fTrigClass;
+    }
+    TObjArray *arr = fTrigClassTokens;
     if (!arr) {
       if (fGeneralHistograms) fHistEventRejection->Fill("trigger",1);
       return kFALSE;
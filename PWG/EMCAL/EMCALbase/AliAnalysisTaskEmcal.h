@@ -21,6 +21,7 @@ class AliAODTrack;
 class AliEmcalPythiaInfo;
 class AliAODInputHandler;
 class AliESDInputHandler;
+class AliTaskTimingProfile;
 
 #include "Rtypes.h"
 
@@ -122,6 +123,17 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
     kOverlapWithLowThreshold   //!< The overlap between low and high threshold trigger is assigned to the lower threshold only
   };
 
+  /**
+   * \enum ETimingRegion_t
+   * \brief Regions of UserExec timed with SetDoTiming(), derived tasks add theirs with GetTimingProfile()->AddRegion()
+   */
+  enum ETimingRegion_t {
+    kTimingUserExec = 0,          //!< Full UserExec
+    kTimingRetrieveEventObjects,  //!< RetrieveEventObjects()
+    kTimingRun,                   //!< Run()
+    kTimingFillHistograms         //!< FillHistograms()
+  };
+
   AliAnalysisTaskEmcal();
   AliAnalysisTaskEmcal(const char *name, Bool_t histo=kFALSE);
   virtual ~AliAnalysisTaskEmcal();
@@ -157,6 +169,7 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
   void                        SetIsEmbedded(Bool_t i)                               { fIsEmbedded        = i                              ; }
   void                        SetIsPythia(Bool_t i)                                 { fIsPythia          = i                              ; }
   void                        SetMakeGeneralHistograms(Bool_t g)                    { fGeneralHistograms = g                              ; }
+  void                        SetGeneralHistogramsDownscale(Int_t n)                { fGeneralHistogramsDownscale = n                     ; }
   void                        SetMCLabelShift(Int_t s)                              { fMCLabelShift      = s                              ; }
   void                        SetMinMCLabel(Int_t s)                                { fMinMCLabel        = s                              ; }
   void                        SetMinNTrack(Int_t min)                               { fMinNTrack         = min                            ; }
@@ -165,6 +178,7 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
   virtual void                SetNCentBins(Int_t n)                                 { fNcentBins         = n                              ; }
   void                        SetNeedEmcalGeom(Bool_t n)                            { fNeedEmcalGeom     = n                              ; }
   void                        SetCountDownscaleCorrectedEvents(Bool_t d)            { fCountDownscaleCorrectedEvents =  d                 ; }
+  void                        SetDoTiming(Bool_t b=kTRUE)                           { fDoTiming          = b                              ; }
   void                        SetOffTrigger(UInt_t t)                               { fOffTrigger        = t                              ; }
   void                        SetTrackEtaLimits(Double_t min, Double_t max, Int_t c=0);
   void                        SetTrackPhiLimits(Double_t min, Double_t max, Int_t c=0);
@@ -182,6 +196,7 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
   const TString&              GetPythiaInfoName()                             const { return fPythiaInfoName                              ; }
   const AliEmcalPythiaInfo   *GetPythiaInfo()                                 const { return fPythiaInfo                                  ; }
   void                        SetUsePtHardBinScaling(Bool_t b)                      { fUsePtHardBinScaling = b                            ; }
+  void                        SetNumberOfMergeThreads(Int_t n)                      { fNumberOfMergeThreads = n                           ; }
   void                        SetMCFilter()                                         { fMCRejectFilter = kTRUE                             ; }
   void                        ResetMCFilter()                                       { fMCRejectFilter = kFALSE                            ; }
   void                        SetJetPtFactor(Float_t f)                             { fPtHardAndJetPtFactor = f                           ; }
@@ -196,6 +211,7 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
   static AliESDInputHandler*  AddESDHandler();
 
  protected:
+  AliTaskTimingProfile       *GetTimingProfile()                                    const { return fTimingProfile ; }
   void                        LoadPythiaInfo(AliVEvent *event);
   void                        SetRejectionReasonLabels(TAxis* axis);
   Bool_t                      AcceptCluster(AliVCluster *clus, Int_t c = 0)      const;
@@ -226,6 +242,8 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
   // Virtual functions, to be overloaded in derived classes
   virtual void                ExecOnce();
   virtual Bool_t              FillGeneralHistograms();
+  Bool_t                      IsQASampledEvent()                              const { return fQASampledEvent; }
+  Double_t                    GetQAWeight()                                   const { return fGeneralHistogramsDownscale > 1 ? fGeneralHistogramsDownscale : 1.; }
   virtual Bool_t              IsEventSelected();
   virtual Bool_t              RetrieveEventObjects();
 
@@ -275,6 +293,7 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
   TString                     fPythiaInfoName;             ///< name of pythia info object
   BeamType                    fForceBeamType;              ///< forced beam type
   Bool_t                      fGeneralHistograms;          ///< whether or not it should fill some general histograms
+  Int_t                       fGeneralHistogramsDownscale; ///< fill the general QA histograms for 1 event out of n (AliEventCuts::IsSampledEvent), weighted by n
   Bool_t                      fLocalInitialized;           ///< whether or not the task has been already initialized
   Bool_t                      fCreateHisto;                ///< whether or not create histograms
   TString                     fCaloCellsName;              ///< name of calo cell collection
@@ -316,14 +335,17 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
   Bool_t                      fUseNewCentralityEstimation; ///< Use new centrality estimation (for 2015 data)
   Bool_t                      fGeneratePythiaInfoObject;   ///< Generate Pythia info object
   Bool_t                      fUsePtHardBinScaling;        ///< Use pt hard bin scaling in merging
+  Int_t                       fNumberOfMergeThreads;       ///< Threads for the last level of the scaled merging (see AliEmcalList)
   Bool_t                      fMCRejectFilter;             ///< enable the filtering of events by tail rejection
   Bool_t                      fCountDownscaleCorrectedEvents; ///< Count event number corrected for downscaling
+  Bool_t                      fDoTiming;                   ///< Fill the real time per call of the regions of UserExec in the output
   Float_t                     fPtHardAndJetPtFactor;       ///< Factor between ptHard and jet pT to reject/accept event.
   Float_t                     fPtHardAndClusterPtFactor;   ///< Factor between ptHard and cluster pT to reject/accept event.
   Float_t                     fPtHardAndTrackPtFactor;     ///< Factor between ptHard and track pT to reject/accept event.
 
   // Service fields
   Int_t                       fRunNumber;                  //!<!run number (triggering RunChanged()
+  Bool_t                      fQASampledEvent;             //!<!the general QA histograms are filled for this event, see fGeneralHistogramsDownscale
   AliAnalysisUtils           *fAliAnalysisUtils;           //!<!vertex selection (optional)
   Bool_t                      fIsEsd;                      //!<!whether it's an ESD analysis
   AliEMCALGeometry           *fGeom;                       //!<!emcal geometry
@@ -365,13 +387,22 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
   TH1                        *fHistEventRejection;         //!<!book keep reasons for rejecting event
   TH1                        *fHistTriggerClasses;         //!<!number of events in each trigger class
   TH1                        *fHistTriggerClassesCorr;     //!<!corrected number of events in each trigger class
+  AliTaskTimingProfile       *fTimingProfile;              //!<!timing of the regions of UserExec (only with fDoTiming)
+  TObjArray                  *fTrigClassTokens;            //!<!trigger classes of fTrigClass, tokenized once
+  TString                     fTrigClassTokenized;         //!<!value of fTrigClass when fTrigClassTokens was filled
 
  private:
   AliAnalysisTaskEmcal(const AliAnalysisTaskEmcal&);            // not implemented
   AliAnalysisTaskEmcal &operator=(const AliAnalysisTaskEmcal&); // not implemented
 
+  static const TClonesArray  *fgTriggerListPatches;        //!<!patch array of the cached trigger list
+  static const AliVEvent     *fgTriggerListEvent;          //!<!input event of the cached trigger list
+  static Long64_t             fgTriggerListEntry;          //!<!analysis manager entry of the cached trigger list
+  static Int_t                fgTriggerListNPatches;       //!<!number of patches of the cached trigger list
+  static ULong_t              fgTriggerList;               //!<!trigger list shared by the tasks of the event
+
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskEmcal, 15) // EMCAL base analysis task
+  ClassDef(AliAnalysisTaskEmcal, 19) // EMCAL base analysis task
   /// \endcond
 };
 
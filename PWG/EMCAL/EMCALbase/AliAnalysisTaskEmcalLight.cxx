@@ -30,6 +30,7 @@
 #include "AliEMCALGeometry.h"
 #include "AliESDEvent.h"
 #include "AliEmcalParticle.h"
+#include "AliEmcalPythiaCrossSectionCache.h"
 #include "AliEventplane.h"
 #include "AliInputEventHandler.h"
 #include "AliLog.h"
@@ -523,47 +524,8 @@ Bool_t AliAnalysisTaskEmcalLight::PythiaInfoFromFile(const char* currFile, Float
   else 
     AliWarning(Form("Could not extract file number from path %s", strPthard.Data()));
 
-  // problem that we cannot really test the existance of a file in a archive so we have to live with open error message from root
-  TFile *fxsec = TFile::Open(Form("%s%s",file.Data(),"pyxsec.root")); 
-
-  if (!fxsec) {
-    // next trial fetch the histgram file
-    fxsec = TFile::Open(Form("%s%s",file.Data(),"pyxsec_hists.root"));
-    if (!fxsec) {
-      // not a severe condition but inciate that we have no information
-      return kFALSE;
-    } else {
-      // find the tlist we want to be independtent of the name so use the Tkey
-      TKey* key = (TKey*)fxsec->GetListOfKeys()->At(0); 
-      if (!key) {
-        fxsec->Close();
-        return kFALSE;
-      }
-      TList *list = dynamic_cast<TList*>(key->ReadObj());
-      if (!list) {
-        fxsec->Close();
-        return kFALSE;
-      }
-      fXsec = ((TProfile*)list->FindObject("h1Xsec"))->GetBinContent(1);
-      fTrials  = ((TH1F*)list->FindObject("h1Trials"))->GetBinContent(1);
-      fxsec->Close();
-    }
-  } else { // no tree pyxsec.root
-    TTree *xtree = (TTree*)fxsec->Get("Xsection");
-    if (!xtree) {
-      fxsec->Close();
-      return kFALSE;
-    }
-    UInt_t   ntrials  = 0;
-    Double_t  xsection  = 0;
-    xtree->SetBranchAddress("xsection",&xsection);
-    xtree->SetBranchAddress("ntrials",&ntrials);
-    xtree->GetEntry(0);
-    fTrials = ntrials;
-    fXsec = xsection;
-    fxsec->Close();
-  }
-  return kTRUE;
+  // The cross section file is shared by all tasks in the train, read it only once
+  return AliEmcalPythiaCrossSectionCache::Instance()->GetCrossSectionAndTrials(file, fXsec, fTrials);
 }
 
 /**
@@ -0,0 +1,312 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <algorithm>
+
+#include <TClonesArray.h>
+#include <TMath.h>
+#include <TVector2.h>
+#include <TVector3.h>
+
+#include "AliAnalysisManager.h"
+#include "AliEmcalClusterTrackMatchTable.h"
+#include "AliInputEventHandler.h"
+#include "AliVCluster.h"
+#include "AliVEvent.h"
+#include "AliVTrack.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalClusterTrackMatchTable)
+/// \endcond
+
+std::vector<AliEmcalClusterTrackMatchTable*> AliEmcalClusterTrackMatchTable::fgTables;
+
+/**
+ * Private constructor, use Get()
+ * \param tracks Track array
+ * \param clusters Cluster array
+ */
+AliEmcalClusterTrackMatchTable::AliEmcalClusterTrackMatchTable(const TClonesArray* tracks, const TClonesArray* clusters) :
+  TObject(),
+  fTrackArray(tracks),
+  fClusterArray(clusters),
+  fEvent(0),
+  fEntry(-1),
+  fMaxDistance(-1),
+  fTracks(),
+  fTrackEta(),
+  fTrackPhi(),
+  fClusters(),
+  fClusterPos(),
+  fClusterEta(),
+  fClusterPhi(),
+  fTrackIndex(),
+  fClusterIndex(),
+  fFirstPair(1, 0),
+  fPairCluster(),
+  fPairDeta(),
+  fPairDphi(),
+  fPairEoverP(),
+  fCellFirst(),
+  fCellClusters(),
+  fNBuilds(0)
+{
+}
+
+/**
+ * Destructor
+ */
+AliEmcalClusterTrackMatchTable::~AliEmcalClusterTrackMatchTable()
+{
+  std::vector<AliEmcalClusterTrackMatchTable*>::iterator it = std::find(fgTables.begin(), fgTables.end(), this);
+  if (it != fgTables.end()) fgTables.erase(it);
+}
+
+/**
+ * Access to the table of a pair of arrays
+ * \param tracks Track array, as attached to the track container
+ * \param clusters Cluster array, as attached to the cluster container
+ * \return The table, created at the first call, NULL if an array is missing
+ */
+AliEmcalClusterTrackMatchTable* AliEmcalClusterTrackMatchTable::Get(const TClonesArray* tracks, const TClonesArray* clusters)
+{
+  if (!tracks || !clusters) return 0;
+  for (UInt_t i = 0; i < fgTables.size(); i++) {
+    if (fgTables[i]->fTrackArray == tracks && fgTables[i]->fClusterArray == clusters) return fgTables[i];
+  }
+  fgTables.push_back(new AliEmcalClusterTrackMatchTable(tracks, clusters));
+  return fgTables.back();
+}
+
+/**
+ * Forget the pairs of the current event, the storage is kept
+ */
+void AliEmcalClusterTrackMatchTable::Clear(Option_t* /*option*/)
+{
+  fEvent = 0;
+  fEntry = -1;
+  fMaxDistance = -1;
+  fTracks.clear();
+  fClusters.clear();
+  fTrackIndex.clear();
+  fClusterIndex.clear();
+  fFirstPair.assign(1, 0);
+  fPairCluster.clear();
+  fPairDeta.clear();
+  fPairDphi.clear();
+  fPairEoverP.clear();
+}
+
+/**
+ * Make the table hold the pairs of the current event up to a distance
+ * \param maxDistance Largest \f$\sqrt{\Delta\eta^2+\Delta\phi^2}\f$ the consumer looks at
+ * \return False outside of an analysis manager event loop, the table must not be used then
+ */
+Bool_t AliEmcalClusterTrackMatchTable::Update(Double_t maxDistance)
+{
+  AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+  const Long64_t entry = mgr ? mgr->GetCurrentEntry() : -1;
+  if (entry < 0) {
+    Clear();
+    return kFALSE;
+  }
+  const AliVEvent* ev = mgr->GetInputEventHandler() ? mgr->GetInputEventHandler()->GetEvent() : 0;
+
+  if (entry != fEntry || ev != fEvent) {
+    Build(maxDistance);
+  }
+  else if (fMaxDistance < maxDistance) {
+    Build(maxDistance);
+  }
+  else if (!IsUpToDate()) {
+    // Same event, keep the largest distance asked for so far
+    Build(fMaxDistance);
+  }
+  fEvent = ev;
+  fEntry = entry;
+  return kTRUE;
+}
+
+/**
+ * Check that the arrays still hold the objects the table was built from, at the same positions
+ * \return True if the pairs are valid
+ */
+Bool_t AliEmcalClusterTrackMatchTable::IsUpToDate() const
+{
+  if (fTrackArray->GetEntriesFast() != GetNTracks()) return kFALSE;
+  if (fClusterArray->GetEntriesFast() != GetNClusters()) return kFALSE;
+
+  for (Int_t i = 0; i < GetNTracks(); i++) {
+    const AliVTrack* track = dynamic_cast<const AliVTrack*>(fTrackArray->UncheckedAt(i));
+    if (track != fTracks[i]) return kFALSE;
+    if (!track) continue;
+    Double_t eta = track->GetTrackEtaOnEMCal();
+    Double_t phi = track->GetTrackPhiOnEMCal();
+    // Written this way for the tracks without a position, which can be NaN
+    if (!(eta == fTrackEta[i] || (eta != eta && fTrackEta[i] != fTrackEta[i]))) return kFALSE;
+    if (!(phi == fTrackPhi[i] || (phi != phi && fTrackPhi[i] != fTrackPhi[i]))) return kFALSE;
+  }
+
+  Float_t pos[3] = {0};
+  for (Int_t i = 0; i < GetNClusters(); i++) {
+    const AliVCluster* cluster = dynamic_cast<const AliVCluster*>(fClusterArray->UncheckedAt(i));
+    if (cluster != fClusters[i]) return kFALSE;
+    if (!cluster) continue;
+    cluster->GetPosition(pos);
+    if (pos[0] != fClusterPos[3*i] || pos[1] != fClusterPos[3*i+1] || pos[2] != fClusterPos[3*i+2]) return kFALSE;
+  }
+  return kTRUE;
+}
+
+/**
+ * Find the pairs of all the tracks within a distance
+ * \param maxDistance Largest distance of the pairs
+ */
+void AliEmcalClusterTrackMatchTable::Build(Double_t maxDistance)
+{
+  const Int_t kMaxCells = 1000;  // per axis
+  fNBuilds++;
+  Clear();
+  fMaxDistance = maxDistance;
+  const Double_t maxd2 = maxDistance * maxDistance;
+
+  const Int_t nTracks = fTrackArray->GetEntriesFast();
+  fTracks.resize(nTracks);
+  fTrackEta.resize(nTracks);
+  fTrackPhi.resize(nTracks);
+  for (Int_t i = 0; i < nTracks; i++) {
+    const AliVTrack* track = dynamic_cast<const AliVTrack*>(fTrackArray->UncheckedAt(i));
+    fTracks[i] = track;
+    fTrackEta[i] = track ? track->GetTrackEtaOnEMCal() : 0;
+    fTrackPhi[i] = track ? track->GetTrackPhiOnEMCal() : 0;
+    if (track) fTrackIndex[track] = i;
+  }
+
+  const Int_t nClusters = fClusterArray->GetEntriesFast();
+  fClusters.resize(nClusters);
+  fClusterPos.resize(3 * nClusters);
+  fClusterEta.resize(nClusters);
+  fClusterPhi.resize(nClusters);
+  Double_t etaMin = 0, etaMax = 0;
+  Bool_t first = kTRUE;
+  for (Int_t i = 0; i < nClusters; i++) {
+    const AliVCluster* cluster = dynamic_cast<const AliVCluster*>(fClusterArray->UncheckedAt(i));
+    fClusters[i] = cluster;
+    fClusterEta[i] = fClusterPhi[i] = 0;
+    if (!cluster) continue;
+    fClusterIndex[cluster] = i;
+    Float_t* pos = &fClusterPos[3*i];
+    cluster->GetPosition(pos);
+    // Same as AliAnalysisTaskEmcal::GetEtaPhiDiff
+    TVector3 cpos(pos);
+    fClusterEta[i] = cpos.Eta();
+    fClusterPhi[i] = cpos.Phi();
+    if (first || fClusterEta[i] < etaMin) etaMin = fClusterEta[i];
+    if (first || fClusterEta[i] > etaMax) etaMax = fClusterEta[i];
+    first = kFALSE;
+  }
+
+  // Cells at least as large as the distance, so that the pairs are in the 3x3 cells
+  // around the track. The margin covers the rounding of the cell numbers.
+  const Double_t width = TMath::Max(maxDistance, 1e-3) * 1.001;
+  const Int_t nEta = TMath::Max(1, TMath::Min(Int_t((etaMax - etaMin) / width), kMaxCells));
+  const Double_t etaWidth = TMath::Max(width, (etaMax - etaMin) / nEta);
+  const Int_t nPhi = TMath::Max(1, TMath::Min(Int_t(TMath::TwoPi() / width), kMaxCells));
+  const Double_t phiWidth = TMath::TwoPi() / nPhi;
+
+  std::vector<Int_t> cell(nClusters, -1);
+  fCellFirst.assign(nEta * nPhi + 1, 0);
+  for (Int_t i = 0; i < nClusters; i++) {
+    if (!fClusters[i]) continue;
+    const Int_t ieta = TMath::Min(nEta - 1, Int_t((fClusterEta[i] - etaMin) / etaWidth));
+    const Int_t iphi = TMath::Min(nPhi - 1, TMath::Max(0, Int_t((fClusterPhi[i] + TMath::Pi()) / phiWidth)));
+    cell[i] = ieta * nPhi + iphi;
+    fCellFirst[cell[i] + 1]++;
+  }
+  for (Int_t c = 0; c < nEta * nPhi; c++) fCellFirst[c + 1] += fCellFirst[c];
+  fCellClusters.resize(fCellFirst[nEta * nPhi]);
+  std::vector<Int_t> fill(fCellFirst.begin(), fCellFirst.end() - 1);
+  for (Int_t i = 0; i < nClusters; i++) {
+    if (cell[i] >= 0) fCellClusters[fill[cell[i]]++] = i;
+  }
+
+  std::vector<Int_t> candidates;
+  fFirstPair.assign(nTracks + 1, 0);
+  for (Int_t itrack = 0; itrack < nTracks; itrack++) {
+    fFirstPair[itrack] = fPairCluster.size();
+    const AliVTrack* track = fTracks[itrack];
+    if (!track || fCellClusters.empty()) continue;
+    const Double_t veta = fTrackEta[itrack];
+    const Double_t vphi = fTrackPhi[itrack];
+
+    candidates.clear();
+    if (!TMath::Finite(veta) || !TMath::Finite(vphi)) {
+      // Not comparable, all the clusters are tested as in the full loop
+      for (Int_t icluster = 0; icluster < nClusters; icluster++) {
+        if (fClusters[icluster]) candidates.push_back(icluster);
+      }
+    }
+    else {
+      const Double_t x = (veta - etaMin) / etaWidth;
+      if (x < -1. || x > nEta + 1.) continue;
+      const Int_t ieta = TMath::Min(nEta, Int_t(TMath::Floor(x)));
+      const Int_t iphi = TMath::Min(nPhi - 1, TMath::Max(0, Int_t((TVector2::Phi_mpi_pi(vphi) + TMath::Pi()) / phiWidth)));
+      for (Int_t jeta = TMath::Max(0, ieta - 1); jeta <= TMath::Min(nEta - 1, ieta + 1); jeta++) {
+        const Int_t nCol = nPhi > 3 ? 3 : nPhi;
+        for (Int_t k = 0; k < nCol; k++) {
+          const Int_t jphi = nPhi > 3 ? (iphi - 1 + k + nPhi) % nPhi : k;
+          const Int_t c = jeta * nPhi + jphi;
+          candidates.insert(candidates.end(), fCellClusters.begin() + fCellFirst[c], fCellClusters.begin() + fCellFirst[c + 1]);
+        }
+      }
+      std::sort(candidates.begin(), candidates.end());
+    }
+
+    const Double_t p = track->P();
+    for (UInt_t j = 0; j < candidates.size(); j++) {
+      const Int_t icluster = candidates[j];
+      const Double_t deta = veta - fClusterEta[icluster];
+      const Double_t dphi = TVector2::Phi_mpi_pi(vphi - fClusterPhi[icluster]);
+      const Double_t d2 = deta * deta + dphi * dphi;
+      if (d2 > maxd2) continue;
+      fPairCluster.push_back(icluster);
+      fPairDeta.push_back(deta);
+      fPairDphi.push_back(dphi);
+      fPairEoverP.push_back(p > 0 ? fClusters[icluster]->GetNonLinCorrEnergy() / p : 0.);
+    }
+  }
+  fFirstPair[nTracks] = fPairCluster.size();
+}
+
+/**
+ * Index of a track in the table
+ * \param track Track of the track array
+ * \return Index of the track, -1 if not in the array
+ */
+Int_t AliEmcalClusterTrackMatchTable::FindTrack(const AliVTrack* track) const
+{
+  std::map<const AliVTrack*, Int_t>::const_iterator it = fTrackIndex.find(track);
+  return it != fTrackIndex.end() ? it->second : -1;
+}
+
+/**
+ * Index of a cluster in the table
+ * \param cluster Cluster of the cluster array
+ * \return Index of the cluster, -1 if not in the array
+ */
+Int_t AliEmcalClusterTrackMatchTable::FindCluster(const AliVCluster* cluster) const
+{
+  std::map<const AliVCluster*, Int_t>::const_iterator it = fClusterIndex.find(cluster);
+  return it != fClusterIndex.end() ? it->second : -1;
+}
@@ -0,0 +1,96 @@
+#ifndef ALIEMCALCLUSTERTRACKMATCHTABLE_H
+#define ALIEMCALCLUSTERTRACKMATCHTABLE_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <map>
+#include <vector>
+#include <TObject.h>
+
+class TClonesArray;
+class AliVCluster;
+class AliVEvent;
+class AliVTrack;
+
+/**
+ * \class AliEmcalClusterTrackMatchTable
+ * \brief Process wide per event table of the cluster-track pairs close on the EMCal surface
+ * \ingroup EMCALCOREFW
+ * \since Oct 14, 2016
+ *
+ * One table exists per pair of track and cluster arrays. It holds, for each
+ * track of the array, the clusters within the largest distance requested in
+ * the event, with \f$\Delta\eta\f$, \f$\Delta\phi\f$ computed as in
+ * AliAnalysisTaskEmcal::GetEtaPhiDiff and E/p. The pairs are found with a
+ * binned (\f$\eta\f$, \f$\phi\f$) index of the clusters instead of a loop over
+ * all the clusters for each track. The pairs of a track are ordered as the
+ * clusters in the array, so that a consumer applying its own window gets the
+ * same matches in the same order as with the full loop.
+ *
+ * The table is bound to the input event and the entry of the analysis manager.
+ * It is rebuilt when the event changes, when a larger distance is requested, or
+ * when the position on the EMCal surface of a track or the position of a cluster
+ * changed since it was built (propagation or reclusterization in between).
+ * Outside of an event loop Update() fails and the consumers do the full loop.
+ */
+class AliEmcalClusterTrackMatchTable : public TObject {
+public:
+  static AliEmcalClusterTrackMatchTable* Get(const TClonesArray* tracks, const TClonesArray* clusters);
+  virtual ~AliEmcalClusterTrackMatchTable();
+
+  Bool_t   Update(Double_t maxDistance);
+  virtual void Clear(Option_t* option="");
+
+  Int_t    FindTrack(const AliVTrack* track) const;
+  Int_t    FindCluster(const AliVCluster* cluster) const;
+
+  Int_t    GetNTracks()                const { return fTracks.size()                         ; }
+  Int_t    GetNClusters()              const { return fClusters.size()                       ; }
+  Int_t    GetFirstPair(Int_t itrack)  const { return fFirstPair[itrack]                     ; }
+  Int_t    GetNPairs(Int_t itrack)     const { return fFirstPair[itrack+1] - fFirstPair[itrack]; }
+  Int_t    GetPairCluster(Int_t ipair) const { return fPairCluster[ipair]                    ; }
+  Double_t GetPairDeta(Int_t ipair)    const { return fPairDeta[ipair]                       ; }
+  Double_t GetPairDphi(Int_t ipair)    const { return fPairDphi[ipair]                       ; }
+  Double_t GetPairEoverP(Int_t ipair)  const { return fPairEoverP[ipair]                     ; }
+  Double_t GetMaxDistance()            const { return fMaxDistance                           ; }
+  Long64_t GetNBuilds()                const { return fNBuilds                               ; }
+
+private:
+  AliEmcalClusterTrackMatchTable(const TClonesArray* tracks, const TClonesArray* clusters);
+  AliEmcalClusterTrackMatchTable(const AliEmcalClusterTrackMatchTable& table);
+  AliEmcalClusterTrackMatchTable& operator=(const AliEmcalClusterTrackMatchTable& table);
+
+  Bool_t   IsUpToDate() const;
+  void     Build(Double_t maxDistance);
+
+  const TClonesArray*                  fTrackArray;      //!<! Tracks of the table
+  const TClonesArray*                  fClusterArray;    //!<! Clusters of the table
+  const AliVEvent*                     fEvent;           //!<! Input event of the table
+  Long64_t                             fEntry;           //!<! Analysis manager entry of the table
+  Double_t                             fMaxDistance;     //!<! Distance used to build the table, negative if not built
+  std::vector<const AliVTrack*>        fTracks;          //!<! Track at each index of the array, NULL if not a track
+  std::vector<Double_t>                fTrackEta;        //!<! Track eta on the EMCal surface
+  std::vector<Double_t>                fTrackPhi;        //!<! Track phi on the EMCal surface
+  std::vector<const AliVCluster*>      fClusters;        //!<! Cluster at each index of the array
+  std::vector<Float_t>                 fClusterPos;      //!<! Cluster positions, 3 per cluster
+  std::vector<Double_t>                fClusterEta;      //!<! Cluster eta
+  std::vector<Double_t>                fClusterPhi;      //!<! Cluster phi
+  std::map<const AliVTrack*, Int_t>    fTrackIndex;      //!<! Index of each track
+  std::map<const AliVCluster*, Int_t>  fClusterIndex;    //!<! Index of each cluster
+  std::vector<Int_t>                   fFirstPair;       //!<! First pair of each track, one more entry for the end
+  std::vector<Int_t>                   fPairCluster;     //!<! Cluster index of each pair
+  std::vector<Double_t>                fPairDeta;        //!<! Track minus cluster eta of each pair
+  std::vector<Double_t>                fPairDphi;        //!<! Track minus cluster phi of each pair, in [-pi, pi]
+  std::vector<Double_t>                fPairEoverP;      //!<! Non linearity corrected cluster energy over track momentum
+  std::vector<Int_t>                   fCellFirst;       //!<! First cluster of each cell of the index, one more entry for the end
+  std::vector<Int_t>                   fCellClusters;    //!<! Clusters ordered by cell
+  Long64_t                             fNBuilds;         //!<! Number of builds
+
+  static std::vector<AliEmcalClusterTrackMatchTable*> fgTables; //!<! The tables of this process
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalClusterTrackMatchTable, 0);
+  /// \endcond
+};
+
+#endif /* ALIEMCALCLUSTERTRACKMATCHTABLE_H */
@@ -48,10 +48,12 @@ AliEmcalContainer::AliEmcalContainer():
   fMinMCLabel(-1),
   fMaxMCLabel(-1),
   fMassHypothesis(-1),
+  fUseAcceptanceCache(kFALSE),
   fClArray(0),
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fAcceptanceCache(),
   fClassName()
 {
   fVertex[0] = 0;
@@ -84,10 +86,12 @@ AliEmcalContainer::AliEmcalContainer(const char *name):
   fMinMCLabel(-1),
   fMaxMCLabel(-1),
   fMassHypothesis(-1),
+  fUseAcceptanceCache(kFALSE),
   fClArray(0),
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fAcceptanceCache(),
   fClassName()
 {
   fVertex[0] = 0;
@@ -128,6 +132,8 @@ void AliEmcalContainer::SetClassName(const char *clname)
  */
 void AliEmcalContainer::SetArray(const AliVEvent *event)
 {
+  InvalidateAcceptanceCache();
+
   const AliVVertex *vertex = event->GetPrimaryVertex();
   if (vertex) vertex->GetXYZ(fVertex);
 
@@ -163,11 +169,39 @@ Int_t AliEmcalContainer::GetNAcceptEntries() const{
   Int_t result = 0;
   for(int index = 0; index < GetNEntries(); index++){
     UInt_t rejectionReason = 0;
-    if(AcceptObject(index, rejectionReason)) result++;
+    if(AcceptObjectCached(index, rejectionReason)) result++;
   }
   return result;
 }
 
+/**
+ * Same as AcceptObject(i, rejectionReason), but if the acceptance cache is
+ * enabled (SetUseAcceptanceCache()) the result is evaluated only once per
+ * index and event: later calls only read the stored rejection reason.
+ * The cache is cleared by NextEvent() and SetArray(); it assumes that the
+ * cuts do not change within an event.
+ * @param[in] i Index of the object
+ * @param[out] rejectionReason Bits of the failed cuts are added
+ * @return True if the object is accepted
+ */
+Bool_t AliEmcalContainer::AcceptObjectCached(Int_t i, UInt_t &rejectionReason) const{
+  // the two free high bits of the rejection word mark valid and accepted entries
+  const UInt_t kCached = 1u<<31;
+  const UInt_t kAccepted = 1u<<30;
+
+  if(!fUseAcceptanceCache || i < 0) return AcceptObject(i, rejectionReason);
+
+  if(i >= (Int_t)fAcceptanceCache.size()) fAcceptanceCache.resize(TMath::Max(i+1, fClArray ? GetNEntries() : 0), 0);
+  UInt_t &entry = fAcceptanceCache[i];
+  if(!(entry & kCached)){
+    UInt_t reason = 0;
+    Bool_t accepted = AcceptObject(i, reason);
+    entry = kCached | (accepted ? kAccepted : 0) | (reason & ~(kCached | kAccepted));
+  }
+  rejectionReason |= entry & ~(kCached | kAccepted);
+  return (entry & kAccepted) != 0;
+}
+
 /**
  * Get the index in the container from a given label
  * @param lab Label to check
@@ -11,6 +11,7 @@ class AliVEvent;
 class AliNamedArrayI;
 class AliVParticle;
 
+#include <vector>
 #include <TNamed.h>
 #include <TClonesArray.h>
 
@@ -146,6 +147,7 @@ class AliEmcalContainer : public TObject {
   virtual Bool_t              GetNextAcceptMomentum(TLorentzVector &mom) = 0;
   virtual Bool_t              AcceptObject(Int_t i, UInt_t &rejectionReason) const = 0;
   virtual Bool_t              AcceptObject(const TObject* obj, UInt_t &rejectionReason) const = 0;
+  Bool_t                      AcceptObjectCached(Int_t i, UInt_t &rejectionReason) const;
   Int_t                       GetNAcceptEntries() const;
   void                        ResetCurrentID(Int_t i=-1)            { fCurrentID = i                    ; }
   virtual void                SetArray(const AliVEvent *event);
@@ -155,7 +157,10 @@ class AliEmcalContainer : public TObject {
   void                        SortArray()                           { fClArray->Sort()                  ; }
 
   TClass*                     GetLoadedClass()                      { return fLoadedClass               ; }
-  virtual void                NextEvent() {;}
+  virtual void                NextEvent()                           { InvalidateAcceptanceCache()       ; }
+  void                        SetUseAcceptanceCache(Bool_t b=kTRUE) { fUseAcceptanceCache = b           ; }
+  Bool_t                      GetUseAcceptanceCache()         const { return fUseAcceptanceCache        ; }
+  void                        InvalidateAcceptanceCache()           { fAcceptanceCache.clear()          ; }
   void                        SetMinMCLabel(Int_t s)                            { fMinMCLabel      = s   ; }
   void                        SetMaxMCLabel(Int_t s)                            { fMaxMCLabel      = s   ; }
   void                        SetMCLabelRange(Int_t min, Int_t max)             { SetMinMCLabel(min)     ; SetMaxMCLabel(max)    ; }
@@ -202,11 +207,13 @@ class AliEmcalContainer : public TObject {
   Int_t                       fMinMCLabel;              ///< minimum MC label
   Int_t                       fMaxMCLabel;              ///< maximum MC label
   Double_t                    fMassHypothesis;          ///< if < 0 it will use a PID mass when available
+  Bool_t                      fUseAcceptanceCache;      ///< cache the result of AcceptObject(i) until the next event
   TClonesArray               *fClArray;                 //!<! Pointer to array in input event
   Int_t                       fCurrentID;               //!<! current ID for automatic loops
   AliNamedArrayI             *fLabelMap;                //!<! Label-Index map
   Double_t                    fVertex[3];               //!<! event vertex array
   TClass                     *fLoadedClass;             //!<! Class of the objects contained in the TClonesArray
+  mutable std::vector<UInt_t> fAcceptanceCache;         //!<! rejection reason per index, see AcceptObjectCached()
 
  private:
   TString                     fClassName;               ///< name of the class in the TClonesArray
@@ -215,7 +222,7 @@ class AliEmcalContainer : public TObject {
   AliEmcalContainer& operator=(const AliEmcalContainer& other); // assignment
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalContainer,8);
+  ClassDef(AliEmcalContainer,9);
   /// \endcond
 };
 #endif
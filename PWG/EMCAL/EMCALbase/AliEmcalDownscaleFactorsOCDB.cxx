@@ -1,5 +1,6 @@
 #include <iostream>
 
+#include <algorithm>
 #include <TObjArray.h>
 
 /**************************************************************************
@@ -16,9 +17,13 @@
  * about the suitability of this software for any purpose. It is          *
  * provided "as is" without express or implied warranty.                  *
  **************************************************************************/
+#include <TObjArray.h>
+#include <TParameter.h>
+
 #include "AliCDBEntry.h"
 #include "AliCDBManager.h"
 #include "AliLog.h"
+#include "AliOADBContainer.h"
 #include "AliTriggerClass.h"
 #include "AliTriggerConfiguration.h"
 
@@ -32,8 +37,13 @@ AliEmcalDownscaleFactorsOCDB *AliEmcalDownscaleFactorsOCDB::fgDownscaleFactors =
 
 AliEmcalDownscaleFactorsOCDB::AliEmcalDownscaleFactorsOCDB() :
   fCurrentRun(0),
-  fDownscaleFactors()
+  fDownscaleFactors(),
+  fTriggerBits(),
+  fTriggerClassNames(),
+  fTriggerClassDownscale(),
+  fOADBContainer(nullptr)
 {
+  for(int ibit = 0; ibit < kNTriggerBits; ibit++) fDownscaleFactorsByBit[ibit] = 1.;
 }
 
 AliEmcalDownscaleFactorsOCDB *AliEmcalDownscaleFactorsOCDB::Instance(){
@@ -48,6 +58,22 @@ void AliEmcalDownscaleFactorsOCDB::SetRun(Int_t runnumber){
 
   fCurrentRun = runnumber;
   fDownscaleFactors.clear();
+  fTriggerBits.clear();
+
+  // Downscale factors from the OADB file, stored as array indexed by the trigger class bit
+  TObjArray *oadbfactors = fOADBContainer ? static_cast<TObjArray *>(fOADBContainer->GetObject(fCurrentRun)) : nullptr;
+  if(oadbfactors){
+    AliInfoStream() << "Loading downscale factors for run " << fCurrentRun << " from OADB" << std::endl;
+    for(int ibit = 0; ibit < oadbfactors->GetSize(); ibit++){
+      TParameter<double> *factor = static_cast<TParameter<double> *>(oadbfactors->At(ibit));
+      if(!factor) continue;
+      fDownscaleFactors.insert(std::pair<TString, Double_t>(factor->GetName(), factor->GetVal()));
+      fTriggerBits.insert(std::pair<TString, Int_t>(factor->GetName(), ibit));
+    }
+    BuildTables();
+    return;
+  }
+
   AliInfoStream() << "Loading downscale factors for run " << fCurrentRun << std::endl;
 
   AliCDBManager *mgr = AliCDBManager::Instance();
@@ -58,7 +84,62 @@ void AliEmcalDownscaleFactorsOCDB::SetRun(Int_t runnumber){
     Double_t downscalefactor;
     trgcls->GetDownscaleFactor(downscalefactor);
     fDownscaleFactors.insert(std::pair<TString, Double_t>(trgcls->GetName(), downscalefactor));
+    fTriggerBits.insert(std::pair<TString, Int_t>(trgcls->GetName(), static_cast<Int_t>(trgcls->GetIndex()) - 1));
+  }
+  BuildTables();
+}
+
+void AliEmcalDownscaleFactorsOCDB::BuildTables(){
+  fTriggerClassNames.clear();
+  fTriggerClassDownscale.clear();
+  for(int ibit = 0; ibit < kNTriggerBits; ibit++) fDownscaleFactorsByBit[ibit] = 1.;
+  for(const auto &en : fDownscaleFactors){
+    fTriggerClassNames.push_back(en.first);
+    fTriggerClassDownscale.push_back(en.second);
+    std::map<TString, Int_t>::const_iterator bit = fTriggerBits.find(en.first);
+    if(bit != fTriggerBits.end() && bit->second >= 0 && bit->second < kNTriggerBits) fDownscaleFactorsByBit[bit->second] = en.second;
+  }
+}
+
+Int_t AliEmcalDownscaleFactorsOCDB::GetTriggerClassIndex(const TString &trigger) const {
+  // The table is in the order of the map, sorted by name
+  std::vector<TString>::const_iterator found = std::lower_bound(fTriggerClassNames.begin(), fTriggerClassNames.end(), trigger);
+  if(found == fTriggerClassNames.end() || *found != trigger) return -1;
+  return found - fTriggerClassNames.begin();
+}
+
+void AliEmcalDownscaleFactorsOCDB::SetOADBFile(const char *filename){
+  if(fOADBContainer) delete fOADBContainer;
+  fOADBContainer = new AliOADBContainer("AliEmcalDownscaleFactors");
+  if(fOADBContainer->InitFromFile(filename, "AliEmcalDownscaleFactors")){
+    AliErrorStream() << "Cannot read downscale factors from " << filename << ", using the OCDB" << std::endl;
+    delete fOADBContainer;
+    fOADBContainer = nullptr;
+  }
+  fCurrentRun = 0;      // reload for the next run
+}
+
+void AliEmcalDownscaleFactorsOCDB::WriteOADBFile(const char *filename, const std::vector<int> &runs){
+  AliOADBContainer cont("AliEmcalDownscaleFactors");
+  AliCDBManager *mgr = AliCDBManager::Instance();
+  for(auto run : runs){
+    mgr->SetRun(run);
+    AliCDBEntry *trgcdb = mgr->Get("GRP/CTP/Config");
+    if(!trgcdb) continue;
+    AliTriggerConfiguration *trgconf = static_cast<AliTriggerConfiguration *>(trgcdb->GetObject());
+    TObjArray *factors = new TObjArray(kNTriggerBits);
+    factors->SetOwner(kTRUE);
+    for(auto e : trgconf->GetClasses()){
+      AliTriggerClass *trgcls = static_cast<AliTriggerClass *>(e);
+      Double_t downscalefactor;
+      trgcls->GetDownscaleFactor(downscalefactor);
+      Int_t bit = static_cast<Int_t>(trgcls->GetIndex()) - 1;
+      if(bit < 0 || bit >= kNTriggerBits) continue;
+      factors->AddAt(new TParameter<double>(trgcls->GetName(), downscalefactor), bit);
+    }
+    cont.AppendObject(factors, run, run);
   }
+  cont.WriteToFile(filename);
 }
 
 double AliEmcalDownscaleFactorsOCDB::GetDownscaleFactorForTriggerClass(const TString &trigger) const {
@@ -69,7 +150,5 @@ double AliEmcalDownscaleFactorsOCDB::GetDownscaleFactorForTriggerClass(const TSt
 }
 
 std::vector<TString> AliEmcalDownscaleFactorsOCDB::GetTriggerClasses() const {
-  std::vector<TString> triggerclasses;
-  for(const auto &en : fDownscaleFactors) triggerclasses.push_back(en.first);
-  return triggerclasses;
+  return fTriggerClassNames;
 }
@@ -8,6 +8,8 @@
 #include <TObject.h>
 #include <TString.h>
 
+class AliOADBContainer;
+
 /**
  * @class AliEmcalDownscaleFactorsOCDB
  * @brief Handler for downscale factors for various triggers obtained from the OCDB
@@ -31,8 +33,24 @@
  * double ds = downscalehandler->GetDownscaleFactorForTriggerClass("CINT7-B-NOPF-ALLNOTRD");
  * ~~~
  *
+ * For per event weights the downscale factors are also available from a per run table,
+ * indexed by the position of the trigger class (alphabetical order, as GetTriggerClasses)
+ * or by the trigger class bit in the trigger mask of the event, without string lookup:
+ *
+ * ~~~{.cxx}
+ * int index = downscalehandler->GetTriggerClassIndex("CINT7-B-NOPF-ALLNOTRD");  // once per run
+ * double ds = downscalehandler->GetDownscaleFactorForIndex(index);            // per event
+ * double dsbit = downscalehandler->GetDownscaleFactorForTriggerBit(bit);      // bit 0 for class index 1
+ * ~~~
+ *
  * Attention: The class does not manage OCDB access. When used in analysis, the CDB
- * connect wagon is expected to run before.
+ * connect wagon is expected to run before. Alternatively the downscale factors can be
+ * read from an OADB file created beforehand with WriteOADBFile, then the OCDB is not
+ * accessed for the runs found in the file:
+ *
+ * ~~~{.cxx}
+ * downscalehandler->SetOADBFile("EMCALDownscaleFactors.root");
+ * ~~~
  */
 class AliEmcalDownscaleFactorsOCDB : public TObject {
 public:
@@ -69,6 +87,56 @@ public:
    */
   std::vector<TString> GetTriggerClasses() const;
 
+  /**
+   * Get the number of trigger classes of the current run
+   * @return Number of trigger classes
+   */
+  Int_t GetNumberOfTriggerClasses() const { return fTriggerClassNames.size(); }
+
+  /**
+   * Get the position of a trigger class in the per run table
+   * @param[in] trigger Trigger class
+   * @return Index of the trigger class (-1 if not found)
+   */
+  Int_t GetTriggerClassIndex(const TString &trigger) const;
+
+  /**
+   * Get the name of a trigger class from the per run table
+   * @param[in] index Index of the trigger class
+   * @return Name of the trigger class
+   */
+  const TString &GetTriggerClassName(Int_t index) const { return fTriggerClassNames[index]; }
+
+  /**
+   * Get the downscale factor of a trigger class from the per run table
+   * @param[in] index Index of the trigger class (see GetTriggerClassIndex)
+   * @return Downscale factor for the trigger (1. for an invalid index)
+   */
+  Double_t GetDownscaleFactorForIndex(Int_t index) const { return (index >= 0 && index < static_cast<Int_t>(fTriggerClassDownscale.size())) ? fTriggerClassDownscale[index] : 1.; }
+
+  /**
+   * Get the downscale factor of the trigger class with a given bit in the trigger mask
+   * (class index - 1, 0 to 99)
+   * @param[in] bit Trigger class bit
+   * @return Downscale factor for the trigger (1. if no class with this bit)
+   */
+  Double_t GetDownscaleFactorForTriggerBit(Int_t bit) const { return (bit >= 0 && bit < kNTriggerBits) ? fDownscaleFactorsByBit[bit] : 1.; }
+
+  /**
+   * Read the downscale factors from an OADB file instead of the OCDB. Runs not
+   * found in the file are still loaded from the OCDB.
+   * @param[in] filename Name of the OADB file
+   */
+  void SetOADBFile(const char *filename);
+
+  /**
+   * Create an OADB file with the downscale factors of the given runs, read from the
+   * OCDB (the default storage of the CDB manager has to be set)
+   * @param[in] filename Name of the output file
+   * @param[in] runs Runs to be stored
+   */
+  static void WriteOADBFile(const char *filename, const std::vector<int> &runs);
+
   /**
    * Get the current run number
    * @return Current run number
@@ -76,8 +144,20 @@ public:
   Int_t GetCurrentRun() const { return fCurrentRun; }
 
 private:
+  enum { kNTriggerBits = 100 };
+
+  /**
+   * Fill the per run tables from the map of downscale factors
+   */
+  void BuildTables();
+
   Int_t                                       fCurrentRun;                        ///< Current run number (for which downscale factors are loaded)
   std::map<TString, Double_t>                 fDownscaleFactors;                  ///< Downscale factors for the various trigger classes for the current run
+  std::map<TString, Int_t>                    fTriggerBits;                       ///< Trigger class bit for the various trigger classes for the current run
+  std::vector<TString>                        fTriggerClassNames;                 ///< Trigger classes of the current run, alphabetical order
+  std::vector<Double_t>                       fTriggerClassDownscale;             ///< Downscale factor for each entry of fTriggerClassNames
+  Double_t                                    fDownscaleFactorsByBit[kNTriggerBits]; ///< Downscale factor by trigger class bit (1. if no class)
+  AliOADBContainer                           *fOADBContainer;                     ///< Downscale factors from the OADB file (optional)
   static AliEmcalDownscaleFactorsOCDB         *fgDownscaleFactors;                ///< Singleton object
 
   AliEmcalDownscaleFactorsOCDB();
@@ -85,7 +165,7 @@ private:
   AliEmcalDownscaleFactorsOCDB &operator=(const AliEmcalDownscaleFactorsOCDB &);
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalDownscaleFactorsOCDB, 1);
+  ClassDef(AliEmcalDownscaleFactorsOCDB, 2);
   /// \endcond
 };
 
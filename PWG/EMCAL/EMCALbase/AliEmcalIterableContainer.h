@@ -336,7 +336,7 @@ void AliEmcalIterableContainerT<T, STAR>::BuildAcceptIndices(){
   int acceptCounter = 0;
   for(int index = 0; index < fkContainer->GetNEntries(); index++){
     UInt_t rejectionReason = 0;
-    if(fkContainer->AcceptObject(index, rejectionReason)) fAcceptIndices[acceptCounter++] = index;
+    if(fkContainer->AcceptObjectCached(index, rejectionReason)) fAcceptIndices[acceptCounter++] = index;
   }
 }
 
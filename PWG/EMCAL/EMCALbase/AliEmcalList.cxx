@@ -13,6 +13,13 @@
  * provided "as is" without express or implied warranty.                  *
  **************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+#include <RVersion.h>
+#include <TROOT.h>
 #include "TList.h"
 #include "TH1.h"
 #include "AliLog.h"
@@ -23,7 +30,7 @@ ClassImp(AliEmcalList)
 /// \endcond
 
 //________________________________________________________________________
-AliEmcalList::AliEmcalList() : TList(), fUseScaling(kFALSE)
+AliEmcalList::AliEmcalList() : TList(), fUseScaling(kFALSE), fNumberOfMergeThreads(1)
 {
   // constructor
 }
@@ -53,6 +60,14 @@ Long64_t AliEmcalList::Merge(TCollection *hlist)
   Bool_t  isLastLevel = IsLastMergeLevel(hlist);
  
   // #### On last level, do the scaling
+  if(isLastLevel && fNumberOfMergeThreads > 1)
+  {
+    AliInfo(Form("===== LAST LEVEL OF MERGING (%d threads) =====", fNumberOfMergeThreads));
+    ParallelLastLevelMerge(hlist);
+    AliInfo("Merge() done.");
+    return hlist->GetEntries() + 1;
+  }
+
   if(isLastLevel)
   {
     AliInfo(Form("===== LAST LEVEL OF MERGING ====="));
@@ -78,9 +93,70 @@ Long64_t AliEmcalList::Merge(TCollection *hlist)
   return hlist->GetEntries() + 1;
 }
 
+/// Last merge level on several threads. The scaling factors are computed first (this is cheap
+/// and logs), then every list is scaled by its own factor and the lists are merged pairwise:
+/// at each round list 2k+1 is merged into list 2k, until only this list is left.
+//________________________________________________________________________
+void AliEmcalList::ParallelLastLevelMerge(TCollection *hlist)
+{
+  std::vector<TList*> lists(1, this);
+  TIter listIterator(hlist);
+  while (AliEmcalList* tmpList = static_cast<AliEmcalList*>(listIterator()))
+    lists.push_back(tmpList);
+
+  std::vector<Double_t> scalingFactors(lists.size());
+  for(UInt_t i = 0; i < lists.size(); i++)
+  {
+    TH1* xsection = static_cast<TH1*>(lists[i]->FindObject("fHistXsection"));
+    TH1* ntrials  = static_cast<TH1*>(lists[i]->FindObject("fHistTrials"));
+    scalingFactors[i] = GetScalingFactor(xsection, ntrials);
+  }
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  ROOT::EnableThreadSafety();
+  const UInt_t nThreads = fNumberOfMergeThreads;
+#else
+  const UInt_t nThreads = 1;
+#endif
+
+  // Run job(0) ... job(n-1) on at most nThreads threads, the calling thread takes part as well
+  auto runJobs = [nThreads](UInt_t n, const std::function<void(UInt_t)> & job) {
+    std::atomic<UInt_t> next(0);
+    auto worker = [&next, n, &job]() {
+      for (UInt_t i = next++; i < n; i = next++)
+        job(i);
+    };
+    std::vector<std::thread> workers;
+    for (UInt_t i = 1; i < std::min(nThreads, n); i++)
+      workers.emplace_back(worker);
+    worker();
+    for (auto & thread : workers)
+      thread.join();
+  };
+
+  runJobs(lists.size(), [this, &lists, &scalingFactors](UInt_t i) {
+    ScaleAllHistograms(lists[i], scalingFactors[i], kFALSE);
+  });
+
+  while (lists.size() > 1)
+  {
+    // TList::Merge of one list into the other, no scaling and objects matched by name as usual
+    runJobs(lists.size() / 2, [&lists](UInt_t k) {
+      TList pair;
+      pair.Add(lists[2*k+1]);
+      lists[2*k]->TList::Merge(&pair);
+    });
+    std::vector<TList*> merged;
+    for(UInt_t i = 0; i < lists.size(); i += 2)
+      merged.push_back(lists[i]);
+    lists.swap(merged);
+  }
+}
+
 /// Function that does the scaling of all histograms in hlist recursively
+/// verbose = false when called from the merge threads, AliLog is not thread safe
 //________________________________________________________________________
-void AliEmcalList::ScaleAllHistograms(TCollection *hlist, Double_t scalingFactor)
+void AliEmcalList::ScaleAllHistograms(TCollection *hlist, Double_t scalingFactor, Bool_t verbose)
 {
   TIter listIterator(hlist);
   while (TObject* listObject = listIterator())
@@ -89,7 +165,7 @@ void AliEmcalList::ScaleAllHistograms(TCollection *hlist, Double_t scalingFactor
     TCollection* sublist = dynamic_cast<TCollection*>(listObject);
     if(sublist)
     {
-      ScaleAllHistograms(sublist, scalingFactor);
+      ScaleAllHistograms(sublist, scalingFactor, verbose);
       continue;
     }
 
@@ -102,18 +178,18 @@ void AliEmcalList::ScaleAllHistograms(TCollection *hlist, Double_t scalingFactor
     TString histogram_class (histogram->ClassName());
     if (!strcmp(histogram->GetName(), "fHistXsection") || !strcmp(histogram->GetName(), "fHistTrials"))
     {
-      AliInfo(Form("Histogram %s will not be scaled, because a scaling histogram", histogram->GetName()));
+      if (verbose) AliInfo(Form("Histogram %s will not be scaled, because a scaling histogram", histogram->GetName()));
       continue;
     }
     if (histogram_class.Contains("TProfile"))
     {
-      AliInfo(Form("Histogram %s will not be scaled, because it is a TProfile", histogram->GetName()));
+      if (verbose) AliInfo(Form("Histogram %s will not be scaled, because it is a TProfile", histogram->GetName()));
       continue;
     }
 
     histogram->Sumw2();
     histogram->Scale(scalingFactor);
-    AliInfo(Form("Histogram %s (%s) was scaled...", histogram->GetName(), histogram_class.Data()));
+    if (verbose) AliInfo(Form("Histogram %s (%s) was scaled...", histogram->GetName(), histogram_class.Data()));
 
   }
 }
@@ -11,6 +11,12 @@
  * Scaling is recursively applied also to all nested lists deriving from TCollection
  * fHistXsection and fHistTrials must be added directly to the list (not to a nested list)
  *
+ * With SetNumberOfMergeThreads(n > 1) the last merge level (the one mixing pt hard bins),
+ * which is the slow one for large THnSparse, is done in parallel: the lists are scaled
+ * concurrently, then merged pairwise in a tree reduction distributed over n threads.
+ * Lower levels and the scaling factors are unchanged. The result is the same as the
+ * sequential merge, up to the rounding of the different summation order.
+ *
  * \author Ruediger Haake <ruediger.haake@cern.ch>, CERN
  * \date May 05, 2016
  * \ingroup EMCALCOREFW
@@ -29,18 +35,21 @@ public:
   ~AliEmcalList() {}
   Long64_t                    Merge(TCollection *hlist);
   void                        SetUseScaling(Bool_t val) {fUseScaling = val;}
+  void                        SetNumberOfMergeThreads(Int_t n) {fNumberOfMergeThreads = n;}
 
 private:
   // ####### Helper functions
-  void                        ScaleAllHistograms(TCollection *hlist, Double_t scalingFactor);
+  void                        ScaleAllHistograms(TCollection *hlist, Double_t scalingFactor, Bool_t verbose = kTRUE);
+  void                        ParallelLastLevelMerge(TCollection *hlist);
   Double_t                    GetScalingFactor(TH1* xsection, TH1* ntrials);
   Bool_t                      IsLastMergeLevel(TCollection* collection);
   Int_t                       GetFilledBinNumber(TH1* hist);
   
   Bool_t                      fUseScaling;                    ///< if true, scaling will be done. if false AliEmcalList simplifies to TList
+  Int_t                       fNumberOfMergeThreads;          ///< number of threads for the last merge level (1: sequential)
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalList, 1);
+  ClassDef(AliEmcalList, 2);
   /// \endcond
 };
 
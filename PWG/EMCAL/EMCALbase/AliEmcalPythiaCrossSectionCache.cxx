@@ -0,0 +1,98 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <memory>
+
+#include <TFile.h>
+#include <TH1F.h>
+#include <TKey.h>
+#include <TList.h>
+#include <TProfile.h>
+#include <TTree.h>
+
+#include "AliLog.h"
+
+#include "AliEmcalPythiaCrossSectionCache.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalPythiaCrossSectionCache)
+/// \endcond
+
+AliEmcalPythiaCrossSectionCache *AliEmcalPythiaCrossSectionCache::fgCrossSectionCache = nullptr;
+
+AliEmcalPythiaCrossSectionCache::AliEmcalPythiaCrossSectionCache() :
+  TObject(),
+  fEntries()
+{
+}
+
+AliEmcalPythiaCrossSectionCache *AliEmcalPythiaCrossSectionCache::Instance(){
+  if(!fgCrossSectionCache) {
+    fgCrossSectionCache = new AliEmcalPythiaCrossSectionCache;
+  }
+  return fgCrossSectionCache;
+}
+
+Bool_t AliEmcalPythiaCrossSectionCache::GetCrossSectionAndTrials(const TString &directory, Float_t &xsec, Float_t &trials){
+  std::map<TString, CrossSectionEntry>::const_iterator found = fEntries.find(directory);
+  if(found == fEntries.end()){
+    // Input files are processed one after the other, old entries are not needed any more
+    if(fEntries.size() >= kMaxEntries) fEntries.clear();
+    CrossSectionEntry entry;
+    entry.fXsec = 0;
+    entry.fTrials = 1;
+    entry.fAvailable = ReadCrossSectionAndTrials(directory, entry.fXsec, entry.fTrials);
+    found = fEntries.insert(std::pair<TString, CrossSectionEntry>(directory, entry)).first;
+  }
+  else {
+    AliDebugStream(1) << "Using cached cross section and trials for " << directory << std::endl;
+  }
+  xsec = found->second.fXsec;
+  trials = found->second.fTrials;
+  return found->second.fAvailable;
+}
+
+Bool_t AliEmcalPythiaCrossSectionCache::ReadCrossSectionAndTrials(const TString &directory, Float_t &xsec, Float_t &trials){
+  xsec = 0;
+  trials = 1;
+
+  // problem that we cannot really test the existance of a file in a archive so we have to live with open error message from root
+  std::unique_ptr<TFile> fxsec(TFile::Open(Form("%s%s",directory.Data(),"pyxsec.root")));
+
+  if (!fxsec) {
+    // next trial fetch the histgram file
+    fxsec = std::unique_ptr<TFile>(TFile::Open(Form("%s%s",directory.Data(),"pyxsec_hists.root")));
+    if (!fxsec) return kFALSE; // not a severe condition but inciate that we have no information
+    else {
+      // find the tlist we want to be independtent of the name so use the Tkey
+      TKey* key = (TKey*)fxsec->GetListOfKeys()->At(0);
+      if (!key) return kFALSE;
+      TList *list = dynamic_cast<TList*>(key->ReadObj());
+      if (!list) return kFALSE;
+      xsec = ((TProfile*)list->FindObject("h1Xsec"))->GetBinContent(1);
+      trials  = ((TH1F*)list->FindObject("h1Trials"))->GetBinContent(1);
+    }
+  } else { // no tree pyxsec.root
+    TTree *xtree = (TTree*)fxsec->Get("Xsection");
+    if (!xtree) return kFALSE;
+    UInt_t   ntrials  = 0;
+    Double_t  xsection  = 0;
+    xtree->SetBranchAddress("xsection",&xsection);
+    xtree->SetBranchAddress("ntrials",&ntrials);
+    xtree->GetEntry(0);
+    trials = ntrials;
+    xsec = xsection;
+  }
+  return kTRUE;
+}
@@ -0,0 +1,92 @@
+#ifndef ALIEMCALPYTHIACROSSSECTIONCACHE_H
+#define ALIEMCALPYTHIACROSSSECTIONCACHE_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <map>
+#include <TObject.h>
+#include <TString.h>
+
+/**
+ * @class AliEmcalPythiaCrossSectionCache
+ * @brief Train-wide cache of the PYTHIA cross section and number of trials per input file
+ * @ingroup  EMCALCOREFW
+ * @since Oct 14, 2016
+ *
+ * Reading the cross section and the number of trials requires opening pyxsec.root
+ * (or pyxsec_hists.root) next to the input file, which is slow when reading over
+ * the network. The class is used as singleton shared among all wagons of a train:
+ * the first task requesting the information for a given input directory opens the
+ * file, all other tasks get the cached values.
+ *
+ * ~~~{.cxx}
+ * Float_t xsec = 0, trials = 1;
+ * AliEmcalPythiaCrossSectionCache::Instance()->GetCrossSectionAndTrials(directory, xsec, trials);
+ * ~~~
+ */
+class AliEmcalPythiaCrossSectionCache : public TObject {
+public:
+
+  /**
+   * Get instance of the cross section cache. If called for the
+   * first time a new object is created
+   * @return Cross section cache
+   */
+  static AliEmcalPythiaCrossSectionCache *Instance();
+
+  /**
+   * Destructor
+   */
+  virtual ~AliEmcalPythiaCrossSectionCache() {}
+
+  /**
+   * Get cross section and number of trials for a given input directory.
+   * The files are only read if the directory is not yet in the cache.
+   * @param[in] directory Directory (or archive prefix) of the current input file
+   * @param[out] xsec Cross section calculated by PYTHIA (0 if not available)
+   * @param[out] trials Number of trials needed by PYTHIA (1 if not available)
+   * @return True if the information was available for the directory
+   */
+  Bool_t GetCrossSectionAndTrials(const TString &directory, Float_t &xsec, Float_t &trials);
+
+  /**
+   * Read cross section and number of trials from pyxsec.root or pyxsec_hists.root,
+   * without caching.
+   * @param[in] directory Directory (or archive prefix) of the current input file
+   * @param[out] xsec Cross section calculated by PYTHIA
+   * @param[out] trials Number of trials needed by PYTHIA
+   * @return True if the information was read successfully
+   */
+  static Bool_t ReadCrossSectionAndTrials(const TString &directory, Float_t &xsec, Float_t &trials);
+
+  /**
+   * Remove all entries from the cache
+   */
+  void Reset() { fEntries.clear(); }
+
+private:
+  /**
+   * @struct CrossSectionEntry
+   * @brief Cached information for one input directory
+   */
+  struct CrossSectionEntry {
+    Bool_t    fAvailable;                       ///< Whether the information could be read
+    Float_t   fXsec;                            ///< Cross section
+    Float_t   fTrials;                          ///< Number of trials
+  };
+
+  enum { kMaxEntries = 100 };                   ///< Maximum number of cached directories
+
+  std::map<TString, CrossSectionEntry>         fEntries;                           //!<! Cached information per input directory
+  static AliEmcalPythiaCrossSectionCache       *fgCrossSectionCache;               ///< Singleton object
+
+  AliEmcalPythiaCrossSectionCache();
+  AliEmcalPythiaCrossSectionCache(const AliEmcalPythiaCrossSectionCache &);
+  AliEmcalPythiaCrossSectionCache &operator=(const AliEmcalPythiaCrossSectionCache &);
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalPythiaCrossSectionCache, 1);
+  /// \endcond
+};
+
+#endif /* ALIEMCALPYTHIACROSSSECTIONCACHE_H */
@@ -18,6 +18,7 @@
 #include <AliVTrack.h>
 #include <AliVEvent.h>
 #include "AliVCuts.h"
+#include "AliEmcalTrackSelectionCache.h"
 
 /// \cond CLASSIMP
 ClassImp(AliEmcalTrackSelection)
@@ -33,7 +34,9 @@ AliEmcalTrackSelection::AliEmcalTrackSelection() :
   fListOfTrackBitmaps(NULL),
   fTrackBitmap(64),
 	fListOfCuts(NULL),
-	fSelectionModeAny(kFALSE)
+	fSelectionModeAny(kFALSE),
+	fUseSelectionCache(kFALSE),
+	fCacheBits()
 {
 }
 
@@ -47,7 +50,9 @@ AliEmcalTrackSelection::AliEmcalTrackSelection(const AliEmcalTrackSelection& ref
 	fListOfTrackBitmaps(NULL),
 	fTrackBitmap(64),
 	fListOfCuts(NULL),
-	fSelectionModeAny(kFALSE)
+	fSelectionModeAny(kFALSE),
+	fUseSelectionCache(ref.fUseSelectionCache),
+	fCacheBits()
 {
 	if(ref.fListOfTracks) fListOfTracks = new TObjArray(*(ref.fListOfTracks));
 	if(ref.fListOfTrackBitmaps) fListOfTrackBitmaps = new TClonesArray(*(ref.fListOfTrackBitmaps));
@@ -76,6 +81,8 @@ AliEmcalTrackSelection& AliEmcalTrackSelection::operator=(const AliEmcalTrackSel
 		  for(TIter cutIter = TIter(ref.fListOfCuts).Begin(); cutIter != TIter::End(); ++cutIter)
 		    fListOfCuts->Add(*cutIter);
 		} else fListOfCuts = NULL;
+		fUseSelectionCache = ref.fUseSelectionCache;
+		fCacheBits.Set(0);
 	}
 	return *this;
 }
@@ -100,6 +107,7 @@ void AliEmcalTrackSelection::AddTrackCuts(AliVCuts *cuts){
     fListOfCuts->SetOwner(true);
   }
   fListOfCuts->Add(cuts);
+  fCacheBits.Set(0);
 }
 
 /**
@@ -136,6 +144,35 @@ AliVCuts* AliEmcalTrackSelection::GetTrackCuts(Int_t icut) {
   return NULL;
 }
 
+/**
+ * Get the result of a cut object for a track from the selection cache.
+ * At the first call the cut objects are registered to the cache.
+ * \param icut Index of the cut object
+ * \param trk Track the cuts are applied on
+ * \return 1 if selected, 0 if rejected, -1 if the cuts have to be evaluated
+ */
+Int_t AliEmcalTrackSelection::GetCachedResult(Int_t icut, const AliVTrack *trk) {
+  if (!fUseSelectionCache || !fListOfCuts) return -1;
+  if (fCacheBits.GetSize() != fListOfCuts->GetEntries()) {
+    fCacheBits.Set(fListOfCuts->GetEntries());
+    for (Int_t i = 0; i < fCacheBits.GetSize(); i++)
+      fCacheBits[i] = AliEmcalTrackSelectionCache::Instance()->Register(static_cast<AliVCuts *>(fListOfCuts->At(i)));
+  }
+  if (icut < 0 || icut >= fCacheBits.GetSize() || fCacheBits[icut] < 0) return -1;
+  return AliEmcalTrackSelectionCache::Instance()->GetResult(fCacheBits[icut], trk);
+}
+
+/**
+ * Store the result of a cut object for a track in the selection cache.
+ * \param icut Index of the cut object
+ * \param trk Track the cuts are applied on
+ * \param selected Result of the cuts
+ */
+void AliEmcalTrackSelection::SetCachedResult(Int_t icut, const AliVTrack *trk, Bool_t selected) {
+  if (!fUseSelectionCache || icut < 0 || icut >= fCacheBits.GetSize() || fCacheBits[icut] < 0) return;
+  AliEmcalTrackSelectionCache::Instance()->SetResult(fCacheBits[icut], trk, selected);
+}
+
 /**
  * Select tracks from a TClonesArray of input tracks
  *
@@ -5,6 +5,7 @@
 
 #include <TObject.h>
 #include <TBits.h>
+#include <TArrayI.h>
 
 class TClonesArray;
 class TObjArray;
@@ -59,12 +60,26 @@ public:
 	void SetSelectionModeAny() { fSelectionModeAny = kTRUE ; }
 	void SetSelectionModeAll() { fSelectionModeAny = kFALSE; }
 
+	/**
+	 * Share the results of the track cuts with the other track selections of the train
+	 * through AliEmcalTrackSelectionCache: each distinct cut configuration is evaluated
+	 * once per track and event.
+	 * \param b If true the selection cache is used
+	 */
+	void SetUseSelectionCache(Bool_t b = kTRUE) { fUseSelectionCache = b; }
+	Bool_t GetUseSelectionCache() const { return fUseSelectionCache; }
+
 protected:
+	Int_t GetCachedResult(Int_t icut, const AliVTrack *trk);
+	void  SetCachedResult(Int_t icut, const AliVTrack *trk, Bool_t selected);
+
 	TObjArray    *fListOfTracks;         ///< TObjArray with accepted tracks
 	TClonesArray *fListOfTrackBitmaps;   ///< TClonesArray with accepted tracks' bit maps
 	TBits         fTrackBitmap;          ///< Bitmap of last accepted/rejected track
 	TObjArray    *fListOfCuts;           ///< List of track cut objects
 	Bool_t        fSelectionModeAny;     ///< Accept track if any of the cuts is fulfilled
+	Bool_t        fUseSelectionCache;    ///< Share the cut results through AliEmcalTrackSelectionCache
+	TArrayI       fCacheBits;            //!<! Bit in AliEmcalTrackSelectionCache of each cut object
 
 	/// \cond CLASSIMP
 
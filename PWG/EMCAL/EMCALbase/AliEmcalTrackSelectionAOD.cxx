@@ -156,17 +156,24 @@ bool AliEmcalTrackSelectionAOD::IsTrackAccepted(AliVTrack * const trk)
     cutcounter++;
   }
   if (fListOfCuts) {
+    Int_t icut(0);
     for (TIter cutIter = TIter(fListOfCuts).Begin(); cutIter != TIter::End(); ++cutIter){
       AliVCuts *trackCuts = static_cast<AliVCuts*>(*cutIter);
-      if (trackCuts->IsA() == AliESDtrackCuts::Class()) {
-        // If track cuts are AliESDtrackCuts, the track needs to be converted to an AliESDtrack before
-        AliESDtrack copyTrack(aodt);
-        if (trackCuts->IsSelected(&copyTrack)) fTrackBitmap.SetBitNumber(cutcounter);
-      }
-      else{
-        if (trackCuts->IsSelected(aodt)) fTrackBitmap.SetBitNumber(cutcounter);
+      Int_t selected = GetCachedResult(icut, aodt);
+      if (selected < 0) {
+        if (trackCuts->IsA() == AliESDtrackCuts::Class()) {
+          // If track cuts are AliESDtrackCuts, the track needs to be converted to an AliESDtrack before
+          AliESDtrack copyTrack(aodt);
+          selected = trackCuts->IsSelected(&copyTrack);
+        }
+        else{
+          selected = trackCuts->IsSelected(aodt);
+        }
+        SetCachedResult(icut, aodt, selected);
       }
+      if (selected) fTrackBitmap.SetBitNumber(cutcounter);
       cutcounter++;
+      icut++;
     }
   }
 
@@ -49,7 +49,7 @@ private:
 	Char_t      fHybridFilterBits[2];   ///< Filter bits of hybrid tracks
 
 	/// \cond CLASSIMP
-	ClassDef(AliEmcalTrackSelectionAOD, 2);
+	ClassDef(AliEmcalTrackSelectionAOD, 3);
 	/// \endcond
 };
 
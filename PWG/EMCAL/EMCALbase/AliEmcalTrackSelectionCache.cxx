@@ -0,0 +1,171 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <TBufferFile.h>
+
+#include "AliAnalysisManager.h"
+#include "AliEmcalTrackSelectionCache.h"
+#include "AliESDtrackCuts.h"
+#include "AliInputEventHandler.h"
+#include "AliLog.h"
+#include "AliVCuts.h"
+#include "AliVEvent.h"
+#include "AliVTrack.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalTrackSelectionCache)
+/// \endcond
+
+AliEmcalTrackSelectionCache* AliEmcalTrackSelectionCache::fgInstance = 0;
+
+/**
+ * Private constructor, use Instance()
+ */
+AliEmcalTrackSelectionCache::AliEmcalTrackSelectionCache() :
+  TObject(),
+  fStreamed(),
+  fEvent(0),
+  fEntry(-1),
+  fIndex(),
+  fTracks(),
+  fNTracks(0),
+  fNRequests(0),
+  fNEvaluated(0)
+{
+}
+
+/**
+ * Destructor
+ */
+AliEmcalTrackSelectionCache::~AliEmcalTrackSelectionCache()
+{
+  if (fgInstance == this) fgInstance = 0;
+}
+
+/**
+ * Access to the cache of this process
+ * \return The cache, created at the first call
+ */
+AliEmcalTrackSelectionCache* AliEmcalTrackSelectionCache::Instance()
+{
+  if (!fgInstance) fgInstance = new AliEmcalTrackSelectionCache();
+  return fgInstance;
+}
+
+/**
+ * Get the bit of a cut configuration, registering it if it was not seen before.
+ * \param cuts Track cuts, fully configured
+ * \return Bit of the configuration, -1 if the cuts cannot be cached
+ */
+Int_t AliEmcalTrackSelectionCache::Register(const AliVCuts* cuts)
+{
+  if (!cuts || cuts->IsA() != AliESDtrackCuts::Class()) return -1;
+  if (static_cast<const AliESDtrackCuts*>(cuts)->GetHistogramsOn()) return -1;
+
+  TBufferFile buffer(TBuffer::kWrite);
+  buffer.WriteObjectAny(cuts, cuts->IsA());
+  std::vector<char> streamed(buffer.Buffer(), buffer.Buffer() + buffer.Length());
+
+  for (UInt_t ibit = 0; ibit < fStreamed.size(); ibit++) {
+    if (fStreamed[ibit] == streamed) return ibit;
+  }
+  if (fStreamed.size() >= kMaxConfigurations) {
+    AliWarning(Form("More than %d track cut configurations, %s is not cached", kMaxConfigurations, cuts->GetName()));
+    return -1;
+  }
+  fStreamed.push_back(streamed);
+  return fStreamed.size() - 1;
+}
+
+/**
+ * Forget the results of the current event, the storage is kept
+ */
+void AliEmcalTrackSelectionCache::Clear(Option_t* /*option*/)
+{
+  fIndex.clear();
+  fNTracks = 0;
+  fEvent = 0;
+  fEntry = -1;
+}
+
+/**
+ * Bind the cache to the current event, emptying it on a new event.
+ * \return False outside of an analysis manager event loop, where nothing is cached
+ */
+Bool_t AliEmcalTrackSelectionCache::CheckEvent()
+{
+  AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+  const Long64_t entry = mgr ? mgr->GetCurrentEntry() : -1;
+  if (entry < 0) return kFALSE;
+  const AliVEvent* ev = mgr->GetInputEventHandler() ? mgr->GetInputEventHandler()->GetEvent() : 0;
+  if (entry != fEntry || ev != fEvent) {
+    Clear();
+    fEvent = ev;
+    fEntry = entry;
+  }
+  return kTRUE;
+}
+
+/**
+ * Find the entry of a track in the current event
+ * \param track Track
+ * \param create Create the entry if the track is not known yet
+ * \return Entry of the track, NULL if not found
+ */
+AliEmcalTrackSelectionCache::TrackEntry* AliEmcalTrackSelectionCache::FindTrack(const AliVTrack* track, Bool_t create)
+{
+  std::map<const AliVTrack*, Int_t>::iterator it = fIndex.find(track);
+  if (it != fIndex.end()) return &(fTracks[it->second]);
+  if (!create) return 0;
+
+  Int_t index = fNTracks++;
+  if (index >= (Int_t)fTracks.size()) fTracks.resize(index + 1);
+  fTracks[index].fDone = 0;
+  fTracks[index].fSelected = 0;
+  fIndex[track] = index;
+  return &(fTracks[index]);
+}
+
+/**
+ * Get the stored result of a configuration for a track
+ * \param bit Bit of the configuration, from Register()
+ * \param track Track as given to the track selection
+ * \return 1 if selected, 0 if rejected, -1 if not evaluated yet in this event
+ */
+Int_t AliEmcalTrackSelectionCache::GetResult(Int_t bit, const AliVTrack* track)
+{
+  fNRequests++;
+  if (bit < 0 || bit >= kMaxConfigurations || !CheckEvent()) return -1;
+  TrackEntry* entry = FindTrack(track, kFALSE);
+  const ULong64_t mask = 1ULL << bit;
+  if (!entry || !(entry->fDone & mask)) return -1;
+  return (entry->fSelected & mask) ? 1 : 0;
+}
+
+/**
+ * Store the result of a configuration for a track
+ * \param bit Bit of the configuration, from Register()
+ * \param track Track as given to the track selection
+ * \param selected Result of the evaluation of the cuts
+ */
+void AliEmcalTrackSelectionCache::SetResult(Int_t bit, const AliVTrack* track, Bool_t selected)
+{
+  fNEvaluated++;
+  if (bit < 0 || bit >= kMaxConfigurations || !CheckEvent()) return;
+  TrackEntry* entry = FindTrack(track, kTRUE);
+  const ULong64_t mask = 1ULL << bit;
+  entry->fDone |= mask;
+  if (selected) entry->fSelected |= mask;
+  else entry->fSelected &= ~mask;
+}
@@ -0,0 +1,81 @@
+#ifndef ALIEMCALTRACKSELECTIONCACHE_H
+#define ALIEMCALTRACKSELECTIONCACHE_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <map>
+#include <vector>
+#include <TObject.h>
+
+class AliVCuts;
+class AliVEvent;
+class AliVTrack;
+
+/**
+ * \class AliEmcalTrackSelectionCache
+ * \brief Process wide per event cache of track selection results
+ * \ingroup EMCALCOREFW
+ * \since Oct 14, 2016
+ *
+ * Every distinct track cut configuration registered by the track selections
+ * of the train (hybrid, TPC-only, ITS-TPC 2011 ...) is given one bit. The cuts
+ * are evaluated at most once per track and event, the result is stored in a
+ * per track mask, similar to the AOD filter bits, and the next requests of any
+ * wagon return the stored bit.
+ *
+ * Two cut objects are the same configuration if they are of the same class and
+ * stream to the same buffer. Only AliESDtrackCuts without QA histograms are shared,
+ * other cuts can have side effects in IsSelected and are not cached.
+ *
+ * The cache is bound to the input event and the entry of the analysis manager,
+ * it is emptied when either changes. Outside of an event loop nothing is cached.
+ */
+class AliEmcalTrackSelectionCache : public TObject {
+public:
+  enum { kMaxConfigurations = 64 };
+
+  static AliEmcalTrackSelectionCache* Instance();
+  virtual ~AliEmcalTrackSelectionCache();
+
+  Int_t  Register(const AliVCuts* cuts);
+
+  Int_t  GetResult(Int_t bit, const AliVTrack* track);
+  void   SetResult(Int_t bit, const AliVTrack* track, Bool_t selected);
+
+  virtual void Clear(Option_t* option="");
+
+  Int_t    GetNConfigurations() const { return fStreamed.size(); }
+  Long64_t GetNRequests()       const { return fNRequests; }
+  Long64_t GetNEvaluated()      const { return fNEvaluated; }
+
+private:
+  /// Selection bits of one track, fDone has the bits already evaluated
+  struct TrackEntry {
+    ULong64_t fDone;
+    ULong64_t fSelected;
+  };
+
+  AliEmcalTrackSelectionCache();
+  AliEmcalTrackSelectionCache(const AliEmcalTrackSelectionCache& cache);
+  AliEmcalTrackSelectionCache& operator=(const AliEmcalTrackSelectionCache& cache);
+
+  Bool_t        CheckEvent();
+  TrackEntry*   FindTrack(const AliVTrack* track, Bool_t create);
+
+  std::vector<std::vector<char> >      fStreamed;        //!<! Streamed registered cuts, one per bit
+  const AliVEvent*                     fEvent;           //!<! Input event of the cached results
+  Long64_t                             fEntry;           //!<! Analysis manager entry of the cached results
+  std::map<const AliVTrack*, Int_t>    fIndex;           //!<! Entry of each track in fTracks
+  std::vector<TrackEntry>              fTracks;          //!<! Cached results, reused from event to event
+  Int_t                                fNTracks;         //!<! Tracks of the current event in fTracks
+  Long64_t                             fNRequests;       //!<! Number of requests
+  Long64_t                             fNEvaluated;      //!<! Number of results set after an evaluation
+
+  static AliEmcalTrackSelectionCache*  fgInstance;       //!<! The cache of this process
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalTrackSelectionCache, 0);
+  /// \endcond
+};
+
+#endif /* ALIEMCALTRACKSELECTIONCACHE_H */
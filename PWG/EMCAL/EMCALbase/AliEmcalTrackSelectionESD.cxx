@@ -107,7 +107,12 @@ bool AliEmcalTrackSelectionESD::IsTrackAccepted(AliVTrack* const trk) {
   fTrackBitmap.ResetAllBits();
   Int_t cutcounter = 0;
   for (TIter cutIter = TIter(fListOfCuts).Begin(); cutIter != TIter::End(); ++cutIter){
-    if((static_cast<AliVCuts *>(*cutIter))->IsSelected(esdt)) fTrackBitmap.SetBitNumber(cutcounter);
+    Int_t selected = GetCachedResult(cutcounter, esdt);
+    if (selected < 0) {
+      selected = (static_cast<AliVCuts *>(*cutIter))->IsSelected(esdt);
+      SetCachedResult(cutcounter, esdt, selected);
+    }
+    if(selected) fTrackBitmap.SetBitNumber(cutcounter);
     cutcounter++;
   }
   // In case of ANY at least one bit has to be set, while in case of ALL all bits have to be set
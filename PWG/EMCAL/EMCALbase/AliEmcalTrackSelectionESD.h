@@ -30,7 +30,7 @@ public:
 	virtual bool IsTrackAccepted(AliVTrack * const trk);
 
 	/// \cond CLASSIMP
-	ClassDef(AliEmcalTrackSelectionESD,1);
+	ClassDef(AliEmcalTrackSelectionESD,2);
 	/// \endcond
 };
 
@@ -84,7 +84,7 @@ AliAODMCParticle* AliMCParticleContainer::GetAcceptMCParticle(Int_t i) const
 
   UInt_t rejectionReason = 0;
   if (i == -1) i = fCurrentID;
-  if (AcceptMCParticle(i, rejectionReason)) {
+  if (AcceptObjectCached(i, rejectionReason)) {
       return GetMCParticle(i);
   }
   else {
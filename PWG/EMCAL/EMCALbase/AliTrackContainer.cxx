@@ -13,11 +13,13 @@
  * provided "as is" without express or implied warranty.                  *
  **************************************************************************/
 #include <TClonesArray.h>
+#include <TMath.h>
 
 #include "AliVEvent.h"
 #include "AliLog.h"
 #include "AliVCuts.h"
 #include "AliESDtrack.h"
+#include "AliNamedArrayI.h"
 
 #include "AliTLorentzVector.h"
 #include "AliEmcalTrackSelectionAOD.h"
@@ -40,9 +42,17 @@ AliTrackContainer::AliTrackContainer():
   fSelectionModeAny(kFALSE),
   fAODFilterBits(0),
   fTrackCutsPeriod(),
+  fUseTrackSelectionCache(kFALSE),
   fEmcalTrackSelection(0),
   fFilteredTracks(0),
-  fTrackTypes(5000)
+  fTrackTypes(5000),
+  fFillPicoTrackInfo(kFALSE),
+  fPicoMCParticlesName(),
+  fPicoMCParticles(0),
+  fPicoMCParticlesMap(0),
+  fTrackIsEmcal(),
+  fTrackMCFlag(),
+  fTrackGeneratorIndex()
 {
   fBaseClassName = "AliVTrack";
   SetClassName("AliVTrack");
@@ -61,9 +71,17 @@ AliTrackContainer::AliTrackContainer(const char *name, const char *period):
   fSelectionModeAny(kFALSE),
   fAODFilterBits(0),
   fTrackCutsPeriod(period),
+  fUseTrackSelectionCache(kFALSE),
   fEmcalTrackSelection(0),
   fFilteredTracks(0),
-  fTrackTypes(5000)
+  fTrackTypes(5000),
+  fFillPicoTrackInfo(kFALSE),
+  fPicoMCParticlesName(),
+  fPicoMCParticles(0),
+  fPicoMCParticlesMap(0),
+  fTrackIsEmcal(),
+  fTrackMCFlag(),
+  fTrackGeneratorIndex()
 {
   fBaseClassName = "AliVTrack";
   SetClassName("AliVTrack");
@@ -139,6 +157,16 @@ void AliTrackContainer::SetArray(const AliVEvent *event)
         AliWarning(Form("Objects are of type %s: no track filtering will be done!!", fLoadedClass->GetName()));
       }
     }
+
+    if (fEmcalTrackSelection) fEmcalTrackSelection->SetUseSelectionCache(fUseTrackSelectionCache);
+  }
+
+  if (fFillPicoTrackInfo && !fPicoMCParticlesName.IsNull() && !fPicoMCParticles) {
+    fPicoMCParticles = dynamic_cast<TClonesArray*>(event->FindListObject(fPicoMCParticlesName));
+    if (!fPicoMCParticles) {
+      AliError(Form("%s: Could not retrieve MC particles %s!", GetName(), fPicoMCParticlesName.Data()));
+    }
+    fPicoMCParticlesMap = dynamic_cast<AliNamedArrayI*>(event->FindListObject(fPicoMCParticlesName + "_Map"));
   }
 }
 
@@ -149,6 +177,7 @@ void AliTrackContainer::SetArray(const AliVEvent *event)
  */
 void AliTrackContainer::NextEvent()
 {
+  AliParticleContainer::NextEvent();
   fTrackTypes.Reset(kUndefined);
   if (fEmcalTrackSelection) {
     fFilteredTracks = fEmcalTrackSelection->GetAcceptedTracks(fClArray);
@@ -182,6 +211,48 @@ void AliTrackContainer::NextEvent()
   else {
     fFilteredTracks = fClArray;
   }
+
+  if (fFillPicoTrackInfo) FillPicoTrackInfo();
+}
+
+/**
+ * Fill the fields that AliEmcalPicoTrackMaker adds to the tracks, for the
+ * tasks iterating the original tracks: EMCal acceptance on the EMCal surface
+ * and, with MC particles, the MC flag and the generator index. The track type
+ * is already in fTrackTypes. The entries follow the indices of the container.
+ */
+void AliTrackContainer::FillPicoTrackInfo()
+{
+  const Int_t n = fFilteredTracks ? fFilteredTracks->GetEntriesFast() : 0;
+  if (fTrackIsEmcal.GetSize() < n) {
+    fTrackIsEmcal.Set(n);
+    fTrackMCFlag.Set(n);
+    fTrackGeneratorIndex.Set(n);
+  }
+  fTrackIsEmcal.Reset(0);
+  fTrackMCFlag.Reset(0);
+  fTrackGeneratorIndex.Reset(-1);
+
+  for (Int_t i = 0; i < n; i++) {
+    AliVTrack* track = static_cast<AliVTrack*>(fFilteredTracks->At(i));
+    if (!track) continue;
+
+    // Same definition as in AliEmcalPicoTrackMaker
+    if (TMath::Abs(track->GetTrackEtaOnEMCal()) < 0.75 &&
+        track->GetTrackPhiOnEMCal() > 70 * TMath::DegToRad() &&
+        track->GetTrackPhiOnEMCal() < 190 * TMath::DegToRad()) {
+      fTrackIsEmcal[i] = 1;
+    }
+
+    if (!fPicoMCParticles || track->GetLabel() == 0) continue;
+    Int_t index = TMath::Abs(track->GetLabel());
+    if (fPicoMCParticlesMap) index = fPicoMCParticlesMap->At(index);
+    if (index < 0 || index >= fPicoMCParticles->GetEntriesFast()) continue;
+    AliVParticle* mcpart = static_cast<AliVParticle*>(fPicoMCParticles->At(index));
+    if (!mcpart) continue;
+    fTrackMCFlag[i] = mcpart->GetFlag();
+    fTrackGeneratorIndex[i] = mcpart->GetGeneratorIndex();
+  }
 }
 
 /**
@@ -205,9 +276,9 @@ AliVTrack* AliTrackContainer::GetTrack(Int_t i) const
  */
 AliVTrack* AliTrackContainer::GetAcceptTrack(Int_t i) const
 {
-  UInt_t rejectionReason;
+  UInt_t rejectionReason = 0;
   if (i == -1) i = fCurrentID;
-  if (AcceptTrack(i, rejectionReason)) {
+  if (AcceptObjectCached(i, rejectionReason)) {
       return GetTrack(i);
   }
   else {
@@ -7,8 +7,11 @@ class AliVEvent;
 class AliVParticle;
 class AliVCuts;
 class AliTLorentzVector;
+class AliNamedArrayI;
 
 #include <TArrayC.h>
+#include <TArrayI.h>
+#include <TArrayS.h>
 
 #include "AliVTrack.h"
 #include "AliEmcalTrackSelection.h"
@@ -74,6 +77,9 @@ class AliTrackContainer : public AliParticleContainer {
   Int_t                       GetNAcceptedTracks()                              { return GetNAcceptedParticles() ; }
   ETrackFilterType_t          GetTrackFilterType()                      const   { return fTrackFilterType; }
   Char_t                      GetTrackType(Int_t i)                     const   { return i >= 0 && i < fTrackTypes.GetSize() ? fTrackTypes[i] : (Char_t)kUndefined ; }
+  Bool_t                      IsTrackEMCAL(Int_t i)                     const   { return i >= 0 && i < fTrackIsEmcal.GetSize() ? fTrackIsEmcal[i] != 0 : kFALSE ; }
+  UInt_t                      GetTrackMCFlag(Int_t i)                   const   { return i >= 0 && i < fTrackMCFlag.GetSize() ? (UInt_t)fTrackMCFlag[i] : 0 ; }
+  Short_t                     GetTrackGeneratorIndex(Int_t i)           const   { return i >= 0 && i < fTrackGeneratorIndex.GetSize() ? fTrackGeneratorIndex[i] : (Short_t)-1 ; }
 
   void                        SetArray(const AliVEvent *event);
 
@@ -90,6 +96,8 @@ class AliTrackContainer : public AliParticleContainer {
 
   void SetSelectionModeAny() { fSelectionModeAny = kTRUE ; }
   void SetSelectionModeAll() { fSelectionModeAny = kFALSE; }
+  void                        SetUseTrackSelectionCache(Bool_t b = kTRUE)   { fUseTrackSelectionCache = b; }
+  void                        SetFillPicoTrackInfo(Bool_t b = kTRUE, const char* mcParticles = "") { fFillPicoTrackInfo = b; fPicoMCParticlesName = mcParticles; }
 
   void                        NextEvent();
 
@@ -107,6 +115,8 @@ class AliTrackContainer : public AliParticleContainer {
 #endif
 
  protected:
+  void                        FillPicoTrackInfo();
+
   static TString              fgDefTrackCutsPeriod;           //!<! default period string used to generate track cuts
 
   ETrackFilterType_t          fTrackFilterType;               ///< track filter type
@@ -114,16 +124,24 @@ class AliTrackContainer : public AliParticleContainer {
   Bool_t                      fSelectionModeAny;              ///< accept track if any of the cuts is fulfilled
   UInt_t                      fAODFilterBits;                 ///< track filter bits
   TString                     fTrackCutsPeriod;               ///< period string used to generate track cuts
+  Bool_t                      fUseTrackSelectionCache;        ///< share the track cut results with the other wagons (AliEmcalTrackSelectionCache)
   AliEmcalTrackSelection     *fEmcalTrackSelection;           //!<! track selection object
   TObjArray                  *fFilteredTracks;                //!<! tracks filtered using fEmcalTrackSelection
   TArrayC                     fTrackTypes;                    //!<! track types
+  Bool_t                      fFillPicoTrackInfo;             ///< fill the AliPicoTrack fields of the tracks in side arrays, instead of running AliEmcalPicoTrackMaker
+  TString                     fPicoMCParticlesName;           ///< MC particles the MC flag and generator index are taken from (AliEmcalPicoTrackMaker::SetCopyMCFlag)
+  TClonesArray               *fPicoMCParticles;               //!<! MC particles
+  AliNamedArrayI             *fPicoMCParticlesMap;            //!<! label to index map of the MC particles
+  TArrayC                     fTrackIsEmcal;                  //!<! track in the EMCal acceptance on the EMCal surface (AliPicoTrack::IsEMCAL)
+  TArrayI                     fTrackMCFlag;                   //!<! flag of the MC particle of the track (AliPicoTrack::GetFlag)
+  TArrayS                     fTrackGeneratorIndex;           //!<! generator index of the MC particle of the track, -1 if unknown
 
  private:
   AliTrackContainer(const AliTrackContainer& obj); // copy constructor
   AliTrackContainer& operator=(const AliTrackContainer& other); // assignment
 
   /// \cond CLASSIMP
-  ClassDef(AliTrackContainer,1);
+  ClassDef(AliTrackContainer,3);
   /// \endcond
 };
 
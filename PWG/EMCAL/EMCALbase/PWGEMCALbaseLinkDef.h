@@ -9,6 +9,7 @@
 #pragma link C++ class AliClusterContainer+;
 #pragma link C++ class AliEmcalContainer+;
 #pragma link C++ class AliEmcalDownscaleFactorsOCDB+;
+#pragma link C++ class AliEmcalPythiaCrossSectionCache+;
 #pragma link C++ class AliEmcalAODFilterBitCuts+;
 #pragma link C++ class AliEmcalESDTrackCutsGenerator+;
 #pragma link C++ class AliEmcalParticle+;
@@ -18,6 +19,8 @@
 #pragma link C++ class AliEmcalTrackSelection+;
 #pragma link C++ class AliEmcalTrackSelectionESD+;
 #pragma link C++ class AliEmcalTrackSelectionAOD+;
+#pragma link C++ class AliEmcalTrackSelectionCache+;
+#pragma link C++ class AliEmcalClusterTrackMatchTable+;
 #pragma link C++ class AliParticleContainer+;
 #pragma link C++ class AliPicoTrack+;
 #pragma link C++ class AliMCParticleContainer+;
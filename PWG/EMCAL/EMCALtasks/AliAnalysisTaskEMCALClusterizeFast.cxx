@@ -35,6 +35,7 @@
 #include "AliEMCALClusterizerv2.h"
 #include "AliEMCALClusterizerFixedWindow.h"
 #include "AliEMCALDigit.h"
+#include "AliEMCALFlatClusterizer.h"
 #include "AliEMCALGeometry.h"
 #include "AliEMCALRecParam.h"
 #include "AliEMCALRecPoint.h"
@@ -89,6 +90,9 @@ AliAnalysisTaskEMCALClusterizeFast::AliAnalysisTaskEMCALClusterizeFast() :
   fRecalDistToBadChannels(kFALSE),
   fSetCellMCLabelFromCluster(0),
   fSetCellMCLabelFromEdepFrac(0),
+  fUseFlatClusterizer(kFALSE),
+  fFlatClusterizer(0),
+  fFlatClusterized(kFALSE),
   fCaloCells(0),
   fCaloClusters(0),
   fEsd(0),
@@ -144,6 +148,9 @@ AliAnalysisTaskEMCALClusterizeFast::AliAnalysisTaskEMCALClusterizeFast(const cha
   fRecalDistToBadChannels(kFALSE),
   fSetCellMCLabelFromCluster(0),
   fSetCellMCLabelFromEdepFrac(0),
+  fUseFlatClusterizer(kFALSE),
+  fFlatClusterizer(0),
+  fFlatClusterized(kFALSE),
   fCaloCells(0),
   fCaloClusters(0),
   fEsd(0),
@@ -165,6 +172,7 @@ AliAnalysisTaskEMCALClusterizeFast::~AliAnalysisTaskEMCALClusterizeFast()
   // Destructor.
 
   delete fClusterizer;
+  delete fFlatClusterizer;
   delete fUnfolder;   
   delete fRecoUtils;
   delete fRecParam;
@@ -316,6 +324,16 @@ void AliAnalysisTaskEMCALClusterizeFast::Clusterize()
 {
   // Clusterize
 
+  fFlatClusterized = kFALSE;
+  if (fFlatClusterizer && !fSetCellMCLabelFromEdepFrac) {
+    // with background subtraction the digits are already calibrated
+    fFlatClusterizer->Clear();
+    fFlatClusterizer->AddDigits(fDigitsArr, fSubBackground ? 0 : fClusterizer);
+    fFlatClusterizer->Clusterize();
+    fFlatClusterized = kTRUE;
+    return;
+  }
+
   if (fSubBackground) {
     fClusterizer->SetInputCalibrated(kTRUE);   
     fClusterizer->SetCalibrationParameters(0);
@@ -891,6 +909,31 @@ void AliAnalysisTaskEMCALClusterizeFast::RecPoints2Clusters(TClonesArray *clus)
   }
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskEMCALClusterizeFast::FlatClusters2Clusters(TClonesArray *clus)
+{
+  // Clusters of the array based clusterizer to ESD/AOD clusters, with the same
+  // content as from the rec points.
+
+  TClonesArray *tarr = 0;
+  if (!fTrackName.IsNull()) {
+    tarr = dynamic_cast<TClonesArray*>(InputEvent()->FindListObject(fTrackName));
+    if (!tarr) {
+      AliError(Form("Cannot get tracks named %s", fTrackName.Data()));
+    }
+  }
+
+  const Int_t Ncls = fFlatClusterizer->GetNClusters();
+  AliDebug(1, Form("total no of clusters %d", Ncls)); 
+
+  for(Int_t i=0, nout=clus->GetEntries(); i < Ncls; ++i) {
+    AliVCluster *c = static_cast<AliVCluster*>(clus->New(nout++));
+    fFlatClusterizer->FillCluster(i, c);
+    if (tarr)
+      TrackClusterMatching(c, tarr);
+  }
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskEMCALClusterizeFast::UpdateCells()
 {
@@ -929,7 +972,10 @@ void AliAnalysisTaskEMCALClusterizeFast::UpdateClusters()
 
   fCaloClusters->Compress();
   
-  RecPoints2Clusters(fCaloClusters);
+  if (fFlatClusterized)
+    FlatClusters2Clusters(fCaloClusters);
+  else
+    RecPoints2Clusters(fCaloClusters);
 }
 
 //________________________________________________________________________________________
@@ -1055,6 +1101,21 @@ void AliAnalysisTaskEMCALClusterizeFast::Init()
   fClusterizer->SetOutput(0);
   fClusterArr = const_cast<TObjArray *>(fClusterizer->GetRecPoints());
 
+  // array based clusterizer, the neighbour table follows the geometry of the run
+  delete fFlatClusterizer;
+  fFlatClusterizer = 0;
+  if (fUseFlatClusterizer) {
+    fFlatClusterizer = new AliEMCALFlatClusterizer;
+    if (!fFlatClusterizer->SetParameters(fRecParam)) {
+      AliWarning(Form("Clusterizer < %d > not available in AliEMCALFlatClusterizer, using the standard one", fRecParam->GetClusterizerFlag()));
+      delete fFlatClusterizer;
+      fFlatClusterizer = 0;
+    }
+    else {
+      fFlatClusterizer->InitGeometry(fGeom);
+    }
+  }
+
   // Get the emcal cells
   if ((fInputCellType == kFEEData ||  fInputCellType == kFEEDataMCOnly || fInputCellType == kFEEDataExcludeMC) && !fCaloCells) {
     if (fCaloCellsName.IsNull()) {
@@ -26,6 +26,7 @@ class AliEMCALRecParam;
 class AliEMCALRecoUtils;
 class AliVCaloCells;
 class AliEMCALGeometry;
+class AliEMCALFlatClusterizer;
 
 #include "AliEMCALGeoParams.h"
 
@@ -100,6 +101,7 @@ class AliAnalysisTaskEMCALClusterizeFast : public AliAnalysisTaskSE {
   void                   SetDoNonLinearity(Bool_t b)                          { fDoNonLinearity              = b     ; }
   void                   SetRecalDistToBadChannels(Bool_t b)                  { fRecalDistToBadChannels      = b     ; }
   void                   SetCellMCLabelFromCluster(Int_t s)                   { fSetCellMCLabelFromCluster   = s     ; }
+  void                   SetUseFlatClusterizer(Bool_t b)                      { fUseFlatClusterizer          = b     ; }
 
   // For backward compatibility
   const TString         &GetNewClusterArrayName()                     const   { return GetCaloClustersName()         ; }
@@ -115,6 +117,7 @@ class AliAnalysisTaskEMCALClusterizeFast : public AliAnalysisTaskSE {
   virtual void           FillDigitsArray();
   virtual void           Init();
   virtual void           RecPoints2Clusters(TClonesArray *clus);
+  virtual void           FlatClusters2Clusters(TClonesArray *clus);
   virtual void           UpdateCells();
   virtual void           UpdateClusters();
   virtual void           CalibrateClusters();
@@ -172,6 +175,10 @@ class AliAnalysisTaskEMCALClusterizeFast : public AliAnalysisTaskSE {
   
   Bool_t                 fSetCellMCLabelFromEdepFrac;     // For MC generated with aliroot > v5-07-21, check the EDep information 
                                                           // stored in ESDs/AODs to set the cell MC labels
+
+  Bool_t                 fUseFlatClusterizer;             // clusterize with AliEMCALFlatClusterizer (v1, v2 and NxN, without the edep fraction labels)
+  AliEMCALFlatClusterizer *fFlatClusterizer;              //!array based clusterizer
+  Bool_t                 fFlatClusterized;                //!clusters of the current event made by fFlatClusterizer
   
   AliVCaloCells         *fCaloCells;                      //!calo cells object
   TClonesArray          *fCaloClusters;                   //!calo clusters array       
@@ -183,6 +190,6 @@ class AliAnalysisTaskEMCALClusterizeFast : public AliAnalysisTaskSE {
   AliAnalysisTaskEMCALClusterizeFast(const AliAnalysisTaskEMCALClusterizeFast&);            // not implemented
   AliAnalysisTaskEMCALClusterizeFast &operator=(const AliAnalysisTaskEMCALClusterizeFast&); // not implemented
 
-  ClassDef(AliAnalysisTaskEMCALClusterizeFast, 10);
+  ClassDef(AliAnalysisTaskEMCALClusterizeFast, 11);
 };
 #endif //ALIANALYSISTASKEMCALCLUSTERIZEFAST_H
@@ -19,6 +19,9 @@
  * Author: Markus Fasel
  */
 
+#include <vector>
+
+#include "AliEMCALTriggerPatchInfo.h"
 #include "AliEmcalTriggerDecision.h"
 #include "AliEmcalTriggerDecisionContainer.h"
 #include "AliEmcalTriggerSelection.h"
@@ -63,16 +66,28 @@ void AliAnalysisTaskEmcalTriggerSelection::AddTriggerSelection(AliEmcalTriggerSe
 //______________________________________________________________________________
 Bool_t AliAnalysisTaskEmcalTriggerSelection::Run(){
   /*
-   * Run over all trigger selections, and append the selection to the global trigger selection container
+   * Run over all trigger selections, and append the selection to the global trigger selection container.
+   * All selections are evaluated in a single loop over the trigger patches, the decisions are the same
+   * as from AliEmcalTriggerSelection::MakeDecison for each selection.
    */
   AliEmcalTriggerDecisionContainer *cont = GetGlobalTriggerDecisionContainer();
   cont->Reset();
-  TClonesArray *triggerPatches(fTriggerPatchInfo);
+  std::vector<AliEmcalTriggerSelection *> selections;
+  std::vector<AliEmcalTriggerDecision *> decisions;
   TIter selectionIter(&fTriggerSelections);
   AliEmcalTriggerSelection *selection(NULL);
   while((selection = dynamic_cast<AliEmcalTriggerSelection *>(selectionIter()))){
-    cont->AddTriggerDecision(selection->MakeDecison(triggerPatches));
+    selections.push_back(selection);
+    decisions.push_back(selection->CreateDecision());
+  }
+  if(fTriggerPatchInfo && selections.size()){
+    TIter patchIter(fTriggerPatchInfo);
+    AliEMCALTriggerPatchInfo *patch(NULL);
+    while((patch = dynamic_cast<AliEMCALTriggerPatchInfo *>(patchIter()))){
+      for(size_t isel = 0; isel < selections.size(); isel++) selections[isel]->AddPatch(decisions[isel], patch);
+    }
   }
+  for(size_t isel = 0; isel < decisions.size(); isel++) cont->AddTriggerDecision(decisions[isel]);
   return kTRUE;
 }
 
@@ -0,0 +1,442 @@
+// Array based EMCal clusterizer, see the header for the differences with the
+// AliEMCALClusterizer classes.
+
+#include <algorithm>
+#include <utility>
+
+#include <TClonesArray.h>
+#include <TMath.h>
+
+#include "AliEMCALClusterizer.h"
+#include "AliEMCALDigit.h"
+#include "AliEMCALGeoParams.h"
+#include "AliEMCALGeometry.h"
+#include "AliEMCALRecParam.h"
+#include "AliLog.h"
+#include "AliVCluster.h"
+
+#include "AliEMCALFlatClusterizer.h"
+
+ClassImp(AliEMCALFlatClusterizer)
+
+namespace {
+  // Order of the seeds: decreasing energy, then increasing cell index
+  struct SeedOrder {
+    const std::vector<Float_t>& fE;
+    SeedOrder(const std::vector<Float_t>& e) : fE(e) {}
+    bool operator()(Int_t a, Int_t b) const { return fE[a] != fE[b] ? fE[a] > fE[b] : a < b; }
+  };
+
+  // Order of the labels: decreasing deposited energy
+  bool LabelOrder(const std::pair<Int_t, Double_t>& a, const std::pair<Int_t, Double_t>& b)
+  {
+    return a.second != b.second ? a.second > b.second : a.first < b.first;
+  }
+}
+
+//________________________________________________________________________
+AliEMCALFlatClusterizer::AliEMCALFlatClusterizer() :
+  TObject(),
+  fAlgorithm(kV1),
+  fSeedE(0.1),
+  fMinE(0.05),
+  fTimeCut(1.),
+  fTimeMin(-1.),
+  fTimeMax(1.),
+  fW0(4.5),
+  fLocMaxCut(0.03),
+  fNRowDiff(1),
+  fNColDiff(1),
+  fNCells(0),
+  fNRows(AliEMCALGeoParams::fgkEMCALRows),
+  fNCols(AliEMCALGeoParams::fgkEMCALCols),
+  fSM(),
+  fRow(),
+  fCol(),
+  fXYZ(),
+  fNeighbours(),
+  fGrid(),
+  fCellId(),
+  fCellE(),
+  fCellT(),
+  fCellLabel(),
+  fCellMCDE(),
+  fCellOfId(),
+  fCellCluster(),
+  fClusterFirst(1, 0),
+  fClusterCells(),
+  fClusterE(),
+  fClusterTime(),
+  fClusterPos(),
+  fClusterDisp(),
+  fClusterM02(),
+  fClusterM20(),
+  fClusterNExMax(),
+  fClusterMCE(),
+  fLabelFirst(1, 0),
+  fLabels()
+{
+  // Constructor.
+}
+
+//________________________________________________________________________
+void AliEMCALFlatClusterizer::InitGeometry(const AliEMCALGeometry* geom)
+{
+  // Cell indices, global positions and neighbour table of the geometry.
+  // To be called again when the alignment matrices change.
+
+  Clear();
+  fNCells = geom->GetNCells();
+  const Int_t nSM = geom->GetNumberOfSuperModules();
+
+  fSM.assign(fNCells, -1);
+  fRow.assign(fNCells, -1);
+  fCol.assign(fNCells, -1);
+  fXYZ.assign(3 * fNCells, 0);
+  fGrid.assign(nSM * fNRows * fNCols, -1);
+  fCellOfId.assign(fNCells, -1);
+
+  for (Int_t absId = 0; absId < fNCells; ++absId) {
+    Int_t nSupMod = -1, nModule = -1, nIphi = -1, nIeta = -1, iphi = -1, ieta = -1;
+    if (!geom->GetCellIndex(absId, nSupMod, nModule, nIphi, nIeta))
+      continue;
+    geom->GetCellPhiEtaIndexInSModule(nSupMod, nModule, nIphi, nIeta, iphi, ieta);
+    if (nSupMod < 0 || nSupMod >= nSM || iphi < 0 || iphi >= fNRows || ieta < 0 || ieta >= fNCols)
+      continue;
+    fSM[absId] = nSupMod;
+    fRow[absId] = iphi;
+    fCol[absId] = ieta;
+    fGrid[(nSupMod * fNRows + iphi) * fNCols + ieta] = absId;
+
+    Double_t glob[3] = {0, 0, 0};
+    geom->GetGlobal(absId, glob);
+    fXYZ[3*absId] = glob[0];
+    fXYZ[3*absId+1] = glob[1];
+    fXYZ[3*absId+2] = glob[2];
+  }
+
+  fNeighbours.assign(8 * fNCells, -1);
+  for (Int_t absId = 0; absId < fNCells; ++absId) {
+    if (fSM[absId] < 0)
+      continue;
+    Int_t n = 0;
+    for (Int_t drow = -1; drow <= 1; ++drow) {
+      for (Int_t dcol = -1; dcol <= 1; ++dcol) {
+        if (drow == 0 && dcol == 0)
+          continue;
+        const Int_t row = fRow[absId] + drow;
+        const Int_t col = fCol[absId] + dcol;
+        if (row < 0 || row >= fNRows || col < 0 || col >= fNCols)
+          continue;
+        const Int_t id = fGrid[(fSM[absId] * fNRows + row) * fNCols + col];
+        if (id >= 0)
+          fNeighbours[8*absId + n++] = id;
+      }
+    }
+  }
+}
+
+//________________________________________________________________________
+Bool_t AliEMCALFlatClusterizer::SetParameters(const AliEMCALRecParam* recParam)
+{
+  // Algorithm and thresholds from the reconstruction parameters.
+  // Returns false for the algorithms not available here.
+
+  if (recParam->GetClusterizerFlag() == AliEMCALRecParam::kClusterizerv1)
+    fAlgorithm = kV1;
+  else if (recParam->GetClusterizerFlag() == AliEMCALRecParam::kClusterizerv2)
+    fAlgorithm = kV2;
+  else if (recParam->GetClusterizerFlag() == AliEMCALRecParam::kClusterizerNxN)
+    fAlgorithm = kNxN;
+  else
+    return kFALSE;
+
+  fSeedE = recParam->GetClusteringThreshold();
+  fMinE = recParam->GetMinECut();
+  fTimeCut = recParam->GetTimeCut();
+  fTimeMin = recParam->GetTimeMin();
+  fTimeMax = recParam->GetTimeMax();
+  fW0 = recParam->GetW0();
+  fLocMaxCut = recParam->GetLocMaxCut();
+  fNRowDiff = recParam->GetNRowDiff();
+  fNColDiff = recParam->GetNColDiff();
+  return kTRUE;
+}
+
+//________________________________________________________________________
+void AliEMCALFlatClusterizer::Clear(Option_t* /*option*/)
+{
+  // Remove the cells and the clusters of the event, the storage is kept.
+
+  for (UInt_t i = 0; i < fCellId.size(); ++i)
+    fCellOfId[fCellId[i]] = -1;
+  fCellId.clear();
+  fCellE.clear();
+  fCellT.clear();
+  fCellLabel.clear();
+  fCellMCDE.clear();
+  fCellCluster.clear();
+
+  fClusterFirst.assign(1, 0);
+  fClusterCells.clear();
+  fClusterE.clear();
+  fClusterTime.clear();
+  fClusterPos.clear();
+  fClusterDisp.clear();
+  fClusterM02.clear();
+  fClusterM20.clear();
+  fClusterNExMax.clear();
+  fClusterMCE.clear();
+  fLabelFirst.assign(1, 0);
+  fLabels.clear();
+}
+
+//________________________________________________________________________
+void AliEMCALFlatClusterizer::AddCell(Int_t absId, Float_t e, Float_t time, Int_t label, Float_t mcDE)
+{
+  // Add a calibrated cell to the event, a cell id given twice is ignored.
+
+  if (absId < 0 || absId >= fNCells || fSM[absId] < 0) {
+    AliWarning(Form("Cell %d not in the geometry, ignored", absId));
+    return;
+  }
+  if (fCellOfId[absId] >= 0)
+    return;
+  fCellOfId[absId] = fCellId.size();
+  fCellId.push_back(absId);
+  fCellE.push_back(e);
+  fCellT.push_back(time);
+  fCellLabel.push_back(label);
+  fCellMCDE.push_back(mcDE);
+}
+
+//________________________________________________________________________
+void AliEMCALFlatClusterizer::AddDigits(const TClonesArray* digits, AliEMCALClusterizer* calibration)
+{
+  // Add the digits as cells, calibrated with the calibration of the clusterizer if given.
+
+  const Int_t ndigits = digits->GetEntriesFast();
+  for (Int_t i = 0; i < ndigits; ++i) {
+    const AliEMCALDigit* digit = static_cast<const AliEMCALDigit*>(digits->At(i));
+    if (!digit)
+      continue;
+    Float_t energy = digit->GetAmplitude();
+    Float_t time = digit->GetTime();
+    if (calibration)
+      calibration->Calibrate(energy, time, digit->GetId());
+    const Int_t label = digit->GetIparent(1);
+    AddCell(digit->GetId(), energy, time, label, label > 0 ? digit->GetDEParent(1) : 0);
+  }
+}
+
+//________________________________________________________________________
+Bool_t AliEMCALFlatClusterizer::IsUsable(Int_t icell) const
+{
+  // Cell above the minimum energy and in the time window, not yet in a cluster.
+
+  return fCellCluster[icell] < 0 && fCellE[icell] > fMinE && fCellT[icell] >= fTimeMin && fCellT[icell] <= fTimeMax;
+}
+
+//________________________________________________________________________
+Int_t AliEMCALFlatClusterizer::Clusterize()
+{
+  // Make the clusters of the cells of the event, returns the number of clusters.
+
+  const Int_t ncells = fCellId.size();
+  fCellCluster.assign(ncells, -1);
+
+  std::vector<Int_t> seeds;
+  seeds.reserve(ncells);
+  for (Int_t i = 0; i < ncells; ++i) {
+    if (fCellE[i] > fSeedE && IsUsable(i))
+      seeds.push_back(i);
+  }
+  std::sort(seeds.begin(), seeds.end(), SeedOrder(fCellE));
+
+  for (UInt_t s = 0; s < seeds.size(); ++s) {
+    const Int_t seed = seeds[s];
+    if (fCellCluster[seed] >= 0)
+      continue;
+
+    const Int_t icluster = fClusterE.size();
+    const Int_t first = fClusterCells.size();
+    fClusterCells.push_back(seed);
+    fCellCluster[seed] = icluster;
+
+    if (fAlgorithm == kNxN) {
+      const Int_t seedId = fCellId[seed];
+      for (Int_t drow = -fNRowDiff; drow <= fNRowDiff; ++drow) {
+        for (Int_t dcol = -fNColDiff; dcol <= fNColDiff; ++dcol) {
+          const Int_t row = fRow[seedId] + drow;
+          const Int_t col = fCol[seedId] + dcol;
+          if (row < 0 || row >= fNRows || col < 0 || col >= fNCols)
+            continue;
+          const Int_t id = fGrid[(fSM[seedId] * fNRows + row) * fNCols + col];
+          if (id < 0)
+            continue;
+          const Int_t j = fCellOfId[id];
+          if (j < 0 || !IsUsable(j) || TMath::Abs(fCellT[j] - fCellT[seed]) > fTimeCut)
+            continue;
+          fClusterCells.push_back(j);
+          fCellCluster[j] = icluster;
+        }
+      }
+    }
+    else {
+      // Breadth first growth, fClusterCells is the queue
+      for (UInt_t next = first; next < fClusterCells.size(); ++next) {
+        const Int_t i = fClusterCells[next];
+        const Int_t* neighbours = &fNeighbours[8*fCellId[i]];
+        for (Int_t k = 0; k < 8 && neighbours[k] >= 0; ++k) {
+          const Int_t j = fCellOfId[neighbours[k]];
+          if (j < 0 || !IsUsable(j) || TMath::Abs(fCellT[j] - fCellT[i]) > fTimeCut)
+            continue;
+          if (fAlgorithm == kV2 && fCellE[j] > fCellE[i])
+            continue;
+          fClusterCells.push_back(j);
+          fCellCluster[j] = icluster;
+        }
+      }
+    }
+
+    Evaluate(first, fClusterCells.size());
+    fClusterFirst.push_back(fClusterCells.size());
+  }
+
+  return fClusterE.size();
+}
+
+//________________________________________________________________________
+void AliEMCALFlatClusterizer::Evaluate(Int_t first, Int_t last)
+{
+  // Energy, time, position, shower shape, local maxima and MC labels of the
+  // cluster made of fClusterCells[first, last).
+
+  Double_t energy = 0;
+  Int_t leading = fClusterCells[first];
+  for (Int_t k = first; k < last; ++k) {
+    const Int_t i = fClusterCells[k];
+    energy += fCellE[i];
+    if (fCellE[i] > fCellE[leading])
+      leading = i;
+  }
+
+  // Log weights, energy weights if no cell passes (w0 too small)
+  Double_t sumw = 0;
+  for (Int_t k = first; k < last; ++k) {
+    const Int_t i = fClusterCells[k];
+    sumw += TMath::Max(0., fW0 + TMath::Log(fCellE[i] / energy));
+  }
+  const Bool_t logWeights = sumw > 0;
+  if (!logWeights)
+    sumw = energy;
+
+  Double_t x = 0, y = 0, z = 0;
+  Double_t col = 0, row = 0, col2 = 0, row2 = 0, colrow = 0;
+  Double_t mcE = 0;
+  std::vector<std::pair<Int_t, Double_t> > labels;
+  for (Int_t k = first; k < last; ++k) {
+    const Int_t i = fClusterCells[k];
+    const Int_t id = fCellId[i];
+    const Double_t w = logWeights ? TMath::Max(0., fW0 + TMath::Log(fCellE[i] / energy)) : fCellE[i];
+    x += w * fXYZ[3*id];
+    y += w * fXYZ[3*id+1];
+    z += w * fXYZ[3*id+2];
+    col += w * fCol[id];
+    row += w * fRow[id];
+    col2 += w * fCol[id] * fCol[id];
+    row2 += w * fRow[id] * fRow[id];
+    colrow += w * fCol[id] * fRow[id];
+    mcE += fCellMCDE[i];
+    if (fCellLabel[i] >= 0)
+      labels.push_back(std::make_pair(fCellLabel[i], (Double_t)fCellE[i]));
+  }
+  x /= sumw; y /= sumw; z /= sumw;
+  col /= sumw; row /= sumw;
+  const Double_t dxx = col2 / sumw - col * col;
+  const Double_t dzz = row2 / sumw - row * row;
+  const Double_t dxz = colrow / sumw - col * row;
+  const Double_t root = TMath::Sqrt(0.25 * (dxx - dzz) * (dxx - dzz) + dxz * dxz);
+
+  // Local maxima: larger than all the neighbour cells of the cluster by fLocMaxCut
+  Int_t nExMax = 0;
+  for (Int_t k = first; k < last; ++k) {
+    const Int_t i = fClusterCells[k];
+    const Int_t id = fCellId[i];
+    Bool_t isMax = kTRUE;
+    for (Int_t l = first; l < last && isMax; ++l) {
+      const Int_t j = fClusterCells[l];
+      const Int_t jd = fCellId[j];
+      if (j == i || fSM[jd] != fSM[id] || TMath::Abs(fRow[jd] - fRow[id]) > 1 || TMath::Abs(fCol[jd] - fCol[id]) > 1)
+        continue;
+      if (fCellE[i] - fCellE[j] <= fLocMaxCut)
+        isMax = kFALSE;
+    }
+    if (isMax)
+      ++nExMax;
+  }
+
+  fClusterE.push_back(energy);
+  fClusterTime.push_back(fCellT[leading]);
+  fClusterPos.push_back(x);
+  fClusterPos.push_back(y);
+  fClusterPos.push_back(z);
+  // Dispersion is the sqrt of the trace of the covariance in cell units
+  fClusterDisp.push_back(TMath::Sqrt(TMath::Max(0., dxx + dzz)));
+  fClusterM02.push_back(TMath::Max(0., 0.5 * (dxx + dzz) + root));
+  fClusterM20.push_back(TMath::Max(0., 0.5 * (dxx + dzz) - root));
+  fClusterNExMax.push_back(nExMax);
+  fClusterMCE.push_back(energy > 0 ? mcE / energy : 0);
+
+  // Labels summed over the cells, by decreasing energy
+  std::sort(labels.begin(), labels.end());
+  std::vector<std::pair<Int_t, Double_t> > merged;
+  for (UInt_t k = 0; k < labels.size(); ++k) {
+    if (!merged.empty() && merged.back().first == labels[k].first)
+      merged.back().second += labels[k].second;
+    else
+      merged.push_back(labels[k]);
+  }
+  std::sort(merged.begin(), merged.end(), LabelOrder);
+  for (UInt_t k = 0; k < merged.size(); ++k)
+    fLabels.push_back(merged[k].first);
+  fLabelFirst.push_back(fLabels.size());
+}
+
+//________________________________________________________________________
+void AliEMCALFlatClusterizer::FillCluster(Int_t i, AliVCluster* c) const
+{
+  // Set the content of the calo cluster c from cluster i, as done from the
+  // rec points in AliAnalysisTaskEMCALClusterizeFast::RecPoints2Clusters.
+
+  const Int_t ncells = GetClusterNCells(i);
+  std::vector<UShort_t> absIds(ncells);
+  std::vector<Double32_t> ratios(ncells, 1.);
+  for (Int_t j = 0; j < ncells; ++j)
+    absIds[j] = GetClusterCellId(i, j);
+
+  Float_t pos[3];
+  GetClusterPosition(i, pos);
+
+  c->SetType(AliVCluster::kEMCALClusterv1);
+  c->SetE(fClusterE[i]);
+  c->SetPosition(pos);
+  c->SetNCells(ncells);
+  c->SetCellsAbsId(&absIds[0]);
+  c->SetCellsAmplitudeFraction(&ratios[0]);
+  c->SetID(i);
+  c->SetDispersion(fClusterDisp[i]);
+  c->SetEmcCpvDistance(-1);
+  c->SetChi2(-1);
+  c->SetTOF(fClusterTime[i]);
+  c->SetNExMax(fClusterNExMax[i]);
+  c->SetM02(fClusterM02[i]);
+  c->SetM20(fClusterM20[i]);
+  c->SetMCEnergyFraction(fClusterMCE[i]);
+
+  const Int_t nlabels = fLabelFirst[i+1] - fLabelFirst[i];
+  if (nlabels > 0) {
+    std::vector<Int_t> labels(fLabels.begin() + fLabelFirst[i], fLabels.begin() + fLabelFirst[i+1]);
+    c->SetLabel(&labels[0], nlabels);
+  }
+}
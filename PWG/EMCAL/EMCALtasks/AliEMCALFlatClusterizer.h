@@ -0,0 +1,132 @@
+#ifndef ALIEMCALFLATCLUSTERIZER_H
+#define ALIEMCALFLATCLUSTERIZER_H
+
+//_________________________________________________________________________
+///
+/// \class AliEMCALFlatClusterizer
+/// \brief Array based EMCal clusterizer for the reclusterization in analysis
+///
+/// Clusterizes the cells of an event given as flat arrays of cell id, energy
+/// and time, with a neighbour table of the cells computed once per geometry.
+/// The v1 (connected cells), v2 (connected cells with decreasing energy from
+/// the seed) and NxN (rectangle around the seed) algorithms are available.
+/// The seeds are processed by decreasing energy, the clusters are grown with
+/// an explicit queue and the cluster quantities (energy, log weighted position,
+/// time of the leading cell, dispersion, M02, M20, number of local maxima,
+/// MC labels) are evaluated in one pass over the cells of each cluster.
+///
+/// The thresholds are the ones of AliEMCALRecParam. Differences with respect
+/// to AliEMCALClusterizerv1/v2/NxN and AliEMCALRecPoint:
+///  - the clusters do not extend over two supermodules,
+///  - the position is the log weighted mean of the cell centres, without the
+///    shower depth correction,
+///  - the clusters are ordered by the energy of their seed.
+///
+//_________________________________________________________________________
+
+#include <vector>
+
+#include <TObject.h>
+
+class TClonesArray;
+class AliVCluster;
+class AliEMCALGeometry;
+class AliEMCALRecParam;
+class AliEMCALClusterizer;
+
+class AliEMCALFlatClusterizer : public TObject {
+ public:
+  enum EAlgorithm_t {
+    kV1 = 0,     ///< connected cells
+    kV2,         ///< connected cells, energy decreasing from the seed
+    kNxN         ///< cells in a rectangle around the seed
+  };
+
+  AliEMCALFlatClusterizer();
+  virtual ~AliEMCALFlatClusterizer() {}
+
+  void                   InitGeometry(const AliEMCALGeometry* geom);
+  Bool_t                 SetParameters(const AliEMCALRecParam* recParam);
+  void                   SetAlgorithm(EAlgorithm_t a)            { fAlgorithm = a; }
+  void                   SetThresholds(Float_t seedE, Float_t minE)              { fSeedE = seedE; fMinE = minE; }
+  void                   SetTimeCuts(Float_t timeCut, Float_t timeMin, Float_t timeMax) { fTimeCut = timeCut; fTimeMin = timeMin; fTimeMax = timeMax; }
+  void                   SetW0(Float_t w0)                       { fW0 = w0; }
+  void                   SetLocMaxCut(Float_t cut)               { fLocMaxCut = cut; }
+  void                   SetNxN(Int_t nRowDiff, Int_t nColDiff)  { fNRowDiff = nRowDiff; fNColDiff = nColDiff; }
+
+  virtual void           Clear(Option_t* option="");
+  void                   AddCell(Int_t absId, Float_t e, Float_t time, Int_t label = -1, Float_t mcDE = 0);
+  void                   AddDigits(const TClonesArray* digits, AliEMCALClusterizer* calibration = 0);
+  Int_t                  Clusterize();
+
+  Int_t                  GetNCells()                       const { return fCellId.size()                                  ; }
+  Int_t                  GetNClusters()                    const { return fClusterE.size()                                ; }
+  Int_t                  GetClusterNCells(Int_t i)         const { return fClusterFirst[i+1] - fClusterFirst[i]           ; }
+  Int_t                  GetClusterCell(Int_t i, Int_t j)  const { return fClusterCells[fClusterFirst[i] + j]             ; }
+  Int_t                  GetClusterCellId(Int_t i, Int_t j) const { return fCellId[GetClusterCell(i, j)]                  ; }
+  Double_t               GetClusterE(Int_t i)              const { return fClusterE[i]                                    ; }
+  Double_t               GetClusterTime(Int_t i)           const { return fClusterTime[i]                                 ; }
+  Double_t               GetClusterDispersion(Int_t i)     const { return fClusterDisp[i]                                 ; }
+  Double_t               GetClusterM02(Int_t i)            const { return fClusterM02[i]                                  ; }
+  Double_t               GetClusterM20(Int_t i)            const { return fClusterM20[i]                                  ; }
+  Int_t                  GetClusterNExMax(Int_t i)         const { return fClusterNExMax[i]                               ; }
+  Double_t               GetClusterMCEnergyFraction(Int_t i) const { return fClusterMCE[i]                                ; }
+  void                   GetClusterPosition(Int_t i, Float_t pos[3]) const { pos[0] = fClusterPos[3*i]; pos[1] = fClusterPos[3*i+1]; pos[2] = fClusterPos[3*i+2]; }
+
+  void                   FillCluster(Int_t i, AliVCluster* c) const;
+
+ private:
+  AliEMCALFlatClusterizer(const AliEMCALFlatClusterizer&);            // not implemented
+  AliEMCALFlatClusterizer &operator=(const AliEMCALFlatClusterizer&); // not implemented
+
+  Bool_t                 IsUsable(Int_t icell)             const;
+  void                   Evaluate(Int_t first, Int_t last);
+
+  EAlgorithm_t           fAlgorithm;      // clusterization algorithm
+  Float_t                fSeedE;          // minimum energy of the seed cells
+  Float_t                fMinE;           // minimum energy of the cells
+  Float_t                fTimeCut;        // maximum time difference between neighbour cells (NxN: with the seed)
+  Float_t                fTimeMin;        // minimum time of the cells
+  Float_t                fTimeMax;        // maximum time of the cells
+  Float_t                fW0;             // parameter of the log weights of the position and of the shower shape
+  Float_t                fLocMaxCut;      // minimum energy difference of a local maximum with its neighbours
+  Int_t                  fNRowDiff;       // NxN: half size of the rectangle in rows
+  Int_t                  fNColDiff;       // NxN: half size of the rectangle in columns
+
+  // Geometry, per absolute cell id
+  Int_t                  fNCells;         //! number of cells of the geometry
+  Int_t                  fNRows;          //! maximum number of rows of a supermodule
+  Int_t                  fNCols;          //! maximum number of columns of a supermodule
+  std::vector<Short_t>   fSM;             //! supermodule of each cell
+  std::vector<Short_t>   fRow;            //! row (phi index) in the supermodule
+  std::vector<Short_t>   fCol;            //! column (eta index) in the supermodule
+  std::vector<Float_t>   fXYZ;            //! global position of the cell centres, 3 per cell
+  std::vector<Int_t>     fNeighbours;     //! neighbours of each cell (common side or corner), 8 per cell, -1 if none
+  std::vector<Int_t>     fGrid;           //! absolute id of each (supermodule, row, column), -1 if none
+
+  // Cells of the event
+  std::vector<Int_t>     fCellId;         //! absolute id
+  std::vector<Float_t>   fCellE;          //! energy
+  std::vector<Float_t>   fCellT;          //! time
+  std::vector<Int_t>     fCellLabel;      //! MC label, -1 if none
+  std::vector<Float_t>   fCellMCDE;       //! energy deposited by the first MC parent
+  std::vector<Int_t>     fCellOfId;       //! cell of the event of each absolute id, -1 if none
+  std::vector<Int_t>     fCellCluster;    //! cluster of each cell, -1 if not clustered
+
+  // Clusters of the event
+  std::vector<Int_t>     fClusterFirst;   //! first cell of each cluster in fClusterCells, one more entry for the end
+  std::vector<Int_t>     fClusterCells;   //! cells of the clusters, the seed first
+  std::vector<Double_t>  fClusterE;       //! energy
+  std::vector<Double_t>  fClusterTime;    //! time of the leading cell
+  std::vector<Float_t>   fClusterPos;     //! global position, 3 per cluster
+  std::vector<Double_t>  fClusterDisp;    //! dispersion
+  std::vector<Double_t>  fClusterM02;     //! long axis squared
+  std::vector<Double_t>  fClusterM20;     //! short axis squared
+  std::vector<Int_t>     fClusterNExMax;  //! number of local maxima
+  std::vector<Double_t>  fClusterMCE;     //! MC energy fraction
+  std::vector<Int_t>     fLabelFirst;     //! first label of each cluster in fLabels, one more entry for the end
+  std::vector<Int_t>     fLabels;         //! MC labels of the clusters, by decreasing deposited energy
+
+  ClassDef(AliEMCALFlatClusterizer, 0); // Array based EMCal clusterizer
+};
+#endif
@@ -27,6 +27,7 @@
 
 #include "AliEMCALGeometry.h"
 #include "AliEmcalCellMonitorTask.h"
+#include "AliEmcalChannelStatistics.h"
 #include "AliInputEventHandler.h"
 #include "AliLog.h"
 #include "AliOADBContainer.h"
@@ -48,7 +49,11 @@ AliEmcalCellMonitorTask::AliEmcalCellMonitorTask() :
    fTriggerString(""),
    fNumberOfCells(12288),
    fOldRun(-1),
-   fMaskedCells()
+   fMaskedCells(),
+   fFillChannelStatistics(kFALSE),
+   fFillCellHistograms(kTRUE),
+   fCellAmplitudeStat(nullptr),
+   fCellTimeStat(nullptr)
 {
 
 }
@@ -64,7 +69,11 @@ AliEmcalCellMonitorTask::AliEmcalCellMonitorTask(const char *name) :
    fTriggerString(""),
    fNumberOfCells(12288),
    fOldRun(-1),
-   fMaskedCells()
+   fMaskedCells(),
+   fFillChannelStatistics(kFALSE),
+   fFillCellHistograms(kTRUE),
+   fCellAmplitudeStat(nullptr),
+   fCellTimeStat(nullptr)
 {
   DefineOutput(1, TList::Class());
 }
@@ -123,13 +132,17 @@ void AliEmcalCellMonitorTask::UserExec(Option_t *){
   for(int icell = 0; icell < emcalcells->GetNumberOfCells(); icell++){
     emcalcells->GetCell(icell, cellNumber, amplitude, celltime, mclabel, efrac);
     if(IsCellMasked(cellNumber)) continue;
-    fHistManager->FillTH2("cellAmplitude", amplitude, cellNumber);
+    if(fCellAmplitudeStat) fCellAmplitudeStat->Fill(cellNumber, amplitude);
+    if(fFillCellHistograms) fHistManager->FillTH2("cellAmplitude", amplitude, cellNumber);
     if(amplitude < fMinCellAmplitude) continue;
-    fHistManager->FillTH1("cellAmplitudeCut", amplitude, cellNumber);
     fHistManager->FillTH1("cellFrequency", cellNumber);
-    fHistManager->FillTH2("cellTime", celltime, cellNumber);
-    if(celltime >= 1e-6) fHistManager->FillTH2("cellTimeOutlier", celltime, cellNumber);
-    if(celltime > -5e-8 && celltime < 1e-7) fHistManager->FillTH2("cellTimeMain", celltime, cellNumber);
+    if(fCellTimeStat) fCellTimeStat->Fill(cellNumber, celltime);
+    if(fFillCellHistograms){
+      fHistManager->FillTH1("cellAmplitudeCut", amplitude, cellNumber);
+      fHistManager->FillTH2("cellTime", celltime, cellNumber);
+      if(celltime >= 1e-6) fHistManager->FillTH2("cellTimeOutlier", celltime, cellNumber);
+      if(celltime > -5e-8 && celltime < 1e-7) fHistManager->FillTH2("cellTimeMain", celltime, cellNumber);
+    }
 
     // Get Cell index in eta-phi of sm
     fGeometry->GetCellIndex(cellNumber, sm, mod, mphi, meta);
@@ -150,7 +163,7 @@ void AliEmcalCellMonitorTask::UserExec(Option_t *){
         if(!myclust) continue;
         for(int icell = 0; icell < myclust->GetNCells(); icell++){
           fHistManager->FillTH1("cellClusterOccurrency", myclust->GetCellAbsId(icell));
-          fHistManager->FillTH2("cellAmplitudeFractionCluster", myclust->GetCellAbsId(icell), myclust->GetCellAmplitudeFraction(icell));
+          if(fFillCellHistograms) fHistManager->FillTH2("cellAmplitudeFractionCluster", myclust->GetCellAbsId(icell), myclust->GetCellAmplitudeFraction(icell));
         }
       }
     } else {
@@ -164,13 +177,24 @@ void AliEmcalCellMonitorTask::CreateHistograms(){
   fHistManager->CreateTH1("events", "Number of events", 1, 0.5, 1.5);
   fHistManager->CreateTH1("cellMasking", "Monitoring for masked cells", TLinearBinning(fNumberOfCells, -0.5, fNumberOfCells - 0.5));
   fHistManager->CreateTH1("cellFrequency", "Frequency of cell firing", TLinearBinning(fNumberOfCells, -0.5, fNumberOfCells - 0.5));
-  fHistManager->CreateTH2("cellAmplitude", "Energy distribution per cell", AliEmcalCellMonitorAmplitudeBinning(), TLinearBinning(fNumberOfCells, -0.5, fNumberOfCells - 0.5));
-  fHistManager->CreateTH2("cellAmplitudeCut", "Energy distribution per cell (after energy cut)", AliEmcalCellMonitorAmplitudeBinning(), TLinearBinning(fNumberOfCells, -0.5, fNumberOfCells - 0.5));
-  fHistManager->CreateTH2("cellTime", "Time distribution per cell", 300, -3e-7, 1e-6, fNumberOfCells, -0.5, fNumberOfCells - 0.5);
-  fHistManager->CreateTH2("cellTimeOutlier", "Outlier time distribution per cell", 100, 1e-6, 5e-5, fNumberOfCells, -0.5, fNumberOfCells - 0.5);
-  fHistManager->CreateTH2("cellTimeMain", "Time distribution per cell for the main bunch", 150, -50e-9, 100e-9, fNumberOfCells, -0.5, fNumberOfCells - 0.5);
+  if(fFillCellHistograms){
+    fHistManager->CreateTH2("cellAmplitude", "Energy distribution per cell", AliEmcalCellMonitorAmplitudeBinning(), TLinearBinning(fNumberOfCells, -0.5, fNumberOfCells - 0.5));
+    fHistManager->CreateTH2("cellAmplitudeCut", "Energy distribution per cell (after energy cut)", AliEmcalCellMonitorAmplitudeBinning(), TLinearBinning(fNumberOfCells, -0.5, fNumberOfCells - 0.5));
+    fHistManager->CreateTH2("cellTime", "Time distribution per cell", 300, -3e-7, 1e-6, fNumberOfCells, -0.5, fNumberOfCells - 0.5);
+    fHistManager->CreateTH2("cellTimeOutlier", "Outlier time distribution per cell", 100, 1e-6, 5e-5, fNumberOfCells, -0.5, fNumberOfCells - 0.5);
+    fHistManager->CreateTH2("cellTimeMain", "Time distribution per cell for the main bunch", 150, -50e-9, 100e-9, fNumberOfCells, -0.5, fNumberOfCells - 0.5);
+  }
   fHistManager->CreateTH1("cellClusterOccurrency", "Occurrency of a cell in clusters", fNumberOfCells, -0.5, fNumberOfCells - 0.5);
-  fHistManager->CreateTH2("cellAmplitudeFractionCluster", "Summed cell amplitude fraction in a cluster", fNumberOfCells, -0.5, fNumberOfCells - 0.5, 200, 0., 200.);
+  if(fFillCellHistograms) fHistManager->CreateTH2("cellAmplitudeFractionCluster", "Summed cell amplitude fraction in a cluster", fNumberOfCells, -0.5, fNumberOfCells - 0.5, 200, 0., 200.);
+  if(fFillChannelStatistics){
+    // Per cell summaries, in the output list next to the histograms
+    fCellAmplitudeStat = new AliEmcalChannelStatistics("cellAmplitudeStat", "Cell amplitude");
+    fCellAmplitudeStat->Init(fNumberOfCells, 100, 0., 10.);
+    fHistManager->GetListOfHistograms()->Add(fCellAmplitudeStat);
+    fCellTimeStat = new AliEmcalChannelStatistics("cellTimeStat", "Cell time");
+    fCellTimeStat->Init(fNumberOfCells, 130, -3e-7, 1e-6);
+    fHistManager->GetListOfHistograms()->Add(fCellTimeStat);
+  }
   for(int ism = 0; ism < 20; ++ism){
     fHistManager->CreateTH2(Form("cellAmpSM%d", ism), Form("Integrated cell amplitudes for SM %d; col; row", ism), 48, -0.5, 47.5, 24, -0.5, 23.5);
     fHistManager->CreateTH2(Form("cellCountSM%d", ism), Form("Count rate per cell for SM %d; col; row", ism), 48, -0.5, 47.5, 24, -0.5, 23.5);
@@ -11,6 +11,7 @@
 class TArrayD;
 class THistManager;
 class AliEMCALGeometry;
+class AliEmcalChannelStatistics;
 
 /**
  * @class AliEmcalCellMonitorTask
@@ -50,6 +51,17 @@ class AliEMCALGeometry;
  * task->SetRequestTrigger(AliVEvent::kEGA, "EG1");
  * ~~~
  *
+ * For the bad channel determination the per cell distributions can
+ * be replaced by compact per cell summaries (AliEmcalChannelStatistics
+ * with entries, mean, variance, minimum, maximum and a quantile sketch),
+ * filled by cell ID and merged in constant size:
+ *
+ * ~~~{.cxx}
+ * ...
+ * task->SetFillChannelStatistics(kTRUE);
+ * task->SetFillCellHistograms(kFALSE);   // no cell ID x amplitude/time histograms
+ * ~~~
+ *
  * It can be added to the train using the add macro
  * ~~~
  * $ALICE_PHYSICS/PWG/EMCAL/AddEmcalCellMonitorTask.C
@@ -120,6 +132,23 @@ public:
    */
   void InitBadChannelsFromContainer(const TString &containername) { fBadChannelContainer = containername; }
 
+  /**
+   * Fill the per cell summaries of the amplitude (cellAmplitudeStat)
+   * and of the time (cellTimeStat, cells above the min. amplitude
+   * only) in the output
+   * @param[in] doFill If true the summaries are filled
+   */
+  void SetFillChannelStatistics(Bool_t doFill = kTRUE) { fFillChannelStatistics = doFill; }
+
+  /**
+   * Switch the histograms with the cell ID on one axis and the cell
+   * amplitude, time or amplitude fraction on the other axis (on by
+   * default). The summaries of SetFillChannelStatistics can be used
+   * instead.
+   * @param[in] doFill If false the histograms are not created
+   */
+  void SetFillCellHistograms(Bool_t doFill = kTRUE) { fFillCellHistograms = doFill; }
+
 protected:
 
   /**
@@ -229,11 +258,16 @@ private:
 
   std::vector<Int_t>                  fMaskedCells;         ///< Vector of masked cells
 
+  Bool_t                              fFillChannelStatistics; ///< Fill the per cell summaries
+  Bool_t                              fFillCellHistograms;  ///< Fill the cell ID x amplitude/time histograms
+  AliEmcalChannelStatistics           *fCellAmplitudeStat;  //!<! Summary of the cell amplitude per cell
+  AliEmcalChannelStatistics           *fCellTimeStat;       //!<! Summary of the cell time per cell
+
   AliEmcalCellMonitorTask(const AliEmcalCellMonitorTask &ref);
   AliEmcalCellMonitorTask &operator=(const AliEmcalCellMonitorTask &ref);
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCellMonitorTask, 1);
+  ClassDef(AliEmcalCellMonitorTask, 2);
   /// \endcond
 };
 
@@ -0,0 +1,208 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <cstring>
+#include <iostream>
+#include <TCollection.h>
+#include <TH1D.h>
+#include <TMath.h>
+
+#include "AliEmcalChannelStatistics.h"
+#include "AliLog.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalChannelStatistics)
+/// \endcond
+
+AliEmcalChannelStatistics::AliEmcalChannelStatistics():
+  TNamed(),
+  fNChannels(0),
+  fNBins(0),
+  fLow(0.),
+  fHigh(1.),
+  fEntries(),
+  fMean(),
+  fM2(),
+  fMin(),
+  fMax(),
+  fSketch()
+{
+
+}
+
+AliEmcalChannelStatistics::AliEmcalChannelStatistics(const char *name, const char *title):
+  TNamed(name, title),
+  fNChannels(0),
+  fNBins(0),
+  fLow(0.),
+  fHigh(1.),
+  fEntries(),
+  fMean(),
+  fM2(),
+  fMin(),
+  fMax(),
+  fSketch()
+{
+
+}
+
+void AliEmcalChannelStatistics::Init(Int_t nchannels, Int_t nbins, Double_t low, Double_t high){
+  if(nbins > 0 && !(high > low)){
+    AliErrorStream() << GetName() << ": invalid sketch range [" << low << ", " << high << "], sketch disabled" << std::endl;
+    nbins = 0;
+  }
+  fNChannels = nchannels > 0 ? nchannels : 0;
+  fNBins = nbins > 0 ? nbins : 0;
+  fLow = low;
+  fHigh = high;
+  fEntries.Set(fNChannels);
+  fMean.Set(fNChannels);
+  fM2.Set(fNChannels);
+  fMin.Set(fNChannels);
+  fMax.Set(fNChannels);
+  fSketch.Set(fNBins ? fNChannels * (fNBins + 2) : 0);
+  Reset();
+}
+
+void AliEmcalChannelStatistics::Fill(Int_t channel, Double_t x){
+  if(channel < 0 || channel >= fNChannels) return;
+  if(!TMath::Finite(x)) return;
+
+  Long64_t n = ++fEntries[channel];
+  if(n == 1) fMin[channel] = fMax[channel] = x;
+  else if(x < fMin[channel]) fMin[channel] = x;
+  else if(x > fMax[channel]) fMax[channel] = x;
+  const Double_t delta = x - fMean[channel];
+  fMean[channel] += delta / n;
+  fM2[channel] += delta * (x - fMean[channel]);
+
+  if(fNBins){
+    Int_t bin = 0;
+    if(x >= fHigh) bin = fNBins + 1;
+    else if(x >= fLow) bin = 1 + TMath::Min(fNBins - 1, Int_t((x - fLow) / (fHigh - fLow) * fNBins));
+    fSketch[channel * (fNBins + 2) + bin]++;
+  }
+}
+
+void AliEmcalChannelStatistics::Reset(Option_t *){
+  fEntries.Reset();
+  fMean.Reset();
+  fM2.Reset();
+  fMin.Reset();
+  fMax.Reset();
+  fSketch.Reset();
+}
+
+Long64_t AliEmcalChannelStatistics::Merge(TCollection *list){
+  if(!list) return 0;
+  TIter next(list);
+  TObject *obj = nullptr;
+  while((obj = next())){
+    const AliEmcalChannelStatistics *other = dynamic_cast<const AliEmcalChannelStatistics *>(obj);
+    if(!other){
+      AliErrorStream() << GetName() << ": cannot merge a " << obj->ClassName() << std::endl;
+      continue;
+    }
+    if(!fNChannels && !fEntries.GetSize()) Init(other->fNChannels, other->fNBins, other->fLow, other->fHigh);
+    if(other->fNChannels != fNChannels || other->fNBins != fNBins || other->fLow != fLow || other->fHigh != fHigh){
+      AliErrorStream() << GetName() << ": different channel or sketch definition, " << other->GetName() << " skipped" << std::endl;
+      continue;
+    }
+    for(Int_t ich = 0; ich < fNChannels; ich++){
+      const Long64_t nB = other->fEntries[ich];
+      if(!nB) continue;
+      const Long64_t nA = fEntries[ich];
+      if(!nA){
+        fMin[ich] = other->fMin[ich];
+        fMax[ich] = other->fMax[ich];
+      } else {
+        fMin[ich] = TMath::Min(fMin[ich], other->fMin[ich]);
+        fMax[ich] = TMath::Max(fMax[ich], other->fMax[ich]);
+      }
+      const Double_t n = static_cast<Double_t>(nA + nB);
+      const Double_t delta = other->fMean[ich] - fMean[ich];
+      fMean[ich] += delta * nB / n;
+      fM2[ich] += other->fM2[ich] + delta * delta * nA * nB / n;
+      fEntries[ich] = nA + nB;
+    }
+    for(Int_t ib = 0; ib < fSketch.GetSize(); ib++) fSketch[ib] += other->fSketch[ib];
+  }
+  Long64_t entries = 0;
+  for(Int_t ich = 0; ich < fNChannels; ich++) entries += fEntries[ich];
+  return entries;
+}
+
+Double_t AliEmcalChannelStatistics::GetVariance(Int_t channel) const {
+  if(fEntries[channel] < 2) return 0.;
+  return TMath::Max(fM2[channel], 0.) / (fEntries[channel] - 1);
+}
+
+Double_t AliEmcalChannelStatistics::GetRMS(Int_t channel) const {
+  return TMath::Sqrt(GetVariance(channel));
+}
+
+Double_t AliEmcalChannelStatistics::GetQuantile(Int_t channel, Double_t q) const {
+  if(!fEntries[channel]) return 0.;
+  if(!fNBins) return fMean[channel];
+  const Int_t *sketch = fSketch.GetArray() + channel * (fNBins + 2);
+  Double_t total = 0;
+  for(Int_t ib = 0; ib < fNBins + 2; ib++) total += sketch[ib];
+  if(!(total > 0)) return fMean[channel];
+
+  const Double_t target = TMath::Min(TMath::Max(q, 0.), 1.) * total;
+  const Double_t width = (fHigh - fLow) / fNBins;
+  Double_t sum = 0;
+  for(Int_t ib = 0; ib < fNBins + 2; ib++){
+    if(sketch[ib] > 0 && sum + sketch[ib] >= target){
+      Double_t lo = fLow + (ib - 1) * width, hi = lo + width;
+      if(ib == 0) { lo = fMin[channel]; hi = fLow; }
+      else if(ib == fNBins + 1) { lo = fHigh; hi = fMax[channel]; }
+      const Double_t x = lo + (target - sum) / sketch[ib] * (hi - lo);
+      return TMath::Min(TMath::Max(x, fMin[channel]), fMax[channel]);
+    }
+    sum += sketch[ib];
+  }
+  return fMax[channel];
+}
+
+TH1 *AliEmcalChannelStatistics::MakeChannelHistogram(const char *what) const {
+  enum { kEntries, kMean, kRMS, kMin, kMax, kMedian } property;
+  if(!strcmp(what, "Entries")) property = kEntries;
+  else if(!strcmp(what, "Mean")) property = kMean;
+  else if(!strcmp(what, "RMS")) property = kRMS;
+  else if(!strcmp(what, "Min")) property = kMin;
+  else if(!strcmp(what, "Max")) property = kMax;
+  else if(!strcmp(what, "Median")) property = kMedian;
+  else {
+    AliErrorStream() << GetName() << ": unknown channel property " << what << std::endl;
+    return nullptr;
+  }
+
+  TH1 *hist = new TH1D(Form("%s%s", GetName(), what), Form("%s: %s per channel; channel ID; %s", GetTitle(), what, what), fNChannels, -0.5, fNChannels - 0.5);
+  hist->SetDirectory(nullptr);
+  for(Int_t ich = 0; ich < fNChannels; ich++){
+    if(!fEntries[ich]) continue;
+    Double_t value = 0;
+    switch(property){
+    case kEntries: value = fEntries[ich]; break;
+    case kMean: value = fMean[ich]; break;
+    case kRMS: value = GetRMS(ich); break;
+    case kMin: value = fMin[ich]; break;
+    case kMax: value = fMax[ich]; break;
+    case kMedian: value = GetQuantile(ich, 0.5); break;
+    };
+    hist->SetBinContent(ich + 1, value);
+  }
+  return hist;
+}
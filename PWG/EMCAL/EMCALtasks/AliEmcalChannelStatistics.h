@@ -0,0 +1,135 @@
+#ifndef ALIEMCALCHANNELSTATISTICS_H
+#define ALIEMCALCHANNELSTATISTICS_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <TArrayD.h>
+#include <TArrayI.h>
+#include <TArrayL64.h>
+#include <TNamed.h>
+
+class TCollection;
+class TH1;
+
+/**
+ * @class AliEmcalChannelStatistics
+ * @brief Mergeable per channel summary of a monitored quantity
+ * @since Oct 14, 2016
+ * @ingroup EMCALFWTASKS
+ *
+ * Keeps for each channel (cell or FastOR, indexed by its absolute ID)
+ * the number of entries, the mean, the sum of squared deviations
+ * (Welford's update), the minimum and the maximum of a quantity in
+ * flat arrays. Optionally a fixed binning sketch per channel, with
+ * underflow and overflow, gives approximate quantiles.
+ *
+ * Merging combines the moments of each channel in constant time
+ * (Chan's pairwise combination) and adds the sketches, so that the
+ * size of the output does not depend on the number of events. The
+ * per run summaries can be used for the bad channel determination
+ * instead of the channel ID x quantity histograms.
+ *
+ * ~~~{.cxx}
+ * AliEmcalChannelStatistics *stat = new AliEmcalChannelStatistics("cellAmplitudeStat", "Cell amplitude");
+ * stat->Init(17664, 50, 0., 10.);     // 50 sketch bins between 0 and 10 GeV
+ * ...
+ * stat->Fill(cellID, amplitude);
+ * ~~~
+ */
+class AliEmcalChannelStatistics : public TNamed {
+public:
+
+  /**
+   * Dummy constructor, for ROOT I/O only
+   */
+  AliEmcalChannelStatistics();
+
+  /**
+   * Named constructor, the channels are defined with Init
+   * @param[in] name Name of the object
+   * @param[in] title Title of the object
+   */
+  AliEmcalChannelStatistics(const char *name, const char *title = "");
+
+  /**
+   * Destructor
+   */
+  virtual ~AliEmcalChannelStatistics() {}
+
+  /**
+   * Define the channels and the sketch, the content is reset
+   * @param[in] nchannels Number of channels
+   * @param[in] nbins Number of bins of the sketch (0: no sketch)
+   * @param[in] low Lower edge of the sketch
+   * @param[in] high Upper edge of the sketch
+   */
+  void Init(Int_t nchannels, Int_t nbins = 0, Double_t low = 0., Double_t high = 1.);
+
+  /**
+   * Add a value to a channel. Values of channels outside the
+   * range and non finite values are ignored.
+   * @param[in] channel Absolute ID of the channel
+   * @param[in] x Value
+   */
+  void Fill(Int_t channel, Double_t x);
+
+  /**
+   * Remove the content, the channel definition is kept
+   * @param[in] option Not used
+   */
+  virtual void Reset(Option_t *option = "");
+
+  /**
+   * Merge the summaries of list into this one. Objects with a
+   * different channel or sketch definition are skipped.
+   * @param[in] list Summaries to be merged
+   * @return Total number of entries
+   */
+  Long64_t Merge(TCollection *list);
+
+  Int_t    GetNChannels()             const { return fNChannels; }
+  Int_t    GetNSketchBins()           const { return fNBins; }
+  Long64_t GetEntries(Int_t channel)  const { return fEntries[channel]; }
+  Double_t GetMean(Int_t channel)     const { return fMean[channel]; }
+  Double_t GetMin(Int_t channel)      const { return fMin[channel]; }
+  Double_t GetMax(Int_t channel)      const { return fMax[channel]; }
+  Double_t GetVariance(Int_t channel) const;
+  Double_t GetRMS(Int_t channel)      const;
+
+  /**
+   * Approximate quantile from the sketch, linear inside the bins.
+   * The underflow and overflow bins extend to the minimum and the
+   * maximum of the channel.
+   * @param[in] channel Absolute ID of the channel
+   * @param[in] q Probability, in [0,1]
+   * @return The quantile (the mean without sketch, 0 without entries)
+   */
+  Double_t GetQuantile(Int_t channel, Double_t q) const;
+
+  /**
+   * Project one property of all the channels in a histogram with
+   * one bin per channel, for the comparison with the histogram
+   * based bad channel tools
+   * @param[in] what One of Entries, Mean, RMS, Min, Max, Median
+   * @return New histogram, owned by the caller (NULL if what is unknown)
+   */
+  TH1 *MakeChannelHistogram(const char *what) const;
+
+private:
+  Int_t                 fNChannels;       ///< Number of channels
+  Int_t                 fNBins;           ///< Number of bins of the sketch, 0 if none
+  Double_t              fLow;             ///< Lower edge of the sketch
+  Double_t              fHigh;            ///< Upper edge of the sketch
+  TArrayL64             fEntries;         ///< Number of entries per channel
+  TArrayD               fMean;            ///< Mean per channel
+  TArrayD               fM2;              ///< Sum of the squared deviations from the mean per channel
+  TArrayD               fMin;             ///< Minimum per channel
+  TArrayD               fMax;             ///< Maximum per channel
+  TArrayI               fSketch;          ///< Sketch counts, (fNBins + 2) per channel with underflow and overflow
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalChannelStatistics, 1);
+  /// \endcond
+};
+
+#endif /* ALIEMCALCHANNELSTATISTICS_H */
@@ -17,6 +17,7 @@ class AliEmcalClusTrackMatcherTask : public AliAnalysisTaskEmcal {
   void          SetAttachEmcalParticles(Bool_t b) { fAttachEmcalParticles  = b; }
   void          SetUpdateTracks(Bool_t b)         { fUpdateTracks          = b; }
   void          SetUpdateClusters(Bool_t b)       { fUpdateClusters        = b; }
+  void          SetUseMatchTable(Bool_t b)        { fUseMatchTable         = b; }
 
  protected:
   void          ExecOnce();
@@ -26,6 +27,7 @@ class AliEmcalClusTrackMatcherTask : public AliAnalysisTaskEmcal {
 
   void          GenerateEmcalParticles();
   void          DoMatching();
+  void          AddMatch(Int_t itrack, Int_t icluster, Double_t deta, Double_t dphi, Double_t d2);
   void          UpdateTracks();
   void          UpdateClusters();
   
@@ -37,6 +39,7 @@ class AliEmcalClusTrackMatcherTask : public AliAnalysisTaskEmcal {
   Bool_t        fAttachEmcalParticles;  // attach emcal particles to the event, so that other tasks can use them
   Bool_t        fUpdateTracks;          // update tracks with matching info
   Bool_t        fUpdateClusters;        // update clusters with matching info
+  Bool_t        fUseMatchTable;         // take the pairs from the cluster-track match table shared with the other matchers
 
   TClonesArray *fEmcalTracks;           //!emcal tracks
   TClonesArray *fEmcalClusters;         //!emcal clusters
@@ -51,6 +54,6 @@ class AliEmcalClusTrackMatcherTask : public AliAnalysisTaskEmcal {
   AliEmcalClusTrackMatcherTask(const AliEmcalClusTrackMatcherTask&);            // not implemented
   AliEmcalClusTrackMatcherTask &operator=(const AliEmcalClusTrackMatcherTask&); // not implemented
 
-  ClassDef(AliEmcalClusTrackMatcherTask, 7) // Cluster-Track matching task
+  ClassDef(AliEmcalClusTrackMatcherTask, 8) // Cluster-Track matching task
 };
 #endif
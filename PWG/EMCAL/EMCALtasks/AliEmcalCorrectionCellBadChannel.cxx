@@ -5,6 +5,7 @@
 #include <TFile.h>
 #include "AliEMCALGeometry.h"
 #include "AliOADBContainer.h"
+#include "AliOADBContainerCache.h"
 #include "AliEMCALRecoUtils.h"
 #include "AliAODEvent.h"
 
@@ -46,6 +47,7 @@ Bool_t AliEmcalCorrectionCellBadChannel::Initialize()
   AliWarning("Init EMCAL cell bad channel removal");
   
   GetProperty("createHistos", fCreateHisto);
+  GetProperty("useCellCalibrationTable", fUseCellCalibrationTable);
 
   // init reco utils
   if (!fRecoUtils)
@@ -159,7 +161,9 @@ Int_t AliEmcalCorrectionCellBadChannel::InitBadChannels()
   
   Int_t runBC = fEvent->GetRunNumber();
   
-  AliOADBContainer *contBC = new AliOADBContainer("");
+  // The container is read once per process and shared with the other tasks,
+  // its maps are cloned below
+  TString fileNameBC = "$ALICE_PHYSICS/OADB/EMCAL/EMCALBadChannels.root";
   if (fBasePath!="")
   { //if fBasePath specified in the ->SetBasePath()
     AliInfo(Form("Loading Bad Channels OADB from given path %s",fBasePath.Data()));
@@ -173,7 +177,7 @@ Int_t AliEmcalCorrectionCellBadChannel::InitBadChannels()
     
     if (fbad) delete fbad;
     
-    contBC->InitFromFile(Form("%s/EMCALBadChannels.root",fBasePath.Data()),"AliEMCALBadChannels");
+    fileNameBC = Form("%s/EMCALBadChannels.root",fBasePath.Data());
   }
   else
   { // Else choose the one in the $ALICE_PHYSICS directory
@@ -187,15 +191,14 @@ Int_t AliEmcalCorrectionCellBadChannel::InitBadChannels()
     }
     
     if (fbad) delete fbad;
-    
-    contBC->InitFromFile("$ALICE_PHYSICS/OADB/EMCAL/EMCALBadChannels.root","AliEMCALBadChannels");
   }
   
+  AliOADBContainer *contBC = AliOADBContainerCache::Instance()->GetContainer(fileNameBC,"AliEMCALBadChannels");
+  
   TObjArray *arrayBC=(TObjArray*)contBC->GetObject(runBC);
   if (!arrayBC)
   {
     AliError(Form("No external hot channel set for run number: %d", runBC));
-    delete contBC;
     return 2;
   }
   
@@ -212,12 +215,11 @@ Int_t AliEmcalCorrectionCellBadChannel::InitBadChannels()
       AliError(Form("Can not get EMCALBadChannelMap_Mod%d",i));
       continue;
     }
+    h=(TH2I*)h->Clone();
     h->SetDirectory(0);
     fRecoUtils->SetEMCALChannelStatusMap(i,h);
   }
   
-  delete contBC;
-  
   return 1;
 }
 // this comment serves no purpose
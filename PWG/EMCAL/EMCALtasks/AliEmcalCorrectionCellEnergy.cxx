@@ -48,6 +48,7 @@ Bool_t AliEmcalCorrectionCellEnergy::Initialize()
   AliWarning("Init EMCAL cell recalibration");
   
   GetProperty("createHistos", fCreateHisto);
+  GetProperty("useCellCalibrationTable", fUseCellCalibrationTable);
 
   if(fFilepass.Contains("LHC14a1a")) fUseAutomaticRecalib = kTRUE;
   
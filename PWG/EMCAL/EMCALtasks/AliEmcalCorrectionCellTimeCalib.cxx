@@ -49,6 +49,7 @@ Bool_t AliEmcalCorrectionCellTimeCalib::Initialize()
   AliWarning("Init EMCAL time calibration");
   
   GetProperty("createHistos", fCreateHisto);
+  GetProperty("useCellCalibrationTable", fUseCellCalibrationTable);
   
   fCalibrateTime = kTRUE;
 
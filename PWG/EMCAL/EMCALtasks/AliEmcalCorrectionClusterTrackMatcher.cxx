@@ -3,6 +3,8 @@
 
 #include "AliEmcalCorrectionClusterTrackMatcher.h"
 
+#include <vector>
+
 #include <TH1.h>
 #include <TList.h>
 
@@ -13,6 +15,7 @@
 #include "AliAODCaloCluster.h"
 #include "AliVParticle.h"
 #include "AliEmcalParticle.h"
+#include "AliEmcalClusterTrackMatchTable.h"
 #include "AliEMCALGeometry.h"
 
 /// \cond CLASSIMP
@@ -32,6 +35,7 @@ AliEmcalCorrectionClusterTrackMatcher::AliEmcalCorrectionClusterTrackMatcher() :
   fMaxDistance(0.1),
   fUpdateTracks(kTRUE),
   fUpdateClusters(kTRUE),
+  fUseMatchTable(kFALSE),
   fEmcalTracks(0),
   fEmcalClusters(0),
   fNEmcalTracks(0),
@@ -74,6 +78,7 @@ Bool_t AliEmcalCorrectionClusterTrackMatcher::Initialize()
   GetProperty("maxDist", fMaxDistance);
   GetProperty("updateClusters", fUpdateClusters);
   GetProperty("updateTracks", fUpdateTracks);
+  GetProperty("useMatchTable", fUseMatchTable);
   fDoPropagation = fEsdMode;
   
   return kTRUE;
@@ -245,12 +250,48 @@ void AliEmcalCorrectionClusterTrackMatcher::GenerateEmcalParticles()
 void AliEmcalCorrectionClusterTrackMatcher::DoMatching()
 {
   // Set the links between tracks and clusters.
+  // With the match table the clusters of each track come from the shared
+  // table, in the same order as in the full loop.
   const Double_t maxd2 = fMaxDistance*fMaxDistance;
 
+  AliEmcalClusterTrackMatchTable* table = 0;
+  std::vector<Int_t> emcalClusterIndex;
+  if (fUseMatchTable) {
+    table = AliEmcalClusterTrackMatchTable::Get(fPartCont->GetArray(), fClusCont->GetArray());
+    if (table && !table->Update(fMaxDistance)) table = 0;
+    if (table) {
+      emcalClusterIndex.assign(table->GetNClusters(), -1);
+      for (Int_t icluster = 0; icluster < fNEmcalClusters && table; icluster++) {
+        AliEmcalParticle* emcalCluster = static_cast<AliEmcalParticle*>(fEmcalClusters->At(icluster));
+        Int_t i = table->FindCluster(emcalCluster->GetCluster());
+        if (i < 0) table = 0;  // cluster not from the array, the table is not usable
+        else emcalClusterIndex[i] = icluster;
+      }
+    }
+  }
+
   for (Int_t itrack = 0; itrack < fNEmcalTracks; itrack++) {
     AliEmcalParticle* emcalTrack = static_cast<AliEmcalParticle*>(fEmcalTracks->At(itrack));
     AliVTrack* track = emcalTrack->GetTrack();
 
+    Int_t itable = table ? table->FindTrack(track) : -1;
+    if (itable >= 0) {
+      const Int_t first = table->GetFirstPair(itable);
+      const Int_t last = first + table->GetNPairs(itable);
+      for (Int_t ipair = first; ipair < last; ipair++) {
+        Int_t icluster = emcalClusterIndex[table->GetPairCluster(ipair)];
+        if (icluster < 0) continue;
+
+        Double_t deta = table->GetPairDeta(ipair);
+        Double_t dphi = table->GetPairDphi(ipair);
+        Double_t d2 = deta * deta + dphi * dphi;
+        if (d2 > maxd2) continue;
+
+        AddMatch(itrack, icluster, deta, dphi, d2);
+      }
+      continue;
+    }
+
     for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) {
       AliEmcalParticle* emcalCluster = static_cast<AliEmcalParticle*>(fEmcalClusters->At(icluster));
       AliVCluster* cluster = emcalCluster->GetCluster();
@@ -262,32 +303,44 @@ void AliEmcalCorrectionClusterTrackMatcher::DoMatching()
 
       if (d2 > maxd2) continue;
       
-      Double_t d = TMath::Sqrt(d2);
-      emcalCluster->AddMatchedObj(itrack, d);
-      emcalTrack->AddMatchedObj(icluster, d);
-      AliDebug(2, Form("Now matching cluster E = %.3f, pT = %.3f, eta = %.3f, phi = %.3f "
-                       "with track pT = %.3f, eta = %.3f, phi = %.3f"
-                       "Track eta, phi on EMCal = %.3f, %.3f, d = %.3f",
-                       cluster->GetNonLinCorrEnergy(), emcalCluster->Pt(), emcalCluster->Eta(), emcalCluster->Phi(),
-                       emcalTrack->Pt(), emcalTrack->Eta(), emcalTrack->Phi(),
-                       track->GetTrackEtaOnEMCal(), track->GetTrackPhiOnEMCal(), d));
-      
-      if (fCreateHisto) {
-        Int_t mombin = GetMomBin(track->P());
-        Int_t centbinch = fCentBin;
-        if (track->Charge() < 0) centbinch += fNcentBins;
-        Int_t etabin = 0;
-        if(track->Eta() > 0) etabin = 1;
-
-        fHistMatchEta[centbinch][mombin][etabin]->Fill(deta);
-        fHistMatchPhi[centbinch][mombin][etabin]->Fill(dphi);
-        fHistMatchEtaAll->Fill(deta);
-        fHistMatchPhiAll->Fill(dphi);
-      }
+      AddMatch(itrack, icluster, deta, dphi, d2);
     }
   }
 }
 
+//________________________________________________________________________
+void AliEmcalCorrectionClusterTrackMatcher::AddMatch(Int_t itrack, Int_t icluster, Double_t deta, Double_t dphi, Double_t d2)
+{
+  // Link a track and a cluster within the maximum distance.
+  AliEmcalParticle* emcalTrack = static_cast<AliEmcalParticle*>(fEmcalTracks->At(itrack));
+  AliEmcalParticle* emcalCluster = static_cast<AliEmcalParticle*>(fEmcalClusters->At(icluster));
+  AliVTrack* track = emcalTrack->GetTrack();
+  AliVCluster* cluster = emcalCluster->GetCluster();
+
+  Double_t d = TMath::Sqrt(d2);
+  emcalCluster->AddMatchedObj(itrack, d);
+  emcalTrack->AddMatchedObj(icluster, d);
+  AliDebug(2, Form("Now matching cluster E = %.3f, pT = %.3f, eta = %.3f, phi = %.3f "
+                   "with track pT = %.3f, eta = %.3f, phi = %.3f"
+                   "Track eta, phi on EMCal = %.3f, %.3f, d = %.3f",
+                   cluster->GetNonLinCorrEnergy(), emcalCluster->Pt(), emcalCluster->Eta(), emcalCluster->Phi(),
+                   emcalTrack->Pt(), emcalTrack->Eta(), emcalTrack->Phi(),
+                   track->GetTrackEtaOnEMCal(), track->GetTrackPhiOnEMCal(), d));
+  
+  if (fCreateHisto) {
+    Int_t mombin = GetMomBin(track->P());
+    Int_t centbinch = fCentBin;
+    if (track->Charge() < 0) centbinch += fNcentBins;
+    Int_t etabin = 0;
+    if(track->Eta() > 0) etabin = 1;
+
+    fHistMatchEta[centbinch][mombin][etabin]->Fill(deta);
+    fHistMatchPhi[centbinch][mombin][etabin]->Fill(dphi);
+    fHistMatchEtaAll->Fill(deta);
+    fHistMatchPhiAll->Fill(dphi);
+  }
+}
+
 //________________________________________________________________________
 void AliEmcalCorrectionClusterTrackMatcher::UpdateClusters()
 {
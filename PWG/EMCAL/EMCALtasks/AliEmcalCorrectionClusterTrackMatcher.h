@@ -64,6 +64,7 @@ class AliEmcalCorrectionClusterTrackMatcher : public AliEmcalCorrectionComponent
   Int_t         GetMomBin(Double_t p) const;
   void          GenerateEmcalParticles();
   void          DoMatching();
+  void          AddMatch(Int_t itrack, Int_t icluster, Double_t deta, Double_t dphi, Double_t d2);
   void          UpdateTracks();
   void          UpdateClusters();
   Bool_t        IsTrackInEmcalAcceptance(AliVParticle* part, Double_t edges=0.9) const;
@@ -75,6 +76,7 @@ class AliEmcalCorrectionClusterTrackMatcher : public AliEmcalCorrectionComponent
   Double_t      fMaxDistance;           ///< maximum distance to match clusters and tracks
   Bool_t        fUpdateTracks;          ///< update tracks with matching info
   Bool_t        fUpdateClusters;        ///< update clusters with matching info
+  Bool_t        fUseMatchTable;         ///< take the pairs from the cluster-track match table shared with the other matchers
   
   TClonesArray *fEmcalTracks;           //!<!emcal tracks
   TClonesArray *fEmcalClusters;         //!<!emcal clusters
@@ -93,7 +95,7 @@ class AliEmcalCorrectionClusterTrackMatcher : public AliEmcalCorrectionComponent
   static RegisterCorrectionComponent<AliEmcalCorrectionClusterTrackMatcher> reg;
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionClusterTrackMatcher, 1); // EMCal cluster track matcher correction component
+  ClassDef(AliEmcalCorrectionClusterTrackMatcher, 2); // EMCal cluster track matcher correction component
   /// \endcond
 };
 
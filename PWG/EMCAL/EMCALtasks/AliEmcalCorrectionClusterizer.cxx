@@ -30,6 +30,7 @@
 #include "AliEMCALClusterizerv2.h"
 #include "AliEMCALClusterizerFixedWindow.h"
 #include "AliEMCALDigit.h"
+#include "AliEMCALFlatClusterizer.h"
 #include "AliEMCALGeometry.h"
 #include "AliEMCALRecParam.h"
 #include "AliEMCALRecPoint.h"
@@ -81,7 +82,10 @@ AliEmcalCorrectionClusterizer::AliEmcalCorrectionClusterizer() :
   fEsd(0),
   fAod(0),
   fRecalDistToBadChannels(kFALSE),
-  fRecalShowerShape(kFALSE)
+  fRecalShowerShape(kFALSE),
+  fUseFlatClusterizer(kFALSE),
+  fFlatClusterizer(0),
+  fFlatClusterized(kFALSE)
 {
   // Default constructor
   AliDebug(3, Form("%s", __PRETTY_FUNCTION__));
@@ -97,6 +101,7 @@ AliEmcalCorrectionClusterizer::~AliEmcalCorrectionClusterizer()
   // Destructor
   
   delete fClusterizer;
+  delete fFlatClusterizer;
   delete fUnfolder;
   delete fRecParam;
 }
@@ -128,6 +133,7 @@ Bool_t AliEmcalCorrectionClusterizer::Initialize()
   GetProperty("w0", w0);
   GetProperty("recalDistToBadChannels", fRecalDistToBadChannels);
   GetProperty("recalShowerShape", fRecalShowerShape);
+  GetProperty("useFlatClusterizer", fUseFlatClusterizer);
   GetProperty("remapMcAod", fRemapMCLabelForAODs);
   Bool_t enableFracEMCRecalc = kFALSE;
   GetProperty("enableFracEMCRecalc", enableFracEMCRecalc);
@@ -250,6 +256,16 @@ void AliEmcalCorrectionClusterizer::Clusterize()
 {
   // Clusterize
   
+  fFlatClusterized = kFALSE;
+  if (fFlatClusterizer && !fSetCellMCLabelFromEdepFrac && fSetCellMCLabelFromCluster != 2) {
+    // with background subtraction the digits are already calibrated
+    fFlatClusterizer->Clear();
+    fFlatClusterizer->AddDigits(fDigitsArr, fSubBackground ? 0 : fClusterizer);
+    fFlatClusterizer->Clusterize();
+    fFlatClusterized = kTRUE;
+    return;
+  }
+  
   if (fSubBackground) {
     fClusterizer->SetInputCalibrated(kTRUE);
     fClusterizer->SetCalibrationParameters(0);
@@ -659,6 +675,22 @@ void AliEmcalCorrectionClusterizer::RecPoints2Clusters(TClonesArray *clus)
   }
 }
 
+//________________________________________________________________________
+void AliEmcalCorrectionClusterizer::FlatClusters2Clusters(TClonesArray *clus)
+{
+  // Clusters of the array based clusterizer to ESD/AOD clusters, with the same
+  // content as from the rec points.
+  
+  const Int_t Ncls = fFlatClusterizer->GetNClusters();
+  AliDebug(1, Form("total no of clusters %d", Ncls));
+  
+  for(Int_t i=0, nout=clus->GetEntries(); i < Ncls; ++i)
+  {
+    AliVCluster *c = static_cast<AliVCluster*>(clus->New(nout++));
+    fFlatClusterizer->FillCluster(i, c);
+  }
+}
+
 //________________________________________________________________________
 void AliEmcalCorrectionClusterizer::UpdateClusters()
 {
@@ -666,7 +698,7 @@ void AliEmcalCorrectionClusterizer::UpdateClusters()
   
   // Before destroying the orignal list, assign to the rec points the MC labels
   // of the original clusters, if requested
-  if (fSetCellMCLabelFromCluster == 2)
+  if (fSetCellMCLabelFromCluster == 2 && !fFlatClusterized)
     SetClustersMCLabelFromOriginalClusters() ;
   
   const Int_t nents = fCaloClusters->GetEntries();
@@ -680,7 +712,10 @@ void AliEmcalCorrectionClusterizer::UpdateClusters()
   
   fCaloClusters->Compress();
   
-  RecPoints2Clusters(fCaloClusters);
+  if (fFlatClusterized)
+    FlatClusters2Clusters(fCaloClusters);
+  else
+    RecPoints2Clusters(fCaloClusters);
 }
 
 //________________________________________________________________________________________
@@ -971,4 +1006,18 @@ void AliEmcalCorrectionClusterizer::Init()
   fClusterizer->SetOutput(0);
   fClusterArr = const_cast<TObjArray *>(fClusterizer->GetRecPoints());
   
+  // array based clusterizer, the neighbour table follows the geometry of the run
+  delete fFlatClusterizer;
+  fFlatClusterizer = 0;
+  if (fUseFlatClusterizer) {
+    fFlatClusterizer = new AliEMCALFlatClusterizer;
+    if (!fFlatClusterizer->SetParameters(fRecParam)) {
+      AliWarning(Form("Clusterizer < %d > not available in AliEMCALFlatClusterizer, using the standard one", fRecParam->GetClusterizerFlag()));
+      delete fFlatClusterizer;
+      fFlatClusterizer = 0;
+    }
+    else {
+      fFlatClusterizer->InitGeometry(fGeom);
+    }
+  }
 }
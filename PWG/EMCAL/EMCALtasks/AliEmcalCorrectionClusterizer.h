@@ -5,6 +5,8 @@
 
 #include "AliEMCALRecParam.h"
 
+class AliEMCALFlatClusterizer;
+
 /**
  * @class AliEmcalCorrectionClusterizer
  * @ingroup EMCALCOREFW
@@ -18,6 +20,8 @@
  *
  * The clusterizer will use as input the cell branch specified in the YAML config, and as output will rewrite the cluster branch specified in the YAML config.
  *
+ * With `useFlatClusterizer: true` the v1, v2 and NxN clusterizations are done by AliEMCALFlatClusterizer, which works on flat arrays of the cells instead of digits and rec points. Its clusters do not extend over two supermodules and their position is not corrected for the shower depth. The standard clusterizer is used for the other clusterizers and for the cell MC labels from the energy deposition fractions or from the original clusters.
+ *
  * At this point the energy of the cluster will be available through `cluster->E()` where cluster is the pointer to the AliAODCaloCluster or AliESDCaloCluster object.
  *
  * Based on code in AliAnalysisTaskEMCALClusterizeFast, in turn based on code by Deepa Thomas.
@@ -63,6 +67,7 @@ protected:
   void           FillDigitsArray();
   void           Init();
   void           RecPoints2Clusters(TClonesArray *clus);
+  void           FlatClusters2Clusters(TClonesArray *clus);
   void           UpdateClusters();
   void           CalibrateClusters();
   
@@ -110,6 +115,10 @@ protected:
   Bool_t                 fRecalDistToBadChannels;         ///< recalculate distance to bad channel
   Bool_t                 fRecalShowerShape;               ///< switch for recalculation of the shower shape
   
+  Bool_t                 fUseFlatClusterizer;             ///< use the array based clusterizer when it supports the configuration
+  AliEMCALFlatClusterizer *fFlatClusterizer;              //!<!array based clusterizer
+  Bool_t                 fFlatClusterized;                //!<!clusters of the event from the array based clusterizer
+  
   TClonesArray          *fCaloClusters;                   //!<!calo clusters array
   AliESDEvent           *fEsd;                            //!<!esd event
   AliAODEvent           *fAod;                            //!<!aod event
@@ -122,7 +131,7 @@ protected:
   static RegisterCorrectionComponent<AliEmcalCorrectionClusterizer> reg;
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionClusterizer, 1); // EMCal correction clusterizer component
+  ClassDef(AliEmcalCorrectionClusterizer, 2); // EMCal correction clusterizer component
   /// \endcond
 };
 
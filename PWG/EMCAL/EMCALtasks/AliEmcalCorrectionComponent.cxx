@@ -8,6 +8,8 @@
 
 #include "AliEmcalList.h"
 #include "AliEMCALRecoUtils.h"
+#include "AliEMCALGeometry.h"
+#include "AliVCaloCells.h"
 #include "AliAnalysisManager.h"
 #include "AliVEvent.h"
 #include "AliClusterContainer.h"
@@ -50,8 +52,14 @@ AliEmcalCorrectionComponent::AliEmcalCorrectionComponent() :
   fCaloCells(0),
   fRecoUtils(0),
   fOutput(0),
-  fBasePath("")
-
+  fBasePath(""),
+  fUseCellCalibrationTable(kFALSE),
+  fCellTableRun(-1),
+  fCellTableNCells(0),
+  fCellTableApplyTime(kFALSE),
+  fCellTableBad(),
+  fCellTableEnergy(),
+  fCellTableTime()
 {
   // Default constructor
   AliDebug(3, Form("%s", __PRETTY_FUNCTION__));
@@ -89,8 +97,14 @@ AliEmcalCorrectionComponent::AliEmcalCorrectionComponent(const char * name) :
   fCaloCells(0),
   fRecoUtils(0),
   fOutput(0),
-  fBasePath("")
-
+  fBasePath(""),
+  fUseCellCalibrationTable(kFALSE),
+  fCellTableRun(-1),
+  fCellTableNCells(0),
+  fCellTableApplyTime(kFALSE),
+  fCellTableBad(),
+  fCellTableEnergy(),
+  fCellTableTime()
 {
   // Standard constructor
   AliDebug(3, Form("%s", __PRETTY_FUNCTION__));
@@ -209,6 +223,12 @@ void AliEmcalCorrectionComponent::UpdateCells()
   
   if (!fEvent) return ;
   
+  if (fUseCellCalibrationTable && fRecoUtils && fGeom) {
+    if (fCellTableRun != fRun) BuildCellCalibrationTable();
+    UpdateCellsFromTable();
+    return;
+  }
+
   Int_t bunchCrossNo = fEvent->GetBunchCrossNumber();
   
   if (fRecoUtils)
@@ -217,6 +237,93 @@ void AliEmcalCorrectionComponent::UpdateCells()
   fCaloCells->Sort();
 }
 
+/**
+ * Flattens the cell corrections which are currently switched on in the reco utils (bad channel removal,
+ * energy recalibration, time recalibration and L1 phase shift) into tables indexed by the absolute cell ID.
+ * The geometry lookups and OADB histogram accesses are done once per run here instead of once per cell
+ * and event. Must be called after the calibration of the run has been loaded into the reco utils.
+ */
+void AliEmcalCorrectionComponent::BuildCellCalibrationTable()
+{
+  fCellTableRun = fRun;
+  fCellTableNCells = fGeom->GetNCells();
+
+  Bool_t applyBad = fRecoUtils->IsBadChannelsRemovalSwitchedOn();
+  Bool_t applyEnergy = fRecoUtils->IsRecalibrationOn();
+  Bool_t applyL1Phase = fRecoUtils->IsTimeRecalibrationOn() && fRecoUtils->IsL1PhaseInTimeRecalibrationOn();
+  fCellTableApplyTime = fRecoUtils->IsTimeRecalibrationOn();
+
+  fCellTableBad.assign(fCellTableNCells, 0);
+  fCellTableEnergy.assign(fCellTableNCells, 1.);
+  fCellTableTime.assign(fCellTableApplyTime ? 4 * fCellTableNCells : 0, 0.);
+
+  Int_t imod = -1, iTower = -1, iIphi = -1, iIeta = -1, iphi = -1, ieta = -1;
+  for (Int_t absId = 0; absId < fCellTableNCells; absId++)
+  {
+    fGeom->GetCellIndex(absId, imod, iTower, iIphi, iIeta);
+    fGeom->GetCellPhiEtaIndexInSModule(imod, iTower, iIphi, iIeta, iphi, ieta);
+
+    if (applyBad && fRecoUtils->GetEMCALChannelStatus(imod, ieta, iphi)) fCellTableBad[absId] = 1;
+    if (applyEnergy) fCellTableEnergy[absId] = fRecoUtils->GetEMCALChannelRecalibrationFactor(imod, ieta, iphi);
+    if (!fCellTableApplyTime) continue;
+
+    for (Int_t bc = 0; bc < 4; bc++)
+    {
+      Double_t offset = fRecoUtils->GetEMCALChannelTimeRecalibrationFactor(bc, absId) * 1.e-9;
+      if (applyL1Phase) {
+        // Same convention as AliEMCALRecoUtils::RecalibrateCellTimeL1Phase
+        Int_t l1PhaseShift = fRecoUtils->GetEMCALL1PhaseInTimeRecalibrationForSM(imod);
+        Int_t l1Phase = l1PhaseShift & 3;
+        Float_t offsetPerSM = (bc >= l1Phase ? bc - l1Phase : bc - l1Phase + 4) * 25;
+        Int_t l1ShiftOffset = (l1PhaseShift >> 2) * 25;
+        offset += offsetPerSM * 1.e-9 + l1ShiftOffset * 1.e-9;
+      }
+      fCellTableTime[bc * fCellTableNCells + absId] = offset;
+    }
+  }
+
+  AliDebug(2, Form("Built cell calibration table for run %d with %d cells (bad channels %d, energy %d, time %d, L1 phase %d)",
+      fRun, fCellTableNCells, applyBad, applyEnergy, fCellTableApplyTime, applyL1Phase));
+}
+
+/**
+ * Applies the flattened cell calibration table in a single pass over the cells. Bad cells and cells
+ * outside of the table get E = 0 and t = -1, as in AliEMCALRecoUtils::RecalibrateCells().
+ */
+void AliEmcalCorrectionComponent::UpdateCellsFromTable()
+{
+  Int_t bunchCrossNo = fEvent->GetBunchCrossNumber();
+  const Double_t * timeOffset = (fCellTableApplyTime && bunchCrossNo >= 0) ? &fCellTableTime[(bunchCrossNo % 4) * fCellTableNCells] : 0;
+  const UChar_t * bad = fCellTableBad.data();
+  const Float_t * energy = fCellTableEnergy.data();
+
+  Short_t  absId  =-1;
+  Double_t ecell = 0;
+  Double_t tcell = 0;
+  Double_t efrac = 0;
+  Int_t  mclabel = -1;
+
+  const Int_t ncells = fCaloCells->GetNumberOfCells();
+  for (Int_t iCell = 0; iCell < ncells; iCell++)
+  {
+    fCaloCells->GetCell(iCell, absId, ecell, tcell, mclabel, efrac);
+    if (absId < 0 || absId >= fCellTableNCells || bad[absId]) {
+      ecell = 0;
+      tcell = -1;
+    }
+    else {
+      // The reco utils recalibrate the amplitude in single precision
+      Float_t amp = ecell;
+      amp *= energy[absId];
+      ecell = amp;
+      if (timeOffset) tcell -= timeOffset[absId];
+    }
+    fCaloCells->SetCell(iCell, absId, ecell, tcell, mclabel, efrac);
+  }
+
+  fCaloCells->Sort();
+}
+
 /**
  * Check whether the run changed.
  */
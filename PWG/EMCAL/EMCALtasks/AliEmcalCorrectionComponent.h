@@ -3,6 +3,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 // CINT can't handle the yaml header!
 #if !(defined(__CINT__) || defined(__MAKECINT__))
@@ -55,6 +56,8 @@ class AliEmcalCorrectionComponent : public TNamed {
   
   void GetEtaPhiDiff(const AliVTrack *t, const AliVCluster *v, Double_t &phidiff, Double_t &etadiff);
   void UpdateCells();
+  void BuildCellCalibrationTable();
+  void UpdateCellsFromTable();
   Bool_t RunChanged();
   void GetPass();
   void FillCellQA(TH1F* h);
@@ -77,6 +80,7 @@ class AliEmcalCorrectionComponent : public TNamed {
   void SetCentrality(Double_t cent) { fCent = cent; }
   void SetNcentralityBins(Int_t n) { fNcentBins = n; }
   void SetIsESD(Bool_t isESD) {fEsdMode = isESD; }
+  void SetUseCellCalibrationTable(Bool_t b) { fUseCellCalibrationTable = b; fCellTableRun = -1; }
 
 #if !(defined(__CINT__) || defined(__MAKECINT__))
   /// Make copy to ensure that the nodes do not point to each other (?)
@@ -129,12 +133,20 @@ class AliEmcalCorrectionComponent : public TNamed {
   
   TString                fBasePath;                       ///< Base folder path to get root files
 
+  Bool_t                 fUseCellCalibrationTable;        ///< Apply the cell corrections from a flattened per-run table instead of AliEMCALRecoUtils
+  Int_t                  fCellTableRun;                   //!<! Run for which the cell calibration table was built
+  Int_t                  fCellTableNCells;                //!<! Number of cells (absolute IDs) in the cell calibration table
+  Bool_t                 fCellTableApplyTime;             //!<! Whether the time offsets of the table are applied
+  std::vector<UChar_t>   fCellTableBad;                   //!<! Bad channel mask, indexed by absolute cell ID
+  std::vector<Float_t>   fCellTableEnergy;                //!<! Energy recalibration factor, indexed by absolute cell ID
+  std::vector<Double_t>  fCellTableTime;                  //!<! Time offset (s) including the L1 phase, indexed by (bunch crossing % 4) * fCellTableNCells + absolute cell ID
+
  private:
   AliEmcalCorrectionComponent(const AliEmcalCorrectionComponent &);               // Not implemented
   AliEmcalCorrectionComponent &operator=(const AliEmcalCorrectionComponent &);    // Not implemented
   
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionComponent, 1); // EMCal correction component
+  ClassDef(AliEmcalCorrectionComponent, 2); // EMCal correction component
   /// \endcond
 };
 
@@ -11,11 +11,21 @@
 #include <fstream>
 #include <sstream>
 #include <iostream>
+#include <map>
+#include <functional>
+#include <algorithm>
+#include <thread>
+#include <atomic>
 
 #include <TChain.h>
 #include <TSystem.h>
 #include <TGrid.h>
 #include <TFile.h>
+#include <TClonesArray.h>
+#include <RVersion.h>
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+#include <TROOT.h>
+#endif
 
 #include "AliVEventHandler.h"
 #include "AliEMCALGeometry.h"
@@ -26,6 +36,8 @@
 #include "AliCentrality.h"
 #include "AliESDEvent.h"
 #include "AliAnalysisManager.h"
+#include "AliClusterContainer.h"
+#include "AliParticleContainer.h"
 
 /// \cond CLASSIMP
 ClassImp(AliEmcalCorrectionTask);
@@ -49,6 +61,8 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask() :
   fDefaultConfigurationFilename(""),
   fDefaultConfigurationString(""),
   fCorrectionComponents(),
+  fExecutionLevels(),
+  fNumberOfThreads(1),
   fIsEsd(false),
   fForceBeamType(kNA),
   fRunPeriod("noSetRunPeriod"),
@@ -101,6 +115,8 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask(const char * name) :
   fDefaultConfigurationFilename(""),
   fDefaultConfigurationString(""),
   fCorrectionComponents(),
+  fExecutionLevels(),
+  fNumberOfThreads(1),
   fIsEsd(false),
   fForceBeamType(kNA),
   fRunPeriod("noSetRunPeriod"),
@@ -239,7 +255,7 @@ void AliEmcalCorrectionTask::InitializeConfiguration()
   {
     AliInfo(TString::Format("Using default EMCal corrections configuration located at %s", fDefaultConfigurationFilename.c_str()));
 
-    fDefaultConfiguration = YAML::LoadFile(fDefaultConfigurationFilename);
+    fDefaultConfiguration = LoadConfigurationFile(fDefaultConfigurationFilename);
     // Check for valid file
     if (fDefaultConfiguration.IsNull() == true)
     {
@@ -258,7 +274,7 @@ void AliEmcalCorrectionTask::InitializeConfiguration()
   {
     AliInfo(TString::Format("Using user EMCal corrections configuration located at %s", fUserConfigurationFilename.c_str()));
 
-    fUserConfiguration = YAML::LoadFile(fUserConfigurationFilename);
+    fUserConfiguration = LoadConfigurationFile(fUserConfigurationFilename);
   }
   else
   {
@@ -453,13 +469,9 @@ void AliEmcalCorrectionTask::CheckForUnmatchedUserSettings()
     for (auto userPropertyName : userPropertyNames)
     {
       AliDebugStream(2) << "Checking property " << userPropertyName << std::endl;
-      foundMatch = false;
-      for (auto defaultPropertyName : defaultPropertyNames)
-      {
-        if (userPropertyName == defaultPropertyName) {
-          AliDebugStream(2) << "Found match of " << userPropertyName << " with " << defaultPropertyName << std::endl;
-          foundMatch = true;
-        }
+      foundMatch = (defaultPropertyNames.find(userPropertyName) != defaultPropertyNames.end());
+      if (foundMatch == true) {
+        AliDebugStream(2) << "Found match of " << userPropertyName << " in the default configuration" << std::endl;
       }
       if (foundMatch == false) {
         AliFatal(TString::Format("Property \"%s:%s\" defined in the user configuration file cannot be found in the default configuration file! Check the spelling in your user file!", tempComponentName.c_str(), userPropertyName.c_str()));
@@ -929,12 +941,12 @@ void AliEmcalCorrectionTask::UserCreateOutputObjects()
   if (fUserConfiguration.IsNull() == true && fUserConfigurationString != "")
   {
     AliInfo("Reinitializing user configuration from string. Expected if running on grid!");
-    fUserConfiguration = YAML::Load(fUserConfigurationString);
+    fUserConfiguration = LoadConfiguration(fUserConfigurationString);
   }
   if (fDefaultConfiguration.IsNull() == true)
   {
     AliInfo("Reinitializing default configuration from string. Expected if running on grid!");
-    fDefaultConfiguration = YAML::Load(fDefaultConfigurationString);
+    fDefaultConfiguration = LoadConfiguration(fDefaultConfigurationString);
   }
 
   // Debug to check that the configuration has been (re)initiailzied has been completed correctly
@@ -1094,6 +1106,73 @@ void AliEmcalCorrectionTask::ExecOnceComponents()
     // Component ExecOnce()
     component->ExecOnce();
   }
+
+  // The cells are only known at this point, so the dependencies can be determined now
+  BuildExecutionGraph();
+}
+
+/**
+ * Groups the correction components into execution levels. Each component is described by the input
+ * objects it was given (cells, cluster array and track array). Since components may modify any of their
+ * input objects, two components which share an input object depend on each other, and the one that
+ * appears later in the configured order must run after the earlier one. A component is placed one level
+ * after the last level of all of its dependencies, such that the components within a level are
+ * independent and the configured order is preserved for all components which share input objects.
+ */
+void AliEmcalCorrectionTask::BuildExecutionGraph()
+{
+  fExecutionLevels.clear();
+
+  // Last level which used a given input object
+  std::map <const TObject *, int> lastLevelForInputObject;
+  // Components without any known input object act as a barrier for all following components
+  int firstAllowedLevel = 0;
+  for (auto component : fCorrectionComponents)
+  {
+    std::vector <const TObject *> inputObjects;
+    if (component->GetCaloCells()) inputObjects.push_back(component->GetCaloCells());
+    if (component->GetClusterContainer() && component->GetClusterContainer()->GetArray()) inputObjects.push_back(component->GetClusterContainer()->GetArray());
+    if (component->GetParticleContainer() && component->GetParticleContainer()->GetArray()) inputObjects.push_back(component->GetParticleContainer()->GetArray());
+
+    int level = firstAllowedLevel;
+    if (inputObjects.size() == 0) {
+      // Without any known input, we cannot exclude dependence on preceding components
+      level = std::max(level, static_cast<int>(fExecutionLevels.size()));
+      firstAllowedLevel = level + 1;
+    }
+    for (auto obj : inputObjects)
+    {
+      auto it = lastLevelForInputObject.find(obj);
+      if (it != lastLevelForInputObject.end()) {
+        level = std::max(level, it->second + 1);
+      }
+    }
+    for (auto obj : inputObjects)
+    {
+      lastLevelForInputObject[obj] = level;
+    }
+
+    if (level == static_cast<int>(fExecutionLevels.size())) {
+      fExecutionLevels.push_back(std::vector <AliEmcalCorrectionComponent *>());
+    }
+    fExecutionLevels.at(level).push_back(component);
+  }
+
+  for (unsigned int i = 0; i < fExecutionLevels.size(); i++)
+  {
+    std::stringstream levelMessage;
+    for (auto component : fExecutionLevels.at(i))
+    {
+      levelMessage << " " << component->GetName();
+    }
+    AliDebugStream(1) << "Execution level " << i << ":" << levelMessage.str() << std::endl;
+  }
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  if (fNumberOfThreads > 1) {
+    ROOT::EnableThreadSafety();
+  }
+#endif
 }
 
 /**
@@ -1203,8 +1282,11 @@ Bool_t AliEmcalCorrectionTask::Run()
     component->SetMCEvent(MCEvent());
     component->SetCentralityBin(fCentBin);
     component->SetCentrality(fCent);
+  }
 
-    component->Run();
+  for (const auto & level : fExecutionLevels)
+  {
+    RunComponents(level);
   }
 
   PostData(1, fOutput);
@@ -1212,6 +1294,45 @@ Bool_t AliEmcalCorrectionTask::Run()
   return kTRUE;
 }
 
+/**
+ * Calls Run() for the components of one execution level. If more than one thread is requested
+ * and the level contains more than one component, the components are distributed over a pool
+ * of worker threads. Otherwise, they are run sequentially in the configured order.
+ *
+ * @param[in] components Independent components to run
+ */
+void AliEmcalCorrectionTask::RunComponents(const std::vector<AliEmcalCorrectionComponent *> & components)
+{
+  unsigned int nThreads = std::min(static_cast<unsigned int>(fNumberOfThreads), static_cast<unsigned int>(components.size()));
+  if (nThreads <= 1) {
+    for (auto component : components)
+    {
+      component->Run();
+    }
+    return;
+  }
+
+  std::atomic <unsigned int> nextComponent(0);
+  auto worker = [&components, &nextComponent]() {
+    for (unsigned int i = nextComponent++; i < components.size(); i = nextComponent++)
+    {
+      components[i]->Run();
+    }
+  };
+
+  std::vector <std::thread> workers;
+  for (unsigned int i = 1; i < nThreads; i++)
+  {
+    workers.emplace_back(worker);
+  }
+  // The calling thread takes part in the work as well
+  worker();
+  for (auto & thread : workers)
+  {
+    thread.join();
+  }
+}
+
 /**
  * Executed when the file is changed. Also calls UserNotify() for each component.
  *
@@ -1617,6 +1738,51 @@ void AliEmcalCorrectionTask::GetPropertyNamesFromNode(const std::string & compon
   }
 }
 
+/**
+ * Parses a YAML configuration. Parsed configurations are kept for the lifetime of the process, keyed
+ * by the hash of their content, so that several correction tasks in the same job (and the reinitialization
+ * from the streamed strings on the worker) only parse each configuration once. A deep copy is returned, such
+ * that the tasks never share (and modify) the same nodes.
+ *
+ * @param[in] configuration Content of the YAML configuration
+ *
+ * @return The parsed configuration, owned by the caller
+ */
+YAML::Node AliEmcalCorrectionTask::LoadConfiguration(const std::string & configuration)
+{
+  static std::map <std::size_t, std::pair <std::string, YAML::Node> > parsedConfigurations;
+
+  std::size_t hash = std::hash <std::string>()(configuration);
+  auto cached = parsedConfigurations.find(hash);
+  // Compare the content as well, in case of a hash collision
+  if (cached != parsedConfigurations.end() && cached->second.first == configuration) {
+    AliDebugClassStream(2) << "Using the cached parsed configuration with hash " << hash << std::endl;
+    return YAML::Clone(cached->second.second);
+  }
+
+  YAML::Node node = YAML::Load(configuration);
+  parsedConfigurations[hash] = std::make_pair(configuration, YAML::Clone(node));
+  return node;
+}
+
+/**
+ * Reads and parses a YAML configuration file, through the cache of LoadConfiguration().
+ *
+ * @param[in] filename Name of the local file
+ *
+ * @return The parsed configuration, owned by the caller
+ */
+YAML::Node AliEmcalCorrectionTask::LoadConfigurationFile(const std::string & filename)
+{
+  std::ifstream inFile(filename);
+  if (!inFile) {
+    throw YAML::BadFile();
+  }
+  std::stringstream content;
+  content << inFile.rdbuf();
+  return LoadConfiguration(content.str());
+}
+
 /**
  * Create new container for MC particles and attach it to the task. The name
  * provided to this function must match the name of the array attached
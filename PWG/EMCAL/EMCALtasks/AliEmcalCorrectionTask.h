@@ -109,6 +109,10 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   void                        SetUseNewCentralityEstimation(Bool_t b)               { fUseNewCentralityEstimation = b                     ; }
   virtual void                SetNCentBins(Int_t n)                                 { fNcentBins         = n                              ; }
   void                        SetCentRange(Double_t min, Double_t max)              { fMinCent           = min  ; fMaxCent = max          ; }
+  // Component execution options
+  /// Number of worker threads used to run independent components of the same execution level (1 runs everything sequentially)
+  void                        SetNumberOfThreads(Int_t n)                           { fNumberOfThreads   = n > 0 ? n : 1                  ; }
+  Int_t                       GetNumberOfThreads()                            const { return fNumberOfThreads                             ; }
 
   /**
    * Direct access to the correction components.
@@ -118,6 +122,12 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
    * reflected in the stored YAML configuration.
    */
   const std::vector<AliEmcalCorrectionComponent *> & CorrectionComponents() { return fCorrectionComponents; }
+  /**
+   * Components grouped by execution level, as determined from the input objects of each component.
+   * Components in the same level do not share any cells, cluster or track array and can run concurrently.
+   * Only available after the first event has been processed.
+   */
+  const std::vector<std::vector<AliEmcalCorrectionComponent *> > & ExecutionLevels() const { return fExecutionLevels; }
 
   // Containers and cells
   AliParticleContainer       *AddParticleContainer(const char *n);
@@ -182,6 +192,8 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   // Execute component functions
   void UserCreateOutputObjectsComponents();
   void ExecOnceComponents();
+  void BuildExecutionGraph();
+  void RunComponents(const std::vector<AliEmcalCorrectionComponent *> & components);
 
   // Initialization functions
   void InitializeConfiguration();
@@ -208,6 +220,9 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   void GetNodeForInputObjects(YAML::Node & inputNode, YAML::Node & nodeToRetrieveFrom, std::string & inputObjectName, bool requiredProperty);
   // YAML node dependent initialization utlitiles
   void GetPropertyNamesFromNode(const std::string & componentName, const YAML::Node & node, std::set <std::string> & propertyNames, const bool nodeRequired);
+  // Parsing of the configuration, cached by content
+  static YAML::Node LoadConfiguration(const std::string & configuration);
+  static YAML::Node LoadConfigurationFile(const std::string & filename);
 #endif
 
 #if !(defined(__CINT__) || defined(__MAKECINT__))
@@ -225,6 +240,8 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
 
   std::vector <std::string>   fOrderedComponentsToExecute; ///< Ordered set of components to execute
   std::vector <AliEmcalCorrectionComponent *> fCorrectionComponents; ///< Contains the correction components
+  std::vector <std::vector <AliEmcalCorrectionComponent *> > fExecutionLevels; //!<! Correction components grouped into levels of independent components
+  Int_t                       fNumberOfThreads;            ///< Number of threads used to run the components of one execution level
   bool                        fConfigurationInitialized;   ///< True if the YAML configuration files are initialized
 
   bool                        fIsEsd;                      ///< File type
@@ -251,7 +268,7 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   TList *                     fOutput;                     //!<! Output for histograms
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionTask, 3); // EMCal correction task
+  ClassDef(AliEmcalCorrectionTask, 4); // EMCal correction task
   /// \endcond
 };
 
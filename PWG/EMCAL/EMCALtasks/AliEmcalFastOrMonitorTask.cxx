@@ -24,6 +24,7 @@
 #include <TParameter.h>
 #include <TVector3.h>
 
+#include "AliEmcalChannelStatistics.h"
 #include "AliEmcalFastOrMonitorTask.h"
 #include "AliEMCALGeometry.h"
 #include "AliEMCALTriggerConstants.h"
@@ -53,7 +54,11 @@ AliEmcalFastOrMonitorTask::AliEmcalFastOrMonitorTask() :
   fNameMaskedFastorOADB(),
   fNameMaskedCellOADB("$ALICE_PHYSICS/OADB/EMCAL/EMCALBadChannels.root"),
   fMaskedFastorOADB(nullptr),
-  fMaskedCellOADB(nullptr)
+  fMaskedCellOADB(nullptr),
+  fFillChannelStatistics(kFALSE),
+  fFillFastOrHistograms(kTRUE),
+  fFastOrAmplitudeStat(nullptr),
+  fFastOrTimeSumStat(nullptr)
 {
 
 }
@@ -71,7 +76,11 @@ AliEmcalFastOrMonitorTask::AliEmcalFastOrMonitorTask(const char *name) :
   fNameMaskedFastorOADB(),
   fNameMaskedCellOADB("$ALICE_PHYSICS/OADB/EMCAL/EMCALBadChannels.root"),
   fMaskedFastorOADB(nullptr),
-  fMaskedCellOADB(nullptr)
+  fMaskedCellOADB(nullptr),
+  fFillChannelStatistics(kFALSE),
+  fFillFastOrHistograms(kTRUE),
+  fFastOrAmplitudeStat(nullptr),
+  fFastOrTimeSumStat(nullptr)
 {
   DefineOutput(1, TList::Class());
 }
@@ -89,10 +98,21 @@ void AliEmcalFastOrMonitorTask::UserCreateOutputObjects() {
   fHistos->CreateTH1("hEvents", "Number of events", 1, 0.5, 1.5);
   fHistos->CreateTH1("hFastOrFrequencyL0", "FastOr frequency at Level0", kMaxFastOr, -0.5, kMaxFastOr - 0.5);
   fHistos->CreateTH1("hFastOrFrequencyL1", "FastOr frequency at Level1", kMaxFastOr, -0.5, kMaxFastOr - 0.5);
-  fHistos->CreateTH2("hFastOrAmplitude", "FastOr amplitudes", kMaxFastOr, -0.5, kMaxFastOr - 0.5, 513, -0.5, 512.5);
-  fHistos->CreateTH2("hFastOrTimeSum", "FastOr time sum", kMaxFastOr, -0.5, kMaxFastOr - 0.5, 2049, -0.5, 2048.5);
-  fHistos->CreateTH2("hFastOrTransverseTimeSum", "FastOr transverse time sum", kMaxFastOr, -0.5, kMaxFastOr - 0.5, 2049, -0.5, 2048.5);
-  fHistos->CreateTH2("hFastOrNL0Times", "FastOr Number of L0 times", kMaxFastOr, -0.5, kMaxFastOr - 0.5, 16, -0.5, 15.5);
+  if(fFillFastOrHistograms){
+    fHistos->CreateTH2("hFastOrAmplitude", "FastOr amplitudes", kMaxFastOr, -0.5, kMaxFastOr - 0.5, 513, -0.5, 512.5);
+    fHistos->CreateTH2("hFastOrTimeSum", "FastOr time sum", kMaxFastOr, -0.5, kMaxFastOr - 0.5, 2049, -0.5, 2048.5);
+    fHistos->CreateTH2("hFastOrTransverseTimeSum", "FastOr transverse time sum", kMaxFastOr, -0.5, kMaxFastOr - 0.5, 2049, -0.5, 2048.5);
+    fHistos->CreateTH2("hFastOrNL0Times", "FastOr Number of L0 times", kMaxFastOr, -0.5, kMaxFastOr - 0.5, 16, -0.5, 15.5);
+  }
+  if(fFillChannelStatistics){
+    // Per FastOR summaries, in the output list next to the histograms
+    fFastOrAmplitudeStat = new AliEmcalChannelStatistics("fastOrAmplitudeStat", "FastOr amplitude");
+    fFastOrAmplitudeStat->Init(kMaxFastOr, 128, 0., 512.);
+    fHistos->GetListOfHistograms()->Add(fFastOrAmplitudeStat);
+    fFastOrTimeSumStat = new AliEmcalChannelStatistics("fastOrTimeSumStat", "FastOr time sum");
+    fFastOrTimeSumStat->Init(kMaxFastOr, 256, 0., 2048.);
+    fHistos->GetListOfHistograms()->Add(fFastOrTimeSumStat);
+  }
   fHistos->CreateTH2("hFastOrColRowFrequencyL0", "FastOr Frequency (col-row) at Level1", kMaxCol, -0.5, kMaxCol - 0.5, kMaxRow, -0.5, kMaxRow - 0.5);
   fHistos->CreateTH2("hFastOrColRowFrequencyL1", "FastOr Frequency (col-row) at Level0", kMaxCol, -0.5, kMaxCol - 0.5, kMaxRow, -0.5, kMaxRow - 0.5);
   fHistos->CreateTH2("hEnergyFastorCell", "Sum of cell energy vs. fastor Energy", 1000, 0., 20., 1000 , 0., 20.);
@@ -219,10 +239,14 @@ void AliEmcalFastOrMonitorTask::UserExec(Option_t *) {
       fHistos->FillTH1("hFastOrFrequencyL1", fastOrID);
     }
     if(std::find(fMaskedFastors.begin(), fMaskedFastors.end(), fastOrID) == fMaskedFastors.end()){
-      fHistos->FillTH2("hFastOrAmplitude", fastOrID, amp);
-      fHistos->FillTH2("hFastOrTimeSum", fastOrID, l1timesum);
-      fHistos->FillTH2("hFastOrNL0Times", fastOrID, nl0times);
-      fHistos->FillTH2("hFastOrTransverseTimeSum", fastOrID, GetTransverseTimeSum(fastOrID, l1timesum, vtxpos));
+      if(fFastOrAmplitudeStat) fFastOrAmplitudeStat->Fill(fastOrID, amp);
+      if(fFastOrTimeSumStat) fFastOrTimeSumStat->Fill(fastOrID, l1timesum);
+      if(fFillFastOrHistograms){
+        fHistos->FillTH2("hFastOrAmplitude", fastOrID, amp);
+        fHistos->FillTH2("hFastOrTimeSum", fastOrID, l1timesum);
+        fHistos->FillTH2("hFastOrNL0Times", fastOrID, nl0times);
+        fHistos->FillTH2("hFastOrTransverseTimeSum", fastOrID, GetTransverseTimeSum(fastOrID, l1timesum, vtxpos));
+      }
       fHistos->FillTH2("hEnergyFastorCell", fCellData(globCol, globRow), l1timesum * EMCALTrigger::kEMCL1ADCtoGeV);
       int ncellmasked = 0;
       int fastorCells[4];
@@ -8,6 +8,7 @@
 #include <TString.h>
 
 class AliEMCALGeometry;
+class AliEmcalChannelStatistics;
 class AliOADBContainer;
 class THistManager;
 
@@ -86,6 +87,23 @@ public:
    */
   void DefineMaskedCellOADB(const char *oadbname) { fNameMaskedCellOADB = oadbname; }
 
+  /**
+   * @brief Fill per FastOR summaries of the ADC amplitude (fastOrAmplitudeStat)
+   * and of the L1 time sum (fastOrTimeSumStat) for the non-masked FastORs.
+   *
+   * The summaries (AliEmcalChannelStatistics) are filled by FastOR abs. ID
+   * and merged in constant size.
+   * @param[in] doFill If true the summaries are filled
+   */
+  void SetFillChannelStatistics(Bool_t doFill = kTRUE) { fFillChannelStatistics = doFill; }
+
+  /**
+   * @brief Switch the histograms with the FastOR abs. ID on one axis (amplitude,
+   * time sum, transverse time sum, number of L0 times), on by default.
+   * @param[in] doFill If false the histograms are not created
+   */
+  void SetFillFastOrHistograms(Bool_t doFill = kTRUE) { fFillFastOrHistograms = doFill; }
+
 protected:
 
   /**
@@ -166,8 +184,13 @@ protected:
   AliOADBContainer                        *fMaskedFastorOADB; //!<! OADB container with masked fastors
   AliOADBContainer                        *fMaskedCellOADB;   //!<! OADB container with masked cells
 
+  Bool_t                                  fFillChannelStatistics; ///< Fill the per FastOR summaries
+  Bool_t                                  fFillFastOrHistograms;  ///< Fill the FastOR ID x amplitude/time sum histograms
+  AliEmcalChannelStatistics               *fFastOrAmplitudeStat;  //!<! Summary of the FastOR amplitude per FastOR
+  AliEmcalChannelStatistics               *fFastOrTimeSumStat;    //!<! Summary of the L1 time sum per FastOR
+
   /// \cond CLASSIMP
-  ClassDef(AliEmcalFastOrMonitorTask, 1);
+  ClassDef(AliEmcalFastOrMonitorTask, 2);
   /// \endcond
 };
 
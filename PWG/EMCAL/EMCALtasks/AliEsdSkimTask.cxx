@@ -30,7 +30,7 @@ AliEsdSkimTask::AliEsdSkimTask(const char *opt) :
   fDoMult(1), fDoTof(0), fDoPileup(1), fDoClus(0), fDoMuonTracks(0), fEmcNames(""), 
   fDoMiniTracks(0), fTracks("Tracks"), fPhosClusOnly(0), fEmcalClusOnly(0),
   fDoSaveBytes(0), fDoCent(1), fDoRP(1), fRemoveCP(0), fResetCov(1), 
-  fDoPicoTracks(0), fCheckCond(0)
+  fDoPicoTracks(0), fCheckCond(0), fProjection(), fTrackMembers(), fTrackKeep(0)
 {
   // Constructor.
 
@@ -42,6 +42,65 @@ AliEsdSkimTask::AliEsdSkimTask(const char *opt) :
   DefineOutput(1, TTree::Class());
 }
 
+//_________________________________________________________________________________________________
+void AliEsdSkimTask::SetProjection(const char *branches)
+{
+  // Keep only the given ESD branches, e.g. "PrimaryVertex.,EMCALCells.,EMCALTrigger.,CaloClusters,Tracks".
+  // The header and the run branches are always kept. The branches not in the list are neither
+  // read from the input (branch names of the task) nor written to the output tree, and the
+  // corresponding SetDo... switches are set accordingly.
+
+  fProjection = branches;
+  fProjection.ReplaceAll(" ","");
+
+  fDoZDC        = IsProjected("AliESDZDC");
+  fDoV0         = IsProjected("AliESDVZERO");
+  fDoT0         = IsProjected("AliESDTZERO");
+  fDoTPCv       = IsProjected("TPCVertex");
+  fDoSPDv       = IsProjected("SPDVertex");
+  fDoPriv       = IsProjected("PrimaryVertex");
+  fDoEmCs       = IsProjected("EMCALCells");
+  fDoPCs        = IsProjected("PHOSCells");
+  fDoEmT        = IsProjected("EMCALTrigger");
+  fDoPT         = IsProjected("PHOSTrigger");
+  fDoTracks     = IsProjected("Tracks");
+  fDoFmd        = IsProjected("AliESDFMD");
+  fDoMult       = IsProjected("AliMultiplicity");
+  fDoTof        = IsProjected("AliTOFHeader");
+  fDoPileup     = IsProjected("SPDPileupVertices") || IsProjected("TrkPileupVertices");
+  fDoClus       = IsProjected("CaloClusters");
+  fDoMuonTracks = IsProjected("MuonTracks");
+  fDoCent       = IsProjected("Centrality");
+  fDoRP         = IsProjected("Eventplane");
+
+  fBranchNames = "ESD:AliESDHeader.,AliESDRun.";
+  if (fProjection.Length())
+    fBranchNames += Form(",%s", fProjection.Data());
+}
+
+//_________________________________________________________________________________________________
+Bool_t AliEsdSkimTask::IsProjected(const char *name) const
+{
+  // Check whether the object with the given name (with or without the trailing dot of the
+  // branch name) is kept in the projection.
+
+  if (fProjection.IsNull())
+    return kTRUE;
+  TString oname(name);
+  oname.Remove(TString::kTrailing,'.');
+  if (oname == "AliESDHeader" || oname == "AliESDRun")
+    return kTRUE;
+  TObjArray *arr = fProjection.Tokenize(",");
+  Bool_t found = kFALSE;
+  for (Int_t i=0; i<arr->GetEntries() && !found; ++i) {
+    TString bname(arr->At(i)->GetName());
+    bname.Remove(TString::kTrailing,'.');
+    found = (bname == oname);
+  }
+  delete arr;
+  return found;
+}
+
 //_________________________________________________________________________________________________
 void AliEsdSkimTask::UserExec(Option_t */*opt*/) 
 {
@@ -377,7 +436,12 @@ void AliEsdSkimTask::UserExec(Option_t */*opt*/)
           ++nacc;
         } else {
           AliEsdTrackExt *newtrack = new ((*tracksout)[nacc]) AliEsdTrackExt(*track);
-          if (fDoMiniTracks) {
+          if (fTrackMembers.Length()) {
+            newtrack->MakeMiniTrack(0, !TESTBIT(fTrackKeep,0), !TESTBIT(fTrackKeep,1), !TESTBIT(fTrackKeep,2),
+                                    !TESTBIT(fTrackKeep,3), !TESTBIT(fTrackKeep,4), !TESTBIT(fTrackKeep,5),
+                                    !TESTBIT(fTrackKeep,6), !TESTBIT(fTrackKeep,7));
+            newtrack->ResetCovariance(fResetCov);
+          } else if (fDoMiniTracks) {
             newtrack->MakeMiniTrack(0,fRemoveCP);
             newtrack->ResetCovariance(fResetCov);
           } else {
@@ -449,6 +513,46 @@ void AliEsdSkimTask::UserCreateOutputObjects()
       fEvent->AddObject(arr);
     }
   }
+  if (fProjection.Length()) {
+    // remove the standard objects not projected, they are not written at all (the copies in
+    // UserExec are done only for the objects found in the output event)
+    TList *objs = fEvent->GetList();
+    TObjArray removed;
+    TIter next(objs);
+    TObject *obj = 0;
+    while ((obj = next())) {
+      TString oname(obj->GetName());
+      if (oname == "PicoTracks" && fDoTracks)
+        continue;
+      if (fEmcNames.Length() && (";"+fEmcNames+";").Contains(";"+oname+";"))
+        continue;
+      if (!IsProjected(oname))
+        removed.Add(obj);
+    }
+    for (Int_t i=0; i<removed.GetEntries(); ++i) {
+      objs->Remove(removed.At(i));
+      delete removed.At(i);
+    }
+  }
+  if (fTrackMembers.Length()) {
+    // track information kept, the rest is reset with AliEsdTrackExt::MakeMiniTrack
+    const char *members[8] = {"ConstrainedParams","TrackParams","ClusterMaps","ITS","TPC","TRD","TOF","HMPID"};
+    fTrackKeep = 0;
+    TObjArray *arr = fTrackMembers.Tokenize(", ");
+    for (Int_t i=0; i<arr->GetEntries(); ++i) {
+      TString mname(arr->At(i)->GetName());
+      Int_t j = 0;
+      for (; j<8; ++j) {
+        if (mname == members[j]) {
+          SETBIT(fTrackKeep,j);
+          break;
+        }
+      }
+      if (j==8)
+        AliError(Form("Unknown track information %s, possible are ConstrainedParams,TrackParams,ClusterMaps,ITS,TPC,TRD,TOF,HMPID", mname.Data()));
+    }
+    delete arr;
+  }
   fEvent->GetStdContent();
   fEvent->WriteToTree(fTree);
   fTree->GetUserInfo()->Add(fEvent);
@@ -46,6 +46,8 @@ class AliEsdSkimTask : public AliAnalysisTaskSE {
   void SetRemoveCP(Bool_t b)       { fRemoveCP      = b; }
   void SetResetCov(Bool_t b)       { fResetCov      = b; }
   void SetTracks(const char *n)    { fTracks        = n; }
+  void SetProjection(const char *branches);
+  void SetTrackProjection(const char *m) { fTrackMembers = m; }
 
  protected:
   AliESDEvent     *fEvent;        //!esd event
@@ -80,11 +82,16 @@ class AliEsdSkimTask : public AliAnalysisTaskSE {
   Bool_t           fResetCov;     // if true reset covariance matrix of track
   Bool_t           fDoPicoTracks; // if true then do pico tracks
   Int_t            fCheckCond;    // if !=0 check certain conditions before event is accepted
+  TString          fProjection;   // if not empty, ESD branches to be read and written (comma separated)
+  TString          fTrackMembers; // if not empty, track information kept in the output tracks (comma separated)
+  UInt_t           fTrackKeep;    //!bits of the track information kept, from fTrackMembers
+
+  Bool_t           IsProjected(const char *name) const;
 
  private:
   AliEsdSkimTask(const AliEsdSkimTask&);            // not implemented
   AliEsdSkimTask &operator=(const AliEsdSkimTask&); // not implemented
 
- ClassDef(AliEsdSkimTask, 5); // Esd trimming and skimming task
+ ClassDef(AliEsdSkimTask, 6); // Esd trimming and skimming task
 };
 #endif
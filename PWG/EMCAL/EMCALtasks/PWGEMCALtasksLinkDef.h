@@ -5,6 +5,7 @@
 #pragma link off all functions;
 
 #pragma link C++ class AliAnalysisTaskEMCALClusterizeFast+;
+#pragma link C++ class AliEMCALFlatClusterizer+;
 #pragma link C++ class  AliAnalysisTaskEmcalSample+;
 #pragma link C++ class  AliAnalysisTaskEmcalTriggerPatchClusterMatch+;
 #pragma link C++ class  AliEMCALClusterParams+;
@@ -23,6 +24,7 @@
 #pragma link C++ class  AliEmcalTrackingQATask+;
 #pragma link C++ class  AliEmcalTrackPropagatorTask+;
 #pragma link C++ class  AliEmcalCellMonitorTask+;
+#pragma link C++ class  AliEmcalChannelStatistics+;
 #pragma link C++ class  AliEmcalFastOrMonitorTask+;
 #pragma link C++ class  AliEsdSkimTask+;
 #pragma link C++ class  AliEsdTrackExt+;
@@ -25,7 +25,8 @@ ClassImp(AliEmcalTriggerDecisionContainer)
 //______________________________________________________________________________
 AliEmcalTriggerDecisionContainer::AliEmcalTriggerDecisionContainer():
   TNamed(),
-  fContainer()
+  fContainer(),
+  fSelectionMask(0)
 {
   /*
    * Dummy constructor, for I/O, not to be called by the user
@@ -36,7 +37,8 @@ AliEmcalTriggerDecisionContainer::AliEmcalTriggerDecisionContainer():
 //______________________________________________________________________________
 AliEmcalTriggerDecisionContainer::AliEmcalTriggerDecisionContainer(const char* name):
   TNamed(name, ""),
-  fContainer()
+  fContainer(),
+  fSelectionMask(0)
 {
   /*
    * Main constructor, called by the user
@@ -50,6 +52,7 @@ void AliEmcalTriggerDecisionContainer::Reset() {
    * Clear container with trigger decisions
    */
   fContainer.Clear();
+  fSelectionMask = 0;
 }
 
 //______________________________________________________________________________
@@ -59,7 +62,9 @@ void AliEmcalTriggerDecisionContainer::AddTriggerDecision(AliEmcalTriggerDecisio
    *
    * @param decision: Trigger decision, created by the trigger selection task
    */
+  Int_t index = fContainer.GetEntries();
   fContainer.Add(decision);
+  if(index < 64 && decision->IsSelected()) fSelectionMask |= (ULong64_t(1) << index);
 }
 
 //______________________________________________________________________________
@@ -72,3 +77,32 @@ const AliEmcalTriggerDecision* AliEmcalTriggerDecisionContainer::FindTriggerDeci
    */
   return dynamic_cast<const AliEmcalTriggerDecision *>(fContainer.FindObject(decname));
 }
+
+//______________________________________________________________________________
+Int_t AliEmcalTriggerDecisionContainer::GetTriggerDecisionIndex(const char* decname) const {
+  /*
+   * Find the position of a trigger decision in the container, which is the bit of the
+   * decision in the selection mask
+   *
+   * @param decname: the name of the trigger decision object
+   * @return: the index of the trigger decision (-1 if not found)
+   */
+  TObject *decision = fContainer.FindObject(decname);
+  return decision ? fContainer.IndexOf(decision) : -1;
+}
+
+//______________________________________________________________________________
+Bool_t AliEmcalTriggerDecisionContainer::IsEventSelected(const char* decname) const {
+  /*
+   * Check whether the trigger decision with a given name selected the event. The decision
+   * is read from the selection mask for the first 64 decisions
+   *
+   * @param decname: the name of the trigger decision object
+   * @return: true if the decision exists and selected the event
+   */
+  Int_t index = GetTriggerDecisionIndex(decname);
+  if(index < 0) return kFALSE;
+  if(index < 64) return (fSelectionMask >> index) & 1;
+  const AliEmcalTriggerDecision *decision = static_cast<const AliEmcalTriggerDecision *>(fContainer.At(index));
+  return decision->IsSelected();
+}
@@ -20,11 +20,17 @@ public:
 
   void AddTriggerDecision(AliEmcalTriggerDecision * const decision);
   const AliEmcalTriggerDecision *FindTriggerDecision(const char *name) const;
+  Int_t GetNumberOfTriggerDecisions() const { return fContainer.GetEntries(); }
+  Int_t GetTriggerDecisionIndex(const char *name) const;
+  ULong64_t GetSelectionMask() const { return fSelectionMask; }
+  Bool_t IsEventSelected(Int_t index) const { return index >= 0 && index < 64 && ((fSelectionMask >> index) & 1); }
+  Bool_t IsEventSelected(const char *name) const;
 
 protected:
   TList     fContainer;         // List of trigger decisions
+  ULong64_t fSelectionMask;     // Bit i set if the decision i (order of adding, first 64) selected the event
 
-  ClassDef(AliEmcalTriggerDecisionContainer, 1);    // Container for trigger decisions
+  ClassDef(AliEmcalTriggerDecisionContainer, 2);    // Container for trigger decisions
 };
 
 #endif /* ALIEMCALTRIGGERDECISIONCONTAINER_H */
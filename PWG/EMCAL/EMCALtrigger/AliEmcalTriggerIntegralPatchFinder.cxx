@@ -0,0 +1,92 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <algorithm>
+
+#include "AliEMCALTriggerDataGrid.h"
+#include "AliEMCALTriggerRawPatch.h"
+#include "AliEmcalTriggerIntegralPatchFinder.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalTriggerIntegralPatchFinder)
+/// \endcond
+
+AliEmcalTriggerIntegralPatchFinder::AliEmcalTriggerIntegralPatchFinder():
+  TObject(),
+  fAlgorithms(),
+  fIntegralADC(),
+  fIntegralOfflineADC()
+{
+}
+
+void AliEmcalTriggerIntegralPatchFinder::AddTriggerAlgorithm(Int_t rowmin, Int_t rowmax, UInt_t bitmask, Int_t patchSize, Int_t subregionSize){
+  fAlgorithms.push_back(rowmin);
+  fAlgorithms.push_back(rowmax);
+  fAlgorithms.push_back(bitmask);
+  fAlgorithms.push_back(patchSize);
+  fAlgorithms.push_back(subregionSize);
+}
+
+std::vector<AliEMCALTriggerRawPatch> AliEmcalTriggerIntegralPatchFinder::FindPatches(const AliEMCALTriggerDataGrid<double> &adc, const AliEMCALTriggerDataGrid<double> &offlineAdc) const {
+  std::vector<AliEMCALTriggerRawPatch> result;
+  if(!fAlgorithms.size()) return result;
+
+  // One pass over each grid serves all patch sizes
+  BuildIntegral(adc, fIntegralADC);
+  BuildIntegral(offlineAdc, fIntegralOfflineADC);
+
+  const Int_t ncolsADC = adc.GetNumberOfCols(), nrowsADC = adc.GetNumberOfRows(),
+      ncolsOffline = offlineAdc.GetNumberOfCols(), nrowsOffline = offlineAdc.GetNumberOfRows();
+  for(std::vector<Int_t>::const_iterator algorithm = fAlgorithms.begin(); algorithm != fAlgorithms.end(); algorithm += kNAlgorithmFields){
+    const Int_t patchsize = algorithm[kPatchSize], subregion = algorithm[kSubregionSize];
+    if(subregion <= 0) continue;
+    const Int_t rowStartMax = algorithm[kRowMax] - (patchsize - 1), colStartMax = ncolsADC - patchsize;
+    for(int irow = algorithm[kRowMin]; irow <= rowStartMax; irow += subregion){
+      for(int icol = 0; icol <= colStartMax; icol += subregion){
+        double sumadc = GetPatchSum(fIntegralADC, ncolsADC, nrowsADC, icol, irow, patchsize),
+            sumofflineadc = GetPatchSum(fIntegralOfflineADC, ncolsOffline, nrowsOffline, icol, irow, patchsize);
+        if(sumadc > 0 || sumofflineadc > 0){
+          AliEMCALTriggerRawPatch recpatch(icol, irow, patchsize, sumadc, sumofflineadc);
+          recpatch.SetBitmask(static_cast<UInt_t>(algorithm[kBitMask]));
+          result.push_back(recpatch);
+        }
+      }
+    }
+  }
+  return result;
+}
+
+void AliEmcalTriggerIntegralPatchFinder::BuildIntegral(const AliEMCALTriggerDataGrid<double> &grid, std::vector<double> &table){
+  const Int_t ncols = grid.GetNumberOfCols(), nrows = grid.GetNumberOfRows(), stride = ncols + 1;
+  table.assign(stride * (nrows + 1), 0.);
+  for(int irow = 0; irow < nrows; irow++){
+    const double *above = &table[irow * stride];
+    double *current = &table[(irow + 1) * stride];
+    double rowsum = 0;
+    for(int icol = 0; icol < ncols; icol++){
+      rowsum += grid(icol, irow);
+      current[icol + 1] = above[icol + 1] + rowsum;
+    }
+  }
+}
+
+double AliEmcalTriggerIntegralPatchFinder::GetPatchSum(const std::vector<double> &table, Int_t ncols, Int_t nrows, Int_t col, Int_t row, Int_t size){
+  // Clip the patch to the grid: channels outside do not contribute
+  const Int_t colmin = std::max(col, 0), colmax = std::min(col + size, ncols),
+      rowmin = std::max(row, 0), rowmax = std::min(row + size, nrows);
+  if(colmin >= colmax || rowmin >= rowmax) return 0.;
+  const Int_t stride = ncols + 1;
+  return table[rowmax * stride + colmax] - table[rowmin * stride + colmax]
+      - table[rowmax * stride + colmin] + table[rowmin * stride + colmin];
+}
@@ -0,0 +1,108 @@
+#ifndef ALIEMCALTRIGGERINTEGRALPATCHFINDER_H
+#define ALIEMCALTRIGGERINTEGRALPATCHFINDER_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <vector>
+
+#include <TObject.h>
+
+class AliEMCALTriggerRawPatch;
+template<class T> class AliEMCALTriggerDataGrid;
+
+/**
+ * @class AliEmcalTriggerIntegralPatchFinder
+ * @brief Patch finder based on summed-area tables
+ * @ingroup EMCALTRGFW
+ * @since Oct. 14th, 2016
+ *
+ * Finds the same patches as AliEMCALTriggerPatchFinder with a set of
+ * AliEMCALTriggerAlgorithm, but instead of summing the channels of each
+ * (overlapping) patch explicitly, one summed-area table (integral image) is
+ * built per data grid and event. The sum over any patch is then obtained
+ * from four table entries, independent of the patch size, and all
+ * algorithms (gamma, jet and background patches) share the same tables.
+ *
+ * Channels outside the data grid do not contribute to the patch sums, as
+ * in AliEMCALTriggerAlgorithm.
+ */
+class AliEmcalTriggerIntegralPatchFinder : public TObject {
+public:
+
+  /**
+   * @brief Constructor
+   */
+  AliEmcalTriggerIntegralPatchFinder();
+
+  /**
+   * @brief Destructor
+   */
+  virtual ~AliEmcalTriggerIntegralPatchFinder() {}
+
+  /**
+   * @brief Add a trigger algorithm
+   * @param[in] rowmin Minimum row value
+   * @param[in] rowmax Maximum row value
+   * @param[in] bitmask Offline bit mask to be applied to the patches
+   * @param[in] patchSize Size of the patches
+   * @param[in] subregionSize Size of the sliding sub region
+   */
+  void AddTriggerAlgorithm(Int_t rowmin, Int_t rowmax, UInt_t bitmask, Int_t patchSize, Int_t subregionSize);
+
+  /**
+   * @brief Remove all trigger algorithms
+   */
+  void ClearTriggerAlgorithms() { fAlgorithms.clear(); }
+
+  /**
+   * @brief Get the number of trigger algorithms handled by the patch finder
+   * @return Number of trigger algorithms
+   */
+  Int_t GetNumberOfTriggerAlgorithms() const { return fAlgorithms.size() / kNAlgorithmFields; }
+
+  /**
+   * @brief Find patches for all trigger algorithms
+   *
+   * Patches are accepted if either the online or the offline ADC sum is above 0,
+   * and they are returned in the same order as by AliEMCALTriggerPatchFinder.
+   * @param[in] adc Data grid with the online ADC values
+   * @param[in] offlineAdc Data grid with the offline ADC values
+   * @return Trigger patches of all trigger algorithms
+   */
+  std::vector<AliEMCALTriggerRawPatch> FindPatches(const AliEMCALTriggerDataGrid<double> &adc, const AliEMCALTriggerDataGrid<double> &offlineAdc) const;
+
+  /**
+   * @brief Build the summed-area table of a data grid
+   *
+   * Entry (row, col) of the table, stored with a row stride of ncols + 1,
+   * contains the sum of all channels with smaller row and column index.
+   * @param[in] grid Input data grid
+   * @param[out] table Summed-area table
+   */
+  static void BuildIntegral(const AliEMCALTriggerDataGrid<double> &grid, std::vector<double> &table);
+
+  /**
+   * @brief Sum over a square patch from a summed-area table
+   * @param[in] table Summed-area table, as built by BuildIntegral
+   * @param[in] ncols Number of columns of the data grid
+   * @param[in] nrows Number of rows of the data grid
+   * @param[in] col Starting column of the patch
+   * @param[in] row Starting row of the patch
+   * @param[in] size Size of the patch
+   * @return Sum over the part of the patch inside the data grid
+   */
+  static double GetPatchSum(const std::vector<double> &table, Int_t ncols, Int_t nrows, Int_t col, Int_t row, Int_t size);
+
+protected:
+  enum { kRowMin = 0, kRowMax, kBitMask, kPatchSize, kSubregionSize, kNAlgorithmFields };
+
+  std::vector<Int_t>                        fAlgorithms;                  ///< Settings of the trigger algorithms, kNAlgorithmFields entries per algorithm
+  mutable std::vector<double>               fIntegralADC;                 //!<! Summed-area table of the online ADC values
+  mutable std::vector<double>               fIntegralOfflineADC;          //!<! Summed-area table of the offline ADC values
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalTriggerIntegralPatchFinder, 1);
+  /// \endcond
+};
+
+#endif
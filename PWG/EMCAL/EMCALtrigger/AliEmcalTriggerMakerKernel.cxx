@@ -50,6 +50,9 @@ AliEmcalTriggerMakerKernel::AliEmcalTriggerMakerKernel():
   fTriggerBitConfig(nullptr),
   fPatchFinder(nullptr),
   fLevel0PatchFinder(nullptr),
+  fIntegralPatchFinder(),
+  fIntegralLevel0PatchFinder(),
+  fUseIntegralPatchFinder(kFALSE),
   fL0MinTime(7),
   fL0MaxTime(10),
   fMinCellAmp(0),
@@ -72,7 +75,8 @@ AliEmcalTriggerMakerKernel::AliEmcalTriggerMakerKernel():
   fPatchEnergySimpleSmeared(nullptr),
   fLevel0TimeMap(nullptr),
   fTriggerBitMap(nullptr),
-  fADCtoGeV(1.)
+  fADCtoGeV(1.),
+  fIntegralSmeared()
 {
   memset(fThresholdConstants, 0, sizeof(Int_t) * 12);
   memset(fL1ThresholdsOffline, 0, sizeof(ULong64_t) * 4);
@@ -128,6 +132,7 @@ void AliEmcalTriggerMakerKernel::AddL1TriggerAlgorithm(Int_t rowmin, Int_t rowma
   trigger->SetPatchSize(patchSize);
   trigger->SetSubregionSize(subregionSize);
   fPatchFinder->AddTriggerAlgorithm(trigger);
+  fIntegralPatchFinder.AddTriggerAlgorithm(rowmin, rowmax, bitmask, patchSize, subregionSize);
 }
 
 void AliEmcalTriggerMakerKernel::SetL0TriggerAlgorithm(Int_t rowmin, Int_t rowmax, UInt_t bitmask, Int_t patchSize, Int_t subregionSize)
@@ -136,6 +141,8 @@ void AliEmcalTriggerMakerKernel::SetL0TriggerAlgorithm(Int_t rowmin, Int_t rowma
   fLevel0PatchFinder = new AliEMCALTriggerAlgorithm<double>(rowmin, rowmax, bitmask);
   fLevel0PatchFinder->SetPatchSize(patchSize);
   fLevel0PatchFinder->SetSubregionSize(subregionSize);
+  fIntegralLevel0PatchFinder.ClearTriggerAlgorithms();
+  fIntegralLevel0PatchFinder.AddTriggerAlgorithm(rowmin, rowmax, bitmask, patchSize, subregionSize);
 }
 
 void AliEmcalTriggerMakerKernel::ConfigureForPbPb2015()
@@ -146,6 +153,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPbPb2015()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  fIntegralPatchFinder.ClearTriggerAlgorithms();
 
   SetL0TriggerAlgorithm(0, 103, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit() | 1<<fTriggerBitConfig->GetGammaLowBit(), 2, 1);
@@ -163,6 +171,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPP2015()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  fIntegralPatchFinder.ClearTriggerAlgorithms();
 
   SetL0TriggerAlgorithm(0, 103, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit() | 1<<fTriggerBitConfig->GetGammaLowBit(), 2, 1);
@@ -180,6 +189,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPPb2013()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  fIntegralPatchFinder.ClearTriggerAlgorithms();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit() | 1<<fTriggerBitConfig->GetGammaLowBit(), 2, 1);
@@ -195,6 +205,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPP2012()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  fIntegralPatchFinder.ClearTriggerAlgorithms();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit(), 2, 1);
@@ -210,6 +221,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPbPb2011()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  fIntegralPatchFinder.ClearTriggerAlgorithms();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   AddL1TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetGammaHighBit(), 2, 1);
@@ -225,6 +237,7 @@ void AliEmcalTriggerMakerKernel::ConfigureForPP2011()
   // Initialize patch finder
   if (fPatchFinder) delete fPatchFinder;
   fPatchFinder = new AliEMCALTriggerPatchFinder<double>;
+  fIntegralPatchFinder.ClearTriggerAlgorithms();
 
   SetL0TriggerAlgorithm(0, 63, 1<<fTriggerBitConfig->GetLevel0Bit(), 2, 1);
   fConfigured = true;
@@ -487,8 +500,13 @@ TObjArray *AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inp
   bkgPatchMask = 1 << fTriggerBitConfig->GetBkgBit();
       //l0PatchMask = 1 << fTriggerBitConfig->GetLevel0Bit();
 
+  if(fUseIntegralPatchFinder && fPatchEnergySimpleSmeared) AliEmcalTriggerIntegralPatchFinder::BuildIntegral(*fPatchEnergySimpleSmeared, fIntegralSmeared);
+
   std::vector<AliEMCALTriggerRawPatch> patches;
-  if (fPatchFinder) {
+  if (fUseIntegralPatchFinder) {
+    patches = fIntegralPatchFinder.FindPatches(useL0amp ? *fPatchAmplitudes : *fPatchADC, *fPatchADCSimple);
+  }
+  else if (fPatchFinder) {
     if (useL0amp) {
       patches = fPatchFinder->FindPatches(*fPatchAmplitudes, *fPatchADCSimple);
     }
@@ -530,12 +548,7 @@ TObjArray *AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inp
     fullpatch->SetOffSet(offset);
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
-      double energysmear = 0;
-      for(int icol = 0; icol < fullpatch->GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch->GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch->GetColStart() + icol, fullpatch->GetRowStart() + irow);
-        }
-      }
+      double energysmear = GetSmearedPatchEnergy(fullpatch->GetColStart(), fullpatch->GetRowStart(), fullpatch->GetPatchSize());
       AliDebugStream(1) << "Patch size(" << fullpatch->GetPatchSize() <<") energy " << fullpatch->GetPatchE() << " smeared " << energysmear << std::endl;
       fullpatch->SetSmearedEnergyV1(energysmear);
     }
@@ -544,7 +557,8 @@ TObjArray *AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inp
 
   // Find Level0 patches
   std::vector<AliEMCALTriggerRawPatch> l0patches;
-  if (fLevel0PatchFinder) l0patches = fLevel0PatchFinder->FindPatches(*fPatchAmplitudes, *fPatchADCSimple);
+  if (fUseIntegralPatchFinder) l0patches = fIntegralLevel0PatchFinder.FindPatches(*fPatchAmplitudes, *fPatchADCSimple);
+  else if (fLevel0PatchFinder) l0patches = fLevel0PatchFinder->FindPatches(*fPatchAmplitudes, *fPatchADCSimple);
   for(std::vector<AliEMCALTriggerRawPatch>::iterator patchit = l0patches.begin(); patchit != l0patches.end(); ++patchit){
     Int_t offlinebits = 0, onlinebits = 0;
     if(HasPHOSOverlap(*patchit)) continue;
@@ -560,12 +574,7 @@ TObjArray *AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inp
     fullpatch->SetTriggerBitConfig(fTriggerBitConfig);
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
-      double energysmear = 0;
-      for(int icol = 0; icol < fullpatch->GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch->GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch->GetColStart() + icol, fullpatch->GetRowStart() + irow);
-        }
-      }
+      double energysmear = GetSmearedPatchEnergy(fullpatch->GetColStart(), fullpatch->GetRowStart(), fullpatch->GetPatchSize());
       fullpatch->SetSmearedEnergyV1(energysmear);
     }
     result->Add(fullpatch);
@@ -575,6 +584,19 @@ TObjArray *AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inp
 }
 
 
+double AliEmcalTriggerMakerKernel::GetSmearedPatchEnergy(Int_t col, Int_t row, Int_t size) const{
+  if(fUseIntegralPatchFinder){
+    return AliEmcalTriggerIntegralPatchFinder::GetPatchSum(fIntegralSmeared, fPatchEnergySimpleSmeared->GetNumberOfCols(), fPatchEnergySimpleSmeared->GetNumberOfRows(), col, row, size);
+  }
+  double energysmear = 0;
+  for(int icol = 0; icol < size; icol++){
+    for(int irow = 0; irow < size; irow++){
+      energysmear += (*fPatchEnergySimpleSmeared)(col + icol, row + irow);
+    }
+  }
+  return energysmear;
+}
+
 double AliEmcalTriggerMakerKernel::GetTriggerChannelADC(Int_t col, Int_t row) const{
   double adc = 0;
   try {
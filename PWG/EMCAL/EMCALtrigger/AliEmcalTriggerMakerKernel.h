@@ -6,9 +6,13 @@
 #include <set>
 #include <iostream>
 
+#include <vector>
+
 #include <TObject.h>
 #include <TArrayF.h>
 
+#include "AliEmcalTriggerIntegralPatchFinder.h"
+
 class TF1;
 class TObjArray;
 class AliEMCALTriggerPatchInfo;
@@ -306,6 +310,23 @@ public:
    */
   void SetApplyOnlineBadChannelMaskingToOffline(Bool_t doApply = kTRUE) { fApplyOnlineBadChannelsToOffline = doApply; }
 
+  /**
+   * @brief Use the summed-area table based patch finder
+   *
+   * Instead of summing each (overlapping) patch channel by channel, patch sums
+   * of all sizes are obtained from one prefix-sum pass over the online and
+   * offline ADC grids (see AliEmcalTriggerIntegralPatchFinder). The same is
+   * done for the smeared patch energies, if enabled.
+   * @param[in] doUse If true the summed-area table based patch finder is used
+   */
+  void SetUseIntegralPatchFinder(Bool_t doUse = kTRUE) { fUseIntegralPatchFinder = doUse; }
+
+  /**
+   * @brief Check whether the summed-area table based patch finder is used
+   * @return True if the summed-area table based patch finder is used
+   */
+  Bool_t IsUsingIntegralPatchFinder() const { return fUseIntegralPatchFinder; }
+
   /**
    * @brief Reset all data grids and VZERO-dependent L1 thresholds
    */
@@ -456,6 +477,17 @@ protected:
    */
   bool HasPHOSOverlap(const AliEMCALTriggerRawPatch &patch) const;
 
+  /**
+   * Sum the smeared energy of all channels in a patch. If the summed-area
+   * table based patch finder is used, the sum is obtained from the
+   * summed-area table of the smeared energy grid.
+   * @param[in] col Starting column of the patch
+   * @param[in] row Starting row of the patch
+   * @param[in] size Size of the patch
+   * @return Smeared patch energy
+   */
+  double GetSmearedPatchEnergy(Int_t col, Int_t row, Int_t size) const;
+
   std::set<Short_t>                         fBadChannels;                 ///< Container of bad channels
   std::set<Short_t>                         fOfflineBadChannels;          ///< Abd ID of offline bad channels
   TArrayF                                   fFastORPedestal;              ///< FastOR pedestal
@@ -463,6 +495,9 @@ protected:
 
   AliEMCALTriggerPatchFinder<double>       *fPatchFinder;                 ///< The actual patch finder
   AliEMCALTriggerAlgorithm<double>         *fLevel0PatchFinder;           ///< Patch finder for Level0 patches
+  AliEmcalTriggerIntegralPatchFinder        fIntegralPatchFinder;         ///< Summed-area table based patch finder with the same L1 algorithms
+  AliEmcalTriggerIntegralPatchFinder        fIntegralLevel0PatchFinder;   ///< Summed-area table based patch finder with the same Level0 algorithm
+  Bool_t                                    fUseIntegralPatchFinder;      ///< Use the summed-area table based patch finders
   Int_t                                     fL0MinTime;                   ///< Minimum L0 time
   Int_t                                     fL0MaxTime;                   ///< Maximum L0 time
   Int_t                                     fMinCellAmp;                  ///< Minimum offline amplitude of the cells used to generate the patches
@@ -491,9 +526,10 @@ protected:
   AliEMCALTriggerDataGrid<int>              *fTriggerBitMap;              //!<! Map of trigger bits
 
   Double_t                                  fADCtoGeV;                    //!<! Conversion factor from ADC to GeV
+  std::vector<double>                       fIntegralSmeared;             //!<! Summed-area table of the smeared energies
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalTriggerMakerKernel, 4);
+  ClassDef(AliEmcalTriggerMakerKernel, 5);
   /// \endcond
 };
 
@@ -171,6 +171,17 @@ public:
     if(fTriggerMaker) fTriggerMaker->SetApplyOnlineBadChannelMaskingToOffline(doApply);
   }
 
+  /**
+   * @brief Use the summed-area table based patch finder in the trigger maker kernel.
+   *
+   * Patches of all sizes are then obtained from one prefix-sum pass over the
+   * online and offline ADC grids.
+   * @param[in] doUse If true the summed-area table based patch finder is used
+   */
+  void SetUseIntegralPatchFinder(Bool_t doUse = kTRUE) {
+    if(fTriggerMaker) fTriggerMaker->SetUseIntegralPatchFinder(doUse);
+  }
+
   void SetTriggerThresholdJetLow   ( Int_t a, Int_t b, Int_t c ) {
     if(fTriggerMaker) fTriggerMaker->SetTriggerThresholdJetLow(a, b, c);
   }
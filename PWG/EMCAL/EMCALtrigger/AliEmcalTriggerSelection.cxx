@@ -19,7 +19,6 @@
  *
  * Author: Markus Fasel
  */
-#include <vector>
 #include <TClonesArray.h>
 
 #include "AliEMCALTriggerPatchInfo.h"
@@ -65,24 +64,42 @@ AliEmcalTriggerDecision* AliEmcalTriggerSelection::MakeDecison(const TClonesArra
    * input event
    * @return: the trigger decision (an event is selected when it has a main patch that fired the decision)
    */
-  AliEmcalTriggerDecision *result = new AliEmcalTriggerDecision(fOutputName.Data());
+  AliEmcalTriggerDecision *result = CreateDecision();
   TIter patchIter(inputPatches);
   AliEMCALTriggerPatchInfo *patch(NULL);
-  std::vector<AliEMCALTriggerPatchInfo *> selectedPatches;
   while((patch = dynamic_cast<AliEMCALTriggerPatchInfo *>(patchIter()))){
-    if(fSelectionCuts->IsSelected(patch)){
-      selectedPatches.push_back(patch);
-    }
-  }
-  // Find the main patch
-  AliEMCALTriggerPatchInfo *mainPatch(NULL), *testpatch(NULL);
-  for(std::vector<AliEMCALTriggerPatchInfo *>::iterator it = selectedPatches.begin(); it != selectedPatches.end(); ++it){
-    testpatch = *it;
-    if(!mainPatch) mainPatch = testpatch;
-    else if(fSelectionCuts->CompareTriggerPatches(testpatch, mainPatch) > 0) mainPatch = testpatch;
-    result->AddAcceptedPatch(testpatch);
+    AddPatch(result, patch);
   }
-  if(mainPatch) result->SetMainPatch(mainPatch);
+  return result;
+}
+
+//______________________________________________________________________________
+AliEmcalTriggerDecision* AliEmcalTriggerSelection::CreateDecision() const {
+  /*
+   * Create an empty trigger decision for this selection, to be filled with AddPatch. Used
+   * when several selections are evaluated in the same loop over the patches.
+   *
+   * @return: the trigger decision, without accepted patches
+   */
+  AliEmcalTriggerDecision *result = new AliEmcalTriggerDecision(fOutputName.Data());
   result->SetSelectionCuts(fSelectionCuts);
   return result;
 }
+
+//______________________________________________________________________________
+Bool_t AliEmcalTriggerSelection::AddPatch(AliEmcalTriggerDecision * const decision, AliEMCALTriggerPatchInfo * const patch) const {
+  /*
+   * Apply the selection cuts to a patch and, if it is selected, add it to the accepted patches
+   * of the decision. The main patch is the first patch with the largest cut primitive, as in
+   * the loop over all the patches in MakeDecison.
+   *
+   * @param decision: the trigger decision created by CreateDecision
+   * @param patch: the patch to be checked
+   * @return: true if the patch is selected
+   */
+  if(!fSelectionCuts->IsSelected(patch)) return kFALSE;
+  const AliEMCALTriggerPatchInfo *mainPatch = decision->GetMainPatch();
+  if(!mainPatch || fSelectionCuts->CompareTriggerPatches(patch, mainPatch) > 0) decision->SetMainPatch(patch);
+  decision->AddAcceptedPatch(patch);
+  return kTRUE;
+}
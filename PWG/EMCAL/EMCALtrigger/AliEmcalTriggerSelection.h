@@ -25,6 +25,8 @@ public:
   void SetSelectionCuts(const AliEmcalTriggerSelectionCuts * const cuts) { fSelectionCuts = cuts; }
 
   AliEmcalTriggerDecision * MakeDecison(const TClonesArray * const reconstructedPatches) const;
+  AliEmcalTriggerDecision * CreateDecision() const;
+  Bool_t AddPatch(AliEmcalTriggerDecision * const decision, AliEMCALTriggerPatchInfo * const patch) const;
 protected:
   const AliEmcalTriggerSelectionCuts  *fSelectionCuts;    // Cuts used for the trigger patch selection
   TString                              fOutputName;       // Name of the output object (AliEmcalTriggerDecision)
@@ -6,6 +6,7 @@
 
 #pragma link C++ class AliEmcalTriggerMaker+;
 #pragma link C++ class AliEmcalTriggerMakerKernel+;
+#pragma link C++ class AliEmcalTriggerIntegralPatchFinder+;
 #pragma link C++ class AliEmcalTriggerMakerTask+;
 #pragma link C++ class AliEmcalTriggerSetupInfo+;
 #pragma link C++ class AliEmcalTriggerDecision+;
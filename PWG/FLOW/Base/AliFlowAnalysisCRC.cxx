@@ -45,6 +45,7 @@
 #include "AliFlowVector.h"
 #include "AliFlowTrackSimple.h"
 #include "AliFlowAnalysisCRC.h"
+#include "AliFlowQVectorEngine.h"
 #include "AliLog.h"
 #include "TRandom.h"
 #include "TF1.h"
@@ -145,6 +146,7 @@ fUseQvectorTerms(kFALSE),
 fReQ(NULL),
 fImQ(NULL),
 fSpk(NULL),
+fQVectorEngine(NULL),
 fIntFlowCorrelationsEBE(NULL),
 fIntFlowEventWeightsForCorrelationsEBE(NULL),
 fIntFlowCorrelationsAllEBE(NULL),
@@ -361,6 +363,7 @@ fZDCGainAlpha(0.395)
   fAvVtxPosZ = TArrayD();
   
   // CRC
+  for(Int_t st=0;st<kNumberOfStages;st++) {fStageActive[st] = kFALSE;}
   this->InitializeCostantsForCRC();
   this->InitializeArraysForParticleWeights();
   this->InitializeArraysForCRC();
@@ -398,6 +401,7 @@ AliFlowAnalysisCRC::~AliFlowAnalysisCRC()
   delete[] fCorrMap;
   delete[] fchisqVA;
   delete[] fchisqVC;
+  delete fQVectorEngine;
 } // end of AliFlowAnalysisCRC::~AliFlowAnalysisCRC()
 
 //================================================================================================================
@@ -438,20 +442,15 @@ void AliFlowAnalysisCRC::Init()
   this->BookEverythingForControlHistograms();
   this->BookEverythingForBootstrap();
   this->SetRunList();
+  // sub-analyses are booked only when requested; the per-event inputs below are shared by them:
+  this->RegisterStages();
   this->BookEverythingForCRC();
-  this->BookEverythingForCRCVZ();
-  this->BookEverythingForCRCZDC();
-  this->BookEverythingForCRCPt();
-  this->BookEverythingForCRC2();
   this->BookEverythingForQVec();
-  this->BookEverythingForCME();
   this->BookEverythingForFlowEbE();
-  this->BookEverythingForFlowQC();
-  this->BookEverythingForFlowQCHighOrders();
-  this->BookEverythingForFlowSPZDC();
-  this->BookEverythingForFlowSPVZ();
-  this->BookEverythingForEbEFlow();
   this->BookEverythingForVarious();
+  for(Int_t st=0;st<kNumberOfStages;st++) {
+    if(fStageActive[st]) this->BookStage(st);
+  }
   
   this->SetCentralityWeights();
   
@@ -477,6 +476,134 @@ void AliFlowAnalysisCRC::Init()
   
 } // end of void AliFlowAnalysisCRC::Init()
 
+//=======================================================================================================================
+
+Bool_t AliFlowAnalysisCRC::IsStageRequested(Int_t stage) const
+{
+  // Is sub-analysis 'stage' enabled by the current configuration?
+  
+  switch(stage) {
+    case kStageCRC2:      return fCalculateCRC && fCalculateCRC2;
+    case kStageCRCVZ:     return fCalculateCRC && fCalculateCRCVZ && fUseVZERO;
+    case kStageCRCZDC:    return fCalculateCRC && fCalculateCRCZDC && fUseZDC;
+    case kStageCRCPt:     return fCalculateCRC && fCalculateCRCPt;
+    case kStageCME:       return fCalculateCRC && fCalculateCME && fUseZDC;
+    case kStageFlowSPZDC: return fCalculateFlowZDC && fUseZDC;
+    case kStageFlowQC:    return fCalculateFlowQC;
+    case kStageFlowSPVZ:  return fCalculateFlowVZ && fUseVZERO;
+    case kStageEbEFlow:   return fCalculateEbEFlow;
+    default:              return kFALSE;
+  }
+  
+} // end of Bool_t AliFlowAnalysisCRC::IsStageRequested(Int_t stage) const
+
+//=======================================================================================================================
+
+const char* AliFlowAnalysisCRC::GetStageName(Int_t stage)
+{
+  // Name of sub-analysis 'stage'.
+  
+  static const char* names[kNumberOfStages] = {"CRC2","CRCVZ","CRCZDC","CRCPt","CME","FlowSPZDC","FlowQC","FlowSPVZ","EbEFlow"};
+  if(stage<0 || stage>=kNumberOfStages) return "";
+  return names[stage];
+  
+} // end of const char* AliFlowAnalysisCRC::GetStageName(Int_t stage)
+
+//=======================================================================================================================
+
+void AliFlowAnalysisCRC::RegisterStages()
+{
+  // Register the requested sub-analyses; only these are booked, filled and finalized.
+  
+  for(Int_t st=0;st<kNumberOfStages;st++) {
+    fStageActive[st] = this->IsStageRequested(st);
+  }
+  
+} // end of void AliFlowAnalysisCRC::RegisterStages()
+
+//=======================================================================================================================
+
+void AliFlowAnalysisCRC::BookStage(Int_t stage)
+{
+  // Book everything needed by sub-analysis 'stage'.
+  
+  switch(stage) {
+    case kStageCRC2:      this->BookEverythingForCRC2(); break;
+    case kStageCRCVZ:     this->BookEverythingForCRCVZ(); break;
+    case kStageCRCZDC:    this->BookEverythingForCRCZDC(); break;
+    case kStageCRCPt:     this->BookEverythingForCRCPt(); break;
+    case kStageCME:       this->BookEverythingForCME(); break;
+    case kStageFlowSPZDC: this->BookEverythingForFlowSPZDC(); break;
+    case kStageFlowQC:
+      this->BookEverythingForFlowQC();
+      this->BookEverythingForFlowQCHighOrders();
+      break;
+    case kStageFlowSPVZ:  this->BookEverythingForFlowSPVZ(); break;
+    case kStageEbEFlow:   this->BookEverythingForEbEFlow(); break;
+    default: break;
+  }
+  
+} // end of void AliFlowAnalysisCRC::BookStage(Int_t stage)
+
+//=======================================================================================================================
+
+void AliFlowAnalysisCRC::CalculateStage(Int_t stage)
+{
+  // Event-by-event part of sub-analysis 'stage', from the shared per-event Q-vectors.
+  
+  switch(stage) {
+    case kStageCRC2:
+      this->CalculateCRCCorr();
+      this->CalculateCRC2Cor();
+      break;
+    case kStageCRCVZ:     this->CalculateCRCVZERO(); break;
+    case kStageCRCZDC:    this->CalculateCRCZDC(); break;
+    case kStageCRCPt:     this->CalculateCRCPtCorr(); break;
+    case kStageCME:
+      this->CalculateCMETPC();
+      this->CalculateCMEZDC();
+      break;
+    case kStageFlowSPZDC: this->CalculateFlowSPZDC(); break;
+    case kStageFlowQC:
+      this->CalculateFlowQC();
+      this->CalculateFlowQCHighOrders();
+      break;
+    case kStageFlowSPVZ:  this->CalculateFlowSPVZ(); break;
+    case kStageEbEFlow:   this->FitEbEFlow(); break;
+    default: break;
+  }
+  
+} // end of void AliFlowAnalysisCRC::CalculateStage(Int_t stage)
+
+//=======================================================================================================================
+
+void AliFlowAnalysisCRC::FinalizeStage(Int_t stage)
+{
+  // Final results of sub-analysis 'stage'.
+  
+  switch(stage) {
+    case kStageCRC2:
+      this->FinalizeCRCCorr();
+      this->FinalizeCRC2Cor();
+      break;
+    case kStageCRCVZ:     this->FinalizeCRCVZERO(); break;
+    case kStageCRCZDC:    this->FinalizeCRCZDC(); break;
+    case kStageCRCPt:     this->FinalizeCRCPtCorr(); break;
+    case kStageCME:
+      this->FinalizeCMETPC();
+      this->FinalizeCMEZDC();
+      break;
+    case kStageFlowSPZDC: this->FinalizeFlowSPZDC(); break;
+    case kStageFlowQC:
+      this->FinalizeFlowQC();
+      this->FinalizeFlowQCHighOrders();
+      break;
+    case kStageFlowSPVZ:  this->FinalizeFlowSPVZ(); break;
+    default: break; // nothing to finalize for EbE flow
+  }
+  
+} // end of void AliFlowAnalysisCRC::FinalizeStage(Int_t stage)
+
 //================================================================================================================
 
 void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
@@ -538,6 +665,7 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
   
   Double_t ptEta[2] = {0.,0.}; // 0 = dPt, 1 = dEta
   Int_t dCharge = 0; // charge
+  fQVectorEngine->Reset();
   
   // d) Loop over data and calculate e-b-e quantities Q_{n,k}, S_{p,k} and s_{p,k}:
   Int_t nPrim = anEvent->NumberOfTracks();  // nPrim = total number of primary tracks
@@ -774,23 +902,8 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
           //          wPhiEta *= 1./fEtaWeightsHist[fCenBin][ptbin][cw]->GetBinContent(fEtaWeightsHist[fCenBin][ptbin][cw]->FindBin(dEta));
         }
         
-        // Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] for this event (m = 1,2,...,12, k = 0,1,...,8):
-        for(Int_t m=0;m<12;m++) // to be improved - hardwired 6
-        {
-          for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-          {
-            (*fReQ)(m,k)+=pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1)*n*dPhi);
-            (*fImQ)(m,k)+=pow(wPhiEta*wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1)*n*dPhi);
-          }
-        }
-        // Calculate S_{p,k} for this event (Remark: final calculation of S_{p,k} follows after the loop over data bellow):
-        for(Int_t p=0;p<8;p++)
-        {
-          for(Int_t k=0;k<9;k++)
-          {
-            (*fSpk)(p,k)+=pow(wPhiEta*wPhi*wPt*wEta*wTrack,k);
-          }
-        }
+        // Buffer this RP for Re[Q_{m*n,k}], Im[Q_{m*n,k}] and S_{p,k} (Remark: they are copied out after the loop over data bellow):
+        fQVectorEngine->Fill(dPhi,wPhiEta*wPhi*wPt*wEta*wTrack);
         // Differential flow:
         if(fCalculateDiffFlow || fCalculate2DDiffFlow)
         {
@@ -970,34 +1083,39 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
         } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
         
         // Charge-Rapidity Correlations
+        // (per-event inputs are filled only for the sub-analyses which use them)
         for (Int_t h=0;h<fCRCnHar;h++) {
           
-          fCRCQRe[cw][h]->Fill(dEta,wPhiEta*TMath::Cos((h+1.)*dPhi));
-          fCRCQIm[cw][h]->Fill(dEta,wPhiEta*TMath::Sin((h+1.)*dPhi));
-          fCRCMult[cw][h]->Fill(dEta,wPhiEta);
-          
-          fCRC2QRe[cw][h]->Fill(dEta,wPhiEta*TMath::Cos((h+1.)*dPhi));
-          fCRC2QIm[cw][h]->Fill(dEta,wPhiEta*TMath::Sin((h+1.)*dPhi));
-          fCRC2Mul[cw][h]->Fill(dEta,wPhiEta);
-          
-          fCRCZDCQRe[cw][h]->Fill(dEta,wPhiEta*TMath::Cos((h+1.)*dPhi));
-          fCRCZDCQIm[cw][h]->Fill(dEta,wPhiEta*TMath::Sin((h+1.)*dPhi));
-          fCRCZDCMult[cw][h]->Fill(dEta,wPhiEta);
-          
-          if(fRandom->Integer(2)>0.5) {
-            fCRC2QRe[2][h]->Fill(dEta,wPhiEta*TMath::Cos((h+1.)*dPhi));
-            fCRC2QIm[2][h]->Fill(dEta,wPhiEta*TMath::Sin((h+1.)*dPhi));
-            fCRC2Mul[2][h]->Fill(dEta,wPhiEta);
+          if(fStageActive[kStageCRC2]) {
+            fCRCQRe[cw][h]->Fill(dEta,wPhiEta*TMath::Cos((h+1.)*dPhi));
+            fCRCQIm[cw][h]->Fill(dEta,wPhiEta*TMath::Sin((h+1.)*dPhi));
+            fCRCMult[cw][h]->Fill(dEta,wPhiEta);
+            
+            fCRC2QRe[cw][h]->Fill(dEta,wPhiEta*TMath::Cos((h+1.)*dPhi));
+            fCRC2QIm[cw][h]->Fill(dEta,wPhiEta*TMath::Sin((h+1.)*dPhi));
+            fCRC2Mul[cw][h]->Fill(dEta,wPhiEta);
+            
+            if(fRandom->Integer(2)>0.5) {
+              fCRC2QRe[2][h]->Fill(dEta,wPhiEta*TMath::Cos((h+1.)*dPhi));
+              fCRC2QIm[2][h]->Fill(dEta,wPhiEta*TMath::Sin((h+1.)*dPhi));
+              fCRC2Mul[2][h]->Fill(dEta,wPhiEta);
+            }
           }
           
-          if(fRandom->Integer(2)>0.5) {
-            fCRCZDCQRe[2][h]->Fill(dEta,wPhiEta*TMath::Cos((h+1.)*dPhi));
-            fCRCZDCQIm[2][h]->Fill(dEta,wPhiEta*TMath::Sin((h+1.)*dPhi));
-            fCRCZDCMult[2][h]->Fill(dEta,wPhiEta);
-          } else {
-            fCRCZDCQRe[3][h]->Fill(dEta,wPhiEta*TMath::Cos((h+1.)*dPhi));
-            fCRCZDCQIm[3][h]->Fill(dEta,wPhiEta*TMath::Sin((h+1.)*dPhi));
-            fCRCZDCMult[3][h]->Fill(dEta,wPhiEta);
+          if(fStageActive[kStageCRCVZ] || fStageActive[kStageCRCZDC]) {
+            fCRCZDCQRe[cw][h]->Fill(dEta,wPhiEta*TMath::Cos((h+1.)*dPhi));
+            fCRCZDCQIm[cw][h]->Fill(dEta,wPhiEta*TMath::Sin((h+1.)*dPhi));
+            fCRCZDCMult[cw][h]->Fill(dEta,wPhiEta);
+            
+            if(fRandom->Integer(2)>0.5) {
+              fCRCZDCQRe[2][h]->Fill(dEta,wPhiEta*TMath::Cos((h+1.)*dPhi));
+              fCRCZDCQIm[2][h]->Fill(dEta,wPhiEta*TMath::Sin((h+1.)*dPhi));
+              fCRCZDCMult[2][h]->Fill(dEta,wPhiEta);
+            } else {
+              fCRCZDCQRe[3][h]->Fill(dEta,wPhiEta*TMath::Cos((h+1.)*dPhi));
+              fCRCZDCQIm[3][h]->Fill(dEta,wPhiEta*TMath::Sin((h+1.)*dPhi));
+              fCRCZDCMult[3][h]->Fill(dEta,wPhiEta);
+            }
           }
           
           if(fCalculateCME) {
@@ -1006,12 +1124,14 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
               Double_t weraw = fZDCESESpecWeightsHist[fZDCESEclEbE]->GetBinContent(fZDCESESpecWeightsHist[fZDCESEclEbE]->FindBin(fCentralityEBE,dPt));
               if(weraw > 0.) SpecWeig = 1./weraw;
             }
-            fCMEQRe[cw][h]->Fill(dEta,SpecWeig*wPhiEta*TMath::Cos((h+1.)*dPhi));
-            fCMEQIm[cw][h]->Fill(dEta,SpecWeig*wPhiEta*TMath::Sin((h+1.)*dPhi));
-            fCMEMult[cw][h]->Fill(dEta,SpecWeig*wPhiEta);
-            fCMEQRe[2+cw][h]->Fill(dEta,pow(SpecWeig*wPhiEta,2.)*TMath::Cos((h+1.)*dPhi));
-            fCMEQIm[2+cw][h]->Fill(dEta,pow(SpecWeig*wPhiEta,2.)*TMath::Sin((h+1.)*dPhi));
-            fCMEMult[2+cw][h]->Fill(dEta,pow(SpecWeig*wPhiEta,2.));
+            if(fStageActive[kStageCME]) {
+              fCMEQRe[cw][h]->Fill(dEta,SpecWeig*wPhiEta*TMath::Cos((h+1.)*dPhi));
+              fCMEQIm[cw][h]->Fill(dEta,SpecWeig*wPhiEta*TMath::Sin((h+1.)*dPhi));
+              fCMEMult[cw][h]->Fill(dEta,SpecWeig*wPhiEta);
+              fCMEQRe[2+cw][h]->Fill(dEta,pow(SpecWeig*wPhiEta,2.)*TMath::Cos((h+1.)*dPhi));
+              fCMEQIm[2+cw][h]->Fill(dEta,pow(SpecWeig*wPhiEta,2.)*TMath::Sin((h+1.)*dPhi));
+              fCMEMult[2+cw][h]->Fill(dEta,pow(SpecWeig*wPhiEta,2.));
+            }
             
             // spectra
             fhCenvsSpec[fZDCESEclEbE]->Fill(fCentralityEBE,dPt,SpecWeig*wPhiEta);
@@ -1130,11 +1250,20 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
   
   
   // e) Calculate the final expressions for S_{p,k} and s_{p,k} (important !!!!):
+  fQVectorEngine->Finish();
+  for(Int_t m=0;m<12;m++)
+  {
+    for(Int_t k=0;k<9;k++)
+    {
+      (*fReQ)(m,k)+=fQVectorEngine->ReQ(m+1,k);
+      (*fImQ)(m,k)+=fQVectorEngine->ImQ(m+1,k);
+    }
+  }
   for(Int_t p=0;p<8;p++)
   {
     for(Int_t k=0;k<9;k++)
     {
-      (*fSpk)(p,k)=pow((*fSpk)(p,k),p+1);
+      (*fSpk)(p,k)=pow((*fSpk)(p,k)+fQVectorEngine->SumOfWeightsToPower(k),p+1);
     }
   }
   
@@ -1261,28 +1390,13 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
     // ... to be ctd ...
   } // end of if(!fEvaluateDiffFlowNestedLoops)
   
-  // i.2) Calculate CRC quantities:
-  if(fCalculateCRC) {
-//    if(fUseCRCRecenter) this->RecenterCRCQVec();
-    if(fCalculateCRC2) this->CalculateCRCCorr();
-    if(fCalculateCRC2) this->CalculateCRC2Cor();
-    if(fCalculateCRCVZ && fUseVZERO) this->CalculateCRCVZERO();
-    if(fCalculateCRCZDC && fUseZDC) this->CalculateCRCZDC();
-    if(fCalculateCRCPt) this->CalculateCRCPtCorr();
-    //    if(fUseVZERO && fUseZDC) this->CalculateVZvsZDC();
-    if(fCalculateCME && fUseZDC) {
-      this->CalculateCMETPC();
-      this->CalculateCMEZDC();
-    }
+  // i.2) Calculate CRC quantities and the other registered sub-analyses:
+  //    if(fUseCRCRecenter) this->RecenterCRCQVec();
+  //    if(fUseVZERO && fUseZDC) this->CalculateVZvsZDC();
+  // WARNING: do not invert order of SPZDC and QC, used in SC (see CRCStage)
+  for(Int_t st=0;st<kNumberOfStages;st++) {
+    if(fStageActive[st]) this->CalculateStage(st);
   }
-  // WARNING: do not invert order of SPZDC and QC, used in SC
-  if(fCalculateFlowZDC && fUseZDC) this->CalculateFlowSPZDC();
-  if(fCalculateFlowQC) {
-    this->CalculateFlowQC();
-    this->CalculateFlowQCHighOrders();
-  }
-  if(fCalculateFlowVZ && fUseVZERO) this->CalculateFlowSPVZ();
-  if(fCalculateEbEFlow) this->FitEbEFlow();
   
   // j) Distributions of correlations:
   if(fStoreDistributions){this->StoreDistributionsOfCorrelations();}
@@ -1495,25 +1609,13 @@ void AliFlowAnalysisCRC::Finish()
   // n) Calculate cumulants for mixed harmonics:
   if(fCalculateMixedHarmonics){this->CalculateCumulantsMixedHarmonics();}
   
-  // o) Calculate charge-rapidity correlations:
-  if(fCalculateCRC) {
-    if(fCalculateCRC2) this->FinalizeCRCCorr();
-    if(fCalculateCRC2) this->FinalizeCRC2Cor();
-    if(fCalculateCRCVZ && fUseVZERO) this->FinalizeCRCVZERO();
-    if(fCalculateCRCZDC && fUseZDC) this->FinalizeCRCZDC();
-    if(fCalculateCRCPt) this->FinalizeCRCPtCorr();
-    if(fCalculateCME && fUseZDC) {
-      this->FinalizeCMETPC();
-      this->FinalizeCMEZDC();
-    }
-  }
-  // WARNING: do not invert order of SPZDC and QC, used in SC
-  if(fCalculateFlowZDC && fUseZDC) this->FinalizeFlowSPZDC();
-  if(fCalculateFlowQC) {
-    this->FinalizeFlowQC();
-    this->FinalizeFlowQCHighOrders();
+  // o) Calculate charge-rapidity correlations and finalize the other registered sub-analyses
+  //    (flags may have been restored from the output file, so register them again):
+  this->RegisterStages();
+  // WARNING: do not invert order of SPZDC and QC, used in SC (see CRCStage)
+  for(Int_t st=0;st<kNumberOfStages;st++) {
+    if(fStageActive[st]) this->FinalizeStage(st);
   }
-  if(fCalculateFlowVZ && fUseVZERO) this->FinalizeFlowSPVZ();
   
   // p) Calculate cumulants for bootstrap:
   if(fUseBootstrap||fUseBootstrapVsM){this->CalculateCumulantsForBootstrap();}
@@ -2510,6 +2612,9 @@ void AliFlowAnalysisCRC::BookEverythingForIntegratedFlow()
   fReQ = new TMatrixD(12,9);
   fImQ = new TMatrixD(12,9);
   fSpk = new TMatrixD(8,9);
+  // block-wise accumulator for Q_{m*n,k}, m = 0,1,...,12, k = 0,1,...,8 (m = 0 gives sum_i w_i^k):
+  delete fQVectorEngine;
+  fQVectorEngine = new AliFlowQVectorEngine(12,8,fHarmonic);
   // average correlations <2>, <4>, <6> and <8> for single event (bining is the same as in fIntFlowCorrelationsPro and fIntFlowCorrelationsHist):
   TString intFlowCorrelationsEBEName = "fIntFlowCorrelationsEBE";
   intFlowCorrelationsEBEName += fAnalysisLabel->Data();
@@ -28635,17 +28740,7 @@ void AliFlowAnalysisCRC::BookEverythingForCRCVZ()
 
 void AliFlowAnalysisCRC::BookEverythingForCRCZDC()
 {
-  // EbE quantities
-  for(Int_t c=0;c<4;c++) {
-    for (Int_t h=0;h<fCRCnHar;h++) {
-      fCRCZDCQRe[c][h] = new TH1D(Form("fCRCZDCQRe[%d][%d]",c,h),Form("fCRCZDCQRe[%d][%d]",c,h),fCRCZDCnEtaBin,fCRCEtaMin,fCRCEtaMax);
-      fTempList->Add(fCRCZDCQRe[c][h]);
-      fCRCZDCQIm[c][h] = new TH1D(Form("fCRCZDCQIm[%d][%d]",c,h),Form("fCRCZDCQIm[%d][%d]",c,h),fCRCZDCnEtaBin,fCRCEtaMin,fCRCEtaMax);
-      fTempList->Add(fCRCZDCQIm[c][h]);
-      fCRCZDCMult[c][h] = new TH1D(Form("fCRCZDCMult[%d][%d]",c,h),Form("fCRCZDCMult[%d][%d]",c,h),fCRCZDCnEtaBin,fCRCEtaMin,fCRCEtaMax);
-      fTempList->Add(fCRCZDCMult[c][h]);
-    }
-  }
+  // EbE quantities are booked in BookEverythingForCRC(), shared with CRCVZ
   
   if(!fCalculateCRC){return;}
   if(!fCalculateCRCZDC){return;}
@@ -28738,6 +28833,22 @@ void AliFlowAnalysisCRC::BookEverythingForCRC()
   fCRCFlags->GetXaxis()->SetBinLabel(17,"CalculateEbEFlow");
   fCRCList->Add(fCRCFlags);
   
+  // EbE quantities, used by CRCVZ and CRCZDC
+  if(fStageActive[kStageCRCVZ] || fStageActive[kStageCRCZDC]) {
+    for(Int_t c=0;c<4;c++) {
+      for (Int_t h=0;h<fCRCnHar;h++) {
+        fCRCZDCQRe[c][h] = new TH1D(Form("fCRCZDCQRe[%d][%d]",c,h),Form("fCRCZDCQRe[%d][%d]",c,h),fCRCZDCnEtaBin,fCRCEtaMin,fCRCEtaMax);
+        fTempList->Add(fCRCZDCQRe[c][h]);
+        fCRCZDCQIm[c][h] = new TH1D(Form("fCRCZDCQIm[%d][%d]",c,h),Form("fCRCZDCQIm[%d][%d]",c,h),fCRCZDCnEtaBin,fCRCEtaMin,fCRCEtaMax);
+        fTempList->Add(fCRCZDCQIm[c][h]);
+        fCRCZDCMult[c][h] = new TH1D(Form("fCRCZDCMult[%d][%d]",c,h),Form("fCRCZDCMult[%d][%d]",c,h),fCRCZDCnEtaBin,fCRCEtaMin,fCRCEtaMax);
+        fTempList->Add(fCRCZDCMult[c][h]);
+      }
+    }
+  }
+  
+  if(!fStageActive[kStageCRC2]){return;}
+  
   // EbE quantities
   for(Int_t c=0;c<2;c++) {
     for (Int_t h=0;h<fCRCnHar;h++) {
@@ -28746,12 +28857,10 @@ void AliFlowAnalysisCRC::BookEverythingForCRC()
       fCRCQIm[c][h] = new TH1D(Form("fCRCQIm[%d][%d]",c,h),Form("fCRCQIm[%d][%d]",c,h),fCRCnEtaBins,fCRCEtaMin,fCRCEtaMax);
       fTempList->Add(fCRCQIm[c][h]);
       fCRCMult[c][h] = new TH1D(Form("fCRCMult[%d][%d]",c,h),Form("fCRCMult[%d][%d]",c,h),fCRCnEtaBins,fCRCEtaMin,fCRCEtaMax);
-      fTempList->Add(fCRCQIm[c][h]);
+      fTempList->Add(fCRCMult[c][h]);
     }
   }
   
-  if(!fCalculateCRC2){return;}
-  
   for(Int_t eg=0;eg<fCRCnEtaGap;eg++) {
     for (Int_t h=0;h<fCRCnCen;h++) {
       
@@ -40,6 +40,7 @@ class TProfile;
 class TProfile2D;
 class TProfile3D;
 class TDirectoryFile;
+class AliFlowQVectorEngine;
 class TRandom3;
 class TNtuple;
 class THnSparse;
@@ -85,6 +86,20 @@ public:
     kAllCh
   };
   
+  // sub-analyses, in execution order (SPZDC before QC, used in SC):
+  enum CRCStage {
+    kStageCRC2,
+    kStageCRCVZ,
+    kStageCRCZDC,
+    kStageCRCPt,
+    kStageCME,
+    kStageFlowSPZDC,
+    kStageFlowQC,
+    kStageFlowSPVZ,
+    kStageEbEFlow,
+    kNumberOfStages
+  };
+  
   // 0.) methods called in the constructor:
   virtual void InitializeArraysForIntFlow();
   virtual void InitializeArraysForDiffFlow();
@@ -141,6 +156,11 @@ public:
   virtual void BookEverythingForFlowSPZDC();
   virtual void BookEverythingForFlowSPVZ();
   virtual void BookEverythingForEbEFlow();
+  virtual void RegisterStages();
+  virtual Bool_t IsStageRequested(Int_t stage) const;
+  Bool_t IsStageActive(Int_t stage) const {return (stage>=0 && stage<kNumberOfStages) ? fStageActive[stage] : kFALSE;};
+  static const char* GetStageName(Int_t stage);
+  virtual void BookStage(Int_t stage);
   virtual void StoreIntFlowFlags();
   virtual void StoreDiffFlowFlags();
   virtual void StoreFlagsForDistributions();
@@ -222,11 +242,13 @@ public:
   virtual void CalculateFlowSPZDC();
   virtual void CalculateFlowSPVZ();
   virtual void FitEbEFlow();
+  virtual void CalculateStage(Int_t stage);
   // 2h.) Various
   virtual void FillVarious();
   
   // 3.) method Finish() and methods called within Finish():
   virtual void Finish();
+  virtual void FinalizeStage(Int_t stage);
   virtual void CheckPointersUsedInFinish();
   // 3a.) integrated flow:
   virtual void FinalizeCorrelationsIntFlow();
@@ -1216,6 +1238,7 @@ private:
   TMatrixD *fReQ; //! fReQ[m][k] = sum_{i=1}^{M} w_{i}^{k} cos(m*phi_{i})
   TMatrixD *fImQ; //! fImQ[m][k] = sum_{i=1}^{M} w_{i}^{k} sin(m*phi_{i})
   TMatrixD *fSpk; //! fSM[p][k] = (sum_{i=1}^{M} w_{i}^{k})^{p+1}
+  AliFlowQVectorEngine *fQVectorEngine; //! block-wise accumulator filling fReQ, fImQ and fSpk
   TH1D *fIntFlowCorrelationsEBE; //! 1st bin: <2>, 2nd bin: <4>, 3rd bin: <6>, 4th bin: <8>
   TH1D *fIntFlowEventWeightsForCorrelationsEBE; //! 1st bin: eW_<2>, 2nd bin: eW_<4>, 3rd bin: eW_<6>, 4th bin: eW_<8>
   TH1D *fIntFlowCorrelationsAllEBE; //! to be improved (add comment)
@@ -1442,6 +1465,7 @@ private:
   TList *fTempList; //! list to hold temp histograms
   TProfile *fCRCFlags; //! profile to hold all flags for CRC
   Bool_t fCalculateCRC; // calculate CRC
+  Bool_t fStageActive[kNumberOfStages]; //! sub-analyses booked, filled and finalized in this wagon
   Bool_t fCalculateCRCPt;
   Bool_t fCalculateCME;
   Bool_t fCalculateCRC2;
@@ -24,6 +24,7 @@
 #define AliFlowAnalysisWithMultiparticleCorrelations_cxx
 
 #include "AliFlowAnalysisWithMultiparticleCorrelations.h"
+#include "AliFlowQVectorEngine.h"
 
 using std::endl;
 using std::cout;
@@ -64,6 +65,8 @@ AliFlowAnalysisWithMultiparticleCorrelations::AliFlowAnalysisWithMultiparticleCo
  fQvectorFlagsPro(NULL),
  fCalculateQvector(kFALSE),
  fCalculateDiffQvectors(kFALSE),
+ fQVectorEngine(NULL),
+ fCorrelatorCache(),
  // 3.) Correlations:
  fCorrelationsList(NULL),
  fCorrelationsFlagsPro(NULL),
@@ -169,6 +172,7 @@ AliFlowAnalysisWithMultiparticleCorrelations::~AliFlowAnalysisWithMultiparticleC
  // Destructor.
  
  delete fHistList;
+ delete fQVectorEngine;
 
 } // end of AliFlowAnalysisWithMultiparticleCorrelations::~AliFlowAnalysisWithMultiparticleCorrelations()
 
@@ -1999,7 +2003,11 @@ void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimpl
  Double_t dPt = 0., wPt = 1.; // transverse momentum and corresponding pT weight
  Double_t dEta = 0., wEta = 1.; // pseudorapidity and corresponding eta weight
  Double_t wToPowerP = 1.; // weight raised to power p
+ Double_t dCosMultiples[49] = {0.}; // cos(h*dPhi) [fMaxHarmonic*fMaxCorrelator+1]
+ Double_t dSinMultiples[49] = {0.}; // sin(h*dPhi) [fMaxHarmonic*fMaxCorrelator+1]
  Int_t nCounterRPs = 0;
+ if(!fQVectorEngine){fQVectorEngine = new AliFlowQVectorEngine(fMaxHarmonic*fMaxCorrelator,fMaxCorrelator,1);}
+ fQVectorEngine->Reset();
  for(Int_t t=0;t<nTracks;t++) // loop over all tracks
  {
   AliFlowTrackSimple *pTrack = NULL;
@@ -2035,15 +2043,8 @@ void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimpl
    dEta = pTrack->Eta();
    if(fUseWeights[0][2]){wEta = Weight(dEta,"RP","eta");} // corresponding eta weight
 
-   // Calculate Q-vector components:
-   for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
-   {
-    for(Int_t wp=0;wp<fMaxCorrelator+1;wp++) // weight power
-    {
-     if(fUseWeights[0][0]||fUseWeights[0][1]||fUseWeights[0][2]){wToPowerP = pow(wPhi*wPt*wEta,wp);} 
-     fQvector[h][wp] += TComplex(wToPowerP*TMath::Cos(h*dPhi),wToPowerP*TMath::Sin(h*dPhi));
-    } // for(Int_t wp=0;wp<fMaxCorrelator+1;wp++)
-   } // for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
+   // Buffer RP for Q-vector components (they are copied into fQvector after the loop over tracks):
+   fQVectorEngine->Fill(dPhi,wPhi*wPt*wEta);
   } // if(pTrack->InRPSelection()) // fill Q-vector components only with reference particles
 
   // Differential Q-vectors (a.k.a. p-vector and q-vector):
@@ -2072,12 +2073,13 @@ void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimpl
       binNo = fDiffCorrelationsPro[0][0]->FindBin(dEta); // TBI: hardwired [0][0]
      }
    // Calculate p-vector components:
+   AliFlowQVectorEngine::CosSinMultiples(dPhi,fMaxHarmonic*fMaxCorrelator,dCosMultiples,dSinMultiples);
    for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
    {
     for(Int_t wp=0;wp<fMaxCorrelator+1;wp++) // weight power
     {
      if(fUseWeights[1][0]||fUseWeights[1][1]||fUseWeights[1][2]){wToPowerP = pow(wPhi*wPt*wEta,wp);} 
-     fpvector[binNo-1][h][wp] += TComplex(wToPowerP*TMath::Cos(h*dPhi),wToPowerP*TMath::Sin(h*dPhi));
+     fpvector[binNo-1][h][wp] += TComplex(wToPowerP*dCosMultiples[h],wToPowerP*dSinMultiples[h]);
 
      if(pTrack->InRPSelection()) 
      {
@@ -2095,7 +2097,7 @@ void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimpl
       if(fUseWeights[1][1]){wPt = Weight(dPt,"POI","pt");} // corresponding pT weight
       if(fUseWeights[1][2]){wEta = Weight(dEta,"POI","eta");} // corresponding eta weight
       if(fUseWeights[0][0]||fUseWeights[0][1]||fUseWeights[0][2]||fUseWeights[1][0]||fUseWeights[1][1]||fUseWeights[1][2]){wToPowerP = pow(wPhi*wPt*wEta,wp);} 
-      fqvector[binNo-1][h][wp] += TComplex(wToPowerP*TMath::Cos(h*dPhi),wToPowerP*TMath::Sin(h*dPhi));
+      fqvector[binNo-1][h][wp] += TComplex(wToPowerP*dCosMultiples[h],wToPowerP*dSinMultiples[h]);
      } // if(pTrack->InRPSelection()) 
 
     } // for(Int_t wp=0;wp<fMaxCorrelator+1;wp++)
@@ -2104,6 +2106,17 @@ void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimpl
 
  } // for(Int_t t=0;t<nTracks;t++) // loop over all tracks
 
+ // Q-vector components from all buffered RPs:
+ fQVectorEngine->Finish();
+ for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
+ {
+  for(Int_t wp=0;wp<fMaxCorrelator+1;wp++) // weight power
+  {
+   fQvector[h][wp] += fQVectorEngine->Q(h,wp);
+  } // for(Int_t wp=0;wp<fMaxCorrelator+1;wp++)
+ } // for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++)
+ fCorrelatorCache.clear(); // Q-vector has changed
+
 } // void AliFlowAnalysisWithMultiparticleCorrelations::FillQvector(AliFlowEventSimple *anEvent)
 
 //=======================================================================================================================
@@ -3862,6 +3875,7 @@ void AliFlowAnalysisWithMultiparticleCorrelations::ResetQvector()
 {
  // Reset all Q-vector components to zero before starting a new event. 
 
+ fCorrelatorCache.clear();
  for(Int_t h=0;h<fMaxHarmonic*fMaxCorrelator+1;h++) 
  {
   for(Int_t wp=0;wp<fMaxCorrelator+1;wp++) // weight powe
@@ -4129,7 +4143,7 @@ TComplex AliFlowAnalysisWithMultiparticleCorrelations::Seven(Int_t n1, Int_t n2,
 
  Int_t harmonic[7] = {n1,n2,n3,n4,n5,n6,n7};
 
- TComplex seven = Recursion(7,harmonic); 
+ TComplex seven = Correlator(7,harmonic); 
 
  return seven;
 
@@ -4143,7 +4157,7 @@ TComplex AliFlowAnalysisWithMultiparticleCorrelations::Eight(Int_t n1, Int_t n2,
 
  Int_t harmonic[8] = {n1,n2,n3,n4,n5,n6,n7,n8};
 
- TComplex eight = Recursion(8,harmonic); 
+ TComplex eight = Correlator(8,harmonic); 
 
  return eight;
 
@@ -5061,6 +5075,69 @@ TComplex AliFlowAnalysisWithMultiparticleCorrelations::Recursion(Int_t n, Int_t*
 
 //=======================================================================================================================
 
+TComplex AliFlowAnalysisWithMultiparticleCorrelations::Correlator(Int_t n, const Int_t *harmonic)
+{
+ // Generic n-particle correlation <exp[i(n1*phi1+...+nn*phin)]> (numerator) for arbitrary order and harmonics.
+
+ // The numerator is a sum over all set partitions of the n particles, each block B contributing
+ // (-1)^{|B|-1}(|B|-1)! Q(sum_{i in B} n_i,|B|). Fixing the block which holds the last particle gives
+ //   N(S) = sum_{B: last in B} (-1)^{|B|-1}(|B|-1)! Q(n_B,|B|) N(S\B),   N({}) = 1.
+ // N(S) depends only on the multiset of harmonics in S, so the sub-correlators are memoized in
+ // fCorrelatorCache (cleared whenever the Q-vector changes) and shared among all requested
+ // harmonic combinations in the event.
+
+ TString sMethodName = "AliFlowAnalysisWithMultiparticleCorrelations::Correlator(Int_t n, const Int_t *harmonic)";
+ if(n<0 || n>fMaxCorrelator){Fatal(sMethodName.Data(),"n = %d is out of range [0,%d]",n,fMaxCorrelator);}
+ if(0==n){return TComplex(1.,0.);}
+
+ // Sort harmonics (insertion sort, n<=8):
+ Int_t sorted[9] = {0};
+ for(Int_t i=0;i<n;i++)
+ {
+  Int_t j = i;
+  while(j>0 && sorted[j-1]>harmonic[i]){sorted[j]=sorted[j-1];j--;}
+  sorted[j] = harmonic[i];
+ }
+
+ // Key: number of harmonics in the lowest 4 bits, then 7 bits per shifted harmonic:
+ Bool_t bCacheable = kTRUE;
+ Long64_t key = n;
+ for(Int_t i=0;i<n;i++)
+ {
+  if(TMath::Abs(sorted[i])>=64){bCacheable = kFALSE;break;}
+  key |= ((Long64_t)(sorted[i]+64))<<(4+7*i);
+ }
+ if(bCacheable)
+ {
+  std::map<Long64_t,TComplex>::const_iterator it = fCorrelatorCache.find(key);
+  if(it != fCorrelatorCache.end()){return it->second;}
+ }
+
+ TComplex c(0.,0.);
+ Int_t rest[9] = {0}; // remaining harmonics, remain sorted
+ Double_t factorial[9] = {1.,1.,2.,6.,24.,120.,720.,5040.,40320.};
+ for(Int_t mask=0;mask<(1<<(n-1));mask++) // other members of the block holding the last particle
+ {
+  Int_t blockSize = 1;
+  Int_t blockHarmonic = sorted[n-1];
+  Int_t nRest = 0;
+  for(Int_t i=0;i<n-1;i++)
+  {
+   if(mask & (1<<i)){blockSize++;blockHarmonic+=sorted[i];}
+   else{rest[nRest++]=sorted[i];}
+  }
+  Double_t dCoefficient = (blockSize%2 ? 1. : -1.)*factorial[blockSize-1];
+  c += dCoefficient*Q(blockHarmonic,blockSize)*Correlator(nRest,rest);
+ } // for(Int_t mask=0;mask<(1<<(n-1));mask++)
+
+ if(bCacheable){fCorrelatorCache[key] = c;}
+
+ return c;
+
+} // TComplex AliFlowAnalysisWithMultiparticleCorrelations::Correlator(Int_t n, const Int_t *harmonic)
+
+//=======================================================================================================================
+
 TComplex AliFlowAnalysisWithMultiparticleCorrelations::OneDiff(Int_t n1)
 {
  // Generic differential one-particle correlation <exp[i(n1*psi1)]>.
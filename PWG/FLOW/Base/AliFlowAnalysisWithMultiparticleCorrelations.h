@@ -15,6 +15,8 @@
 #ifndef ALIFLOWANALYSISWITHMULTIPARTICLECORRELATIONS_H
 #define ALIFLOWANALYSISWITHMULTIPARTICLECORRELATIONS_H
 
+#include <map>
+
 #include "TH1D.h"
 #include "TH2D.h"
 #include "TProfile.h"
@@ -31,6 +33,8 @@
 #include "AliFlowEventSimple.h"
 #include "AliFlowTrackSimple.h"
 
+class AliFlowQVectorEngine;
+
 class AliFlowAnalysisWithMultiparticleCorrelations{
  public:
   AliFlowAnalysisWithMultiparticleCorrelations();
@@ -315,6 +319,8 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   virtual Double_t CastStringToCorrelation(const char *string, Bool_t numerator);
   virtual Double_t Covariance(const char *x, const char *y, TProfile2D *profile2D, Bool_t bUnbiasedEstimator = kFALSE);
   virtual TComplex Recursion(Int_t n, Int_t* harmonic, Int_t mult = 1, Int_t skip = 0); // Credits: Kristjan Gulbrandsen (gulbrand@nbi.dk) 
+  virtual TComplex Correlator(Int_t n, const Int_t *harmonic); // generic n-particle correlator, memoized within an event
+  virtual void ResetCorrelatorCache() {fCorrelatorCache.clear();}
   virtual void CalculateProductsOfCorrelations(AliFlowEventSimple *anEvent, TProfile2D *profile2D);
   static void DumpPointsForDurham(TGraphErrors *ge);
   static void DumpPointsForDurham(TH1D *h);
@@ -385,6 +391,8 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   Bool_t fCalculateDiffQvectors; // to calculate or not to calculate p- and q-vector components, that's a Boolean...  
   TComplex fpvector[100][49][9]; // p-vector components [bin][fMaxHarmonic*fMaxCorrelator+1][fMaxCorrelator+1] = [6*8+1][8+1] TBI hardwired 100
   TComplex fqvector[100][49][9]; // q-vector components [bin][fMaxHarmonic*fMaxCorrelator+1][fMaxCorrelator+1] = [6*8+1][8+1] TBI hardwired 100
+  AliFlowQVectorEngine *fQVectorEngine; //! block-wise accumulator filling fQvector
+  std::map<Long64_t,TComplex> fCorrelatorCache; //! sub-correlators keyed by their sorted harmonics, valid for the current Q-vector
 
   // 3.) Correlations:
   TList *fCorrelationsList;           // list to hold all correlations objects
@@ -43,6 +43,7 @@
 #include "AliFlowEventSimple.h"
 #include "AliFlowTrackSimple.h"
 #include "AliFlowAnalysisWithQCumulants.h"
+#include "AliFlowQVectorEngine.h"
 #include "TArrayD.h"
 #include "TRandom.h"
 #include "TF1.h"
@@ -137,6 +138,7 @@ AliFlowAnalysisWithQCumulants::AliFlowAnalysisWithQCumulants():
  fReQ(NULL),
  fImQ(NULL),
  fSpk(NULL),
+ fQVectorEngine(NULL),
  fIntFlowCorrelationsEBE(NULL),
  fIntFlowEventWeightsForCorrelationsEBE(NULL),
  fIntFlowCorrelationsAllEBE(NULL),
@@ -271,6 +273,7 @@ AliFlowAnalysisWithQCumulants::~AliFlowAnalysisWithQCumulants()
  // destructor
  
  delete fHistList;
+ delete fQVectorEngine;
 
 } // end of AliFlowAnalysisWithQCumulants::~AliFlowAnalysisWithQCumulants()
 
@@ -369,6 +372,10 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
  fReferenceMultiplicityEBE = anEvent->GetReferenceMultiplicity(); // reference multiplicity for current event
  //Printf("Reference multiplicity (QC): %.1f",fReferenceMultiplicityEBE);
  Double_t ptEta[2] = {0.,0.}; // 0 = dPt, 1 = dEta
+ Double_t dCosMultiples[5] = {0.}; // cos(m*n*dPhi), m = 0,1,...,4
+ Double_t dSinMultiples[5] = {0.}; // sin(m*n*dPhi), m = 0,1,...,4
+ Double_t dWeightPowers[9] = {0.}; // (wPhi*wPt*wEta*wTrack)^k, k = 0,1,...,8
+ fQVectorEngine->Reset();
   
  // c) Fill the common control histograms and call the method to fill fAvMultiplicity:
  this->FillCommonControlHistograms(anEvent);                                                               
@@ -409,28 +416,15 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     {
      wTrack = aftsTrack->Weight(); 
     }
-    // Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] for this event (m = 1,2,...,12, k = 0,1,...,8):
-    for(Int_t m=0;m<12;m++) // to be improved - hardwired 6 
-    {
-     for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-     {
-      (*fReQ)(m,k)+=pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1)*n*dPhi); 
-      (*fImQ)(m,k)+=pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1)*n*dPhi); 
-     } 
-    }
-    // Calculate S_{p,k} for this event (Remark: final calculation of S_{p,k} follows after the loop over data bellow):
-    for(Int_t p=0;p<8;p++)
-    {
-     for(Int_t k=0;k<9;k++)
-     {     
-      (*fSpk)(p,k)+=pow(wPhi*wPt*wEta*wTrack,k);
-     }
-    } 
+    // Buffer this RP for Re[Q_{m*n,k}], Im[Q_{m*n,k}] and S_{p,k} (Remark: they are copied out after the loop over data bellow):
+    fQVectorEngine->Fill(dPhi,wPhi*wPt*wEta*wTrack);
     // Differential flow:
     if(fCalculateDiffFlow || fCalculate2DDiffFlow)
     {
      ptEta[0] = dPt; 
      ptEta[1] = dEta; 
+     AliFlowQVectorEngine::CosSinMultiples(n*dPhi,4,dCosMultiples,dSinMultiples);
+     AliFlowQVectorEngine::Powers(wPhi*wPt*wEta*wTrack,8,dWeightPowers);
      // Calculate r_{m*n,k} and s_{p,k} (r_{m,k} is 'p-vector' for RPs): 
      for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
      {
@@ -521,6 +515,8 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     }
     ptEta[0] = dPt;
     ptEta[1] = dEta;
+    AliFlowQVectorEngine::CosSinMultiples(n*dPhi,4,dCosMultiples,dSinMultiples);
+    AliFlowQVectorEngine::Powers(wPhi*wPt*wEta*wTrack,8,dWeightPowers);
     // Calculate p_{m*n,k} ('p-vector' for POIs): 
     for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
     {
@@ -549,6 +545,22 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
  } // end of for(Int_t i=0;i<nPrim;i++) 
 
  // e) Calculate the final expressions for S_{p,k} and s_{p,k} (important !!!!):
+ fQVectorEngine->Finish();
+ for(Int_t m=0;m<12;m++)
+ {
+  for(Int_t k=0;k<9;k++)
+  {
+   (*fReQ)(m,k)+=fQVectorEngine->ReQ(m+1,k);
+   (*fImQ)(m,k)+=fQVectorEngine->ImQ(m+1,k);
+  } // end of for(Int_t k=0;k<9;k++)
+ } // end of for(Int_t m=0;m<12;m++)
+ for(Int_t p=0;p<8;p++)
+ {
+  for(Int_t k=0;k<9;k++)
+  {
+   (*fSpk)(p,k)+=fQVectorEngine->SumOfWeightsToPower(k);
+  } // end of for(Int_t k=0;k<9;k++)
+ } // end of for(Int_t p=0;p<8;p++)
  for(Int_t p=0;p<8;p++)
  {
   for(Int_t k=0;k<9;k++)
@@ -1773,6 +1785,9 @@ void AliFlowAnalysisWithQCumulants::BookEverythingForIntegratedFlow()
  fReQ = new TMatrixD(12,9);
  fImQ = new TMatrixD(12,9);
  fSpk = new TMatrixD(8,9);
+ // block-wise accumulator for Q_{m*n,k}, m = 0,1,...,12, k = 0,1,...,8 (m = 0 gives sum_i w_i^k):
+ delete fQVectorEngine;
+ fQVectorEngine = new AliFlowQVectorEngine(12,8,fHarmonic);
  // average correlations <2>, <4>, <6> and <8> for single event (bining is the same as in fIntFlowCorrelationsPro and fIntFlowCorrelationsHist):
  TString intFlowCorrelationsEBEName = "fIntFlowCorrelationsEBE";
  intFlowCorrelationsEBEName += fAnalysisLabel->Data();
@@ -31,6 +31,7 @@ class TDirectoryFile;
 
 class AliFlowEventSimple;
 class AliFlowVector;
+class AliFlowQVectorEngine;
 
 class AliFlowCommonHist;
 class AliFlowCommonHistResults;
@@ -632,6 +633,7 @@ class AliFlowAnalysisWithQCumulants{
   TMatrixD *fReQ; //! fReQ[m][k] = sum_{i=1}^{M} w_{i}^{k} cos(m*phi_{i})
   TMatrixD *fImQ; //! fImQ[m][k] = sum_{i=1}^{M} w_{i}^{k} sin(m*phi_{i})
   TMatrixD *fSpk; //! fSM[p][k] = (sum_{i=1}^{M} w_{i}^{k})^{p+1}
+  AliFlowQVectorEngine *fQVectorEngine; //! block-wise accumulator filling fReQ, fImQ and fSpk
   TH1D *fIntFlowCorrelationsEBE; // 1st bin: <2>, 2nd bin: <4>, 3rd bin: <6>, 4th bin: <8>
   TH1D *fIntFlowEventWeightsForCorrelationsEBE; // 1st bin: eW_<2>, 2nd bin: eW_<4>, 3rd bin: eW_<6>, 4th bin: eW_<8>
   TH1D *fIntFlowCorrelationsAllEBE; // to be improved (add comment)
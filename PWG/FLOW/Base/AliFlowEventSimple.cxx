@@ -82,6 +82,11 @@ AliFlowEventSimple::AliFlowEventSimple():
   fRun(-1),
   fZNCM(0.),
   fZNAM(0.),
+  fTrackView(),
+  fTrackViewCapacity(0),
+  fTrackViewStore(NULL),
+  fTrackViewBits(NULL),
+  fNQVectorCache(0),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(NULL)
 {
@@ -132,6 +137,11 @@ AliFlowEventSimple::AliFlowEventSimple( Int_t n,
   fRun(-1),
   fZNCM(0.),
   fZNAM(0.),
+  fTrackView(),
+  fTrackViewCapacity(0),
+  fTrackViewStore(NULL),
+  fTrackViewBits(NULL),
+  fNQVectorCache(0),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -186,6 +196,11 @@ AliFlowEventSimple::AliFlowEventSimple(const AliFlowEventSimple& anEvent):
   fZNAQ(anEvent.fZNAQ),
   fZNCM(anEvent.fZNCM),
   fZNAM(anEvent.fZNAM),
+  fTrackView(),
+  fTrackViewCapacity(0),
+  fTrackViewStore(NULL),
+  fTrackViewBits(NULL),
+  fNQVectorCache(0),
   fNumberOfPOItypes(anEvent.fNumberOfPOItypes),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -270,6 +285,8 @@ AliFlowEventSimple& AliFlowEventSimple::operator=(const AliFlowEventSimple& anEv
     fVtxPos[i] = anEvent.fVtxPos[i];
   }
   delete [] fShuffledIndexes;
+  fShuffledIndexes=NULL;
+  InvalidateTrackView();
   return *this;
 }
 
@@ -286,6 +303,8 @@ AliFlowEventSimple::~AliFlowEventSimple()
   delete fShuffledIndexes;
   delete fMothersCollection;
   delete [] fNumberOfPOIs;
+  delete [] fTrackViewStore;
+  delete [] fTrackViewBits;
 }
 
 //-----------------------------------------------------------------------
@@ -430,6 +449,7 @@ void AliFlowEventSimple::AddTrack( AliFlowTrackSimple* track )
 void AliFlowEventSimple::TrackAdded()
 {
   //book keeping after a new track has been added
+  InvalidateTrackView();
   fNumberOfTracks++;
   if (fShuffledIndexes)
   {
@@ -449,6 +469,87 @@ AliFlowTrackSimple* AliFlowEventSimple::MakeNewTrack()
    return t;
 }
 
+//-----------------------------------------------------------------------
+const AliFlowEventSimple::TrackView& AliFlowEventSimple::GetTrackView()
+{
+  //contiguous copy of phi, eta, pt, weight and tags of all tracks, so flow
+  //methods can loop over plain arrays instead of the track objects;
+  //built once per event and shared by all methods attached to it,
+  //the arena is only reallocated when an event has more tracks than before
+  if (fTrackView.fN>=0 && fTrackView.fN==fNumberOfTracks) return fTrackView;
+  fNQVectorCache = 0;
+  if (fNumberOfTracks>fTrackViewCapacity)
+  {
+    Int_t capacity = TMath::Max(fNumberOfTracks,2*fTrackViewCapacity);
+    delete [] fTrackViewStore;
+    delete [] fTrackViewBits;
+    fTrackViewStore = new Double_t[4*capacity];
+    fTrackViewBits = new UInt_t[2*capacity];
+    fTrackViewCapacity = capacity;
+  }
+  Double_t* phi = fTrackViewStore;
+  Double_t* eta = fTrackViewStore+fTrackViewCapacity;
+  Double_t* pt = fTrackViewStore+2*fTrackViewCapacity;
+  Double_t* weight = fTrackViewStore+3*fTrackViewCapacity;
+  UInt_t* flowBits = fTrackViewBits;
+  UInt_t* subEventBits = fTrackViewBits+fTrackViewCapacity;
+  for (Int_t i=0; i<fNumberOfTracks; i++)
+  {
+    AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
+    if (!track)
+    {
+      phi[i]=0.; eta[i]=0.; pt[i]=0.; weight[i]=0.;
+      flowBits[i]=0; subEventBits[i]=0;
+      continue;
+    }
+    phi[i] = track->Phi();
+    eta[i] = track->Eta();
+    pt[i] = track->Pt();
+    weight[i] = track->Weight();
+    const TBits* bits = track->GetFlowBits();
+    UInt_t nBits = TMath::Min(bits->GetNbits(),(UInt_t)32);
+    UInt_t tags = 0;
+    for (UInt_t k=0; k<nBits; k++)
+    {
+      if (bits->TestBitNumber(k)) tags |= (1u<<k);
+    }
+    flowBits[i] = tags;
+    subEventBits[i] = (track->InSubevent(0)?1u:0u) | (track->InSubevent(1)?2u:0u);
+  }
+  fTrackView.fPhi = phi;
+  fTrackView.fEta = eta;
+  fTrackView.fPt = pt;
+  fTrackView.fWeight = weight;
+  fTrackView.fFlowBits = flowBits;
+  fTrackView.fSubEventBits = subEventBits;
+  fTrackView.fN = fNumberOfTracks;
+  return fTrackView;
+}
+
+//-----------------------------------------------------------------------
+Int_t AliFlowEventSimple::FindQVectorCache(Int_t n, TList* weightsList, UInt_t flags) const
+{
+  //slot of the Q-vectors already calculated for the current track view
+  //with the same harmonic and weights, -1 if none
+  for (Int_t i=0; i<fNQVectorCache; i++)
+  {
+    if (fQVectorCacheHarmonic[i]==n && fQVectorCacheList[i]==weightsList && fQVectorCacheFlags[i]==flags) return i;
+  }
+  return -1;
+}
+
+//-----------------------------------------------------------------------
+Int_t AliFlowEventSimple::AddQVectorCache(Int_t n, TList* weightsList, UInt_t flags)
+{
+  //slot for new Q-vectors, -1 if the cache is full (not cached then)
+  if (fNQVectorCache>=kQVectorCacheSize) return -1;
+  Int_t i = fNQVectorCache++;
+  fQVectorCacheHarmonic[i] = n;
+  fQVectorCacheList[i] = weightsList;
+  fQVectorCacheFlags[i] = flags;
+  return i;
+}
+
 //-----------------------------------------------------------------------
 AliFlowVector AliFlowEventSimple::GetQ( Int_t n, 
                                         TList *weightsList, 
@@ -457,6 +558,14 @@ AliFlowVector AliFlowEventSimple::GetQ( Int_t n,
                                         Bool_t useEtaWeights )
 {
   // calculate Q-vector in harmonic n without weights (default harmonic n=2)
+
+  // the flow methods attached to the same event usually ask for the same
+  // Q-vectors, they are calculated once per event (per track view)
+  const TrackView& view = GetTrackView();
+  UInt_t cacheFlags = (usePhiWeights?1u:0u) | (usePtWeights?2u:0u) | (useEtaWeights?4u:0u);
+  Int_t cacheSlot = FindQVectorCache(n,weightsList,cacheFlags);
+  if (cacheSlot>=0) return fQVectorCache[2*cacheSlot];
+
   Double_t dQX = 0.;
   Double_t dQY = 0.;
   AliFlowVector vQ;
@@ -513,17 +622,17 @@ AliFlowVector AliFlowEventSimple::GetQ( Int_t n,
   } // end of if(weightsList)
 
   // loop over tracks
-  for(Int_t i=0; i<fNumberOfTracks; i++)
+  for(Int_t i=0; i<view.fN; i++)
   {
     pTrack = (AliFlowTrackSimple*)fTrackCollection->At(i);
     if(pTrack)
     {
-      if(pTrack->InRPSelection())
+      if(view.fFlowBits[i] & (1u<<AliFlowTrackSimple::kRP))
       {
-        dPhi = pTrack->Phi();
-        dPt  = pTrack->Pt();
-        dEta = pTrack->Eta();
-	      dWeight = pTrack->Weight();
+        dPhi = view.fPhi[i];
+        dPt  = view.fPt[i];
+        dEta = view.fEta[i];
+	      dWeight = view.fWeight[i];
 
         // determine Phi weight: (to be improved, I should here only access it + the treatment of gaps in the if statement)
         if(phiWeights && nBinsPhi)
@@ -562,6 +671,9 @@ AliFlowVector AliFlowEventSimple::GetQ( Int_t n,
   vQ.SetPOItype(AliFlowTrackSimple::kRP);
   vQ.SetSubeventNumber(-1);
 
+  cacheSlot = AddQVectorCache(n,weightsList,cacheFlags);
+  if (cacheSlot>=0) fQVectorCache[2*cacheSlot] = vQ;
+
   return vQ;
 
 }
@@ -576,6 +688,18 @@ void AliFlowEventSimple::Get2Qsub( AliFlowVector* Qarray,
 {
 
   // calculate Q-vector in harmonic n without weights (default harmonic n=2)
+
+  // cached per event like in GetQ, bit 3 of the flags marks the subevents
+  const TrackView& view = GetTrackView();
+  UInt_t cacheFlags = 8u | (usePhiWeights?1u:0u) | (usePtWeights?2u:0u) | (useEtaWeights?4u:0u);
+  Int_t cacheSlot = FindQVectorCache(n,weightsList,cacheFlags);
+  if (cacheSlot>=0)
+  {
+    Qarray[0] = fQVectorCache[2*cacheSlot];
+    Qarray[1] = fQVectorCache[2*cacheSlot+1];
+    return;
+  }
+
   Double_t dQX = 0.;
   Double_t dQY = 0.;
 
@@ -641,7 +765,7 @@ void AliFlowEventSimple::Get2Qsub( AliFlowVector* Qarray,
   for (Int_t s=0; s<2; s++)
   {
     // loop over tracks
-    for(Int_t i=0; i<fNumberOfTracks; i++)
+    for(Int_t i=0; i<view.fN; i++)
     {
       pTrack = (AliFlowTrackSimple*)fTrackCollection->At(i);
       if(!pTrack)
@@ -649,12 +773,12 @@ void AliFlowEventSimple::Get2Qsub( AliFlowVector* Qarray,
         cerr << "no particle!!!"<<endl;
         continue;
       }
-      if(pTrack->InRPSelection() && (pTrack->InSubevent(s)))
+      if((view.fFlowBits[i] & (1u<<AliFlowTrackSimple::kRP)) && (view.fSubEventBits[i] & (1u<<s)))
       {
-        dPhi    = pTrack->Phi();
-        dPt     = pTrack->Pt();
-        dEta    = pTrack->Eta();
-        dWeight = pTrack->Weight();
+        dPhi    = view.fPhi[i];
+        dPt     = view.fPt[i];
+        dEta    = view.fEta[i];
+        dWeight = view.fWeight[i];
 
         // determine Phi weight: (to be improved, I should here only access it + the treatment of gaps in the if statement)
         //subevent 0
@@ -710,6 +834,13 @@ void AliFlowEventSimple::Get2Qsub( AliFlowVector* Qarray,
     dQY = 0.;
   }
 
+  cacheSlot = AddQVectorCache(n,weightsList,cacheFlags);
+  if (cacheSlot>=0)
+  {
+    fQVectorCache[2*cacheSlot] = Qarray[0];
+    fQVectorCache[2*cacheSlot+1] = Qarray[1];
+  }
+
 }
 
 
@@ -828,6 +959,11 @@ AliFlowEventSimple::AliFlowEventSimple( TTree* inputTree,
   fRun(-1),
   fZNCM(0.),
   fZNAM(0.),
+  fTrackView(),
+  fTrackViewCapacity(0),
+  fTrackViewStore(NULL),
+  fTrackViewBits(NULL),
+  fNQVectorCache(0),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -886,6 +1022,7 @@ AliFlowEventSimple::AliFlowEventSimple( TTree* inputTree,
 void AliFlowEventSimple::CloneTracks(Int_t n)
 {
   //clone every track n times to add non-flow
+  InvalidateTrackView();
   if (n<=0) return; //no use to clone stuff zero or less times
   Int_t ntracks = fNumberOfTracks;
   fTrackCollection->Expand((n+1)*fNumberOfTracks);
@@ -905,6 +1042,7 @@ void AliFlowEventSimple::CloneTracks(Int_t n)
 void AliFlowEventSimple::ResolutionPt(Double_t res)
 {
   //smear pt of all tracks by gaussian with sigma=res
+  InvalidateTrackView();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -920,6 +1058,7 @@ void AliFlowEventSimple::TagSubeventsInEta( Double_t etaMinA,
                                             Double_t etaMaxB )
 {
   //Flag two subevents in given eta ranges
+  InvalidateTrackView();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -935,6 +1074,7 @@ void AliFlowEventSimple::TagSubeventsInEta( Double_t etaMinA,
 void AliFlowEventSimple::TagSubeventsByCharge()
 {
   //Flag two subevents in given eta ranges
+  InvalidateTrackView();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -950,6 +1090,7 @@ void AliFlowEventSimple::TagSubeventsByCharge()
 void AliFlowEventSimple::AddV1( Double_t v1 )
 {
   //add v2 to all tracks wrt the reaction plane angle
+  InvalidateTrackView();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -967,6 +1108,7 @@ void AliFlowEventSimple::AddV1( Double_t v1 )
 void AliFlowEventSimple::AddV2( Double_t v2 )
 {
   //add v2 to all tracks wrt the reaction plane angle
+  InvalidateTrackView();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -984,6 +1126,7 @@ void AliFlowEventSimple::AddV2( Double_t v2 )
 void AliFlowEventSimple::AddV3( Double_t v3 )
 {
   //add v3 to all tracks wrt the reaction plane angle
+  InvalidateTrackView();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1001,6 +1144,7 @@ void AliFlowEventSimple::AddV3( Double_t v3 )
 void AliFlowEventSimple::AddV4( Double_t v4 )
 {
   //add v4 to all tracks wrt the reaction plane angle
+  InvalidateTrackView();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1018,6 +1162,7 @@ void AliFlowEventSimple::AddV4( Double_t v4 )
 void AliFlowEventSimple::AddV5( Double_t v5 )
 {
   //add v4 to all tracks wrt the reaction plane angle
+  InvalidateTrackView();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1036,6 +1181,7 @@ void AliFlowEventSimple::AddFlow( Double_t v1, Double_t v2, Double_t v3, Double_
                                   Double_t rp1, Double_t rp2, Double_t rp3, Double_t rp4, Double_t rp5 )
 {
   //add flow to all tracks wrt the reaction plane angle, for all harmonic separate angle
+  InvalidateTrackView();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1048,6 +1194,7 @@ void AliFlowEventSimple::AddFlow( Double_t v1, Double_t v2, Double_t v3, Double_
 void AliFlowEventSimple::AddFlow( Double_t v1, Double_t v2, Double_t v3, Double_t v4, Double_t v5 )
 {
   //add flow to all tracks wrt the reaction plane angle
+  InvalidateTrackView();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1060,6 +1207,7 @@ void AliFlowEventSimple::AddFlow( Double_t v1, Double_t v2, Double_t v3, Double_
 void AliFlowEventSimple::AddV2( TF1* ptDepV2 )
 {
   //add v2 to all tracks wrt the reaction plane angle
+  InvalidateTrackView();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1074,6 +1222,7 @@ void AliFlowEventSimple::AddV2( TF1* ptDepV2 )
 void AliFlowEventSimple::AddV2( TF2* ptEtaDepV2 )
 {
   //add v2 to all tracks wrt the reaction plane angle
+  InvalidateTrackView();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1088,6 +1237,7 @@ void AliFlowEventSimple::AddV2( TF2* ptEtaDepV2 )
 void AliFlowEventSimple::TagRP( const AliFlowTrackSimpleCuts* cuts )
 {
   //tag tracks as reference particles (RPs)
+  InvalidateTrackView();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1110,6 +1260,7 @@ void AliFlowEventSimple::TagRP( const AliFlowTrackSimpleCuts* cuts )
 void AliFlowEventSimple::TagPOI( const AliFlowTrackSimpleCuts* cuts, Int_t poiType )
 {
   //tag tracks as particles of interest (POIs)
+  InvalidateTrackView();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1143,6 +1294,7 @@ void AliFlowEventSimple::DefineDeadZone( Double_t etaMin,
 {
   //mark tracks in given eta-phi region as dead
   //by resetting the flow bits
+  InvalidateTrackView();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1165,6 +1317,7 @@ Int_t AliFlowEventSimple::CleanUpDeadTracks()
 {
   //remove tracks that have no flow tags set and cleanup the container
   //returns number of cleaned tracks
+  InvalidateTrackView();
   Int_t ncleaned=0;
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
@@ -1203,6 +1356,7 @@ TF1* AliFlowEventSimple::SimplePtSpectrum()
 void AliFlowEventSimple::ClearFast()
 {
   //clear the counters without deleting allocated objects so they can be reused
+  InvalidateTrackView();
   fReferenceMultiplicity = 0;
   fNumberOfTracks = 0;
   for (Int_t i=0; i<fNumberOfPOItypes; i++)
@@ -1214,4 +1368,5 @@ void AliFlowEventSimple::ClearFast()
   fAfterBurnerPrecision = 0.001;
   fUserModified = kFALSE;
   delete [] fShuffledIndexes; fShuffledIndexes=NULL;
+  if (fMothersCollection) fMothersCollection->Clear(); //the reused tracks are collected again on fill
 }
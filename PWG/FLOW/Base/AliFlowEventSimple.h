@@ -31,6 +31,22 @@ class AliFlowEventSimple: public TObject {
  public:
 
   enum ConstructionMethod {kEmpty,kGenerate};
+  enum { kQVectorCacheSize=8 }; // number of (harmonic, weights) combinations of GetQ/Get2Qsub kept per event
+
+  //contiguous (SoA) view of the tracks for flow methods which loop over
+  //all of them; bit k of fFlowBits is POI type k (0=RP), bit i of
+  //fSubEventBits is subevent i; call InvalidateTrackView() after changing
+  //tracks obtained from GetTrack()
+  struct TrackView {
+    TrackView(): fN(-1), fPhi(NULL), fEta(NULL), fPt(NULL), fWeight(NULL), fFlowBits(NULL), fSubEventBits(NULL) {}
+    Int_t           fN;            // number of tracks, -1 if not built
+    const Double_t* fPhi;          // [fN] phi
+    const Double_t* fEta;          // [fN] eta
+    const Double_t* fPt;           // [fN] pt
+    const Double_t* fWeight;       // [fN] track weight
+    const UInt_t*   fFlowBits;     // [fN] RP/POI tags
+    const UInt_t*   fSubEventBits; // [fN] subevent tags
+  };
 
   AliFlowEventSimple();
   AliFlowEventSimple( Int_t nParticles,
@@ -116,6 +132,8 @@ class AliFlowEventSimple: public TObject {
   void AddTrack( AliFlowTrackSimple* track ); 
   void TrackAdded();
   AliFlowTrackSimple* MakeNewTrack();
+  const TrackView& GetTrackView();
+  void InvalidateTrackView() { fTrackView.fN = -1; fNQVectorCache = 0; }
  
   virtual AliFlowVector GetQ(Int_t n=2, TList *weightsList=NULL, Bool_t usePhiWeights=kFALSE, Bool_t usePtWeights=kFALSE, Bool_t useEtaWeights=kFALSE);
   virtual void Get2Qsub(AliFlowVector* Qarray, Int_t n=2, TList *weightsList=NULL, Bool_t usePhiWeights=kFALSE, Bool_t usePtWeights=kFALSE, Bool_t useEtaWeights=kFALSE);
@@ -140,6 +158,9 @@ class AliFlowEventSimple: public TObject {
   Double_t GetZNAEnergy() const {return fZNAM;};
 
  protected:
+  Int_t FindQVectorCache(Int_t n, TList* weightsList, UInt_t flags) const;
+  Int_t AddQVectorCache(Int_t n, TList* weightsList, UInt_t flags);
+
   virtual void Generate( Int_t nParticles,
                          TF1* ptDist=NULL,
                          Double_t phiMin=0.0,
@@ -182,12 +203,21 @@ class AliFlowEventSimple: public TObject {
   Double_t                fZNCM;                      // total energy from ZNC-C
   Double_t                fZNAM;                      // total energy from ZNC-A
   Double_t                fVtxPos[3];                 // Primary vertex position (x,y,z)
+  TrackView               fTrackView;                 //! SoA view of the tracks, rebuilt when the event changes
+  Int_t                   fTrackViewCapacity;         //! number of tracks the view arena can hold
+  Double_t*               fTrackViewStore;            //! arena for phi, eta, pt and weight of the view, reused across events
+  UInt_t*                 fTrackViewBits;             //! arena for the flow and subevent bits of the view
+  Int_t                   fNQVectorCache;             //! number of Q-vectors of GetQ/Get2Qsub cached for the current view
+  Int_t                   fQVectorCacheHarmonic[kQVectorCacheSize]; //! harmonic of the cached Q-vectors
+  UInt_t                  fQVectorCacheFlags[kQVectorCacheSize];    //! weights flags and GetQ/Get2Qsub of the cached Q-vectors
+  TList*                  fQVectorCacheList[kQVectorCacheSize];     //! weights list of the cached Q-vectors
+  AliFlowVector           fQVectorCache[2*kQVectorCacheSize];       //! cached Q-vectors, the two subevents for Get2Qsub
  
  private:
   Int_t                   fNumberOfPOItypes;    // how many different flow particle types do we have? (RP,POI,POI_2,...)
   Int_t*                  fNumberOfPOIs;          //[fNumberOfPOItypes] number of tracks that have passed the POI selection
 
-  ClassDef(AliFlowEventSimple,6)
+  ClassDef(AliFlowEventSimple,7)
 };
 
 #endif
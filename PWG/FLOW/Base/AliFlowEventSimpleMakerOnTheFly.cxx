@@ -73,7 +73,8 @@ fPi(TMath::Pi()),
 fUniformEfficiency(kTRUE),
 fPtMin(0.5),
 fPtMax(1.0),
-fPtProbability(0.75) 
+fPtProbability(0.75),
+fSamplePhiAnalytically(kFALSE) 
 {
  // Constructor.
   
@@ -173,6 +174,41 @@ Bool_t AliFlowEventSimpleMakerOnTheFly::AcceptPt(AliFlowTrackSimple *pTrack)
 
 //====================================================================================================================
 
+Double_t AliFlowEventSimpleMakerOnTheFly::SamplePhi() const
+{
+ // Sample phi from the current parameters (reaction plane, v1,...,v6) of fPhiDistribution with accept-reject.
+ 
+ // The Fourier-like distribution is bounded by 1+2*sum|v_n| and its average is 1, so this bound is also 
+ // the average number of trials. Unlike TF1::GetRandom() nothing has to be recomputed when the reaction 
+ // plane or v2 are changed, i.e. for each event or for each particle with pt-dependent v2.
+ 
+ Double_t dReactionPlane = fPhiDistribution->GetParameter(0);
+ Double_t dVn[6] = {0.};
+ Double_t dMax = 1.;
+ for(Int_t n=0;n<6;n++)
+ {
+  dVn[n] = fPhiDistribution->GetParameter(n+1);
+  dMax += 2.*TMath::Abs(dVn[n]);
+ }
+ 
+ Double_t dPhi = 0.;
+ Double_t dValue = 0.;
+ do
+ {
+  dPhi = gRandom->Uniform(0.,TMath::TwoPi());
+  dValue = 1.;
+  for(Int_t n=0;n<6;n++)
+  {
+   if(dVn[n] != 0.){dValue += 2.*dVn[n]*TMath::Cos((n+1.)*(dPhi-dReactionPlane));}
+  }
+ } while(gRandom->Uniform(0.,dMax) >= dValue);
+ 
+ return dPhi;
+ 
+} // end of Double_t AliFlowEventSimpleMakerOnTheFly::SamplePhi() const
+
+//====================================================================================================================
+
 AliFlowEventSimple* AliFlowEventSimpleMakerOnTheFly::CreateEventOnTheFly(AliFlowTrackSimpleCuts const *cutsRP, AliFlowTrackSimpleCuts const *cutsPOI)
 {
  // Method to create event 'on the fly'.
@@ -214,7 +250,7 @@ AliFlowEventSimple* AliFlowEventSimpleMakerOnTheFly::CreateEventOnTheFly(AliFlow
     fPhiDistribution->SetParameter(2,fV2vsPtMax)
    );
   } // end of if(fPtDependentV2)  
-  pTrack->SetPhi(fPhiDistribution->GetRandom());
+  pTrack->SetPhi(fSamplePhiAnalytically ? this->SamplePhi() : fPhiDistribution->GetRandom());
   pTrack->SetEta(gRandom->Uniform(-1.,1.));
   pTrack->SetCharge((gRandom->Integer(2)>0.5 ? 1 : -1));
   // Check uniform acceptance:
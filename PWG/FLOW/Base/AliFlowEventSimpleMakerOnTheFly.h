@@ -90,10 +90,13 @@ class AliFlowEventSimpleMakerOnTheFly{
   Double_t GetPtMax() const {return this->fPtMax;} 
   void SetPtProbability(Double_t ptp) {this->fPtProbability = ptp;}
   Double_t GetPtProbability() const {return this->fPtProbability;} 
+  void SetSamplePhiAnalytically(Bool_t spa) {this->fSamplePhiAnalytically = spa;}
+  Bool_t GetSamplePhiAnalytically() const {return this->fSamplePhiAnalytically;} 
 
  private:
   AliFlowEventSimpleMakerOnTheFly(const AliFlowEventSimpleMakerOnTheFly& anAnalysis); // copy constructor
   AliFlowEventSimpleMakerOnTheFly& operator=(const AliFlowEventSimpleMakerOnTheFly& anAnalysis); // assignment operator
+  Double_t SamplePhi() const; // sample phi from the current parameters of fPhiDistribution with accept-reject
   Int_t fCount; // count number of events 
   Int_t fMinMult; // uniformly sampled multiplicity is >= iMinMult
   Int_t fMaxMult; // uniformly sampled multiplicity is < iMaxMult
@@ -130,8 +133,9 @@ class AliFlowEventSimpleMakerOnTheFly{
   Double_t fPtMin; // non-uniform efficiency vs pT starts at pT = fPtMin
   Double_t fPtMax; // non-uniform efficiency vs pT ends at pT = fPtMax
   Double_t fPtProbability; // particles emitted in fPtMin <= pT < fPtMax are taken with probability fPtProbability 
+  Bool_t fSamplePhiAnalytically; // sample phi with accept-reject from the analytic distribution instead of TF1::GetRandom()
 
-  ClassDef(AliFlowEventSimpleMakerOnTheFly,1) // macro for rootcint
+  ClassDef(AliFlowEventSimpleMakerOnTheFly,2) // macro for rootcint
 };
  
 #endif
@@ -0,0 +1,211 @@
+/*************************************************************************
+* Copyright(c) 1998-2008, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+
+#include "AliFlowQVectorEngine.h"
+#include "TMath.h"
+
+//********************************************************************
+// AliFlowQVectorEngine:                                             *
+// Event-by-event accumulator of Q-vectors for all harmonic          *
+// multiples and powers of weights, shared by the QC, CRC and MPC    *
+// flow analysis classes.                                            *
+//********************************************************************
+
+ClassImp(AliFlowQVectorEngine)
+
+//________________________________________________________________________
+
+AliFlowQVectorEngine::AliFlowQVectorEngine():
+  TObject(),
+  fMaxHarmonic(0),
+  fMaxPower(0),
+  fHarmonic(1),
+  fNTracks(0),
+  fNBuffered(0),
+  fReQ(NULL),
+  fImQ(NULL),
+  fPowBuffer(NULL)
+{
+  // default constructor
+}
+
+//________________________________________________________________________
+
+AliFlowQVectorEngine::AliFlowQVectorEngine(Int_t maxHarmonic, Int_t maxPower, Int_t harmonic):
+  TObject(),
+  fMaxHarmonic(0),
+  fMaxPower(0),
+  fHarmonic(1),
+  fNTracks(0),
+  fNBuffered(0),
+  fReQ(NULL),
+  fImQ(NULL),
+  fPowBuffer(NULL)
+{
+  // constructor: Q_{h*harmonic,p} for h = 0,...,maxHarmonic and p = 0,...,maxPower
+  Configure(maxHarmonic,maxPower,harmonic);
+}
+
+//________________________________________________________________________
+
+AliFlowQVectorEngine::~AliFlowQVectorEngine()
+{
+  // destructor
+  delete [] fReQ;
+  delete [] fImQ;
+  delete [] fPowBuffer;
+}
+
+//________________________________________________________________________
+
+void AliFlowQVectorEngine::Configure(Int_t maxHarmonic, Int_t maxPower, Int_t harmonic)
+{
+  // (re)allocate the accumulators and reset them
+  delete [] fReQ;
+  delete [] fImQ;
+  delete [] fPowBuffer;
+  fMaxHarmonic = maxHarmonic<0 ? 0 : maxHarmonic;
+  fMaxPower = maxPower<0 ? 0 : maxPower;
+  fHarmonic = harmonic;
+  Int_t size = (fMaxHarmonic+1)*(fMaxPower+1);
+  fReQ = new Double_t[size];
+  fImQ = new Double_t[size];
+  fPowBuffer = new Double_t[(fMaxPower+1)*kBlockSize];
+  Reset();
+}
+
+//________________________________________________________________________
+
+void AliFlowQVectorEngine::Reset()
+{
+  // zero all accumulators and drop buffered tracks
+  fNTracks = 0;
+  fNBuffered = 0;
+  if(!fReQ){return;}
+  Int_t size = (fMaxHarmonic+1)*(fMaxPower+1);
+  for(Int_t i=0;i<size;i++)
+  {
+   fReQ[i] = 0.;
+   fImQ[i] = 0.;
+  }
+}
+
+//________________________________________________________________________
+
+void AliFlowQVectorEngine::FillN(Int_t n, const Double_t *phi, const Double_t *weight)
+{
+  // add n tracks; weight can be NULL for unit weights
+  Finish();
+  Double_t unit[kBlockSize];
+  if(!weight)
+  {
+   for(Int_t j=0;j<kBlockSize;j++){unit[j]=1.;}
+  }
+  for(Int_t first=0;first<n;first+=kBlockSize)
+  {
+   Int_t nBlock = TMath::Min(n-first,(Int_t)kBlockSize);
+   ProcessBlock(nBlock,phi+first,weight ? weight+first : unit);
+  }
+}
+
+//________________________________________________________________________
+
+void AliFlowQVectorEngine::ProcessBlock(Int_t n, const Double_t *phi, const Double_t *weight)
+{
+  // accumulate one block of at most kBlockSize tracks; all inner loops run over the tracks
+  if(n<=0 || !fReQ){return;} // not configured
+  Double_t c1[kBlockSize], s1[kBlockSize];   // cos(n phi), sin(n phi)
+  Double_t cPrev[kBlockSize], sPrev[kBlockSize]; // cos((h-1) n phi), sin((h-1) n phi)
+  Double_t cCur[kBlockSize], sCur[kBlockSize];   // cos(h n phi), sin(h n phi)
+  for(Int_t j=0;j<n;j++)
+  {
+   c1[j] = TMath::Cos(fHarmonic*phi[j]);
+   s1[j] = TMath::Sin(fHarmonic*phi[j]);
+  }
+
+  // weights to powers, p-th row of fPowBuffer holds w_j^p:
+  for(Int_t j=0;j<n;j++){fPowBuffer[j]=1.;}
+  for(Int_t p=1;p<=fMaxPower;p++)
+  {
+   const Double_t *prev = fPowBuffer+(p-1)*kBlockSize;
+   Double_t *cur = fPowBuffer+p*kBlockSize;
+   for(Int_t j=0;j<n;j++){cur[j]=prev[j]*weight[j];}
+  }
+
+  // Chebyshev recurrence: cos((h+1)x) = 2cos(x)cos(hx)-cos((h-1)x), same for sin:
+  for(Int_t h=0;h<=fMaxHarmonic;h++)
+  {
+   if(h==0)
+   {
+    for(Int_t j=0;j<n;j++){cCur[j]=1.;sCur[j]=0.;}
+   } else if(h==1)
+   {
+    for(Int_t j=0;j<n;j++){cPrev[j]=1.;sPrev[j]=0.;cCur[j]=c1[j];sCur[j]=s1[j];}
+   } else
+   {
+    for(Int_t j=0;j<n;j++)
+    {
+     Double_t c = 2.*c1[j]*cCur[j]-cPrev[j];
+     Double_t s = 2.*c1[j]*sCur[j]-sPrev[j];
+     cPrev[j] = cCur[j];
+     sPrev[j] = sCur[j];
+     cCur[j] = c;
+     sCur[j] = s;
+    }
+   }
+   Double_t *re = fReQ+h*(fMaxPower+1);
+   Double_t *im = fImQ+h*(fMaxPower+1);
+   for(Int_t p=0;p<=fMaxPower;p++)
+   {
+    const Double_t *wp = fPowBuffer+p*kBlockSize;
+    Double_t sumRe = 0., sumIm = 0.;
+    for(Int_t j=0;j<n;j++)
+    {
+     sumRe += wp[j]*cCur[j];
+     sumIm += wp[j]*sCur[j];
+    }
+    re[p] += sumRe;
+    im[p] += sumIm;
+   }
+  }
+  fNTracks += n;
+}
+
+//________________________________________________________________________
+
+void AliFlowQVectorEngine::CosSinMultiples(Double_t x, Int_t kMax, Double_t *cosArr, Double_t *sinArr)
+{
+  // cos(k x) and sin(k x) for k = 0,...,kMax from a single cos/sin evaluation
+  cosArr[0] = 1.;
+  sinArr[0] = 0.;
+  if(kMax<1){return;}
+  Double_t c1 = TMath::Cos(x);
+  cosArr[1] = c1;
+  sinArr[1] = TMath::Sin(x);
+  for(Int_t k=2;k<=kMax;k++)
+  {
+   cosArr[k] = 2.*c1*cosArr[k-1]-cosArr[k-2];
+   sinArr[k] = 2.*c1*sinArr[k-1]-sinArr[k-2];
+  }
+}
+
+//________________________________________________________________________
+
+void AliFlowQVectorEngine::Powers(Double_t w, Int_t pMax, Double_t *powArr)
+{
+  // w^p for p = 0,...,pMax by repeated multiplication
+  powArr[0] = 1.;
+  for(Int_t p=1;p<=pMax;p++){powArr[p]=powArr[p-1]*w;}
+}
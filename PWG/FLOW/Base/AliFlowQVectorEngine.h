@@ -0,0 +1,71 @@
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+* See cxx source for full Copyright notice */
+/* $Id$ */
+
+#ifndef ALIFLOWQVECTORENGINE_H
+#define ALIFLOWQVECTORENGINE_H
+
+#include "TObject.h"
+#include "TComplex.h"
+
+//********************************************************************
+// AliFlowQVectorEngine:                                             *
+// Event-by-event accumulator of Q_{h*n,p} = sum_i w_i^p e^{i h n phi_i}
+// for all harmonic multiples h = 0,...,maxHarmonic and all powers   *
+// of weights p = 0,...,maxPower. Tracks are buffered and processed  *
+// block-wise: cos(n phi) and sin(n phi) are evaluated once per      *
+// track and the higher multiples follow from Chebyshev recurrence,  *
+// so the inner loops run over the tracks of a block and vectorise.  *
+//********************************************************************
+
+class AliFlowQVectorEngine: public TObject {
+ public:
+  enum { kBlockSize = 64 }; // number of tracks processed in one pass
+
+  AliFlowQVectorEngine();
+  AliFlowQVectorEngine(Int_t maxHarmonic, Int_t maxPower, Int_t harmonic=1);
+  virtual ~AliFlowQVectorEngine();
+
+  void Configure(Int_t maxHarmonic, Int_t maxPower, Int_t harmonic=1);
+  void Reset();                                                  // start a new event
+  void Fill(Double_t phi, Double_t weight=1.)                    // buffer one track
+   {fPhiBuffer[fNBuffered]=phi; fWeightBuffer[fNBuffered]=weight; if(++fNBuffered==kBlockSize){ProcessBuffer();}}
+  void FillN(Int_t n, const Double_t *phi, const Double_t *weight=0); // add a batch of tracks
+  void Finish() {if(fNBuffered>0){ProcessBuffer();}}            // process buffered tracks, call before reading
+
+  Int_t GetMaxHarmonic() const {return fMaxHarmonic;}
+  Int_t GetMaxPower() const {return fMaxPower;}
+  Int_t GetHarmonic() const {return fHarmonic;}
+  Int_t GetNumberOfTracks() const {return fNTracks;}
+
+  // Q_{h*n,p}; h = 0 gives the sum of weights to power p
+  Double_t ReQ(Int_t h, Int_t p) const {return fReQ[h*(fMaxPower+1)+p];}
+  Double_t ImQ(Int_t h, Int_t p) const {return fImQ[h*(fMaxPower+1)+p];}
+  TComplex Q(Int_t h, Int_t p) const {return h>=0 ? TComplex(ReQ(h,p),ImQ(h,p)) : TComplex(ReQ(-h,p),-ImQ(-h,p));}
+  Double_t SumOfWeightsToPower(Int_t p) const {return fReQ[p];}
+
+  // per-track helpers: cos(k x), sin(k x) for k = 0,...,kMax and w^p for p = 0,...,pMax
+  static void CosSinMultiples(Double_t x, Int_t kMax, Double_t *cosArr, Double_t *sinArr);
+  static void Powers(Double_t w, Int_t pMax, Double_t *powArr);
+
+ private:
+  AliFlowQVectorEngine(const AliFlowQVectorEngine& other);
+  AliFlowQVectorEngine& operator=(const AliFlowQVectorEngine& other);
+  void ProcessBlock(Int_t n, const Double_t *phi, const Double_t *weight);
+  void ProcessBuffer() {ProcessBlock(fNBuffered,fPhiBuffer,fWeightBuffer); fNBuffered=0;}
+
+  Int_t fMaxHarmonic;                   // highest harmonic multiple h
+  Int_t fMaxPower;                      // highest power of weights p
+  Int_t fHarmonic;                      // base harmonic n
+  Int_t fNTracks;                       // number of tracks accumulated in this event
+  Int_t fNBuffered;                     // number of tracks waiting in the buffer
+  Double_t *fReQ;                       //! [(fMaxHarmonic+1)*(fMaxPower+1)] real parts
+  Double_t *fImQ;                       //! [(fMaxHarmonic+1)*(fMaxPower+1)] imaginary parts
+  Double_t fPhiBuffer[kBlockSize];      //! buffered azimuthal angles
+  Double_t fWeightBuffer[kBlockSize];   //! buffered weights
+  Double_t *fPowBuffer;                 //! [(fMaxPower+1)*kBlockSize] weights to powers for one block
+
+  ClassDef(AliFlowQVectorEngine,1)      // block-wise Q-vector accumulator
+};
+
+#endif
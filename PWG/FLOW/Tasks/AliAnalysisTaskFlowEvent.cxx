@@ -70,6 +70,7 @@
 #include "AliFlowEvent.h"
 #include "AliFlowTrackCuts.h"
 #include "AliFlowEventCuts.h"
+#include "AliFlowEventCache.h"
 #include "AliFlowCommonConstants.h"
 #include "AliAnalysisTaskFlowEvent.h"
 
@@ -137,7 +138,9 @@ AliAnalysisTaskFlowEvent::AliAnalysisTaskFlowEvent() :
   fDifferentialV2(0),
   fFlowEvent(NULL),
   fShuffleTracks(kFALSE),
-  fMyTRandom3(NULL)
+  fMyTRandom3(NULL),
+  fShareRPTracks(kFALSE),
+  fRPCache(NULL)
 {
   // Constructor
   AliDebug(2,"AliAnalysisTaskFlowEvent::AliAnalysisTaskFlowEvent()");
@@ -198,7 +201,9 @@ AliAnalysisTaskFlowEvent::AliAnalysisTaskFlowEvent(const char *name, TString RPt
   fDifferentialV2(0),
   fFlowEvent(NULL),
   fShuffleTracks(kFALSE),
-  fMyTRandom3(NULL)
+  fMyTRandom3(NULL),
+  fShareRPTracks(kFALSE),
+  fRPCache(NULL)
 {
   // Constructor
   AliDebug(2,"AliAnalysisTaskFlowEvent::AliAnalysisTaskFlowEvent(const char *name, Bool_t on, UInt_t iseed)");
@@ -290,6 +295,21 @@ void AliAnalysisTaskFlowEvent::UserCreateOutputObjects()
 
   fFlowEvent = new AliFlowEvent(10000);
 
+  //wagons with the same RP cuts fill the RPs only once per event
+  if (fShareRPTracks)
+  {
+    if (fAnalysisType != "AUTOMATIC" || !fCutsRP)
+      AliWarning("RP sharing needs the AUTOMATIC analysis type, RPs not shared");
+    else if (fCutsRP->GetQA())
+      AliWarning("RP cuts QA is on, RPs not shared");
+    else
+    {
+      UInt_t key = AliFlowEventCache::HashCuts(fCutsRP);
+      fRPCache = AliFlowEventCache::GetCache(key);
+      AliInfo(Form("sharing RPs with the wagons with RP cuts key %u",key));
+    }
+  }
+
   if (fQAon)
   {
     fQAList=new TList();
@@ -336,7 +356,11 @@ void AliAnalysisTaskFlowEvent::UserExec(Option_t *)
     fCutsPOI->SetEvent( InputEvent(), MCEvent() );
 
     //then make the event
-    fFlowEvent->Fill( fCutsRP, fCutsPOI );
+    if (fRPCache)
+      fFlowEvent->Fill( fRPCache->GetRPEvent(InputEvent(),Entry(),fCutsRP),
+                        fRPCache->GetRPInputIndexes(), fCutsRP, fCutsPOI );
+    else
+      fFlowEvent->Fill( fCutsRP, fCutsPOI );
     //fFlowEvent = new AliFlowEvent( fCutsRP, fCutsPOI );
 
     //    if (myESD)
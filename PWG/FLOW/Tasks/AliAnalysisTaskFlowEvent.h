@@ -18,6 +18,7 @@ class AliFlowEventCuts;
 class AliFlowTrackCuts;
 class AliFlowEventSimpleMaker;
 class AliFlowEvent;
+class AliFlowEventCache;
 class TList;
 class TF1;
 class TRandom3;
@@ -74,6 +75,8 @@ class AliAnalysisTaskFlowEvent : public AliAnalysisTaskSE {
   Bool_t        GetQAOn()   const         {return fQAon; }
 
   void          SetShuffleTracks(Bool_t b)  {fShuffleTracks=b;}
+  void          SetShareRPTracks(Bool_t b=kTRUE) {fShareRPTracks=b;} //fill RPs once per event for all wagons with the same RP cuts
+  Bool_t        GetShareRPTracks() const    {return fShareRPTracks;}
 
   // setters for common constants
   void SetNbinsMult( Int_t i ) { fNbinsMult = i; }
@@ -183,8 +186,11 @@ class AliAnalysisTaskFlowEvent : public AliAnalysisTaskSE {
     
   TRandom3* fMyTRandom3;     // TRandom3 generator
   // end afterburner
+
+  Bool_t             fShareRPTracks; // take the RPs from the AliFlowEventCache shared with other wagons
+  AliFlowEventCache* fRPCache;       //! shared RPs for fCutsRP
   
-  ClassDef(AliAnalysisTaskFlowEvent, 1); // example of analysis
+  ClassDef(AliAnalysisTaskFlowEvent, 2); // example of analysis
 };
 
 #endif
@@ -147,6 +147,16 @@ AliFlowBayesianPID::~AliFlowBayesianPID(){
   if(fBBdata) delete fBBdata;
 }
 //________________________________________________________________________
+Double_t AliFlowBayesianPID::EvalResponse(const TF1 *f,Double_t x){
+  // Gaussian+exponential tail response in Nsigmas, the formula of fTPCResponseF and fTOFResponseF
+  // evaluated directly from the function parameters instead of through TFormula for each track and specie
+  const Double_t *par = f->GetParameters();
+  Double_t tailStart = par[1]+par[3]*par[2];
+  if(x < tailStart) return par[0]*TMath::Exp(-(x-par[1])*(x-par[1])/2/par[2]/par[2]);
+  if(x > tailStart) return par[0]*TMath::Exp(-(x-par[1]-par[3]*par[2]*0.5)*par[3]/par[2]);
+  return 0;
+}
+//________________________________________________________________________
 void AliFlowBayesianPID::SetDetResponse(AliESDEvent *esd,Float_t centrality,EStartTimeType_t flagStart,Bool_t){
   // Set the detector responses (including also TPC dE/dx paramterization vs. centrality)
   if(!esd){
@@ -633,7 +643,7 @@ void AliFlowBayesianPID::ComputeWeights(const AliESDtrack *t){
       else if(centr < 70) resolutionTPC *= 0.88;
       else resolutionTPC *= 0.83;
       
-      fWeights[0][iS] = fTPCResponseF->Eval((dedx - dedxExp)/resolutionTPC)/resolutionTPC;
+      fWeights[0][iS] = EvalResponse(fTPCResponseF,(dedx - dedxExp)/resolutionTPC)/resolutionTPC;
     }
     fMaskCurrent[0] = kTRUE;
   }
@@ -674,7 +684,7 @@ void AliFlowBayesianPID::ComputeWeights(const AliESDtrack *t){
       if (TMath::Abs(delta) > 5*expsigma) {
 	fWeights[1][iS] = mismfrac*mismweight;
       } else
-	fWeights[1][iS] = fTOFResponseF->Eval(delta/expsigma)/expsigma + mismfrac*mismweight;
+	fWeights[1][iS] = EvalResponse(fTOFResponseF,delta/expsigma)/expsigma + mismfrac*mismweight;
     }
     fMaskCurrent[1] = kTRUE;
   }
@@ -782,7 +792,7 @@ void AliFlowBayesianPID::ComputeWeights(const AliAODTrack *t,const AliAODEvent *
       else if(centr < 70) resolutionTPC *= 0.88;
       else resolutionTPC *= 0.83;
       
-      fWeights[0][iS] = fTPCResponseF->Eval((dedx - dedxExp)/resolutionTPC)/resolutionTPC;
+      fWeights[0][iS] = EvalResponse(fTPCResponseF,(dedx - dedxExp)/resolutionTPC)/resolutionTPC;
     }
     fMaskCurrent[0] = kTRUE;
   }
@@ -850,7 +860,7 @@ void AliFlowBayesianPID::ComputeWeights(const AliAODTrack *t,const AliAODEvent *
       if (TMath::Abs(delta) > 5*expsigma) {
 	fWeights[1][iS] = mismfrac*mismweight;
       } else
-	fWeights[1][iS] = fTOFResponseF->Eval(delta/expsigma)/expsigma + mismfrac*mismweight;
+	fWeights[1][iS] = EvalResponse(fTOFResponseF,delta/expsigma)/expsigma + mismfrac*mismweight;
     }
     fMaskCurrent[1] = kTRUE;
   }
@@ -877,7 +887,10 @@ void AliFlowBayesianPID::ComputeProb(const AliESDtrack *t,Float_t /*centrObsolet
 
   Float_t centr = fCurrCentrality;
 
-  for(Int_t iS=0;iS<fgkNspecies;iS++) priors[iS] = fghPriors[iS]->GetBinContent(fghPriors[iS]->GetXaxis()->FindBin(centr),fghPriors[iS]->GetYaxis()->FindBin(t->Pt()));
+  // all the prior histos have the same binning
+  Int_t binCentr = fghPriors[0]->GetXaxis()->FindBin(centr);
+  Int_t binPt = fghPriors[0]->GetYaxis()->FindBin(t->Pt());
+  for(Int_t iS=0;iS<fgkNspecies;iS++) priors[iS] = fghPriors[iS]->GetBinContent(binCentr,binPt);
 
 
   if((!fMaskAND[0] || fMaskCurrent[0]) && (!fMaskAND[1] || fMaskCurrent[1])){
@@ -940,7 +953,10 @@ void AliFlowBayesianPID::ComputeProb(const AliAODTrack *t, const AliAODEvent *ao
 
   Float_t centr = fCurrCentrality;
 
-  for(Int_t iS=0;iS<fgkNspecies;iS++) priors[iS] = fghPriors[iS]->GetBinContent(fghPriors[iS]->GetXaxis()->FindBin(centr),fghPriors[iS]->GetYaxis()->FindBin(t->Pt()));
+  // all the prior histos have the same binning
+  Int_t binCentr = fghPriors[0]->GetXaxis()->FindBin(centr);
+  Int_t binPt = fghPriors[0]->GetYaxis()->FindBin(t->Pt());
+  for(Int_t iS=0;iS<fgkNspecies;iS++) priors[iS] = fghPriors[iS]->GetBinContent(binCentr,binPt);
 
 
   if((!fMaskAND[0] || fMaskCurrent[0]) && (!fMaskAND[1] || fMaskCurrent[1])){
@@ -123,6 +123,7 @@ class AliFlowBayesianPID : public AliPIDResponse{
 
  private: 
   void SetPriors();
+  static Double_t EvalResponse(const TF1 *f,Double_t x); // same as f->Eval(x) for fTPCResponseF and fTOFResponseF
 
   static const Int_t fgkNdetectors = 2; // Number of detector used for PID
   static const Int_t fgkNspecies = 9;// 0=el, 1=mu, 2=pi, 3=ka, 4=pr, 5=deuteron, 6=triton, 7=He3 
@@ -20,6 +20,7 @@
   mods:     Redmer A. Bertens (rbertens@cern.ch)
 *****************************************************************/
 
+#include <vector>
 #include <TGrid.h>
 #include "Riostream.h"
 #include "TFile.h"
@@ -29,6 +30,7 @@
 #include "TH2F.h"
 #include "TH3F.h"
 #include "TArrayD.h"
+#include "TArrayI.h"
 #include "TProfile.h"
 #include "AliMCEvent.h"
 #include "AliMCParticle.h"
@@ -872,6 +874,85 @@ void AliFlowEvent::Fill( AliFlowTrackCuts* rpCuts,
   AliFlowTrackCuts::trackParameterType sourceRP = rpCuts->GetParamType();
   AliFlowTrackCuts::trackParameterType sourcePOI = poiCuts->GetParamType();
   AliFlowTrack* pTrack=NULL;
+
+  SetCalibrationForTrackCuts(rpCuts,poiCuts);
+
+  if (sourceRP==sourcePOI)
+  {
+    //loop over tracks
+    Int_t numberOfInputObjects = rpCuts->GetNumberOfInputObjects();
+    for (Int_t i=0; i<numberOfInputObjects; i++)
+    {
+      //get input object (particle)
+      TObject* particle = rpCuts->GetInputObject(i);
+
+      Bool_t rp = rpCuts->IsSelected(particle,i);
+      Bool_t poi = poiCuts->IsSelected(particle,i);
+
+      if (!(rp||poi)) continue;
+
+      //make new AliFlowTrack
+      if (rp)
+      {
+        pTrack = rpCuts->FillFlowTrack(fTrackCollection,fNumberOfTracks);
+        if (!pTrack) continue;
+        pTrack->Tag(0); IncrementNumberOfPOIs(0);
+        if (poi) {pTrack->Tag(1); IncrementNumberOfPOIs(1);}
+        if (pTrack->GetNDaughters()>0) fMothersCollection->Add(pTrack);
+      }
+      else if (poi)
+      {
+        pTrack = poiCuts->FillFlowTrack(fTrackCollection,fNumberOfTracks);
+        if (!pTrack) continue;
+        pTrack->Tag(1); IncrementNumberOfPOIs(1);
+        if (pTrack->GetNDaughters()>0) fMothersCollection->Add(pTrack);
+      }
+      fNumberOfTracks++;
+    }//end of while (i < numberOfTracks)
+  }
+  else if (sourceRP!=sourcePOI)
+  {
+    //here we have two different sources of particles, so we fill
+    //them independently
+    //POI
+    for (Int_t i=0; i<poiCuts->GetNumberOfInputObjects(); i++)
+    {
+      TObject* particle = poiCuts->GetInputObject(i);
+      Bool_t poi = poiCuts->IsSelected(particle,i);
+      if (!poi) continue;
+      pTrack = poiCuts->FillFlowTrack(fTrackCollection,fNumberOfTracks);
+      if (!pTrack) continue;
+      pTrack->Tag(1);
+      IncrementNumberOfPOIs(1);
+      fNumberOfTracks++;
+      if (pTrack->GetNDaughters()>0) fMothersCollection->Add(pTrack);
+    }
+    //RP
+    Int_t numberOfInputObjects = rpCuts->GetNumberOfInputObjects();
+    for (Int_t i=0; i<numberOfInputObjects; i++)
+      {
+      TObject* particle = rpCuts->GetInputObject(i);
+      Bool_t rp = rpCuts->IsSelected(particle,i);
+      if (!rp) continue;
+      pTrack = rpCuts->FillFlowTrack(fTrackCollection,fNumberOfTracks);
+      if (!pTrack) continue;
+      pTrack->Tag(0);
+      IncrementNumberOfPOIs(0);
+      fNumberOfTracks++;
+      if (pTrack->GetNDaughters()>0) fMothersCollection->Add(pTrack);
+    }
+  }
+}
+
+
+//-----------------------------------------------------------------------
+void AliFlowEvent::SetCalibrationForTrackCuts( AliFlowTrackCuts* rpCuts,
+                                               AliFlowTrackCuts* poiCuts )
+{
+  //attach the run dependent calibration needed by the RP and POI sources,
+  //poiCuts can be NULL when only the RPs are filled
+  AliFlowTrackCuts::trackParameterType sourceRP = rpCuts->GetParamType();
+  AliFlowTrackCuts::trackParameterType sourcePOI = (poiCuts)?poiCuts->GetParamType():AliFlowTrackCuts::kUserA; //kUserA: no calibration
  
   //set run
  if(rpCuts->GetRun()) fRun = rpCuts->GetRun();
@@ -945,71 +1026,83 @@ void AliFlowEvent::Fill( AliFlowTrackCuts* rpCuts,
       // probably no-one will choose vzero tracks as poi's ...
       SetVZEROCalibrationForTrackCuts(poiCuts); 
   }
+}
 
-  if (sourceRP==sourcePOI)
+//-----------------------------------------------------------------------
+void AliFlowEvent::FillRPs( AliFlowTrackCuts* rpCuts, TArrayI* inputIndexes )
+{
+  //fill only the RPs, e.g. once per event for AliFlowEventCache;
+  //inputIndexes (if given) gets the input object index of every track
+  ClearFast();
+  if (!rpCuts) return;
+  SetCalibrationForTrackCuts(rpCuts,NULL);
+  Int_t numberOfInputObjects = rpCuts->GetNumberOfInputObjects();
+  if (inputIndexes && inputIndexes->GetSize()<numberOfInputObjects) inputIndexes->Set(numberOfInputObjects);
+  for (Int_t i=0; i<numberOfInputObjects; i++)
   {
-    //loop over tracks
-    Int_t numberOfInputObjects = rpCuts->GetNumberOfInputObjects();
-    for (Int_t i=0; i<numberOfInputObjects; i++)
-    {
-      //get input object (particle)
-      TObject* particle = rpCuts->GetInputObject(i);
+    TObject* particle = rpCuts->GetInputObject(i);
+    if (!rpCuts->IsSelected(particle,i)) continue;
+    AliFlowTrack* pTrack = rpCuts->FillFlowTrack(fTrackCollection,fNumberOfTracks);
+    if (!pTrack) continue;
+    pTrack->Tag(0); IncrementNumberOfPOIs(0);
+    if (inputIndexes) (*inputIndexes)[fNumberOfTracks] = i;
+    if (pTrack->GetNDaughters()>0) fMothersCollection->Add(pTrack);
+    fNumberOfTracks++;
+  }
+}
 
-      Bool_t rp = rpCuts->IsSelected(particle,i);
-      Bool_t poi = poiCuts->IsSelected(particle,i);
+//-----------------------------------------------------------------------
+void AliFlowEvent::Fill( const AliFlowEvent* rpEvent,
+                         const TArrayI* rpInputIndexes,
+                         AliFlowTrackCuts* rpCuts,
+                         AliFlowTrackCuts* poiCuts )
+{
+  //same as Fill(rpCuts,poiCuts) but the RPs are copied from rpEvent, which
+  //was filled by FillRPs() with an equivalent rpCuts: only the POI selection
+  //runs here. With a common source of RPs and POIs rpInputIndexes is used to
+  //tag the RPs which are also POIs, as Fill(rpCuts,poiCuts) does.
+  //The RPs come first in the track collection.
+  ClearFast();
+  if (!rpEvent || !rpCuts || !poiCuts) return;
+  SetCalibrationForTrackCuts(rpCuts,poiCuts);
 
-      if (!(rp||poi)) continue;
+  Int_t numberOfInputObjects = poiCuts->GetNumberOfInputObjects();
+  Bool_t sameSource = (rpCuts->GetParamType()==poiCuts->GetParamType()) && rpInputIndexes;
+  std::vector<Int_t> inputToTrack(sameSource?numberOfInputObjects:0,-1);
 
-      //make new AliFlowTrack
-      if (rp)
-      {
-        pTrack = rpCuts->FillFlowTrack(fTrackCollection,fNumberOfTracks);
-        if (!pTrack) continue;
-        pTrack->Tag(0); IncrementNumberOfPOIs(0);
-        if (poi) {pTrack->Tag(1); IncrementNumberOfPOIs(1);}
-        if (pTrack->GetNDaughters()>0) fMothersCollection->Add(pTrack);
-      }
-      else if (poi)
-      {
-        pTrack = poiCuts->FillFlowTrack(fTrackCollection,fNumberOfTracks);
-        if (!pTrack) continue;
-        pTrack->Tag(1); IncrementNumberOfPOIs(1);
-        if (pTrack->GetNDaughters()>0) fMothersCollection->Add(pTrack);
-      }
-      fNumberOfTracks++;
-    }//end of while (i < numberOfTracks)
+  //RPs
+  for (Int_t i=0; i<rpEvent->fNumberOfTracks; i++)
+  {
+    const AliFlowTrack* rp = static_cast<const AliFlowTrack*>(rpEvent->fTrackCollection->At(i));
+    if (!rp) continue;
+    AliFlowTrack* pTrack = ReuseTrack(fNumberOfTracks);
+    *pTrack = *rp;
+    IncrementNumberOfPOIs(0);
+    if (sameSource)
+    {
+      Int_t input = rpInputIndexes->At(i);
+      if (input>=0 && input<numberOfInputObjects) inputToTrack[input] = fNumberOfTracks;
+    }
+    if (pTrack->GetNDaughters()>0) fMothersCollection->Add(pTrack);
+    fNumberOfTracks++;
   }
-  else if (sourceRP!=sourcePOI)
+
+  //POIs
+  for (Int_t i=0; i<numberOfInputObjects; i++)
   {
-    //here we have two different sources of particles, so we fill
-    //them independently
-    //POI
-    for (Int_t i=0; i<poiCuts->GetNumberOfInputObjects(); i++)
+    TObject* particle = poiCuts->GetInputObject(i);
+    if (!poiCuts->IsSelected(particle,i)) continue;
+    if (sameSource && inputToTrack[i]>=0)
     {
-      TObject* particle = poiCuts->GetInputObject(i);
-      Bool_t poi = poiCuts->IsSelected(particle,i);
-      if (!poi) continue;
-      pTrack = poiCuts->FillFlowTrack(fTrackCollection,fNumberOfTracks);
-      if (!pTrack) continue;
-      pTrack->Tag(1);
+      static_cast<AliFlowTrack*>(fTrackCollection->At(inputToTrack[i]))->Tag(1);
       IncrementNumberOfPOIs(1);
-      fNumberOfTracks++;
-      if (pTrack->GetNDaughters()>0) fMothersCollection->Add(pTrack);
-    }
-    //RP
-    Int_t numberOfInputObjects = rpCuts->GetNumberOfInputObjects();
-    for (Int_t i=0; i<numberOfInputObjects; i++)
-      {
-      TObject* particle = rpCuts->GetInputObject(i);
-      Bool_t rp = rpCuts->IsSelected(particle,i);
-      if (!rp) continue;
-      pTrack = rpCuts->FillFlowTrack(fTrackCollection,fNumberOfTracks);
-      if (!pTrack) continue;
-      pTrack->Tag(0);
-      IncrementNumberOfPOIs(0);
-      fNumberOfTracks++;
-      if (pTrack->GetNDaughters()>0) fMothersCollection->Add(pTrack);
+      continue;
     }
+    AliFlowTrack* pTrack = poiCuts->FillFlowTrack(fTrackCollection,fNumberOfTracks);
+    if (!pTrack) continue;
+    pTrack->Tag(1); IncrementNumberOfPOIs(1);
+    if (pTrack->GetNDaughters()>0) fMothersCollection->Add(pTrack);
+    fNumberOfTracks++;
   }
 }
 
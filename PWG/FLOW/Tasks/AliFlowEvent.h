@@ -26,6 +26,7 @@ class TH1F;
 class TH1;
 class TH2F;
 class TArrayD;
+class TArrayI;
 
 #include "AliFlowEventSimple.h"
 
@@ -76,6 +77,11 @@ public:
   
   void Fill( AliFlowTrackCuts* rpCuts,
              AliFlowTrackCuts* poiCuts );
+  void FillRPs( AliFlowTrackCuts* rpCuts, TArrayI* inputIndexes=NULL );
+  void Fill( const AliFlowEvent* rpEvent,
+             const TArrayI* rpInputIndexes,
+             AliFlowTrackCuts* rpCuts,
+             AliFlowTrackCuts* poiCuts );
 
   void FindDaughters(Bool_t keepDaughtersInRPselection=kFALSE);
 
@@ -99,6 +105,7 @@ public:
 
 protected:
   AliFlowTrack* ReuseTrack( Int_t i);
+  void SetCalibrationForTrackCuts( AliFlowTrackCuts* rpCuts, AliFlowTrackCuts* poiCuts );
 
 private:
   Int_t         fApplyRecentering;      // apply recentering of q-vectors? 2010 is 10h style, 2011 is 11h style
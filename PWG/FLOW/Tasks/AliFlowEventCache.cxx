@@ -0,0 +1,113 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/*****************************************************************
+  AliFlowEventCache: RPs of the current event, filled once and
+  shared by all AliAnalysisTaskFlowEvent wagons with the same RP
+  cut configuration. The first wagon asking for an event fills
+  the RPs, the others copy them (AliFlowEvent::Fill(rpEvent,...))
+  and only run their own POI selection.
+*****************************************************************/
+
+#include <map>
+#include "TBufferFile.h"
+#include "TString.h"
+#include "AliVEvent.h"
+#include "AliFlowTrackCuts.h"
+#include "AliFlowEvent.h"
+#include "AliFlowEventCache.h"
+
+ClassImp(AliFlowEventCache)
+
+//-----------------------------------------------------------------------
+static std::map<UInt_t,AliFlowEventCache*>& FlowEventCaches()
+{
+  //all caches of the job, by RP cut configuration
+  static std::map<UInt_t,AliFlowEventCache*> caches;
+  return caches;
+}
+
+//-----------------------------------------------------------------------
+AliFlowEventCache::AliFlowEventCache():
+  TObject(),
+  fRPEvent(new AliFlowEvent(10000)),
+  fRPInputIndexes(),
+  fEvent(NULL),
+  fEntry(-1),
+  fNFills(0),
+  fNRequests(0)
+{
+  //constructor
+}
+
+//-----------------------------------------------------------------------
+AliFlowEventCache::~AliFlowEventCache()
+{
+  //destructor
+  delete fRPEvent;
+}
+
+//-----------------------------------------------------------------------
+AliFlowEventCache* AliFlowEventCache::GetCache(UInt_t key)
+{
+  //the cache shared by all wagons with RP cut configuration key
+  std::map<UInt_t,AliFlowEventCache*>& caches = FlowEventCaches();
+  std::map<UInt_t,AliFlowEventCache*>::iterator it = caches.find(key);
+  if (it!=caches.end()) return it->second;
+  AliFlowEventCache* cache = new AliFlowEventCache();
+  caches[key] = cache;
+  return cache;
+}
+
+//-----------------------------------------------------------------------
+void AliFlowEventCache::DeleteCaches()
+{
+  //delete all caches
+  std::map<UInt_t,AliFlowEventCache*>& caches = FlowEventCaches();
+  for (std::map<UInt_t,AliFlowEventCache*>::iterator it=caches.begin(); it!=caches.end(); ++it)
+    delete it->second;
+  caches.clear();
+}
+
+//-----------------------------------------------------------------------
+UInt_t AliFlowEventCache::HashCuts(const AliFlowTrackCuts* cuts)
+{
+  //hash of the streamed cut configuration; name and title are ignored
+  //so wagons only differing in the name of their cuts share the cache
+  if (!cuts) return 0;
+  AliFlowTrackCuts* copy = static_cast<AliFlowTrackCuts*>(cuts->Clone());
+  copy->SetName("");
+  copy->SetTitle("");
+  TBufferFile buffer(TBuffer::kWrite);
+  copy->Streamer(buffer);
+  delete copy;
+  return TString::Hash(buffer.Buffer(),buffer.Length());
+}
+
+//-----------------------------------------------------------------------
+const AliFlowEvent* AliFlowEventCache::GetRPEvent(const AliVEvent* event, Long64_t entry, AliFlowTrackCuts* rpCuts)
+{
+  //RPs of the current event, filled with rpCuts on the first request
+  //for this event; rpCuts must have the event attached
+  fNRequests++;
+  if (event!=fEvent || entry!=fEntry)
+  {
+    fRPEvent->FillRPs(rpCuts,&fRPInputIndexes);
+    fEvent = event;
+    fEntry = entry;
+    fNFills++;
+  }
+  return fRPEvent;
+}
@@ -0,0 +1,49 @@
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+* See cxx source for full Copyright notice */
+/* $Id$ */
+
+/*****************************************************************
+  AliFlowEventCache: RPs of the current event, filled once and
+  shared by all AliAnalysisTaskFlowEvent wagons with the same RP
+  cut configuration
+*****************************************************************/
+
+#ifndef ALIFLOWEVENTCACHE_H
+#define ALIFLOWEVENTCACHE_H
+
+#include "TObject.h"
+#include "TArrayI.h"
+
+class AliVEvent;
+class AliFlowEvent;
+class AliFlowTrackCuts;
+
+class AliFlowEventCache: public TObject {
+public:
+  AliFlowEventCache();
+  virtual ~AliFlowEventCache();
+
+  static AliFlowEventCache* GetCache(UInt_t key);
+  static UInt_t HashCuts(const AliFlowTrackCuts* cuts);
+  static void DeleteCaches();
+
+  const AliFlowEvent* GetRPEvent(const AliVEvent* event, Long64_t entry, AliFlowTrackCuts* rpCuts);
+  const TArrayI* GetRPInputIndexes() const {return &fRPInputIndexes;}
+  Long64_t GetNumberOfFills() const {return fNFills;}
+  Long64_t GetNumberOfRequests() const {return fNRequests;}
+
+private:
+  AliFlowEventCache(const AliFlowEventCache& cache);
+  AliFlowEventCache& operator=(const AliFlowEventCache& cache);
+
+  AliFlowEvent*    fRPEvent;           //! RPs of the current event
+  TArrayI          fRPInputIndexes;    //! input object index of every RP
+  const AliVEvent* fEvent;             //! event the RPs were filled from
+  Long64_t         fEntry;             //! entry the RPs were filled from
+  Long64_t         fNFills;            //! number of events filled
+  Long64_t         fNRequests;         //! number of requests from the wagons
+
+  ClassDef(AliFlowEventCache,1)
+};
+
+#endif
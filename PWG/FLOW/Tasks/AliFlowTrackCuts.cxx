@@ -1491,9 +1491,6 @@ Bool_t AliFlowTrackCuts::PassesAODcuts(const AliAODTrack* track, Bool_t passedFi
   if(fCutMinimalTPCdedx) {
     if (dedx < fMinimalTPCdedx) pass=kFALSE;
   }
-  Double_t time[9];
-  track->GetIntegratedTimes(time);
-  
   if(fCutTPCSecbound && track->Pt()>fCutTPCSecboundMinpt) {
     Double_t xyz[3]={-9999.,-9999.,-9999.};
     const double r = 84.; // TPC IROC radius
@@ -1526,6 +1523,9 @@ Bool_t AliFlowTrackCuts::PassesAODcuts(const AliAODTrack* track, Bool_t passedFi
   }
 
   if (fQA) {
+    //the integrated times are only needed for the QA histograms
+    Double_t time[9];
+    track->GetIntegratedTimes(time);
     // changed 04062014 used to be filled before possible PID cut
     Double_t momTPC = track->GetTPCmomentum();
     QAbefore( 0)->Fill(momTPC,GetBeta(track, kTRUE));
@@ -1618,10 +1618,13 @@ Bool_t AliFlowTrackCuts::PassesESDcuts(AliESDtrack* track)
   }
  
   //PID part with pid QA
-  Double_t beta = GetBeta(track);
-  Double_t dedx = Getdedx(track);
+  //beta and dedx are only needed for the QA histograms
+  Double_t beta = 0.;
+  Double_t dedx = 0.;
   if (fQA)
   {
+    beta = GetBeta(track);
+    dedx = Getdedx(track);
     if (pass) QAbefore(0)->Fill(track->GetP(),beta);
     if (pass) QAbefore(1)->Fill(pin->GetP(),dedx);
   }
@@ -2134,8 +2137,8 @@ AliFlowTrack* AliFlowTrackCuts::FillFlowTrackGeneric(TObjArray* trackCollection,
   if (FillFlowTrackGeneric(flowtrack)) return flowtrack;
   else 
   {
-    trackCollection->RemoveAt(trackIndex);
-    delete flowtrack;
+    //keep the object in its slot, it is reused for the next accepted track
+    flowtrack->Clear();
     return NULL;
   }
 }
@@ -2211,8 +2214,8 @@ AliFlowTrack* AliFlowTrackCuts::FillFlowTrackVParticle(TObjArray* trackCollectio
   if (FillFlowTrackVParticle(flowtrack)) return flowtrack;
   else
   {
-    trackCollection->RemoveAt(trackIndex);
-    delete flowtrack;
+    //keep the object in its slot, it is reused for the next accepted track
+    flowtrack->Clear();
     return NULL;
   }
 }
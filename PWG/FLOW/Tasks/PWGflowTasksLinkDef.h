@@ -5,6 +5,7 @@
 #pragma link off all functions;
 
 #pragma link C++ class AliFlowEvent+;
+#pragma link C++ class AliFlowEventCache+;
 #pragma link C++ class AliFlowEventCuts+;
 #pragma link C++ class AliFlowCandidateTrack+;
 #pragma link C++ class AliFlowTrack+;
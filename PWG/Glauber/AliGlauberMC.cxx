@@ -32,6 +32,8 @@
 #include <TFile.h>
 #include <TTree.h>
 #include <TF1.h>
+#include <vector>
+#include <algorithm>
 
 #include "AliGlauberNucleon.h"
 #include "AliGlauberNucleus.h"
@@ -511,20 +513,51 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
   Double_t Nco   = 0;
   Double_t Ncohc = 0; // hard core
 
+  // Nucleons of A ordered in x: for each nucleon of B only the nucleons of A
+  // with |dx| below the largest interaction distance are tested. The pairs
+  // are then taken in the order of A, as in the full A*B loop, so that the
+  // sums and the cross section left in fXSect are the same.
+  std::vector<Double_t> xA(fAN), yA(fAN), sigA(fAN), xSorted(fAN);
+  std::vector<Int_t> order(fAN), matches;
+  matches.reserve(fAN);
+  Double_t sigMaxA = 0;
+  for (Int_t j = 0; j<fAN; j++)
+  {
+    AliGlauberNucleon *nucleonA=(AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j));
+    xA[j] = nucleonA->GetX();
+    yA[j] = nucleonA->GetY();
+    sigA[j] = nucleonA->GetSigNN();
+    sigMaxA = TMath::Max(sigMaxA,sigA[j]);
+  }
+  if (fAN>0)
+    TMath::Sort(fAN,&xA[0],&order[0],kFALSE);
+  for (Int_t j = 0; j<fAN; j++)
+    xSorted[j] = xA[order[j]];
+
   // for each of the A nucleons in nucleus B
   for (Int_t i = 0; i<fBN; i++)
   {
     AliGlauberNucleon *nucleonB=(AliGlauberNucleon*)(fNucleonsB->UncheckedAt(i));
-    for (Int_t j = 0 ; j < fAN ; j++)
+    Double_t xB = nucleonB->GetX();
+    Double_t yB = nucleonB->GetY();
+    Double_t sigB = nucleonB->GetSigNN();
+    Double_t d2max = fDoFluc ? (Double_t)TMath::Max(sigMaxA,sigB)/(TMath::Pi()*10) : d2;
+    Double_t dmax = TMath::Sqrt(d2max)*(1+1e-9);
+    matches.clear();
+    for (Int_t k = std::lower_bound(xSorted.begin(),xSorted.end(),xB-dmax)-xSorted.begin();
+         k<fAN && xSorted[k]<=xB+dmax; k++)
+      matches.push_back(order[k]);
+    std::sort(matches.begin(),matches.end());
+    for (UInt_t k = 0 ; k < matches.size() ; k++)
     {
-      AliGlauberNucleon *nucleonA=(AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j));
-      Double_t dx = nucleonB->GetX()-nucleonA->GetX();
-      Double_t dy = nucleonB->GetY()-nucleonA->GetY();
+      Int_t j = matches[k];
+      Double_t dx = xB-xA[j];
+      Double_t dy = yB-yA[j];
       Double_t dij = dx*dx+dy*dy;
       if (fDoFluc) {
 	//fXSect = nucleonA->GetSigNN();
 	//fXSect = (nucleonA->GetSigNN()+nucleonB->GetSigNN())/2.;
-	fXSect = TMath::Max(nucleonA->GetSigNN(),nucleonB->GetSigNN());
+	fXSect = TMath::Max(sigA[j],sigB);
 	d2 = (Double_t)fXSect/(TMath::Pi()*10); // in fm^2
       }
       if (dij < d2)
@@ -532,12 +565,15 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
 	bNN += dij;
 	++Nco;
         nucleonB->Collide();
-        nucleonA->Collide();
+        ((AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j)))->Collide();
 	if (dij<d2/4)
 	  ++Ncohc;
       }
     }
   }
+  // cross section of the last pair of the full loop
+  if (fDoFluc && fAN>0 && fBN>0)
+    fXSect = TMath::Max(sigA[fAN-1],((AliGlauberNucleon*)(fNucleonsB->UncheckedAt(fBN-1)))->GetSigNN());
 
   if (Nco>0) {
     fNcollw = Ncohc;
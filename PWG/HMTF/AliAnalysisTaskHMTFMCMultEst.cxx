@@ -26,14 +26,14 @@ ClassImp(AliAnalysisTaskHMTFMCMultEst)
 //________________________________________________________________________
 AliAnalysisTaskHMTFMCMultEst::AliAnalysisTaskHMTFMCMultEst()
 : AliAnalysisTaskSE(), fMyOut(0), fClassifiers(0), fObservables(0), fGlobalTrigger(0),
-  fGlobalTriggerClassifiers(0)
+  fUseParticleCache(kTRUE), fParticleCache(0), fGlobalTriggerClassifiers(0)
 {
 }
 
 //________________________________________________________________________
 AliAnalysisTaskHMTFMCMultEst::AliAnalysisTaskHMTFMCMultEst(const char *name)
   : AliAnalysisTaskSE(name), fMyOut(0), fClassifiers(0), fObservables(0), fGlobalTrigger(0),
-    fGlobalTriggerClassifiers(0)
+    fUseParticleCache(kTRUE), fParticleCache(0), fGlobalTriggerClassifiers(0)
 {
   DefineOutput(1, TList::Class());
 }
@@ -129,6 +129,13 @@ void AliAnalysisTaskHMTFMCMultEst::UserCreateOutputObjects()
      //fObservables.push_back(new AliObservableCorrelationsOfClassifiers(fClassifiers.at(i), refClassifierSpherocity));
      fObservables.push_back(new AliObservableCorrelationsOfClassifiers(fClassifiers.at(i), refClassifierSphericity));
   }
+
+  // Share the particles of the event between all classifiers and observables
+  if (fUseParticleCache) {
+    fParticleCache = new AliEventParticleCache();
+    for (Int_t i = 0; i < fClassifiers.size(); i++) fClassifiers[i]->SetParticleCache(fParticleCache);
+    for (Int_t i = 0; i < fObservables.size(); i++) fObservables[i]->SetParticleCache(fParticleCache);
+  }
   AliLog::SetGlobalLogLevel(AliLog::kError);
   PostData(1, fMyOut);
 }
@@ -149,6 +156,7 @@ void AliAnalysisTaskHMTFMCMultEst::UserExec(Option_t *)
      return;
   }
   AliStack  *stack = mcEvent->Stack();
+  if (fParticleCache) fParticleCache->Fill(mcEvent, stack);
 
   // do we have the right trigger?
   if (((fGlobalTrigger == kINEL) && IsInel(mcEvent, stack)) ||
@@ -5,6 +5,7 @@
 
 #include "AliEventClassifierBase.h"
 #include "AliObservableBase.h"
+#include "AliEventParticleCache.h"
 
 class AliAnalysisTaskHMTFMCMultEst : public AliAnalysisTaskSE {
  public:
@@ -18,12 +19,17 @@ class AliAnalysisTaskHMTFMCMultEst : public AliAnalysisTaskSE {
 
   // set the name of the global trigger in the AddTask marcro through this function
   void SetGlobalTrigger(Int_t triggerEnum) {fGlobalTrigger = triggerEnum;};
+  // Read the particles of the event once for all the classifiers and observables (default),
+  // instead of one loop over the stack in each of them. The histograms are the same.
+  void SetUseParticleCache(Bool_t b) {fUseParticleCache = b;};
  private:
   TList *fMyOut;                          // Output list
   std::vector<AliEventClassifierBase*> fClassifiers;
   std::vector<AliObservableBase*> fObservables;
 
   Int_t fGlobalTrigger;
+  Bool_t fUseParticleCache;               // Fill the classifiers and observables from fParticleCache
+  AliEventParticleCache *fParticleCache;  //! Particles of the current event
   enum {kINEL, kINELGT0, kV0AND};
 
   void SetupInelAsGlobalTrigger();
@@ -40,7 +46,7 @@ class AliAnalysisTaskHMTFMCMultEst : public AliAnalysisTaskSE {
   AliAnalysisTaskHMTFMCMultEst(const AliAnalysisTaskHMTFMCMultEst&); // not implemented
   AliAnalysisTaskHMTFMCMultEst& operator=(const AliAnalysisTaskHMTFMCMultEst&); // not implemented
 
-  ClassDef(AliAnalysisTaskHMTFMCMultEst, 1); // example of analysis
+  ClassDef(AliAnalysisTaskHMTFMCMultEst, 2); // example of analysis
 };
 
 #endif
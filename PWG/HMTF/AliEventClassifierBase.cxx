@@ -18,7 +18,8 @@ AliEventClassifierBase::AliEventClassifierBase()
   fExpectedMaxValue(0),
   fClassifierValueIsCached(false),
   fClassifierOutputList(0),
-  fTaskOutputList(0)
+  fTaskOutputList(0),
+  fParticleCache(0)
 {
   
 }
@@ -29,7 +30,8 @@ AliEventClassifierBase::AliEventClassifierBase(const char* name, const char* tit
     fExpectedMaxValue(0),
     fClassifierValueIsCached(false),
     fClassifierOutputList(0),
-    fTaskOutputList(taskOutputList)
+    fTaskOutputList(taskOutputList),
+    fParticleCache(0)
 {
   fClassifierOutputList = new TList();
   fClassifierOutputList->SetName(name);
@@ -7,6 +7,8 @@
 #include "AliMCEvent.h"
 #include "AliStack.h"
 
+#include "AliEventParticleCache.h"
+
 class AliEventClassifierBase : public TNamed {
  public:
   AliEventClassifierBase();
@@ -16,6 +18,8 @@ class AliEventClassifierBase : public TNamed {
   Float_t GetClassifierValue(AliMCEvent *event, AliStack *stack);
   void ResetClassifier() {fClassifierValueIsCached = false;}
   TList* GetClassifierOutputList() {return fClassifierOutputList;}
+  // Particles of the event read once by the task, the classifier loops over the stack without it
+  void SetParticleCache(AliEventParticleCache *cache) {fParticleCache = cache;}
   Int_t GetExpectedMinValue() {return fExpectedMinValue;}
   Int_t GetExpectedMaxValue() {return fExpectedMaxValue;}
 
@@ -28,8 +32,9 @@ class AliEventClassifierBase : public TNamed {
   
   TList *fClassifierOutputList;  // The "folder" in which the hists binned in this classifier a saved
   TList *fTaskOutputList;        // The list for the entire task
+  AliEventParticleCache *fParticleCache;  //! Particles of the current event, not owned, can be null
 
-  ClassDef(AliEventClassifierBase, 1);
+  ClassDef(AliEventClassifierBase, 2);
 };
 
 #endif
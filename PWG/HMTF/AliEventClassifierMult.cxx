@@ -32,8 +32,29 @@ AliEventClassifierMult::AliEventClassifierMult(const char* name, const char* tit
   }
 }
 
+Bool_t AliEventClassifierMult::IsInRegion(Double_t eta) const {
+  // does this track fall into any of the defined regions?
+  Bool_t trackIsInRegion = false;
+  for(Int_t i = 0; i != fRegions.size(); i++) {
+    if(eta >= fRegions[i][0] && eta <=fRegions[i][1]) {
+      trackIsInRegion = true;
+    }
+  }
+  return trackIsInRegion;
+}
+
 void AliEventClassifierMult::CalculateClassifierValue(AliMCEvent *event, AliStack *stack) {
   fClassifierValue = 0.0;
+  if (fParticleCache) {
+    for (Int_t i = 0; i < fParticleCache->GetNParticles(); i++) {
+      if (!fParticleCache->IsPhysicalPrimary(i)) continue;
+      if (fParticleCache->Charge(i) == 0 && fCountCharged) continue;
+      Bool_t trackIsInRegion = IsInRegion(fParticleCache->Eta(i));
+      if (trackIsInRegion && fRegionsAreInclusive) fClassifierValue += 1.0;
+      else if (!trackIsInRegion && !fRegionsAreInclusive) fClassifierValue += 1.0;
+    }
+    return;
+  }
   for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++) {
     AliMCParticle *track = static_cast<AliMCParticle*>(event->GetTrack(iTrack));
     // load track
@@ -51,14 +72,7 @@ void AliEventClassifierMult::CalculateClassifierValue(AliMCEvent *event, AliStac
     // do we count charged or neutral?
     if (track->Charge() == 0 && fCountCharged) continue;
 
-    // does this track fall into any of the defined regions?
-    Double_t eta = track->Eta();
-    Bool_t trackIsInRegion = false;
-    for(Int_t i = 0; i != fRegions.size(); i++) {
-      if(eta >= fRegions[i][0] && eta <=fRegions[i][1]) {
-	trackIsInRegion = true;
-      }
-    }
+    Bool_t trackIsInRegion = IsInRegion(track->Eta());
     // Are we counting tracks inside or outside of the region?
     // increment counter accordingly
     if (trackIsInRegion && fRegionsAreInclusive) fClassifierValue += 1.0;
@@ -21,6 +21,7 @@ class AliEventClassifierMult : public AliEventClassifierBase {
   std::vector< std::vector<Float_t> > fRegions;
   Bool_t fRegionsAreInclusive;
   Bool_t fCountCharged;
+  Bool_t IsInRegion(Double_t eta) const;
   void CalculateClassifierValue(AliMCEvent *event, AliStack *stack);
 
   ClassDef(AliEventClassifierMult, 1);
@@ -33,7 +33,18 @@ void AliEventClassifierSphericity::CalculateClassifierValue(AliMCEvent *event, A
   Float_t s11=0;
   Float_t totalpt=0;
 
-  Int_t ntracks = event->GetNumberOfTracks();
+  Int_t ntracks = fParticleCache ? 0 : event->GetNumberOfTracks();
+  for (Int_t i = 0; fParticleCache && i < fParticleCache->GetNParticles(); i++) {
+    if (!fParticleCache->IsPhysicalPrimary(i))
+      continue;
+    Double_t pt = fParticleCache->Pt(i);
+    Float_t px = pt * TMath::Cos( fParticleCache->Phi(i) );
+    Float_t py = pt * TMath::Sin( fParticleCache->Phi(i) );
+    s00 += (px * px) / pt;
+    s01 += (py * px) / pt;
+    s11 += (py * py) / pt;
+    totalpt += pt;
+  }
   for (Int_t iTrack = 0; iTrack < ntracks; iTrack++) {
     AliMCParticle *track = static_cast<AliMCParticle*>(event->GetTrack(iTrack));
     if (!track)
@@ -17,7 +17,9 @@ ClassImp(AliEventClassifierSpherocity)
 
 AliEventClassifierSpherocity::AliEventClassifierSpherocity(const char* name, const char* title,
 					     TList *taskOutputList)
-  : AliEventClassifierBase(name, title, taskOutputList)
+  : AliEventClassifierBase(name, title, taskOutputList),
+    fExactMinimization(kFALSE),
+    fEventShape()
 {
   fExpectedMinValue = 0;
   fExpectedMaxValue = 1;
@@ -41,6 +43,17 @@ Bool_t AliEventClassifierSpherocity::TrackPassesSelection(AliMCParticle* track,
     return true;
 }
 
+void AliEventClassifierSpherocity::AddTrack(Double_t pt, Double_t phi, Float_t &sumapt,
+					    vector<Float_t> &pxA, vector<Float_t> &pyA) {
+  sumapt += pt;
+  if (fExactMinimization) {
+    fEventShape.AddParticle(pt, phi);
+    return;
+  }
+  pxA.push_back(pt * TMath::Cos(phi));
+  pyA.push_back(pt * TMath::Sin(phi));
+}
+
 void AliEventClassifierSpherocity::CalculateClassifierValue(AliMCEvent *event, AliStack *stack) {
   // This implementation is adapted from PWGLF/SPECTRA/Spherocity/AliTransverseEventShape.cxx
   fClassifierValue = 0.0;
@@ -51,16 +64,31 @@ void AliEventClassifierSpherocity::CalculateClassifierValue(AliMCEvent *event, A
   // Step size in phi unit vector used to find m spherocity
   Float_t phiStepSize = 0.1;
 
-  // Computing total pt
+  // Computing total pt and the transverse momenta of the selected tracks
   Float_t sumapt = 0;
-  Int_t ntracks = event->GetNumberOfTracks();
+  vector<Float_t> pxA;
+  vector<Float_t> pyA;
+  fEventShape.Reset();
+  Int_t ntracks = fParticleCache ? 0 : event->GetNumberOfTracks();
+  for (Int_t i = 0; fParticleCache && i < fParticleCache->GetNParticles(); i++) {
+    // Only the primaries with |eta| < 0.8, as in TrackPassesSelection
+    if (!fParticleCache->IsPhysicalPrimary(i)) continue;
+    if (TMath::Abs(fParticleCache->Eta(i)) > 0.8) continue;
+    AddTrack(fParticleCache->Pt(i), fParticleCache->Phi(i), sumapt, pxA, pyA);
+  }
   for (Int_t iTrack = 0; iTrack < ntracks; iTrack++) {
     AliMCParticle *track = static_cast<AliMCParticle*>(event->GetTrack(iTrack));
     if (!TrackPassesSelection(track, stack, iTrack)) continue;
-    sumapt += track->Pt();
+    AddTrack(track->Pt(), track->Phi(), sumapt, pxA, pyA);
   }
-  
+
+  if (fExactMinimization) {
+    fClassifierValue = fEventShape.GetSpherocity();
+    return;
+  }
+
   // Getting thrust
+  Int_t nselected = pxA.size();
   for(Int_t i = 0; i < 360/(phiStepSize); ++i){
     Float_t numerator = 0;
     Float_t phiparam  = 0;
@@ -69,14 +97,9 @@ void AliEventClassifierSpherocity::CalculateClassifierValue(AliMCEvent *event, A
     phiparam=((TMath::Pi()) * i * phiStepSize) / 180; // parametrization of the angle
     nx = TMath::Cos(phiparam);            // x component of an unitary vector n
     ny = TMath::Sin(phiparam);            // y component of an unitary vector n
-    for(Int_t iTrack = 0; iTrack < ntracks; ++iTrack){
-      AliMCParticle *track = static_cast<AliMCParticle*>(event->GetTrack(iTrack));
-      if (!TrackPassesSelection(track, stack, iTrack)) continue;
-      
-      Float_t pxA = track->Pt() * TMath::Cos(track->Phi());
-      Float_t pyA = track->Pt() * TMath::Sin(track->Phi());
+    for(Int_t iTrack = 0; iTrack < nselected; ++iTrack){
       //product between p projection in XY plane and the unitary vector
-      numerator += TMath::Abs( ny * pxA - nx * pyA );
+      numerator += TMath::Abs( ny * pxA[iTrack] - nx * pyA[iTrack] );
     }
     
     sumRatioSquare = TMath::Power((numerator / sumapt), 2);
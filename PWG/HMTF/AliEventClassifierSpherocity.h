@@ -1,21 +1,32 @@
 #ifndef AliEventClassifierSpherocity_cxx
 #define AliEventClassifierSpherocity_cxx
 
+#include <vector>
+
 #include "AliEventClassifierBase.h"
+#include "AliEventShapeCalculator.h"
 
 class AliEventClassifierSpherocity : public AliEventClassifierBase {
  public:
   AliEventClassifierSpherocity()
-    : AliEventClassifierBase() {}
+    : AliEventClassifierBase(), fExactMinimization(kFALSE), fEventShape() {}
   AliEventClassifierSpherocity(const char* name, const char* title,
 			TList *taskOutputList);
   virtual ~AliEventClassifierSpherocity() {}
 
+  // Exact minimum over the transverse axes instead of the scan in steps of 0.1 degree
+  void SetExactMinimization(Bool_t b) {fExactMinimization = b;}
+
  private:
   Bool_t TrackPassesSelection(AliMCParticle* track, AliStack *stack, Int_t iTrack);
+  void AddTrack(Double_t pt, Double_t phi, Float_t &sumapt,
+		std::vector<Float_t> &pxA, std::vector<Float_t> &pyA);
   void CalculateClassifierValue(AliMCEvent *event, AliStack *stack);
-  
-  ClassDef(AliEventClassifierSpherocity, 1);
+
+  Bool_t fExactMinimization;              // Use the exact minimization of AliEventShapeCalculator
+  AliEventShapeCalculator fEventShape;    //! Selected particles of the event for the exact minimization
+
+  ClassDef(AliEventClassifierSpherocity, 2);
 };
 
 #endif
@@ -0,0 +1,61 @@
+#include <iostream>
+
+#include "AliMCEvent.h"
+#include "AliMCParticle.h"
+#include "AliStack.h"
+#include "AliGenEventHeader.h"
+
+#include "AliEventParticleCache.h"
+#include "AliIsPi0PhysicalPrimary.h"
+
+using namespace std;
+
+ClassImp(AliEventParticleCache)
+
+AliEventParticleCache::AliEventParticleCache()
+  : TObject(),
+    fPt(),
+    fPhi(),
+    fEta(),
+    fY(),
+    fPdgCode(),
+    fCharge(),
+    fIsPhysicalPrimary(),
+    fEventWeight(1)
+{
+}
+
+void AliEventParticleCache::Fill(AliMCEvent *event, AliStack *stack) {
+  fPt.clear();
+  fPhi.clear();
+  fEta.clear();
+  fY.clear();
+  fPdgCode.clear();
+  fCharge.clear();
+  fIsPhysicalPrimary.clear();
+  fEventWeight = event->GenEventHeader()->EventWeight();
+
+  Int_t ntracks = event->GetNumberOfTracks();
+  for (Int_t iTrack = 0; iTrack < ntracks; iTrack++) {
+    AliMCParticle *track = static_cast<AliMCParticle*>(event->GetTrack(iTrack));
+    if (!track) {
+      Printf("ERROR: Could not receive track %d", iTrack);
+      continue;
+    }
+    // discard unphysical particles from some generators
+    if (track->Pt() == 0 || track->E() <= 0)
+      continue;
+    // primaries (Aliroot definition) and the pi0 which would be primaries if they were stable
+    Bool_t isPhysicalPrimary = stack->IsPhysicalPrimary(iTrack);
+    if (!isPhysicalPrimary && !AliIsPi0PhysicalPrimary(iTrack, stack))
+      continue;
+
+    fPt.push_back(track->Pt());
+    fPhi.push_back(track->Phi());
+    fEta.push_back(track->Eta());
+    fY.push_back(track->Y());
+    fPdgCode.push_back(track->PdgCode());
+    fCharge.push_back(track->Charge());
+    fIsPhysicalPrimary.push_back(isPhysicalPrimary);
+  }
+}
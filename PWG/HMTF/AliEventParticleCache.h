@@ -0,0 +1,48 @@
+#ifndef AliEventParticleCache_cxx
+#define AliEventParticleCache_cxx
+
+#include <vector>
+
+#include "TObject.h"
+
+#include "AliMCEvent.h"
+#include "AliStack.h"
+
+// Kinematics of the primary particles of one MC event, read once from the stack and shared by
+// all the classifiers and observables of the event instead of each of them looping over the
+// stack. Only the particles with pt > 0 and E > 0 which are physical primaries (or primary pi0,
+// see AliIsPi0PhysicalPrimary) are kept, in the order of the stack.
+class AliEventParticleCache : public TObject {
+ public:
+  AliEventParticleCache();
+  virtual ~AliEventParticleCache() {}
+
+  void Fill(AliMCEvent *event, AliStack *stack);
+
+  Int_t GetNParticles() const {return fPt.size();}
+  Double_t GetEventWeight() const {return fEventWeight;}
+
+  // Kinematics of the kept particle i
+  Double_t Pt(Int_t i) const {return fPt[i];}
+  Double_t Phi(Int_t i) const {return fPhi[i];}
+  Double_t Eta(Int_t i) const {return fEta[i];}
+  Double_t Y(Int_t i) const {return fY[i];}
+  Int_t PdgCode(Int_t i) const {return fPdgCode[i];}
+  Short_t Charge(Int_t i) const {return fCharge[i];}
+  Bool_t IsPhysicalPrimary(Int_t i) const {return fIsPhysicalPrimary[i];}
+
+ private:
+  // One entry per kept particle
+  std::vector<Double_t> fPt;                //! pt
+  std::vector<Double_t> fPhi;               //! phi
+  std::vector<Double_t> fEta;               //! pseudorapidity
+  std::vector<Double_t> fY;                 //! rapidity
+  std::vector<Int_t> fPdgCode;              //! pdg code
+  std::vector<Short_t> fCharge;             //! charge as given by AliMCParticle
+  std::vector<Bool_t> fIsPhysicalPrimary;   //! physical primary, false for the primary pi0
+  Double_t fEventWeight;                    //! weight of the generator header
+
+  ClassDef(AliEventParticleCache, 1);
+};
+
+#endif
@@ -6,14 +6,19 @@
 class AliObservableBase : public TNamed {
  public:
   AliObservableBase()
-    : TNamed() {}
+    : TNamed(), fParticleCache(0) {}
   AliObservableBase(const char* name, const char* title)
-    : TNamed(name, title) {}
+    : TNamed(name, title), fParticleCache(0) {}
   ~AliObservableBase() {}
 
   virtual void Fill(AliMCEvent *event, AliStack *stack) = 0;
+  // Particles of the event read once by the task, the observable loops over the stack without it
+  void SetParticleCache(AliEventParticleCache *cache) {fParticleCache = cache;}
 
-  ClassDef(AliObservableBase, 1);
+ protected:
+  AliEventParticleCache *fParticleCache;  //! Particles of the current event, not owned, can be null
+
+  ClassDef(AliObservableBase, 2);
 };
 
 #endif
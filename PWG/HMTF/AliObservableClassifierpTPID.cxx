@@ -82,6 +82,14 @@ AliObservableClassifierpTPID::AliObservableClassifierpTPID(AliEventClassifierBas
 void AliObservableClassifierpTPID::Fill(AliMCEvent *event, AliStack *stack) {
   Double_t classifier_value = fclassifier->GetClassifierValue(event, stack);
   Double_t event_weight = event->GenEventHeader()->EventWeight();
+  if (fParticleCache) {
+    // The cache holds the primaries and the primary pi0's
+    for (Int_t i = 0; i < fParticleCache->GetNParticles(); i++) {
+      FillParticle(classifier_value, fParticleCache->Pt(i), fParticleCache->Y(i),
+		   fParticleCache->PdgCode(i), fParticleCache->Charge(i), event_weight);
+    }
+    return;
+  }
 
   for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++) {
     AliMCParticle *track = static_cast<AliMCParticle*>(event->GetTrack(iTrack));
@@ -101,25 +109,29 @@ void AliObservableClassifierpTPID::Fill(AliMCEvent *event, AliStack *stack) {
     }
 
     // Ok, lets fill!
-    Int_t pdgCode = track->PdgCode();
-    if(((TMath::Abs(track->Y()) < 0.5))) {  //y since this is for identified particles. Region is TPC+ITS
-      for (Int_t ipid = 0; ipid < kNPID; ipid++) {
-	if (pdgCode == this->Pid_enum_to_pdg(ipid)){
-	  fhistogram->Fill(classifier_value,
-			   track->Pt(),
-			   ipid,
-			   event_weight);
-	  break;
-	}
-      }
-      // Fill the "allcharged" bin of the 3d histogram. Note that this is still restricted to the y<.5 region
-      if (track->Charge() != 0) {
-      	fhistogram->Fill(classifier_value,
-			 track->Pt(),
-			 this->kALLCHARGED,
+    FillParticle(classifier_value, track->Pt(), track->Y(), track->PdgCode(), track->Charge(), event_weight);
+  }
+}
+
+void AliObservableClassifierpTPID::FillParticle(Double_t classifier_value, Double_t pt, Double_t y,
+						Int_t pdgCode, Short_t charge, Double_t event_weight) {
+  if(((TMath::Abs(y) < 0.5))) {  //y since this is for identified particles. Region is TPC+ITS
+    for (Int_t ipid = 0; ipid < kNPID; ipid++) {
+      if (pdgCode == this->Pid_enum_to_pdg(ipid)){
+	fhistogram->Fill(classifier_value,
+			 pt,
+			 ipid,
 			 event_weight);
+	break;
       }
     }
+    // Fill the "allcharged" bin of the 3d histogram. Note that this is still restricted to the y<.5 region
+    if (charge != 0) {
+      fhistogram->Fill(classifier_value,
+		       pt,
+		       this->kALLCHARGED,
+		       event_weight);
+    }
   }
 }
 
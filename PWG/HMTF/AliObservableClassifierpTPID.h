@@ -35,6 +35,8 @@ class AliObservableClassifierpTPID : public AliObservableBase {
   TH3F *fhistogram;
   AliEventClassifierBase *fclassifier;
   Int_t Pid_enum_to_pdg(Int_t pid_enum);
+  void FillParticle(Double_t classifier_value, Double_t pt, Double_t y,
+		    Int_t pdgCode, Short_t charge, Double_t event_weight);
 
   ClassDef(AliObservableClassifierpTPID, 1);
 };
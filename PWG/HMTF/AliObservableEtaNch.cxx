@@ -47,6 +47,14 @@ AliObservableEtaNch::AliObservableEtaNch(AliEventClassifierBase *classifier)
 void AliObservableEtaNch::Fill(AliMCEvent *event, AliStack *stack) {
   Double_t classifier_value = fclassifier->GetClassifierValue(event, stack);
   Double_t event_weight = event->GenEventHeader()->EventWeight();
+  if (fParticleCache) {
+    for (Int_t i = 0; i < fParticleCache->GetNParticles(); i++) {
+      if (!fParticleCache->IsPhysicalPrimary(i)) continue;
+      if (fParticleCache->Charge(i) == 0) continue;
+      fhistogram->Fill(fParticleCache->Eta(i), classifier_value, event_weight);
+    }
+    return;
+  }
 
   for (Int_t iTrack = 0; iTrack < event->GetNumberOfTracks(); iTrack++) {
     AliMCParticle *track = static_cast<AliMCParticle*>(event->GetTrack(iTrack));
@@ -0,0 +1,232 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include "AliEmcalJetGrid.h"
+
+#include <algorithm>
+
+#include <TMath.h>
+#include <TVector2.h>
+
+#include "AliEmcalJet.h"
+#include "AliJetContainer.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalJetGrid);
+/// \endcond
+
+/**
+ * Default constructor
+ * @param cellSize Size of the cells in eta and (approximately) in phi
+ */
+AliEmcalJetGrid::AliEmcalJetGrid(Double_t cellSize) :
+  fCellSize(cellSize),
+  fEtaMin(0),
+  fPhiCellSize(0),
+  fNEtaCells(0),
+  fNPhiCells(0),
+  fIsBuilt(kFALSE),
+  fJets(),
+  fIndex(),
+  fCell(),
+  fCellStart(),
+  fSorted(),
+  fCandidates()
+{
+}
+
+/**
+ * Remove all jets; the allocated memory is kept for the next event
+ */
+void AliEmcalJetGrid::Reset()
+{
+  fJets.clear();
+  fIndex.clear();
+  fIsBuilt = kFALSE;
+}
+
+/**
+ * Add a jet to the grid. Build() has to be called after the last jet was added.
+ * @param jet Pointer to the jet
+ * @param index Index of the jet in its collection, returned by GetJetIndex()
+ */
+void AliEmcalJetGrid::AddJet(AliEmcalJet* jet, Int_t index)
+{
+  if (!jet) return;
+  fJets.push_back(jet);
+  fIndex.push_back(index);
+  fIsBuilt = kFALSE;
+}
+
+/**
+ * Reset the grid and fill it with the jets of a container
+ * @param cont Jet container
+ * @param acceptedOnly If true only the jets accepted by the container cuts are added
+ */
+void AliEmcalJetGrid::Fill(const AliJetContainer* cont, Bool_t acceptedOnly)
+{
+  Reset();
+  if (!cont) return;
+  for (Int_t i = 0; i < cont->GetNJets(); i++) {
+    AliEmcalJet* jet = acceptedOnly ? cont->GetAcceptJet(i) : cont->GetJet(i);
+    AddJet(jet, i);
+  }
+  Build();
+}
+
+/**
+ * Sort the jets into the cells (counting sort). The eta extent of the grid
+ * follows the jets, in phi the grid always covers the full azimuth.
+ */
+void AliEmcalJetGrid::Build()
+{
+  Int_t n = fJets.size();
+  Double_t cellSize = fCellSize > 0 ? fCellSize : 0.2;
+
+  Double_t etaMin = 0, etaMax = 0;
+  for (Int_t i = 0; i < n; i++) {
+    Double_t eta = fJets[i]->Eta();
+    if (i == 0 || eta < etaMin) etaMin = eta;
+    if (i == 0 || eta > etaMax) etaMax = eta;
+  }
+  fEtaMin = etaMin;
+  fNEtaCells = TMath::FloorNint((etaMax - etaMin) / cellSize) + 1;
+  fNPhiCells = TMath::Max(1, TMath::FloorNint(TMath::TwoPi() / cellSize));
+  fPhiCellSize = TMath::TwoPi() / fNPhiCells;
+
+  Int_t nCells = fNEtaCells * fNPhiCells;
+  fCell.resize(n);
+  fSorted.resize(n);
+  fCellStart.assign(nCells + 1, 0);
+
+  for (Int_t i = 0; i < n; i++) {
+    fCell[i] = EtaCell(fJets[i]->Eta()) * fNPhiCells + PhiCell(fJets[i]->Phi());
+    fCellStart[fCell[i] + 1]++;
+  }
+  for (Int_t c = 0; c < nCells; c++) fCellStart[c + 1] += fCellStart[c];
+
+  // fill in order of addition, so that the jets of a cell keep their collection order
+  std::vector<Int_t> next(fCellStart.begin(), fCellStart.end() - 1);
+  for (Int_t i = 0; i < n; i++) fSorted[next[fCell[i]]++] = i;
+
+  fIsBuilt = kTRUE;
+}
+
+/**
+ * Cell index in eta, clamped to the grid
+ * @param eta Pseudorapidity
+ * @return Cell index in [0, fNEtaCells)
+ */
+Int_t AliEmcalJetGrid::EtaCell(Double_t eta) const
+{
+  Int_t i = TMath::FloorNint((eta - fEtaMin) / (fCellSize > 0 ? fCellSize : 0.2));
+  if (i < 0) return 0;
+  if (i >= fNEtaCells) return fNEtaCells - 1;
+  return i;
+}
+
+/**
+ * Cell index in phi, with periodic boundaries
+ * @param phi Azimuthal angle
+ * @return Cell index in [0, fNPhiCells)
+ */
+Int_t AliEmcalJetGrid::PhiCell(Double_t phi) const
+{
+  Int_t i = TMath::FloorNint(TVector2::Phi_0_2pi(phi) / fPhiCellSize);
+  if (i >= fNPhiCells) i = fNPhiCells - 1;
+  return i;
+}
+
+/**
+ * Collect the jets in the cells overlapping a window of half width maxDist
+ * around (eta, phi). The list is a superset of the jets within maxDist;
+ * the caller still has to check the distance. The entries are returned in the order
+ * the jets were added, so that loops over them behave as loops over the collection.
+ * @param eta Pseudorapidity of the window center
+ * @param phi Azimuthal angle of the window center
+ * @param maxDist Half width of the window
+ * @param entries Output: grid entries of the candidates (see GetJet(), GetJetIndex())
+ * @return Number of candidates
+ */
+Int_t AliEmcalJetGrid::FindCandidates(Double_t eta, Double_t phi, Double_t maxDist, std::vector<Int_t>& entries) const
+{
+  entries.clear();
+  if (!fIsBuilt || fJets.empty()) return 0;
+
+  Double_t cellSize = fCellSize > 0 ? fCellSize : 0.2;
+  Int_t ieta0 = TMath::FloorNint((eta - maxDist - fEtaMin) / cellSize);
+  Int_t ieta1 = TMath::FloorNint((eta + maxDist - fEtaMin) / cellSize);
+  if (ieta1 < 0 || ieta0 >= fNEtaCells) return 0;
+  ieta0 = TMath::Max(ieta0, 0);
+  ieta1 = TMath::Min(ieta1, fNEtaCells - 1);
+
+  phi = TVector2::Phi_0_2pi(phi);
+  Int_t iphi0 = TMath::FloorNint((phi - maxDist) / fPhiCellSize);
+  Int_t iphi1 = TMath::FloorNint((phi + maxDist) / fPhiCellSize);
+  if (iphi1 - iphi0 + 1 >= fNPhiCells) {
+    iphi0 = 0;
+    iphi1 = fNPhiCells - 1;
+  }
+
+  for (Int_t ieta = ieta0; ieta <= ieta1; ieta++) {
+    for (Int_t iphi = iphi0; iphi <= iphi1; iphi++) {
+      Int_t c = ieta * fNPhiCells + ((iphi % fNPhiCells) + fNPhiCells) % fNPhiCells;
+      for (Int_t k = fCellStart[c]; k < fCellStart[c + 1]; k++) entries.push_back(fSorted[k]);
+    }
+  }
+  std::sort(entries.begin(), entries.end());
+  return entries.size();
+}
+
+/**
+ * Find the jet closest to a particle (or another jet), using AliEmcalJet::DeltaR.
+ * Only jets with a distance strictly below maxDist are considered; for equal distances
+ * the jet with the lower collection index wins, as in a plain loop over the collection.
+ * @param part Particle or jet
+ * @param maxDist Maximum distance
+ * @param dist Output: distance of the closest jet
+ * @return Grid entry of the closest jet, -1 if none was found
+ */
+Int_t AliEmcalJetGrid::FindClosest(const AliVParticle* part, Double_t maxDist, Double_t& dist) const
+{
+  std::vector<Int_t>& entries = fCandidates;
+  dist = maxDist;
+  Int_t best = -1;
+  if (!part) return best;
+
+  FindCandidates(part->Eta(), part->Phi(), maxDist, entries);
+  for (UInt_t k = 0; k < entries.size(); k++) {
+    Int_t e = entries[k];
+    Double_t d = fJets[e]->DeltaR(part);
+    if (d >= maxDist) continue;
+    if (best < 0 || d < dist || (d == dist && fIndex[e] < fIndex[best])) {
+      best = e;
+      dist = d;
+    }
+  }
+  return best;
+}
+
+/**
+ * Same as FindClosest(), returning the jet
+ * @param part Particle or jet
+ * @param maxDist Maximum distance
+ * @param dist Output: distance of the closest jet
+ * @return Closest jet, 0 if none was found
+ */
+AliEmcalJet* AliEmcalJetGrid::FindClosestJet(const AliVParticle* part, Double_t maxDist, Double_t& dist) const
+{
+  Int_t e = FindClosest(part, maxDist, dist);
+  return e < 0 ? 0 : fJets[e];
+}
@@ -0,0 +1,76 @@
+#ifndef ALIEMCALJETGRID_H
+#define ALIEMCALJETGRID_H
+
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <vector>
+#include <Rtypes.h>
+
+class AliVParticle;
+class AliEmcalJet;
+class AliJetContainer;
+
+/// \class AliEmcalJetGrid
+/// \brief Spatial index of jets in the (eta, phi) plane
+///
+/// The jets of one collection are sorted into square (eta, phi) cells,
+/// with periodic boundaries in phi. Queries for the closest jet or for all jets
+/// within a \f$\Delta R\f$ window then only visit the cells overlapping the window,
+/// instead of looping over the whole collection. Meant to be filled once per event
+/// and shared by the jet-jet matching tasks (response maker, tagger, ...).
+///
+/// ~~~{.cxx}
+/// fJetGrid.Fill(jets2);
+/// Double_t d = 0;
+/// AliEmcalJet* closest = fJetGrid.FindClosestJet(jet1, maxDist, d);
+/// ~~~
+class AliEmcalJetGrid {
+
+public:
+
+  AliEmcalJetGrid(Double_t cellSize = 0.2);
+  virtual ~AliEmcalJetGrid() {}
+
+  void              SetCellSize(Double_t s)                                    { fCellSize = s                                   ; }
+  Double_t          GetCellSize()                                        const { return fCellSize                                ; }
+
+  void              Reset();
+  void              AddJet(AliEmcalJet* jet, Int_t index);
+  void              Fill(const AliJetContainer* cont, Bool_t acceptedOnly = kTRUE);
+  void              Build();
+
+  Int_t             GetNJets()                                           const { return fJets.size()                             ; }
+  AliEmcalJet      *GetJet(Int_t entry)                                  const { return fJets[entry]                             ; }
+  Int_t             GetJetIndex(Int_t entry)                             const { return fIndex[entry]                            ; }
+
+  Int_t             FindCandidates(Double_t eta, Double_t phi, Double_t maxDist, std::vector<Int_t>& entries) const;
+  Int_t             FindClosest(const AliVParticle* part, Double_t maxDist, Double_t& dist) const;
+  AliEmcalJet      *FindClosestJet(const AliVParticle* part, Double_t maxDist, Double_t& dist) const;
+
+protected:
+  Int_t             EtaCell(Double_t eta)                                const;
+  Int_t             PhiCell(Double_t phi)                                const;
+
+  Double_t                   fCellSize;           ///< requested cell size in eta and phi
+  Double_t                   fEtaMin;             //!<! lower eta edge of the grid
+  Double_t                   fPhiCellSize;        //!<! cell size in phi, 2pi/fNPhiCells
+  Int_t                      fNEtaCells;          //!<! number of cells in eta
+  Int_t                      fNPhiCells;          //!<! number of cells in phi
+  Bool_t                     fIsBuilt;            //!<! whether the cells are up to date
+  std::vector<AliEmcalJet*>  fJets;               //!<! jets in the order they were added
+  std::vector<Int_t>         fIndex;              //!<! index of the jets in their collection
+  std::vector<Int_t>         fCell;               //!<! cell of each jet
+  std::vector<Int_t>         fCellStart;          //!<! first position of each cell in fSorted
+  std::vector<Int_t>         fSorted;             //!<! jet entries ordered by cell
+  mutable std::vector<Int_t> fCandidates;         //!<! work buffer of FindClosest()
+
+private:
+  AliEmcalJetGrid(const AliEmcalJetGrid&);            // not implemented
+  AliEmcalJetGrid& operator=(const AliEmcalJetGrid&); // not implemented
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalJetGrid, 1);
+  /// \endcond
+};
+#endif
@@ -63,7 +63,8 @@ AliJetContainer::AliJetContainer():
   fGeom(0),
   fRunNumber(0),
   fTpcHolePos(0),
-  fTpcHoleWidth(0)
+  fTpcHoleWidth(0),
+  fSnapshot()
 {
   fBaseClassName = "AliEmcalJet";
   SetClassName("AliEmcalJet");
@@ -104,7 +105,8 @@ AliJetContainer::AliJetContainer(const char *name):
   fGeom(0),
   fRunNumber(0),
   fTpcHolePos(0),
-  fTpcHoleWidth(0)
+  fTpcHoleWidth(0),
+  fSnapshot()
 {
   fBaseClassName = "AliEmcalJet";
   SetClassName("AliEmcalJet");
@@ -154,7 +156,10 @@ AliJetContainer::AliJetContainer(EJetType_t jetType, EJetAlgo_t jetAlgo, ERecoSc
   fLocalRho(0),
   fRhoMass(0),
   fGeom(0),
-  fRunNumber(0)
+  fRunNumber(0),
+  fTpcHolePos(0),
+  fTpcHoleWidth(0),
+  fSnapshot()
 {
   fBaseClassName = "AliEmcalJet";
   SetClassName("AliEmcalJet");
@@ -170,6 +175,7 @@ void AliJetContainer::SetArray(const AliVEvent *event)
   // Set jet array
 
   AliEmcalContainer::SetArray(event);
+  InvalidateSnapshot();
 }
 
 /**
@@ -805,6 +811,71 @@ Int_t AliJetContainer::GetNAcceptedJets()
   return accepted().GetEntries();
 }
 
+/**
+ * Columnar copy of the jets of the current event, built on the first call
+ * after NextEvent() (or SetArray()) and reused until the next event.
+ * The cuts are evaluated once per jet when the snapshot is built, hence
+ * rho must be loaded before the first call if the cuts depend on it.
+ * The storage is kept across events.
+ * @return Reference to the snapshot
+ */
+const AliJetContainer::JetSnapshot& AliJetContainer::GetSnapshot()
+{
+  if (fSnapshot.fN >= 0) return fSnapshot;
+
+  Int_t n = GetNEntries();
+  fSnapshot.fPt.resize(n);
+  fSnapshot.fEta.resize(n);
+  fSnapshot.fPhi.resize(n);
+  fSnapshot.fArea.resize(n);
+  fSnapshot.fNEF.resize(n);
+  fSnapshot.fLeadingPt.resize(n);
+  fSnapshot.fRejectionReason.resize(n);
+
+  for (Int_t i = 0; i < n; i++) {
+    AliEmcalJet* jet = GetJet(i);
+    if (!jet) {
+      fSnapshot.fPt[i] = fSnapshot.fEta[i] = fSnapshot.fPhi[i] = 0;
+      fSnapshot.fArea[i] = fSnapshot.fNEF[i] = fSnapshot.fLeadingPt[i] = 0;
+      fSnapshot.fRejectionReason[i] = kNullObject;
+      continue;
+    }
+    fSnapshot.fPt[i] = jet->Pt();
+    fSnapshot.fEta[i] = jet->Eta();
+    fSnapshot.fPhi[i] = jet->Phi();
+    fSnapshot.fArea[i] = jet->Area();
+    fSnapshot.fNEF[i] = jet->NEF();
+    fSnapshot.fLeadingPt[i] = GetLeadingHadronPt(jet);
+    UInt_t rejectionReason = 0;
+    if (!AcceptJet(jet, rejectionReason) && rejectionReason == 0) rejectionReason = kNullObject;
+    fSnapshot.fRejectionReason[i] = rejectionReason;
+  }
+  fSnapshot.fN = n;
+
+  return fSnapshot;
+}
+
+/**
+ * Select jets from the snapshot in a pt window.
+ * @param[out] indexes Positions of the selected jets in the array
+ * @param[in] minPt Minimum jet pt (ignored if negative)
+ * @param[in] maxPt Maximum jet pt (ignored if negative)
+ * @param[in] acceptedOnly If true only jets accepted by the container cuts are selected
+ * @return Number of selected jets
+ */
+Int_t AliJetContainer::SelectFromSnapshot(std::vector<Int_t>& indexes, Double_t minPt, Double_t maxPt, Bool_t acceptedOnly)
+{
+  const JetSnapshot& snap = GetSnapshot();
+  indexes.clear();
+  for (Int_t i = 0; i < snap.fN; i++) {
+    if (acceptedOnly && snap.fRejectionReason[i] != 0) continue;
+    if (minPt >= 0 && snap.fPt[i] < minPt) continue;
+    if (maxPt >= 0 && snap.fPt[i] > maxPt) continue;
+    indexes.push_back(i);
+  }
+  return indexes.size();
+}
+
 /**
  * Get fraction of shared pT between matched jets.
  * Uses ClosestJet() jet pT as baseline: fraction = \Sum_{const,jet1} pT,const,i / pT,jet,closest
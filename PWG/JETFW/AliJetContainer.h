@@ -13,6 +13,7 @@ class AliParticleContainer;
 class AliClusterContainer;
 class AliLocalRhoParameter;
 
+#include <vector>
 #include <TMath.h>
 #include <TLorentzVector.h>
 #include "AliRhoParameter.h"
@@ -36,7 +37,28 @@ typedef EMCALIterableContainer::AliEmcalIterableContainerT<AliEmcalJet, EMCALIte
  */
 class AliJetContainer : public AliParticleContainer {
  public:
- 
+
+  /**
+   * @struct JetSnapshot
+   * @brief Columnar copy of the jets of the current event
+   *
+   * Built once per event by GetSnapshot(), element i describes the jet at position i
+   * of the array. fRejectionReason is the result of AcceptJet(): 0 for accepted jets,
+   * otherwise the rejection bits. Loops which only need the kinematics can run over
+   * these arrays instead of the jet objects and the accept iterators.
+   */
+  struct JetSnapshot {
+    JetSnapshot() : fN(-1), fPt(), fEta(), fPhi(), fArea(), fNEF(), fLeadingPt(), fRejectionReason() {}
+    Int_t                     fN;                    ///< number of entries, -1 if not built for this event
+    std::vector<Double_t>     fPt;                   ///< jet pt
+    std::vector<Double_t>     fEta;                  ///< jet eta
+    std::vector<Double_t>     fPhi;                  ///< jet phi
+    std::vector<Double_t>     fArea;                 ///< jet area
+    std::vector<Double_t>     fNEF;                  ///< neutral energy fraction
+    std::vector<Double_t>     fLeadingPt;            ///< leading hadron pt, see SetLeadingHadronType()
+    std::vector<UInt_t>       fRejectionReason;      ///< 0 if accepted, otherwise the rejection bits
+  };
+
   enum EJetType_t {
     kFullJet,
     kChargedJet,
@@ -152,6 +174,10 @@ class AliJetContainer : public AliParticleContainer {
   Int_t                       GetFlavourCut()                       const    {return fFlavourSelection;}
   Int_t                       GetNJets()                            const    {return GetNEntries();}
   Int_t                       GetNAcceptedJets()                         ;
+  const JetSnapshot&          GetSnapshot()                              ;
+  Int_t                       SelectFromSnapshot(std::vector<Int_t>& indexes, Double_t minPt = -1, Double_t maxPt = -1, Bool_t acceptedOnly = kTRUE);
+  void                        InvalidateSnapshot()                                 { fSnapshot.fN = -1                  ; }
+  void                        NextEvent()                                          { AliParticleContainer::NextEvent(); InvalidateSnapshot(); }
 
   Double_t                    GetLeadingHadronPt(const AliEmcalJet* jet)  const;
   void                        GetLeadingHadronMomentum(TLorentzVector &mom, const AliEmcalJet* jet)  const;
@@ -224,6 +250,7 @@ class AliJetContainer : public AliParticleContainer {
   Int_t                       fRunNumber;            //!<! run number
   Double_t                    fTpcHolePos;           ///   position(in radians) of the malfunctioning TPC sector
   Double_t                    fTpcHoleWidth;         ///   width of the malfunctioning TPC area
+  JetSnapshot                 fSnapshot;             //!<! columnar copy of the jets of the current event
  private:
   AliJetContainer(const AliJetContainer& obj); // copy constructor
   AliJetContainer& operator=(const AliJetContainer& other); // assignment
@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include "AliLog.h"
 
 // analysis framework
@@ -7,6 +11,8 @@
 // ESD stuff
 #include "AliESDEvent.h"
 #include "AliESDInputHandler.h"
+#include "AliESDTrdTrack.h"
+#include "AliESDTrdTracklet.h"
 
 // GTU simulation
 #include "AliTRDgtuParam.h"
@@ -118,65 +124,88 @@ void AliAnalysisTaskTRDgtuSim::Check(Int_t label, Int_t labelRef)
   if (!esdEvent)
     return;
 
-  TList tracksCheck;
-  TList tracksRef;
+  std::vector<AliESDTrdTrack*> tracksCheck;
+  std::vector<AliESDTrdTrack*> tracksRef;
 
   Int_t nTracks = esdEvent->GetNumberOfTrdTracks();
   for (Int_t iTrack = 0; iTrack < nTracks; ++iTrack) {
     AliESDTrdTrack *trk = esdEvent->GetTrdTrack(iTrack);
     if (trk->GetLabel() == label)
-      tracksCheck.Add(trk);
+      tracksCheck.push_back(trk);
     if (trk->GetLabel() == labelRef)
-      tracksRef.Add(trk);
+      tracksRef.push_back(trk);
   }
 
-  TIter iterTrack(&tracksCheck);
-  while (AliESDTrdTrack *trk = (AliESDTrdTrack*) iterTrack()) {
-    TIter iterTrackRef(&tracksRef);
-    Bool_t foundMatch = kFALSE;
-    while (AliESDTrdTrack *trkRef = (AliESDTrdTrack*) iterTrackRef()) {
-      // check for common tracklets
-      Bool_t commonTracklet = kFALSE;
-      Bool_t allEqual = kTRUE;
-      for (Int_t iLayer = 0; iLayer < 6; ++iLayer) {
-	if (trk->GetTracklet(iLayer)) {
-	  if (trk->GetTracklet(iLayer) == trkRef->GetTracklet(iLayer))
-	    commonTracklet = kTRUE;
-	  else
-	    allEqual = kFALSE;
-	}
-	else if (trkRef->GetTracklet(iLayer))
-	  allEqual = kFALSE;
-      }
-      if (commonTracklet) {
-	// tracks with a common tracklet should be identical
-	if (allEqual) {
-	  // identical track composition
-	  fHistStat->Fill(1);
-	  Int_t deltaA = trk->GetA() - trkRef->GetA();
-	  fHistDeltaA->Fill(deltaA);
-	  Int_t deltaB = trk->GetB() - trkRef->GetB();
-	  fHistDeltaB->Fill(deltaB);
-	  Int_t deltaC = trk->GetC() - trkRef->GetC();
-	  fHistDeltaC->Fill(deltaC);
-	}
-	else {
-	  // track with different tracklets
-	  fHistStat->Fill(2);
+  // tracklets of the reference tracks per layer, sorted by tracklet
+  // and then by reference track
+  typedef std::pair<const AliESDTrdTracklet*, Int_t> TrackletRef_t;
+  const Int_t nRef = tracksRef.size();
+  std::vector<TrackletRef_t> trackletsRef[6];
+  for (Int_t iRef = 0; iRef < nRef; ++iRef) {
+    for (Int_t iLayer = 0; iLayer < 6; ++iLayer) {
+      if (const AliESDTrdTracklet *trkl = tracksRef[iRef]->GetTracklet(iLayer))
+	trackletsRef[iLayer].push_back(TrackletRef_t(trkl, iRef));
+    }
+  }
+  for (Int_t iLayer = 0; iLayer < 6; ++iLayer)
+    std::sort(trackletsRef[iLayer].begin(), trackletsRef[iLayer].end());
+
+  std::vector<Bool_t> matchedRef(nRef, kFALSE);
+  for (std::vector<AliESDTrdTrack*>::const_iterator iterTrack = tracksCheck.begin();
+       iterTrack != tracksCheck.end(); ++iterTrack) {
+    AliESDTrdTrack *trk = *iterTrack;
+
+    // the first unmatched reference track with a common tracklet
+    Int_t iMatch = nRef;
+    for (Int_t iLayer = 0; iLayer < 6; ++iLayer) {
+      const AliESDTrdTracklet *trkl = trk->GetTracklet(iLayer);
+      if (!trkl)
+	continue;
+      std::vector<TrackletRef_t>::const_iterator iterRef =
+	std::lower_bound(trackletsRef[iLayer].begin(), trackletsRef[iLayer].end(), TrackletRef_t(trkl, 0));
+      for (; iterRef != trackletsRef[iLayer].end() && iterRef->first == trkl && iterRef->second < iMatch; ++iterRef) {
+	if (!matchedRef[iterRef->second]) {
+	  iMatch = iterRef->second;
+	  break;
 	}
-	tracksRef.Remove(trkRef);
-	foundMatch = kTRUE;
-	break;
       }
     }
-    if (!foundMatch) {
+
+    if (iMatch == nRef) {
       // unmatched sim track
       fHistStat->Fill(3);
+      continue;
+    }
+
+    AliESDTrdTrack *trkRef = tracksRef[iMatch];
+    matchedRef[iMatch] = kTRUE;
+
+    // tracks with a common tracklet should be identical
+    Bool_t allEqual = kTRUE;
+    for (Int_t iLayer = 0; iLayer < 6; ++iLayer) {
+      if (trk->GetTracklet(iLayer) != trkRef->GetTracklet(iLayer))
+	allEqual = kFALSE;
+    }
+    if (allEqual) {
+      // identical track composition
+      fHistStat->Fill(1);
+      Int_t deltaA = trk->GetA() - trkRef->GetA();
+      fHistDeltaA->Fill(deltaA);
+      Int_t deltaB = trk->GetB() - trkRef->GetB();
+      fHistDeltaB->Fill(deltaB);
+      Int_t deltaC = trk->GetC() - trkRef->GetC();
+      fHistDeltaC->Fill(deltaC);
+    }
+    else {
+      // track with different tracklets
+      fHistStat->Fill(2);
     }
   }
-  TIter iterTrackRef(&tracksRef);
-  while (iterTrackRef()) {
-    // unmatched raw track
-    fHistStat->Fill(4);
+
+  for (Int_t iRef = 0; iRef < nRef; ++iRef) {
+    if (!matchedRef[iRef]) {
+      // unmatched raw track
+      fHistStat->Fill(4);
+    }
   }
 }
@@ -0,0 +1,166 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <algorithm>
+#include <utility>
+
+#include <TMath.h>
+
+#include "AliEventShapeCalculator.h"
+
+ClassImp(AliEventShapeCalculator)
+
+AliEventShapeCalculator::AliEventShapeCalculator() :
+  TObject(),
+  fPx(),
+  fPy(),
+  fSumPt(0),
+  fCached(0),
+  fSphericity(-1),
+  fSpherocity(-1),
+  fQ2(-1)
+{
+  // Default constructor
+}
+
+void AliEventShapeCalculator::Reset()
+{
+  // New event: remove the particles and the cached observables
+  fPx.clear();
+  fPy.clear();
+  fSumPt = 0;
+  fCached = 0;
+}
+
+void AliEventShapeCalculator::AddParticle(Double_t pt, Double_t phi)
+{
+  // Add a particle to the event shape
+  fPx.push_back(pt * TMath::Cos(phi));
+  fPy.push_back(pt * TMath::Sin(phi));
+  fSumPt += pt;
+  fCached = 0;
+}
+
+Double_t AliEventShapeCalculator::GetSphericity()
+{
+  // Transverse sphericity, computed at the first call of the event
+  if (!(fCached & kSphericity)) {
+    fSphericity = ComputeSphericity();
+    fCached |= kSphericity;
+  }
+  return fSphericity;
+}
+
+Double_t AliEventShapeCalculator::GetSpherocity()
+{
+  // Transverse spherocity, computed at the first call of the event
+  if (!(fCached & kSpherocity)) {
+    fSpherocity = ComputeSpherocity();
+    fCached |= kSpherocity;
+  }
+  return fSpherocity;
+}
+
+Double_t AliEventShapeCalculator::GetQ2()
+{
+  // Reduced flow vector q2, computed at the first call of the event
+  if (!(fCached & kQ2)) {
+    fQ2 = ComputeQ2();
+    fCached |= kQ2;
+  }
+  return fQ2;
+}
+
+Double_t AliEventShapeCalculator::ComputeSphericity() const
+{
+  // Eigenvalues of the linearized transverse momentum tensor,
+  // same definition as in AliTransverseEventShape
+  if (!(fSumPt > 0)) return -1;
+
+  Double_t s00 = 0, s01 = 0, s11 = 0;
+  for (UInt_t i = 0; i < fPx.size(); i++) {
+    Double_t pt = TMath::Sqrt(fPx[i]*fPx[i] + fPy[i]*fPy[i]);
+    if (pt <= 0) continue;
+    s00 += fPx[i] * fPx[i] / pt;
+    s01 += fPx[i] * fPy[i] / pt;
+    s11 += fPy[i] * fPy[i] / pt;
+  }
+  s00 /= fSumPt;
+  s01 /= fSumPt;
+  s11 /= fSumPt;
+
+  Double_t trace = s00 + s11;
+  if (trace == 0) return 0;
+  Double_t delta = TMath::Sqrt(TMath::Max(trace*trace - 4*(s00*s11 - s01*s01), 0.));
+  return (trace - delta) / trace;
+}
+
+Double_t AliEventShapeCalculator::ComputeSpherocity() const
+{
+  // Exact minimum of (sum |pT x n| / sum pT)^2 * pi^2/4 over the transverse axes n
+  if (!(fSumPt > 0)) return -1;
+
+  // Momenta folded in the upper half plane: the axis n and -n are the same
+  UInt_t n = fPx.size();
+  std::vector<std::pair<Double_t, UInt_t> > axes;
+  axes.reserve(n);
+  std::vector<Double_t> qx(n), qy(n);
+  for (UInt_t i = 0; i < n; i++) {
+    Bool_t flip = fPy[i] < 0 || (fPy[i] == 0 && fPx[i] < 0);
+    qx[i] = flip ? -fPx[i] : fPx[i];
+    qy[i] = flip ? -fPy[i] : fPy[i];
+    if (qx[i] == 0 && qy[i] == 0) continue;
+    axes.push_back(std::make_pair(TMath::ATan2(qy[i], qx[i]), i));
+  }
+  if (axes.empty()) return -1;
+  std::sort(axes.begin(), axes.end());
+
+  Double_t totX = 0, totY = 0;
+  for (UInt_t k = 0; k < axes.size(); k++) {
+    totX += qx[axes[k].second];
+    totY += qy[axes[k].second];
+  }
+
+  // Along the axis n of angle psi the momenta below psi give +|q x n|, the others -|q x n|:
+  // sum |q x n| = (2 L - Q) x n with L the sum of the momenta below psi and Q the total
+  Double_t minSum = -1;
+  Double_t lowX = 0, lowY = 0;
+  for (UInt_t k = 0; k < axes.size(); k++) {
+    UInt_t i = axes[k].second;
+    lowX += qx[i];
+    lowY += qy[i];
+    Double_t q = TMath::Sqrt(qx[i]*qx[i] + qy[i]*qy[i]);
+    Double_t sum = TMath::Abs(((2*lowX - totX) * qy[i] - (2*lowY - totY) * qx[i]) / q);
+    if (minSum < 0 || sum < minSum) minSum = sum;
+  }
+
+  Double_t ratio = minSum / fSumPt;
+  return ratio * ratio * TMath::Pi() * TMath::Pi() / 4.0;
+}
+
+Double_t AliEventShapeCalculator::ComputeQ2() const
+{
+  // |sum exp(2 i phi)| / sqrt(M)
+  UInt_t n = fPx.size();
+  if (n == 0) return -1;
+
+  Double_t q2x = 0, q2y = 0;
+  for (UInt_t i = 0; i < n; i++) {
+    Double_t pt2 = fPx[i]*fPx[i] + fPy[i]*fPy[i];
+    if (pt2 <= 0) continue;
+    q2x += (fPx[i]*fPx[i] - fPy[i]*fPy[i]) / pt2;
+    q2y += 2 * fPx[i] * fPy[i] / pt2;
+  }
+  return TMath::Sqrt((q2x*q2x + q2y*q2y) / n);
+}
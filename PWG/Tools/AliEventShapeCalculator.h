@@ -0,0 +1,57 @@
+#ifndef ALIEVENTSHAPECALCULATOR_H
+#define ALIEVENTSHAPECALCULATOR_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <vector>
+#include <TObject.h>
+
+/**
+ * \class AliEventShapeCalculator
+ * \brief Transverse event shapes of one set of particles, computed once per event.
+ *
+ * The task (or the classifier) fills the particles selected for the event shape
+ * with AddParticle() after Reset(). Each observable is computed at its first
+ * Get call and cached until the next Reset(), so several consumers of the same
+ * particle selection can share one calculator.
+ *
+ * The spherocity is the exact minimum over all the transverse axes. Between two
+ * particle directions the sum of the |p_T x n| is a positive sinusoid of the
+ * axis angle, hence concave, so the minimum is on one of the particle
+ * directions. The axes are sorted in [0,pi) and the sum is updated along them
+ * from the prefix sums of the momenta: O(N log N) instead of the scan of a
+ * fixed grid of axes, which only gives an upper bound of the minimum.
+ */
+class AliEventShapeCalculator : public TObject {
+public:
+  AliEventShapeCalculator();
+  virtual ~AliEventShapeCalculator() {}
+
+  void        Reset();
+  void        AddParticle(Double_t pt, Double_t phi);
+
+  Int_t       GetMultiplicity()            const { return fPx.size() ; }
+  Double_t    GetSumPt()                   const { return fSumPt     ; }
+  Double_t    GetSphericity();
+  Double_t    GetSpherocity();
+  Double_t    GetQ2();
+
+private:
+  enum { kSphericity = BIT(0), kSpherocity = BIT(1), kQ2 = BIT(2) };
+
+  Double_t    ComputeSphericity() const;
+  Double_t    ComputeSpherocity() const;
+  Double_t    ComputeQ2() const;
+
+  std::vector<Double_t> fPx;           //!<! px of the particles
+  std::vector<Double_t> fPy;           //!<! py of the particles
+  Double_t    fSumPt;                  //!<! Scalar sum of the pt
+  UInt_t      fCached;                 //!<! Observables already computed for this event
+  Double_t    fSphericity;             //!<! Transverse (linearized) sphericity, -1 without particles
+  Double_t    fSpherocity;             //!<! Transverse spherocity, -1 without particles
+  Double_t    fQ2;                     //!<! Reduced second order flow vector |Q_2|/sqrt(M), -1 without particles
+
+  ClassDef(AliEventShapeCalculator, 1); // Transverse event shapes of a set of particles
+};
+
+#endif /* ALIEVENTSHAPECALCULATOR_H */
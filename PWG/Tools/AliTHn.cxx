@@ -53,7 +53,13 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT() :
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fXminCache(0),
+  fXmaxCache(0),
+  fFixedBinsCache(0),
+  fStrideCache(0),
+  fBinBuffer(0),
+  fBinBufferSize(0)
 {
   // Constructor
 }
@@ -69,7 +75,13 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT(const Char_t* name, const Char_t*
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fXminCache(0),
+  fXmaxCache(0),
+  fFixedBinsCache(0),
+  fStrideCache(0),
+  fBinBuffer(0),
+  fBinBufferSize(0)
 {
   // Constructor
 
@@ -106,7 +118,13 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT(const AliTHnT &c) :
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fXminCache(0),
+  fXmaxCache(0),
+  fFixedBinsCache(0),
+  fStrideCache(0),
+  fBinBuffer(0),
+  fBinBufferSize(0)
 {
   //
   // AliTHnT copy constructor
@@ -131,10 +149,7 @@ AliTHnT<TemplateArray, TemplateType>::~AliTHnT()
   
   delete[] fValues;
   delete[] fSumw2;
-  delete[] axisCache;
-  delete[] fNbinsCache;
-  delete[] fLastVars;
-  delete[] fLastBins;
+  DeleteCache();
 }
 
 template <class TemplateArray, typename TemplateType>
@@ -191,9 +206,8 @@ AliTHnT<TemplateArray, TemplateType> &AliTHnT<TemplateArray, TemplateType>::oper
       fValues = 0;
       fSumw2 = 0;
     }
-    delete [] axisCache;
-    axisCache = new TAxis*[fNVars];
-    memcpy(axisCache, c.axisCache, fNVars*sizeof(TAxis*));
+    // the cache refers to the axes of <c>, it is rebuilt at the next fill
+    DeleteCache();
   }
   return *this;
 }
@@ -212,6 +226,7 @@ void AliTHnT<TemplateArray, TemplateType>::Copy(TObject& c) const
   target.fNBins = fNBins;
   target.fNVars = fNVars;
   
+  target.DeleteCache();
   target.Init();
 
   for (Int_t i=0; i<fNSteps; i++)
@@ -288,22 +303,17 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 
   // fill axis cache
   if (!axisCache)
+    InitCache();
+  
+  if (!fLastVars)
   {
-    axisCache = new TAxis*[fNVars];
-    fNbinsCache = new Int_t[fNVars];
-    for (Int_t i=0; i<fNVars; i++)
-    {
-      axisCache[i] = GetAxis(i, 0);
-      fNbinsCache[i] = axisCache[i]->GetNbins();
-    }
-    
     fLastVars = new Double_t[fNVars];
     fLastBins = new Int_t[fNVars];
     
     // initial values to prevent checking for 0 below
     for (Int_t i=0; i<fNVars; i++)
     {
-      fLastBins[i] = axisCache[i]->FindBin(var[i]);
+      fLastBins[i] = FindBin(i, var[i]);
       fLastVars[i] = var[i];
     }
   }
@@ -312,26 +322,22 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
   Long64_t bin = 0;
   for (Int_t i=0; i<fNVars; i++)
   {
-    bin *= fNbinsCache[i];
-    
     Int_t tmpBin = 0;
     if (fLastVars[i] == var[i])
       tmpBin = fLastBins[i];
     else
     {
-      tmpBin = axisCache[i]->FindBin(var[i]);
+      tmpBin = FindBin(i, var[i]);
       fLastBins[i] = tmpBin;
       fLastVars[i] = var[i];
     }
-    //Printf("%d", tmpBin);
 
     // under/overflow not supported
     if (tmpBin < 1 || tmpBin > fNbinsCache[i])
       return;
     
     // bins start from 0 here
-    bin += tmpBin - 1;
-//     Printf("%lld", bin);
+    bin += (tmpBin - 1) * fStrideCache[i];
   }
 
   if (!fValues[istep])
@@ -360,6 +366,164 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 //   AliCFContainer::Fill(var, istep, weight);
 }
 
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::InitCache()
+{
+  // fills the per-axis cache: axis pointer, number of bins, range, fixed bin width flag and stride of the global bin index
+  // with this the global bin index is calculated without calls to GetAxis and, for fixed bin width, without TAxis::FindBin
+  
+  axisCache = new TAxis*[fNVars];
+  fNbinsCache = new Int_t[fNVars];
+  fXminCache = new Double_t[fNVars];
+  fXmaxCache = new Double_t[fNVars];
+  fFixedBinsCache = new Bool_t[fNVars];
+  fStrideCache = new Long64_t[fNVars];
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    axisCache[i] = GetAxis(i, 0);
+    fNbinsCache[i] = axisCache[i]->GetNbins();
+    fXminCache[i] = axisCache[i]->GetXmin();
+    fXmaxCache[i] = axisCache[i]->GetXmax();
+    fFixedBinsCache[i] = (axisCache[i]->GetXbins()->GetSize() == 0);
+  }
+  
+  // the last axis runs fastest
+  Long64_t stride = 1;
+  for (Int_t i=fNVars-1; i>=0; i--)
+  {
+    fStrideCache[i] = stride;
+    stride *= fNbinsCache[i];
+  }
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::DeleteCache()
+{
+  // deletes the axis cache and the fill buffers (they are recreated when needed)
+  
+  delete[] axisCache;
+  delete[] fNbinsCache;
+  delete[] fLastVars;
+  delete[] fLastBins;
+  delete[] fXminCache;
+  delete[] fXmaxCache;
+  delete[] fFixedBinsCache;
+  delete[] fStrideCache;
+  delete[] fBinBuffer;
+  
+  axisCache = 0;
+  fNbinsCache = 0;
+  fLastVars = 0;
+  fLastBins = 0;
+  fXminCache = 0;
+  fXmaxCache = 0;
+  fFixedBinsCache = 0;
+  fStrideCache = 0;
+  fBinBuffer = 0;
+  fBinBufferSize = 0;
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::FillN(Int_t nEntries, const Double_t* const* vars, Int_t istep, const Double_t* weights)
+{
+  // fills <nEntries> entries at once
+  //   vars[i][j] is the value of variable i of entry j (one array per variable)
+  //   weights[j] is the weight of entry j; if weights is 0, all entries are filled with weight 1
+  //
+  // the global bin indices are calculated axis by axis for the full batch. For axes with fixed bin width 
+  // the bin is calculated inline (same expression as TAxis::FindBin) which avoids the virtual call per entry 
+  // and allows the compiler to vectorize the loop. Only afterwards the weights are added to the container.
+  
+  if (nEntries <= 0)
+    return;
+  
+  if (!axisCache)
+    InitCache();
+  
+  if (fBinBufferSize < nEntries)
+  {
+    delete[] fBinBuffer;
+    fBinBuffer = new Long64_t[nEntries];
+    fBinBufferSize = nEntries;
+  }
+  
+  // calculate global bin indices, entries in under/overflow bins are flagged with -1
+  Long64_t* bins = fBinBuffer;
+  for (Int_t j=0; j<nEntries; j++)
+    bins[j] = 0;
+  
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    const Double_t* var = vars[i];
+    const Int_t nBins = fNbinsCache[i];
+    
+    if (fFixedBinsCache[i])
+    {
+      const Double_t xMin = fXminCache[i];
+      const Double_t xMax = fXmaxCache[i];
+      
+      for (Int_t j=0; j<nEntries; j++)
+      {
+	// bins start from 0 here
+	const Bool_t inRange = (var[j] >= xMin && var[j] < xMax);
+	const Int_t tmpBin = (inRange) ? (Int_t) (nBins * (var[j] - xMin) / (xMax - xMin)) : 0;
+	bins[j] = (inRange && tmpBin < nBins && bins[j] >= 0) ? bins[j] * nBins + tmpBin : -1;
+      }
+    }
+    else
+    {
+      for (Int_t j=0; j<nEntries; j++)
+      {
+	if (bins[j] < 0)
+	  continue;
+	
+	Int_t tmpBin = axisCache[i]->FindBin(var[j]);
+	
+	// under/overflow not supported
+	if (tmpBin < 1 || tmpBin > nBins)
+	  bins[j] = -1;
+	else
+	  bins[j] = bins[j] * nBins + tmpBin - 1;
+      }
+    }
+  }
+  
+  if (!fValues[istep])
+  {
+    fValues[istep] = new TemplateArray(fNBins);
+    AliInfo(Form("Created values container for step %d", istep));
+  }
+
+  if (weights && !fSumw2[istep])
+  {
+    for (Int_t j=0; j<nEntries; j++)
+    {
+      if (bins[j] >= 0 && weights[j] != 1)
+      {
+	// initialize with already filled entries (which have been filled with weight == 1), in this case fSumw2 := fValues
+	fSumw2[istep] = new TemplateArray(*fValues[istep]);
+	AliInfo(Form("Created sumw2 container for step %d", istep));
+	break;
+      }
+    }
+  }
+  
+  // scatter the weights
+  TemplateType* values = fValues[istep]->GetArray();
+  TemplateType* sumw2 = (fSumw2[istep]) ? fSumw2[istep]->GetArray() : 0;
+  
+  for (Int_t j=0; j<nEntries; j++)
+  {
+    if (bins[j] < 0)
+      continue;
+    
+    const Double_t weight = (weights) ? weights[j] : 1.;
+    values[bins[j]] += weight;
+    if (sumw2)
+      sumw2[bins[j]] += weight * weight;
+  }
+}
+
 template <class TemplateArray, typename TemplateType>
 Long64_t AliTHnT<TemplateArray, TemplateType>::GetGlobalBinIndex(const Int_t* binIdx)
 {
@@ -367,12 +531,12 @@ Long64_t AliTHnT<TemplateArray, TemplateType>::GetGlobalBinIndex(const Int_t* bi
   // binIdx contains TAxis bin indexes
   // here bin count starts at 0 because we do not have over/underflow bins
   
+  if (!axisCache)
+    InitCache();
+  
   Long64_t bin = 0;
   for (Int_t i=0; i<fNVars; i++)
-  {
-    bin *= GetAxis(i, 0)->GetNbins();
-    bin += binIdx[i] - 1;
-  }
+    bin += (binIdx[i] - 1) * fStrideCache[i];
 
   return bin;
 }
@@ -437,6 +601,7 @@ void AliTHnT<TemplateArray, TemplateType>::FillContainer(AliCFContainer* cont)
     }
     
     AliInfo(Form("Step %d: copied %lld entries out of %lld bins", i, count, GetGlobalBinIndex(binIdx)));
+    cont->GetGrid(i)->ContentChanged();
 
     delete[] binIdx;
     delete[] nBins;
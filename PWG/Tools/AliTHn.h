@@ -26,6 +26,7 @@ public:
   AliTHnBase(const Char_t* name, const Char_t* title,const Int_t nSelStep, const Int_t nVarIn, const Int_t* nBinIn) : AliCFContainer(name, title, nSelStep, nVarIn, nBinIn) { }
   
   virtual void Fill(const Double_t *var, Int_t istep, Double_t weight=1.) = 0;
+  virtual void FillN(Int_t nEntries, const Double_t* const* vars, Int_t istep, const Double_t* weights=0) = 0;
   virtual void FillParent() = 0;
   virtual void FillContainer(AliCFContainer* cont) = 0;
 
@@ -48,6 +49,7 @@ class AliTHnT : public AliTHnBase
   virtual ~AliTHnT();
   
   virtual void Fill(const Double_t *var, Int_t istep, Double_t weight=1.) ;
+  virtual void FillN(Int_t nEntries, const Double_t* const* vars, Int_t istep, const Double_t* weights=0);
   virtual void FillParent();
   virtual void FillContainer(AliCFContainer* cont);
   
@@ -65,8 +67,22 @@ class AliTHnT : public AliTHnBase
   
 protected:
   void Init();
+  void InitCache();
+  void DeleteCache();
   Long64_t GetGlobalBinIndex(const Int_t* binIdx);
   
+  // same result as axisCache[i]->FindBin(x), inlined for axes with fixed bin width
+  Int_t FindBin(Int_t i, Double_t x) const
+  {
+    if (!fFixedBinsCache[i])
+      return axisCache[i]->FindBin(x);
+    if (x < fXminCache[i])
+      return 0;
+    if (!(x < fXmaxCache[i]))
+      return fNbinsCache[i] + 1;
+    return 1 + (Int_t) (fNbinsCache[i] * (x - fXminCache[i]) / (fXmaxCache[i] - fXminCache[i]));
+  }
+  
   Long64_t fNBins;   // number of total bins
   Int_t    fNVars;   // number of variables
   Int_t    fNSteps;  // number of selection steps
@@ -77,6 +93,12 @@ protected:
   Int_t* fNbinsCache; //! cache Nbins per axis
   Double_t* fLastVars; //! caching of last used bins (in many loops some vars are the same for a while)
   Int_t* fLastBins; //! caching of last used bins (in many loops some vars are the same for a while)
+  Double_t* fXminCache; //! cache lower edge per axis
+  Double_t* fXmaxCache; //! cache upper edge per axis
+  Bool_t* fFixedBinsCache; //! cache if axis has fixed bin width
+  Long64_t* fStrideCache; //! cache stride of each axis in the global bin index
+  Long64_t* fBinBuffer; //! global bin indices of the batch processed in FillN
+  Int_t fBinBufferSize; //! allocated size of fBinBuffer
   
   ClassDef(AliTHnT, 5) // THn like container
 };
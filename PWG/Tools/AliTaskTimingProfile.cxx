@@ -0,0 +1,111 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <TList.h>
+#include <TObjString.h>
+
+#include "AliTaskTimingProfile.h"
+
+ClassImp(AliTaskTimingProfile)
+
+AliTaskTimingProfile::AliTaskTimingProfile() :
+  TNamed(),
+  fRegionNames(),
+  fCounterNames(),
+  fOutput(0),
+  fBooked(kFALSE),
+  fT0(0),
+  fStart(),
+  fHistRealTime(0),
+  fHistCounters(0)
+{
+  // Default constructor
+  fRegionNames.SetOwner(kTRUE);
+  fCounterNames.SetOwner(kTRUE);
+}
+
+AliTaskTimingProfile::AliTaskTimingProfile(const char *name) :
+  TNamed(name, name),
+  fRegionNames(),
+  fCounterNames(),
+  fOutput(0),
+  fBooked(kFALSE),
+  fT0(0),
+  fStart(),
+  fHistRealTime(0),
+  fHistCounters(0)
+{
+  // Constructor, the name is used in the names of the histograms
+  fRegionNames.SetOwner(kTRUE);
+  fCounterNames.SetOwner(kTRUE);
+}
+
+AliTaskTimingProfile::~AliTaskTimingProfile()
+{
+  // Destructor, the histograms belong to the output list
+}
+
+Int_t AliTaskTimingProfile::AddRegion(const char *name)
+{
+  // Declare a timed region, return its index for Start(), Stop() and Scope
+  if (fBooked) {
+    Error("AddRegion", "Region %s declared after the first event, ignored", name);
+    return -1;
+  }
+  fRegionNames.Add(new TObjString(name));
+  return fRegionNames.GetEntriesFast()-1;
+}
+
+Int_t AliTaskTimingProfile::AddCounter(const char *name)
+{
+  // Declare a counter, return its index for Count()
+  if (fBooked) {
+    Error("AddCounter", "Counter %s declared after the first event, ignored", name);
+    return -1;
+  }
+  fCounterNames.Add(new TObjString(name));
+  return fCounterNames.GetEntriesFast()-1;
+}
+
+void AliTaskTimingProfile::Init(TList *output)
+{
+  // Enable the timing, the histograms will be booked in output
+  fOutput = output;
+  TTimeStamp t0;
+  fT0 = t0.GetSec();
+}
+
+void AliTaskTimingProfile::BookHistograms()
+{
+  // Book the histograms of the declared regions and counters in the output list
+  fBooked = kTRUE;
+  Bool_t addDirectory = TH1::AddDirectoryStatus();
+  TH1::AddDirectory(kFALSE);
+
+  Int_t nRegions = GetNRegions();
+  fStart.Set(nRegions);
+  if (nRegions > 0) {
+    fHistRealTime = new TProfile(Form("h%sRealTime", GetName()), "Real time per call;;t (#mus)", nRegions, 0, nRegions);
+    for (Int_t i = 0; i < nRegions; i++) fHistRealTime->GetXaxis()->SetBinLabel(i+1, fRegionNames.At(i)->GetName());
+    fOutput->Add(fHistRealTime);
+  }
+
+  Int_t nCounters = GetNCounters();
+  if (nCounters > 0) {
+    fHistCounters = new TH1D(Form("h%sCounters", GetName()), "Counters;;counts", nCounters, 0, nCounters);
+    for (Int_t i = 0; i < nCounters; i++) fHistCounters->GetXaxis()->SetBinLabel(i+1, fCounterNames.At(i)->GetName());
+    fOutput->Add(fHistCounters);
+  }
+  TH1::AddDirectory(addDirectory);
+}
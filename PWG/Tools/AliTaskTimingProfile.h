@@ -0,0 +1,108 @@
+#ifndef ALITASKTIMINGPROFILE_H
+#define ALITASKTIMINGPROFILE_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <TNamed.h>
+#include <TArrayD.h>
+#include <TObjArray.h>
+#include <TProfile.h>
+#include <TH1D.h>
+#include <TTimeStamp.h>
+
+class TList;
+
+/**
+ * \class AliTaskTimingProfile
+ * \brief Timers and counters of the named regions of an analysis task.
+ *
+ * Init() gives the output list of the task. The histograms are booked in it at
+ * the first Start() or Count(): one profile with the real time per call of each
+ * region (in microseconds, entries = number of calls) and one histogram with the
+ * counters. The regions and counters can therefore be declared by the task and
+ * by its derived classes until the first event. The bins are labelled with the
+ * region names, so the outputs of the workers are merged as any other histogram
+ * of the task.
+ *
+ * The tasks keep a null pointer when the timing is not requested, the cost is
+ * then one pointer check per region, see AliTaskTimingProfile::Scope.
+ */
+class AliTaskTimingProfile : public TNamed {
+public:
+  /**
+   * \class Scope
+   * \brief Times a region from its construction to its destruction, does nothing for a null profile.
+   */
+  class Scope {
+  public:
+    Scope(AliTaskTimingProfile *profile, Int_t region) : fProfile(profile), fRegion(region)
+                                                           { if (fProfile) fProfile->Start(fRegion); }
+    ~Scope()                                               { if (fProfile) fProfile->Stop(fRegion); }
+  private:
+    Scope(const Scope&);            // not implemented
+    Scope& operator=(const Scope&); // not implemented
+
+    AliTaskTimingProfile *fProfile; ///< Profile filled, can be null
+    Int_t                 fRegion;  ///< Region timed
+  };
+
+  AliTaskTimingProfile();
+  AliTaskTimingProfile(const char *name);
+  virtual ~AliTaskTimingProfile();
+
+  Int_t       AddRegion(const char *name);
+  Int_t       AddCounter(const char *name);
+  void        Init(TList *output);
+
+  Int_t       GetNRegions()                const { return fRegionNames.GetEntriesFast()  ; }
+  Int_t       GetNCounters()               const { return fCounterNames.GetEntriesFast() ; }
+  TProfile   *GetRealTimeHistogram()       const { return fHistRealTime                  ; }
+  TH1D       *GetCounterHistogram()        const { return fHistCounters                  ; }
+
+  inline void Start(Int_t region);
+  inline void Stop(Int_t region);
+  inline void Count(Int_t counter, Double_t n=1.);
+
+private:
+  AliTaskTimingProfile(const AliTaskTimingProfile&);            // not implemented
+  AliTaskTimingProfile& operator=(const AliTaskTimingProfile&); // not implemented
+
+  void        BookHistograms();
+  Double_t    Now() const { TTimeStamp t; return (t.GetSec()-fT0)*1e6 + t.GetNanoSec()*1e-3; }
+
+  TObjArray   fRegionNames;     ///< Names of the timed regions
+  TObjArray   fCounterNames;    ///< Names of the counters
+  TList      *fOutput;          //!<! Output list of the task, the histograms are booked in it
+  Bool_t      fBooked;          //!<! Histograms booked, no more regions or counters can be declared
+  Long64_t    fT0;              //!<! Seconds of the first time stamp, keeps the precision of the microseconds
+  TArrayD     fStart;           //!<! Start time of the running regions (microseconds)
+  TProfile   *fHistRealTime;    //!<! Real time per call of the regions, owned by the output list
+  TH1D       *fHistCounters;    //!<! Counters, owned by the output list
+
+  ClassDef(AliTaskTimingProfile, 1); // Timers and counters of the regions of an analysis task
+};
+
+void AliTaskTimingProfile::Start(Int_t region)
+{
+  // Start the timer of the region
+  if (!fOutput) return;
+  if (!fBooked) BookHistograms();
+  fStart[region] = Now();
+}
+
+void AliTaskTimingProfile::Stop(Int_t region)
+{
+  // Stop the timer of the region and fill its real time
+  if (!fOutput) return;
+  fHistRealTime->Fill(region+0.5, Now()-fStart[region]);
+}
+
+void AliTaskTimingProfile::Count(Int_t counter, Double_t n)
+{
+  // Add n to the counter
+  if (!fOutput) return;
+  if (!fBooked) BookHistograms();
+  fHistCounters->Fill(counter+0.5, n);
+}
+
+#endif /* ALITASKTIMINGPROFILE_H */
@@ -30,6 +30,8 @@
 #pragma link C++ class AliJSONString+;
 #pragma link C++ class AliAnalysisTaskDummy+;
 #pragma link C++ class AliTLorentzVector+;
+#pragma link C++ class AliTaskTimingProfile+;
+#pragma link C++ class AliEventShapeCalculator+;
 #pragma link C++ namespace TestTHistManager;
 #pragma link C++ class TestTHistManager::THistManagerTestSuite;
 #pragma link C++ function TestTHistManager::TestRunAll();
@@ -42,14 +42,18 @@ ClassImp(THistManager)
 THistManager::THistManager():
 		TNamed(),
 		fHistos(NULL),
-		fIsOwner(true)
+		fIsOwner(true),
+		fHandles(),
+		fThreadSlots()
 {
 }
 
 THistManager::THistManager(const char *name):
 		TNamed(name, Form("Histogram container %s", name)),
 		fHistos(NULL),
-		fIsOwner(true)
+		fIsOwner(true),
+		fHandles(),
+		fThreadSlots()
 {
 	fHistos = new THashList();
 	fHistos->SetName(Form("histos%s", name));
@@ -57,6 +61,7 @@ THistManager::THistManager(const char *name):
 }
 
 THistManager::~THistManager(){
+  ClearThreadSlots();
 	if(fHistos && fIsOwner) delete fHistos;
 }
 
@@ -567,6 +572,119 @@ void THistManager::FillProfile(const char* name, double x, double y, double weig
   hist->Fill(x, y, weight);
 }
 
+int THistManager::GetHistogramHandle(const char *name){
+  TObject *hist = FindObject(name);
+  if(!hist) return -1;
+  for(size_t ihandle = 0; ihandle < fHandles.size(); ihandle++){
+    if(fHandles[ihandle] == hist) return ihandle;
+  }
+  fHandles.push_back(hist);
+  for(std::vector<std::vector<TObject *> >::iterator slotit = fThreadSlots.begin(); slotit != fThreadSlots.end(); ++slotit)
+    slotit->push_back(CreateShadowHistogram(hist));
+  return fHandles.size() - 1;
+}
+
+void THistManager::FillTH1(int handle, double x, double weight, int slot){
+  TH1 *hist = dynamic_cast<TH1 *>(GetHandleObject(handle, slot));
+  if(!hist){
+    Fatal("THistManager::FillTH1", "Handle %d is not connected to a 1D histogram", handle);
+    return;
+  }
+  hist->Fill(x, weight);
+}
+
+void THistManager::FillTH2(int handle, double x, double y, double weight, int slot){
+  TH2 *hist = dynamic_cast<TH2 *>(GetHandleObject(handle, slot));
+  if(!hist){
+    Fatal("THistManager::FillTH2", "Handle %d is not connected to a 2D histogram", handle);
+    return;
+  }
+  hist->Fill(x, y, weight);
+}
+
+void THistManager::FillTH3(int handle, double x, double y, double z, double weight, int slot){
+  TH3 *hist = dynamic_cast<TH3 *>(GetHandleObject(handle, slot));
+  if(!hist){
+    Fatal("THistManager::FillTH3", "Handle %d is not connected to a 3D histogram", handle);
+    return;
+  }
+  hist->Fill(x, y, z, weight);
+}
+
+void THistManager::FillTHnSparse(int handle, const double *x, double weight, int slot){
+  THnSparse *hist = dynamic_cast<THnSparse *>(GetHandleObject(handle, slot));
+  if(!hist){
+    Fatal("THistManager::FillTHnSparse", "Handle %d is not connected to a THnSparse", handle);
+    return;
+  }
+  hist->Fill(x, weight);
+}
+
+void THistManager::FillProfile(int handle, double x, double y, double weight, int slot){
+  TProfile *hist = dynamic_cast<TProfile *>(GetHandleObject(handle, slot));
+  if(!hist){
+    Fatal("THistManager::FillProfile", "Handle %d is not connected to a profile histogram", handle);
+    return;
+  }
+  hist->Fill(x, y, weight);
+}
+
+void THistManager::SetNumberOfThreadSlots(int nslots){
+  ClearThreadSlots();
+  if(nslots <= 0) return;
+  fThreadSlots.resize(nslots);
+  for(std::vector<std::vector<TObject *> >::iterator slotit = fThreadSlots.begin(); slotit != fThreadSlots.end(); ++slotit){
+    for(std::vector<TObject *>::iterator histit = fHandles.begin(); histit != fHandles.end(); ++histit)
+      slotit->push_back(CreateShadowHistogram(*histit));
+  }
+}
+
+void THistManager::MergeThreadSlots(){
+  for(std::vector<std::vector<TObject *> >::iterator slotit = fThreadSlots.begin(); slotit != fThreadSlots.end(); ++slotit){
+    for(size_t ihandle = 0; ihandle < fHandles.size(); ihandle++){
+      TObject *shadow = (*slotit)[ihandle];
+      if(TH1 *hist = dynamic_cast<TH1 *>(fHandles[ihandle])){
+        TH1 *shadowhist = static_cast<TH1 *>(shadow);
+        hist->Add(shadowhist);
+        shadowhist->Reset();
+      } else if(THnBase *hist = dynamic_cast<THnBase *>(fHandles[ihandle])){
+        THnBase *shadowhist = static_cast<THnBase *>(shadow);
+        hist->Add(shadowhist);
+        shadowhist->Reset();
+      }
+    }
+  }
+}
+
+TObject *THistManager::GetHandleObject(int handle, int slot) const {
+  if(handle < 0 || handle >= static_cast<int>(fHandles.size())) return NULL;
+  if(slot < 0) return fHandles[handle];
+  if(slot >= static_cast<int>(fThreadSlots.size())){
+    Fatal("THistManager::GetHandleObject", "Thread slot %d requested, but only %d slots available", slot, static_cast<int>(fThreadSlots.size()));
+    return NULL;
+  }
+  return fThreadSlots[slot][handle];
+}
+
+TObject *THistManager::CreateShadowHistogram(const TObject *o) const {
+  TObject *shadow = o->Clone();
+  if(TH1 *hist = dynamic_cast<TH1 *>(shadow)){
+    hist->SetDirectory(NULL);
+    hist->Reset();
+  } else if(THnBase *hist = dynamic_cast<THnBase *>(shadow)){
+    hist->Reset();
+  }
+  return shadow;
+}
+
+void THistManager::ClearThreadSlots(){
+  for(std::vector<std::vector<TObject *> >::iterator slotit = fThreadSlots.begin(); slotit != fThreadSlots.end(); ++slotit){
+    for(std::vector<TObject *>::iterator histit = slotit->begin(); histit != slotit->end(); ++histit)
+      delete *histit;
+  }
+  fThreadSlots.clear();
+}
+
 TObject *THistManager::FindObject(const char *name) const {
 	TString dirname(basename(name)), hname(histname(name));
 	THashList *parent(FindGroup(dirname));
@@ -972,6 +1090,81 @@ namespace TestTHistManager {
     return success ? 0 : 1;
   }
 
+  int THistManagerTestSuite::TestFillHandleHistograms(){
+    THistManager testmgr("testmgr");
+
+    testmgr.CreateTH1("Group1/Test1", "Test fill 1D histogram via handle", 1, 0., 1.);
+    testmgr.CreateTH2("Group1/Test2", "Test fill 2D histogram via handle", 1, 0., 1., 1, 0., 1.);
+    testmgr.CreateTH3("Test3", "Test fill 3D histogram via handle", 1, 0., 1., 1, 0., 1., 1, 0., 1.);
+    int nbins[4] = {1,1,1,1}; double min[4] = {0.,0.,0.,0.}, max[4] = {1.,1.,1.,1.};
+    testmgr.CreateTHnSparse("TestN", "Test fill THnSparse via handle", 4, nbins, min, max);
+    testmgr.CreateTProfile("Group2/Subgroup1/TestProfile", "Test fill Profile histogram via handle", 1, 0., 1.);
+
+    bool success(true);
+    if(testmgr.GetHistogramHandle("Group1/NotExisting") != -1){
+      std::cout << "Handle found for non-existing histogram Group1/NotExisting" << std::endl;
+      success = false;
+    }
+
+    // Request handles before and after enabling the thread slots
+    int handle1 = testmgr.GetHistogramHandle("Group1/Test1"),
+        handle2 = testmgr.GetHistogramHandle("Group1/Test2"),
+        handle3 = testmgr.GetHistogramHandle("Test3");
+    testmgr.SetNumberOfThreadSlots(2);
+    int handleN = testmgr.GetHistogramHandle("TestN"),
+        handleProfile = testmgr.GetHistogramHandle("Group2/Subgroup1/TestProfile");
+    if(handle1 < 0 || handle2 < 0 || handle3 < 0 || handleN < 0 || handleProfile < 0){
+      std::cout << "Not all handles found" << std::endl;
+      return 1;
+    }
+    if(testmgr.GetHistogramHandle("Group1/Test1") != handle1){
+      std::cout << "Handle for Group1/Test1 not stable" << std::endl;
+      success = false;
+    }
+
+    double point[4] = {0.5, 0.5, 0.5, 0.5};
+    for(int i = 0; i < 100; i++){
+      int slot = i < 50 ? -1 : i % 2;
+      testmgr.FillTH1(handle1, 0.5, 1., slot);
+      testmgr.FillTH2(handle2, 0.5, 0.5, 1., slot);
+      testmgr.FillTH3(handle3, 0.5, 0.5, 0.5, 1., slot);
+      testmgr.FillTHnSparse(handleN, point, 1., slot);
+      testmgr.FillProfile(handleProfile, 0.5, 1., 1., slot);
+    }
+    testmgr.MergeThreadSlots();
+
+    // Evaluate test
+    // tell user why test has failed
+    TH1 *test1 = dynamic_cast<TH1 *>(testmgr.FindObject("Group1/Test1"));
+    if(!test1 || TMath::Abs(test1->GetBinContent(1) - 100) > DBL_EPSILON){
+      std::cout << "Group1/Test1: Mismatch in values, expected 100" << std::endl;
+      success = false;
+    }
+    TH2 *test2 = dynamic_cast<TH2 *>(testmgr.FindObject("Group1/Test2"));
+    if(!test2 || TMath::Abs(test2->GetBinContent(1, 1) - 100) > DBL_EPSILON){
+      std::cout << "Group1/Test2: Mismatch in values, expected 100" << std::endl;
+      success = false;
+    }
+    TH3 *test3 = dynamic_cast<TH3 *>(testmgr.FindObject("Test3"));
+    if(!test3 || TMath::Abs(test3->GetBinContent(1, 1, 1) - 100) > DBL_EPSILON){
+      std::cout << "Test3: Mismatch in values, expected 100" << std::endl;
+      success = false;
+    }
+    THnSparse *testN = dynamic_cast<THnSparse *>(testmgr.FindObject("TestN"));
+    int index[4] = {1,1,1,1};
+    if(!testN || TMath::Abs(testN->GetBinContent(index) - 100) > DBL_EPSILON){
+      std::cout << "TestN: Mismatch in values, expected 100" << std::endl;
+      success = false;
+    }
+    TProfile *testProfile = dynamic_cast<TProfile *>(testmgr.FindObject("Group2/Subgroup1/TestProfile"));
+    if(!testProfile || TMath::Abs(testProfile->GetBinContent(1) - 1) > DBL_EPSILON || TMath::Abs(testProfile->GetBinEntries(1) - 100) > DBL_EPSILON){
+      std::cout << "Group2/Subgroup1/TestProfile: Mismatch in values, expected 1 with 100 entries" << std::endl;
+      success = false;
+    }
+
+    return success ? 0 : 1;
+  }
+
   int TestRunAll(){
     int testresult(0);
     THistManagerTestSuite testsuite;
@@ -992,6 +1185,10 @@ namespace TestTHistManager {
     testresult += testsuite.TestFillGroupedHistograms();
     std::cout << "Result after test: " << testresult << std::endl;
 
+    std::cout << "Running test: Fill Handle" << std::endl;
+    testresult += testsuite.TestFillHandleHistograms();
+    std::cout << "Result after test: " << testresult << std::endl;
+
     return testresult;
   }
 
@@ -1014,4 +1211,9 @@ namespace TestTHistManager {
     THistManagerTestSuite testsuite;
     return testsuite.TestFillGroupedHistograms();
   }
+
+  int TestRunFillHandle(){
+    THistManagerTestSuite testsuite;
+    return testsuite.TestFillHandleHistograms();
+  }
 }
@@ -7,6 +7,7 @@
 #include <TIterator.h>
 #include <TNamed.h>
 #include <iterator>
+#include <vector>
 
 class TArrayD;
 class TAxis;
@@ -469,6 +470,95 @@ public:
 	 */
   void FillProfile(const char *name, double x, double y, double weight = 1.);
 
+  /**
+   * Resolve an histogram by its name (full path including parent groups) and
+   * register it for handle-based access. The handle stays valid for the lifetime
+   * of the histogram manager. Requesting the handle of an histogram more than
+   * once returns the same handle.
+   *
+   * Handles remove the string parsing and hash lookup from the fill call, and
+   * they are needed to fill from several threads (see @ref SetNumberOfThreadSlots)
+   * @param[in] name Name of the histogram
+   * @return Handle of the histogram (-1 if the histogram is not found)
+   */
+  int GetHistogramHandle(const char *name);
+
+  /**
+   * Fill a 1D histogram via its handle (see @ref GetHistogramHandle)
+   * @param[in] handle Handle of the histogram
+   * @param[in] x x-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] slot Thread slot to be filled (default -1: fill the histogram in the container directly)
+   */
+  void FillTH1(int handle, double x, double weight = 1., int slot = -1);
+
+  /**
+   * Fill a 2D histogram via its handle (see @ref GetHistogramHandle)
+   * @param[in] handle Handle of the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] slot Thread slot to be filled (default -1: fill the histogram in the container directly)
+   */
+  void FillTH2(int handle, double x, double y, double weight = 1., int slot = -1);
+
+  /**
+   * Fill a 3D histogram via its handle (see @ref GetHistogramHandle)
+   * @param[in] handle Handle of the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] z z-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] slot Thread slot to be filled (default -1: fill the histogram in the container directly)
+   */
+  void FillTH3(int handle, double x, double y, double z, double weight = 1., int slot = -1);
+
+  /**
+   * Fill a nD histogram via its handle (see @ref GetHistogramHandle)
+   * @param[in] handle Handle of the histogram
+   * @param[in] x coordinates of the data
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] slot Thread slot to be filled (default -1: fill the histogram in the container directly)
+   */
+  void FillTHnSparse(int handle, const double *x, double weight = 1., int slot = -1);
+
+  /**
+   * Fill a profile histogram via its handle (see @ref GetHistogramHandle)
+   * @param[in] handle Handle of the profile histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   * @param[in] slot Thread slot to be filled (default -1: fill the histogram in the container directly)
+   */
+  void FillProfile(int handle, double x, double y, double weight = 1., int slot = -1);
+
+  /**
+   * Enable thread slots: For each registered histogram handle an empty
+   * shadow histogram is created per slot. Each worker thread fills its own
+   * slot, so no locking is needed as long as a slot is used by only one
+   * thread at a time. The shadow histograms are added to the histograms in
+   * the container by @ref MergeThreadSlots. The slots have to be set up before
+   * the worker threads start filling; handles requested afterwards get their
+   * shadow histograms at registration.
+   * @param[in] nslots Number of thread slots (0 disables the thread slots)
+   */
+  void SetNumberOfThreadSlots(int nslots);
+
+  /**
+   * Get the number of thread slots
+   * @return Number of thread slots (0 if disabled)
+   */
+  int GetNumberOfThreadSlots() const { return fThreadSlots.size(); }
+
+  /**
+   * Add the content of the shadow histograms of all thread slots to the
+   * histograms in the container and reset the shadow histograms. Slots are
+   * merged in increasing order, so the result does not depend on the
+   * scheduling of the worker threads. Must be called once the worker threads
+   * are done, at the latest in the Terminate of the task.
+   */
+  void MergeThreadSlots();
+
   /**
    * Create forward iterator starting at the beginning of the
    * container
@@ -545,8 +635,30 @@ private:
 	 */
 	TString histname(const TString &path) const;
 
+	/**
+	 * Get the object connected to a histogram handle
+	 * @param[in] handle Handle of the histogram
+	 * @param[in] slot Thread slot (-1 for the histogram in the container)
+	 * @return Histogram connected to the handle (shadow histogram in case of a thread slot)
+	 */
+	TObject *GetHandleObject(int handle, int slot) const;
+
+	/**
+	 * Create an empty shadow copy of a histogram for a thread slot
+	 * @param[in] o Histogram to be copied
+	 * @return The shadow histogram
+	 */
+	TObject *CreateShadowHistogram(const TObject *o) const;
+
+	/**
+	 * Delete all shadow histograms of the thread slots
+	 */
+	void ClearThreadSlots();
+
 	THashList *fHistos;                   ///< List of histograms
 	bool fIsOwner;                        ///< Set the ownership
+	std::vector<TObject *> fHandles;      ///<! Histograms registered for handle-based access
+	std::vector<std::vector<TObject *> > fThreadSlots; ///<! Shadow histograms per thread slot, indexed by handle
 
   /// \cond CLASSIMP
 	ClassDef(THistManager, 1);  // Container for histograms
@@ -671,6 +783,21 @@ public:
    * @return 0 if test is passed, 1 if it failed
    */
   int TestFillGroupedHistograms();
+
+  /**
+   * Purpose of the test: Check whether histograms are filled correctly via handles and thread slots
+   * Relies on: TestBuildSimpleHistograms, TestFillSimpleHistograms
+   *
+   * Creating histograms of all types with 1 bin per dimension. Each histogram
+   * is filled 100 times via its handle: 50 times directly and 50 times distributed
+   * over 2 thread slots, which are merged afterwards.
+   *
+   * Test passed:
+   * - Handles for all histograms are found, a non-existing histogram gives handle -1
+   * - All histograms need to have in its 1 bin the bin content 100 (1 for the profile)
+   * @return 0 if test is passed, 1 if it failed
+   */
+  int TestFillHandleHistograms();
 };
 
 /**
@@ -708,5 +835,12 @@ int TestRunFillSimple();
  */
 int TestRunFillGrouped();
 
+/**
+ * Run the test for filling histograms via handles. See @ref THistManagerTestSuite
+ * for details.
+ * @return 0 if test is passed, 1 if failed
+ */
+int TestRunFillHandle();
+
 }
 #endif
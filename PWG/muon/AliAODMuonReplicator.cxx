@@ -65,8 +65,7 @@ fList(0x0),
 fMCParticles(0x0),
 fMCHeader(0x0),
 fMCMode(mcMode),
-fLabelMap(),
-fParticleSelected(),
+fNewLabel(),
 fReplicateHeader(replicateHeader),
 fReplicateTracklets(replicateTracklets)
 {
@@ -98,50 +97,65 @@ void AliAODMuonReplicator::SelectParticle(Int_t i)
   /// of negative daughter and mother
   /// IDs when setting!
   
-  if (!IsParticleSelected(TMath::Abs(i)))
+  i = TMath::Abs(i);
+  if ( i < (Int_t)fNewLabel.size() && fNewLabel[i] < 0 ) fNewLabel[i] = 0;
+}
+
+//_____________________________________________________________________________
+void AliAODMuonReplicator::SelectAncestors(Int_t label, const TClonesArray& mcParticles)
+{
+  /// select the particle and all its mothers. The walk stops at the first
+  /// particle already selected, as its mothers are then selected too
+  
+  while ( label >= 0 && !IsParticleSelected(label) )
   {
-    fParticleSelected.Add(TMath::Abs(i),1);    
+    if ( label >= (Int_t)fNewLabel.size() )
+    {
+      AliError(Form("Got a label %d beyond the %d MC particles ! Check that !",label,(Int_t)fNewLabel.size()));
+      return;
+    }
+    SelectParticle(label);
+    AliAODMCParticle* mother = static_cast<AliAODMCParticle*>(mcParticles.UncheckedAt(label));
+    if (!mother)
+    {
+      AliError("Got a null mother ! Check that !");
+      label = -1;
+    }
+    else
+    {
+      label = mother->GetMother();
+    }
   }
 }
 
 //_____________________________________________________________________________
-Bool_t AliAODMuonReplicator::IsParticleSelected(Int_t i)  
+Bool_t AliAODMuonReplicator::IsParticleSelected(Int_t i) const
 {
   /// taking the absolute values here, need to take
   /// care with negative daughter and mother
   /// IDs when setting!
-  return (fParticleSelected.GetValue(TMath::Abs(i))==1);
+  i = TMath::Abs(i);
+  return ( i < (Int_t)fNewLabel.size() && fNewLabel[i] >= 0 );
 }
 
 
 //_____________________________________________________________________________
-void AliAODMuonReplicator::CreateLabelMap(const AliAODEvent& source)
+void AliAODMuonReplicator::CreateLabelMap()
 {  
   //
   // this should be called once all selections are done 
+  // the selected particles are numbered in their input order
   //
   
-  fLabelMap.Delete();
-  
-  TClonesArray* mcParticles = static_cast<TClonesArray*>(source.FindListObject(AliAODMCParticle::StdBranchName()));
-  
-  Int_t i(0);
   Int_t j(0);
-  
-  TIter next(mcParticles);
-  
-  while ( next() ) 
+  for ( UInt_t i = 0; i < fNewLabel.size(); ++i )
   {
-    if (IsParticleSelected(i))
-    {
-      fLabelMap.Add(i,j++);
-    }
-    ++i;
+    if ( fNewLabel[i] >= 0 ) fNewLabel[i] = j++;
   }
 }
 
 //_____________________________________________________________________________
-Int_t AliAODMuonReplicator::GetNewLabel(Int_t i) 
+Int_t AliAODMuonReplicator::GetNewLabel(Int_t i) const
 {
   /// Gets the label from the new created Map
   /// Call CreatLabelMap before
@@ -150,13 +164,17 @@ Int_t AliAODMuonReplicator::GetNewLabel(Int_t i)
     AliError(Form("Searching for new label of particle with invalid label %i",i));
     return i;
   }
-  return fLabelMap.GetValue(i);
+  return IsParticleSelected(i) ? fNewLabel[i] : 0;
 }
 
 //_____________________________________________________________________________
 void AliAODMuonReplicator::FilterMC(const AliAODEvent& source)
 {
   /// Filter MC information
+  ///
+  /// In the aggressive modes the kept particles are first flagged for the
+  /// whole event, then numbered in one pass, and only the kept particles
+  /// are copied, with their mother and daughters remapped
 
   fMCHeader->Reset();
   fMCParticles->Clear("C");
@@ -164,7 +182,7 @@ void AliAODMuonReplicator::FilterMC(const AliAODEvent& source)
   AliAODMCHeader* mcHeader(0x0);
   TClonesArray* mcParticles(0x0);
   
-  fParticleSelected.Delete();
+  fNewLabel.clear();
   
   if ( fMCMode==2 && !fTracks->GetEntries() ) return;
   // for fMCMode==2 we only copy MC information for events where there's at least one muon track
@@ -180,152 +198,109 @@ void AliAODMuonReplicator::FilterMC(const AliAODEvent& source)
   
   if ( mcParticles && mcParticles->GetLast() >= 0 && fMCMode>=2 )
   {
-    // loop on (kept) muon tracks to find their ancestors
-    TIter nextMT(fTracks);
-    AliAODTrack* mt;
+    const Int_t nmc = mcParticles->GetEntriesFast();
+    fNewLabel.assign(nmc,-1);
     
-    while ( ( mt = static_cast<AliAODTrack*>(nextMT()) ) )
+    // loop on (kept) muon tracks to find their ancestors
+    const Int_t ntracks = fTracks->GetEntriesFast();
+    for ( Int_t it = 0; it < ntracks; ++it )
     {
-      Int_t label = mt->GetLabel();
-      
-      while ( label >= 0 ) 
-      {
-        SelectParticle(label);
-        AliAODMCParticle* mother = static_cast<AliAODMCParticle*>(mcParticles->UncheckedAt(label));
-        if (!mother)
-        {
-          AliError("Got a null mother ! Check that !");
-          label = -1;
-        }
-        else
-        {
-          label = mother->GetMother();
-        }
-      }
+      SelectAncestors(static_cast<AliAODTrack*>(fTracks->UncheckedAt(it))->GetLabel(),*mcParticles);
     }
     
-    if ( mcParticles && fMCMode==3 )
+    if ( fMCMode==3 )
     {
       // loop on MC muon tracks to find their ancestors
-      for ( Int_t ipart=0; ipart<mcParticles->GetEntries(); ipart++ )
+      for ( Int_t ipart=0; ipart<nmc; ipart++ )
       {
         AliAODMCParticle* mcp = static_cast<AliAODMCParticle*>(mcParticles->UncheckedAt(ipart));
-        if ( TMath::Abs(mcp->PdgCode()) != 13 ) continue;
-        Int_t label = ipart;
-
-        while ( label >= 0 )
-        {
-          SelectParticle(label);
-          AliAODMCParticle* mother = static_cast<AliAODMCParticle*>(mcParticles->UncheckedAt(label));
-          if (!mother)
-          {
-            AliError("Got a null mother ! Check that !");
-            label = -1;
-          }
-          else
-          {
-            label = mother->GetMother();
-          }
-        }
+        if ( !mcp || TMath::Abs(mcp->PdgCode()) != 13 ) continue;
+        SelectAncestors(ipart,*mcParticles);
       }
     }
     
-    CreateLabelMap(source);
+    CreateLabelMap();
     
     // Actual filtering and label remapping (shamelessly taken for the implementation of AliAODHandler::StoreMCParticles)
-    TIter nextMC(mcParticles);
-    AliAODMCParticle* p;
-    Int_t nmc(0);
     Int_t nmcout(0);
     
-    while ( ( p = static_cast<AliAODMCParticle*>(nextMC()) ) )
+    for ( Int_t imc = 0; imc < nmc; ++imc )
     {
-      AliAODMCParticle c(*p);
+      if ( fNewLabel[imc] < 0 ) continue;
+      
+      AliAODMCParticle* p = static_cast<AliAODMCParticle*>(mcParticles->UncheckedAt(imc));
+      if ( !p ) continue;
+      
+      AliAODMCParticle* c = new ((*fMCParticles)[nmcout++]) AliAODMCParticle(*p);
+      
+      Int_t d0 =  p->GetDaughter(0);
+      Int_t d1 =  p->GetDaughter(1);
+      Int_t m =   p->GetMother();
       
-      if ( IsParticleSelected(nmc) )
+      // other than for the track labels, negative values mean
+      // no daughter/mother so preserve it
+      
+      if(d0<0 && d1<0)
       {
-        // 
-        Int_t d0 =  p->GetDaughter(0);
-        Int_t d1 =  p->GetDaughter(1);
-        Int_t m =   p->GetMother();
-        
-        // other than for the track labels, negative values mean
-        // no daughter/mother so preserve it
-        
-        if(d0<0 && d1<0)
-        {
-          // no first daughter -> no second daughter
-          // nothing to be done
-          // second condition not needed just for sanity check at the end
-          c.SetDaughter(0,d0);
-          c.SetDaughter(1,d1);
-        } else if(d1 < 0 && d0 >= 0) 
-        {
-          // Only one daughter
-          // second condition not needed just for sanity check at the end
-          if(IsParticleSelected(d0))
-          {
-            c.SetDaughter(0,GetNewLabel(d0));
-          } else 
-          {
-            c.SetDaughter(0,-1);
-          }
-          c.SetDaughter(1,d1);
-        }
-        else if (d0 > 0 && d1 > 0 )
+        // no first daughter -> no second daughter
+        // nothing to be done
+        // second condition not needed just for sanity check at the end
+        c->SetDaughter(0,d0);
+        c->SetDaughter(1,d1);
+      } else if(d1 < 0 && d0 >= 0) 
+      {
+        // Only one daughter
+        // second condition not needed just for sanity check at the end
+        c->SetDaughter(0,IsParticleSelected(d0) ? GetNewLabel(d0) : -1);
+        c->SetDaughter(1,d1);
+      }
+      else if (d0 > 0 && d1 > 0 )
+      {
+        // we have two or more daughters loop on the stack to see if they are
+        // selected
+        Int_t d0tmp = -1;
+        Int_t d1tmp = -1;
+        for (int id = d0; id<=d1;++id)
         {
-          // we have two or more daughters loop on the stack to see if they are
-          // selected
-          Int_t d0tmp = -1;
-          Int_t d1tmp = -1;
-          for (int id = d0; id<=d1;++id)
+          if (IsParticleSelected(id))
           {
-            if (IsParticleSelected(id))
+            if(d0tmp==-1)
             {
-              if(d0tmp==-1)
-              {
-                // first time
-                d0tmp = GetNewLabel(id);
-                d1tmp = d0tmp; // this is to have the same schema as on the stack i.e. with one daugther d0 and d1 are the same 
-              }
-              else d1tmp = GetNewLabel(id);
+              // first time
+              d0tmp = GetNewLabel(id);
+              d1tmp = d0tmp; // this is to have the same schema as on the stack i.e. with one daugther d0 and d1 are the same 
             }
+            else d1tmp = GetNewLabel(id);
           }
-          c.SetDaughter(0,d0tmp);
-          c.SetDaughter(1,d1tmp);
-        } else 
-        {
-          AliError(Form("Unxpected indices %d %d",d0,d1));
         }
-        
-        if ( m < 0 )
+        c->SetDaughter(0,d0tmp);
+        c->SetDaughter(1,d1tmp);
+      } else 
+      {
+        AliError(Form("Unxpected indices %d %d",d0,d1));
+      }
+      
+      if ( m < 0 )
+      {
+        c->SetMother(m);
+      } else 
+      {
+        if (IsParticleSelected(m)) 
         {
-          c.SetMother(m);
-        } else 
+          c->SetMother(GetNewLabel(m));              
+        }
+        else 
         {
-          if (IsParticleSelected(m)) 
-          {
-            c.SetMother(GetNewLabel(m));              
-          }
-          else 
-          {
-            AliError(Form("PROBLEM Mother not selected %d", m));              
-          }
+          AliError(Form("PROBLEM Mother not selected %d", m));              
         }
-        
-        new ((*fMCParticles)[nmcout++]) AliAODMCParticle(c);
       }
-      
-      ++nmc;        
     }      
     
     // now remap the tracks...
     
-    TIter nextTrack(fTracks);
-    AliAODTrack* t;
-    
-    while ( ( t = static_cast<AliAODTrack*>(nextTrack()) ) )
+    for ( Int_t it = 0; it < ntracks; ++it )
     {
+      AliAODTrack* t = static_cast<AliAODTrack*>(fTracks->UncheckedAt(it));
       if ( t->GetLabel() >= 0 ) t->SetLabel(GetNewLabel(t->GetLabel()));
     }
     
@@ -10,9 +10,7 @@
 #ifndef ALIDAODBRANCHREPLICATOR_H
 #  include "AliAODBranchReplicator.h"
 #endif
-#ifndef ROOT_TExMap
-#  include "TExMap.h"
-#endif
+#include <vector>
 
 //
 // Implementation of a branch replicator 
@@ -50,9 +48,10 @@ public:
 private:
   void FilterMC(const AliAODEvent& source);
   void SelectParticle(Int_t i);
-  Bool_t IsParticleSelected(Int_t i);
-  void CreateLabelMap(const AliAODEvent& source);
-  Int_t GetNewLabel(Int_t i);
+  void SelectAncestors(Int_t label, const TClonesArray& mcParticles);
+  Bool_t IsParticleSelected(Int_t i) const;
+  void CreateLabelMap();
+  Int_t GetNewLabel(Int_t i) const;
   
 private:
   AliAnalysisCuts* fTrackCut; // decides which tracks to keep
@@ -70,8 +69,7 @@ private:
   mutable TClonesArray* fMCParticles; //! internal array of MC particles
   mutable AliAODMCHeader* fMCHeader; //! internal array of MC header
   Int_t fMCMode; // MC filtering switch (0=none=no mc information,1=normal=simple copy,>=2=aggressive=filter out)
-  TExMap fLabelMap; //! for MC label remapping (in case of aggressive filtering)
-  TExMap fParticleSelected; //! List of selected MC particles
+  std::vector<Int_t> fNewLabel; //! per input MC particle: -1 if not selected, else its label in the output (after CreateLabelMap)
   Bool_t fReplicateHeader; // whether or not the replicate the AOD Header
   Bool_t fReplicateTracklets; // whether or not the replicate the AOD Tracklets
   
@@ -79,7 +77,7 @@ private:
   AliAODMuonReplicator(const AliAODMuonReplicator&);
   AliAODMuonReplicator& operator=(const AliAODMuonReplicator&);
   
-  ClassDef(AliAODMuonReplicator,10) // Branch replicator for ESD to muon AOD.
+  ClassDef(AliAODMuonReplicator,11) // Branch replicator for ESD to muon AOD.
 };
 
 #endif
@@ -68,7 +68,8 @@ fCutRegistry(0x0),
 fEvent(0x0),
 fMCEvent(0x0),
 fHistogramToDisable(0x0),
-fHasMC(kFALSE)
+fHasMC(kFALSE),
+fHandles()
 {
  /// default ctor
 }
@@ -325,6 +326,18 @@ Bool_t AliAnalysisMuMuBase::ExistSemaphoreHistogram(const char* eventSelection,
   return ( HistogramCollection()->Histo(Form("/%s/%s/%s/%s",eventSelection,triggerClassName,centrality,ClassName())) != 0x0 );
 }
 
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuBase::GetHandle(const char* identifier, const char* objectName)
+{
+  /// Resolve the object identifier/objectName of the histogram collection and
+  /// return a handle to it, to be used with Histo(handle) or Prof(handle).
+  /// The handle is valid even if the object does not exist (the object is then 0x0)
+  
+  fHandles.push_back(fHistogramCollection ? fHistogramCollection->GetObject(identifier,objectName) : 0x0);
+  
+  return fHandles.size()-1;
+}
+
 //_____________________________________________________________________________
 Int_t AliAnalysisMuMuBase::GetNbins(Double_t xmin, Double_t xmax, Double_t xstep)
 {
@@ -423,6 +436,7 @@ void AliAnalysisMuMuBase::Init(AliCounterCollection& cc,
   fHistogramCollection = &hc;
   fBinning = &binning;
   fCutRegistry = &registry;
+  ClearHandles();
 }
 
 //_____________________________________________________________________________
@@ -13,6 +13,7 @@
 #include "TObject.h"
 #include "TString.h"
 #include "TProfile.h"
+#include <vector>
 
 class AliCounterCollection;
 class AliAnalysisMuMuBinning;
@@ -99,7 +100,7 @@ public:
   Bool_t AlwaysFalse(const AliVParticle& /*particle*/, const AliVParticle& /*particle*/) const { return kFALSE; }
   void NameOfAlwaysFalse(TString& name) const { name = "NONE"; }
   
-  void SetHistogramCollection(AliMergeableCollection* h) { fHistogramCollection = h; }
+  void SetHistogramCollection(AliMergeableCollection* h) { fHistogramCollection = h; ClearHandles(); }
   
 protected:
 
@@ -176,6 +177,16 @@ protected:
   TProfile* MCProf(const char* eventSelection, const char* triggerClassName, const char* cent,
                  const char* what, const char* histoname);
 
+  /** Handles to the objects of the histogram collection, to be resolved once (e.g. when the
+   * histograms of a path are first needed) and used on the fill path instead of the string
+   * identifiers. A handle stays valid until the histogram collection is changed.
+   */
+  Int_t GetHandle(const char* identifier, const char* objectName);
+  TH1* Histo(Int_t handle) const { return static_cast<TH1*>(HandleObject(handle)); }
+  TProfile* Prof(Int_t handle) const { return static_cast<TProfile*>(HandleObject(handle)); }
+  TObject* HandleObject(Int_t handle) const { return ( handle >= 0 && handle < (Int_t)fHandles.size() ) ? fHandles[handle] : 0x0; }
+  virtual void ClearHandles() { fHandles.clear(); }
+
   Int_t GetNbins(Double_t xmin, Double_t xmax, Double_t xstep);
 
   AliCounterCollection* CounterCollection() const { return fEventCounters; }
@@ -198,8 +209,9 @@ private:
   AliMCEvent* fMCEvent; //! current MC event
   TList* fHistogramToDisable; // list of regexp of histo name to disable
   Bool_t fHasMC; // whether or not we're dealing with MC data
+  std::vector<TObject*> fHandles; //! objects of the histogram collection, indexed by handle
   
-  ClassDef(AliAnalysisMuMuBase,1) // base class for a companion class to AliAnalysisMuMu
+  ClassDef(AliAnalysisMuMuBase,2) // base class for a companion class to AliAnalysisMuMu
 };
 
 #endif
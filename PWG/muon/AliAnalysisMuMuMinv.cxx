@@ -48,7 +48,9 @@ fmcptcutmax(12.0),
 fPtFuncOld(0x0),
 fPtFuncNew(0x0),
 fYFuncOld(0x0),
-fYFuncNew(0x0)
+fYFuncNew(0x0),
+fPairHandleOffsets(),
+fPairHandles()
 {
   // FIXME ? find the AccxEff histogram from HistogramCollection()->Histo("/EXCHANGE/JpsiAccEff")
 
@@ -243,7 +245,7 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
   AliVParticle               * mcTrackj(0x0);
   TLorentzVector             * pair4MomentumMC(0x0);
   Double_t inputWeightMC(1.);
-  AliMergeableCollectionProxy* mcProxy(0x0);
+  Int_t mcOffset(-1);
 
   // Make sure we have an associated tracks in simulation stack if running on MC
   if(HasMC()){
@@ -273,8 +275,8 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     AliMCParticle* mother = static_cast<AliMCParticle*>(MCEvent()->GetTrack(currMotheri));
     if(mother->PdgCode() !=443) return;
 
-    // Create proxy for MC
-    mcProxy = HistogramCollection()->CreateProxy(BuildMCPath(eventSelection,triggerClassName,centrality,pairCutName));
+    // Get the handles of the MC histograms
+    mcOffset = GetPairHandles(BuildMCPath(eventSelection,triggerClassName,centrality,pairCutName));
     TLorentzVector mcpi(mcTracki->Px(),mcTracki->Py(),mcTracki->Pz(),TMath::Sqrt(AliAnalysisMuonUtility::MuonMass2()+mcTracki->P()*mcTracki->P()));
     TLorentzVector mcpj(mcTrackj->Px(),mcTrackj->Py(),mcTrackj->Pz(),TMath::Sqrt(AliAnalysisMuonUtility::MuonMass2()+mcTrackj->P()*mcTrackj->P()));
     mcpj+=mcpi;
@@ -291,8 +293,9 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
                                TMath::Sqrt(AliAnalysisMuonUtility::MuonMass2()+trackj.P()*trackj.P()));
   pair4Momentum += pi;
 
-  // Create proxy in AliMergeableCollection
-  AliMergeableCollectionProxy* proxy = HistogramCollection()->CreateProxy(BuildPath(eventSelection,triggerClassName,centrality,pairCutName));
+  // Get the handles of the histograms in AliMergeableCollection
+  const Int_t* handles = &fPairHandles[GetPairHandles(BuildPath(eventSelection,triggerClassName,centrality,pairCutName))];
+  const Int_t* mcHandles = ( mcOffset >= 0 ) ? &fPairHandles[mcOffset] : 0x0;
 
   // Weight tracks if specified
   Double_t inputWeight=0.;
@@ -300,12 +303,12 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
   else if(fWeightMuon)  inputWeight = WeightMuonDistribution(tracki.Pt()) * WeightMuonDistribution(trackj.Pt());
 
   // Fill some distribution histos
-  if ( !IsHistogramDisabled("Pt") )  proxy->Histo("Pt")->Fill(pair4Momentum.Pt(),inputWeight);
-  if ( !IsHistogramDisabled("Y") )   proxy->Histo("Y")->Fill(pair4Momentum.Rapidity(),inputWeight);
-  if ( !IsHistogramDisabled("Eta") ) proxy->Histo("Eta")->Fill(pair4Momentum.Eta());
-  if ( !IsHistogramDisabled("PtPaireVsPtTrack") ) {
-    static_cast<TH2*>( proxy->Histo("PtPaireVsPtTrack"))->Fill(pair4Momentum.Pt(),tracki.Pt(),inputWeight);
-    static_cast<TH2*>( proxy->Histo("PtPaireVsPtTrack"))->Fill(pair4Momentum.Pt(),trackj.Pt(),inputWeight);
+  if ( handles[kPt] >= 0 )  Histo(handles[kPt])->Fill(pair4Momentum.Pt(),inputWeight);
+  if ( handles[kY] >= 0 )   Histo(handles[kY])->Fill(pair4Momentum.Rapidity(),inputWeight);
+  if ( handles[kEta] >= 0 ) Histo(handles[kEta])->Fill(pair4Momentum.Eta());
+  if ( handles[kPtPaireVsPtTrack] >= 0 ) {
+    static_cast<TH2*>( Histo(handles[kPtPaireVsPtTrack]))->Fill(pair4Momentum.Pt(),tracki.Pt(),inputWeight);
+    static_cast<TH2*>( Histo(handles[kPtPaireVsPtTrack]))->Fill(pair4Momentum.Pt(),trackj.Pt(),inputWeight);
   }
 
   // Fill histos with MC stack info
@@ -316,10 +319,10 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     mcpj+=mcpi;
 
     // Fill histo
-    proxy->Histo("PtRecVsSim")->Fill(mcpj.Pt(),pair4Momentum.Pt());
-    if ( !IsHistogramDisabled("Pt") )  mcProxy->Histo("Pt")->Fill(mcpj.Pt(),inputWeightMC);
-    if ( !IsHistogramDisabled("Y") )   mcProxy->Histo("Y")->Fill(mcpj.Rapidity(),inputWeightMC);
-    if ( !IsHistogramDisabled("Eta") ) mcProxy->Histo("Eta")->Fill(mcpj.Eta());
+    Histo(handles[kPtRecVsSim])->Fill(mcpj.Pt(),pair4Momentum.Pt());
+    if ( mcHandles[kPt] >= 0 )  Histo(mcHandles[kPt])->Fill(mcpj.Pt(),inputWeightMC);
+    if ( mcHandles[kY] >= 0 )   Histo(mcHandles[kY])->Fill(mcpj.Rapidity(),inputWeightMC);
+    if ( mcHandles[kEta] >= 0 ) Histo(mcHandles[kEta])->Fill(mcpj.Eta());
 
     // set pair4MomentumMC for the rest of the function
     pair4MomentumMC = &mcpj;
@@ -327,10 +330,13 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
 
   TIter nextBin(fBinsToFill);
   AliAnalysisMuMuBinning::Range* r;
+  Int_t ibin(-1);
 
   // Loop over all bin ranges
   while ( ( r = static_cast<AliAnalysisMuMuBinning::Range*>(nextBin()) ) ){
 
+    ++ibin;
+
     //In this loop we first check if the pairs pass some tests and we fill histo accordingly.
 
     // Flag for cuts and ranges
@@ -348,7 +354,7 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
       // Fill NchForJpsi histo
       if ( pair4Momentum.M() >= 2.9 && pair4Momentum.M() <= 3.3 ){
 
-        h = proxy->Histo("NchForJpsi");
+        h = Histo(handles[kNchForJpsi]);
 
         Double_t ntrcorr = (-1.);
         TList* list = static_cast<TList*>(Event()->FindListObject("NCH"));
@@ -372,7 +378,7 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
       }
       else if ( pair4Momentum.M() >= 3.6 && pair4Momentum.M() <= 3.9){
 
-        h = proxy->Histo("NchForPsiP");
+        h = Histo(handles[kNchForPsiP]);
         Double_t ntrcorr = (-1.);
 
         TList* list = static_cast<TList*>(Event()->FindListObject("NCH"));
@@ -573,41 +579,39 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
     // Check if pair pass all conditions, either MC or not, and fill Minv Histogrames
     if ( ok || okMC ){
 
-      // Get Minv histo name associated to the bin
-      TString minvName = GetMinvHistoName(*r,kFALSE);
+      // Get Minv histo handles associated to the bin
+      const Int_t* binHandles = handles + kNPairHistos + kNBinHistos*ibin;
+      const Int_t* mcBinHandles = mcHandles ? mcHandles + kNPairHistos + kNBinHistos*ibin : 0x0;
 
       //Create, fill and store Minv histo
-      if (!IsHistogramDisabled(minvName.Data())){
+      if ( binHandles[kMinv] >= 0 ){
 
         TH1* h(0x0);
 
         if ( ok ){
-          h = proxy->Histo(minvName.Data());
-          if (!h) AliError(Form("Could not get %s",minvName.Data()));
+          h = Histo(binHandles[kMinv]);
+          if (!h) AliError(Form("Could not get %s",GetMinvHistoName(*r,kFALSE).Data()));
           else h->Fill(pair4Momentum.M(),inputWeight);
         }
 
         if( okMC ){
-          h = mcProxy->Histo(minvName.Data());
-          if (!h) AliError(Form("Could not get MC %s",minvName.Data()));
+          h = Histo(mcBinHandles[kMinv]);
+          if (!h) AliError(Form("Could not get MC %s",GetMinvHistoName(*r,kFALSE).Data()));
           else h->Fill(pair4MomentumMC->M(),inputWeightMC);
         }
 
         // Fill Mean pT
         if ( fcomputeMeanPt ){
-          TString hprofName("");
 
           if ( ok ){
-            hprofName= Form("MeanPtVs%s",minvName.Data());
-            TProfile* hprof = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-            if ( !hprof )AliError(Form("Could not get %s",hprofName.Data()));
+            TProfile* hprof = Prof(binHandles[kMeanPt]);
+            if ( !hprof )AliError(Form("Could not get MeanPtVs%s",GetMinvHistoName(*r,kFALSE).Data()));
             else hprof->Fill(pair4Momentum.M(),pair4Momentum.Pt(),inputWeight);
           }
 
           if ( okMC ){
-            hprofName= Form("MeanPtVs%s",minvName.Data());
-            TProfile* hprof = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofName.Data());
-            if ( !hprof )AliError(Form("Could not get MC %s",hprofName.Data()));
+            TProfile* hprof = Prof(mcBinHandles[kMeanPt]);
+            if ( !hprof )AliError(Form("Could not get MC MeanPtVs%s",GetMinvHistoName(*r,kFALSE).Data()));
             else hprof->Fill(pair4MomentumMC->M(),pair4MomentumMC->Pt(),inputWeightMC);
           }
         }
@@ -636,38 +640,31 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
           else okAccEffMC = kTRUE;
         }
 
-        // Get histo name
-        minvName = GetMinvHistoName(*r,kTRUE);
-
         // fill histo
-        if (!IsHistogramDisabled(minvName.Data())){
+        if ( binHandles[kMinvCorr] >= 0 ){
 
-          TH1* hCorr = proxy->Histo(minvName.Data());
+          TH1* hCorr = Histo(binHandles[kMinvCorr]);
 
-          if (!hCorr) AliError(Form("Could not get %sr",minvName.Data()));
+          if (!hCorr) AliError(Form("Could not get %sr",GetMinvHistoName(*r,kTRUE).Data()));
           else if ( okAccEff ) hCorr->Fill(pair4Momentum.M(),inputWeight/AccxEff);
 
           if( okAccEffMC ){
-            hCorr = mcProxy->Histo(minvName.Data());
-            if (!hCorr) AliError(Form("Could not get MC %s",minvName.Data()));
+            hCorr = Histo(mcBinHandles[kMinvCorr]);
+            if (!hCorr) AliError(Form("Could not get MC %s",GetMinvHistoName(*r,kTRUE).Data()));
             else hCorr->Fill(pair4MomentumMC->M(),inputWeightMC/AccxEffMC);
           }
 
           if ( fcomputeMeanPt ){
 
-            TString hprofCorrName("");
-
             if( ok ){
-              hprofCorrName = Form("MeanPtVs%s",minvName.Data());
-              TProfile* hprofCorr = Prof(eventSelection,triggerClassName,centrality,pairCutName,hprofCorrName.Data());
-              if ( !hprofCorr ) AliError(Form("Could not get %s",hprofCorrName.Data()));
+              TProfile* hprofCorr = Prof(binHandles[kMeanPtCorr]);
+              if ( !hprofCorr ) AliError(Form("Could not get MeanPtVs%s",GetMinvHistoName(*r,kTRUE).Data()));
               else if ( okAccEff ) hprofCorr->Fill(pair4Momentum.M(),pair4Momentum.Pt(),inputWeight/AccxEff);
             }
 
             if( okMC ){
-              hprofCorrName = Form("MeanPtVs%s",minvName.Data());
-              TProfile* hprofCorr = MCProf(eventSelection,triggerClassName,centrality,pairCutName,hprofCorrName.Data());
-              if ( !hprofCorr ) AliError(Form("Could not get MC %s",hprofCorrName.Data()));
+              TProfile* hprofCorr = Prof(mcBinHandles[kMeanPtCorr]);
+              if ( !hprofCorr ) AliError(Form("Could not get MC MeanPtVs%s",GetMinvHistoName(*r,kTRUE).Data()));
               else if ( okAccEffMC )hprofCorr->Fill(pair4MomentumMC->M(),pair4MomentumMC->Pt(),inputWeightMC/AccxEffMC);
             }
           }
@@ -675,8 +672,63 @@ void AliAnalysisMuMuMinv::FillHistosForPair(const char* eventSelection,
       }
     }
   }
-  delete proxy;
-  delete mcProxy;
+}
+
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuMinv::GetPairHandles(const TString& path)
+{
+  /// Return the offset in fPairHandles of the handles of the pair histograms of path,
+  /// in the EPairHisto order followed by the EBinHisto ones for each bin to fill.
+  /// The histogram names are resolved the first time the path is used, the handle
+  /// of a disabled histogram is -1.
+
+  std::map<std::string,Int_t>::const_iterator it = fPairHandleOffsets.find(path.Data());
+  if ( it != fPairHandleOffsets.end() ) return it->second;
+
+  Int_t offset = fPairHandles.size();
+
+  const char* names[kNPairHistos] = { "Pt", "Y", "Eta", "PtPaireVsPtTrack", "PtRecVsSim", "NchForJpsi", "NchForPsiP" };
+
+  for ( Int_t i = 0; i < kNPairHistos; ++i )
+  {
+    fPairHandles.push_back( IsHistogramDisabled(names[i]) ? -1 : GetHandle(path.Data(),names[i]) );
+  }
+
+  TIter next(fBinsToFill);
+  AliAnalysisMuMuBinning::Range* r;
+
+  while ( ( r = static_cast<AliAnalysisMuMuBinning::Range*>(next()) ) )
+  {
+    TString minvName(GetMinvHistoName(*r,kFALSE));
+    Bool_t disabled = IsHistogramDisabled(minvName.Data());
+
+    fPairHandles.push_back( disabled ? -1 : GetHandle(path.Data(),minvName.Data()) );
+    fPairHandles.push_back( ( disabled || !fcomputeMeanPt ) ? -1 : GetHandle(path.Data(),Form("MeanPtVs%s",minvName.Data())) );
+
+    disabled = kTRUE;
+    if ( ShouldCorrectDimuonForAccEff() )
+    {
+      minvName = GetMinvHistoName(*r,kTRUE);
+      disabled = IsHistogramDisabled(minvName.Data());
+    }
+
+    fPairHandles.push_back( disabled ? -1 : GetHandle(path.Data(),minvName.Data()) );
+    fPairHandles.push_back( ( disabled || !fcomputeMeanPt ) ? -1 : GetHandle(path.Data(),Form("MeanPtVs%s",minvName.Data())) );
+  }
+
+  fPairHandleOffsets[path.Data()] = offset;
+
+  return offset;
+}
+
+//_____________________________________________________________________________
+void AliAnalysisMuMuMinv::ClearHandles()
+{
+  /// Forget the handles of the pair histograms, e.g. when the histogram collection changes
+
+  AliAnalysisMuMuBase::ClearHandles();
+  fPairHandleOffsets.clear();
+  fPairHandles.clear();
 }
 
 
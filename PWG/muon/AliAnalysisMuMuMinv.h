@@ -12,6 +12,9 @@
 #include "AliAnalysisMuMuBinning.h"
 #include "TString.h"
 #include "TH2.h"
+#include <map>
+#include <string>
+#include <vector>
 
 class TH2F;
 class AliVParticle;
@@ -68,8 +71,17 @@ protected:
 
   void FillHistosForMCEvent(const char* eventSelection,const char* triggerClassName,const char* centrality);
 
+  virtual void ClearHandles();
+
 private:
 
+  /// Histograms of a pair path, in the order of the handles returned by GetPairHandles
+  enum EPairHisto { kPt, kY, kEta, kPtPaireVsPtTrack, kPtRecVsSim, kNchForJpsi, kNchForPsiP, kNPairHistos };
+  /// Histograms of each bin to fill, following the kNPairHistos ones
+  enum EBinHisto { kMinv, kMeanPt, kMinvCorr, kMeanPtCorr, kNBinHistos };
+
+  Int_t GetPairHandles(const TString& path);
+
   void CreateMinvHistograms(const char* eventSelection, const char* triggerClassName, const char* centrality);
 
   // normalize the function to its integral in the given range
@@ -105,8 +117,10 @@ private:
   Double_t fMinvMax;
   Double_t fmcptcutmin;
   Double_t fmcptcutmax;
+  std::map<std::string,Int_t> fPairHandleOffsets; //! offset in fPairHandles of the handles of a pair path
+  std::vector<Int_t> fPairHandles; //! handles of the pair histograms (-1 if disabled), see GetPairHandles
 
-  ClassDef(AliAnalysisMuMuMinv,8) // implementation of AliAnalysisMuMuBase for muon pairs
+  ClassDef(AliAnalysisMuMuMinv,9) // implementation of AliAnalysisMuMuBase for muon pairs
 };
 
 #endif
@@ -82,7 +82,11 @@ fbinWhat(""),
 fbinQuantity(""),
 fbinFlavor(""),
 fDisableHistoLoop(kFALSE),
-fLegacyCentrality(kFALSE)
+fLegacyCentrality(kFALSE),
+fCutResultsDone(kFALSE),
+fMuonTracks(),
+fTrackCutResults(),
+fPairCutResults()
 {
   /// Constructor with a predefined list of triggers to consider
   /// Note that we take ownership of cutRegister
@@ -291,14 +295,18 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
   // prepare iterators
   TIter nextAnalysis(fSubAnalysisVector);
   AliAnalysisMuMuBase* analysis;
-  TIter nextTrackCut(fCutRegistry->GetCutCombinations(AliAnalysisMuMuCutElement::kTrack));
-  TIter nextPairCut(fCutRegistry->GetCutCombinations(AliAnalysisMuMuCutElement::kTrackPair));
-  
-  // Get number of tracks
-  Int_t nTracks = AliAnalysisMuonUtility::GetNTracks(Event());
+  const TObjArray* trackCuts = fCutRegistry->GetCutCombinations(AliAnalysisMuMuCutElement::kTrack);
+  const TObjArray* pairCuts = fCutRegistry->GetCutCombinations(AliAnalysisMuMuCutElement::kTrackPair);
+  const Int_t nTrackCuts = trackCuts ? trackCuts->GetEntriesFast() : 0;
+  const Int_t nPairCuts = pairCuts ? pairCuts->GetEntriesFast() : 0;
   
   // The main part, loop over subanalysis and fill histo
   if ( !IsHistogrammingDisabled() && !fDisableHistoLoop ){
+    
+    // the cut results do not depend on the event selection, trigger, centrality or sub-analysis
+    ComputeCutResults();
+    const Int_t nMuons = fMuonTracks.size();
+    
     while ( ( analysis = static_cast<AliAnalysisMuMuBase*>(nextAnalysis()) ) ){
       
       // Create proxy for the Histogram collections
@@ -312,41 +320,31 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
       AliCodeTimerAuto(Form("%s (FillHistosForEvent)",analysis->ClassName()),1);
       analysis->FillHistosForEvent(eventSelection,triggerClassName,centrality); // Implemented in AliAnalysisMuMuNch at the moment
       
-      // Loop on all event tracks 
-      for (Int_t i = 0; i < nTracks; ++i){
+      // Loop on all event muon tracks 
+      Int_t ipair = 0;
+      for (Int_t i = 0; i < nMuons; ++i){
 
         // Get track
-        AliVParticle* tracki = AliAnalysisMuonUtility::GetTrack(i,Event());
-       if (!AliAnalysisMuonUtility::IsMuonTrack(tracki) ) continue;
-        
-        nextTrackCut.Reset();
-        AliAnalysisMuMuCutCombination* trackCut;
+        AliVParticle* tracki = AliAnalysisMuonUtility::GetTrack(fMuonTracks[i],Event());
         
         // Loop on all track selections and fill histos for track that pass it
-        while ( ( trackCut = static_cast<AliAnalysisMuMuCutCombination*>(nextTrackCut()) ) ){
-          if ( trackCut->Pass(*tracki) ){
+        for (Int_t icut = 0; icut < nTrackCuts; ++icut){
+          if ( fTrackCutResults[i*nTrackCuts+icut] ){
+            AliAnalysisMuMuCutCombination* trackCut = static_cast<AliAnalysisMuMuCutCombination*>(trackCuts->UncheckedAt(icut));
             AliCodeTimerAuto(Form("%s (FillHistosForTrack)",analysis->ClassName()),2);
             analysis->FillHistosForTrack(eventSelection,triggerClassName,centrality,trackCut->GetName(),*tracki);
           }
         }
                 
         // loop on track pairs (here we only consider muon pairs)
-        for (Int_t j = i+1; j < nTracks; ++j){
+        for (Int_t j = i+1; j < nMuons; ++j, ++ipair){
           // Get track
-          AliVParticle* trackj = AliAnalysisMuonUtility::GetTrack(j,Event());
-          if (!AliAnalysisMuonUtility::IsMuonTrack(trackj) ) continue;
+          AliVParticle* trackj = AliAnalysisMuonUtility::GetTrack(fMuonTracks[j],Event());
           
-          nextPairCut.Reset();
-          AliAnalysisMuMuCutCombination* pairCut;
-
           // Fill pair histo
-          while ( ( pairCut = static_cast<AliAnalysisMuMuCutCombination*>(nextPairCut()) ) ){
-            // Weither or not the pairs pass the tests
-            Bool_t testi = (pairCut->IsTrackCutter()) ? pairCut->Pass(*tracki) : kTRUE;
-            Bool_t testj = (pairCut->IsTrackCutter()) ? pairCut->Pass(*trackj) : kTRUE;
-            Bool_t testij = pairCut->Pass(*tracki,*trackj);
-            
-            if ( ( testi && testj ) && testij ){
+          for (Int_t icut = 0; icut < nPairCuts; ++icut){
+            if ( fPairCutResults[ipair*nPairCuts+icut] ){
+              AliAnalysisMuMuCutCombination* pairCut = static_cast<AliAnalysisMuMuCutCombination*>(pairCuts->UncheckedAt(icut));
               AliCodeTimerAuto(Form("%s (FillHistosForPair)",analysis->ClassName()),3);
               analysis->FillHistosForPair(eventSelection,triggerClassName,centrality,pairCut->GetName(),*tracki,*trackj);
             }
@@ -357,6 +355,60 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
   }
 }
 
+//_____________________________________________________________________________
+void AliAnalysisTaskMuMu::ComputeCutResults()
+{
+  /// Evaluate the track and pair cut combinations once per event, for all
+  /// the muon tracks and muon pairs of the event
+  
+  if ( fCutResultsDone ) return;
+  
+  AliCodeTimerAuto("",0);
+  
+  const TObjArray* trackCuts = fCutRegistry->GetCutCombinations(AliAnalysisMuMuCutElement::kTrack);
+  const TObjArray* pairCuts = fCutRegistry->GetCutCombinations(AliAnalysisMuMuCutElement::kTrackPair);
+  const Int_t nTrackCuts = trackCuts ? trackCuts->GetEntriesFast() : 0;
+  const Int_t nPairCuts = pairCuts ? pairCuts->GetEntriesFast() : 0;
+  
+  fMuonTracks.clear();
+  Int_t nTracks = AliAnalysisMuonUtility::GetNTracks(Event());
+  for (Int_t i = 0; i < nTracks; ++i){
+    if ( AliAnalysisMuonUtility::IsMuonTrack(AliAnalysisMuonUtility::GetTrack(i,Event())) ) fMuonTracks.push_back(i);
+  }
+  const Int_t nMuons = fMuonTracks.size();
+  
+  // track cuts, and the single track part of the pair cuts
+  fTrackCutResults.assign(nMuons*nTrackCuts,0);
+  std::vector<UChar_t> pairTrackResults(nMuons*nPairCuts,1);
+  for (Int_t i = 0; i < nMuons; ++i){
+    AliVParticle* track = AliAnalysisMuonUtility::GetTrack(fMuonTracks[i],Event());
+    for (Int_t icut = 0; icut < nTrackCuts; ++icut){
+      fTrackCutResults[i*nTrackCuts+icut] = static_cast<AliAnalysisMuMuCutCombination*>(trackCuts->UncheckedAt(icut))->Pass(*track);
+    }
+    for (Int_t icut = 0; icut < nPairCuts; ++icut){
+      AliAnalysisMuMuCutCombination* pairCut = static_cast<AliAnalysisMuMuCutCombination*>(pairCuts->UncheckedAt(icut));
+      if ( pairCut->IsTrackCutter() ) pairTrackResults[i*nPairCuts+icut] = pairCut->Pass(*track);
+    }
+  }
+  
+  // pair cuts, for the pairs (i,j>i) in the order of the filling loop
+  fPairCutResults.assign(nMuons*(nMuons-1)/2*nPairCuts,0);
+  Int_t ipair = 0;
+  for (Int_t i = 0; i < nMuons; ++i){
+    AliVParticle* tracki = AliAnalysisMuonUtility::GetTrack(fMuonTracks[i],Event());
+    for (Int_t j = i+1; j < nMuons; ++j, ++ipair){
+      AliVParticle* trackj = AliAnalysisMuonUtility::GetTrack(fMuonTracks[j],Event());
+      for (Int_t icut = 0; icut < nPairCuts; ++icut){
+        if ( !pairTrackResults[i*nPairCuts+icut] || !pairTrackResults[j*nPairCuts+icut] ) continue;
+        AliAnalysisMuMuCutCombination* pairCut = static_cast<AliAnalysisMuMuCutCombination*>(pairCuts->UncheckedAt(icut));
+        fPairCutResults[ipair*nPairCuts+icut] = pairCut->Pass(*tracki,*trackj);
+      }
+    }
+  }
+  
+  fCutResultsDone = kTRUE;
+}
+
 //_____________________________________________________________________________
 void AliAnalysisTaskMuMu::FillCounters(const char* eventSelection, const char* triggerClassName, const char* centrality, Int_t currentRun)
 {
@@ -613,6 +665,8 @@ void AliAnalysisTaskMuMu::UserExec(Option_t* /*opt*/)
   
   Binning(); // insure we have a binning...
   
+  fCutResultsDone = kFALSE; // new event
+  
   TIter nextAnalysis(fSubAnalysisVector);
   AliAnalysisMuMuBase* analysis;  
 
@@ -33,6 +33,8 @@
 #  include "TMath.h"
 #endif
 
+#include <vector>
+
 class AliAnalysisMuMuBinning;
 class AliCounterCollection;
 class AliMergeableCollection;
@@ -96,6 +98,8 @@ private:
   AliVEvent* Event() const;
   
   void FillHistos(const char* eventSelection, const char* triggerClassName, const char* centrality);
+
+  void ComputeCutResults();
   
   void FillCounters(const char* eventSelection, const char* triggerClassName, const char* centrality, Int_t currentRun);
   
@@ -146,8 +150,15 @@ private:
   Bool_t fDisableHistoLoop; //Flag to not enter in the Filling histos Loop without disabling the histogramming (neccesary to have dNhcdEta event info avaliable)
 
   Bool_t fLegacyCentrality; // use old centrality framework
+
+  // Track and pair cut results of the current event, shared by all the
+  // (event selection, trigger, centrality) combinations and sub-analysis
+  Bool_t fCutResultsDone; //! cut results below are up to date for the current event
+  std::vector<Int_t> fMuonTracks; //! indices of the muon tracks of the event
+  std::vector<UChar_t> fTrackCutResults; //! [imuon*ntrackcuts+icut] track passes the track cut combination
+  std::vector<UChar_t> fPairCutResults; //! [ipair*npaircuts+icut] pair passes the pair cut combination
   
-  ClassDef(AliAnalysisTaskMuMu,28) // a class to analyse muon pairs (and single also ;-) )
+  ClassDef(AliAnalysisTaskMuMu,29) // a class to analyse muon pairs (and single also ;-) )
 };
 
 #endif
@@ -285,14 +285,20 @@ UInt_t AliMuonTrackCuts::GetSelectionMask( const TObject* obj )
 
   if ( AliAnalysisMuonUtility::GetChi2perNDFtracker(track) < fOADBParam.GetChi2NormCut() ) selectionMask |= kMuTrackChiSquare;
 
+  // The absorber region is evaluated once per track
+  // (same as IsThetaAbs23, used in GetAverageMomentum)
+  Bool_t isThetaAbs23 = ( thetaAbsEndDeg < 3. );
+
   TVector3 dcaAtVz = GetCorrectedDCA(track);
-  Double_t pTotMean = GetAverageMomentum(track);
 
-  Double_t pDca = pTotMean * dcaAtVz.Mag();
-    
   Double_t pTot = track->P();
+  Double_t pTotMean = 0.;
+  if ( ! AliAnalysisMuonUtility::IsAODTrack(track) ) pTotMean = ((AliESDMuonTrack*)track)->PUncorrected(); // Increased stability if using uncorrected value
+  else pTotMean = pTot - ( isThetaAbs23 ? fOADBParam.GetMeanPCorr23() : fOADBParam.GetMeanPCorr310() );
+
+  Double_t pDca = pTotMean * dcaAtVz.Mag();
   
-  Double_t sigmaPdca = IsThetaAbs23(track) ? fOADBParam.GetSigmaPdca23() : fOADBParam.GetSigmaPdca310();
+  Double_t sigmaPdca = isThetaAbs23 ? fOADBParam.GetSigmaPdca23() : fOADBParam.GetSigmaPdca310();
   
   // Momentum resolution only
   // The cut depends on the momentum resolution. In particular:
@@ -21,6 +21,7 @@
 #include "TMath.h"
 #include "TRandom3.h"
 #include "TDatabasePDG.h"
+#include "TROOT.h"
 
 #include "AliLog.h"
 //#include "AliVParticle.h"
@@ -48,7 +49,7 @@ fZB310(0.),
 fMuMass(0.),
 fTuneKalman(0),
 fCrystalBallTails(),
-fCrystalBall(NULL),
+fCrystalBall(),
 fRecoCharge(0.),
 fRecoTrack()
 //,
@@ -74,7 +75,7 @@ fZB310(4.46),
 fMuMass(TDatabasePDG::Instance()->GetParticle("mu-")->Mass()),
 fTuneKalman(kFALSE),
 fCrystalBallTails(),
-fCrystalBall(NULL),
+fCrystalBall(),
 fRecoCharge(0.),
 fRecoTrack()
 //,
@@ -88,7 +89,7 @@ fRecoTrack()
 AliMuonTrackSmearing::~AliMuonTrackSmearing()
 {
   /// Dtr
-  delete fCrystalBall;
+  for ( UInt_t ifunc=0; ifunc<fCrystalBall.size(); ifunc++ ) delete fCrystalBall[ifunc];
 //  ClearRecoTrackList();
 }
 
@@ -402,14 +403,36 @@ Double_t AliMuonTrackSmearing::GenRndBreitWigner ( Double_t mean, Double_t sigma
 Double_t AliMuonTrackSmearing::GenRndCrystalBall ( Double_t mean, Double_t sigma, Double_t tail1, Double_t tail2, Double_t max )
 {
   /// generate a random number following a Crystal Ball distribution in the range mean +- max
-  if ( ! fCrystalBall ) {
-    fCrystalBall = new TF1("CrystalBall2", this, &AliMuonTrackSmearing::CrystalBallSymmetric, -2., 2., 5, "AliMuonTrackSmearing", "CrystalBallSymmetric");
-    fCrystalBall->SetNpx(1000);
+  /// The number is generated in units of sigma: the shape then only depends on the tails
+  /// and on max/sigma, which are fixed for each resolution of the configuration.
+  /// One function is kept for each of them, so that its integral (the inverse CDF table
+  /// used by TF1::GetRandom) is computed once instead of at each call
+  Double_t range = max / sigma;
+  TF1* crystalBall = 0x0;
+  for ( UInt_t ifunc=0; ifunc<fCrystalBall.size(); ifunc++ ) {
+    TF1* func = fCrystalBall[ifunc];
+    if ( func->GetParameter(3) == tail1 && func->GetParameter(4) == tail2 && TMath::Abs(func->GetXmax()-range) <= 1.e-9*range ) {
+      crystalBall = func;
+      break;
+    }
+  }
+
+  if ( ! crystalBall && fCrystalBall.size() >= 20 ) {
+    // The range is not fixed for this configuration: recompute the last function
+    crystalBall = fCrystalBall.back();
+    crystalBall->SetParameters(1.,0.,1.,tail1,tail2);
+    crystalBall->SetRange(-range,range);
+  }
+  else if ( ! crystalBall ) {
+    crystalBall = new TF1(Form("CrystalBall2_%i",(Int_t)fCrystalBall.size()), this, &AliMuonTrackSmearing::CrystalBallSymmetric, -range, range, 5, "AliMuonTrackSmearing", "CrystalBallSymmetric");
+    // Owned by this class: avoid that another function with the same name replaces it
+    gROOT->GetListOfFunctions()->Remove(crystalBall);
+    crystalBall->SetNpx(1000);
+    crystalBall->SetParameters(1.,0.,1.,tail1,tail2);
+    fCrystalBall.push_back(crystalBall);
   }
 
-  fCrystalBall->SetParameters(1.,mean,sigma,tail1,tail2);
-  fCrystalBall->SetRange(mean-max,mean+max);
-  return fCrystalBall->GetRandom();
+  return mean + sigma * crystalBall->GetRandom();
 }
 
 
@@ -95,13 +95,13 @@ private:
   Double_t fMuMass; ///< muon mass
   Bool_t fTuneKalman; ///< tune the parameterization of MCS and energy loss to fit the momentum and angular resolution given by: kTRUE:  the Kalman filter ; kFALSE: the performance task
   std::vector<Double_t> fCrystalBallTails; ///< Tail parameters of Crystal ball functions
-  TF1* fCrystalBall; //!<! Crystal Ball function
+  std::vector<TF1*> fCrystalBall; //!<! Crystal Ball functions in units of sigma, one per set of tails and range
   Double_t fRecoCharge; //!<! Reconstructed track charge
   TLorentzVector fRecoTrack; //!<! Reconstructed track from cluster resolution
 //  std::vector<AliVParticle*> fRecoTrackList; //!<! Bookkeeping of produced tracks
 
 
-  ClassDef(AliMuonTrackSmearing, 1); // Trigger chamber efficiencies
+  ClassDef(AliMuonTrackSmearing, 2); // Trigger chamber efficiencies
   /// \endcond
 };
 
@@ -44,7 +44,10 @@ fPhysSelBits(0x0),
 fTriggerClasses(0x0),
 fComboType(0),
 fTrigPtMatchLevel(0),
-fIsDimuTrig(0)
+fIsDimuTrig(0),
+fNClassRegexps(-1),
+fClassRegexps(0x0),
+fPatternRegexp(0x0)
 {
   /// Defult ctr.
 }
@@ -59,7 +62,10 @@ fPhysSelBits(0x0),
 fTriggerClasses(0x0),
 fComboType(0),
 fTrigPtMatchLevel(0),
-fIsDimuTrig(0)
+fIsDimuTrig(0),
+fNClassRegexps(-1),
+fClassRegexps(0x0),
+fPatternRegexp(0x0)
 {
   /// Ctr
 
@@ -219,6 +225,9 @@ AliMuonTriggerCombo::~AliMuonTriggerCombo ()
   delete fL2Inputs;
   delete fPhysSelBits;
   delete fTriggerClasses;
+  for ( Int_t ire=0; ire<fNClassRegexps; ire++ ) delete fClassRegexps[ire];
+  delete [] fClassRegexps;
+  delete fPatternRegexp;
 }
 
 //________________________________________________________________________
@@ -312,49 +321,65 @@ Bool_t AliMuonTriggerCombo::CheckElement ( TString& formula, const TObjString* e
   return stopCheck;
 }
 
+//________________________________________________________________________
+void AliMuonTriggerCombo::CompileRegexps ()
+{
+  /// Compile the regular expressions of the trigger classes once,
+  /// instead of in every event.
+  /// They are transient, the ones of a streamed or cloned combination are compiled at first use
+  fNClassRegexps = 0;
+  if ( ! fTriggerClasses ) return;
+  if ( fComboType == kMatchPattern || fComboType == kRejectPattern ) {
+    fPatternRegexp = new TRegexp(fTriggerClasses->At(0)->GetName(),kTRUE);
+    return;
+  }
+  fNClassRegexps = fTriggerClasses->GetEntriesFast();
+  fClassRegexps = new TPRegexp*[fNClassRegexps];
+  for ( Int_t ire=0; ire<fNClassRegexps; ire++ ) {
+    fClassRegexps[ire] = new TPRegexp(Form("(^|[ ])%s([ ]|$)",fTriggerClasses->At(ire)->GetName()));
+  }
+}
+
 //________________________________________________________________________
 Bool_t AliMuonTriggerCombo::MatchEvent ( const TString& firedTriggerClasses, UInt_t l0Inputs, UInt_t l1Inputs, UInt_t l2Inputs, UInt_t physicsSelection )
 {
   /// Check if current event satisfies the trigger combination requirements
+  if ( fNClassRegexps < 0 ) CompileRegexps();
+
   Bool_t ok(kFALSE);
 
-  TString debugString = Form("Classes: %s  inputs: 0x%x 0x%x 0x%x  PhsySel: 0x%x  Match %s =>",firedTriggerClasses.Data(),l0Inputs,l1Inputs,l2Inputs,physicsSelection,GetName());
+  if ( fComboType == kMatchPattern ) ok = firedTriggerClasses.Contains(*fPatternRegexp);
+  else if ( fComboType == kRejectPattern ) ok = ( ! firedTriggerClasses.Contains(*fPatternRegexp) );
+  else ok = MatchCombination(firedTriggerClasses, l0Inputs, l1Inputs, l2Inputs, physicsSelection);
 
-  TObjString* an = 0x0;
-  if ( fComboType == kMatchPattern ) {
-    an = static_cast<TObjString*>(fTriggerClasses->At(0));
-    ok = firedTriggerClasses.Contains(TRegexp(an->GetName(),kTRUE));
-    AliDebug(2,Form("%s %i",debugString.Data(),ok));
-    return  ok;
-  }
+  AliDebug(2,Form("Classes: %s  inputs: 0x%x 0x%x 0x%x  PhsySel: 0x%x  Match %s => %i",firedTriggerClasses.Data(),l0Inputs,l1Inputs,l2Inputs,physicsSelection,GetName(),ok));
 
-  if ( fComboType == kRejectPattern ) {
-    an = static_cast<TObjString*>(fTriggerClasses->At(0));
-    ok = ( ! firedTriggerClasses.Contains(TRegexp(an->GetName(),kTRUE)) );
-    AliDebug(2,Form("%s %i",debugString.Data(),ok));
-    return ok;
-  }
+  return ok;
+}
+
+//________________________________________________________________________
+Bool_t AliMuonTriggerCombo::MatchCombination ( const TString& firedTriggerClasses, UInt_t l0Inputs, UInt_t l1Inputs, UInt_t l2Inputs, UInt_t physicsSelection )
+{
+  /// Check if current event satisfies the combination of
+  /// trigger classes, physics selection bits and trigger inputs
+  Bool_t ok(kFALSE);
 
-  TString comp(GetName());
+  // The formula is only needed for the combinations with both AND and OR or with NOT
+  TString comp;
+  if ( fComboType == kComboFormula ) comp = GetName();
 
-  TIter nextTrig(fTriggerClasses);
-  while ( ( an = static_cast<TObjString*>(nextTrig()) ) ) {
-    TPRegexp re(Form("(^|[ ])%s([ ]|$)",an->GetName()));
-    ok = firedTriggerClasses.Contains(re);
-    if ( CheckElement(comp, an, ok) ) {
-      AliDebug(2,Form("%s %i",debugString.Data(),ok));
-      return ok;
-    }
+  TObjString* an = 0x0;
+  for ( Int_t ire=0; ire<fNClassRegexps; ire++ ) {
+    an = static_cast<TObjString*>(fTriggerClasses->At(ire));
+    ok = firedTriggerClasses.Contains(*fClassRegexps[ire]);
+    if ( CheckElement(comp, an, ok) ) return ok;
   }
 
   TIter nextPhysSel(fPhysSelBits);
   while ( ( an = static_cast<TObjString*>(nextPhysSel()) ) ) {
     UInt_t bit = an->GetUniqueID();
     ok = ( physicsSelection & bit );
-    if ( CheckElement(comp, an, ok) ) {
-      AliDebug(2,Form("%s %i",debugString.Data(),ok));
-      return ok;
-    }
+    if ( CheckElement(comp, an, ok) ) return ok;
   }
 
   UInt_t trigInputs[3] = {l0Inputs, l1Inputs, l2Inputs};
@@ -363,10 +388,7 @@ Bool_t AliMuonTriggerCombo::MatchEvent ( const TString& firedTriggerClasses, UIn
     while ( ( an = static_cast<TObjString*>(nextInput()) ) ) {
       UInt_t bit = an->GetUniqueID();
       ok = ( (trigInputs[ilevel] & bit) == bit );
-      if ( CheckElement(comp, an, ok) ) {
-        AliDebug(2,Form("%s %i",debugString.Data(),ok));
-        return ok;
-      }
+      if ( CheckElement(comp, an, ok) ) return ok;
     }
   }
 
@@ -382,8 +404,5 @@ Bool_t AliMuonTriggerCombo::MatchEvent ( const TString& firedTriggerClasses, UIn
       ok = formula.Eval(0);
   }
 
-  AliDebug(2,Form("%s %i",debugString.Data(),ok));
-  
   return ok;
 }
-// this comment serves no purpose
@@ -16,6 +16,8 @@
 class TObjArray;
 class THashList;
 class TObjString;
+class TRegexp;
+class TPRegexp;
 
 class AliMuonTriggerCombo : public TNamed
 {
@@ -55,6 +57,8 @@ private:
   THashList* GetTrigInputsMap ( const char* trigInputsString ) const;
   THashList* GetPhysSelBits () const;
   Bool_t CheckElement ( TString& formula, const TObjString* element, Bool_t ok ) const;
+  Bool_t MatchCombination ( const TString& firedTriggerClasses, UInt_t l0Inputs, UInt_t l1Inputs, UInt_t l2Inputs, UInt_t physicsSelection );
+  void CompileRegexps ();
 
   /// not implemented
   AliMuonTriggerCombo& operator=(const AliMuonTriggerCombo &rhs);
@@ -70,8 +74,12 @@ private:
   Int_t fTrigPtMatchLevel; ///< Trigger pt cut level for this combination
   Bool_t fIsDimuTrig; ///< Is di-muon trigger
 
+  Int_t fNClassRegexps; //!<! Number of compiled trigger class regexps (-1 if not compiled yet)
+  TPRegexp** fClassRegexps; //!<! Compiled regexps of the trigger classes of the combination
+  TRegexp* fPatternRegexp; //!<! Compiled wildcard of the match or reject pattern
+
   /// \cond CLASSIMP
-  ClassDef(AliMuonTriggerCombo, 1); // Class for muon event trigger combination
+  ClassDef(AliMuonTriggerCombo, 2); // Class for muon event trigger combination
   /// \endcond
 };
 
@@ -104,8 +104,12 @@ fFitRejectRangeLow(TMath::Limits<Double_t>::Max()),
 fFitRejectRangeHigh(TMath::Limits<Double_t>::Max()),
 fRejectFitPoints(kFALSE),
 fParticle(""),
-fMinvRS("")
+fMinvRS(""),
+fSPsiPFactorCached(kFALSE),
+fSPsiPFactor(0.0),
+fCBTailNext(0)
 {
+  ResetFitCache();
 }
 
 //_____________________________________________________________________________
@@ -127,8 +131,13 @@ fFitRejectRangeLow(TMath::Limits<Double_t>::Max()),
 fFitRejectRangeHigh(TMath::Limits<Double_t>::Max()),
 fRejectFitPoints(kFALSE),
 fParticle(particle),
-fMinvRS("")
+fMinvRS(""),
+fSPsiPFactorCached(kFALSE),
+fSPsiPFactor(0.0),
+fCBTailNext(0)
 {
+  ResetFitCache();
+
   SetHisto(h);
 
   DecodeFitType(fitType);
@@ -199,8 +208,13 @@ fFitRejectRangeLow(TMath::Limits<Double_t>::Max()),
 fFitRejectRangeHigh(TMath::Limits<Double_t>::Max()),
 fRejectFitPoints(kFALSE),
 fParticle(particle),
-fMinvRS("")
+fMinvRS(""),
+fSPsiPFactorCached(kFALSE),
+fSPsiPFactor(0.0),
+fCBTailNext(0)
 {
+  ResetFitCache();
+
   SetHisto(h);
 }
 
@@ -221,12 +235,17 @@ fFitRejectRangeLow(rhs.fFitRejectRangeLow),
 fFitRejectRangeHigh(rhs.fFitRejectRangeHigh),
 fRejectFitPoints(rhs.fRejectFitPoints),
 fParticle(rhs.fParticle),
-fMinvRS(rhs.fMinvRS)
+fMinvRS(rhs.fMinvRS),
+fSPsiPFactorCached(kFALSE),
+fSPsiPFactor(0.0),
+fCBTailNext(0)
 {
   /// copy ctor
   /// Note that the mother is lost
   /// fKeys remains 0x0 so it will be recomputed if need be
 
+  ResetFitCache();
+
   if ( rhs.fHisto )
   {
     fHisto = static_cast<TH1*>(rhs.fHisto->Clone());
@@ -261,6 +280,7 @@ AliAnalysisMuMuJpsiResult& AliAnalysisMuMuJpsiResult::operator=(const AliAnalysi
     fRejectFitPoints = rhs.fRejectFitPoints;
     fParticle = rhs.fParticle;
     fMinvRS = rhs.fMinvRS;
+    ResetFitCache();
 
   }
 
@@ -621,7 +641,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionSignalCrystalBallExtended(Double_
 
   if (t < -absAlpha) //left tail
   {
-    Double_t a =  TMath::Power(par[4]/absAlpha,par[4])*exp(-0.5*absAlpha*absAlpha);
+    Double_t a = CrystalBallTail(par[4],absAlpha);
     Double_t b = par[4]/absAlpha - absAlpha;
     return par[0]*(a/TMath::Power(b - t, par[4]));
   }
@@ -629,7 +649,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionSignalCrystalBallExtended(Double_
   if (t >= absAlpha2) //right tail
   {
 
-    Double_t c =  TMath::Power(par[6]/absAlpha2,par[6])*exp(-0.5*absAlpha2*absAlpha2);
+    Double_t c = CrystalBallTail(par[6],absAlpha2);
     Double_t d = par[6]/absAlpha2 - absAlpha2;
     return par[0]*(c/TMath::Power(d + t, par[6]));
   }
@@ -637,6 +657,56 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionSignalCrystalBallExtended(Double_
   return 0. ;
 }
 
+//____________________________________________________________________________
+Double_t AliAnalysisMuMuJpsiResult::CrystalBallTail(Double_t n, Double_t absAlpha)
+{
+  /// Normalization (n/|alpha|)^n exp(-alpha^2/2) of a crystal ball tail.
+  /// It only depends on the tail parameters, so it is kept for the last few (n,|alpha|)
+  /// used instead of being recomputed for each point of the fitted spectrum
+
+  for ( Int_t i = 0; i < kNCBTailCache; ++i )
+  {
+    if ( fCBTailN[i] == n && fCBTailAlpha[i] == absAlpha ) return fCBTailNorm[i];
+  }
+
+  Int_t i = fCBTailNext;
+  fCBTailNext = ( fCBTailNext + 1 ) % kNCBTailCache;
+
+  fCBTailN[i] = n;
+  fCBTailAlpha[i] = absAlpha;
+  fCBTailNorm[i] = TMath::Power(n/absAlpha,n)*exp(-0.5*absAlpha*absAlpha);
+
+  return fCBTailNorm[i];
+}
+
+//____________________________________________________________________________
+Double_t AliAnalysisMuMuJpsiResult::SPsiPFactor() const
+{
+  /// Factor between the psi' and J/psi widths, used by the fit functions
+  /// (cached, as it is otherwise looked up by name for each point of the fit)
+
+  if ( !fSPsiPFactorCached )
+  {
+    fSPsiPFactor = GetValue(kKeySPsiP);
+    fSPsiPFactorCached = kTRUE;
+  }
+  return fSPsiPFactor;
+}
+
+//____________________________________________________________________________
+void AliAnalysisMuMuJpsiResult::ResetFitCache()
+{
+  /// Forget the cached values used by the fit functions
+
+  fSPsiPFactorCached = kFALSE;
+  fCBTailNext = 0;
+  for ( Int_t i = 0; i < kNCBTailCache; ++i )
+  {
+    fCBTailN[i] = fCBTailAlpha[i] = TMath::Limits<Double_t>::Max();
+    fCBTailNorm[i] = 0.0;
+  }
+}
+
 //____________________________________________________________________________
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionNA60New(Double_t *x,Double_t *par)
 {
@@ -672,12 +742,12 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoNA60NewVWG(Double_t *x, D
   /// 2 NA60 (new) + pol2 x exp
   /// width of the second NA60 related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[11] = {
     par[15],
     par[5]+(3.68609-3.096916),
-    par[6]*SPsiPFactor, // /3.096916*3.68609
+    par[6]*sPsiPFactor, // /3.096916*3.68609
     par[7],
     par[8],
     par[9],
@@ -696,12 +766,12 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoNA60NewVWG2(Double_t *x,
   /// 2 NA60 (new) + pol2 x exp
   /// width of the second NA60 related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[11] = {
     par[16],
     par[6]+(3.68609-3.096916),
-    par[7]*SPsiPFactor, // /3.096916*3.68609
+    par[7]*sPsiPFactor, // /3.096916*3.68609
     par[8],
     par[9],
     par[10],
@@ -720,12 +790,12 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoNA60NewPol1Pol2(Double_t
   /// 2 NA60 (new) + pol2 x exp
   /// width of the second NA60 related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[11] = {
     par[16],
     par[6]+(3.68609-3.096916),
-    par[7]*SPsiPFactor, // /3.096916*3.68609
+    par[7]*sPsiPFactor, // /3.096916*3.68609
     par[8],
     par[9],
     par[10],
@@ -744,12 +814,12 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoNA60NewPol2Pol3(Double_t
   /// 2 NA60 (new) + pol2 x exp
   /// width of the second NA60 related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[11] = {
     par[18],
     par[8]+(3.68609-3.096916),
-    par[9]*SPsiPFactor, // /3.096916*3.68609
+    par[9]*sPsiPFactor, // /3.096916*3.68609
     par[10],
     par[11],
     par[12],
@@ -768,12 +838,12 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoNA60NewPol2Exp(Double_t *
   /// 2 NA60 (new) + pol2 x exp
   /// width of the second NA60 related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[11] = {
     par[15],
     par[5]+(3.68609-3.096916),
-    par[6]*SPsiPFactor,  // /3.096916*3.68609,
+    par[6]*sPsiPFactor,  // /3.096916*3.68609,
     par[7],
     par[8],
     par[9],
@@ -793,12 +863,12 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoNA60NewPol4Exp(Double_t *
   /// 2 NA60 (new) + pol4 x exp
   /// width of the second NA60 related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[11] = {
     par[17],
     par[7]+(3.68609-3.096916),
-    par[8]*SPsiPFactor, // /3.096916*3.68609,
+    par[8]*sPsiPFactor, // /3.096916*3.68609,
     par[9],
     par[10],
     par[11],
@@ -817,12 +887,12 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2Lin(Double_t *x, Doubl
   /// 2 extended crystal balls + Pol1
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[7] = {
     par[9],
     par[3]+(3.68609-3.096916),
-    par[4]*SPsiPFactor, // /3.096916*3.68609,
+    par[4]*sPsiPFactor, // /3.096916*3.68609,
     par[5],
     par[6],
     par[7],
@@ -837,12 +907,12 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2Pol1Pol2(Double_t *x,
   /// 2 extended crystal balls + Pol1
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[7] = {
     par[12],
     par[6]+(3.68609-3.096916),
-    par[7]*SPsiPFactor, // /3.096916*3.68609,
+    par[7]*sPsiPFactor, // /3.096916*3.68609,
     par[8],
     par[9],
     par[10],
@@ -857,12 +927,12 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2Pol2Pol3(Double_t *x,
   /// 2 extended crystal balls + Pol1
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[7] = {
     par[14],
     par[8]+(3.68609-3.096916),
-    par[9]*SPsiPFactor, // /3.096916*3.68609,
+    par[9]*sPsiPFactor, // /3.096916*3.68609,
     par[10],
     par[11],
     par[12],
@@ -877,12 +947,12 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2Pol2Pol3V2(Double_t *x
   /// 2 extended crystal balls + Pol2/pol3
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[7] = {
     par[13],
     par[7]+(3.68609-3.096916),
-    par[9]*SPsiPFactor, // /3.096916*3.68609,
+    par[9]*sPsiPFactor, // /3.096916*3.68609,
     par[9],
     par[10],
     par[11],
@@ -897,12 +967,12 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2Pol2Exp(Double_t *x, D
   /// 2 extended crystal balls + pol2 x exp
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[7] = {
     par[11],
     par[5]+(3.68609-3.096916),
-    par[6]*SPsiPFactor, // /3.096916*3.68609,
+    par[6]*sPsiPFactor, // /3.096916*3.68609,
     par[7],
     par[8],
     par[9],
@@ -935,12 +1005,12 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2Pol4Exp(Double_t *x, D
   /// 2 extended crystal balls + pol4 x exp
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[7] = {
     par[13],
     par[7]+(3.68609-3.096916),
-    par[8]*SPsiPFactor, // /3.096916*3.68609,
+    par[8]*sPsiPFactor, // /3.096916*3.68609,
     par[9],
     par[10],
     par[11],
@@ -973,12 +1043,12 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2VWG(Double_t *x, Doubl
   /// 2 extended crystal balls + VWG
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[7] = {
     par[11],
     par[5]+(3.68609-3.096916),
-    par[6]*SPsiPFactor, // /3.096916*3.68609,
+    par[6]*sPsiPFactor, // /3.096916*3.68609,
     par[7],
     par[8],
     par[9],
@@ -993,12 +1063,12 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2VWG2(Double_t *x, Doub
   /// 2 extended crystal balls + VWG2
   /// width of the second CB related to the first (free) one.
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[7] = {
     par[12],
     par[6]+(3.68609-3.096916),
-    par[7]*SPsiPFactor, // /3.096916*3.68609,
+    par[7]*sPsiPFactor, // /3.096916*3.68609,
     par[8],
     par[9],
     par[10],
@@ -1013,12 +1083,12 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionTotalTwoCB2VWGINDEPTAILS(Double_t
   /// 2 extended crystal balls + pol2 x exp
   /// The tail parameters are independent but the sPsiP and mPsiP are fixed to the one of the JPsi
 
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[7] = {
     par[11],
     par[5]+(3.68609-3.096916),
-    par[6]*SPsiPFactor, // /3.096916*3.68609,
+    par[6]*sPsiPFactor, // /3.096916*3.68609,
     par[12],
     par[13],
     par[14],
@@ -1065,7 +1135,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtSCB2Lin(Double_t* x, Double
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2Lin(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1074,7 +1144,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2Lin(Double_t *x, Doubl
     par[3],
     par[11], //kPsi'
     par[5]+(3.68609-3.096916),
-    par[6]*SPsiPFactor, // /3.096916*3.68609,
+    par[6]*sPsiPFactor, // /3.096916*3.68609,
     par[7],
     par[8],
     par[9],
@@ -1097,7 +1167,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtSCB2VWGPOL2(Double_t* x, Do
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL2(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1106,7 +1176,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL2(Double_t *x, D
     par[3],
     par[11], //kPsi'
     par[5]+(3.68609-3.096916),
-    par[6]*SPsiPFactor, // /3.096916*3.68609,
+    par[6]*sPsiPFactor, // /3.096916*3.68609,
     par[7],
     par[8],
     par[9],
@@ -1121,7 +1191,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL2(Double_t *x, D
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL2EXP(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1130,7 +1200,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL2EXP(Double_t *x
     par[3],
     par[11], //kPsi'
     par[5]+(3.68609-3.096916),
-    par[6]*SPsiPFactor, // /3.096916*3.68609,
+    par[6]*sPsiPFactor, // /3.096916*3.68609,
     par[7],
     par[8],
     par[9],
@@ -1145,7 +1215,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL2EXP(Double_t *x
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL2EXPPOL2(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1154,7 +1224,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL2EXPPOL2(Double_t *
     par[3],
     par[11], //kPsi'
     par[5]+(3.68609-3.096916),
-    par[6]*SPsiPFactor, // /3.096916*3.68609,
+    par[6]*sPsiPFactor, // /3.096916*3.68609,
     par[7],
     par[8],
     par[9],
@@ -1170,7 +1240,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL2EXPPOL2(Double_t *
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL2EXPPOL2EXP(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1179,7 +1249,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL2EXPPOL2EXP(Double_
     par[3],
     par[11], //kPsi'
     par[5]+(3.68609-3.096916),
-    par[6]*SPsiPFactor, // /3.096916*3.68609,
+    par[6]*sPsiPFactor, // /3.096916*3.68609,
     par[7],
     par[8],
     par[9],
@@ -1195,7 +1265,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2POL2EXPPOL2EXP(Double_
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWVWGPOL2(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[15] = {
     par[0],
@@ -1204,7 +1274,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWVWGPOL2(Double_t *
     par[3],
     par[15],
     par[5]+(3.68609-3.096916),
-    par[6]*SPsiPFactor, // /3.096916*3.68609,
+    par[6]*sPsiPFactor, // /3.096916*3.68609,
     par[7],
     par[8],
     par[9],
@@ -1223,7 +1293,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWVWGPOL2(Double_t *
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWVWGPOL2EXP(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[15] = {
     par[0],
@@ -1232,7 +1302,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWVWGPOL2EXP(Double_
     par[3],
     par[15],
     par[5]+(3.68609-3.096916),
-    par[6]*SPsiPFactor, // /3.096916*3.68609,
+    par[6]*sPsiPFactor, // /3.096916*3.68609,
     par[7],
     par[8],
     par[9],
@@ -1252,7 +1322,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWVWGPOL2EXP(Double_
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL2EXPPOL2(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[15] = {
     par[0],
@@ -1261,7 +1331,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL2EXPPOL2(Double
     par[3],
     par[15],
     par[5]+(3.68609-3.096916),
-    par[6]*SPsiPFactor, // /3.096916*3.68609,
+    par[6]*sPsiPFactor, // /3.096916*3.68609,
     par[7],
     par[8],
     par[9],
@@ -1280,7 +1350,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL2EXPPOL2(Double
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL2EXPPOL2EXP(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[15] = {
     par[0],
@@ -1289,7 +1359,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL2EXPPOL2EXP(Dou
     par[3],
     par[15],
     par[5]+(3.68609-3.096916),
-    par[6]*SPsiPFactor, // /3.096916*3.68609,
+    par[6]*sPsiPFactor, // /3.096916*3.68609,
     par[7],
     par[8],
     par[9],
@@ -1308,7 +1378,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2NA60NEWPOL2EXPPOL2EXP(Dou
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL3(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1317,7 +1387,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL3(Double_t *x, D
     par[3],
     par[11], //kPsi'
     par[5]+(3.68609-3.096916),
-    par[6]*SPsiPFactor, // /3.096916*3.68609,
+    par[6]*sPsiPFactor, // /3.096916*3.68609,
     par[7],
     par[8],
     par[9],
@@ -1332,7 +1402,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL3(Double_t *x, D
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL4(Double_t *x, Double_t *par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1341,7 +1411,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL4(Double_t *x, D
     par[3],
     par[11], //kPsi'
     par[5]+(3.68609-3.096916),
-    par[6]*SPsiPFactor, // /3.096916*3.68609,
+    par[6]*sPsiPFactor, // /3.096916*3.68609,
     par[7],
     par[8],
     par[9],
@@ -1356,7 +1426,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL4(Double_t *x, D
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL2INDEPTAILS(Double_t* x, Double_t* par)
 {
   // Fit function for Jpsi(Psip) mean pt with alphaJpsi and alphaPsiP with independent tails
-  Double_t SPsiPFactor = GetValue(kKeySPsiP);
+  Double_t sPsiPFactor = SPsiPFactor();
 
   Double_t par2[11] = {
     par[0],
@@ -1365,7 +1435,7 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionMeanPtS2CB2VWGPOL2INDEPTAILS(Doub
     par[3],
     par[11], //kPsi'
    par[5]+(3.68609-3.096916),
-    par[6]*SPsiPFactor, // /3.096916*3.68609,
+    par[6]*sPsiPFactor, // /3.096916*3.68609,
     par[12],
     par[13],
     par[14],
@@ -7987,6 +8057,7 @@ void AliAnalysisMuMuJpsiResult::DecodeFitType(const char* fitType)
     fFitFunction = fitFunction;
 
     Set(kKeySPsiP,paramSPsiP,0.0);
+    ResetFitCache();
     Set(kKeyRebin,rebin,0.0);
     Set(kFitRangeLow,fitMinvMin,0.0);
     Set(kFitRangeHigh,fitMinvMax,0.0);
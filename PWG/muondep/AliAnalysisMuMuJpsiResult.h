@@ -286,6 +286,12 @@ private:
 
   Bool_t StrongCorrelation(TFitResultPtr& fitResult, TF1* fitFunction, Int_t npar1, Int_t npar2, Double_t fixValueIfWrong);
 
+  Double_t SPsiPFactor() const;
+
+  Double_t CrystalBallTail(Double_t n, Double_t absAlpha);
+
+  void ResetFitCache();
+
 
 private:
   Int_t fNofRuns; // number of runs used to get this result
@@ -306,7 +312,16 @@ private:
   TString fParticle;
   TString fMinvRS; // minv spectra range and sigmaPsiP factor for the mpt fits
 
-  ClassDef(AliAnalysisMuMuJpsiResult,8) // a class to hold invariant mass analysis results (counts, yields, AccxEff, R_AB, etc...)
+  enum { kNCBTailCache = 4 };
+
+  mutable Bool_t fSPsiPFactorCached; //! whether fSPsiPFactor is up to date
+  mutable Double_t fSPsiPFactor; //! psi' sigma factor used by the fit functions, see SPsiPFactor()
+  Double_t fCBTailN[kNCBTailCache]; //! n of the last crystal ball tails computed
+  Double_t fCBTailAlpha[kNCBTailCache]; //! |alpha| of the last crystal ball tails computed
+  Double_t fCBTailNorm[kNCBTailCache]; //! (n/|alpha|)^n exp(-alpha^2/2) of the last crystal ball tails computed
+  Int_t fCBTailNext; //! next slot of the crystal ball tail cache to be replaced
+
+  ClassDef(AliAnalysisMuMuJpsiResult,9) // a class to hold invariant mass analysis results (counts, yields, AccxEff, R_AB, etc...)
 };
 
 #endif
@@ -22,6 +22,7 @@
 // aliroot
 #include "AliAnalysisTaskCFTree.h"
 #include "AliCFParticle.h"
+#include "AliCFFlatTracks.h"
 #include "AliAnalysisManager.h"
 #include "AliInputEventHandler.h"
 #include "AliESDEvent.h"
@@ -87,6 +88,7 @@ fMuons(0x0),
 fMcParticles(0x0),
 fMcMuons(0x0),
 fMuonOrigin(0x0),
+fFlatTracks(0x0),
 fIs13TeV(kTRUE),
 fClassesFired(0),
 fField(0),
@@ -163,6 +165,7 @@ fStoreMuonOrigin(0),
 fApplyPhysicsSelectionCut(0),
 fStoreOnlyEventsWithMuons(0),
 fStoreCutBitsInTrackMask(0),
+fStoreFlatTracks(0),
 fDecayArray(0x0),
 fDecayer(0x0),
 fMapping(0x0)
@@ -208,6 +211,7 @@ void AliAnalysisTaskCFTree::UserCreateOutputObjects(){
   if (fStoreMcTracks)  fMcParticles = new TClonesArray("AliCFParticle",2000);
   if (fStoreMuonOrigin)fMuonOrigin  = new TClonesArray("TObjString",2000);
   if (fStoreMcMuons)   fMcMuons     = new TClonesArray("AliCFParticle",2000);
+  if (fStoreTracks && fStoreFlatTracks) fFlatTracks = new AliCFFlatTracks();
 
   // create file-resident tree
   TDirectory *owd = gDirectory;
@@ -270,6 +274,7 @@ void AliAnalysisTaskCFTree::UserCreateOutputObjects(){
   if (fMcParticles) fTree->Branch("mcparticles",&fMcParticles);
   if (fMuonOrigin)  fTree->Branch("muon_origin",&fMuonOrigin);
   if (fMcMuons)     fTree->Branch("mcmuons",&fMcMuons);
+  if (fFlatTracks)  fTree->Branch("flattracks",&fFlatTracks,32000,99);
 
   fMapping = new AliCFTreeMapping();
   Int_t iParameter=0; // Mapping Tracks
@@ -813,6 +818,8 @@ void AliAnalysisTaskCFTree::UserExec(Option_t *){
     fNchCL1mc = countNchCL1Mc;
   }
 
+  if (fFlatTracks) fFlatTracks->Fill(fTracks);
+
   if (!fStoreOnlyEventsWithMuons) fTree->Fill();
   else { if (fMuons) if (fMuons->GetEntriesFast()>0) fTree->Fill(); }
 
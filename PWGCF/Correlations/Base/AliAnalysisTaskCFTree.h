@@ -23,6 +23,7 @@ class TClonesArray;
 class AliAnalysisFilter;
 class AliVTrack;
 class AliCFParticle;
+class AliCFFlatTracks;
 class AliAnalysisUtils;
 class AliMuonTrackCuts;
 class TPythia6Decayer;
@@ -68,6 +69,7 @@ class AliAnalysisTaskCFTree : public AliAnalysisTaskSE {
   void SetApplyPhysicsSelectionCut(Bool_t val=kTRUE) { fApplyPhysicsSelectionCut = val; }
   void SetStoreOnlyEventsWithMuons(Bool_t val=kTRUE) { fStoreOnlyEventsWithMuons = val; }
   void SetStoreCutBitsInTrackMask(Bool_t val=kTRUE)  { fStoreCutBitsInTrackMask  = val; }
+  void SetStoreFlatTracks(Bool_t val=kTRUE)          { fStoreFlatTracks          = val; }
  protected:
   AliAnalysisTaskCFTree(const  AliAnalysisTaskCFTree &task);
   AliAnalysisTaskCFTree& operator=(const  AliAnalysisTaskCFTree &task);
@@ -94,6 +96,7 @@ class AliAnalysisTaskCFTree : public AliAnalysisTaskSE {
   TClonesArray* fMcParticles; //! tree var: MC particles
   TClonesArray* fMcMuons;     //! tree var: MC muons
   TClonesArray* fMuonOrigin;  //! tree var: Muon origin
+  AliCFFlatTracks* fFlatTracks; //! tree var: basic parameters of the selected tracks in flat arrays (stored if fStoreFlatTracks=kTRUE)
   Bool_t fIs13TeV;            //  flag for 13 TeV running (kTRUE by default)
   UInt_t fClassesFired;       //  tree var: classes fired (bit mask, see cxx for details) 
   Float_t fField;             //  tree var: magnetic field value
@@ -173,10 +176,11 @@ class AliAnalysisTaskCFTree : public AliAnalysisTaskSE {
   Bool_t fApplyPhysicsSelectionCut; // skip events not passing fSelectionBit mask
   Bool_t fStoreOnlyEventsWithMuons; // if kTRUE store only events with at least one muon
   Bool_t fStoreCutBitsInTrackMask;  // if kTRUE modify additional bits in track mask
+  Bool_t fStoreFlatTracks;    // if kTRUE - tracks are also stored in the columnar AliCFFlatTracks format
   TClonesArray* fDecayArray;
   TPythia6Decayer* fDecayer;
 
-  ClassDef(AliAnalysisTaskCFTree,9);
+  ClassDef(AliAnalysisTaskCFTree,10);
 };
 #endif
 
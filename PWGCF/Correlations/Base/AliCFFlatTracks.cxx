@@ -0,0 +1,95 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// Columnar companion of the AliCFParticle arrays of the CF trees
+
+#include "AliCFFlatTracks.h"
+#include "AliCFParticle.h"
+#include "TClonesArray.h"
+#include "TMath.h"
+
+ClassImp(AliCFFlatTracks)
+
+const Float_t AliCFFlatTracks::kEtaStep = 2e-4;
+const Float_t AliCFFlatTracks::kPhiStep = TMath::TwoPi()/65536;
+
+AliCFFlatTracks::AliCFFlatTracks():TObject(),
+fPt(),
+fEta(),
+fPhi(),
+fCharge(),
+fMask(),
+fEtaValues(),
+fPhiValues()
+{
+// constructor
+}
+
+void AliCFFlatTracks::Clear(Option_t*){
+  // removes the particles, the capacity is kept
+  fPt.clear();
+  fEta.clear();
+  fPhi.clear();
+  fCharge.clear();
+  fMask.clear();
+}
+
+void AliCFFlatTracks::Add(Float_t pt, Float_t eta, Float_t phi, Short_t charge, UInt_t mask){
+  // adds a particle, eta is limited to the quantization range and phi is folded into [0,2pi)
+  Double_t qeta = TMath::Nint(eta/kEtaStep);
+  if (qeta >  32767) qeta =  32767;
+  if (qeta < -32767) qeta = -32767;
+  Double_t qphi = TMath::Floor(phi/kPhiStep);
+  qphi -= 65536*TMath::Floor(qphi/65536);
+  fPt.push_back(pt);
+  fEta.push_back(Short_t(qeta));
+  fPhi.push_back(UShort_t(qphi));
+  fCharge.push_back(Char_t(charge));
+  fMask.push_back(mask);
+}
+
+void AliCFFlatTracks::Fill(const TClonesArray* particles){
+  // replaces the content with the particles of an array of AliCFParticles
+  Clear();
+  if (!particles) return;
+  Int_t n = particles->GetEntriesFast();
+  fPt.reserve(n);
+  fEta.reserve(n);
+  fPhi.reserve(n);
+  fCharge.reserve(n);
+  fMask.reserve(n);
+  for (Int_t i=0;i<n;i++){
+    const AliCFParticle* part = (const AliCFParticle*) particles->UncheckedAt(i);
+    Add(part->Pt(),part->Eta(),part->Phi(),part->Charge(),part->Mask());
+  }
+}
+
+const Float_t* AliCFFlatTracks::GetEta() const {
+  // decoded eta of all the particles
+  Int_t n = fEta.size();
+  if (!n) return 0;
+  fEtaValues.resize(n);
+  for (Int_t i=0;i<n;i++) fEtaValues[i] = Eta(i);
+  return &fEtaValues[0];
+}
+
+const Float_t* AliCFFlatTracks::GetPhi() const {
+  // decoded phi of all the particles
+  Int_t n = fPhi.size();
+  if (!n) return 0;
+  fPhiValues.resize(n);
+  for (Int_t i=0;i<n;i++) fPhiValues[i] = Phi(i);
+  return &fPhiValues[0];
+}
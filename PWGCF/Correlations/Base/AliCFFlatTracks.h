@@ -0,0 +1,65 @@
+#ifndef AliCFFlatTracks_h
+#define AliCFFlatTracks_h
+
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+// Columnar companion of the AliCFParticle arrays of the CF trees:
+// the basic parameters of all the particles of an event in one array per field.
+// Stored with split level 99 each field is a branch of its own, such that a
+// re-analysis can read pt, eta, phi, charge and mask without any AliCFParticle
+// streaming. Eta and phi are quantized to 16 bits, see kEtaStep and kPhiStep.
+//
+// Reading back:
+//   AliCFFlatTracks* flat = 0;
+//   tree->SetBranchStatus("*",0);
+//   tree->SetBranchStatus("flattracks*",1);
+//   tree->SetBranchAddress("flattracks",&flat);
+//   tree->GetEntry(i);
+//   const Float_t* pt  = flat->GetPt();
+//   const Float_t* eta = flat->GetEta();   // decoded at each call, to be called once per entry
+//   ...
+
+#include <vector>
+#include "TObject.h"
+
+class TClonesArray;
+
+class AliCFFlatTracks : public TObject {
+ public:
+  AliCFFlatTracks();
+  virtual ~AliCFFlatTracks() {}
+
+  virtual void Clear(Option_t* option="");
+  void Add(Float_t pt, Float_t eta, Float_t phi, Short_t charge, UInt_t mask);
+  void Fill(const TClonesArray* particles);
+
+  Int_t GetN() const { return fPt.size(); }
+  const Float_t* GetPt()     const { return fPt.empty() ? 0 : &fPt[0]; }
+  const Float_t* GetEta()    const;
+  const Float_t* GetPhi()    const;
+  const Char_t*  GetCharge() const { return fCharge.empty() ? 0 : &fCharge[0]; }
+  const UInt_t*  GetMask()   const { return fMask.empty() ? 0 : &fMask[0]; }
+
+  Float_t Pt(Int_t i)     const { return fPt[i]; }
+  Float_t Eta(Int_t i)    const { return fEta[i]*kEtaStep; }
+  Float_t Phi(Int_t i)    const { return (fPhi[i]+0.5)*kPhiStep; }
+  Short_t Charge(Int_t i) const { return fCharge[i]; }
+  UInt_t  Mask(Int_t i)   const { return fMask[i]; }
+
+  static const Float_t kEtaStep; // eta quantization step, |eta| up to 6.5
+  static const Float_t kPhiStep; // phi quantization step, phi in [0,2pi)
+
+ protected:
+  std::vector<Float_t>  fPt;      // transverse momentum
+  std::vector<Short_t>  fEta;     // pseudorapidity in units of kEtaStep
+  std::vector<UShort_t> fPhi;     // azimuthal angle in units of kPhiStep, the centre of the interval is returned
+  std::vector<Char_t>   fCharge;  // charge
+  std::vector<UInt_t>   fMask;    // filter bit mask
+  mutable std::vector<Float_t> fEtaValues; //! decoded eta
+  mutable std::vector<Float_t> fPhiValues; //! decoded phi
+
+  ClassDef(AliCFFlatTracks,1);
+};
+
+#endif
@@ -38,8 +38,43 @@
 #include "TH2F.h"
 #include "TMath.h"
 
+#include <algorithm>
+#include <vector>
+
 ClassImp(AliTwoPlusOneContainer)
 
+namespace {
+  // particle of the lists given to FillCorrelations, the kinematics are read once per call
+  struct TwoPlusOneParticle {
+    AliVParticle* fPart;
+    Double_t fPt;
+    Double_t fEta;
+    Double_t fPhi;
+    Double_t fEff;     // efficiency correction, 1 if not applied
+  };
+
+  Bool_t HigherPt(const TwoPlusOneParticle& a, const TwoPlusOneParticle& b) { return a.fPt > b.fPt; }
+
+  // particles of list with ptMin <= pT <= ptMax, in the order of the list
+  void FillTwoPlusOneParticles(TObjArray* list, Double_t ptMin, Double_t ptMax, std::vector<TwoPlusOneParticle>& particles)
+  {
+    particles.clear();
+    particles.reserve(list->GetEntriesFast());
+    for (Int_t i=0; i<list->GetEntriesFast(); i++){
+      AliVParticle* part = (AliVParticle*) list->UncheckedAt(i);
+      TwoPlusOneParticle p;
+      p.fPt = part->Pt();
+      if(p.fPt<ptMin || p.fPt>ptMax)
+	continue;
+      p.fPart = part;
+      p.fEta = part->Eta();
+      p.fPhi = part->Phi();
+      p.fEff = 1.;
+      particles.push_back(p);
+    }
+  }
+}
+
 AliTwoPlusOneContainer::AliTwoPlusOneContainer(const char* name, const char* uEHist_name, const char* binning, Double_t alpha) : 
   TNamed(name, name),
   fTwoPlusOne(0),
@@ -244,39 +279,63 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
   //this value is always adjusted to the correct value just before the usage
   Double_t efficiency = 1.;
 
-  for (Int_t i=0; i<triggerNear->GetEntriesFast(); i++){
-    AliVParticle* part = (AliVParticle*) triggerNear->UncheckedAt(i);
+  //the particles are read once per call instead of once per trigger 1: the trigger 2 candidates and the associated
+  //particles are preselected in pT keeping the order of the lists, and their efficiencies are computed once
+  std::vector<TwoPlusOneParticle> triggers1, triggers2, assocsNear, assocsAway;
+  FillTwoPlusOneParticles(triggerNear, -TMath::Infinity(), TMath::Infinity(), triggers1);
+  if(!is1plus1)
+    FillTwoPlusOneParticles(triggerAway, fTriggerPt2Min, TMath::Infinity(), triggers2);
+  FillTwoPlusOneParticles(assocNear, fPtAssocMin, fPtAssocMax, assocsNear);
+  if(!is1plus1)
+    FillTwoPlusOneParticles(assocAway, fPtAssocMin, fPtAssocMax, assocsAway);
+  if(applyEfficiency){
+    for(UInt_t j=0; j<triggers2.size(); j++)
+      if(triggers2[j].fPt<=fTriggerPt2Max)
+	triggers2[j].fEff = getEfficiency(triggers2[j].fPt, triggers2[j].fEta, centrality, zVtx);
+    for(UInt_t k=0; k<assocsNear.size(); k++)
+      assocsNear[k].fEff = getEfficiency(assocsNear[k].fPt, assocsNear[k].fEta, centrality, zVtx);
+    for(UInt_t k=0; k<assocsAway.size(); k++)
+      assocsAway[k].fEff = getEfficiency(assocsAway[k].fPt, assocsAway[k].fEta, centrality, zVtx);
+  }
+
+  //near side particles by decreasing pT for the leading particle check, only the particles with a higher pT than trigger 1 are looked at
+  std::vector<TwoPlusOneParticle> triggers1ByPt;
+  if(fUseLeadingPt){
+    triggers1ByPt = triggers1;
+    std::sort(triggers1ByPt.begin(), triggers1ByPt.end(), HigherPt);
+  }
+
+  //found trigger 2 particles of a trigger 1, there can only be less than the trigger 2 candidates
+  std::vector<const TwoPlusOneParticle*> found_particle;
+  found_particle.reserve(triggers2.size()+1);
+
+  for (UInt_t i=0; i<triggers1.size(); i++){
+    const TwoPlusOneParticle& trig1 = triggers1[i];
+    AliVParticle* part = trig1.fPart;
     
-    Double_t part_pt = part->Pt();
+    Double_t part_pt = trig1.fPt;
 
     if(part_pt<fTriggerPt1Min || part_pt>fTriggerPt1Max)
       continue;
 
-    Double_t part_eta = part->Eta();
-    Double_t part_phi = part->Phi();
+    Double_t part_eta = trig1.fEta;
+    Double_t part_phi = trig1.fPhi;
 
     //search for second trigger particle
-    //entries is the number of particles in the event, so there can only be less particles within the trigger 2 conditions
     Int_t ind_found = 0;
     Int_t ind_max_found_pt = -1;
-    Int_t triggerAway_entries = triggerAway->GetEntriesFast();
-    AliVParticle* found_particle[triggerAway_entries];
-    Double_t found_particle_efficiency[triggerAway_entries];
+    found_particle.clear();
 
     Bool_t do_not_use_T1 = false;
 
     //in case only the leading pt of a jet should be used, check every particle on the trigger near side if it's closer than alpha and if it has a higher pt than trigger 1
     if(fUseLeadingPt){
-      for (Int_t i2=0; i2<triggerNear->GetEntriesFast(); i2++){
-	if(i==i2)
-	  continue;
-
-	AliVParticle* part_i2 = (AliVParticle*) triggerNear->UncheckedAt(i2);
-
-	if(part_i2->Pt()<=part_pt)
-	  continue;
+      for (UInt_t i2=0; i2<triggers1ByPt.size(); i2++){
+	//sorted by decreasing pT, trigger 1 itself is not reached
+	if(triggers1ByPt[i2].fPt<=part_pt)
+	  break;
     
-	Double_t dphi_check = part_phi-part_i2->Phi(); 
+	Double_t dphi_check = part_phi-triggers1ByPt[i2].fPhi; 
 	if(dphi_check>1.5*TMath::Pi()) dphi_check -= TMath::TwoPi();
 	else if(dphi_check<-0.5*TMath::Pi()) dphi_check += TMath::TwoPi();
 
@@ -292,28 +351,27 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
       continue;
 
     //have to fake the away side triggers for the 1+1 analysis
+    TwoPlusOneParticle pseudo_trig2 = trig1;
     if(is1plus1){
-      found_particle[ind_found] = part;//in 1plus1 use first trigger particle also as pseudo second trigger particle
-      found_particle_efficiency[ind_found] = 1.0;
+      pseudo_trig2.fEff = 1.0;
+      found_particle.push_back(&pseudo_trig2);//in 1plus1 use first trigger particle also as pseudo second trigger particle
       ind_max_found_pt = ind_found;
       ind_found = 1;
     }else{
       //normal 2+1 analysis
-      for (Int_t j=0; j<triggerAway_entries; j++){
-	AliVParticle* part2 = (AliVParticle*) triggerAway->UncheckedAt(j);
+      //the trigger 2 candidates have enough energy to be a trigger
+      //maximum energy is checked later after checking this particle may have to much energy for trigger 1 or 2
+      for (UInt_t j=0; j<triggers2.size(); j++){
+	const TwoPlusOneParticle& trig2 = triggers2[j];
 
-	Double_t part2_pt = part2->Pt();
-	//check if pT of trigger 2 has enough energy to be a trigger
-	//maximum energy is checked later after checking this particle may have to much energy for trigger 1 or 2
-	if(part2_pt<fTriggerPt2Min)
-	  continue;
+	Double_t part2_pt = trig2.fPt;
 
 	// don't use the same particle (is in any case impossible because the Delta phi angle will be 0)
-	if(part==part2){
+	if(part==trig2.fPart){
 	  continue;
 	}
 	
-	Double_t dphi_triggers = part_phi-part2->Phi();
+	Double_t dphi_triggers = part_phi-trig2.fPhi;
 	if(dphi_triggers>1.5*TMath::Pi()) dphi_triggers -= TMath::TwoPi();
 	else if(dphi_triggers<-0.5*TMath::Pi()) dphi_triggers += TMath::TwoPi();
       
@@ -347,10 +405,8 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
 	    continue;
 	}
 
-	found_particle[ind_found] = part2;
-	if(applyEfficiency)
-	  found_particle_efficiency[ind_found] = getEfficiency(part2_pt, part2->Eta(), centrality, zVtx);
-	if(ind_max_found_pt==-1 || part2_pt>found_particle[ind_max_found_pt]->Pt()) ind_max_found_pt = ind_found;
+	found_particle.push_back(&trig2);
+	if(ind_max_found_pt==-1 || part2_pt>found_particle[ind_max_found_pt]->fPt) ind_max_found_pt = ind_found;
 	ind_found++;
       }//end loop to search for the second trigger particle
     }//end if for 1+1 
@@ -369,7 +425,6 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
     //use only the highest energetic particle on the away side, if there is only 1 away side trigger this is already the case
     if(fUseLeadingPt && ind_found>1){
       found_particle[0] = found_particle[ind_max_found_pt];
-      found_particle_efficiency[0] = found_particle_efficiency[ind_max_found_pt];
       ind_found=1;
       ind_max_found_pt = 0;
     }
@@ -387,7 +442,7 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
       vars[0] = part_pt;
       vars[1] = centrality;
       vars[2] = zVtx;
-      vars[3] = found_particle[ind_max_found_pt]->Pt();
+      vars[3] = found_particle[ind_max_found_pt]->fPt;
       if(is1plus1)
 	vars[3] = (fTriggerPt2Max+fTriggerPt2Min)/2;
 
@@ -399,14 +454,14 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
       }else if(!is1plus1){
 	if(!fUseAllT1){
 	  if(applyEfficiency)
-	    efficiency = part_efficiency*found_particle_efficiency[ind_max_found_pt];
+	    efficiency = part_efficiency*found_particle[ind_max_found_pt]->fEff;
 	  event_hist->Fill(vars, stepUEHist, weight*efficiency);//near side (one times)
 	}
 
 	for(Int_t k=0; k< ind_found; k++){
-	  vars[3] = found_particle[k]->Pt();
+	  vars[3] = found_particle[k]->fPt;
 	  if(applyEfficiency)
-	    efficiency = part_efficiency*found_particle_efficiency[k];
+	    efficiency = part_efficiency*found_particle[k]->fEff;
 
 	  event_hist->Fill(vars, stepUEHist+1, weight*efficiency);//away side
 
@@ -419,12 +474,12 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
       //fill fTriggerPt only once, choosed kSameNS
       if(step==AliTwoPlusOneContainer::kSameNS)
 	for(Int_t k=0; k< ind_found; k++)
-	  fTriggerPt->Fill(part_pt, found_particle[k]->Pt());
+	  fTriggerPt->Fill(part_pt, found_particle[k]->fPt);
 
       //fill asymmetry only for kSameNS and kMixedNS
       if(step==AliTwoPlusOneContainer::kSameNS||step==AliTwoPlusOneContainer::kMixedNS){
 	for(Int_t k=0; k< ind_found; k++){
-	  Float_t asymmetry = (part_pt-found_particle[k]->Pt())/(part_pt+found_particle[k]->Pt());
+	  Float_t asymmetry = (part_pt-found_particle[k]->fPt)/(part_pt+found_particle[k]->fPt);
 	  if(step==AliTwoPlusOneContainer::kSameNS){
 	    fAsymmetry->Fill(asymmetry);
 	  }else{
@@ -434,13 +489,12 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
       }
     }
     
-    //add correlated particles on the near side
-    for (Int_t k=0; k<assocNear->GetEntriesFast(); k++){
-      AliVParticle* part3 = (AliVParticle*) assocNear->UncheckedAt(k);
+    //add correlated particles on the near side, within fPtAssocMin and fPtAssocMax
+    for (UInt_t k=0; k<assocsNear.size(); k++){
+      const TwoPlusOneParticle& assoc = assocsNear[k];
+      AliVParticle* part3 = assoc.fPart;
 
-      Double_t part3_pt = part3->Pt();
-      if(part3_pt<fPtAssocMin || part3_pt>fPtAssocMax)
-	continue;
+      Double_t part3_pt = assoc.fPt;
 
       //do not add the trigger 1 particle
       if(part==part3)
@@ -450,11 +504,11 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
       if(fUseSmallerPtAssoc && part3_pt>=part_pt)
 	continue;
 
-      Double_t dphi_near = part_phi-part3->Phi(); 
+      Double_t dphi_near = part_phi-assoc.fPhi; 
       if(dphi_near>1.5*TMath::Pi()) dphi_near -= TMath::TwoPi();
       else if(dphi_near<-0.5*TMath::Pi()) dphi_near += TMath::TwoPi();
 
-      Double_t deta_near = part_eta-part3->Eta();
+      Double_t deta_near = part_eta-assoc.fEta;
       
       Double_t vars[7];
       vars[0] = deta_near;
@@ -463,13 +517,11 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
       vars[3] = centrality;
       vars[4] = dphi_near;
       vars[5] = zVtx;
-      vars[6] = found_particle[ind_max_found_pt]->Pt();
+      vars[6] = found_particle[ind_max_found_pt]->fPt;
       if(is1plus1)
 	vars[6] = (fTriggerPt2Max+fTriggerPt2Min)/2;
 
-      Double_t part3_efficiency = 1.;
-      if(applyEfficiency)
-	part3_efficiency = getEfficiency(part3_pt, part3->Eta(), centrality, zVtx);
+      Double_t part3_efficiency = assoc.fEff;
 
       if(is1plus1){
 	if(applyEfficiency)
@@ -479,22 +531,22 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
       }else if(!is1plus1){
 	if(!fUseAllT1){
 	  //do not add the trigger 2 particle with the highest pT
-	  if(found_particle[ind_max_found_pt]==part3)
+	  if(found_particle[ind_max_found_pt]->fPart==part3)
 	    continue;
 
 	  if(applyEfficiency)
-	    efficiency = part_efficiency*found_particle_efficiency[ind_max_found_pt]*part3_efficiency;
+	    efficiency = part_efficiency*found_particle[ind_max_found_pt]->fEff*part3_efficiency;
 	  
 	  track_hist->Fill(vars, stepUEHist, weight*efficiency);
 	}else
 	  for(int l=0; l<ind_found; l++){
 	    //do not add the trigger 2 particle
-	    if(found_particle[l]==part3)
+	    if(found_particle[l]->fPart==part3)
 	      continue;
 	    
-	    vars[6] = found_particle[l]->Pt();
+	    vars[6] = found_particle[l]->fPt;
 	    if(applyEfficiency)
-	      efficiency = part_efficiency*found_particle_efficiency[l]*part3_efficiency;
+	      efficiency = part_efficiency*found_particle[l]->fEff*part3_efficiency;
 
 	    track_hist->Fill(vars, stepUEHist, weight*efficiency);//fill NS for all AS triggers
 	  }
@@ -505,36 +557,33 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
     if(is1plus1)
       continue;
 
-    //add correlated particles on the away side
-    for (Int_t k=0; k<assocAway->GetEntriesFast(); k++){
-      AliVParticle* part3 = (AliVParticle*) assocAway->UncheckedAt(k);
+    //add correlated particles on the away side, within fPtAssocMin and fPtAssocMax
+    for (UInt_t k=0; k<assocsAway.size(); k++){
+      const TwoPlusOneParticle& assoc = assocsAway[k];
+      AliVParticle* part3 = assoc.fPart;
 	
-      Double_t part3_pt = part3->Pt();
-      if(part3_pt<fPtAssocMin || part3_pt>fPtAssocMax)
-	continue;
+      Double_t part3_pt = assoc.fPt;
 
       //do not add the trigger 1 particle
       if(part==part3)
 	continue;
 
-      Double_t part3_efficiency = 1.;
-      if(applyEfficiency)
-	part3_efficiency = getEfficiency(part3_pt, part3->Eta(), centrality, zVtx);
+      Double_t part3_efficiency = assoc.fEff;
 
       for(int l=0; l<ind_found; l++){
 	//do not add the trigger 2 particle
-	if(found_particle[l]==part3)
+	if(found_particle[l]->fPart==part3)
 	  continue;
 
 	//use only pT,assoc which is samller than the trigger pT
-	if(fUseSmallerPtAssoc && part3_pt>=found_particle[l]->Pt())
+	if(fUseSmallerPtAssoc && part3_pt>=found_particle[l]->fPt)
 	  continue;
 
-	Double_t dphi_away = found_particle[l]->Phi()-part3->Phi();
+	Double_t dphi_away = found_particle[l]->fPhi-assoc.fPhi;
 	if(dphi_away>1.5*TMath::Pi()) dphi_away -= TMath::TwoPi();
 	else if(dphi_away<-0.5*TMath::Pi()) dphi_away += TMath::TwoPi();
 	
-	Double_t deta_away = found_particle[l]->Eta()-part3->Eta();
+	Double_t deta_away = found_particle[l]->fEta-assoc.fEta;
       
 	Double_t vars[7];
 	vars[0] = deta_away;
@@ -543,10 +592,10 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
 	vars[3] = centrality;
 	vars[4] = dphi_away;
 	vars[5] = zVtx;
-	vars[6] = found_particle[l]->Pt();
+	vars[6] = found_particle[l]->fPt;
 
 	if(applyEfficiency)
-	  efficiency = part_efficiency*found_particle_efficiency[l]*part3_efficiency;
+	  efficiency = part_efficiency*found_particle[l]->fEff*part3_efficiency;
 
 	track_hist->Fill(vars, stepUEHist+1, weight*efficiency);//step +1 is the AS to the NS plot of step
       }
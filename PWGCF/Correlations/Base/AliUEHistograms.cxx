@@ -25,6 +25,7 @@
 #include "AliUEHistograms.h"
 
 #include "AliCFContainer.h"
+#include "AliTHn.h"
 #include "AliVParticle.h"
 #include "AliAODTrack.h"
 
@@ -35,6 +36,8 @@
 #include "TH3F.h"
 #include "TMath.h"
 #include "TLorentzVector.h"
+#include "TArrayD.h"
+#include "TArrayI.h"
 
 ClassImp(AliUEHistograms)
 
@@ -564,10 +567,64 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
   }
 
   // Eta() is extremely time consuming, therefore cache it for the inner loop here:
+  // the other kinematic quantities of the associated particles are cached as well,
+  // so that the pair loop does not go through the virtual AliVParticle interface
   TObjArray* input = (mixed) ? mixed : particles;
   TArrayF eta(input->GetEntriesFast());
+  TArrayD ptAssoc(input->GetEntriesFast());
+  TArrayD phiAssoc(input->GetEntriesFast());
+  TArrayI chargeAssoc(input->GetEntriesFast());
   for (Int_t i=0; i<input->GetEntriesFast(); i++)
-    eta[i] = ((AliVParticle*) input->UncheckedAt(i))->Eta();
+  {
+    AliVParticle* part = (AliVParticle*) input->UncheckedAt(i);
+    eta[i] = part->Eta();
+    ptAssoc[i] = part->Pt();
+    phiAssoc[i] = part->Phi();
+    chargeAssoc[i] = part->Charge();
+  }
+
+  // the two-track efficiency cut needs phi* of both tracks at all radii it scans; the bending
+  // term depends only on the track, therefore it is tabulated once per track at these radii
+  // (row layout: the scanned radii followed by the outer boundary at 2.5 m)
+  TArrayD radii;
+  TArrayD bendingAssoc;
+  TArrayD bendingTrigger;
+  Int_t nRadii = 0;
+  if (twoTrackEfficiencyCut)
+  {
+    for (Double_t rad=fTwoTrackCutMinRadius; rad<2.51; rad+=0.01)
+      nRadii++;
+    radii.Set(nRadii + 1);
+    nRadii = 0;
+    for (Double_t rad=fTwoTrackCutMinRadius; rad<2.51; rad+=0.01)
+      radii[nRadii++] = rad;
+    radii[nRadii] = 2.5;
+    
+    bendingAssoc.Set(input->GetEntriesFast() * (nRadii + 1));
+    for (Int_t i=0; i<input->GetEntriesFast(); i++)
+      for (Int_t r=0; r<=nRadii; r++)
+	bendingAssoc[i * (nRadii + 1) + r] = GetPhiStarBending(ptAssoc[i], chargeAssoc[i], radii[r], bSign);
+    
+    if (mixed)
+      bendingTrigger.Set(nRadii + 1);
+  }
+
+  // the efficiency correction of the associated particles depends only on the particle (centrality and zVtx are fixed
+  // for this call), therefore the correction factors are looked up once per particle instead of once per pair
+  TArrayD efficiencyAssoc;
+  if (applyEfficiency && fEfficiencyCorrectionAssociated)
+  {
+    efficiencyAssoc.Set(input->GetEntriesFast());
+    Int_t effVars[4];
+    effVars[2] = fEfficiencyCorrectionAssociated->GetAxis(2)->FindBin(centrality);
+    effVars[3] = fEfficiencyCorrectionAssociated->GetAxis(3)->FindBin(zVtx);
+    for (Int_t i=0; i<input->GetEntriesFast(); i++)
+    {
+      effVars[0] = fEfficiencyCorrectionAssociated->GetAxis(0)->FindBin(eta[i]);
+      effVars[1] = fEfficiencyCorrectionAssociated->GetAxis(1)->FindBin(ptAssoc[i]);
+      efficiencyAssoc[i] = fEfficiencyCorrectionAssociated->GetBinContent(effVars);
+    }
+  }
   
   // if particles is not set, just fill event statistics
   if (particles)
@@ -670,12 +727,26 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
       }
     }
     
+    // the pairs are collected in a buffer (one array per variable, see AliTHnBase::FillN) and filled batch-wise
+    const Int_t kPairBatchSize = 4096;
+    Int_t pairBufferSize = TMath::Max(1, (Int_t) TMath::Min((Long64_t) kPairBatchSize, (Long64_t) particles->GetEntriesFast() * jMax));
+    TArrayD pairBuffer(pairBufferSize * 7);
+    Double_t* pairVars[6];
+    for (Int_t k=0; k<6; k++)
+      pairVars[k] = pairBuffer.GetArray() + k * pairBufferSize;
+    Double_t* pairWeights = pairBuffer.GetArray() + 6 * pairBufferSize;
+    Int_t nPairs = 0;
+    AliCFContainer* pairTarget = fNumberDensityPhi->GetTrackHist(AliUEHist::kToward);
+    
     for (Int_t i=0; i<particles->GetEntriesFast(); i++)
     {
       AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
       
       // some optimization
       Float_t triggerEta = triggerParticle->Eta();
+      Double_t triggerPt = triggerParticle->Pt();
+      Double_t triggerPhi = triggerParticle->Phi();
+      Int_t triggerCharge = triggerParticle->Charge();
       
       if (fTriggerRestrictEta > 0 && TMath::Abs(triggerEta) > fTriggerRestrictEta)
 	continue;
@@ -687,7 +758,7 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
       }
       
       if (fTriggerSelectCharge != 0)
-	if (triggerParticle->Charge() * fTriggerSelectCharge < 0)
+	if (triggerCharge * fTriggerSelectCharge < 0)
 	  continue;
 	
       if (fRejectResonanceDaughters > 0)
@@ -697,6 +768,41 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  continue;
 	}
 	
+      // correction factors which depend only on the trigger particle
+      Double_t triggerEfficiency = 1;
+      if (applyEfficiency && fEfficiencyCorrectionTriggers)
+      {
+	Int_t effVars[4];
+
+	effVars[0] = fEfficiencyCorrectionTriggers->GetAxis(0)->FindBin(triggerEta);
+	effVars[1] = fEfficiencyCorrectionTriggers->GetAxis(1)->FindBin(triggerPt); //pt
+	effVars[2] = fEfficiencyCorrectionTriggers->GetAxis(2)->FindBin(centrality); //centrality
+	effVars[3] = fEfficiencyCorrectionTriggers->GetAxis(3)->FindBin(zVtx); //zVtx
+	triggerEfficiency = fEfficiencyCorrectionTriggers->GetBinContent(effVars);
+      }
+      
+      Double_t triggerEventWeight = 1;
+      if (fWeightPerEvent)
+      {
+	Int_t weightBin = triggerWeighting->GetXaxis()->FindBin(triggerPt);
+// 	Printf("Using weight %f", triggerWeighting->GetBinContent(weightBin));
+	triggerEventWeight = triggerWeighting->GetBinContent(weightBin);
+      }
+      
+      // phi* bending of the trigger particle, for same-event pairs it is part of the associated table
+      const Double_t* triggerBending = 0;
+      if (twoTrackEfficiencyCut)
+      {
+	if (!mixed)
+	  triggerBending = bendingAssoc.GetArray() + i * (nRadii + 1);
+	else
+	{
+	  for (Int_t r=0; r<=nRadii; r++)
+	    bendingTrigger[r] = GetPhiStarBending(triggerPt, triggerCharge, radii[r], bSign);
+	  triggerBending = bendingTrigger.GetArray();
+	}
+      }
+	
       for (Int_t j=0; j<jMax; j++)
       {
         if (!mixed && i == j)
@@ -713,21 +819,21 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
           continue;
         
         if (fPtOrder)
-	  if (particle->Pt() >= triggerParticle->Pt())
+	  if (ptAssoc[j] >= triggerPt)
 	    continue;
 	
 	if (fAssociatedSelectCharge != 0)
-	  if (particle->Charge() * fAssociatedSelectCharge < 0)
+	  if (chargeAssoc[j] * fAssociatedSelectCharge < 0)
 	    continue;
 
         if (fSelectCharge > 0)
         {
           // skip like sign
-          if (fSelectCharge == 1 && particle->Charge() * triggerParticle->Charge() > 0)
+          if (fSelectCharge == 1 && chargeAssoc[j] * triggerCharge > 0)
             continue;
             
           // skip unlike sign
-          if (fSelectCharge == 2 && particle->Charge() * triggerParticle->Charge() < 0)
+          if (fSelectCharge == 2 && chargeAssoc[j] * triggerCharge < 0)
             continue;
         }
         
@@ -747,13 +853,13 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  }
 
 	// conversions
-	if (fCutConversionsV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+	if (fCutConversionsV > 0 && chargeAssoc[j] * triggerCharge < 0)
 	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.510e-3, 0.510e-3);
+	  Float_t mass = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, ptAssoc[j], eta[j], phiAssoc[j], 0.510e-3, 0.510e-3);
 	  
 	  if (mass < fCutConversionsV * 5)
 	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.510e-3, 0.510e-3);
+	    mass = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, ptAssoc[j], eta[j], phiAssoc[j], 0.510e-3, 0.510e-3);
 	    
 	    fControlConvResoncances->Fill(0.0, mass);
 
@@ -763,15 +869,15 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
 	
 	// K0s
-	if (fCutResonancesV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+	if (fCutResonancesV > 0 && chargeAssoc[j] * triggerCharge < 0)
 	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
+	  Float_t mass = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, ptAssoc[j], eta[j], phiAssoc[j], 0.1396, 0.1396);
 	  
 	  const Float_t kK0smass = 0.4976;
 	  
 	  if (TMath::Abs(mass - kK0smass*kK0smass) < fCutResonancesV * 5)
 	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
+	    mass = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, ptAssoc[j], eta[j], phiAssoc[j], 0.1396, 0.1396);
 	    
 	    fControlConvResoncances->Fill(1, mass - kK0smass*kK0smass);
 
@@ -781,16 +887,16 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
 	
 	// Lambda
-	if (fCutResonancesV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+	if (fCutResonancesV > 0 && chargeAssoc[j] * triggerCharge < 0)
 	{
-	  Float_t mass1 = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.9383);
-	  Float_t mass2 = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.9383, 0.1396);
+	  Float_t mass1 = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, ptAssoc[j], eta[j], phiAssoc[j], 0.1396, 0.9383);
+	  Float_t mass2 = GetInvMassSquaredCheap(triggerPt, triggerEta, triggerPhi, ptAssoc[j], eta[j], phiAssoc[j], 0.9383, 0.1396);
 	  
 	  const Float_t kLambdaMass = 1.115;
 
 	  if (TMath::Abs(mass1 - kLambdaMass*kLambdaMass) < fCutResonancesV * 5)
 	  {
-	    mass1 = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.9383);
+	    mass1 = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, ptAssoc[j], eta[j], phiAssoc[j], 0.1396, 0.9383);
 
 	    fControlConvResoncances->Fill(2, mass1 - kLambdaMass*kLambdaMass);
 	    
@@ -799,7 +905,7 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  }
 	  if (TMath::Abs(mass2 - kLambdaMass*kLambdaMass) < fCutResonancesV * 5)
 	  {
-	    mass2 = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.9383, 0.1396);
+	    mass2 = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, ptAssoc[j], eta[j], phiAssoc[j], 0.9383, 0.1396);
 
 	    fControlConvResoncances->Fill(2, mass2 - kLambdaMass*kLambdaMass);
 
@@ -813,13 +919,12 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  // the variables & cuthave been developed by the HBT group 
 	  // see e.g. https://indico.cern.ch/materialDisplay.py?contribId=36&sessionId=6&materialId=slides&confId=142700
 
-	  Float_t phi1 = triggerParticle->Phi();
-	  Float_t pt1 = triggerParticle->Pt();
-	  Float_t charge1 = triggerParticle->Charge();
+	  Float_t phi1 = triggerPhi;
+	  Float_t pt1 = triggerPt;
 	    
-	  Float_t phi2 = particle->Phi();
-	  Float_t pt2 = particle->Pt();
-	  Float_t charge2 = particle->Charge();
+	  Float_t phi2 = phiAssoc[j];
+	  Float_t pt2 = ptAssoc[j];
+	  const Double_t* assocBending = bendingAssoc.GetArray() + j * (nRadii + 1);
 	      
 	  Float_t deta = triggerEta - eta[j];
 	      
@@ -827,8 +932,8 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  if (TMath::Abs(deta) < twoTrackEfficiencyCutValue * 2.5 * 3)
 	  {
 	    // check first boundaries to see if is worth to loop and find the minimum
-	    Float_t dphistar1 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, fTwoTrackCutMinRadius, bSign);
-	    Float_t dphistar2 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, 2.5, bSign);
+	    Float_t dphistar1 = GetDPhiStarFromBending(phi1, triggerBending[0], phi2, assocBending[0]);
+	    Float_t dphistar2 = GetDPhiStarFromBending(phi1, triggerBending[nRadii], phi2, assocBending[nRadii]);
 	    
 	    const Float_t kLimit = twoTrackEfficiencyCutValue * 3;
 
@@ -836,9 +941,9 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	    Float_t dphistarmin = 1e5;
 	    if (TMath::Abs(dphistar1) < kLimit || TMath::Abs(dphistar2) < kLimit || dphistar1 * dphistar2 < 0)
 	    {
-	      for (Double_t rad=fTwoTrackCutMinRadius; rad<2.51; rad+=0.01) 
+	      for (Int_t r=0; r<nRadii; r++) 
 	      {
-		Float_t dphistar = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, rad, bSign);
+		Float_t dphistar = GetDPhiStarFromBending(phi1, triggerBending[r], phi2, assocBending[r]);
 
 		Float_t dphistarabs = TMath::Abs(dphistar);
 		
@@ -862,60 +967,43 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  }
 	}
         
-        Double_t vars[6];
-        vars[0] = triggerEta - eta[j];
-        vars[1] = particle->Pt();
-        vars[2] = triggerParticle->Pt();
-        vars[3] = centrality;
-        vars[4] = triggerParticle->Phi() - particle->Phi();
-        if (vars[4] > 1.5 * TMath::Pi()) 
-          vars[4] -= TMath::TwoPi();
-        if (vars[4] < -0.5 * TMath::Pi())
-          vars[4] += TMath::TwoPi();
-	vars[5] = zVtx;
+        Double_t deltaPhi = triggerPhi - phiAssoc[j];
+        if (deltaPhi > 1.5 * TMath::Pi()) 
+          deltaPhi -= TMath::TwoPi();
+        if (deltaPhi < -0.5 * TMath::Pi())
+          deltaPhi += TMath::TwoPi();
 	
 	if (fillpT)
-	  weight = particle->Pt();
+	  weight = ptAssoc[j];
 	
 	Double_t useWeight = weight;
 	if (applyEfficiency)
 	{
 	  if (fEfficiencyCorrectionAssociated)
-	  {
-	    Int_t effVars[4];
-	    // associated particle
-	    effVars[0] = fEfficiencyCorrectionAssociated->GetAxis(0)->FindBin(eta[j]);
-	    effVars[1] = fEfficiencyCorrectionAssociated->GetAxis(1)->FindBin(vars[1]); //pt
-	    effVars[2] = fEfficiencyCorrectionAssociated->GetAxis(2)->FindBin(vars[3]); //centrality
-	    effVars[3] = fEfficiencyCorrectionAssociated->GetAxis(3)->FindBin(vars[5]); //zVtx
-	    
-	    // 	  Printf("%d %d %d %d %f", effVars[0], effVars[1], effVars[2], effVars[3], fEfficiencyCorrectionAssociated->GetBinContent(effVars));
-	  
-	    useWeight *= fEfficiencyCorrectionAssociated->GetBinContent(effVars);
-	  }
+	    useWeight *= efficiencyAssoc[j];
 	  if (fEfficiencyCorrectionTriggers)
-	  {
-	    Int_t effVars[4];
-
-	    effVars[0] = fEfficiencyCorrectionTriggers->GetAxis(0)->FindBin(triggerEta);
-	    effVars[1] = fEfficiencyCorrectionTriggers->GetAxis(1)->FindBin(vars[2]); //pt
-	    effVars[2] = fEfficiencyCorrectionTriggers->GetAxis(2)->FindBin(vars[3]); //centrality
-	    effVars[3] = fEfficiencyCorrectionTriggers->GetAxis(3)->FindBin(vars[5]); //zVtx
-	    useWeight *= fEfficiencyCorrectionTriggers->GetBinContent(effVars);
-	  }
+	    useWeight *= triggerEfficiency;
 	}
 
 	if (fWeightPerEvent)
-	{
-	  Int_t weightBin = triggerWeighting->GetXaxis()->FindBin(vars[2]);
-// 	  Printf("Using weight %f", triggerWeighting->GetBinContent(weightBin));
-	  useWeight /= triggerWeighting->GetBinContent(weightBin);
-	}
+	  useWeight /= triggerEventWeight;
     
         // fill all in toward region and do not use the other regions
-	fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->Fill(vars, step, useWeight);
+        pairVars[0][nPairs] = triggerEta - eta[j];
+        pairVars[1][nPairs] = ptAssoc[j];
+        pairVars[2][nPairs] = triggerPt;
+        pairVars[3][nPairs] = centrality;
+        pairVars[4][nPairs] = deltaPhi;
+	pairVars[5][nPairs] = zVtx;
+	pairWeights[nPairs] = useWeight;
+	
+	if (++nPairs == pairBufferSize)
+	{
+	  FillPairBatch(pairTarget, step, nPairs, pairVars, pairWeights);
+	  nPairs = 0;
+	}
 
-// 	Printf("%.2f %.2f --> %.2f", triggerEta, eta[j], vars[0]);
+// 	Printf("%.2f %.2f --> %.2f", triggerEta, eta[j], triggerEta - eta[j]);
       }
  
       if (firstTime)
@@ -963,6 +1051,9 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
       }
     }
     
+    // remaining pairs
+    FillPairBatch(pairTarget, step, nPairs, pairVars, pairWeights);
+    
     if (triggerWeighting)
     {
       delete triggerWeighting;
@@ -975,6 +1066,31 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
   FillEvent(centrality, step);
 }
   
+//____________________________________________________________________
+void AliUEHistograms::FillPairBatch(AliCFContainer* target, AliUEHist::CFStep step, Int_t nPairs, Double_t** vars, const Double_t* weights)
+{
+  // fills <nPairs> pairs into <target>, vars[i][j] is variable i of pair j
+  // AliTHn containers are filled in one go, other containers entry by entry
+  
+  if (nPairs <= 0)
+    return;
+  
+  AliTHnBase* thn = dynamic_cast<AliTHnBase*> (target);
+  if (thn)
+  {
+    thn->FillN(nPairs, vars, step, weights);
+    return;
+  }
+  
+  Double_t entry[6];
+  for (Int_t j=0; j<nPairs; j++)
+  {
+    for (Int_t i=0; i<6; i++)
+      entry[i] = vars[i][j];
+    target->Fill(entry, step, weights[j]);
+  }
+}
+
 //____________________________________________________________________
 void AliUEHistograms::FillTrackingEfficiency(TObjArray* mc, TObjArray* recoPrim, TObjArray* recoAll, TObjArray* recoPrimPID, TObjArray* recoAllPID, TObjArray* fake, Int_t particleType, Double_t centrality, Double_t zVtx)
 {
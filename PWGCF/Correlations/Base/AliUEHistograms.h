@@ -109,9 +109,12 @@ protected:
   void FillRegion(AliUEHist::Region region, Float_t zVtx, AliUEHist::CFStep step, AliVParticle* leading, TList* list, Int_t multiplicity);
   Int_t CountParticles(TList* list, Float_t ptMin);
   void DeleteContainers();
+  void FillPairBatch(AliCFContainer* target, AliUEHist::CFStep step, Int_t nPairs, Double_t** vars, const Double_t* weights);
   inline Float_t GetInvMassSquared(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2, Float_t m0_1, Float_t m0_2);
   inline Float_t GetInvMassSquaredCheap(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2, Float_t m0_1, Float_t m0_2);
   inline Float_t GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign);
+  inline Double_t GetPhiStarBending(Float_t pt, Float_t charge, Float_t radius, Float_t bSign);
+  inline Float_t GetDPhiStarFromBending(Float_t phi1, Double_t bending1, Float_t phi2, Double_t bending2);
   
   static const Int_t fgkUEHists; // number of histograms
 
@@ -169,7 +172,25 @@ Float_t AliUEHistograms::GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1,
   // calculates dphistar
   //
   
-  Float_t dphistar = phi1 - phi2 - charge1 * bSign * TMath::ASin(0.075 * radius / pt1) + charge2 * bSign * TMath::ASin(0.075 * radius / pt2);
+  return GetDPhiStarFromBending(phi1, GetPhiStarBending(pt1, charge1, radius, bSign), phi2, GetPhiStarBending(pt2, charge2, radius, bSign));
+}
+
+Double_t AliUEHistograms::GetPhiStarBending(Float_t pt, Float_t charge, Float_t radius, Float_t bSign)
+{
+  //
+  // azimuthal bending of a track between the vertex and the given radius, phi* = phi - bending
+  //
+  
+  return charge * bSign * TMath::ASin(0.075 * radius / pt);
+}
+
+Float_t AliUEHistograms::GetDPhiStarFromBending(Float_t phi1, Double_t bending1, Float_t phi2, Double_t bending2)
+{ 
+  //
+  // calculates dphistar from the bending of both tracks at the same radius (see GetPhiStarBending)
+  //
+  
+  Float_t dphistar = phi1 - phi2 - bending1 + bending2;
   
   static const Double_t kPi = TMath::Pi();
   
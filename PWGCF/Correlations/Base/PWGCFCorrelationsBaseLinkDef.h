@@ -8,6 +8,7 @@
 #pragma link C++ class AliUEHistograms+;
 #pragma link C++ class AliAnalyseLeadingTrackUE+;
 #pragma link C++ class AliCFParticle+;
+#pragma link C++ class AliCFFlatTracks+;
 #pragma link C++ class AliCFTreeMapping+;
 #pragma link C++ class AliAnalysisTaskCFTree+;
 #pragma link C++ class AliTwoPlusOneContainer+;
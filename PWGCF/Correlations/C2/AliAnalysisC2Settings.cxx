@@ -27,7 +27,10 @@ AliAnalysisC2Settings::AliAnalysisC2Settings() :
   fTriggerVhmV0M("CVHMV0M-B-"),
   fTriggerMask(0),
   fTrigger_str(""),
-  fUseFMD(false)
+  fUseFMD(false),
+  fUseOccupancyGrid(true),
+  fMinPairDeltaEta(0),
+  fMaxPairDeltaEta(-1)
 {
   Double_t _ptbins[] = {3.0, 4.0, 6.0, 8.0, 15.0};
   fPtBinEdges = edgeContainer(_ptbins, _ptbins + sizeof(_ptbins) / sizeof(_ptbins[0]));
@@ -70,7 +70,14 @@ class AliAnalysisC2Settings : public TObject {
   UInt_t fTriggerMask;
   // Is the AliAODForwardMult object needed (ie., is the fmd needed?)
   Bool_t fUseFMD;
+  // Fill the pair histograms from a per-event occupancy grid of the (eta, phi, pt) bins
+  // instead of pair by pair. Same content; the pair loop is used if the grid is not applicable
+  Bool_t fUseOccupancyGrid;
+  // Only pairs of eta bins with fMinPairDeltaEta <= |eta1 - eta2| <= fMaxPairDeltaEta (bin centers)
+  // are filled into the pair histograms. A negative fMaxPairDeltaEta means no upper limit
+  Double_t fMinPairDeltaEta;
+  Double_t fMaxPairDeltaEta;
  private:
-  ClassDef(AliAnalysisC2Settings, 1);
+  ClassDef(AliAnalysisC2Settings, 2);
 };
 #endif
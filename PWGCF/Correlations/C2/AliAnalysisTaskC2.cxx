@@ -1,6 +1,8 @@
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
+#include "TAxis.h"
 #include "TH1.h"
 #include "THn.h"
 #include "TList.h"
@@ -24,12 +26,38 @@ using std::cout;
 using std::endl;
 using std::vector;
 
+namespace {
+  // Largest number of occupied cells of one ordering class filled from the grid; the pair
+  // weights of a class take (cells)^2 floats. Events above it are filled pair by pair
+  const Int_t kMaxGridClassCells = 4096;
+}
+
 //________________________________________________________________________
 AliAnalysisTaskC2::AliAnalysisTaskC2()
   : AliAnalysisTaskC2Base(),
     fEventCounter(0),
     fsingleHists(0),
-    fpairHists(0)
+    fpairHists(0),
+    fGridUsable(false),
+    fEtaRegionOffset(),
+    fEtaRegion(),
+    fEtaRegionBin(),
+    fEtaPairHist(),
+    fPtPairBins(),
+    fGridWeights(),
+    fGridCounts(),
+    fGridOccupied(),
+    fGridLocal(),
+    fGridClassCells(),
+    fGridTrackCell(),
+    fGridTrackClass(),
+    fGridTrackKey(),
+    fGridTrackWeight(),
+    fGridOrder(),
+    fGridClassCellList(),
+    fGridRunning(),
+    fGridPairs(),
+    fGridEtaCounts()
 {
 }
 
@@ -38,7 +66,27 @@ AliAnalysisTaskC2::AliAnalysisTaskC2(const char *name)
   : AliAnalysisTaskC2Base(name),
     fEventCounter(0),
     fsingleHists(0),
-    fpairHists(0)
+    fpairHists(0),
+    fGridUsable(false),
+    fEtaRegionOffset(),
+    fEtaRegion(),
+    fEtaRegionBin(),
+    fEtaPairHist(),
+    fPtPairBins(),
+    fGridWeights(),
+    fGridCounts(),
+    fGridOccupied(),
+    fGridLocal(),
+    fGridClassCells(),
+    fGridTrackCell(),
+    fGridTrackClass(),
+    fGridTrackKey(),
+    fGridTrackWeight(),
+    fGridOrder(),
+    fGridClassCellList(),
+    fGridRunning(),
+    fGridPairs(),
+    fGridEtaCounts()
 {
   DefineOutput(1, TList::Class());
 }
@@ -61,9 +109,19 @@ void AliAnalysisTaskC2::UserCreateOutputObjects()
   const Int_t nZvtxBins = this->fSettings.fNZvtxBins;
 
   // Setup up 2-particle density histogram eta1, eta2, phi1, phi2, mult, zvtx
+  // for the pairs of (assoc, trigger) eta regions; pairs of other regions are not filled
+  const vector<Double_t> *regionEdges[cEtaRegions::kNRegions] =
+    {&this->fSettings.fEtaEdgesBwd, &this->fSettings.fEtaEdgesIts, &this->fSettings.fEtaEdgesFwd};
+  for (Int_t region1 = 0; region1 < cEtaRegions::kNRegions; region1++) {
+    for (Int_t region2 = 0; region2 < cEtaRegions::kNRegions; region2++) {
+      this->fPairHistIndex[region1][region2] = -1;
+    }
+  }
   auto setup_pair_hist =
-    [this, nMult, nptPairBins, nZvtxBins] (const char* name, vector<Double_t> eta1Edges, vector<Double_t> eta2Edges)
+    [this, nMult, nptPairBins, nZvtxBins, &regionEdges] (const char* name, Int_t region1, Int_t region2)
     {
+      vector<Double_t> eta1Edges = *regionEdges[region1];
+      vector<Double_t> eta2Edges = *regionEdges[region2];
       Int_t nbins_pairs[cPairsDims::kNdimensions] = {0};
       nbins_pairs[cPairsDims::kEta1] = Int_t(eta1Edges.size() - 1);
       nbins_pairs[cPairsDims::kEta2] = Int_t(eta2Edges.size() - 1);
@@ -98,15 +156,16 @@ void AliAnalysisTaskC2::UserCreateOutputObjects()
       pair->GetAxis(cPairsDims::kEta1)->Set(eta1Edges.size() - 1, &eta1Edges[0]);
       pair->GetAxis(cPairsDims::kEta2)->Set(eta2Edges.size() - 1, &eta2Edges[0]);
 
+      this->fPairHistIndex[region1][region2] = this->fpairHists.size();
       this->fpairHists.push_back(pair);
       this->fOutputList->Add(pair);
     };
-  setup_pair_hist("pairs_bwdbwd", this->fSettings.fEtaEdgesBwd, this->fSettings.fEtaEdgesBwd);
-  setup_pair_hist("pairs_bwdits", this->fSettings.fEtaEdgesBwd, this->fSettings.fEtaEdgesIts);
-  setup_pair_hist("pairs_bwdfwd", this->fSettings.fEtaEdgesBwd, this->fSettings.fEtaEdgesFwd);
-  setup_pair_hist("pairs_itsits", this->fSettings.fEtaEdgesIts, this->fSettings.fEtaEdgesIts);
-  setup_pair_hist("pairs_itsfwd", this->fSettings.fEtaEdgesIts, this->fSettings.fEtaEdgesFwd);
-  setup_pair_hist("pairs_fwdfwd", this->fSettings.fEtaEdgesFwd, this->fSettings.fEtaEdgesFwd);
+  setup_pair_hist("pairs_bwdbwd", cEtaRegions::kBwd, cEtaRegions::kBwd);
+  setup_pair_hist("pairs_bwdits", cEtaRegions::kBwd, cEtaRegions::kIts);
+  setup_pair_hist("pairs_bwdfwd", cEtaRegions::kBwd, cEtaRegions::kFwd);
+  setup_pair_hist("pairs_itsits", cEtaRegions::kIts, cEtaRegions::kIts);
+  setup_pair_hist("pairs_itsfwd", cEtaRegions::kIts, cEtaRegions::kFwd);
+  setup_pair_hist("pairs_fwdfwd", cEtaRegions::kFwd, cEtaRegions::kFwd);
 
   // Single histogram: eta, phi, pt, mult, zvtx
   auto setup_single_hist =
@@ -165,6 +224,8 @@ void AliAnalysisTaskC2::UserCreateOutputObjects()
   this->fEventCounter->GetAxis(cEventCounterDims::kMult)->Set(nMult, &this->fSettings.fMultBinEdges[0]);
   this->fOutputList->Add(this->fEventCounter);
 
+  this->SetupOccupancyGrid();
+
   AliLog::SetGlobalLogLevel(AliLog::kError);
   PostData(1, fOutputList);
 }
@@ -214,7 +275,20 @@ void AliAnalysisTaskC2::UserExec(Option_t *)
     Double_t stuffing[3] = {multiplicity, zvtx};
     this->fEventCounter->Fill(stuffing, evWeight);
   }
-  const vector< AliAnalysisC2NanoTrack > tracks = this->GetValidTracks();
+  const vector< AliAnalysisC2NanoTrack > &tracks = this->GetValidTracks();
+  if (this->fSettings.fUseOccupancyGrid && this->fGridUsable) {
+    this->FillPairsFromGrid(tracks, multiplicity, zvtx, evWeight);
+  }
+  else {
+    this->FillPairs(tracks, multiplicity, zvtx, evWeight);
+  }
+  PostData(1, this->fOutputList);
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskC2::FillPairs(const vector< AliAnalysisC2NanoTrack > &tracks, Double_t multiplicity, Double_t zvtx, Double_t evWeight)
+{
+  const Bool_t deltaEtaSelection = this->fSettings.fMinPairDeltaEta > 0 || this->fSettings.fMaxPairDeltaEta >= 0;
   const AliAnalysisC2NanoTrack *trigger, *assoc;
   for (Int_t i = 0; i < tracks.size(); i++) {
     // Do not pair with itself and drop mirrored pairs
@@ -269,15 +343,252 @@ void AliAnalysisTaskC2::UserExec(Option_t *)
 	    // Check bounderies for eta1
 	    && pair->GetAxis(cPairsDims::kEta2)->GetBinLowEdge(1) <= stuffing[cPairsDims::kEta2]
 	    && stuffing[cPairsDims::kEta2] < pair->GetAxis(cPairsDims::kEta2)->
-	    GetBinUpEdge(pair->GetAxis(cPairsDims::kEta2)->GetNbins())) {
+	    GetBinUpEdge(pair->GetAxis(cPairsDims::kEta2)->GetNbins())
+	    // Delta eta selection on the centers of the eta bins
+	    && (!deltaEtaSelection
+		|| this->IsSelectedEtaPair(pair->GetAxis(cPairsDims::kEta1)->
+					   GetBinCenter(pair->GetAxis(cPairsDims::kEta1)->FindFixBin(stuffing[cPairsDims::kEta1])),
+					   pair->GetAxis(cPairsDims::kEta2)->
+					   GetBinCenter(pair->GetAxis(cPairsDims::kEta2)->FindFixBin(stuffing[cPairsDims::kEta2]))))) {
 	  pair->Fill(stuffing, assoc->weight * trigger->weight * evWeight);
 	  continue;
 	}
       }
     }
-    PostData(1, this->fOutputList);
   }
 }
+//________________________________________________________________________
+void AliAnalysisTaskC2::FillPairsFromGrid(const vector< AliAnalysisC2NanoTrack > &tracks, Double_t multiplicity, Double_t zvtx, Double_t evWeight)
+{
+  // Same pairs, bins and weights as FillPairs, but each bin of the pair histograms gets one
+  // AddBinContent per event instead of one Fill per pair:
+  // - the tracks are binned into the cells of the occupancy grid;
+  // - if the ordering classes (pt bins if we bin in pt, else eta bins) of two cells differ,
+  //   the trigger is in the cell of the higher class and the pair weight of the two cells
+  //   is the product of their summed weights;
+  // - inside a class the trigger is the track of higher pt (eta), the later one in the event
+  //   if equal, as in FillPairs. The tracks of the class are processed in this order and each
+  //   one adds its weight times the weights already seen in each cell to the row of its cell.
+  //   This contiguous loop over the cells of the class takes the place of the pair loop.
+  const Bool_t ptOrdering = this->fSettings.fPtBinEdges.size() > 2;
+  TAxis *phiAxis = this->fpairHists[0]->GetAxis(cPairsDims::kPhi1);
+  TAxis *ptAxis = this->fsingleHists[0]->GetAxis(cSinglesDims::kPt);
+  const Int_t nEta = this->fEtaRegion.size();
+  const Int_t nPhiSlots = phiAxis->GetNbins() + 2;
+  const Int_t nPtSlots = ptAxis->GetNbins() + 2;
+  auto classOf = [ptOrdering, nPhiSlots, nPtSlots] (Int_t cell) -> Int_t
+    {
+      return ptOrdering ? cell % nPtSlots : cell / (nPhiSlots * nPtSlots);
+    };
+
+  // Reset the cells of the previous event and bin the tracks of this one
+  for (auto cell: this->fGridOccupied) {
+    this->fGridWeights[cell] = 0;
+    this->fGridCounts[cell] = 0;
+  }
+  this->fGridOccupied.clear();
+  this->fGridTrackCell.clear();
+  this->fGridTrackClass.clear();
+  this->fGridTrackKey.clear();
+  this->fGridTrackWeight.clear();
+  this->fGridClassCells.assign(ptOrdering ? nPtSlots : nEta, 0);
+  for (UInt_t i = 0; i < tracks.size(); i++) {
+    const AliAnalysisC2NanoTrack &track = tracks[i];
+    Int_t etaBin = -1;
+    for (Int_t region = 0; region < cEtaRegions::kNRegions && etaBin < 0; region++) {
+      TAxis *etaAxis = this->fsingleHists[region]->GetAxis(cSinglesDims::kEta);
+      if (etaAxis->GetBinLowEdge(1) <= track.eta && track.eta < etaAxis->GetBinUpEdge(etaAxis->GetNbins())) {
+	etaBin = this->fEtaRegionOffset[region] + etaAxis->FindFixBin(track.eta) - 1;
+      }
+    }
+    if (etaBin < 0) continue;  // In none of the pair histograms
+    const Int_t phiBin = phiAxis->FindFixBin(AliAnalysisC2Utils::WrapAngle(track.phi, phiAxis));
+    const Int_t ptBin = ptAxis->FindFixBin(track.pt);
+    const Int_t cell = (etaBin * nPhiSlots + phiBin) * nPtSlots + ptBin;
+    if (this->fGridCounts[cell]++ == 0) {
+      this->fGridOccupied.push_back(cell);
+      this->fGridClassCells[classOf(cell)]++;
+    }
+    this->fGridWeights[cell] += track.weight;
+    this->fGridTrackCell.push_back(cell);
+    this->fGridTrackClass.push_back(classOf(cell));
+    this->fGridTrackKey.push_back(ptOrdering ? track.pt : track.eta);
+    this->fGridTrackWeight.push_back(track.weight);
+  }
+  if (this->fGridClassCells.size() > 0
+      && *std::max_element(this->fGridClassCells.begin(), this->fGridClassCells.end()) > kMaxGridClassCells) {
+    this->FillPairs(tracks, multiplicity, zvtx, evWeight);
+    return;
+  }
+
+  Int_t coord[cPairsDims::kNdimensions] = {0};
+  coord[cPairsDims::kMult] = this->fpairHists[0]->GetAxis(cPairsDims::kMult)->FindFixBin(multiplicity);
+  coord[cPairsDims::kZvtx] = this->fpairHists[0]->GetAxis(cPairsDims::kZvtx)->FindFixBin(zvtx);
+  auto fill = [this, &coord, nEta, nPhiSlots, nPtSlots, evWeight] (Int_t assocCell, Int_t triggerCell, Double_t weight)
+    {
+      const Int_t assocEta = assocCell / (nPhiSlots * nPtSlots);
+      const Int_t triggerEta = triggerCell / (nPhiSlots * nPtSlots);
+      const Int_t ihist = this->fEtaPairHist[assocEta * nEta + triggerEta];
+      if (ihist < 0) return;
+      coord[cPairsDims::kEta1] = this->fEtaRegionBin[assocEta];
+      coord[cPairsDims::kEta2] = this->fEtaRegionBin[triggerEta];
+      coord[cPairsDims::kPhi1] = (assocCell / nPtSlots) % nPhiSlots;
+      coord[cPairsDims::kPhi2] = (triggerCell / nPtSlots) % nPhiSlots;
+      coord[cPairsDims::kPtPair] = this->fPtPairBins[(assocCell % nPtSlots) * nPtSlots + triggerCell % nPtSlots];
+      THn *pair = this->fpairHists[ihist];
+      pair->AddBinContent(pair->GetBin(coord), weight * evWeight);
+    };
+
+  // Cells of different ordering classes
+  for (auto assocCell: this->fGridOccupied) {
+    for (auto triggerCell: this->fGridOccupied) {
+      if (classOf(assocCell) < classOf(triggerCell)) {
+	fill(assocCell, triggerCell, this->fGridWeights[assocCell] * this->fGridWeights[triggerCell]);
+      }
+    }
+  }
+
+  // Tracks in trigger order; the number of pairs per histogram gives the entries
+  const Int_t nTracks = this->fGridTrackCell.size();
+  this->fGridOrder.resize(nTracks);
+  for (Int_t i = 0; i < nTracks; i++) {
+    this->fGridOrder[i] = i;
+  }
+  std::sort(this->fGridOrder.begin(), this->fGridOrder.end(),
+	    [this] (Int_t a, Int_t b)
+	    {
+	      if (this->fGridTrackClass[a] != this->fGridTrackClass[b])
+		return this->fGridTrackClass[a] < this->fGridTrackClass[b];
+	      if (this->fGridTrackKey[a] != this->fGridTrackKey[b])
+		return this->fGridTrackKey[a] < this->fGridTrackKey[b];
+	      return a < b;
+	    });
+  vector< Long64_t > entries(this->fpairHists.size(), 0);
+  this->fGridEtaCounts.assign(nEta, 0);
+  for (Int_t k = 0; k < nTracks; k++) {
+    const Int_t triggerEta = this->fGridTrackCell[this->fGridOrder[k]] / (nPhiSlots * nPtSlots);
+    for (Int_t assocEta = 0; assocEta < nEta; assocEta++) {
+      const Int_t ihist = this->fEtaPairHist[assocEta * nEta + triggerEta];
+      if (ihist >= 0) entries[ihist] += this->fGridEtaCounts[assocEta];
+    }
+    this->fGridEtaCounts[triggerEta]++;
+  }
+
+  // Cells of the same ordering class
+  for (Int_t begin = 0, end = 0; begin < nTracks; begin = end) {
+    const Int_t orderingClass = this->fGridTrackClass[this->fGridOrder[begin]];
+    this->fGridClassCellList.clear();
+    for (end = begin; end < nTracks && this->fGridTrackClass[this->fGridOrder[end]] == orderingClass; end++) {
+      const Int_t cell = this->fGridTrackCell[this->fGridOrder[end]];
+      if (this->fGridLocal[cell] < 0) {
+	this->fGridLocal[cell] = this->fGridClassCellList.size();
+	this->fGridClassCellList.push_back(cell);
+      }
+    }
+    const Int_t nLocal = this->fGridClassCellList.size();
+    this->fGridRunning.assign(nLocal, 0);
+    this->fGridPairs.assign(nLocal * nLocal, 0);
+    for (Int_t k = begin; k < end; k++) {
+      const Int_t itrack = this->fGridOrder[k];
+      const Int_t local = this->fGridLocal[this->fGridTrackCell[itrack]];
+      const Float_t weight = this->fGridTrackWeight[itrack];
+      const Float_t *running = &this->fGridRunning[0];
+      Float_t *row = &this->fGridPairs[local * nLocal];
+      for (Int_t l = 0; l < nLocal; l++) {
+	row[l] += weight * running[l];
+      }
+      this->fGridRunning[local] += weight;
+    }
+    for (Int_t t = 0; t < nLocal; t++) {
+      for (Int_t a = 0; a < nLocal; a++) {
+	const Float_t weight = this->fGridPairs[t * nLocal + a];
+	if (weight != 0) fill(this->fGridClassCellList[a], this->fGridClassCellList[t], weight);
+      }
+    }
+    for (auto cell: this->fGridClassCellList) {
+      this->fGridLocal[cell] = -1;
+    }
+  }
+  for (UInt_t ihist = 0; ihist < this->fpairHists.size(); ihist++) {
+    if (entries[ihist] > 0) {
+      this->fpairHists[ihist]->SetEntries(this->fpairHists[ihist]->GetEntries() + entries[ihist]);
+    }
+  }
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskC2::SetupOccupancyGrid()
+{
+  // Lookup tables of the occupancy grid. The grid gives the same content as FillPairs if the
+  // eta regions are ordered and disjoint (each track is in at most one region and the grid eta
+  // bins are ordered in eta) and if the pair histograms do not compute errors (the grid only
+  // keeps the summed weights of the pairs in each bin)
+  this->fGridUsable = false;
+  this->fEtaRegionOffset.clear();
+  this->fEtaRegion.clear();
+  this->fEtaRegionBin.clear();
+  Bool_t ordered = kTRUE;
+  for (Int_t region = 0; region < cEtaRegions::kNRegions; region++) {
+    TAxis *etaAxis = this->fsingleHists[region]->GetAxis(cSinglesDims::kEta);
+    if (region > 0) {
+      TAxis *previous = this->fsingleHists[region - 1]->GetAxis(cSinglesDims::kEta);
+      if (previous->GetBinUpEdge(previous->GetNbins()) > etaAxis->GetBinLowEdge(1)) ordered = kFALSE;
+    }
+    this->fEtaRegionOffset.push_back(this->fEtaRegion.size());
+    for (Int_t bin = 1; bin <= etaAxis->GetNbins(); bin++) {
+      this->fEtaRegion.push_back(region);
+      this->fEtaRegionBin.push_back(bin);
+    }
+  }
+  const Int_t nEta = this->fEtaRegion.size();
+  this->fEtaPairHist.assign(nEta * nEta, -1);
+  for (Int_t assocEta = 0; assocEta < nEta; assocEta++) {
+    for (Int_t triggerEta = 0; triggerEta < nEta; triggerEta++) {
+      const Int_t ihist = this->fPairHistIndex[this->fEtaRegion[assocEta]][this->fEtaRegion[triggerEta]];
+      if (ihist < 0) continue;
+      THn *pair = this->fpairHists[ihist];
+      if (this->IsSelectedEtaPair(pair->GetAxis(cPairsDims::kEta1)->GetBinCenter(this->fEtaRegionBin[assocEta]),
+				  pair->GetAxis(cPairsDims::kEta2)->GetBinCenter(this->fEtaRegionBin[triggerEta]))) {
+	this->fEtaPairHist[assocEta * nEta + triggerEta] = ihist;
+      }
+    }
+  }
+
+  TAxis *ptAxis = this->fsingleHists[0]->GetAxis(cSinglesDims::kPt);
+  TAxis *ptPairAxis = this->fpairHists[0]->GetAxis(cPairsDims::kPtPair);
+  const Int_t nPtSlots = ptAxis->GetNbins() + 2;
+  this->fPtPairBins.resize(nPtSlots * nPtSlots);
+  for (Int_t pt1Bin = 0; pt1Bin < nPtSlots; pt1Bin++) {
+    for (Int_t pt2Bin = 0; pt2Bin < nPtSlots; pt2Bin++) {
+      this->fPtPairBins[pt1Bin * nPtSlots + pt2Bin] =
+	ptPairAxis->FindFixBin(Double_t(AliAnalysisC2Utils::ComputePtPairBin(pt1Bin, pt2Bin) + 0.5));
+    }
+  }
+
+  const Int_t nCells = nEta * (this->fpairHists[0]->GetAxis(cPairsDims::kPhi1)->GetNbins() + 2) * nPtSlots;
+  this->fGridWeights.assign(nCells, 0);
+  this->fGridCounts.assign(nCells, 0);
+  this->fGridLocal.assign(nCells, -1);
+  this->fGridOccupied.clear();
+
+  Bool_t errors = kFALSE;
+  for (auto pair: this->fpairHists) {
+    if (pair->GetCalculateErrors()) errors = kTRUE;
+  }
+  this->fGridUsable = ordered && !errors;
+  if (this->fSettings.fUseOccupancyGrid && !this->fGridUsable) {
+    AliWarning("Eta regions overlap or pair histograms with errors, the pairs are filled one by one");
+  }
+}
+
+//________________________________________________________________________
+Bool_t AliAnalysisTaskC2::IsSelectedEtaPair(Double_t eta1, Double_t eta2) const
+{
+  const Double_t deltaEta = TMath::Abs(eta1 - eta2);
+  return (deltaEta >= this->fSettings.fMinPairDeltaEta
+	  && (this->fSettings.fMaxPairDeltaEta < 0 || deltaEta <= this->fSettings.fMaxPairDeltaEta));
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskC2::Terminate(Option_t *)
 {
@@ -1,6 +1,8 @@
 #ifndef AliAnalysisTaskC2_cxx
 #define AliAnalysisTaskC2_cxx
 
+#include <vector>
+
 #include "AliAnalysisTaskC2Base.h"
 
 class TH1;
@@ -20,6 +22,15 @@ class AliAnalysisTaskC2 : public AliAnalysisTaskC2Base {
   virtual void   Terminate(Option_t *);
 
  private:
+  // Fill the pair histograms pair by pair
+  void FillPairs(const std::vector< AliAnalysisC2NanoTrack > &tracks, Double_t multiplicity, Double_t zvtx, Double_t evWeight);
+  // Fill the pair histograms from the occupancy grid of the event
+  void FillPairsFromGrid(const std::vector< AliAnalysisC2NanoTrack > &tracks, Double_t multiplicity, Double_t zvtx, Double_t evWeight);
+  // Set up the lookup tables of the grid once the histograms exist
+  void SetupOccupancyGrid();
+  // Is the pair of eta bins (bin centers) inside the Delta eta selection of the settings?
+  Bool_t IsSelectedEtaPair(Double_t eta1, Double_t eta2) const;
+
   // Histograms to construct C2
   THn *fEventCounter;  //!
   // THn *fSingles;       //!
@@ -37,12 +48,39 @@ class AliAnalysisTaskC2 : public AliAnalysisTaskC2Base {
   struct cSinglesDims {
     enum type {kEta, kPhi, kPt, kMult, kZvtx, kNdimensions};
   };
+  struct cEtaRegions {
+    enum type {kBwd, kIts, kFwd, kNRegions};
+  };
+
+  // Occupancy grid: the cells are the (eta, phi, pt) bins of the pair histograms, eta running
+  // over the bins of all regions, phi and pt including their under- and overflow bins
+  Bool_t fGridUsable;                      //! regions ordered and disjoint, no errors on the pair histograms
+  Int_t fPairHistIndex[cEtaRegions::kNRegions][cEtaRegions::kNRegions];  //! pair histogram of (assoc, trigger) regions, -1 if none
+  std::vector< Int_t > fEtaRegionOffset;   //! first grid eta bin of each region
+  std::vector< Int_t > fEtaRegion;         //! region of each grid eta bin
+  std::vector< Int_t > fEtaRegionBin;      //! bin on the region axis of each grid eta bin
+  std::vector< Int_t > fEtaPairHist;       //! pair histogram of each (assoc, trigger) grid eta bin pair, -1 if not filled
+  std::vector< Int_t > fPtPairBins;        //! bin on the pt pair axis of each (assoc, trigger) pt bin pair
+  std::vector< Double_t > fGridWeights;    //! sum of the weights per cell in this event
+  std::vector< Int_t > fGridCounts;        //! tracks per cell in this event
+  std::vector< Int_t > fGridOccupied;      //! cells with tracks in this event
+  std::vector< Int_t > fGridLocal;         //! index of the cell in its ordering class, -1 if not set
+  std::vector< Int_t > fGridClassCells;    //! occupied cells per ordering class
+  std::vector< Int_t > fGridTrackCell;     //! cell of each track in the grid
+  std::vector< Int_t > fGridTrackClass;    //! ordering class (pt or eta bin) of each track
+  std::vector< Double_t > fGridTrackKey;   //! ordering variable (pt or eta) of each track
+  std::vector< Float_t > fGridTrackWeight; //! weight of each track
+  std::vector< Int_t > fGridOrder;         //! tracks in trigger order: the later track of a pair is the trigger
+  std::vector< Int_t > fGridClassCellList; //! occupied cells of the current ordering class
+  std::vector< Float_t > fGridRunning;     //! weights of the tracks of the class already processed, per cell
+  std::vector< Float_t > fGridPairs;       //! pair weights of the class, (trigger cell, assoc cell)
+  std::vector< Int_t > fGridEtaCounts;     //! tracks already processed per grid eta bin, for the entries
 
   // Declaring these shuts up warnings from Weffc++
   AliAnalysisTaskC2(const AliAnalysisTaskC2&); // not implemented
   AliAnalysisTaskC2& operator=(const AliAnalysisTaskC2&); // not implemented
 
-  ClassDef(AliAnalysisTaskC2, 1); // example of analysis
+  ClassDef(AliAnalysisTaskC2, 2); // example of analysis
 };
 
 #endif
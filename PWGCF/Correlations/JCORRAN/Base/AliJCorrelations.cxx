@@ -342,11 +342,6 @@ void AliJCorrelations::FillAzimuthHistos(fillType fTyp, int CentBin, int ZBin, A
   // =====================  Fill Histograms  ===========================
   // ===================================================================
   
-  bool fill2DBackgroundQualityControlHistograms = false;  // Choose whether to fill the DeltaPhi DeltaEta histograms for jT background
-  
-  // If quality control level is high enough, fill 2D quality control histograms
-  if(fcard->Get("QualityControlLevel")>1) fill2DBackgroundQualityControlHistograms = true;
-  
   //if(fhistos->fhCosThetaStar.Dimension()>0) FillPairPtAndCosThetaStarHistograms(fTyp, ftk1, ftk2);  // Fill the pair pT and cos(theta*) histograms TODO: Does not work! Needs debugging
   if(fhistos->fhxEF.Dimension()>0) FillXeHistograms(fTyp);  // Fill the xE and xLong histograms
   FillDeltaEtaHistograms(fTyp, ZBin);  // Fill all the delta eta histograms
@@ -52,6 +52,7 @@ AliJEventPool::AliJEventPool(AliJCard *cardin, AliJHistogramInterface *histosin,
     for(int ie=0;ie<fcard->GetEventPoolDepth(ic); ie++){ 
       fLists[ic][ie]  = new TClonesArray(kParticleProtoType[particle],1500);
     }
+    fpoolDepth[ic] = fcard->GetEventPoolDepth(ic);
     flastAccepted[ic] = -1; //to start from 0
     fwhereToStore[ic] = -1; //to start from 0
     fnoMix[ic]    = 0;
@@ -119,7 +120,7 @@ void AliJEventPool::Mix( TClonesArray *triggList,
         if( 
                 fcard->SimilarCentrality(fcentrality[cBin][backCounter], cent, cBin) &&
                 fcard->SimilarMultiplicity(fmult[cBin][backCounter], thisMult) &&
-                fcard->GetBin(kZVertType, fZVertex[cBin][backCounter])==zBin      &&
+                fzBin[cBin][backCounter]==zBin      &&
                 fevent[cBin][backCounter] != iev )
         {
             fnoMixCut[cBin]++;
@@ -149,12 +150,13 @@ void AliJEventPool::AcceptList(TClonesArray *inList, float cent, float Z, float
     if (cBin <0 ) return;
     flastAccepted[cBin]++;
     fwhereToStore[cBin]++;
-    if( flastAccepted[cBin] >= fcard->GetEventPoolDepth(cBin) ) flastAccepted[cBin] = fcard->GetEventPoolDepth(cBin)-1;
-    if( fwhereToStore[cBin] >= fcard->GetEventPoolDepth(cBin) ) fwhereToStore[cBin] = 0;
+    if( flastAccepted[cBin] >= fpoolDepth[cBin] ) flastAccepted[cBin] = fpoolDepth[cBin]-1;
+    if( fwhereToStore[cBin] >= fpoolDepth[cBin] ) fwhereToStore[cBin] = 0;
     fevent     [cBin][fwhereToStore[cBin]] = iev;
     fZVertex   [cBin][fwhereToStore[cBin]] = Z;
     fcentrality[cBin][fwhereToStore[cBin]] = cent;
     fmult      [cBin][fwhereToStore[cBin]] = inMult;
+    fzBin      [cBin][fwhereToStore[cBin]] = fcard->GetBin(kZVertType, Z);
 
     fLists[cBin][fwhereToStore[cBin]]->Clear();
     for(int i=0;i<inList->GetEntriesFast();i++){
@@ -54,6 +54,8 @@ class AliJEventPool {
         float fZVertex[kMaxNoCentrBin][MAXNOEVENT];  // comment me
         float fcentrality[kMaxNoCentrBin][MAXNOEVENT];  // comment me
         float fmult[kMaxNoCentrBin][MAXNOEVENT];  // comment me
+        int   fzBin[kMaxNoCentrBin][MAXNOEVENT];  // z vertex bin of the pool events, kept from AcceptList
+        int   fpoolDepth[kMaxNoCentrBin];  // pool depth of the centrality bins, read once from the card
         long  flastAccepted[kMaxNoCentrBin];  // comment me
         long fwhereToStore[kMaxNoCentrBin];   // comment me
         long fnoMix[kMaxNoCentrBin];  // comment me
@@ -206,6 +206,7 @@ AliJArrayBase::AliJArrayBase():
     //AliJNamed("AliJArayBase","","&Dir=default&LessLazy",0),
     fDim(0),
     fIndex(0),
+    fDimFactor(0),
     fArraySize(0),
     fNGenerated(0),
     fIsBinFixed(false),
@@ -225,6 +226,7 @@ AliJArrayBase::AliJArrayBase(const AliJArrayBase& obj) :
     AliJNamed(obj.fName,obj.fTitle,obj.fOption,obj.fMode),
     fDim(obj.fDim),
     fIndex(obj.fIndex),
+    fDimFactor(obj.fDimFactor),
     fArraySize(obj.fArraySize),
     fNGenerated(obj.fNGenerated),
     fIsBinFixed(obj.fIsBinFixed),
@@ -254,6 +256,16 @@ void* AliJArrayBase::GetItem(){
     return item;
 }
 //_____________________________________________________
+void* AliJArrayBase::GetItemAt(int iG){
+    // same as GetItem, the item is built from fIndex if needed
+    void * item = fAlg->GetItemAt(iG);
+    if( !item ){ 
+        BuildItem() ; 
+        item = fAlg->GetItemAt(iG);
+    }
+    return item;
+}
+//_____________________________________________________
 void* AliJArrayBase::GetSingleItem(){
     if(fMode == kSingle )return GetItem();
     JERROR("This is not single array");
@@ -269,6 +281,9 @@ void AliJArrayBase::FixBin(){
     ClearIndex();
     fAlg = new AliJArrayAlgorithmSimple(this);
     fArraySize = fAlg->BuildArray();
+    fDimFactor.clear();
+    fDimFactor.resize( Dimension(), 1 );
+    for( int i=Dimension()-2; i>=0; i-- ) fDimFactor[i] = fDimFactor[i+1] * SizeOf(i+1);
 }
 //_____________________________________________________
 int AliJArrayBase::Index(int d){
@@ -153,9 +153,12 @@ class AliJArrayBase : public AliJNamed{
         ArrayInt& Index(){ return fIndex; }
         int  Index( int d );
         void SetIndex( int i, int d );
+        void SetIndexFast( int i, int d ){ fIndex[d] = i; } // i and d checked by the caller
         void ClearIndex(){ fIndex.clear();fIndex.resize( Dimension(), 0 ); }
+        int  DimFactor( int d ){ return fDimFactor[d]; }   // stride of dimension d in the flat array
 
         void * GetItem();
+        void * GetItemAt( int iG );  // item at the flat index iG, fIndex must point to the same item
         void * GetSingleItem();
 
         ///void LockBin(bool is=true){}//TODO
@@ -185,6 +188,7 @@ class AliJArrayBase : public AliJNamed{
 
         ArrayInt        fDim;           // Comment test
         ArrayInt        fIndex;         /// Comment test
+        ArrayInt        fDimFactor;     /// stride of each dimension in the flat array
         int         fArraySize;         /// Comment test3
         int         fNGenerated;
         bool        fIsBinFixed;
@@ -207,6 +211,7 @@ class AliJArrayAlgorithm {
         int Index(int i){ return fCMD->Index(i); }
         virtual int BuildArray()=0;
         virtual void * GetItem()=0;
+        virtual void * GetItemAt(int iG)=0;
         virtual void SetItem(void * item)=0;
         virtual void InitIterator()=0;
         virtual bool Next(void *& item) = 0;
@@ -230,6 +235,7 @@ class AliJArrayAlgorithmSimple : public AliJArrayAlgorithm {
         int  GlobalIndex();
         void ReverseIndex(int iG );
         virtual void * GetItem();
+        virtual void * GetItemAt(int iG){ return fArray[iG]; }
         virtual void SetItem(void * item);
         virtual void InitIterator(){ fPos = 0; }
         virtual void ** GetRawItem(){ return &fArray[GlobalIndex()]; }
@@ -352,20 +358,24 @@ class AliJTH1Derived : public AliJTH1 {
 template< typename T>
 class AliJTH1DerivedPlayer {
     public:
-        AliJTH1DerivedPlayer( AliJTH1Derived<T> * cmd ):fLevel(0),fCMD(cmd){};
+        AliJTH1DerivedPlayer( AliJTH1Derived<T> * cmd ):fLevel(0),fGlobalIndex(0),fCMD(cmd){};
+        // The flat index of the item is accumulated level by level, so that the
+        // item is found without recomputing it from the index of each dimension
         AliJTH1DerivedPlayer<T>& operator[](int i){
-            if( fLevel > fCMD->Dimension() ) { JERROR("Exceed Dimension"); }
+            if( fLevel >= fCMD->Dimension() ) { JERROR("Exceed Dimension"); }
             if( OutOf( i, 0,  fCMD->SizeOf(fLevel)-1) ){ JERROR(Form("wrong Index %d of %dth in ",i, fLevel)+fCMD->GetName()); }
-            fCMD->SetIndex(i, fLevel++);
+            fGlobalIndex += i*fCMD->DimFactor(fLevel);
+            fCMD->SetIndexFast(i, fLevel++);
             return *this;
         }
-        void Init(){ fLevel=0;fCMD->ClearIndex(); }
-        T* operator->(){ return static_cast<T*>(fCMD->GetItem()); } 
-        operator T*(){ return static_cast<T*>(fCMD->GetItem()); } 
-        operator TObject*(){ return static_cast<TObject*>(fCMD->GetItem()); } 
-        operator TH1*(){ return static_cast<TH1*>(fCMD->GetItem()); } 
+        void Init(){ fLevel=0;fGlobalIndex=0;fCMD->ClearIndex(); }
+        T* operator->(){ return static_cast<T*>(fCMD->GetItemAt(fGlobalIndex)); } 
+        operator T*(){ return static_cast<T*>(fCMD->GetItemAt(fGlobalIndex)); } 
+        operator TObject*(){ return static_cast<TObject*>(fCMD->GetItemAt(fGlobalIndex)); } 
+        operator TH1*(){ return static_cast<TH1*>(fCMD->GetItemAt(fGlobalIndex)); } 
     private:
         int fLevel;
+        int fGlobalIndex;
         AliJTH1Derived<T> * fCMD;
 };
 
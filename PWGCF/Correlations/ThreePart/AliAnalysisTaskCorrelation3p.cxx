@@ -103,6 +103,8 @@ AliAnalysisTaskCorrelation3p::AliAnalysisTaskCorrelation3p()
   , fCentralityPercentile(0)
   , fMultiplicity(0)
   , fBinVer(0)
+  , fNHarmonics(0)
+  , fHarmonicsOnly(kFALSE)
   , fMaxVz(10.0)
   , fMaxMult(0)
   , fMaxNumberOfTracksInPPConsidered(200)
@@ -182,6 +184,8 @@ AliAnalysisTaskCorrelation3p::AliAnalysisTaskCorrelation3p(const char *name, con
   , fCentralityPercentile(0)
   , fMultiplicity(0)
   , fBinVer(0)
+  , fNHarmonics(0)
+  , fHarmonicsOnly(kFALSE)
   , fMaxVz(10.0)
   , fMaxMult(0)
   , fMaxNumberOfTracksInPPConsidered(200)
@@ -294,6 +298,7 @@ void AliAnalysisTaskCorrelation3p::UserCreateOutputObjects()
     AliCorrelation3p* workertracktrigger =new AliCorrelation3p(tracksname, fMBinEdges, fZBinEdges);
     workertracktrigger->SetAcceptanceCut(fAcceptancecut);
     workertracktrigger->SetBinningVersion(fBinVer);
+    workertracktrigger->SetHarmonics(fNHarmonics,fHarmonicsOnly);
     workertracktrigger->Init(triggerinit);
     correlator->Add(workertracktrigger,fExtraMixed);
     fOutput->Add(correlator->GetCorrespondingME(workertracktrigger, 0));
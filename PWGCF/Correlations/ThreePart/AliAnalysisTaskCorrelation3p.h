@@ -76,6 +76,7 @@ class AliAnalysisTaskCorrelation3p : public AliAnalysisTaskSE {
   void SetQA(){fQA=kTRUE;}
   void SetQAtask(bool qatask){fqatask=qatask;}
   void SetBinVer(int binver){fBinVer=binver;}
+  void SetHarmonics(int nharmonics, bool only=kFALSE){fNHarmonics=nharmonics;fHarmonicsOnly=only;}
   void SetExtraMixed(bool extramixed){fExtraMixed=extramixed;}
   void SetLeading(bool leading){fLeading=leading;}
   void SetWeights(const char* file){
@@ -204,6 +205,8 @@ class AliAnalysisTaskCorrelation3p : public AliAnalysisTaskSE {
   Double_t 	    fCentralityPercentile;	
   Double_t 	    fMultiplicity;
   Int_t 	    fBinVer;
+  Int_t 	    fNHarmonics;//Harmonic cutoff of the Q-vector estimator of DPhi1 vs DPhi2, 0: off.
+  Bool_t 	    fHarmonicsOnly;//If true the explicit triplets are not filled, only the Q-vector estimator.
   //cut variables:
   ////event:
   Double_t	    fMaxVz;//Vertex cut variable.
@@ -239,7 +242,7 @@ class AliAnalysisTaskCorrelation3p : public AliAnalysisTaskSE {
   static const Int_t fNRunsP11a = 58;
   static const Int_t fNRunsP11h = 108;
   //Class definition.
-  ClassDef(AliAnalysisTaskCorrelation3p, 5);
+  ClassDef(AliAnalysisTaskCorrelation3p, 6);
 };
 
 #endif
\ No newline at end of file
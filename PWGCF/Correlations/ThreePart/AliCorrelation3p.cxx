@@ -40,6 +40,11 @@
 // using namespace std;
 const double gkPii =  TMath::Pi();
 
+namespace {
+  // Q_n for negative n from Q_{-n}, the sums are stored for n>=0 only
+  std::complex<double> Harmonic(const std::vector<std::complex<double> >& q, int n) {return n>=0?q[n]:std::conj(q[-n]);}
+}
+
 ClassImp(AliCorrelation3p)
 
 AliCorrelation3p::AliCorrelation3p(const char* name,TArrayD MBinEdges, TArrayD ZBinEdges)
@@ -62,6 +67,12 @@ AliCorrelation3p::AliCorrelation3p(const char* name,TArrayD MBinEdges, TArrayD Z
   , fbinver(0)
   , fCollisionType(PbPb)
   , fTriggerType(tracks)
+  , fNHarmonics(0)
+  , fFillTriplets(true)
+  , fQ1()
+  , fQ2()
+  , fQw2()
+  , fPairs()
 {
   // default constructor
 }
@@ -85,6 +96,12 @@ AliCorrelation3p::AliCorrelation3p(const AliCorrelation3p& other)
   , fbinver(other.fbinver)
   , fCollisionType(other.fCollisionType)
   , fTriggerType(other.fTriggerType)
+  , fNHarmonics(other.fNHarmonics)
+  , fFillTriplets(other.fFillTriplets)
+  , fQ1()
+  , fQ2()
+  , fQw2()
+  , fPairs()
 {
   // copy constructor
 }
@@ -176,6 +193,23 @@ int AliCorrelation3p::Init(const char* arguments)
       AliWarning(Form("Trigger Type set to: %s",param.Data()));
       continue;
     }
+    key="harmonics=";
+    if (token.BeginsWith(key)) {
+      TString param=token;
+      param.ReplaceAll(key, "");
+      fNHarmonics=param.Atoi();
+      continue;
+    }
+    key="harmonicsonly";
+    if (token.CompareTo(key)==0) {
+      fFillTriplets=false;
+      continue;
+    }
+  }
+  if (fNHarmonics<0) fNHarmonics=0;
+  if (!fFillTriplets&&fNHarmonics==0) {
+    AliWarning("harmonicsonly without harmonics, the explicit triplets are filled");
+    fFillTriplets=true;
   }
   if (fHistograms) delete fHistograms;
   fHistograms=new TObjArray(GetNumberHist(kNofHistograms+2,fMBinEdges.GetSize()-1,fZBinEdges.GetSize()-1));//One Extra for overflow
@@ -225,6 +259,10 @@ int AliCorrelation3p::Init(const char* arguments)
     a->AddAt(new TH2D(GetNameHist("hDeltaPhiVsDeltaEta2a"	 ,i,j),"#Delta#Phi_{12} vs #Delta#eta_{12}"		 ,nbinseta ,-2.0*fAcceptanceCut,2.0*fAcceptanceCut,nbinsphi,-0.5*gkPii,1.5*gkPii			       ),GetNumberHist(khPhiEtaa   ,i,j));// 2 particle correlation with two associated
     a->AddAt(new TH3F(GetNameHist("hDeltaPhiVsDeltaPhiVsDeltaEta",i,j),"#Delta#Phi_1 vs #Delta#Phi_2 vs #Delta#eta_{12}" ,nbinseta ,-2.0*fAcceptanceCut,2.0*fAcceptanceCut,nbinsphi,-0.5*gkPii,1.5*gkPii,nbinsphi ,-0.5*gkPii,1.5*gkPii),GetNumberHist(khPhiPhiDEta,i,j));//3d, DPhiDPhiDEta
     a->AddAt(new TH1D(GetNameHist("khQAtocheckadressing"         ,i,j),"Will be filled once per event. Should match the centvzbin histogram."   ,1  ,0 ,2),GetNumberHist(khQAtocheckadressing,i,j));
+    if(fNHarmonics>0){//Fourier coefficients c_{n,m} of DPhi1 vs DPhi2, x: n, y: m
+    a->AddAt(new TH2D(GetNameHist("hDeltaPhiDeltaPhiHarmonicsRe" ,i,j),"Re c_{n,m} of #Delta#Phi_1 vs #Delta#Phi_2"	 ,2*fNHarmonics+1,-fNHarmonics-0.5,fNHarmonics+0.5,2*fNHarmonics+1,-fNHarmonics-0.5,fNHarmonics+0.5),GetNumberHist(khPhiPhiHarmonicsRe,i,j));
+    a->AddAt(new TH2D(GetNameHist("hDeltaPhiDeltaPhiHarmonicsIm" ,i,j),"Im c_{n,m} of #Delta#Phi_1 vs #Delta#Phi_2"	 ,2*fNHarmonics+1,-fNHarmonics-0.5,fNHarmonics+0.5,2*fNHarmonics+1,-fNHarmonics-0.5,fNHarmonics+0.5),GetNumberHist(khPhiPhiHarmonicsIm,i,j));
+    }
     }
   }
   a->AddAt(new TH1D("overflow","overflow",3,0.0,1),GetNumberHist(kNofHistograms+1,fMBinEdges.GetSize()-1,fZBinEdges.GetSize()-1));
@@ -343,6 +381,121 @@ int AliCorrelation3p::FillTrigger(AliVParticle* ptrigger)
   HistFill(GetNumberHist(kHistNTriggers,fMBin,fVzBin),0.5,fillweight);//Increments number of triggers by weight. Call before filling with any associated.
   return 1;
 }
+int AliCorrelation3p::FillHarmonics(AliVParticle* ptrigger, const std::vector<AliVParticle*>& associated, const double weight)
+{
+  /// Fourier coefficients of DPhi1 vs DPhi2 from all ordered pairs i!=j of the associated,
+  /// the same pairs as Fill(trigger,p1,p2) and Fill(trigger,p2,p1) in the triplet loop.
+  /// With Q_n = sum w e^{in phi}, sum_{i!=j} w_i w_j e^{in phi_i} e^{im phi_j} = Q_n Q_m - Q_{n+m}(w^2),
+  /// the self correlations are removed exactly at a cost linear in the number of associated.
+  if (fNHarmonics<=0) return 0;
+  if (!ptrigger) return -EINVAL;
+  FillQVectors(ptrigger, associated, fQ1, &fQw2, 2*fNHarmonics);
+  const int n1=2*fNHarmonics+1;
+  fPairs.resize(n1*n1);
+  for (int n=-fNHarmonics; n<=fNHarmonics; n++) {
+    for (int m=-fNHarmonics; m<=fNHarmonics; m++) {
+      fPairs[(n+fNHarmonics)*n1+m+fNHarmonics] = Harmonic(fQ1,n)*Harmonic(fQ1,m) - Harmonic(fQw2,n+m);
+    }
+  }
+  FillHarmonicCoefficients(ptrigger, weight);
+  return 0;
+}
+int AliCorrelation3p::FillHarmonics(AliVParticle* ptrigger, const std::vector<AliVParticle*>& associated1, const std::vector<AliVParticle*>& associated2, const double weight)
+{
+  /// Fourier coefficients of DPhi1 vs DPhi2 from all pairs of two different sets of associated: Q_n(1) Q_m(2)
+  if (fNHarmonics<=0) return 0;
+  if (!ptrigger) return -EINVAL;
+  FillQVectors(ptrigger, associated1, fQ1, NULL, fNHarmonics);
+  FillQVectors(ptrigger, associated2, fQ2, NULL, fNHarmonics);
+  const int n1=2*fNHarmonics+1;
+  fPairs.resize(n1*n1);
+  for (int n=-fNHarmonics; n<=fNHarmonics; n++) {
+    for (int m=-fNHarmonics; m<=fNHarmonics; m++) {
+      fPairs[(n+fNHarmonics)*n1+m+fNHarmonics] = Harmonic(fQ1,n)*Harmonic(fQ2,m);
+    }
+  }
+  FillHarmonicCoefficients(ptrigger, weight);
+  return 0;
+}
+void AliCorrelation3p::FillQVectors(AliVParticle* ptrigger, const std::vector<AliVParticle*>& associated, std::vector<std::complex<double> >& q, std::vector<std::complex<double> >* q2, int nmax) const
+{
+  /// Q_n = sum w e^{in phi} for n=0..nmax of the associated paired with this trigger,
+  /// the per particle cuts of Fill(trigger,p1,p2): pT below the trigger pT and not the trigger itself.
+  /// If q2 is given it gets the same sums with the squared weights.
+  q.assign(nmax+1, std::complex<double>(0.0, 0.0));
+  if (q2) q2->assign(nmax+1, std::complex<double>(0.0, 0.0));
+  for (std::vector<AliVParticle*>::const_iterator p=associated.begin(), e=associated.end(); p!=e; ++p) {
+    if (!*p) continue;
+    if (ptrigger->Pt()<(*p)->Pt()) continue;
+    if (TMath::Abs((*p)->Eta()-ptrigger->Eta())<1.0E-10) continue;//Track duplicate, reject.
+    Double_t w = 1.0;
+    if (dynamic_cast<AliFilteredTrack*>(*p)) w = dynamic_cast<AliFilteredTrack*>(*p)->GetEff();
+    const std::complex<double> step = std::polar(1.0, (*p)->Phi());
+    std::complex<double> harmonic(1.0, 0.0);
+    for (int n=0; n<=nmax; n++) {
+      q[n] += w*harmonic;
+      if (q2) (*q2)[n] += w*w*harmonic;
+      harmonic *= step;
+    }
+  }
+}
+void AliCorrelation3p::FillHarmonicCoefficients(AliVParticle* ptrigger, const double weight)
+{
+  /// c_{n,m} = sum over pairs of e^{-i(n DPhi1 + m DPhi2)}: rotate the pair sums by the trigger phi and fill
+  const int n1=2*fNHarmonics+1;
+  if (fPairs[fNHarmonics*n1+fNHarmonics]==std::complex<double>(0.0, 0.0)) return;//No pairs for this trigger.
+  const Int_t hre = GetNumberHist(khPhiPhiHarmonicsRe,fMBin,fVzBin);
+  const Int_t him = GetNumberHist(khPhiPhiHarmonicsIm,fMBin,fVzBin);
+  for (int n=-fNHarmonics; n<=fNHarmonics; n++) {
+    for (int m=-fNHarmonics; m<=fNHarmonics; m++) {
+      const std::complex<double> c = weight*fPairs[(n+fNHarmonics)*n1+m+fNHarmonics]*std::polar(1.0, -(n+m)*ptrigger->Phi());
+      HistFill(hre, n, m, c.real());
+      HistFill(him, n, m, c.imag());
+    }
+  }
+}
+TH2D* AliCorrelation3p::HarmonicDeltaPhiDeltaPhi(Int_t Mbin, Int_t ZBin, const char* name, bool mixed) const
+{
+  /// DPhi1 (x) vs DPhi2 (y) from the Fourier coefficients with the binning of the triplet histogram.
+  /// Each bin is the integral of the truncated Fourier series over the bin,
+  /// f(x,y) = 1/(4 pi^2) sum c_{n,m} e^{i(nx+my)}, so the integral over all bins is the sum of the pair weights.
+  const AliCorrelation3p* source = mixed?fMixedEvent:this;
+  if (!source || !source->fHistograms) return NULL;
+  TH2D* hre = dynamic_cast<TH2D*>(source->fHistograms->At(GetNumberHist(khPhiPhiHarmonicsRe,Mbin,ZBin)));
+  TH2D* him = dynamic_cast<TH2D*>(source->fHistograms->At(GetNumberHist(khPhiPhiHarmonicsIm,Mbin,ZBin)));
+  TH3F* h3  = dynamic_cast<TH3F*>(source->fHistograms->At(GetNumberHist(khPhiPhiDEta,Mbin,ZBin)));
+  if (!hre || !him || !h3) return NULL;
+  const int nh = (hre->GetNbinsX()-1)/2;
+  const int nbins = h3->GetNbinsY();
+  const Double_t low = h3->GetYaxis()->GetXmin();
+  const Double_t high = h3->GetYaxis()->GetXmax();
+  TH2D* result = new TH2D(name, "#Delta#Phi_1 vs #Delta#Phi_2", nbins, low, high, nbins, low, high);
+  result->SetDirectory(0);
+  // integrals of e^{inx} over the bins
+  std::vector<std::complex<double> > integrals((2*nh+1)*nbins);
+  for (int n=-nh; n<=nh; n++) {
+    for (int bin=1; bin<=nbins; bin++) {
+      const Double_t a = result->GetXaxis()->GetBinLowEdge(bin);
+      const Double_t b = result->GetXaxis()->GetBinUpEdge(bin);
+      std::complex<double>& integral = integrals[(n+nh)*nbins+bin-1];
+      if (n==0) integral = std::complex<double>(b-a, 0.0);
+      else integral = (std::polar(1.0, n*b)-std::polar(1.0, n*a))/std::complex<double>(0.0, n);
+    }
+  }
+  for (int x=1; x<=nbins; x++) {
+    for (int y=1; y<=nbins; y++) {
+      Double_t content = 0;
+      for (int n=-nh; n<=nh; n++) {
+	for (int m=-nh; m<=nh; m++) {
+	  const std::complex<double> c(hre->GetBinContent(n+nh+1, m+nh+1), him->GetBinContent(n+nh+1, m+nh+1));
+	  content += (c*integrals[(n+nh)*nbins+x-1]*integrals[(m+nh)*nbins+y-1]).real();
+	}
+      }
+      result->SetBinContent(x, y, content/(4*gkPii*gkPii));
+    }
+  }
+  return result;
+}
 void AliCorrelation3p::Clear(Option_t * /*option*/)
 {
   /// overloaded from TObject: cleanup
@@ -1402,6 +1555,14 @@ int AliCorrelation3p::MakeResultsFile(const char* scalingmethod, bool recreate,b
 	  TH2D* DPHIDPHI3 = slice(DPHIDPHIDETA,"yz",1,DPHIDPHIDETA->GetNbinsX(),"DPhi_1_DPHI_2",kFALSE);
 	  PrepareHist(DPHIDPHI3,"#Delta#Phi_{1} vs #Delta#Phi_{2}","#Delta#Phi_{1} [rad]","#Delta#Phi_{2} [rad]","# Pairs");
 	  DPHIDPHI3->Write("DPhi_1_DPHI_2");
+	  if(fNHarmonics>0){
+	    TH2D* DPHIDPHIharmonics = HarmonicDeltaPhiDeltaPhi(mb,zb,"DPhi_1_DPHI_2_harmonics");
+	    if(DPHIDPHIharmonics){
+	      PrepareHist(DPHIDPHIharmonics,Form("#Delta#Phi_{1} vs #Delta#Phi_{2} up to the harmonic %i",fNHarmonics),"#Delta#Phi_{1} [rad]","#Delta#Phi_{2} [rad]","# Pairs");
+	      DPHIDPHIharmonics->Write("DPhi_1_DPHI_2_harmonics");
+	      delete DPHIDPHIharmonics;
+	    }
+	  }
 	  TH2D* DPHIDPHI3near =slice(DPHIDPHIDETA,"yz",DPHIDPHIDETA->GetXaxis()->FindBin(-0.4),DPHIDPHIDETA->GetXaxis()->FindBin(0.4),"DPhi_1_DPHI_2_near",kFALSE);
 	  PrepareHist(DPHIDPHI3near,"#Delta#Phi_{1} vs #Delta#Phi_{2} for #Delta#eta_{12}<=0.4","#Delta#Phi_{1} [rad]","#Delta#Phi_{2} [rad]","# Pairs");
 	  DPHIDPHI3near->Write("DPhi_1_DPHI_2_near");
@@ -1485,6 +1646,16 @@ int AliCorrelation3p::MakeResultsFile(const char* scalingmethod, bool recreate,b
 	  DPHIDPHI3m->Write("DPhi_1_DPHI_2");
 	  scale->Write("DPhi_1_DPHI_2_scale");
 	  scale->SetVal(0.0);
+	  if(fNHarmonics>0){
+	    TH2D* DPHIDPHIharmonicsm = HarmonicDeltaPhiDeltaPhi(mb,zb,"DPhi_1_DPHI_2_harmonics",true);
+	    if(DPHIDPHIharmonicsm){
+	      PrepareHist(DPHIDPHIharmonicsm,Form("#Delta#Phi_{1} vs #Delta#Phi_{2} up to the harmonic %i",fNHarmonics),"#Delta#Phi_{1} [rad]","#Delta#Phi_{2} [rad]","",true,scale);
+	      DPHIDPHIharmonicsm->Write("DPhi_1_DPHI_2_harmonics");
+	      scale->Write("DPhi_1_DPHI_2_harmonics_scale");
+	      scale->SetVal(0.0);
+	      delete DPHIDPHIharmonicsm;
+	    }
+	  }
 	  TH2D* DPHIDPHI3nearm = slice(DPHIDPHIDETAm,"yz",DPHIDPHIDETAm->GetXaxis()->FindBin(-0.4),DPHIDPHIDETAm->GetXaxis()->FindBin(0.4),"DPhi_1_DPHI_2_near",kFALSE);
 	  PrepareHist(DPHIDPHI3nearm,"#Delta#Phi_{1} vs #Delta#Phi_{2} for #Delta#eta_{12}<=0.4","#Delta#Phi_{1} [rad]","#Delta#Phi_{2} [rad]","",true,scale);
 	  DPHIDPHI3nearm->Write("DPhi_1_DPHI_2_near");
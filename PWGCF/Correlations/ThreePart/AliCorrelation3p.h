@@ -18,6 +18,8 @@
 #include "TF1.h"
 #include "TH2D.h"
 #include "TH3D.h"
+#include <vector>
+#include <complex>
 class TH1;
 class TH1F;
 class TH2F;
@@ -54,6 +56,12 @@ class AliCorrelation3p : public TNamed {
   int Fill( AliVParticle* trigger		, AliVParticle* p1				, const double weight=1.0);
   int Filla( AliVParticle* p1			, AliVParticle* p2				, const double weight=1.0);
   int FillTrigger( AliVParticle*ptrigger);
+  /// fill the Fourier coefficients of DPhi1 vs DPhi2 from all pairs of one set of associated
+  int FillHarmonics( AliVParticle* trigger	, const std::vector<AliVParticle*>& associated	, const double weight=1.0);
+  /// fill the Fourier coefficients of DPhi1 vs DPhi2 from the pairs of two sets of associated
+  int FillHarmonics( AliVParticle* trigger	, const std::vector<AliVParticle*>& associated1, const std::vector<AliVParticle*>& associated2, const double weight=1.0);
+  /// DPhi1 vs DPhi2 from the Fourier coefficients, same binning as the explicit triplet histograms
+  TH2D* HarmonicDeltaPhiDeltaPhi(Int_t Mbin, Int_t ZBin, const char* name, bool mixed = false) const;
   int MakeResultsFile(const char* scalingmethod, bool recreate=false, bool fakecor=false);
   /// overloaded from TObject: cleanup
   virtual void Clear(Option_t * option ="");
@@ -72,6 +80,10 @@ class AliCorrelation3p : public TNamed {
   void SetMixedEvent(AliCorrelation3p* pME) {fMixedEvent=pME;}
   void SetAcceptanceCut(float AccCut){fAcceptanceCut = AccCut;}
   void SetBinningVersion(int ver){fbinver = ver;}
+  /// Q-vector estimator of DPhi1 vs DPhi2 up to the harmonic nharmonics, if only is set the explicit triplets are not filled
+  void SetHarmonics(int nharmonics, bool only = false){fNHarmonics = nharmonics; fFillTriplets = !(only&&nharmonics>0);}
+  int  GetNHarmonics() const {return fNHarmonics;}
+  bool GetFillTriplets() const {return fFillTriplets;}
 
   TH1 * GetHistogram(Int_t khist, Int_t Mbin, Int_t ZBin, const char* histname){return PrepareHist(GetNumberHist(khist,Mbin,ZBin),histname,"","","");}
   enum {
@@ -92,6 +104,8 @@ class AliCorrelation3p : public TNamed {
 //     khPhiEtaDublicate, // TH2F
     khPhiPhiDEta, //TH3F
     khPhiPhiDEtaScaled, //TH3F
+    khPhiPhiHarmonicsRe, //TH2D
+    khPhiPhiHarmonicsIm, //TH2D
     kNofHistograms//number, but points to itself
   };
   enum{
@@ -133,6 +147,8 @@ class AliCorrelation3p : public TNamed {
   void AddHists(Bool_t isAverage,TH1* hist1, TH1* hist2);
   TH1* PrepareHist(int HistLocation,const char* HistName,const char* title, const char* xaxis, const char* yaxis,const char* zaxis = "",bool mixed = false);
   TH1* PrepareHist(TH1* Hist,const char* title, const char* xaxis, const char* yaxis,const char* zaxis = "",bool scale = false,TParameter<double> * par = NULL);
+  void FillQVectors(AliVParticle* trigger, const std::vector<AliVParticle*>& associated, std::vector<std::complex<double> >& q, std::vector<std::complex<double> >* q2, int nmax) const;
+  void FillHarmonicCoefficients(AliVParticle* trigger, const double weight);
 
   //Actual members
   TObjArray* fHistograms; // the histograms
@@ -156,8 +172,14 @@ class AliCorrelation3p : public TNamed {
   int fbinver;
   CollisionType fCollisionType;
   TriggerType fTriggerType;
+  int fNHarmonics; // harmonic cutoff of the Q-vector estimator of DPhi1 vs DPhi2, 0: not filled
+  bool fFillTriplets; // fill DPhi1 vs DPhi2 vs DEta12 from the explicit triplets
+  std::vector<std::complex<double> > fQ1; //! Q-vectors of the first associated
+  std::vector<std::complex<double> > fQ2; //! Q-vectors of the second associated
+  std::vector<std::complex<double> > fQw2; //! Q-vectors with the squared weights, self correlations
+  std::vector<std::complex<double> > fPairs; //! Fourier coefficients of the pairs for the current trigger
 
   //Class definition.
-  ClassDef(AliCorrelation3p, 6)
+  ClassDef(AliCorrelation3p, 7)
 };
 #endif
@@ -18,6 +18,7 @@
 #include "TF1.h"
 #include "TH2D.h"
 #include "TH3D.h"
+#include <vector>
 class TH1;
 class TH1F;
 class TH2F;
@@ -54,6 +55,11 @@ class AliCorrelation3p_noQA : public TNamed {
   int Fill( AliVParticle* trigger		, AliVParticle* p1				, const double weight=1.0);
   int Filla( AliVParticle* p1			, AliVParticle* p2				, const double weight=1.0);
   int FillTrigger( AliVParticle*ptrigger);
+  /// the Q-vector estimator of DPhi1 vs DPhi2 is only in AliCorrelation3p, the triplets are always filled
+  int FillHarmonics( AliVParticle* /*trigger*/, const std::vector<AliVParticle*>& /*associated*/, const double /*weight*/=1.0){return 0;}
+  int FillHarmonics( AliVParticle* /*trigger*/, const std::vector<AliVParticle*>& /*associated1*/, const std::vector<AliVParticle*>& /*associated2*/, const double /*weight*/=1.0){return 0;}
+  int  GetNHarmonics() const {return 0;}
+  bool GetFillTriplets() const {return true;}
   int MakeResultsFile(const char* scalingmethod, bool recreate=false, bool all=false);
   /// overloaded from TObject: cleanup
   virtual void Clear(Option_t * option ="");
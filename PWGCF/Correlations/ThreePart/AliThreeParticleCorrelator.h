@@ -256,24 +256,31 @@ class AliThreeParticleCorrelator : public TNamed {
     Double_t weighta2 = 1.0;
     if(NAssociated==0) return 0;//No associated means we need not fill anything.
     if (activeTriggers.size()==0) return 0;//No Triggers means we need not fill anything
+    //Without the explicit triplets only the a-a 2p correlation needs the pairs, once per event.
+    const bool triplets = AnalysisObject->GetFillTriplets();
     for (typename std::vector<AliVParticle*>::const_iterator trigger=activeTriggers.begin(), e=activeTriggers.end(); trigger!=e; ++trigger) {
       AnalysisObject->FillTrigger(*trigger);//Fill histogram for number of triggers.
       weightt = 1.0;
       if(dynamic_cast<AliFilteredTrack*>(*trigger))weightt = dynamic_cast<AliFilteredTrack*>(*trigger)->GetEff();
+      if(AnalysisObject->GetNHarmonics()>0) AnalysisObject->FillHarmonics(*trigger,associated,weightt);//Q-vectors, linear in the number of associated.
       for (typename std::vector<AliVParticle*>::const_iterator assoc=associated.begin(), eassoc=associated.end(); assoc!=eassoc; ++assoc) {
 	weighta1 = 1.0;
 	if(dynamic_cast<AliFilteredTrack*>(*assoc))weighta1 = dynamic_cast<AliFilteredTrack*>(*assoc)->GetEff();
+	if(triplets||trigger==activeTriggers.begin()){
 	for (typename std::vector<AliVParticle*>::const_iterator assoc2=assoc+1, eassoc2 = associated.end(); assoc2 !=eassoc2;++assoc2){
 	  weighta2 = 1.0;
 	  if(dynamic_cast<AliFilteredTrack*>(*assoc2))weighta2 = dynamic_cast<AliFilteredTrack*>(*assoc2)->GetEff();
-	  AnalysisObject->Fill(*trigger,*assoc,*assoc2,weightt*weighta1*weighta2);//Fill histogram for number of triggers.
-	  AnalysisObject->Fill(*trigger,*assoc2,*assoc,weightt*weighta1*weighta2);//Fill histogram for number of triggers.
+	  if(triplets){
+	    AnalysisObject->Fill(*trigger,*assoc,*assoc2,weightt*weighta1*weighta2);//Fill histogram for number of triggers.
+	    AnalysisObject->Fill(*trigger,*assoc2,*assoc,weightt*weighta1*weighta2);//Fill histogram for number of triggers.
+	  }
 	  if(trigger==activeTriggers.begin()){
 	    //once per event fill the a-a 2p correlation histogram symmitrized
 	    AnalysisObject->Filla(*assoc,*assoc2,weighta1*weighta2);
 	    AnalysisObject->Filla(*assoc2,*assoc,weighta1*weighta2);
 	  }
 	}//loop over second associated
+	}
 	AnalysisObject->Fill(*trigger,*assoc,weightt*weighta1);//Fill histogram for number of triggers.	        
       } // loop over first associated
     } // loop over triggers
@@ -289,23 +296,28 @@ class AliThreeParticleCorrelator : public TNamed {
     Double_t weighta2 = 1.0;
     if(NAssociated1==0||NAssociated2==0) return 0;//No associated means we need not fill anything.
     if (activeTriggers.size()==0) return 0;//no triggers means nothing to be correlated
+    //Without the explicit triplets only the a-a 2p correlation needs the pairs, once per event.
+    const bool triplets = AnalysisObject->GetFillTriplets();
     for (typename std::vector<AliVParticle*>::const_iterator trigger=activeTriggers.begin(), e=activeTriggers.end(); trigger!=e; ++trigger) {
       AnalysisObject->FillTrigger(*trigger);//Fill histogram for number of triggers.
       weightt = 1.0;
       if(dynamic_cast<AliFilteredTrack*>(*trigger))weightt = dynamic_cast<AliFilteredTrack*>(*trigger)->GetEff();
+      if(AnalysisObject->GetNHarmonics()>0) AnalysisObject->FillHarmonics(*trigger,associated,associatedmixed,weightt);//Q-vectors, linear in the number of associated.
       for (typename std::vector<AliVParticle*>::const_iterator assoc=associated.begin(), eassoc=associated.end(); assoc!=eassoc; ++assoc) {
 	weighta1 = 1.0;
 	if(dynamic_cast<AliFilteredTrack*>(*assoc))weighta1 = dynamic_cast<AliFilteredTrack*>(*assoc)->GetEff();
+	if(triplets||trigger==activeTriggers.begin()){
 	for (typename std::vector<AliVParticle*>::const_iterator assoc2=associatedmixed.begin(), eassoc2 = associatedmixed.end(); assoc2 !=eassoc2;++assoc2){
 	  weighta2 = 1.0;
 	  if(dynamic_cast<AliFilteredTrack*>(*assoc2))weighta2 = dynamic_cast<AliFilteredTrack*>(*assoc2)->GetEff();
-	  AnalysisObject->Fill(*trigger,*assoc,*assoc2,weightt*weighta1*weighta2);//Fill histogram for number of triggers.
+	  if(triplets) AnalysisObject->Fill(*trigger,*assoc,*assoc2,weightt*weighta1*weighta2);//Fill histogram for number of triggers.
 	  if(trigger==activeTriggers.begin()){
 	    //once per event fill the a-a 2p correlation histogram
 	    AnalysisObject->Filla(*assoc,*assoc2,weighta1*weighta2);
 	    AnalysisObject->Filla(*assoc2,*assoc,weighta1*weighta2);
 	  }
 	}//loop over second associated
+	}
 	if (twop){
 	  AnalysisObject->Fill(*trigger,*assoc,weightt*weighta1);//Fill histogram for number of triggers.  
 	  }
@@ -29,6 +29,7 @@
 #include <TH3D.h>
 #include <TLorentzVector.h>
 #include <TObjArray.h>
+#include <TArrayD.h>
 #include <TGraphErrors.h>
 #include <TString.h>
 #include <TSpline.h>
@@ -451,6 +452,22 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
     secondCharge[i]  = (Short_t)((AliVParticle*) particlesSecond->At(i))->Charge();
     secondCorrection[i]  = (Double_t)((AliBFBasicParticle*) particlesSecond->At(i))->Correction();   //==========================correction
   }
+
+  // the accepted pairs of a trigger particle are collected per charge combination
+  // and filled with one AliTHn::FillN call per container after the 2nd particle loop
+  const Int_t kNChargeCombinations = 4;
+  AliTHn *pairHist[kNChargeCombinations] = {fHistPN, fHistNP, fHistPP, fHistNN};
+  TArrayD pairVariables[kNChargeCombinations][kTrackVariablesPair];
+  TArrayD pairWeights[kNChargeCombinations];
+  Double_t *pairVariablesPtr[kNChargeCombinations][kTrackVariablesPair];
+  Int_t nPairs[kNChargeCombinations];
+  for (Int_t iComb = 0; iComb < kNChargeCombinations; iComb++){
+    pairWeights[iComb].Set(jMax);
+    for (Int_t iVar = 0; iVar < kTrackVariablesPair; iVar++){
+      pairVariables[iComb][iVar].Set(jMax);
+      pairVariablesPtr[iComb][iVar] = pairVariables[iComb][iVar].GetArray();
+    }
+  }
   
   //TLorenzVector implementation for resonances
   TLorentzVector vectorMother, vectorDaughter[2];
@@ -512,6 +529,9 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
     if(charge1 > 0)      fHistP->Fill(trackVariablesSingle,0,firstCorrection); //==========================correction
     else if(charge1 < 0) fHistN->Fill(trackVariablesSingle,0,firstCorrection);  //==========================correction
     
+    for (Int_t iComb = 0; iComb < kNChargeCombinations; iComb++)
+      nPairs[iComb] = 0;
+
     // 2nd particle loop
     for(Int_t j = 0; j < jMax; j++) {   
 
@@ -689,15 +709,25 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
 
       }
 
-      if( charge1 > 0 && charge2 < 0)  fHistPN->Fill(trackVariablesPair,0,firstCorrection*secondCorrection[j]); //==========================correction
-      else if( charge1 < 0 && charge2 > 0)  fHistNP->Fill(trackVariablesPair,0,firstCorrection*secondCorrection[j]);//==========================correction 
-      else if( charge1 > 0 && charge2 > 0)  fHistPP->Fill(trackVariablesPair,0,firstCorrection*secondCorrection[j]);//==========================correction 
-      else if( charge1 < 0 && charge2 < 0)  fHistNN->Fill(trackVariablesPair,0,firstCorrection*secondCorrection[j]);//==========================correction 
+      Int_t iComb = -1;
+      if( charge1 > 0 && charge2 < 0)  iComb = 0; // fHistPN
+      else if( charge1 < 0 && charge2 > 0)  iComb = 1; // fHistNP
+      else if( charge1 > 0 && charge2 > 0)  iComb = 2; // fHistPP
+      else if( charge1 < 0 && charge2 < 0)  iComb = 3; // fHistNN
       else {
 	//AliWarning(Form("Wrong charge combination: charge1 = %d and charge2 = %d",charge,charge2));
 	continue;
       }
+
+      for (Int_t iVar = 0; iVar < kTrackVariablesPair; iVar++)
+	pairVariablesPtr[iComb][iVar][nPairs[iComb]] = trackVariablesPair[iVar];
+      pairWeights[iComb][nPairs[iComb]] = firstCorrection*secondCorrection[j]; //==========================correction
+      nPairs[iComb]++;
     }//end of 2nd particle loop
+
+    // same entries and order per container as with one Fill() per pair
+    for (Int_t iComb = 0; iComb < kNChargeCombinations; iComb++)
+      pairHist[iComb]->FillN(nPairs[iComb],pairVariablesPtr[iComb],0,pairWeights[iComb].GetArray());
   }//end of 1st particle loop
 }  
 
@@ -6,6 +6,7 @@
 #include "TProfile2D.h" 
 #include "TH2D.h" 
 #include "TH3D.h" 
+#include "TObjArray.h"
 
 #include "AliStack.h"
 #include "AliMCEvent.h"
@@ -44,6 +45,7 @@ AliAnalysisNetParticleDistribution::AliAnalysisNetParticleDistribution() :
   AliAnalysisNetParticleBase("Dist", "Dist"),
 
   fOutList(NULL),
+  fHistSetCache(NULL),
 
   fOrder(8),
   fNNp(6),
@@ -91,6 +93,8 @@ AliAnalysisNetParticleDistribution::~AliAnalysisNetParticleDistribution() {
     if (fRedFactp[ii]) delete[] fRedFactp[ii];
   if (fRedFactp) delete[] fRedFactp;
 
+  if (fHistSetCache) delete fHistSetCache;
+
   return;
 }
 
@@ -204,6 +208,9 @@ void AliAnalysisNetParticleDistribution::Reset() {
 void AliAnalysisNetParticleDistribution::CreateHistograms() {
   // -- Add histograms to outlist
 
+  fHistSetCache = new TList;
+  fHistSetCache->SetOwner(kTRUE);
+
   // ------------------------------------------------------------------
   // -- Get Probe Particle Container
   // ------------------------------------------------------------------
@@ -701,6 +708,8 @@ void  AliAnalysisNetParticleDistribution::AddHistSetCent(const Char_t *name, con
 			       Form("f_ik counts : %s Cent %d;i;k;", sTitle.Data(), idxCent),
 			       fOrder+1, -0.5, Double_t(fOrder)+0.49, fOrder+1, -0.5, Double_t(fOrder)+0.49));
   }
+
+  CacheHistSet(name, kFALSE);
   
   return;
 }
@@ -813,6 +822,8 @@ void  AliAnalysisNetParticleDistribution::AddHistSetCentPt(const Char_t *name, c
 				 fOrder+1, -0.5, Double_t(fOrder)+0.49, fOrder+1, -0.5, Double_t(fOrder)+0.49, nBinsPt+1, -0.5, Double_t(nBinsPt)+0.49));
   }
 
+  CacheHistSet(name, kTRUE);
+
   return;
 }
 
@@ -821,8 +832,9 @@ void AliAnalysisNetParticleDistribution::FillHistSetCent(const Char_t *name, Int
   // -- Fill histogram sets for particle and anti-particle
   //    dependence : centrality 
   
-  // -- Get List
-  TList *list = static_cast<TList*>(fOutList->FindObject(Form("f%s",name)));
+  // -- Get cached histograms
+  TObjArray *hists = static_cast<TObjArray*>(fHistSetCache->FindObject(name));
+  const Int_t nDist = 8;
   
   // -- Get Centrality Bin
   Float_t centralityBin = fHelper->GetCentralityBin();
@@ -836,15 +848,15 @@ void AliAnalysisNetParticleDistribution::FillHistSetCent(const Char_t *name, Int
   Int_t deltaNp = np[idx][1]-np[idx][0];  // p - pbar
 
   // -- Fill Particle / Anti-Particle Distributions
-  (static_cast<TH2D*>(list->FindObject(Form("h%s%s", name, fHelper->GetParticleName(0).Data()))))->Fill(centralityBin, np[idx][0]);
-  (static_cast<TH2D*>(list->FindObject(Form("h%s%s", name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, np[idx][1]);
+  (static_cast<TH2D*>(hists->UncheckedAt(0)))->Fill(centralityBin, np[idx][0]);
+  (static_cast<TH2D*>(hists->UncheckedAt(1)))->Fill(centralityBin, np[idx][1]);
 
   // -- Fill NetParticle Distributions
-  (static_cast<TH2D*>(list->FindObject(Form("h%sNet%s",  name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, deltaNp);
+  (static_cast<TH2D*>(hists->UncheckedAt(2)))->Fill(centralityBin, deltaNp);
 
   // -- Fill NetParticle vs SumParticle
   Double_t deltaNpOverSumNp = (sumNp == 0.) ? 0. : deltaNp/Double_t(sumNp);
-  (static_cast<TH2D*>(list->FindObject(Form("h%sNet%sOverSum", name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, deltaNpOverSumNp);
+  (static_cast<TH2D*>(hists->UncheckedAt(3)))->Fill(centralityBin, deltaNpOverSumNp);
 
   // -----------------------------------------------------------------------------------------------
 
@@ -854,24 +866,25 @@ void AliAnalysisNetParticleDistribution::FillHistSetCent(const Char_t *name, Int
   Double_t deltaNpX = np[idx][1]-(np[idx][0]*CENT[Int_t(centralityBin)]);
 
   // -- Fill Particle / Anti-Particle Distributions
-  (static_cast<TH2D*>(list->FindObject(Form("h%s%sX", name, fHelper->GetParticleName(0).Data()))))->Fill(centralityBin, np[idx][0]*CENT[Int_t(centralityBin)]);
-  (static_cast<TH2D*>(list->FindObject(Form("h%s%sX", name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, np[idx][1]);
+  (static_cast<TH2D*>(hists->UncheckedAt(4)))->Fill(centralityBin, np[idx][0]*CENT[Int_t(centralityBin)]);
+  (static_cast<TH2D*>(hists->UncheckedAt(5)))->Fill(centralityBin, np[idx][1]);
 
   // -- Fill NetParticle Distributions
-  (static_cast<TH2D*>(list->FindObject(Form("h%sNet%sX",  name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, deltaNpX);
+  (static_cast<TH2D*>(hists->UncheckedAt(6)))->Fill(centralityBin, deltaNpX);
 
   // -- Fill NetParticle vs SumParticle
   Double_t deltaNpXOverSumNpX = (sumNpX == 0.) ? 0. : deltaNpX/sumNpX;
-  (static_cast<TH2D*>(list->FindObject(Form("h%sNet%sOverSumX", name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, deltaNpXOverSumNpX);
+  (static_cast<TH2D*>(hists->UncheckedAt(7)))->Fill(centralityBin, deltaNpXOverSumNpX);
 
   // -----------------------------------------------------------------------------------------------
 
   // -- Fill TProfile for <NetParticle^k>
+  Int_t idxSample = fHelper->GetSubSampleIdx() + 1;
   Double_t delta = 1.;
   for (Int_t idxOrder = 1; idxOrder <= fOrder; ++idxOrder) {
     delta *= deltaNp;
-    (static_cast<TProfile*>(list->FindObject(Form("p%sNet%s%dM", name, fHelper->GetParticleName(1).Data(), idxOrder))))->Fill(centralityBin, delta);
-    (static_cast<TProfile*>(list->FindObject(Form("p%sNet%s%dM_%02d", name, fHelper->GetParticleName(1).Data(), idxOrder, fHelper->GetSubSampleIdx()))))->Fill(centralityBin, delta);
+    (static_cast<TProfile*>(hists->UncheckedAt(GetHistSetIdxMoment(nDist, 0, idxOrder))))->Fill(centralityBin, delta);
+    (static_cast<TProfile*>(hists->UncheckedAt(GetHistSetIdxMoment(nDist, idxSample, idxOrder))))->Fill(centralityBin, delta);
   }
 
   // -- Generate reduced factorials - explictly removing the factorials
@@ -888,18 +901,15 @@ void AliAnalysisNetParticleDistribution::FillHistSetCent(const Char_t *name, Int
   }
 
   // -- Fill TProfiles for <f_ik> 
-  TList *fikList    = static_cast<TList*>(list->FindObject(Form("f%sFik",name)));
-  TList *fikListSub = static_cast<TList*>(list->FindObject(Form("f%sFik_%02d",name, fHelper->GetSubSampleIdx())));
-  TH2D  *hCntik     = static_cast<TH2D*>(fikList->FindObject(Form("p%sNet%sFCounts_%02d", name, fHelper->GetParticleName(1).Data(), Int_t(centralityBin))));
-  TH2D  *hCntikSub  = static_cast<TH2D*>(fikListSub->FindObject(Form("p%sNet%sFCounts_%02d_%02d", name, fHelper->GetParticleName(1).Data(), Int_t(centralityBin), fHelper->GetSubSampleIdx())));
+  TH2D  *hCntik     = static_cast<TH2D*>(hists->UncheckedAt(GetHistSetIdxCounts(nDist, 0, Int_t(centralityBin))));
+  TH2D  *hCntikSub  = static_cast<TH2D*>(hists->UncheckedAt(GetHistSetIdxCounts(nDist, idxSample, Int_t(centralityBin))));
 
   for (Int_t ii = 0; ii <= fOrder; ++ii) {   // ii -> p    -> n1
     for (Int_t kk = 0; kk <= fOrder; ++kk) { // kk -> pbar -> n2
       // -- use the reduced factorials only 
       Double_t fik = fRedFactp[ii][1] * fRedFactp[kk][0];   // n1 *n2 -> p * pbar
-      (static_cast<TProfile*>(fikList->FindObject(Form("p%sNet%sF%02d%02d", name, fHelper->GetParticleName(1).Data(), ii, kk))))->Fill(centralityBin, fik);
-      (static_cast<TProfile*>(fikListSub->FindObject(Form("p%sNet%sF%02d%02d_%02d", 
-							  name, fHelper->GetParticleName(1).Data(), ii, kk, fHelper->GetSubSampleIdx()))))->Fill(centralityBin, fik);
+      (static_cast<TProfile*>(hists->UncheckedAt(GetHistSetIdxFik(nDist, 0, ii, kk))))->Fill(centralityBin, fik);
+      (static_cast<TProfile*>(hists->UncheckedAt(GetHistSetIdxFik(nDist, idxSample, ii, kk))))->Fill(centralityBin, fik);
 
       if (fik != 0.) {
 	hCntik->Fill(ii, kk);
@@ -916,8 +926,10 @@ void AliAnalysisNetParticleDistribution::FillHistSetCentPt(const Char_t *name, I
   // -- Add histogram sets for particle and anti-particle
   //    dependence : centrality and pt
 
-  // -- Get List
-  TList *list = static_cast<TList*>(fOutList->FindObject(Form("f%s",name)));  
+  // -- Get cached histograms
+  TObjArray *hists = static_cast<TObjArray*>(fHistSetCache->FindObject(name));
+  const Int_t nDist = 4;
+  Int_t idxSample   = fHelper->GetSubSampleIdx() + 1;
 
   // -- Get Centrality Bin
   Float_t centralityBin = fHelper->GetCentralityBin();
@@ -934,15 +946,15 @@ void AliAnalysisNetParticleDistribution::FillHistSetCentPt(const Char_t *name, I
     Int_t sumNp   = npPt[idx][1][idxPt]+npPt[idx][0][idxPt]; // p + pbar
 
     // -- Fill Particle / Anti-Particle Distributions
-    (static_cast<TH3D*>(list->FindObject(Form("h%s%s", name, fHelper->GetParticleName(0).Data()))))->Fill(centralityBin, idxPt, npPt[idx][0][idxPt]);
-    (static_cast<TH3D*>(list->FindObject(Form("h%s%s", name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, idxPt, npPt[idx][1][idxPt]);
+    (static_cast<TH3D*>(hists->UncheckedAt(0)))->Fill(centralityBin, idxPt, npPt[idx][0][idxPt]);
+    (static_cast<TH3D*>(hists->UncheckedAt(1)))->Fill(centralityBin, idxPt, npPt[idx][1][idxPt]);
     
     // -- Fill NetParticle Distributions
-    (static_cast<TH3D*>(list->FindObject(Form("h%sNet%s",  name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, idxPt, deltaNp);
+    (static_cast<TH3D*>(hists->UncheckedAt(2)))->Fill(centralityBin, idxPt, deltaNp);
     
     // -- Fill NetParticle vs SumParticle
     Double_t deltaNpOverSumNp = (sumNp == 0.) ? 0. : deltaNp/Double_t(sumNp);
-    (static_cast<TH3D*>(list->FindObject(Form("h%sNet%sOverSum", name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, idxPt, deltaNpOverSumNp);
+    (static_cast<TH3D*>(hists->UncheckedAt(3)))->Fill(centralityBin, idxPt, deltaNpOverSumNp);
 
     // -----------------------------------------------------------------------------------------------
 
@@ -950,9 +962,8 @@ void AliAnalysisNetParticleDistribution::FillHistSetCentPt(const Char_t *name, I
     Double_t delta = 1.;
     for (Int_t idxOrder = 1; idxOrder <= fOrder; ++idxOrder) {
       delta *= deltaNp;
-      (static_cast<TProfile2D*>(list->FindObject(Form("p%sNet%s%dM", name, fHelper->GetParticleName(1).Data(), idxOrder))))->Fill(centralityBin, idxPt, delta);
-      (static_cast<TProfile2D*>(list->FindObject(Form("p%sNet%s%dM_%02d", 
-						      name, fHelper->GetParticleName(1).Data(), idxOrder, fHelper->GetSubSampleIdx()))))->Fill(centralityBin, idxPt, delta);
+      (static_cast<TProfile2D*>(hists->UncheckedAt(GetHistSetIdxMoment(nDist, 0, idxOrder))))->Fill(centralityBin, idxPt, delta);
+      (static_cast<TProfile2D*>(hists->UncheckedAt(GetHistSetIdxMoment(nDist, idxSample, idxOrder))))->Fill(centralityBin, idxPt, delta);
     }
     
     // -- Generate reduced factorials - explictly removing the factorials
@@ -969,17 +980,13 @@ void AliAnalysisNetParticleDistribution::FillHistSetCentPt(const Char_t *name, I
     }
 
     // -- Fill TProfiles for <f_ik> 
-    TList *fikListPt    = static_cast<TList*>(list->FindObject(Form("f%sPtFik",name)));
-    TList *fikListPtSub = static_cast<TList*>(list->FindObject(Form("f%sPtFik_%02d",name, fHelper->GetSubSampleIdx())));
-    TH3D  *hCntikPt     = static_cast<TH3D*>(fikListPt->FindObject(Form("p%sNet%sFCounts_%02d", name, fHelper->GetParticleName(1).Data(), Int_t(centralityBin))));
-    TH3D  *hCntikPtSub  = static_cast<TH3D*>(fikListPtSub->FindObject(Form("p%sNet%sFCounts_%02d_%02d", name, fHelper->GetParticleName(1).Data(), 
-									   Int_t(centralityBin), fHelper->GetSubSampleIdx())));
+    TH3D  *hCntikPt     = static_cast<TH3D*>(hists->UncheckedAt(GetHistSetIdxCounts(nDist, 0, Int_t(centralityBin))));
+    TH3D  *hCntikPtSub  = static_cast<TH3D*>(hists->UncheckedAt(GetHistSetIdxCounts(nDist, idxSample, Int_t(centralityBin))));
     for (Int_t ii = 0; ii <= fOrder; ++ii) {   // ii -> p    -> n1
       for (Int_t kk = 0; kk <= fOrder; ++kk) { // kk -> pbar -> n2
 	Double_t fik = fRedFactp[ii][1] * fRedFactp[kk][0];   // n1 *n2 -> p * pbar
-	(static_cast<TProfile2D*>(fikListPt->FindObject(Form("p%sNet%sF%02d%02d", name, fHelper->GetParticleName(1).Data(), ii, kk))))->Fill(centralityBin, idxPt, fik);
-	(static_cast<TProfile2D*>(fikListPtSub->FindObject(Form("p%sNet%sF%02d%02d_%02d", 
-								name, fHelper->GetParticleName(1).Data(), ii, kk, fHelper->GetSubSampleIdx()))))->Fill(centralityBin, idxPt, fik);
+	(static_cast<TProfile2D*>(hists->UncheckedAt(GetHistSetIdxFik(nDist, 0, ii, kk))))->Fill(centralityBin, idxPt, fik);
+	(static_cast<TProfile2D*>(hists->UncheckedAt(GetHistSetIdxFik(nDist, idxSample, ii, kk))))->Fill(centralityBin, idxPt, fik);
 	
 	if (fik != 0.) {
 	  hCntikPt->Fill(ii, kk, idxPt);
@@ -993,3 +1000,92 @@ void AliAnalysisNetParticleDistribution::FillHistSetCentPt(const Char_t *name, I
   return;
 }
 
+//________________________________________________________________________
+void AliAnalysisNetParticleDistribution::CacheHistSet(const Char_t *name, Bool_t isPt)  {
+  // -- Collect the histograms of a set in the order of GetHistSetIdx*()
+  //    the Fill methods then do not need a search by name per histogram and event
+
+  TList *list = static_cast<TList*>(fOutList->FindObject(Form("f%s",name)));
+
+  TObjArray *hists = new TObjArray;
+  hists->SetName(name);
+
+  TString sPart0(fHelper->GetParticleName(0));
+  TString sPart1(fHelper->GetParticleName(1));
+  const Char_t *part0 = sPart0.Data();
+  const Char_t *part1 = sPart1.Data();
+  const Char_t *sPt   = (isPt) ? "Pt" : "";
+
+  // -- Distributions
+  hists->Add(list->FindObject(Form("h%s%s", name, part0)));
+  hists->Add(list->FindObject(Form("h%s%s", name, part1)));
+  hists->Add(list->FindObject(Form("h%sNet%s", name, part1)));
+  hists->Add(list->FindObject(Form("h%sNet%sOverSum", name, part1)));
+  if (!isPt) {
+    hists->Add(list->FindObject(Form("h%s%sX", name, part0)));
+    hists->Add(list->FindObject(Form("h%s%sX", name, part1)));
+    hists->Add(list->FindObject(Form("h%sNet%sX", name, part1)));
+    hists->Add(list->FindObject(Form("h%sNet%sOverSumX", name, part1)));
+  }
+
+  // -- <NetParticle^k>
+  for (Int_t idxSample = 0; idxSample <= fHelper->GetNSubSamples(); ++idxSample) {
+    for (Int_t idxOrder = 1; idxOrder <= fOrder; ++idxOrder) {
+      if (idxSample == 0)
+	hists->Add(list->FindObject(Form("p%sNet%s%dM", name, part1, idxOrder)));
+      else
+	hists->Add(list->FindObject(Form("p%sNet%s%dM_%02d", name, part1, idxOrder, idxSample-1)));
+    }
+  }
+
+  // -- <f_ik>
+  for (Int_t idxSample = 0; idxSample <= fHelper->GetNSubSamples(); ++idxSample) {
+    TList *fikList = (idxSample == 0) ? static_cast<TList*>(list->FindObject(Form("f%s%sFik", name, sPt))) 
+      : static_cast<TList*>(list->FindObject(Form("f%s%sFik_%02d", name, sPt, idxSample-1)));
+    for (Int_t ii = 0; ii <= fOrder; ++ii) {
+      for (Int_t kk = 0; kk <= fOrder; ++kk) {
+	if (idxSample == 0)
+	  hists->Add(fikList->FindObject(Form("p%sNet%sF%02d%02d", name, part1, ii, kk)));
+	else
+	  hists->Add(fikList->FindObject(Form("p%sNet%sF%02d%02d_%02d", name, part1, ii, kk, idxSample-1)));
+      }
+    }
+  }
+
+  // -- f_ik counts
+  for (Int_t idxSample = 0; idxSample <= fHelper->GetNSubSamples(); ++idxSample) {
+    TList *fikList = (idxSample == 0) ? static_cast<TList*>(list->FindObject(Form("f%s%sFik", name, sPt))) 
+      : static_cast<TList*>(list->FindObject(Form("f%s%sFik_%02d", name, sPt, idxSample-1)));
+    for (Int_t idxCent = 0; idxCent < AliAnalysisNetParticleHelper::fgkfHistNBinsCent; ++idxCent) {
+      if (idxSample == 0)
+	hists->Add(fikList->FindObject(Form("p%sNet%sFCounts_%02d", name, part1, idxCent)));
+      else
+	hists->Add(fikList->FindObject(Form("p%sNet%sFCounts_%02d_%02d", name, part1, idxCent, idxSample-1)));
+    }
+  }
+
+  fHistSetCache->Add(hists);
+
+  return;
+}
+
+//________________________________________________________________________
+Int_t AliAnalysisNetParticleDistribution::GetHistSetIdxMoment(Int_t nDist, Int_t idxSample, Int_t idxOrder) const {
+  // -- Index of <NetParticle^idxOrder> of sample idxSample in the cache of a set
+
+  return nDist + idxSample*fOrder + (idxOrder-1);
+}
+
+//________________________________________________________________________
+Int_t AliAnalysisNetParticleDistribution::GetHistSetIdxFik(Int_t nDist, Int_t idxSample, Int_t ii, Int_t kk) const {
+  // -- Index of <f_ik> of sample idxSample in the cache of a set
+
+  return GetHistSetIdxMoment(nDist, fHelper->GetNSubSamples()+1, 1) + (idxSample*(fOrder+1) + ii)*(fOrder+1) + kk;
+}
+
+//________________________________________________________________________
+Int_t AliAnalysisNetParticleDistribution::GetHistSetIdxCounts(Int_t nDist, Int_t idxSample, Int_t idxCent) const {
+  // -- Index of the f_ik counter of sample idxSample and centrality bin idxCent in the cache of a set
+
+  return GetHistSetIdxFik(nDist, fHelper->GetNSubSamples()+1, 0, 0) + idxSample*AliAnalysisNetParticleHelper::fgkfHistNBinsCent + idxCent;
+}
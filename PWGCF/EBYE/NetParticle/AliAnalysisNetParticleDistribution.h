@@ -89,6 +89,15 @@ class AliAnalysisNetParticleDistribution : public AliAnalysisNetParticleBase {
   void FillHistSetCent(const Char_t *name, Int_t idx, Bool_t isMC);
   void FillHistSetCentPt(const Char_t *name, Int_t idx, Bool_t isMC);
 
+  /** Cache the histograms of a set, so that they are not searched by name in every event */
+  void CacheHistSet(const Char_t *name, Bool_t isPt);
+
+  /** Index in the cache of a set : distributions, then per sample <NetParticle^k>, <f_ik> and f_ik counts
+   *  sample 0 is the full sample, sample idxSub+1 the subsample idxSub */
+  Int_t GetHistSetIdxMoment(Int_t nDist, Int_t idxSample, Int_t idxOrder) const;
+  Int_t GetHistSetIdxFik(Int_t nDist, Int_t idxSample, Int_t ii, Int_t kk) const;
+  Int_t GetHistSetIdxCounts(Int_t nDist, Int_t idxSample, Int_t idxCent) const;
+
   /*
    * ---------------------------------------------------------------------------------
    *                             Members - private
@@ -97,6 +106,7 @@ class AliAnalysisNetParticleDistribution : public AliAnalysisNetParticleBase {
 
   // =======================================================================
   TList                *fOutList;               //! Output data container
+  TList                *fHistSetCache;          //! Per histogram set, array of its histograms (see CacheHistSet)
   // =======================================================================
   Int_t                 fOrder;                 //  Max order of higher order distributions
   // -----------------------------------------------------------------------
@@ -113,7 +123,7 @@ class AliAnalysisNetParticleDistribution : public AliAnalysisNetParticleBase {
   THnSparseD           *fHnTrackUnCorr;         //  THnSparseD : uncorrected probe particles
   // -----------------------------------------------------------------------
 
-  ClassDef(AliAnalysisNetParticleDistribution, 1);
+  ClassDef(AliAnalysisNetParticleDistribution, 2);
 };
 
 #endif
@@ -3,9 +3,12 @@
 /// All correlation function classes must inherit from this one              ///
 ////////////////////////////////////////////////////////////////////////////////
 #include "AliFemtoCorrFctn.h"
+#include "AliFemtoPairBatch.h"
 
 void AliFemtoCorrFctn::AddRealPair(AliFemtoPair*) { cout << "Not implemented" << endl; }
 void AliFemtoCorrFctn::AddMixedPair(AliFemtoPair*) { cout << "Not implemented" << endl; }
+void AliFemtoCorrFctn::AddRealPairs(const AliFemtoPairBatch& aBatch) { for (int i = 0; i < aBatch.Size(); i++) AddRealPair(aBatch.Pair(i)); }
+void AliFemtoCorrFctn::AddMixedPairs(const AliFemtoPairBatch& aBatch) { for (int i = 0; i < aBatch.Size(); i++) AddMixedPair(aBatch.Pair(i)); }
 
 AliFemtoCorrFctn::AliFemtoCorrFctn(const AliFemtoCorrFctn& /* c */):fyAnalysis(0),fPairCut(0x0) {}
 AliFemtoCorrFctn::AliFemtoCorrFctn(): fyAnalysis(0),fPairCut(0x0) {/* no-op */}
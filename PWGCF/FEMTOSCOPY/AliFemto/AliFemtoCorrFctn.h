@@ -10,6 +10,8 @@
 #include "AliFemtoPair.h"
 #include "AliFemtoPairCut.h"
 
+class AliFemtoPairBatch;
+
 class AliFemtoCorrFctn{
 
   friend class AliFemtoAnalysis;
@@ -25,6 +27,10 @@ public:
   virtual void AddRealPair(AliFemtoPair* aPair);
   virtual void AddMixedPair(AliFemtoPair* aPir);
 
+  // block-wise filling, the default passes each pair to AddRealPair/AddMixedPair
+  virtual void AddRealPairs(const AliFemtoPairBatch& aBatch);
+  virtual void AddMixedPairs(const AliFemtoPairBatch& aBatch);
+
   virtual void EventBegin(const AliFemtoEvent* aEvent);
   virtual void EventEnd(const AliFemtoEvent* aEvent);
   virtual void Finish() = 0;
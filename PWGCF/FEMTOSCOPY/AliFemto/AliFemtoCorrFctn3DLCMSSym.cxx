@@ -5,6 +5,7 @@
 
 #include "AliFemtoCorrFctn3DLCMSSym.h"
 #include "AliFemtoPairCut.h"
+#include "AliFemtoPairBatch.h"
 
 #include <TH3F.h>
 
@@ -216,6 +217,47 @@ void AliFemtoCorrFctn3DLCMSSym::AddMixedPair(AliFemtoPair* pair)
 
 }
 
+//____________________________
+void AliFemtoCorrFctn3DLCMSSym::AddRealPairs(const AliFemtoPairBatch& aBatch)
+{
+  // block of real pairs, the LCMS components are precomputed in the batch
+  if (!fUseLCMS) {
+    AliFemtoCorrFctn::AddRealPairs(aBatch);
+    return;
+  }
+  for (int i = 0; i < aBatch.Size(); i++) {
+    if (fPairCut && !fPairCut->Pass(aBatch.Pair(i))) {
+      continue;
+    }
+    const Double_t qout = aBatch.QOutCMS(i),
+                  qside = aBatch.QSideCMS(i),
+                  qlong = aBatch.QLongCMS(i);
+
+    fNumerator->Fill(qout, qside, qlong, 1.0);
+    fNumeratorW->Fill(qout, qside, qlong, aBatch.QInv(i));
+  }
+}
+//____________________________
+void AliFemtoCorrFctn3DLCMSSym::AddMixedPairs(const AliFemtoPairBatch& aBatch)
+{
+  // block of mixed pairs, the LCMS components are precomputed in the batch
+  if (!fUseLCMS) {
+    AliFemtoCorrFctn::AddMixedPairs(aBatch);
+    return;
+  }
+  for (int i = 0; i < aBatch.Size(); i++) {
+    if (fPairCut && !fPairCut->Pass(aBatch.Pair(i))) {
+      continue;
+    }
+    const Double_t qout = aBatch.QOutCMS(i),
+                  qside = aBatch.QSideCMS(i),
+                  qlong = aBatch.QLongCMS(i);
+
+    fDenominator->Fill(qout, qside, qlong, 1.0);
+    fDenominatorW->Fill(qout, qside, qlong, aBatch.QInv(i));
+  }
+}
+
 void AliFemtoCorrFctn3DLCMSSym::SetUseLCMS(int aUseLCMS)
 {
   fUseLCMS = aUseLCMS;
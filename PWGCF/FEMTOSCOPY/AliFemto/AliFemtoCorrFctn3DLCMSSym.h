@@ -33,6 +33,8 @@ public:
   virtual AliFemtoString Report();
   virtual void AddRealPair(AliFemtoPair* aPair);
   virtual void AddMixedPair(AliFemtoPair* aPair);
+  virtual void AddRealPairs(const AliFemtoPairBatch& aBatch);
+  virtual void AddMixedPairs(const AliFemtoPairBatch& aBatch);
 
   virtual void Finish();
 
@@ -94,7 +94,11 @@ AliFemtoEventReaderAOD::AliFemtoEventReaderAOD():
   fIsKaonAnalysis(kFALSE),
   fIsProtonAnalysis(kFALSE),
   fIsPionAnalysis(kFALSE),
-  fIsElectronAnalysis(kFALSE)
+  fIsElectronAnalysis(kFALSE),
+  fPreselectTracks(kFALSE),
+  fPreselectPt(),
+  fPreselectEtaMax(0.),
+  fComputeNominalTPCPoints(kTRUE)
 {
   // default constructor
   fAllTrue.ResetAllBits(kTRUE);
@@ -148,10 +152,16 @@ AliFemtoEventReaderAOD::AliFemtoEventReaderAOD(const AliFemtoEventReaderAOD &aRe
   fIsKaonAnalysis(aReader.fIsKaonAnalysis),
   fIsProtonAnalysis(aReader.fIsProtonAnalysis),
   fIsPionAnalysis(aReader.fIsPionAnalysis),
-  fIsElectronAnalysis(aReader.fIsElectronAnalysis)
+  fIsElectronAnalysis(aReader.fIsElectronAnalysis),
+  fPreselectTracks(aReader.fPreselectTracks),
+  fPreselectPt(),
+  fPreselectEtaMax(aReader.fPreselectEtaMax),
+  fComputeNominalTPCPoints(aReader.fComputeNominalTPCPoints)
 
 {
   // copy constructor
+  fPreselectPt[0] = aReader.fPreselectPt[0];
+  fPreselectPt[1] = aReader.fPreselectPt[1];
   fAllTrue.ResetAllBits(kTRUE);
   fAllFalse.ResetAllBits(kFALSE);
 
@@ -223,6 +233,11 @@ AliFemtoEventReaderAOD &AliFemtoEventReaderAOD::operator=(const AliFemtoEventRea
   fIsProtonAnalysis = aReader.fIsProtonAnalysis;
   fIsPionAnalysis = aReader.fIsPionAnalysis;
   fIsElectronAnalysis = aReader.fIsElectronAnalysis;
+  fPreselectTracks = aReader.fPreselectTracks;
+  fPreselectPt[0] = aReader.fPreselectPt[0];
+  fPreselectPt[1] = aReader.fPreselectPt[1];
+  fPreselectEtaMax = aReader.fPreselectEtaMax;
+  fComputeNominalTPCPoints = aReader.fComputeNominalTPCPoints;
 
   return *this;
 }
@@ -470,6 +485,28 @@ AliFemtoEvent *AliFemtoEventReaderAOD::CopyAODtoFemtoEvent()
               tNormMult++;
     }
 
+    // Cheap rejections before the conversion, which creates the full AliFemtoTrack
+    if (fPreselectTracks) {
+      const double pt = aodtrack->Pt();
+      if (pt <= fPreselectPt[0] || pt >= fPreselectPt[1] || TMath::Abs(aodtrack->Eta()) > fPreselectEtaMax) {
+        continue;
+      }
+    }
+
+    //Special MC analysis for pi,K,p,e slected by PDG code: the tracks of other species are not converted
+    if (mcP && (fIsKaonAnalysis || fIsProtonAnalysis || fIsPionAnalysis || fIsElectronAnalysis)) {
+      const Int_t track_label = aodtrack->GetLabel();
+      const AliAODMCParticle *tPart = (track_label > -1)
+                                    ? (AliAODMCParticle *)mcP->At(track_label)
+                                    : NULL;
+      const Int_t pdg = tPart ? TMath::Abs(tPart->GetPdgCode()) : 0;
+      if (!tPart || (tPart->Px() == 0.0 && tPart->Py() == 0.0 && tPart->Pz() == 0.0)
+          || (fIsKaonAnalysis && pdg != 321) || (fIsProtonAnalysis && pdg != 2212)
+          || (fIsPionAnalysis && pdg != 211) || (fIsElectronAnalysis && pdg != 11)) {
+        continue;
+      }
+    }
+
     AliFemtoTrack *trackCopy = CopyAODtoFemtoTrack(aodtrack);
 
     // copying PID information from the correspondent track
@@ -915,44 +952,46 @@ AliFemtoTrack *AliFemtoEventReaderAOD::CopyAODtoFemtoTrack(AliAODTrack *tAodTrac
   tFemtoTrack->SetTPCClusterMap(tAodTrack->GetTPCClusterMap());
   tFemtoTrack->SetTPCSharedMap(tAodTrack->GetTPCSharedMap());
 
-  float globalPositionsAtRadii[9][3];
   float bfield = 5 * fMagFieldSign;
 
-  GetGlobalPositionAtGlobalRadiiThroughTPC(tAodTrack, bfield, globalPositionsAtRadii);
-  double tpcEntrance[3] = {globalPositionsAtRadii[0][0], globalPositionsAtRadii[0][1], globalPositionsAtRadii[0][2]};
-  double **tpcPositions;
-  tpcPositions = new double*[9];
-
-  for (int i = 0; i < 9; i++) {
-    tpcPositions[i] = new double[3];
-  }
+  if (fComputeNominalTPCPoints) {
+    float globalPositionsAtRadii[9][3];
+    GetGlobalPositionAtGlobalRadiiThroughTPC(tAodTrack, bfield, globalPositionsAtRadii);
+    double tpcEntrance[3] = {globalPositionsAtRadii[0][0], globalPositionsAtRadii[0][1], globalPositionsAtRadii[0][2]};
+    double tpcPositionsData[9][3];
+    double *tpcPositions[9];
 
-  double tpcExit[3] = {globalPositionsAtRadii[8][0], globalPositionsAtRadii[8][1], globalPositionsAtRadii[8][2]};
-  for (int i = 0; i < 9; i++) {
-    tpcPositions[i][0] = globalPositionsAtRadii[i][0];
-    tpcPositions[i][1] = globalPositionsAtRadii[i][1];
-    tpcPositions[i][2] = globalPositionsAtRadii[i][2];
-  }
-
-  if (fPrimaryVertexCorrectionTPCPoints) {
-    tpcEntrance[0] -= fV1[0];
-    tpcEntrance[1] -= fV1[1];
-    tpcEntrance[2] -= fV1[2];
-
-    tpcExit[0] -= fV1[0];
-    tpcExit[1] -= fV1[1];
-    tpcExit[2] -= fV1[2];
+    for (int i = 0; i < 9; i++) {
+      tpcPositions[i] = tpcPositionsData[i];
+    }
 
+    double tpcExit[3] = {globalPositionsAtRadii[8][0], globalPositionsAtRadii[8][1], globalPositionsAtRadii[8][2]};
     for (int i = 0; i < 9; i++) {
-      tpcPositions[i][0] -= fV1[0];
-      tpcPositions[i][1] -= fV1[1];
-      tpcPositions[i][2] -= fV1[2];
+      tpcPositions[i][0] = globalPositionsAtRadii[i][0];
+      tpcPositions[i][1] = globalPositionsAtRadii[i][1];
+      tpcPositions[i][2] = globalPositionsAtRadii[i][2];
+    }
+
+    if (fPrimaryVertexCorrectionTPCPoints) {
+      tpcEntrance[0] -= fV1[0];
+      tpcEntrance[1] -= fV1[1];
+      tpcEntrance[2] -= fV1[2];
+
+      tpcExit[0] -= fV1[0];
+      tpcExit[1] -= fV1[1];
+      tpcExit[2] -= fV1[2];
+
+      for (int i = 0; i < 9; i++) {
+        tpcPositions[i][0] -= fV1[0];
+        tpcPositions[i][1] -= fV1[1];
+        tpcPositions[i][2] -= fV1[2];
+      }
     }
-  }
 
-  tFemtoTrack->SetNominalTPCEntrancePoint(tpcEntrance);
-  tFemtoTrack->SetNominalTPCPoints(tpcPositions);
-  tFemtoTrack->SetNominalTPCExitPoint(tpcExit);
+    tFemtoTrack->SetNominalTPCEntrancePoint(tpcEntrance);
+    tFemtoTrack->SetNominalTPCPoints(tpcPositions);
+    tFemtoTrack->SetNominalTPCExitPoint(tpcExit);
+  }
 
   if (fShiftPosition > 0.) {
     Float_t posShifted[3];
@@ -960,11 +999,6 @@ AliFemtoTrack *AliFemtoEventReaderAOD::CopyAODtoFemtoTrack(AliAODTrack *tAodTrac
     tFemtoTrack->SetNominalTPCPointShifted(posShifted);
   }
 
-  for (int i = 0; i < 9; i++) {
-    delete [] tpcPositions[i];
-  }
-  delete [] tpcPositions;
-
 
   int indexes[3];
   for (int ik = 0; ik < 3; ik++) {
@@ -1967,3 +2001,16 @@ void AliFemtoEventReaderAOD::SetElectronAnalysis(Bool_t aSetElectronAna)
   fIsElectronAnalysis = aSetElectronAna;
 }
 //Special MC analysis for pi,K,p,e selected by PDG code <--
+
+void AliFemtoEventReaderAOD::SetTrackPreselection(double ptMin, double ptMax, double etaMax)
+{
+  fPreselectTracks = kTRUE;
+  fPreselectPt[0] = ptMin;
+  fPreselectPt[1] = ptMax;
+  fPreselectEtaMax = etaMax;
+}
+
+void AliFemtoEventReaderAOD::SetComputeNominalTPCPoints(bool compute)
+{
+  fComputeNominalTPCPoints = compute;
+}
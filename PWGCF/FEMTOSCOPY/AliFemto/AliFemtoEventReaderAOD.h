@@ -98,6 +98,15 @@ public:
   void SetProtonAnalysis(Bool_t aSetProtonAna);
   void SetElectronAnalysis(Bool_t aSetElectronAna);
   //Special MC analysis for pi,K,p,e slected by PDG code <--
+
+  /// Reject the tracks outside ptMin < pT < ptMax or with |eta| > etaMax
+  /// before they are converted to AliFemtoTrack. The range should be the
+  /// loosest one of the particle cuts of all the analyses using the reader.
+  void SetTrackPreselection(double ptMin, double ptMax, double etaMax);
+  /// Propagate the tracks through the TPC for the nominal TPC entrance,
+  /// exit and intermediate points (default). Can be switched off when no
+  /// pair cut of the analyses uses them.
+  void SetComputeNominalTPCPoints(bool compute);
   
 protected:
   virtual AliFemtoEvent *CopyAODtoFemtoEvent();
@@ -164,10 +173,15 @@ private:
   Bool_t fIsElectronAnalysis; // e+e- are taken (for gamma cut tuning)
   //Special MC analysis for pi,K,p,e slected by PDG code <--
 
+  Bool_t fPreselectTracks;          ///< reject the tracks outside the preselection range before the conversion
+  Double_t fPreselectPt[2];         ///< pT range of the track preselection
+  Double_t fPreselectEtaMax;        ///< |eta| limit of the track preselection
+  Bool_t fComputeNominalTPCPoints;  ///< compute the nominal TPC points of the tracks
+
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
-  ClassDef(AliFemtoEventReaderAOD, 12);
+  ClassDef(AliFemtoEventReaderAOD, 13);
   /// \endcond
 #endif
 
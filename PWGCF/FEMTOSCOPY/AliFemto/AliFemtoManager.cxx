@@ -8,6 +8,8 @@
 ///////////////////////////////////////////////////////////////////////////
 
 #include "AliFemtoManager.h"
+#include "AliFemtoSimpleAnalysis.h"
+#include "AliFemtoParticleSelectionCache.h"
 //#include "AliFemtoParticleCollection.h"
 //#include "AliFemtoTrackCut.h"
 //#include "AliFemtoV0Cut.h"
@@ -25,7 +27,8 @@
 AliFemtoManager::AliFemtoManager():
   fAnalysisCollection(NULL),
   fEventReader(NULL),
-  fEventWriterCollection(NULL)
+  fEventWriterCollection(NULL),
+  fParticleSelectionCache(NULL)
 {
   // default constructor
   fAnalysisCollection = new AliFemtoAnalysisCollection;
@@ -35,7 +38,8 @@ AliFemtoManager::AliFemtoManager():
 AliFemtoManager::AliFemtoManager(const AliFemtoManager& aManager):
   fAnalysisCollection(new AliFemtoAnalysisCollection),
   fEventReader(aManager.fEventReader),
-  fEventWriterCollection(new AliFemtoEventWriterCollection)
+  fEventWriterCollection(new AliFemtoEventWriterCollection),
+  fParticleSelectionCache(aManager.fParticleSelectionCache ? new AliFemtoParticleSelectionCache : NULL)
 {
   // copy constructor
   AliFemtoSimpleAnalysisIterator tAnalysisIter;
@@ -65,6 +69,7 @@ AliFemtoManager::~AliFemtoManager()
     delete *tEventWriterIter;
   }
   delete fEventWriterCollection;
+  delete fParticleSelectionCache;
 }
 //____________________________
 AliFemtoManager& AliFemtoManager::operator=(const AliFemtoManager& aManager)
@@ -102,6 +107,7 @@ AliFemtoManager& AliFemtoManager::operator=(const AliFemtoManager& aManager)
   for (tEventWriterIter=aManager.fEventWriterCollection->begin();tEventWriterIter!=aManager.fEventWriterCollection->end();tEventWriterIter++){
     fEventWriterCollection->push_back(*tEventWriterIter);
   }
+  SetShareParticleSelections(aManager.fParticleSelectionCache != NULL);
   return *this;
 }
 
@@ -211,6 +217,22 @@ AliFemtoEventWriter* AliFemtoManager::EventWriter( int n )
     iter++;
   }
   return *iter;
+}
+//____________________________
+void AliFemtoManager::SetShareParticleSelections(bool aShare)
+{
+  // create or drop the particle selection cache
+  if (aShare && !fParticleSelectionCache) {
+    fParticleSelectionCache = new AliFemtoParticleSelectionCache;
+  } else if (!aShare && fParticleSelectionCache) {
+    AliFemtoSimpleAnalysisIterator tAnalysisIter;
+    for (tAnalysisIter=fAnalysisCollection->begin();tAnalysisIter!=fAnalysisCollection->end();tAnalysisIter++){
+      AliFemtoSimpleAnalysis *tSimpleAnalysis = dynamic_cast<AliFemtoSimpleAnalysis*>(*tAnalysisIter);
+      if (tSimpleAnalysis) tSimpleAnalysis->SetParticleSelectionCache(NULL);
+    }
+    delete fParticleSelectionCache;
+    fParticleSelectionCache = NULL;
+  }
 }
  //____________________________
 int AliFemtoManager::ProcessEvent()
@@ -242,10 +264,20 @@ int AliFemtoManager::ProcessEvent()
   }
 
   // loop over all the Analysis
+  if (fParticleSelectionCache) {
+    fParticleSelectionCache->NewEvent(currentHbtEvent);
+  }
   AliFemtoSimpleAnalysisIterator tAnalysisIter;
   for (tAnalysisIter=fAnalysisCollection->begin();tAnalysisIter!=fAnalysisCollection->end();tAnalysisIter++){
+    if (fParticleSelectionCache) {
+      AliFemtoSimpleAnalysis *tSimpleAnalysis = dynamic_cast<AliFemtoSimpleAnalysis*>(*tAnalysisIter);
+      if (tSimpleAnalysis) tSimpleAnalysis->SetParticleSelectionCache(fParticleSelectionCache);
+    }
     (*tAnalysisIter)->ProcessEvent(currentHbtEvent);
   }
+  if (fParticleSelectionCache) {
+    fParticleSelectionCache->NewEvent(NULL);
+  }
 
   if (currentHbtEvent) {
     delete currentHbtEvent;
@@ -19,6 +19,7 @@
 #include "AliFemtoEventReader.h"
 #include "AliFemtoEventWriter.h"
 
+class AliFemtoParticleSelectionCache;
 
 /// \class AliFemtoManager
 /// \brief Main class for managing femtoscopic analyses
@@ -49,6 +50,7 @@ private:
   AliFemtoAnalysisCollection* fAnalysisCollection;       ///< Collection of analyzes
   AliFemtoEventReader*        fEventReader;              ///< Event reader
   AliFemtoEventWriterCollection* fEventWriterCollection; ///< Event writer collection
+  AliFemtoParticleSelectionCache* fParticleSelectionCache; //!<! particle collections shared by the analyses
 
 public:
   AliFemtoManager();
@@ -78,6 +80,11 @@ public:
 
   int ProcessEvent();   ///< a "0" return value means success - otherwise quit
 
+  /// Evaluate equivalent particle cuts (same class and ListSettings(), no cut
+  /// monitors) only once per event and give the analyses derived from
+  /// AliFemtoSimpleAnalysis copies of the selected particles.
+  void SetShareParticleSelections(bool aShare);
+
   /// Calls `Finish()` on the EventReader, EventWriters, and the Analyses.
   void Finish();
 
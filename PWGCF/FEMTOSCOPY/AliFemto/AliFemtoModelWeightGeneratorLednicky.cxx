@@ -14,6 +14,9 @@
 #include "AliFemtoModelWeightGeneratorLednicky.h"
 #include "AliFemtoModelHiddenInfo.h"
 #include "AliFemtoPair.h"
+#include "TFile.h"
+#include "TVectorD.h"
+#include "TMath.h"
 //#include "StarCallf77.h"
 //#include <strstream.h>
 //#include <iomanip.h>
@@ -114,7 +117,10 @@ AliFemtoModelWeightGeneratorLednicky::AliFemtoModelWeightGeneratorLednicky() :
   fSphereApp(false),fT0App(false) ,
   fLL(0), fNuclChargeSign(1), fSwap(0), fLLMax(30), fLLName(0), 
   fNumProcessPair(0), fNumbNonId(0),
-  fKpKmModel(14),fPhi_OffOn(1)
+  fKpKmModel(14),fPhi_OffOn(1),
+  fUseWeightTable(false), fTableAccuracy(0.005),
+  fTableNKStar(50), fTableKStarMax(0.5), fTableNRStar(50), fTableRStarMax(50.),
+  fTableNCosTheta(21), fTableFileName(""), fWeightTables()
 {
   // default constructor
   fLLName=new char*[fLLMax+1];
@@ -163,7 +169,10 @@ AliFemtoModelWeightGeneratorLednicky::AliFemtoModelWeightGeneratorLednicky(const
   fSphereApp(false),fT0App(false) ,
   fLL(0), fNuclChargeSign(1), fSwap(0), fLLMax(30), fLLName(0), 
   fNumProcessPair(0), fNumbNonId(0),
-  fKpKmModel(14),fPhi_OffOn(1)
+  fKpKmModel(14),fPhi_OffOn(1),
+  fUseWeightTable(false), fTableAccuracy(0.005),
+  fTableNKStar(50), fTableKStarMax(0.5), fTableNRStar(50), fTableRStarMax(50.),
+  fTableNCosTheta(21), fTableFileName(""), fWeightTables()
 {
   // copy constructor
   fWei = aWeight.fWei; 
@@ -190,6 +199,14 @@ AliFemtoModelWeightGeneratorLednicky::AliFemtoModelWeightGeneratorLednicky(const
   fNumProcessPair=new int[fLLMax+1];
   fKpKmModel = aWeight.fKpKmModel;
   fPhi_OffOn = aWeight.fPhi_OffOn;
+  fUseWeightTable = aWeight.fUseWeightTable;
+  fTableAccuracy = aWeight.fTableAccuracy;
+  fTableNKStar = aWeight.fTableNKStar;
+  fTableKStarMax = aWeight.fTableKStarMax;
+  fTableNRStar = aWeight.fTableNRStar;
+  fTableRStarMax = aWeight.fTableRStarMax;
+  fTableNCosTheta = aWeight.fTableNCosTheta;
+  fTableFileName = aWeight.fTableFileName;
   int i;
   for (i=1;i<=fLLMax;i++) {fLLName[i]=new char[40];fNumProcessPair[i]=0;}
   strncpy( fLLName[1],"neutron neutron",40);
@@ -258,6 +275,14 @@ AliFemtoModelWeightGeneratorLednicky& AliFemtoModelWeightGeneratorLednicky::oper
   fNumProcessPair=new int[fLLMax+1];
   fKpKmModel = aWeight.fKpKmModel;
   fPhi_OffOn = aWeight.fPhi_OffOn;
+  fUseWeightTable = aWeight.fUseWeightTable;
+  fTableAccuracy = aWeight.fTableAccuracy;
+  fTableNKStar = aWeight.fTableNKStar;
+  fTableKStarMax = aWeight.fTableKStarMax;
+  fTableNRStar = aWeight.fTableNRStar;
+  fTableRStarMax = aWeight.fTableRStarMax;
+  fTableNCosTheta = aWeight.fTableNCosTheta;
+  fTableFileName = aWeight.fTableFileName;
   int i;
   for (i=1;i<=fLLMax;i++) {fLLName[i]=new char[40];fNumProcessPair[i]=0;}
   strncpy( fLLName[1],"neutron neutron",40);
@@ -444,6 +469,11 @@ Double_t tDTime =inf1->GetEmissionPoint()->t()  - inf2->GetEmissionPoint()->t();
       fWeightDen=0.;
       return 0;  
     } 
+    double tTableWeight;
+    if (TableWeight(tTableWeight)) {
+      fWein = tTableWeight;
+      return fWein;
+    }
     if (fSwap) {
       fsiposition(*x2,*x1);
     } else {
@@ -483,6 +513,8 @@ AliFemtoString AliFemtoModelWeightGeneratorLednicky::Report() {
   }
   if (fNumbNonId)
     tStr << "         "<< fNumbNonId << " Non Identified" << endl;
+  if (fUseWeightTable)
+    tStr << "    Weights interpolated from tables in (k*, r*, cos theta*), accuracy " << fTableAccuracy << endl;
   AliFemtoString returnThis = tStr.str();
   return returnThis;
 }
@@ -496,12 +528,14 @@ void AliFemtoModelWeightGeneratorLednicky::FsiInit(){
    cout <<"mIsi dans FsiInit() = " << fIsi << endl;
    cout <<"mI3c dans FsiInit() = " << fI3c << endl;
   fsiin(fItest,fIch,fIqs,fIsi,fI3c);
+  fWeightTables.clear();
 }
 
 void AliFemtoModelWeightGeneratorLednicky::FsiSetKpKmModelType(){
   // initialize K+K- model type
   cout<<"******************* AliFemtoModelWeightGeneratorLednicky check FsiInit initialize K+K- model type with FsiSetKpKmModelType(), type= "<<fKpKmModel<<" PhiOffON= "<<fPhi_OffOn<<" *************"<< endl;
    setkpkmmodel(fKpKmModel,fPhi_OffOn);
+   fWeightTables.clear();
    cout<<"-----------------END FsiSetKpKmModelType-------"<<endl;
 }
 
@@ -718,13 +752,13 @@ void AliFemtoModelWeightGeneratorLednicky::SetKpKmModelType(const int aModelType
 void AliFemtoModelWeightGeneratorLednicky::SetNuclCharge(const double aNuclCharge) {fNuclCharge=aNuclCharge;FsiNucl();}
 void AliFemtoModelWeightGeneratorLednicky::SetNuclMass(const double aNuclMass){fNuclMass=aNuclMass;FsiNucl();}
 
-void AliFemtoModelWeightGeneratorLednicky::SetSphere(){fSphereApp=true;}
-void AliFemtoModelWeightGeneratorLednicky::SetSquare(){fSphereApp=false;}
-void AliFemtoModelWeightGeneratorLednicky::SetT0ApproxOn(){ fT0App=true;}
-void AliFemtoModelWeightGeneratorLednicky::SetT0ApproxOff(){ fT0App=false;}
+void AliFemtoModelWeightGeneratorLednicky::SetSphere(){fSphereApp=true;fWeightTables.clear();}
+void AliFemtoModelWeightGeneratorLednicky::SetSquare(){fSphereApp=false;fWeightTables.clear();}
+void AliFemtoModelWeightGeneratorLednicky::SetT0ApproxOn(){ fT0App=true;fWeightTables.clear();}
+void AliFemtoModelWeightGeneratorLednicky::SetT0ApproxOff(){ fT0App=false;fWeightTables.clear();}
 void AliFemtoModelWeightGeneratorLednicky::SetDefaultCalcPar(){
   fItest=1;fIqs=1;fIsi=1;fI3c=0;fIch=1;FsiInit();
-  fSphereApp=false;fT0App=false;}
+  fSphereApp=false;fT0App=false;fWeightTables.clear();}
 
 void AliFemtoModelWeightGeneratorLednicky::SetCoulOn()    {fItest=1;fIch=1;FsiInit();}
 void AliFemtoModelWeightGeneratorLednicky::SetCoulOff()   {fItest=1;fIch=0;FsiInit();}
@@ -748,3 +782,205 @@ AliFemtoModelWeightGenerator* AliFemtoModelWeightGeneratorLednicky::Clone() cons
   AliFemtoModelWeightGenerator* tmp = new AliFemtoModelWeightGeneratorLednicky(*this);
   return tmp;
 }
+
+//_____________________________________________
+// Tabulated weights. A table holds kTableHeader entries describing the grid
+// and the calculation mode, followed by the weights at the nodes
+//   k*_i = (i+1) k*max/nK, r*_j = (j+1) r*max/nR, cos_l = -1 + 2 l/(nCos-1)
+// stored at ((i*nR)+j)*nCos+l.
+static const int kTableHeader = 13;
+static const int kTableMaxRefine = 3;
+
+void AliFemtoModelWeightGeneratorLednicky::SetUseWeightTable(const bool aUse, const double aAccuracy)
+{
+  fUseWeightTable = aUse;
+  fTableAccuracy = aAccuracy;
+  fWeightTables.clear();
+}
+
+void AliFemtoModelWeightGeneratorLednicky::SetWeightTableBinning(const int aNKStar, const double aKStarMax,
+                                                                 const int aNRStar, const double aRStarMax, const int aNCosTheta)
+{
+  fTableNKStar = TMath::Max(aNKStar, 2);
+  fTableKStarMax = aKStarMax;
+  fTableNRStar = TMath::Max(aNRStar, 2);
+  fTableRStarMax = aRStarMax;
+  fTableNCosTheta = TMath::Max(aNCosTheta, 2);
+  fWeightTables.clear();
+}
+
+void AliFemtoModelWeightGeneratorLednicky::SetWeightTableFile(const char *aFileName)
+{
+  fTableFileName = aFileName;
+  fWeightTables.clear();
+}
+
+double AliFemtoModelWeightGeneratorLednicky::FsiPrfWeight(const double aKStar, const double aRStar, const double aCosTheta)
+{
+  // exact weight of a pair at rest, first particle momentum k* along z,
+  // separation r* at angle theta* to it and equal emission times
+  double p1[] = {0., 0., aKStar};
+  double p2[] = {0., 0., -aKStar};
+  double x1[] = {aRStar*TMath::Sqrt(TMath::Max(0., 1. - aCosTheta*aCosTheta)), 0., aRStar*aCosTheta, 0.};
+  double x2[] = {0., 0., 0., 0.};
+  fsimomentum(*p1,*p2);
+  fsiposition(*x1,*x2);
+  FsiSetLL();
+  ltran12();
+  fsiw(1,fWeif,fWei,fWein);
+  return fWein;
+}
+
+bool AliFemtoModelWeightGeneratorLednicky::TableWeight(double &aWeight)
+{
+  // weight of the current pair (fKStar*, fRStar* already set) from the table
+  if (!fUseWeightTable || fI3c || fKStar <= 0. || fRStar <= 0.) return false;
+  double tCosTheta = (fKStarOut*fRStarOut + fKStarSide*fRStarSide + fKStarLong*fRStarLong)/(fKStar*fRStar);
+  bool tInside;
+  aWeight = InterpolateWeightTable(WeightTable(), fKStar, fRStar, tCosTheta, tInside);
+  return tInside;
+}
+
+const std::vector<double>& AliFemtoModelWeightGeneratorLednicky::WeightTable()
+{
+  // table for the current pair type, read or built on first use
+  std::map<int, std::vector<double> >::iterator tIter = fWeightTables.find(fLL);
+  if (tIter != fWeightTables.end()) return tIter->second;
+
+  std::vector<double> &tTable = fWeightTables[fLL];
+  if (!ReadWeightTable(tTable)) {
+    BuildWeightTable(tTable);
+    WriteWeightTable(tTable);
+  }
+  return tTable;
+}
+
+void AliFemtoModelWeightGeneratorLednicky::FillWeightTableHeader(std::vector<double> &aTable, const int aNK, const int aNR, const int aNCos) const
+{
+  // grid and calculation mode the table is valid for
+  int tNS;
+  if (fSphereApp||(fLL>5)) {
+    if (fT0App) { tNS=4;}
+    else {tNS=2;}
+  } else { tNS=1;}
+
+  aTable.resize(kTableHeader + aNK*aNR*aNCos);
+  aTable[0] = aNK;
+  aTable[1] = fTableKStarMax;
+  aTable[2] = aNR;
+  aTable[3] = fTableRStarMax;
+  aTable[4] = aNCos;
+  aTable[5] = fIch;
+  aTable[6] = fIqs;
+  aTable[7] = fIsi;
+  aTable[8] = tNS;
+  aTable[9] = fKpKmModel;
+  aTable[10] = fPhi_OffOn;
+  aTable[11] = fLL;
+  aTable[12] = fTableAccuracy;
+}
+
+void AliFemtoModelWeightGeneratorLednicky::BuildWeightTable(std::vector<double> &aTable)
+{
+  // fill the nodes, then compare with the exact weights at the cell centres
+  // and double the k* and r* granularity until the accuracy target is met
+  int tNK = fTableNKStar, tNR = fTableNRStar;
+  const int tNCos = fTableNCosTheta;
+  double tMaxDev = 0.;
+  for (int iRefine = 0; ; iRefine++) {
+    FillWeightTableHeader(aTable, tNK, tNR, tNCos);
+    const double tDK = fTableKStarMax/tNK, tDR = fTableRStarMax/tNR, tDC = 2./(tNCos-1);
+    double *tValues = &aTable[kTableHeader];
+    for (int ik = 0; ik < tNK; ik++)
+      for (int ir = 0; ir < tNR; ir++)
+        for (int ic = 0; ic < tNCos; ic++)
+          tValues[(ik*tNR + ir)*tNCos + ic] = FsiPrfWeight((ik+1)*tDK, (ir+1)*tDR, -1. + ic*tDC);
+
+    tMaxDev = 0.;
+    bool tInside;
+    for (int ik = 0; ik < tNK-1; ik++)
+      for (int ir = 0; ir < tNR-1; ir++)
+        for (int ic = 0; ic < tNCos-1; ic++) {
+          const double tK = (ik+1.5)*tDK, tR = (ir+1.5)*tDR, tC = -1. + (ic+0.5)*tDC;
+          const double tDev = TMath::Abs(InterpolateWeightTable(aTable, tK, tR, tC, tInside) - FsiPrfWeight(tK, tR, tC));
+          if (tDev > tMaxDev) tMaxDev = tDev;
+        }
+    if (tMaxDev <= fTableAccuracy || iRefine == kTableMaxRefine) break;
+    tNK *= 2;
+    tNR *= 2;
+  }
+  cout << "AliFemtoModelWeightGeneratorLednicky: weight table for " << fLLName[fLL]
+       << " with " << tNK << " x " << tNR << " x " << tNCos << " nodes, max deviation " << tMaxDev << endl;
+}
+
+bool AliFemtoModelWeightGeneratorLednicky::ReadWeightTable(std::vector<double> &aTable)
+{
+  // take the table from the cache file if it was built for the same settings
+  if (fTableFileName.IsNull()) return false;
+  TDirectory *tSaveDir = gDirectory;
+  TFile *tFile = TFile::Open(fTableFileName.Data(), "READ");
+  if (tSaveDir) tSaveDir->cd();
+  if (!tFile || tFile->IsZombie()) {
+    delete tFile;
+    return false;
+  }
+
+  bool tValid = false;
+  TVectorD *tStored = dynamic_cast<TVectorD*>(tFile->Get(Form("LednickyWeights_LL%d", fLL)));
+  if (tStored && tStored->GetNrows() > kTableHeader) {
+    std::vector<double> tExpected;
+    FillWeightTableHeader(tExpected, 0, 0, 0);
+    const Double_t *tData = tStored->GetMatrixArray();
+    tValid = (tData[0] >= fTableNKStar && tData[2] >= fTableNRStar && tData[12] <= fTableAccuracy);
+    for (int i = 3; tValid && i < 12; i++) tValid = (tData[i] == tExpected[i]);
+    tValid = tValid && (tData[1] == tExpected[1]) &&
+      (tStored->GetNrows() == kTableHeader + int(tData[0])*int(tData[2])*int(tData[4]));
+    if (tValid) aTable.assign(tData, tData + tStored->GetNrows());
+  }
+  tFile->Close();
+  delete tFile;
+  return tValid;
+}
+
+void AliFemtoModelWeightGeneratorLednicky::WriteWeightTable(const std::vector<double> &aTable)
+{
+  // store the table in the cache file
+  if (fTableFileName.IsNull()) return;
+  TDirectory *tSaveDir = gDirectory;
+  TFile *tFile = TFile::Open(fTableFileName.Data(), "UPDATE");
+  if (tFile && !tFile->IsZombie()) {
+    TVectorD tStored(aTable.size(), &aTable[0]);
+    tStored.Write(Form("LednickyWeights_LL%d", fLL), TObject::kOverwrite);
+    tFile->Close();
+  } else {
+    cout << "W-AliFemtoModelWeightGeneratorLednicky: cannot write weight table to " << fTableFileName << endl;
+  }
+  delete tFile;
+  if (tSaveDir) tSaveDir->cd();
+}
+
+double AliFemtoModelWeightGeneratorLednicky::InterpolateWeightTable(const std::vector<double> &aTable, double aKStar, double aRStar, double aCosTheta, bool &aInside)
+{
+  // trilinear interpolation between the nodes, aInside is false outside the grid
+  const int tNK = int(aTable[0]), tNR = int(aTable[2]), tNCos = int(aTable[4]);
+  const double tFK = aKStar*tNK/aTable[1] - 1.;
+  const double tFR = aRStar*tNR/aTable[3] - 1.;
+  aInside = (tFK >= 0. && tFK <= tNK-1 && tFR >= 0. && tFR <= tNR-1);
+  if (!aInside) return 1.;
+  const double tFC = (TMath::Min(TMath::Max(aCosTheta, -1.), 1.) + 1.)*0.5*(tNCos-1);
+
+  const int ik = TMath::Min(int(tFK), tNK-2);
+  const int ir = TMath::Min(int(tFR), tNR-2);
+  const int ic = TMath::Min(int(tFC), tNCos-2);
+  const double tWK = tFK - ik, tWR = tFR - ir, tWC = tFC - ic;
+
+  const double *tValues = &aTable[kTableHeader];
+  double tResult = 0.;
+  for (int dk = 0; dk < 2; dk++)
+    for (int dr = 0; dr < 2; dr++)
+      for (int dc = 0; dc < 2; dc++) {
+        const double tW = (dk ? tWK : 1.-tWK) * (dr ? tWR : 1.-tWR) * (dc ? tWC : 1.-tWC);
+        tResult += tW * tValues[((ik+dk)*tNR + (ir+dr))*tNCos + (ic+dc)];
+      }
+  return tResult;
+}
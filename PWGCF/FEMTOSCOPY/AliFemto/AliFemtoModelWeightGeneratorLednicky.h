@@ -13,6 +13,9 @@
 
 #include "AliFemtoTypes.h"
 #include "AliFemtoModelWeightGenerator.h"
+#include "TString.h"
+#include <map>
+#include <vector>
 
 class AliFemtoModelWeightGeneratorLednicky : public  AliFemtoModelWeightGenerator {
  public: 
@@ -66,6 +69,17 @@ class AliFemtoModelWeightGeneratorLednicky : public  AliFemtoModelWeightGenerato
 
   void SetKpKmModelType(const int aModelType, const int aPhi_OffOn);  // K+K- model type,Phi off/on
 
+// >>> Tabulated weights
+  // Interpolate the weight in (k*, r*, cos theta*) from a table built once per
+  // pair type instead of calling the FSI code for every pair. The grid is refined
+  // until the interpolation error at the cell centres is below aAccuracy.
+  // The table neglects the emission time difference in the pair rest frame and
+  // is not used with the 3-body calculation; pairs outside the grid get the exact weight.
+  void SetUseWeightTable(const bool aUse, const double aAccuracy=0.005);
+  void SetWeightTableBinning(const int aNKStar, const double aKStarMax,
+                             const int aNRStar, const double aRStarMax, const int aNCosTheta);
+  void SetWeightTableFile(const char *aFileName); // read tables from / store them in this ROOT file
+
   virtual AliFemtoString Report();
 
 protected:
@@ -109,8 +123,28 @@ protected:
   void FsiNucl();
   bool SetPid(const int aPid1,const int aPid2);
 
+  // Weight tables
+  double FsiPrfWeight(const double aKStar, const double aRStar, const double aCosTheta);
+  bool   TableWeight(double &aWeight);
+  const std::vector<double>& WeightTable();
+  void   BuildWeightTable(std::vector<double> &aTable);
+  bool   ReadWeightTable(std::vector<double> &aTable);
+  void   WriteWeightTable(const std::vector<double> &aTable);
+  void   FillWeightTableHeader(std::vector<double> &aTable, const int aNK, const int aNR, const int aNCos) const;
+  static double InterpolateWeightTable(const std::vector<double> &aTable, double aKStar, double aRStar, double aCosTheta, bool &aInside);
+
+  bool    fUseWeightTable;   // interpolate weights from the tables
+  double  fTableAccuracy;    // target absolute accuracy of the interpolated weights
+  int     fTableNKStar;      // initial number of k* nodes
+  double  fTableKStarMax;    // upper edge of the table in k* (GeV/c)
+  int     fTableNRStar;      // initial number of r* nodes
+  double  fTableRStarMax;    // upper edge of the table in r* (fm)
+  int     fTableNCosTheta;   // number of cos theta* nodes
+  TString fTableFileName;    // file caching the tables, empty = no cache
+  std::map<int, std::vector<double> > fWeightTables; //! tables per internal pair type
+
 #ifdef __ROOT__
-  ClassDef(AliFemtoModelWeightGeneratorLednicky,1)
+  ClassDef(AliFemtoModelWeightGeneratorLednicky,2)
 #endif
 };
 
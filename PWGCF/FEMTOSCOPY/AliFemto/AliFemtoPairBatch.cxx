@@ -0,0 +1,64 @@
+///
+/// \file AliFemtoPairBatch.cxx
+///
+
+#include <TMath.h>
+#include "AliFemtoPairBatch.h"
+
+AliFemtoPairBatch::AliFemtoPairBatch():
+  fPairs(new AliFemtoPair[kMaxSize]),
+  fSize(0)
+{
+  // Default constructor
+}
+
+AliFemtoPairBatch::~AliFemtoPairBatch()
+{
+  delete [] fPairs;
+}
+
+bool AliFemtoPairBatch::Add(const AliFemtoParticle* track1, const AliFemtoParticle* track2)
+{
+  if (IsFull()) {
+    return false;
+  }
+  fPairs[fSize].SetTrack1(track1);
+  fPairs[fSize].SetTrack2(track2);
+
+  const AliFemtoLorentzVector &p1 = track1->FourMomentum(),
+                              &p2 = track2->FourMomentum();
+  fPx1[fSize] = p1.px();  fPy1[fSize] = p1.py();  fPz1[fSize] = p1.pz();  fE1[fSize] = p1.e();
+  fPx2[fSize] = p2.px();  fPy2[fSize] = p2.py();  fPz2[fSize] = p2.pz();  fE2[fSize] = p2.e();
+  fSize++;
+  return true;
+}
+
+void AliFemtoPairBatch::Compute()
+{
+  // The expressions follow AliFemtoPair term by term, so that the
+  // results are bitwise identical to the per-pair getters
+  for (int i = 0; i < fSize; i++) {
+    const double dx = fPx1[i] - fPx2[i],
+                 dy = fPy1[i] - fPy2[i],
+                 dz = fPz1[i] - fPz2[i],
+                 dt = fE1[i] - fE2[i];
+    const double xt = fPx1[i] + fPx2[i],
+                 yt = fPy1[i] + fPy2[i],
+                 zz = fPz1[i] + fPz2[i],
+                 tt = fE1[i] + fE2[i];
+
+    // qinv = -m(p1-p2), m() being negative for space-like vectors
+    const double m2 = dt*dt - (dx*dx + dy*dy + dz*dz);
+    fQInv[i] = (m2 < 0) ? ::sqrt(-m2) : -::sqrt(m2);
+
+    const double k1 = ::sqrt(xt*xt + yt*yt);
+    fKT[i] = .5 * k1;
+
+    fQOutCMS[i] = (k1 != 0) ? (dx*xt + dy*yt) / k1 : 0;
+    fQSideCMS[i] = (k1 != 0) ? 2.0*(fPx2[i]*fPy1[i] - fPx1[i]*fPy2[i]) / k1 : 0;
+
+    const double beta = zz/tt;
+    const double gamma = 1.0/TMath::Sqrt((1.-beta)*(1.+beta));
+    fQLongCMS[i] = gamma*(dz - beta*dt);
+  }
+}
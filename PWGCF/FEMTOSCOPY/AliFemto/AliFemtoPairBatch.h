@@ -0,0 +1,60 @@
+///
+/// \file  AliFemtoPairBatch.h
+/// \class AliFemtoPairBatch
+/// \brief A block of pairs with precomputed relative-momentum variables
+///
+/// The analysis collects the pairs passing its pair cut into a batch and hands
+/// the full block to the correlation functions (AddRealPairs/AddMixedPairs).
+/// The four-momenta of both particles are packed into flat arrays and the
+/// common pair variables (qinv, kT and the LCMS components of q) are computed
+/// for the whole block in loops without branches or virtual calls.
+/// The values are identical to the ones of the corresponding AliFemtoPair
+/// getters. The AliFemtoPair objects are kept for everything else.
+///
+
+#ifndef ALIFEMTOPAIRBATCH_H
+#define ALIFEMTOPAIRBATCH_H
+
+#include "AliFemtoPair.h"
+
+class AliFemtoPairBatch {
+public:
+  enum { kMaxSize = 256 };
+
+  AliFemtoPairBatch();
+  ~AliFemtoPairBatch();
+
+  /// Add the pair (track1, track2), returns false if the batch is full
+  bool Add(const AliFemtoParticle* track1, const AliFemtoParticle* track2);
+  /// Compute the pair variables of all pairs in the batch
+  void Compute();
+  void Clear() { fSize = 0; }
+
+  int Size() const { return fSize; }
+  bool IsFull() const { return fSize == kMaxSize; }
+
+  AliFemtoPair* Pair(int i) const { return &fPairs[i]; }
+  double QInv(int i) const { return fQInv[i]; }
+  double KT(int i) const { return fKT[i]; }
+  double QOutCMS(int i) const { return fQOutCMS[i]; }
+  double QSideCMS(int i) const { return fQSideCMS[i]; }
+  double QLongCMS(int i) const { return fQLongCMS[i]; }
+
+private:
+  AliFemtoPairBatch(const AliFemtoPairBatch&);
+  AliFemtoPairBatch& operator=(const AliFemtoPairBatch&);
+
+  AliFemtoPair *fPairs;            ///< [kMaxSize] pair objects, reused from block to block
+  int fSize;                       ///< number of pairs in the batch
+
+  double fPx1[kMaxSize], fPy1[kMaxSize], fPz1[kMaxSize], fE1[kMaxSize];  ///< four-momentum of particle 1
+  double fPx2[kMaxSize], fPy2[kMaxSize], fPz2[kMaxSize], fE2[kMaxSize];  ///< four-momentum of particle 2
+
+  double fQInv[kMaxSize];          ///< AliFemtoPair::QInv()
+  double fKT[kMaxSize];            ///< AliFemtoPair::KT()
+  double fQOutCMS[kMaxSize];       ///< AliFemtoPair::QOutCMS()
+  double fQSideCMS[kMaxSize];      ///< AliFemtoPair::QSideCMS()
+  double fQLongCMS[kMaxSize];      ///< AliFemtoPair::QLongCMS()
+};
+
+#endif
@@ -0,0 +1,103 @@
+///
+/// \file AliFemtoParticleSelectionCache.cxx
+///
+
+#include <typeinfo>
+#include <TList.h>
+#include <TObjString.h>
+#include <TString.h>
+
+#include "AliFemtoParticleSelectionCache.h"
+#include "AliFemtoParticleCut.h"
+#include "AliFemtoParticle.h"
+#include "AliFemtoEvent.h"
+
+// defined in AliFemtoSimpleAnalysis.cxx
+extern void FillHbtParticleCollection(AliFemtoParticleCut *partCut,
+                                      AliFemtoEvent *hbtEvent,
+                                      AliFemtoParticleCollection *partCollection,
+                                      bool performSharedDaughterCut);
+
+AliFemtoParticleSelectionCache::AliFemtoParticleSelectionCache():
+  fEvent(NULL),
+  fCollections()
+{
+  // Default constructor
+}
+
+AliFemtoParticleSelectionCache::~AliFemtoParticleSelectionCache()
+{
+  Clear();
+}
+
+void AliFemtoParticleSelectionCache::Clear()
+{
+  // delete the stored particles
+  for (std::map<std::string, AliFemtoParticleCollection*>::iterator iter = fCollections.begin(); iter != fCollections.end(); ++iter) {
+    for (AliFemtoParticleIterator piter = iter->second->begin(); piter != iter->second->end(); ++piter) {
+      delete *piter;
+    }
+    delete iter->second;
+  }
+  fCollections.clear();
+  fEvent = NULL;
+}
+
+void AliFemtoParticleSelectionCache::NewEvent(const AliFemtoEvent *event)
+{
+  Clear();
+  fEvent = event;
+}
+
+const std::string& AliFemtoParticleSelectionCache::CutKey(AliFemtoParticleCut *partCut, bool performSharedDaughterCut)
+{
+  // configuration key of the cut, empty if the cut must not be shared;
+  // computed once per cut, the cuts are not reconfigured during the run
+  std::map<AliFemtoParticleCut*, std::string> &keys = fCutKeys[performSharedDaughterCut ? 1 : 0];
+  std::map<AliFemtoParticleCut*, std::string>::iterator found = keys.find(partCut);
+  if (found != keys.end()) {
+    return found->second;
+  }
+
+  std::string &key = keys[partCut];
+  if (partCut->PassMonitorColl()->size() != 0 || partCut->FailMonitorColl()->size() != 0) {
+    return key;
+  }
+
+  key = typeid(*partCut).name();
+  key += Form(";type=%d;shared=%d", (int)partCut->Type(), performSharedDaughterCut ? 1 : 0);
+  TList *settings = partCut->ListSettings();
+  if (settings) {
+    TIter next(settings);
+    while (TObject *obj = next()) {
+      key += ';';
+      key += obj->GetName();
+    }
+    settings->SetOwner(kTRUE);
+    delete settings;
+  }
+  return key;
+}
+
+void AliFemtoParticleSelectionCache::FillParticleCollection(AliFemtoParticleCut *partCut,
+                                                            AliFemtoEvent *event,
+                                                            AliFemtoParticleCollection *partCollection,
+                                                            bool performSharedDaughterCut)
+{
+  const std::string &key = (event == fEvent) ? CutKey(partCut, performSharedDaughterCut) : std::string();
+  if (key.empty()) {
+    FillHbtParticleCollection(partCut, event, partCollection, performSharedDaughterCut);
+    return;
+  }
+
+  AliFemtoParticleCollection *&selected = fCollections[key];
+  if (!selected) {
+    selected = new AliFemtoParticleCollection;
+    FillHbtParticleCollection(partCut, event, selected, performSharedDaughterCut);
+  }
+
+  // every analysis owns (and may store) its particles: hand out copies
+  for (AliFemtoParticleConstIterator piter = selected->begin(); piter != selected->end(); ++piter) {
+    partCollection->push_back(new AliFemtoParticle(**piter));
+  }
+}
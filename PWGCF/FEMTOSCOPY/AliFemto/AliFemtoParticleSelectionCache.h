@@ -0,0 +1,55 @@
+///
+/// \file  AliFemtoParticleSelectionCache.h
+/// \class AliFemtoParticleSelectionCache
+/// \brief Particle collections of one event shared by analyses with identical particle cuts
+///
+/// The manager owns one cache and hands it to its analyses. The first analysis
+/// asking for the particles of a cut in the current event runs the cut and keeps
+/// the passing particles; every further analysis with an equivalent cut gets
+/// copies of them instead of evaluating the cut again.
+///
+/// Two cuts are equivalent if they are of the same class and type and return
+/// the same ListSettings(), and if the shared daughter cut setting agrees.
+/// Only cuts without cut monitors are shared (the cut monitors of the other
+/// cuts would not be filled), and the pass/fail counters of a cut are only
+/// updated when the cut is actually evaluated.
+///
+
+#ifndef ALIFEMTOPARTICLESELECTIONCACHE_H
+#define ALIFEMTOPARTICLESELECTIONCACHE_H
+
+#include <map>
+#include <string>
+
+#include "AliFemtoParticleCollection.h"
+
+class AliFemtoEvent;
+class AliFemtoParticleCut;
+
+class AliFemtoParticleSelectionCache {
+public:
+  AliFemtoParticleSelectionCache();
+  ~AliFemtoParticleSelectionCache();
+
+  /// Start a new event, dropping the particles of the previous one
+  void NewEvent(const AliFemtoEvent *event);
+
+  /// Fill partCollection with the particles of event passing partCut
+  void FillParticleCollection(AliFemtoParticleCut *partCut,
+                              AliFemtoEvent *event,
+                              AliFemtoParticleCollection *partCollection,
+                              bool performSharedDaughterCut);
+
+private:
+  AliFemtoParticleSelectionCache(const AliFemtoParticleSelectionCache &);
+  AliFemtoParticleSelectionCache& operator=(const AliFemtoParticleSelectionCache &);
+
+  void Clear();
+  const std::string& CutKey(AliFemtoParticleCut *partCut, bool performSharedDaughterCut);
+
+  const AliFemtoEvent *fEvent;                                     ///< event the collections belong to
+  std::map<std::string, AliFemtoParticleCollection*> fCollections; ///< selected particles per cut key
+  std::map<AliFemtoParticleCut*, std::string> fCutKeys[2];         ///< cut key per cut, without/with shared daughter cut
+};
+
+#endif
@@ -195,4 +195,18 @@ AliFemtoPicoEvent& AliFemtoPicoEvent::operator=(const AliFemtoPicoEvent& aPicoEv
 
   return *this;
 }
-
+//_________________
+void AliFemtoPicoEvent::ClearParticles()
+{
+  // Delete the stored particles, leaving empty collections behind
+  AliFemtoParticleCollection* collections[3] = {fFirstParticleCollection,
+                                                fSecondParticleCollection,
+                                                fThirdParticleCollection};
+  for (int ic = 0; ic < 3; ic++) {
+    if (!collections[ic]) continue;
+    for (AliFemtoParticleIterator iter=collections[ic]->begin();iter!=collections[ic]->end();iter++){
+      delete *iter;
+    }
+    collections[ic]->clear();
+  }
+}
@@ -52,6 +52,9 @@ public:
 
   AliFemtoPicoEvent& operator=(const AliFemtoPicoEvent& aPicoEvent);
 
+  /* delete the particles but keep the collections, so the event can be refilled */
+  void ClearParticles();
+
   /* may want to have other stuff in here, like where is primary vertex */
 
   AliFemtoParticleCollection* FirstParticleCollection();
@@ -6,6 +6,7 @@
 ///////////////////////////////////////////////////////////////////////////
 
 #include "AliFemtoQinvCorrFctn.h"
+#include "AliFemtoPairBatch.h"
 //#include "AliFemtoHisto.h"
 #include <cstdio>
 
@@ -326,6 +327,31 @@ void AliFemtoQinvCorrFctn::AddMixedPair(AliFemtoPair* pair){
   }
 //_______________________________________________________________
 
+}
+//____________________________
+void AliFemtoQinvCorrFctn::AddRealPairs(const AliFemtoPairBatch& aBatch){
+  // add a block of true pairs, using the precomputed qinv and kT
+  if (fDetaDphiscal) {
+    AliFemtoCorrFctn::AddRealPairs(aBatch);
+    return;
+  }
+  for (int i = 0; i < aBatch.Size(); i++) {
+    if (fPairCut && !fPairCut->Pass(aBatch.Pair(i))) continue;
+    fNumerator->Fill(fabs(aBatch.QInv(i)));
+    fkTMonitor->Fill(aBatch.KT(i));
+  }
+}
+//____________________________
+void AliFemtoQinvCorrFctn::AddMixedPairs(const AliFemtoPairBatch& aBatch){
+  // add a block of mixed pairs, using the precomputed qinv
+  if (fDetaDphiscal || fPairKinematics) {
+    AliFemtoCorrFctn::AddMixedPairs(aBatch);
+    return;
+  }
+  for (int i = 0; i < aBatch.Size(); i++) {
+    if (fPairCut && !fPairCut->Pass(aBatch.Pair(i))) continue;
+    fDenominator->Fill(fabs(aBatch.QInv(i)),1.0);
+  }
 }
 //____________________________
 void AliFemtoQinvCorrFctn::Write(){
@@ -9,8 +9,11 @@
 #include "AliFemtoXiCut.h"
 #include "AliFemtoXiTrackCut.h"
 #include "AliFemtoPicoEvent.h"
+#include "AliFemtoPairBatch.h"
+#include "AliFemtoParticleSelectionCache.h"
 
 #include <string>
+#include <vector>
 #include <iostream>
 #include <iterator>
 
@@ -161,7 +164,12 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis():
   fMinSizePartCollection(0),
   fVerbose(kTRUE),
   fPerformSharedDaughterCut(kFALSE),
-  fEnablePairMonitors(kFALSE)
+  fEnablePairMonitors(kFALSE),
+  fMaxPairQInv(0.0),
+  fUsePairBatches(kFALSE),
+  fRecyclePicoEvents(kFALSE),
+  fSparePicoEvent(NULL),
+  fParticleSelectionCache(NULL)
 {
   // Default constructor
   fCorrFctnCollection = new AliFemtoCorrFctnCollection;
@@ -183,7 +191,12 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis(const AliFemtoSimpleAnalysis& a):
   fMinSizePartCollection(a.fMinSizePartCollection),
   fVerbose(a.fVerbose),
   fPerformSharedDaughterCut(a.fPerformSharedDaughterCut),
-  fEnablePairMonitors(a.fEnablePairMonitors)
+  fEnablePairMonitors(a.fEnablePairMonitors),
+  fMaxPairQInv(a.fMaxPairQInv),
+  fUsePairBatches(a.fUsePairBatches),
+  fRecyclePicoEvents(a.fRecyclePicoEvents),
+  fSparePicoEvent(NULL),
+  fParticleSelectionCache(NULL)
 {
   /// Copy constructor
 
@@ -294,6 +307,7 @@ AliFemtoSimpleAnalysis::~AliFemtoSimpleAnalysis()
     }
     delete fMixingBuffer;
   }
+  delete fSparePicoEvent;
 }
 //______________________
 AliFemtoSimpleAnalysis& AliFemtoSimpleAnalysis::operator=(const AliFemtoSimpleAnalysis& aAna)
@@ -379,6 +393,9 @@ AliFemtoSimpleAnalysis& AliFemtoSimpleAnalysis::operator=(const AliFemtoSimpleAn
   fVerbose = aAna.fVerbose;
   fPerformSharedDaughterCut = aAna.fPerformSharedDaughterCut;
   fEnablePairMonitors = aAna.fEnablePairMonitors;
+  fMaxPairQInv = aAna.fMaxPairQInv;
+  fUsePairBatches = aAna.fUsePairBatches;
+  fRecyclePicoEvents = aAna.fRecyclePicoEvents;
 
   return *this;
 }
@@ -450,8 +467,13 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
   // analysis likes. This is what we will make pairs from and put in Mixing
   // Buffer.
   // No memory leak: we will delete picoevents when they come out of the
-  // mixing buffer
-  fPicoEvent = new AliFemtoPicoEvent;
+  // mixing buffer (or refill them, when recycling)
+  if (fSparePicoEvent) {
+    fPicoEvent = fSparePicoEvent;
+    fSparePicoEvent = NULL;
+  } else {
+    fPicoEvent = new AliFemtoPicoEvent;
+  }
 
   AliFemtoParticleCollection *collection1 = fPicoEvent->FirstParticleCollection(),
                              *collection2 = fPicoEvent->SecondParticleCollection();
@@ -467,17 +489,32 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
   // Subroutine fills fPicoEvent'a FirstParticleCollection with tracks from
   // hbtEvent which pass fFirstParticleCut. Uses cut's "Type()" to determine
   // which track collection to pull from hbtEvent.
-  FillHbtParticleCollection(fFirstParticleCut,
-                            (AliFemtoEvent*)hbtEvent,
-                            fPicoEvent->FirstParticleCollection(),
-                            fPerformSharedDaughterCut);
+  // With a shared cache, analyses with equivalent cuts reuse the selection.
+  if (fParticleSelectionCache) {
+    fParticleSelectionCache->FillParticleCollection(fFirstParticleCut,
+                                                    (AliFemtoEvent*)hbtEvent,
+                                                    fPicoEvent->FirstParticleCollection(),
+                                                    fPerformSharedDaughterCut);
+  } else {
+    FillHbtParticleCollection(fFirstParticleCut,
+                              (AliFemtoEvent*)hbtEvent,
+                              fPicoEvent->FirstParticleCollection(),
+                              fPerformSharedDaughterCut);
+  }
 
   // fill second particle cut if not analyzing identical particles
   if ( !AnalyzeIdenticalParticles() ) {
+    if (fParticleSelectionCache) {
+      fParticleSelectionCache->FillParticleCollection(fSecondParticleCut,
+                                                      (AliFemtoEvent*)hbtEvent,
+                                                      fPicoEvent->SecondParticleCollection(),
+                                                      fPerformSharedDaughterCut);
+    } else {
       FillHbtParticleCollection(fSecondParticleCut,
                                 (AliFemtoEvent*)hbtEvent,
                                 fPicoEvent->SecondParticleCollection(),
                                 fPerformSharedDaughterCut);
+    }
   }
 
   const UInt_t coll_1_size = collection1->size(),
@@ -504,7 +541,13 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
 
   if (!tmpPassEvent) {
     EventEnd(hbtEvent);
-    delete fPicoEvent;
+    if (fRecyclePicoEvents) {
+      fPicoEvent->ClearParticles();
+      fSparePicoEvent = fPicoEvent;
+    } else {
+      delete fPicoEvent;
+    }
+    fPicoEvent = NULL;
     return;
   }
 
@@ -545,13 +588,24 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
   }
 
   //--------- If mixing buffer is full, delete oldest event ---------//
-  if ( MixingBufferFull() ) {
-    delete MixingBuffer()->back();
-    MixingBuffer()->pop_back();
-  }
+  if ( MixingBufferFull() && fRecyclePicoEvents && !MixingBuffer()->empty() ) {
+    // keep the oldest event as spare for the next one and move its list
+    // node to the front, holding the current event
+    AliFemtoPicoEventCollection *buffer = MixingBuffer();
+    AliFemtoPicoEvent *oldest = buffer->back();
+    oldest->ClearParticles();
+    fSparePicoEvent = oldest;
+    buffer->back() = fPicoEvent;
+    buffer->splice(buffer->begin(), *buffer, --buffer->end());
+  } else {
+    if ( MixingBufferFull() ) {
+      delete MixingBuffer()->back();
+      MixingBuffer()->pop_back();
+    }
 
-  //-------- Add current event (fPicoEvent) to mixing buffer --------//
-  MixingBuffer()->push_front(fPicoEvent);
+    //-------- Add current event (fPicoEvent) to mixing buffer --------//
+    MixingBuffer()->push_front(fPicoEvent);
+  }
 
   EventEnd(hbtEvent);  // cleanup for EbyE
   //cout << "AliFemtoSimpleAnalysis::ProcessEvent() - return to caller ... " << endl;
@@ -600,17 +654,35 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
 
   // Create the pair outside the loop - only allocate once
   AliFemtoPair* tPair = new AliFemtoPair;
+  AliFemtoPairBatch* tBatch = fUsePairBatches ? new AliFemtoPairBatch : NULL;
+
+  // Optional qinv pre-selection: the four-momenta are packed once per
+  // collection, so that combinations above fMaxPairQInv are dropped with a
+  // few multiplications, before the pair is formed
+  const bool useQInvCut = fMaxPairQInv > 0.0;
+  const double maxQInv2 = fMaxPairQInv * fMaxPairQInv;
+  std::vector<double> tMom1, tMom2;
+  if (useQInvCut) {
+    FillFourMomenta(partCollection1, tMom1);
+    if (partCollection2) {
+      FillFourMomenta(partCollection2, tMom2);
+    }
+  }
+  const std::vector<double> &tInnerMom = partCollection2 ? tMom2 : tMom1;
+  size_t tIndex1 = 0;
 
   // Begin the outer loop
   for (AliFemtoParticleConstIterator tPartIter1 = tStartOuterLoop;
                                      tPartIter1 != tEndOuterLoop;
-                                     ++tPartIter1) {
+                                     ++tPartIter1, ++tIndex1) {
 
     // If analyzing identical particles, start inner loop at the particle
     // after the current outer loop position, (loops until end)
+    size_t tIndex2 = 0;
     if (!partCollection2) {
       tStartInnerLoop = tPartIter1;
       tStartInnerLoop++;
+      tIndex2 = tIndex1 + 1;
     }
 
     // If we have two collections - set the first track
@@ -621,7 +693,24 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
     // Begin the inner loop
     for (AliFemtoParticleConstIterator tPartIter2 = tStartInnerLoop;
                                        tPartIter2 != tEndInnerLoop;
-                                     ++tPartIter2) {
+                                     ++tPartIter2, ++tIndex2) {
+
+      if (useQInvCut) {
+        const double *p1 = &tMom1[4 * tIndex1],
+                     *p2 = &tInnerMom[4 * tIndex2];
+        const double dx = p1[0] - p2[0],
+                     dy = p1[1] - p2[1],
+                     dz = p1[2] - p2[2],
+                     de = p1[3] - p2[3];
+        if (dx * dx + dy * dy + dz * dz - de * de > maxQInv2) {
+          // keep the alternation of the particle order identical
+          if (partCollection2 == NULL) {
+            swpart = !swpart;
+          }
+          continue;
+        }
+      }
+
       // If we have two collections - only set the second track
       if (partCollection2 != NULL) {
         tPair->SetTrack2(*tPartIter2);
@@ -641,8 +730,15 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
         fPairCut->FillCutMonitor(tPair, tmpPassPair);
       }
 
+      // In batch mode, collect the pair and pass full blocks to the CF's
+      if (tmpPassPair && tBatch) {
+        tBatch->Add(tPair->Track1(), tPair->Track2());
+        if (tBatch->IsFull()) {
+          FlushPairBatch(type, *tBatch);
+        }
+      }
       // If pair passes cut, loop over CF's and add pair to real/mixed
-      if (tmpPassPair) {
+      else if (tmpPassPair) {
         for (AliFemtoCorrFctnIterator tCorrFctnIter = fCorrFctnCollection->begin();
                                       tCorrFctnIter != fCorrFctnCollection->end();
                                     ++tCorrFctnIter) {
@@ -662,6 +758,49 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
 
   // we are done with the pair
   delete tPair;
+  if (tBatch) {
+    FlushPairBatch(type, *tBatch);
+    delete tBatch;
+  }
+}
+//_________________________
+void AliFemtoSimpleAnalysis::FlushPairBatch(const string &type, AliFemtoPairBatch &batch)
+{
+  /// Compute the pair variables of the batch, pass it to all correlation
+  /// functions and empty it
+  if (batch.Size() == 0) {
+    return;
+  }
+  batch.Compute();
+  for (AliFemtoCorrFctnIterator tCorrFctnIter = fCorrFctnCollection->begin();
+                                tCorrFctnIter != fCorrFctnCollection->end();
+                              ++tCorrFctnIter) {
+    AliFemtoCorrFctn* tCorrFctn = *tCorrFctnIter;
+    if (type == "real")
+      tCorrFctn->AddRealPairs(batch);
+    else if (type == "mixed")
+      tCorrFctn->AddMixedPairs(batch);
+    else
+      cout << "Problem with pair type, type = " << type << endl;
+  }
+  batch.Clear();
+}
+//_________________________
+void AliFemtoSimpleAnalysis::FillFourMomenta(const AliFemtoParticleCollection *partCollection,
+                                             std::vector<double> &momenta)
+{
+  /// Pack px, py, pz, E of all particles of the collection, in order
+  momenta.clear();
+  momenta.reserve(4 * partCollection->size());
+  for (AliFemtoParticleConstIterator tPartIter = partCollection->begin();
+                                     tPartIter != partCollection->end();
+                                   ++tPartIter) {
+    const AliFemtoLorentzVector &p = (*tPartIter)->FourMomentum();
+    momenta.push_back(p.px());
+    momenta.push_back(p.py());
+    momenta.push_back(p.pz());
+    momenta.push_back(p.e());
+  }
 }
 //_________________________
 void AliFemtoSimpleAnalysis::EventBegin(const AliFemtoEvent* ev)
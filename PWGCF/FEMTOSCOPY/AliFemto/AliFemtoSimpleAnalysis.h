@@ -5,6 +5,9 @@
 #ifndef ALIFEMTO_SIMPLE_ANALYSIS_H
 #define ALIFEMTO_SIMPLE_ANALYSIS_H
 
+#include <string>
+#include <vector>
+
 #include "AliFemtoAnalysis.h"        // base analysis class
 #include "AliFemtoPairCut.h"
 #include "AliFemtoEventCut.h"
@@ -16,6 +19,8 @@
 #include "AliFemtoV0SharedDaughterCut.h"
 
 class AliFemtoPicoEventCollectionVectorHideAway;
+class AliFemtoPairBatch;
+class AliFemtoParticleSelectionCache;
 class AliFemtoPicoEvent;
 
 ///
@@ -98,6 +103,29 @@ public:
   void SetEnablePairMonitors(Bool_t aEnable);
   Bool_t EnablePairMonitors();
 
+  /// Skip particle combinations with qinv above this value before the pair
+  /// cut and the correlation functions see them (0, the default, disables it).
+  /// Must be at or above the largest qinv (2k* for identical particles)
+  /// booked by any attached correlation function.
+  void SetMaxPairQInv(double aMaxQInv);
+  double MaxPairQInv() const;
+
+  /// Hand the pairs passing the pair cut to the correlation functions in
+  /// blocks (AliFemtoCorrFctn::AddRealPairs/AddMixedPairs), with the common
+  /// pair variables computed once per block.
+  void SetUsePairBatches(Bool_t aUse);
+  Bool_t UsePairBatches() const;
+
+  /// Recycle pico events instead of reallocating them: the event dropped
+  /// from a full mixing buffer (or a rejected one) is emptied and refilled
+  /// with the next event, and the buffer entry is rotated in place.
+  void SetRecyclePicoEvents(Bool_t aRecycle);
+  Bool_t RecyclePicoEvents() const;
+
+  /// Take the particle collections from a cache shared with other analyses
+  /// of the same manager (not owned, NULL evaluates the cuts directly).
+  void SetParticleSelectionCache(AliFemtoParticleSelectionCache *aCache);
+
   unsigned int NumEventsToMix() const;
   void SetNumEventsToMix(const unsigned int& NumberOfEventsToMix);
   AliFemtoPicoEvent* CurrentPicoEvent();
@@ -158,6 +186,14 @@ protected:
                  AliFemtoParticleCollection* ParticlesPssingCut2=NULL,
                  Bool_t enablePairMonitors=kFALSE);
 
+  /// Pack the four-momenta of a particle collection for the qinv pre-selection
+  static void FillFourMomenta(const AliFemtoParticleCollection *partCollection,
+                              std::vector<double> &momenta);
+
+  /// Compute the pair variables of the batch, pass it to all correlation
+  /// functions and empty it
+  void FlushPairBatch(const std::string &type, AliFemtoPairBatch &batch);
+
   AliFemtoPicoEventCollectionVectorHideAway* fPicoEventCollectionVectorHideAway; //!<! Mixing Buffer used for Analyses which wrap this one
 
   AliFemtoPairCut*             fPairCut;             ///< cut applied to pairs
@@ -176,6 +212,11 @@ protected:
   Bool_t fVerbose;
   Bool_t fPerformSharedDaughterCut;
   Bool_t fEnablePairMonitors;
+  double fMaxPairQInv;                               ///< pre-selection of pairs below this qinv, 0 = off
+  Bool_t fUsePairBatches;                            ///< pass pairs to the correlation functions in blocks
+  Bool_t fRecyclePicoEvents;                         ///< reuse pico events dropped from the mixing buffer
+  AliFemtoPicoEvent* fSparePicoEvent;                //!<! emptied pico event waiting to be refilled
+  AliFemtoParticleSelectionCache* fParticleSelectionCache; //!<! particle collections shared between analyses
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
@@ -304,4 +345,39 @@ inline void AliFemtoSimpleAnalysis::SetEnablePairMonitors(Bool_t aEnable)
   fEnablePairMonitors = aEnable;
 }
 
+inline void AliFemtoSimpleAnalysis::SetMaxPairQInv(double aMaxQInv)
+{
+  fMaxPairQInv = aMaxQInv;
+}
+
+inline double AliFemtoSimpleAnalysis::MaxPairQInv() const
+{
+  return fMaxPairQInv;
+}
+
+inline void AliFemtoSimpleAnalysis::SetUsePairBatches(Bool_t aUse)
+{
+  fUsePairBatches = aUse;
+}
+
+inline Bool_t AliFemtoSimpleAnalysis::UsePairBatches() const
+{
+  return fUsePairBatches;
+}
+
+inline void AliFemtoSimpleAnalysis::SetRecyclePicoEvents(Bool_t aRecycle)
+{
+  fRecyclePicoEvents = aRecycle;
+}
+
+inline Bool_t AliFemtoSimpleAnalysis::RecyclePicoEvents() const
+{
+  return fRecyclePicoEvents;
+}
+
+inline void AliFemtoSimpleAnalysis::SetParticleSelectionCache(AliFemtoParticleSelectionCache *aCache)
+{
+  fParticleSelectionCache = aCache;
+}
+
 #endif
@@ -42,11 +42,14 @@ The names are available via the function PairClassName(Int_t i)
 //                                                                       //
 ///////////////////////////////////////////////////////////////////////////
 
+#include <vector>
+
 #include <TString.h>
 #include <TList.h>
 #include <TMath.h>
 #include <TObject.h>
 #include <TGrid.h>
+#include <TDatabasePDG.h>
 
 #include <AliKFParticle.h>
 
@@ -155,6 +158,10 @@ AliDielectron::AliDielectron() :
   fDontClearArrays(kFALSE),
   fEventProcess(kTRUE),
   fUseGammaTracks(kTRUE),
+  fUsePairPreSelection(kFALSE),
+  fPreSelMassMin(0.),
+  fPreSelMassMax(1.e10),
+  fPreSelOpeningAngleMin(0.),
   fEstimatorFilename(""),
   fEstimatorObjArray(0x0),
   fTRDpidCorrectionFilename(""),
@@ -227,6 +234,10 @@ AliDielectron::AliDielectron(const char* name, const char* title) :
   fDontClearArrays(kFALSE),
   fEventProcess(kTRUE),
   fUseGammaTracks(kTRUE),
+  fUsePairPreSelection(kFALSE),
+  fPreSelMassMin(0.),
+  fPreSelMassMax(1.e10),
+  fPreSelOpeningAngleMin(0.),
   fEstimatorFilename(""),
   fEstimatorObjArray(0x0),
   fTRDpidCorrectionFilename(""),
@@ -329,6 +340,8 @@ void AliDielectron::Init()
   if(fHistos) {
     (*fUsedVars)|= (*fHistos->GetUsedVars());
   }
+  // make sure the inputs of requested derived variables are filled as well
+  AliDielectronVarManager::AddDependencies(fUsedVars);
 
 }
 
@@ -1392,10 +1405,50 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
 
   UInt_t selectedMask=(1<<fPairFilter.GetCuts()->GetEntries())-1;
 
+  // pack the momenta of the second legs into plain arrays for the pre-selection,
+  // such that the inner loop over all combinations is cheap and vectorisable
+  std::vector<Double_t> px2, py2, pz2, p2, e2;
+  std::vector<Char_t> preSelected;
+  Double_t mLeg1Sq=0., mLeg2Sq=0., massMinSq=0., massMaxSq=0., cosAngleMax=1.;
+  if (fUsePairPreSelection) {
+    TParticlePDG *pdgLeg1=TDatabasePDG::Instance()->GetParticle(fPdgLeg1);
+    TParticlePDG *pdgLeg2=TDatabasePDG::Instance()->GetParticle(fPdgLeg2);
+    mLeg1Sq=pdgLeg1 ? pdgLeg1->Mass()*pdgLeg1->Mass() : 0.;
+    mLeg2Sq=pdgLeg2 ? pdgLeg2->Mass()*pdgLeg2->Mass() : 0.;
+    massMinSq=fPreSelMassMin>0. ? fPreSelMassMin*fPreSelMassMin : -1.;
+    massMaxSq=fPreSelMassMax*fPreSelMassMax;
+    cosAngleMax=TMath::Cos(fPreSelOpeningAngleMin);
+    px2.resize(ntrack2); py2.resize(ntrack2); pz2.resize(ntrack2);
+    p2.resize(ntrack2);  e2.resize(ntrack2);  preSelected.resize(ntrack2);
+    for (Int_t itrack2=0; itrack2<ntrack2; ++itrack2){
+      const AliVTrack *track2=static_cast<const AliVTrack*>(arrTracks2.UncheckedAt(itrack2));
+      px2[itrack2]=track2->Px();
+      py2[itrack2]=track2->Py();
+      pz2[itrack2]=track2->Pz();
+      p2[itrack2]=TMath::Sqrt(px2[itrack2]*px2[itrack2]+py2[itrack2]*py2[itrack2]+pz2[itrack2]*pz2[itrack2]);
+      e2[itrack2]=TMath::Sqrt(p2[itrack2]*p2[itrack2]+mLeg2Sq);
+    }
+  }
+
   for (Int_t itrack1=0; itrack1<ntrack1; ++itrack1){
     Int_t end=ntrack2;
     if (arr1==arr2) end=itrack1;
+
+    if (fUsePairPreSelection) {
+      const AliVTrack *track1=static_cast<const AliVTrack*>(arrTracks1.UncheckedAt(itrack1));
+      const Double_t px1=track1->Px(), py1=track1->Py(), pz1=track1->Pz();
+      const Double_t p1=TMath::Sqrt(px1*px1+py1*py1+pz1*pz1);
+      const Double_t e1=TMath::Sqrt(p1*p1+mLeg1Sq);
+      for (Int_t itrack2=0; itrack2<end; ++itrack2){
+        const Double_t dot=px1*px2[itrack2]+py1*py2[itrack2]+pz1*pz2[itrack2];
+        const Double_t massSq=mLeg1Sq+mLeg2Sq+2.*(e1*e2[itrack2]-dot);
+        // opening angle >= min  <=>  cos(angle) <= cos(min)
+        preSelected[itrack2]=(massSq>=massMinSq) && (massSq<=massMaxSq) && (dot<=cosAngleMax*p1*p2[itrack2]);
+      }
+    }
+
     for (Int_t itrack2=0; itrack2<end; ++itrack2){
+      if (fUsePairPreSelection && !preSelected[itrack2]) continue;
       //create the pair (direct pointer to the memory by this daughter reference are kept also for ME)
       candidate->SetTracks(&(*static_cast<AliVTrack*>(arrTracks1.UncheckedAt(itrack1))), fPdgLeg1,
                            &(*static_cast<AliVTrack*>(arrTracks2.UncheckedAt(itrack2))), fPdgLeg2);
@@ -1453,6 +1506,8 @@ void AliDielectron::FillPairArrayTR()
 
   while ( fTrackRotator->NextCombination() ){
     if(fTrackRotator->SameTracks() ) continue;
+    // optional mass/pt window of the rotator, checked before the pair is built
+    if(!fTrackRotator->PassesPairPreselection() ) continue;
     AliDielectronPair candidate;
     candidate.SetKFUsage(fUseKF);
     candidate.SetTracks(&fTrackRotator->GetKFTrackP(), &fTrackRotator->GetKFTrackN(),
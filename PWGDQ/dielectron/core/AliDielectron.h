@@ -179,6 +179,11 @@ public:
   void SetEventProcess(Bool_t setValue=kTRUE) { fEventProcess=setValue; }
   Bool_t GammaTracksUsed() const { return fUseGammaTracks; }
   void SetUseGammaTracks(Bool_t setValue=kTRUE) { fUseGammaTracks=setValue; }
+  // cheap kinematic pre-selection of leg combinations, applied before the pair object (and its KF particle) is built.
+  // Pairs rejected here are not seen by the pair CF manager and the cut QA, so the window must be looser than the pair cuts
+  void SetPairPreSelection(Double_t massMin, Double_t massMax, Double_t openingAngleMin=0.)
+    { fUsePairPreSelection=kTRUE; fPreSelMassMin=massMin; fPreSelMassMax=massMax; fPreSelOpeningAngleMin=openingAngleMin; }
+  Bool_t IsUsingPairPreSelection() const { return fUsePairPreSelection; }
   void  FillHistogramsFromPairArray(Bool_t pairInfoOnly=kFALSE);
 
 private:
@@ -256,6 +261,10 @@ private:
   Bool_t fDontClearArrays;      //Don't clear the arrays at the end of the Process function, needed for external use of pair and tracks
   Bool_t fEventProcess;         //Process event (or pair array)
   Bool_t fUseGammaTracks;       // use function SetGammaTracks for MCtruth photons
+  Bool_t fUsePairPreSelection;  // apply the kinematic pre-selection before building pair candidates
+  Double_t fPreSelMassMin;      // pre-selection: minimum pair mass
+  Double_t fPreSelMassMax;      // pre-selection: maximum pair mass
+  Double_t fPreSelOpeningAngleMin; // pre-selection: minimum opening angle
 
   void FillTrackArrays(AliVEvent * const ev, Int_t eventNr=0);
   void EventPlanePreFilter(Int_t arr1, Int_t arr2, TObjArray arrTracks1, TObjArray arrTracks2, const AliVEvent *ev);
@@ -295,7 +304,7 @@ private:
   AliDielectron(const AliDielectron &c);
   AliDielectron &operator=(const AliDielectron &c);
 
-  ClassDef(AliDielectron,17);
+  ClassDef(AliDielectron,18);
 };
 
 inline void AliDielectron::InitPairCandidateArrays()
@@ -198,6 +198,7 @@ void AliDielectronCF::AddVariable(AliDielectronVarManager::ValueTypes type, TVec
   // Add variable with the binning given in the TVectorD
   //
   fUsedVars->SetBitNumber(type,kTRUE);
+  AliDielectronVarManager::AddDependencies(fUsedVars);
   if (!leg){
     if (!fVarBinLimits){
       fVarBinLimits=new TObjArray;
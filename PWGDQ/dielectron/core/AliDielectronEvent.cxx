@@ -32,6 +32,7 @@ Detailed description
 #include <AliVTrack.h>
 #include <AliESDtrack.h>
 #include <AliAODTrack.h>
+#include <AliExternalTrackParam.h>
 
 #include "AliDielectronEvent.h"
 
@@ -46,6 +47,7 @@ AliDielectronEvent::AliDielectronEvent() :
   fNTracksP(0),
   fNTracksN(0),
   fIsAOD(kFALSE),
+  fIsCompact(kFALSE),
   fEventData(),
   fPID(0x0),
   fPIDIndex(0)
@@ -66,6 +68,7 @@ AliDielectronEvent::AliDielectronEvent(const char* name, const char* title) :
   fNTracksP(0),
   fNTracksN(0),
   fIsAOD(kFALSE),
+  fIsCompact(kFALSE),
   fEventData(),
   fPID(0x0),
   fPIDIndex(0)
@@ -109,6 +112,22 @@ void AliDielectronEvent::SetTracks(const TObjArray &arrP, const TObjArray &arrN,
     fArrTrackN.Expand(arrN.GetSize());
   }
 
+  if (fIsCompact){
+    // only the track parametrisation is kept; the objects stay allocated in the
+    // clones arrays between events and are overwritten in place
+    for (Int_t itrack=0; itrack<arrP.GetEntriesFast(); ++itrack){
+      const AliVTrack *track=dynamic_cast<const AliVTrack*>(arrP.At(itrack));
+      if (!track) continue;
+      static_cast<AliExternalTrackParam*>(fArrTrackP.ConstructedAt(fNTracksP++))->CopyFromVTrack(track);
+    }
+    for (Int_t itrack=0; itrack<arrN.GetEntriesFast(); ++itrack){
+      const AliVTrack *track=dynamic_cast<const AliVTrack*>(arrN.At(itrack));
+      if (!track) continue;
+      static_cast<AliExternalTrackParam*>(fArrTrackN.ConstructedAt(fNTracksN++))->CopyFromVTrack(track);
+    }
+    return;
+  }
+
   TExMap mapStoredVertices;
   fPIDIndex=TProcessID::GetPIDs()->IndexOf(fPID);
   // fill particles
@@ -192,6 +211,14 @@ void AliDielectronEvent::Clear(Option_t *opt)
 //   fArrTrackP.Clear(opt);
 //   fArrTrackN.Clear(opt);
 
+  if (fIsCompact){
+    // keep the allocated track parametrisations for reuse
+    fArrTrackP.Clear();
+    fArrTrackN.Clear();
+    fArrPairs.Clear(opt);
+    return;
+  }
+
   for (Int_t i=fArrTrackP.GetEntriesFast()-1; i>=0; --i){
     delete fArrTrackP.RemoveAt(i);
   }
@@ -235,6 +262,19 @@ void AliDielectronEvent::SetESD(Int_t sizeP, Int_t sizeN)
   fIsAOD=kFALSE;
 }
 
+//______________________________________________
+void AliDielectronEvent::SetCompact(Int_t sizeP, Int_t sizeN)
+{
+  //
+  // buffer only the track parametrisation of the legs,
+  // independent of the input (ESD or AOD)
+  //
+  fArrTrackP.SetClass("AliExternalTrackParam",sizeP);
+  fArrTrackN.SetClass("AliExternalTrackParam",sizeN);
+  fIsAOD=kFALSE;
+  fIsCompact=kTRUE;
+}
+
 //______________________________________________
 void AliDielectronEvent::SetEventData(const Double_t data[AliDielectronVarManager::kNMaxValues])
 {
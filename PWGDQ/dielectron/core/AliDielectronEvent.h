@@ -31,7 +31,9 @@ public:
 
   void SetESD(Int_t sizeP=1000, Int_t sizeN=1000);
   void SetAOD(Int_t sizeP=1000, Int_t sizeN=1000);
+  void SetCompact(Int_t sizeP=1000, Int_t sizeN=1000);
   Bool_t IsAOD() const { return fIsAOD; }
+  Bool_t IsCompact() const { return fIsCompact; }
 
   void SetTracks(const TObjArray &arrP, const TObjArray &arrN, const TObjArray &arrPairs);
   void SetEventData(const Double_t data[AliDielectronVarManager::kNMaxValues]);
@@ -61,6 +63,7 @@ private:
   Int_t fNTracksN;              //number of negative tracks
 
   Bool_t fIsAOD;                // if we deal with AODs
+  Bool_t fIsCompact;            // if only the track parametrisation (AliExternalTrackParam) is buffered
 
   Double_t fEventData[AliDielectronVarManager::kNMaxValues]; // event informaion from the var manager
 
@@ -72,7 +75,7 @@ private:
 
   void AssignID(TObject *obj);
   
-  ClassDef(AliDielectronEvent,1)         // Dielectron Event
+  ClassDef(AliDielectronEvent,2)         // Dielectron Event
 };
 
 
@@ -25,6 +25,8 @@ Detailed description
 //                                                                       //
 ///////////////////////////////////////////////////////////////////////////
 
+#include <vector>
+
 #include <TVectorD.h>
 #include <TH1.h>
 #include <TH1F.h>
@@ -35,6 +37,7 @@ Detailed description
 #include <TProfile3D.h>
 #include <THnSparse.h>
 #include <TAxis.h>
+#include <TMath.h>
 #include <TString.h>
 #include <TObjString.h>
 #include <TObjArray.h>
@@ -479,72 +482,121 @@ void AliDielectronHF::Fill(Int_t index, Double_t * const valuesPair, Double_t *
 {
   //
   // main fill function using index and values as input
+  // the bin cells are found per cut variable and combined, instead of
+  // testing the values against every cell of the grid
   //
 
   TObjArray *histArr = static_cast<TObjArray*>(fArrPairType.At(index));
   if(!histArr) return;
 
-  Int_t size  = GetNumberOfBins();
-  // loop over all histograms
-  for(Int_t ihist=0; ihist<size; ihist++) {
-
-    Int_t sizeAdd   = 1;
-    Bool_t selected = kTRUE;
-    
-    // loop over all cut variables
-    Int_t nvars = fAxes.GetEntriesFast();
-    for(Int_t ivar=0; ivar<nvars; ivar++) {
-      
-      // get bin limits
-      TVectorD *bins = static_cast<TVectorD*>(fAxes.At(ivar));
-      Int_t nbins    = bins->GetNrows()-1;
-
-      // bin limits for current ivar bin
-      Int_t ibin   = (ihist/sizeAdd)%nbins;
-      Double_t lowEdge = (*bins)[ibin];
-      Double_t upEdge  = (*bins)[ibin+1];
-      switch(fBinType[ivar]) {
-      case kStdBin:     upEdge=(*bins)[ibin+1];     break;
-      case kBinToMax:   upEdge=(*bins)[nbins];      break;
-      case kBinFromMin: lowEdge=(*bins)[0];         break;
-      case kSymBin:     upEdge=(*bins)[nbins-ibin];
-	if(ibin>=((Double_t)(nbins+1))/2) upEdge=(*bins)[nbins]; // to avoid low>up
-	break;
+  Int_t nvars = fAxes.GetEntriesFast();
+  std::vector<Int_t> selBins[kMaxCuts];   // selected bins of each cut variable
+  Int_t nSel[kMaxCuts]   = {0};
+  Int_t stride[kMaxCuts] = {0};
+  Int_t sizeAdd = 1;
+  for(Int_t ivar=0; ivar<nvars; ivar++) {
+    Int_t nbins = static_cast<TVectorD*>(fAxes.At(ivar))->GetNrows()-1;
+    selBins[ivar].resize(nbins);
+
+    // leg variable: both legs have to be inside the bin
+    if(fVarCutType->TestBitNumber(ivar)) {
+      std::vector<Int_t> selLeg2(nbins);
+      Int_t n1 = FindSelectedBins(ivar, valuesLeg1, &selBins[ivar][0]);
+      Int_t n2 = FindSelectedBins(ivar, valuesLeg2, &selLeg2[0]);
+      Int_t n  = 0;
+      for(Int_t i1=0, i2=0; i1<n1 && i2<n2; ) {
+        if(selBins[ivar][i1]<selLeg2[i2]) ++i1;
+        else if(selBins[ivar][i1]>selLeg2[i2]) ++i2;
+        else { selBins[ivar][n++]=selBins[ivar][i1]; ++i1; ++i2; }
       }
+      nSel[ivar] = n;
+    }
+    else { // pair and event variables
+      nSel[ivar] = FindSelectedBins(ivar, valuesPair, &selBins[ivar][0]);
+    }
 
-      // leg variable
-      if(fVarCutType->TestBitNumber(ivar)) {
-	if( (valuesLeg1[fVarCuts[ivar]] < lowEdge || valuesLeg1[fVarCuts[ivar]] >= upEdge) ||
-	    (valuesLeg2[fVarCuts[ivar]] < lowEdge || valuesLeg2[fVarCuts[ivar]] >= upEdge) ) {
-	  selected=kFALSE;
-	  break;
-	}
-      }
-      else { // pair and event variables
-	if( (valuesPair[fVarCuts[ivar]] < lowEdge || valuesPair[fVarCuts[ivar]] >= upEdge) ) {
-	  selected=kFALSE;
-	  break;
-	}
-      }
+    // no bin cell selected
+    if(!nSel[ivar]) return;
 
-      sizeAdd*=nbins;
-    } //end of var cut loop
+    stride[ivar] = sizeAdd;
+    sizeAdd*=nbins;
+  } //end of var cut loop
 
-    // do not fill the histogram
-    if(!selected) continue;
+  // loop over all combinations of the selected bins
+  Int_t pos[kMaxCuts] = {0};
+  while(kTRUE) {
+    Int_t ihist=0;
+    for(Int_t ivar=0; ivar<nvars; ivar++) ihist += selBins[ivar][pos[ivar]]*stride[ivar];
 
     // fill the object with Pair and event values
     TObjArray *tmp = (TObjArray*) histArr->At(ihist);
-    TString title = tmp->GetName();
-    AliDebug(10,title.Data());
+    AliDebug(10,tmp->GetName());
     for(Int_t i=0; i<tmp->GetEntriesFast(); i++) {
       AliDielectronHistos::FillValues(tmp->At(i), valuesPair);
     }
     //    AliDebug(10,Form("Fill var %d %s value %f in %s \n",fVar,AliDielectronVarManager::GetValueName(fVar),valuesPair[fVar],tmp->GetName()));
+
+    // next combination, the first variable runs fastest
+    Int_t ivar=0;
+    for(; ivar<nvars; ivar++) {
+      if(++pos[ivar]<nSel[ivar]) break;
+      pos[ivar]=0;
+    }
+    if(ivar==nvars) break;
   } //end of hist loop
 
 }
 
+//______________________________________________
+void AliDielectronHF::GetBinEdges(Int_t ivar, Int_t ibin, Double_t &lowEdge, Double_t &upEdge) const
+{
+  //
+  // lower and upper limit of bin ibin of the cut variable ivar, according to its binning type
+  //
+  const TVectorD &bins = *static_cast<TVectorD*>(fAxes.At(ivar));
+  Int_t nbins = bins.GetNrows()-1;
+
+  lowEdge = bins[ibin];
+  upEdge  = bins[ibin+1];
+  switch(fBinType[ivar]) {
+  case kStdBin:     upEdge=bins[ibin+1];     break;
+  case kBinToMax:   upEdge=bins[nbins];      break;
+  case kBinFromMin: lowEdge=bins[0];         break;
+  case kSymBin:     upEdge=bins[nbins-ibin];
+    if(ibin>=((Double_t)(nbins+1))/2) upEdge=bins[nbins]; // to avoid low>up
+    break;
+  }
+}
+
+//______________________________________________
+Int_t AliDielectronHF::FindSelectedBins(Int_t ivar, Double_t * const values, Int_t *selBins) const
+{
+  //
+  // store in selBins the bins of the cut variable ivar which contain the value,
+  // in increasing order, and return their number
+  //
+  const TVectorD &bins = *static_cast<TVectorD*>(fAxes.At(ivar));
+  Int_t nbins = bins.GetNrows()-1;
+  Double_t value = values[fVarCuts[ivar]];
+
+  // standard binning: at most one bin, binary search
+  // (a NaN is never rejected by the limits and goes through the generic loop)
+  if(fBinType[ivar]==kStdBin && !TMath::IsNaN(value)) {
+    if(value<bins[0] || value>=bins[nbins]) return 0;
+    selBins[0] = TMath::BinarySearch(nbins+1, bins.GetMatrixArray(), value);
+    return 1;
+  }
+
+  Int_t n=0;
+  for(Int_t ibin=0; ibin<nbins; ibin++) {
+    Double_t lowEdge=0., upEdge=0.;
+    GetBinEdges(ivar, ibin, lowEdge, upEdge);
+    if(value < lowEdge || value >= upEdge) continue;
+    selBins[n++] = ibin;
+  }
+  return n;
+}
+
 //______________________________________________
 void AliDielectronHF::Init()
 {
@@ -596,16 +648,8 @@ void AliDielectronHF::Init()
 
       // get the lower limit for current ivar bin
       Int_t ibin   = (ihist/sizeAdd)%nbins; 
-      Double_t lowEdge = (*bins)[ibin];
-      Double_t upEdge  = (*bins)[ibin+1];
-      switch(fBinType[ivar]) {
-      case kStdBin:     upEdge=(*bins)[ibin+1];     break;
-      case kBinToMax:   upEdge=(*bins)[nbins];      break;
-      case kBinFromMin: lowEdge=(*bins)[0];         break;
-      case kSymBin:     upEdge=(*bins)[nbins-ibin];
-	if(ibin>=((Double_t)(nbins+1))/2) upEdge=(*bins)[nbins]; // to avoid low>up
-	break;
-      }
+      Double_t lowEdge = 0., upEdge = 0.;
+      GetBinEdges(ivar, ibin, lowEdge, upEdge);
 
       TObjArray *tmp= (TObjArray*) histArr->At(ihist);
       TString title = tmp->GetName();
@@ -121,6 +121,9 @@ private:
   Bool_t    fEventArray;            // switch OFF pair types and ON event array
   TObjArray fRefObj;               // reference object
 
+  void GetBinEdges(Int_t ivar, Int_t ibin, Double_t &lowEdge, Double_t &upEdge) const;
+  Int_t FindSelectedBins(Int_t ivar, Double_t * const values, Int_t *selBins) const;
+
   AliDielectronHF(const AliDielectronHF &c);
   AliDielectronHF &operator=(const AliDielectronHF &c);
 
@@ -31,6 +31,7 @@ Detailed description
 
 #include <AliLog.h>
 #include <AliVTrack.h>
+#include <AliExternalTrackParam.h>
 
 #include "AliDielectron.h"
 #include "AliDielectronHelper.h"
@@ -50,6 +51,7 @@ AliDielectronMixingHandler::AliDielectronMixingHandler() :
   fMixIncomplete(kTRUE),
   fMoveToSameVertex(kFALSE),
   fSkipFirstEvt(kFALSE),
+  fCompactPools(kFALSE),
   fPID(0x0)
 {
   //
@@ -71,6 +73,7 @@ AliDielectronMixingHandler::AliDielectronMixingHandler(const char* name, const c
   fMixIncomplete(kTRUE),
   fMoveToSameVertex(kFALSE),
   fSkipFirstEvt(kFALSE),
+  fCompactPools(kFALSE),
   fPID(0x0)
 {
   //
@@ -198,7 +201,9 @@ void AliDielectronMixingHandler::Fill(const AliVEvent *ev, AliDielectron *diele)
     AliDebug(10,Form("new event at %d: %d",bin,index1));
      //printf("new event at %d: %d\n",bin,index1);
     event = new(pool[index1]) AliDielectronEvent();
-    if(ev->IsA() == AliAODEvent::Class()) {
+    if(fCompactPools) {
+      event->SetCompact(diele->GetTrackArray(0)->GetEntriesFast(),diele->GetTrackArray(1)->GetEntriesFast());
+    } else if(ev->IsA() == AliAODEvent::Class()) {
       event->SetAOD(diele->GetTrackArray(0)->GetEntriesFast(),diele->GetTrackArray(1)->GetEntriesFast());
     } else {
         event->SetESD(diele->GetTrackArray(0)->GetEntriesFast(),diele->GetTrackArray(1)->GetEntriesFast());
@@ -499,8 +504,9 @@ void AliDielectronMixingHandler::MoveToSameVertex(AliVTrack * const vtrack, cons
 
   static Bool_t printed=kFALSE;
   
-  if (vtrack->IsA()==AliESDtrack::Class()){
-    AliESDtrack *track=(AliESDtrack*)vtrack;
+  // ESD tracks and the compact pool tracks share the AliExternalTrackParam parametrisation
+  if (vtrack->InheritsFrom(AliExternalTrackParam::Class())){
+    AliExternalTrackParam *track=(AliExternalTrackParam*)vtrack;
 
     //get track information
     Double_t x        = track->GetX();
@@ -55,6 +55,10 @@ public:
 
   void SetSkipFirstEvent(Bool_t skip) { fSkipFirstEvt=skip; }
 
+  // store only the track parametrisation (AliExternalTrackParam) of the legs in the pools
+  void SetCompactPools(Bool_t compact=kTRUE) { fCompactPools=compact; }
+  Bool_t GetCompactPools() const { return fCompactPools; }
+
   Int_t GetNumberOfBins() const;
   Int_t FindBin(const Double_t values[], TString *dim=0x0);
   void Fill(const AliVEvent *ev, AliDielectron *diele);
@@ -76,6 +80,7 @@ private:
   Bool_t fMixIncomplete;  // whether to mix uncomplete bins at the end of the processing
   Bool_t fMoveToSameVertex; //whether to move the mixed tracks to the same vertex position
   Bool_t fSkipFirstEvt;   //whether to skip the first event in the pool
+  Bool_t fCompactPools;   //whether to buffer only the track parametrisation instead of full track copies
 
   TProcessID *fPID;             //! internal PID for references to buffered objects
   
@@ -85,7 +90,7 @@ private:
   AliDielectronMixingHandler &operator=(const AliDielectronMixingHandler &c);
 
   
-  ClassDef(AliDielectronMixingHandler,1)         // Dielectron MixingHandler
+  ClassDef(AliDielectronMixingHandler,2)         // Dielectron MixingHandler
 };
 
 
@@ -44,6 +44,11 @@ AliDielectronTrackRotator::AliDielectronTrackRotator() :
   fStartAnglePhi(TMath::Pi()),
   fConeAnglePhi(TMath::Pi()/6.),
   fKeepLocalY(kFALSE),
+  fPreselect(kFALSE),
+  fPreMassMin(0.),
+  fPreMassMax(1e30),
+  fPrePtMin(0.),
+  fPrePtMax(1e30),
   fkArrTracksP(0x0),
   fkArrTracksN(0x0),
   fCurrentIteration(0),
@@ -52,6 +57,10 @@ AliDielectronTrackRotator::AliDielectronTrackRotator() :
   fEvent(0x0),
   fTrackP(),
   fTrackN(),
+  fCachedTackP(-1),
+  fCachedTackN(-1),
+  fCachedTrackP(),
+  fCachedTrackN(),
   fVTrackP(0x0),
   fVTrackN(0x0),
   fPdgLeg1(-11),
@@ -72,6 +81,11 @@ AliDielectronTrackRotator::AliDielectronTrackRotator(const char* name, const cha
   fStartAnglePhi(TMath::Pi()),
   fConeAnglePhi(TMath::Pi()/6.),
   fKeepLocalY(kFALSE),
+  fPreselect(kFALSE),
+  fPreMassMin(0.),
+  fPreMassMax(1e30),
+  fPrePtMin(0.),
+  fPrePtMax(1e30),
   fkArrTracksP(0x0),
   fkArrTracksN(0x0),
   fCurrentIteration(0),
@@ -80,6 +94,10 @@ AliDielectronTrackRotator::AliDielectronTrackRotator(const char* name, const cha
   fEvent(0x0),
   fTrackP(),
   fTrackN(),
+  fCachedTackP(-1),
+  fCachedTackN(-1),
+  fCachedTrackP(),
+  fCachedTrackN(),
   fVTrackP(0x0),
   fVTrackN(0x0),
   fPdgLeg1(-11),
@@ -110,6 +128,8 @@ void AliDielectronTrackRotator::Reset()
   fCurrentIteration=0;
   fCurrentTackP=0;
   fCurrentTackN=0;
+  fCachedTackP=-1;
+  fCachedTackN=-1;
 }
 
 //______________________________________________
@@ -170,13 +190,25 @@ Bool_t AliDielectronTrackRotator::RotateTracks()
   }
   fSameTracks = kFALSE;
 
-  fTrackP.Initialize();
-  fTrackN.Initialize();
   fVTrackP=0x0;
   fVTrackN=0x0;
   if (!trackP||!trackN) return kFALSE;
-  fTrackP+=AliKFParticle(*trackP,fPdgLeg1);
-  fTrackN+=AliKFParticle(*trackN,fPdgLeg2);
+
+  // the unrotated KF particles only depend on the track, build them once
+  // per positive track (all iterations) and per negative track (all
+  // positive tracks) instead of once per rotation
+  if (fCachedTackP!=fCurrentTackP){
+    fCachedTrackP.Initialize();
+    fCachedTrackP+=AliKFParticle(*trackP,fPdgLeg1);
+    fCachedTackP=fCurrentTackP;
+  }
+  if (fCachedTackN!=fCurrentTackN){
+    fCachedTrackN.Initialize();
+    fCachedTrackN+=AliKFParticle(*trackN,fPdgLeg2);
+    fCachedTackN=fCurrentTackN;
+  }
+  fTrackP=fCachedTrackP;
+  fTrackN=fCachedTrackN;
 
   fVTrackP=trackP;
   fVTrackN=trackN;
@@ -197,3 +229,25 @@ Bool_t AliDielectronTrackRotator::RotateTracks()
 
   return kTRUE;
 }
+
+//______________________________________________
+Bool_t AliDielectronTrackRotator::PassesPairPreselection() const
+{
+  //
+  // Check the mass and pt of the current rotated pair, computed from the
+  // momenta of the rotated legs, against the preselection window.
+  // Always true if no preselection is set.
+  //
+  if (!fPreselect) return kTRUE;
+
+  const Double_t px=fTrackP.GetPx()+fTrackN.GetPx();
+  const Double_t py=fTrackP.GetPy()+fTrackN.GetPy();
+  const Double_t pt2=px*px+py*py;
+  if (pt2<fPrePtMin*fPrePtMin || pt2>fPrePtMax*fPrePtMax) return kFALSE;
+
+  const Double_t pz=fTrackP.GetPz()+fTrackN.GetPz();
+  const Double_t e=fTrackP.GetE()+fTrackN.GetE();
+  const Double_t m2=e*e-pt2-pz*pz;
+  const Double_t m=m2>0 ? TMath::Sqrt(m2) : 0.;
+  return m>=fPreMassMin && m<=fPreMassMax;
+}
@@ -36,7 +36,7 @@ public:
 
   virtual ~AliDielectronTrackRotator();
 
-  void SetTrackArrays(const TObjArray * const arrP, const TObjArray * const arrN) {fkArrTracksP=arrP;fkArrTracksN=arrN;}
+  void SetTrackArrays(const TObjArray * const arrP, const TObjArray * const arrN) {fkArrTracksP=arrP;fkArrTracksN=arrN;fCachedTackP=-1;fCachedTackN=-1;}
   void Reset();
   Bool_t NextCombination();
 
@@ -46,6 +46,8 @@ public:
   void SetStartAnglePhi(Double_t phi)      { fStartAnglePhi=phi; }
   void SetConeAnglePhi(Double_t phi)       { fConeAnglePhi=phi;  }
   void SetKeepLocalY(Bool_t keep)          { fKeepLocalY=keep;  }
+  void SetPairPreselection(Double_t massMin, Double_t massMax, Double_t ptMin=0., Double_t ptMax=1e30)
+    { fPreselect=kTRUE; fPreMassMin=massMin; fPreMassMax=massMax; fPrePtMin=ptMin; fPrePtMax=ptMax; }
 
   //Getters
   Int_t GetIterations() const           { return fIterations;    }
@@ -53,6 +55,7 @@ public:
   Double_t GetStartAnglePhi() const     { return fStartAnglePhi; }
   Double_t GetConeAnglePhi() const      { return fConeAnglePhi;  }
   Bool_t GetKeepLocalY() const          { return fKeepLocalY;  }
+  Bool_t GetPairPreselection() const    { return fPreselect;  }
 
   void SetEvent(AliVEvent * const ev)   { fEvent = ev;           }
   void SetPdgLegs(Int_t pdfLeg1, Int_t pdfLeg2) { fPdgLeg1=pdfLeg1; fPdgLeg2=pdfLeg2; }
@@ -63,6 +66,7 @@ public:
   AliVTrack* GetVTrackP() const {return fVTrackP;}
   AliVTrack* GetVTrackN() const {return fVTrackN;}
   Bool_t SameTracks() const {return fSameTracks;}
+  Bool_t PassesPairPreselection() const;
   
 private:
   UInt_t   fIterations;             // number of iterations
@@ -73,6 +77,12 @@ private:
   Double_t fConeAnglePhi;           // opening angle in phi for multiple rotation
   Bool_t fKeepLocalY;               // rotate on such an angle that the position wrt TPC chamber borders stays the same
 
+  Bool_t   fPreselect;              // reject rotated pairs outside the mass and pt window before the pair is built
+  Double_t fPreMassMin;             // preselection: minimum pair mass
+  Double_t fPreMassMax;             // preselection: maximum pair mass
+  Double_t fPrePtMin;               // preselection: minimum pair pt
+  Double_t fPrePtMax;               // preselection: maximum pair pt
+
   const TObjArray *fkArrTracksP;    //! array of positive tracks
   const TObjArray *fkArrTracksN;    //! array of negative tracks
 
@@ -84,6 +94,11 @@ private:
   
   AliKFParticle fTrackP;            //! Positive track
   AliKFParticle fTrackN;            //! Negative track
+
+  Int_t    fCachedTackP;            //! positive track of fCachedTrackP, -1 if none
+  Int_t    fCachedTackN;            //! negative track of fCachedTrackN, -1 if none
+  AliKFParticle fCachedTrackP;      //! unrotated positive track, reused for all iterations
+  AliKFParticle fCachedTrackN;      //! unrotated negative track, reused for all positive tracks
   
   AliVTrack *fVTrackP;              //! Positive track
   AliVTrack *fVTrackN;              //! Negative track
@@ -98,7 +113,7 @@ private:
   AliDielectronTrackRotator &operator=(const AliDielectronTrackRotator &c);
 
   
-  ClassDef(AliDielectronTrackRotator,2)         // Dielectron TrackRotator
+  ClassDef(AliDielectronTrackRotator,3)         // Dielectron TrackRotator
 };
 
 
@@ -200,6 +200,7 @@ void AliDielectronVarCuts::AddCut(AliDielectronVarManager::ValueTypes type, Doub
   SETBIT(fActiveCutsMask,fNActiveCuts);
   fActiveCuts[fNActiveCuts]=(UShort_t)type;
   fUsedVars->SetBitNumber(type,kTRUE);
+  AliDielectronVarManager::AddDependencies(fUsedVars);
   ++fNActiveCuts;
 }
 
@@ -215,6 +216,7 @@ void AliDielectronVarCuts::AddBitCut(AliDielectronVarManager::ValueTypes type, U
   SETBIT(fActiveCutsMask,fNActiveCuts);
   fActiveCuts[fNActiveCuts]=(UShort_t)type;
   fUsedVars->SetBitNumber(type,kTRUE);
+  AliDielectronVarManager::AddDependencies(fUsedVars);
   ++fNActiveCuts;
 }
 
@@ -237,6 +239,7 @@ void AliDielectronVarCuts::AddCut(AliDielectronVarManager::ValueTypes type, Doub
     TString var(fUpperCut[fNActiveCuts]->GetAxis(idim)->GetName());
     fUsedVars->SetBitNumber(AliDielectronVarManager::GetValueType(var.Data()), kTRUE);
   }
+  AliDielectronVarManager::AddDependencies(fUsedVars);
   ++fNActiveCuts;
 }
 
@@ -258,6 +261,7 @@ void AliDielectronVarCuts::AddCut(AliDielectronVarManager::ValueTypes typeA, Ali
   fActiveCuts[fNActiveCuts]=(UShort_t)typeA;
   fUsedVars->SetBitNumber(typeA,kTRUE);
   fUsedVars->SetBitNumber(typeB,kTRUE);
+  AliDielectronVarManager::AddDependencies(fUsedVars);
 
   fVarOperation[fNActiveCuts] = operation;
   ++fNActiveCuts;
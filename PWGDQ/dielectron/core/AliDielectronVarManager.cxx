@@ -721,3 +721,47 @@ UInt_t AliDielectronVarManager::GetValueType(const char* valname) {
   }
   return -1;
 }
+
+//________________________________________________________________
+void AliDielectronVarManager::AddDependencies(TBits *map) {
+  //
+  // Add the input variables of all requested derived variables to the map,
+  // such that a consumer requesting e.g. only kOpeningAngleCorr also gets the
+  // pair DCA it is computed from. Repeated until the map no longer changes,
+  // so chains (kOneOverPairEff -> kPairEff -> kLegEff) are resolved as well.
+  // Each row: derived variable, followed by its inputs, padded with -1
+  //
+  static const Int_t kNInputs=3;
+  static const Int_t dependencies[][kNInputs+1] = {
+    { kNFclsTPCfCross,             kNFclsTPC,                   kNFclsTPCr,           -1         },
+    { kTRDpidEffLeg,               kEta,                        kTRDphi,              kPOut      },
+    { kOneOverLegEff,              kLegEff,                     -1,                   -1         },
+    { kOpeningAngleCorr,           kOpeningAngle,               kPairDCAabsXY,        kOneOverPt },
+    { kMCorr,                      kM,                          kPairDCAabsXY,        kPt        },
+    { kPseudoProperTimeResolution, kPseudoProperTime,           -1,                   -1         },
+    { kPseudoProperTimePull,       kPseudoProperTimeResolution, kPseudoProperTimeErr, -1         },
+    { kTRDpidEffPair,              kTRDpidEffLeg,               -1,                   -1         },
+    { kPairEff,                    kLegEff,                     -1,                   -1         },
+    { kOneOverPairEff,             kPairEff,                    -1,                   -1         },
+    { kOneOverPairEffSq,           kPairEff,                    -1,                   -1         },
+    { kQnTPCrpH2FlowV2,            kQnDeltaPhiTPCrpH2,          -1,                   -1         },
+    { kQnV0ArpH2FlowV2,            kQnDeltaPhiV0ArpH2,          -1,                   -1         },
+    { kQnV0CrpH2FlowV2,            kQnDeltaPhiV0CrpH2,          -1,                   -1         },
+    { kQnSPDrpH2FlowV2,            kQnDeltaPhiSPDrpH2,          -1,                   -1         }
+  };
+  static const Int_t nDependencies=sizeof(dependencies)/sizeof(dependencies[0]);
+
+  if (!map) return;
+  Bool_t changed=kTRUE;
+  while (changed) {
+    changed=kFALSE;
+    for (Int_t i=0; i<nDependencies; ++i) {
+      if (!map->TestBitNumber(dependencies[i][0])) continue;
+      for (Int_t j=1; j<=kNInputs && dependencies[i][j]>=0; ++j) {
+        if (map->TestBitNumber(dependencies[i][j])) continue;
+        map->SetBitNumber(dependencies[i][j],kTRUE);
+        changed=kTRUE;
+      }
+    }
+  }
+}
@@ -663,6 +663,7 @@ public:
   static void SetLegEffMap( TObject *map) { fgLegEffMap=map; }
   static void SetPairEffMap(TObject *map) { fgPairEffMap=map; }
   static void SetFillMap(   TBits   *map) { fgFillMap=map; }
+  static void AddDependencies(TBits *map);
   static void SetVZEROCalibrationFile(const Char_t* filename) {fgVZEROCalibrationFile = filename;}
 
   static void SetVZERORecenteringFile(const Char_t* filename) {fgVZERORecenteringFile = filename;}
@@ -764,6 +765,7 @@ inline void AliDielectronVarManager::Fill(const TObject* object, Double_t * cons
   else if (object->IsA() == AliAODMCParticle::Class())  FillVarAODMCParticle(static_cast<const AliAODMCParticle*>(object), values);
   else if (object->IsA() == AliDielectronPair::Class()) FillVarDielectronPair(static_cast<const AliDielectronPair*>(object), values);
   else if (object->IsA() == AliKFParticle::Class())     FillVarKFParticle(static_cast<const AliKFParticle*>(object),values);
+  else if (object->IsA() == AliExternalTrackParam::Class()) FillVarVParticle(static_cast<const AliExternalTrackParam*>(object), values); // compact mixing pool legs
   // Main function to fill all available variables according to the type of event
 
   else if (object->IsA() == AliVEvent::Class())         FillVarVEvent(static_cast<const AliVEvent*>(object), values);
@@ -2098,8 +2100,11 @@ inline void AliDielectronVarManager::FillVarDielectronPair(const AliDielectronPa
 
   if (mc->HasMC()){
     values[AliDielectronVarManager::kPseudoProperTimeResolution] = -10.0e+10;
-    Bool_t samemother =  mc->HaveSameMother(pair);
-    values[AliDielectronVarManager::kIsJpsiPrimary] = mc->IsJpsiPrimary(pair);
+    // MC mother lookups are expensive, only do them if one of their results is requested
+    Bool_t samemother = kFALSE;
+    if(Req(kHaveSameMother) || Req(kHasCocktailMother) || Req(kPseudoProperTimeResolution) || Req(kPseudoProperTimePull))
+      samemother = mc->HaveSameMother(pair);
+    if(Req(kIsJpsiPrimary)) values[AliDielectronVarManager::kIsJpsiPrimary] = mc->IsJpsiPrimary(pair);
     values[AliDielectronVarManager::kHaveSameMother] = samemother ;
 
     // fill kPseudoProperTimeResolution
@@ -2125,7 +2130,7 @@ inline void AliDielectronVarManager::FillVarDielectronPair(const AliDielectronPa
     }
 
 	values[AliDielectronVarManager::kTRDpidEffPair] = 0.;
-	if (fgTRDpidEff[0][0]){
+	if (fgTRDpidEff[0][0] && Req(kTRDpidEffPair)){
 	  Double_t valuesLeg1[AliDielectronVarManager::kNMaxValues];
 	  Double_t valuesLeg2[AliDielectronVarManager::kNMaxValues];
 	  AliVParticle* leg1 = pair->GetFirstDaughterP();
@@ -2156,15 +2161,17 @@ inline void AliDielectronVarManager::FillVarDielectronPair(const AliDielectronPa
   values[AliDielectronVarManager::kPairEff]=0.0;
   values[AliDielectronVarManager::kOneOverPairEff]=0.0;
   values[AliDielectronVarManager::kOneOverPairEffSq]=0.0;
-  if (leg1 && leg2 && fgLegEffMap) {
+  // refilling both legs is only worth it if the pair efficiency is actually used
+  const Bool_t reqPairEff = Req(kPairEff) || Req(kOneOverPairEff) || Req(kOneOverPairEffSq);
+  if (reqPairEff && leg1 && leg2 && fgLegEffMap) {
     Fill(leg1, valuesLeg1);
     Fill(leg2, valuesLeg2);
     values[AliDielectronVarManager::kPairEff] = valuesLeg1[AliDielectronVarManager::kLegEff] *valuesLeg2[AliDielectronVarManager::kLegEff];
   }
-  else if(fgPairEffMap) {
+  else if(reqPairEff && fgPairEffMap) {
     values[AliDielectronVarManager::kPairEff] = GetPairEff(values);
   }
-  if(fgLegEffMap || fgPairEffMap) {
+  if(reqPairEff && (fgLegEffMap || fgPairEffMap)) {
     values[AliDielectronVarManager::kOneOverPairEff] = (values[AliDielectronVarManager::kPairEff]>0.0 ? 1./values[AliDielectronVarManager::kPairEff] : 1.0);
     values[AliDielectronVarManager::kOneOverPairEffSq] = (values[AliDielectronVarManager::kPairEff]>0.0 ? 1./values[AliDielectronVarManager::kPairEff]/values[AliDielectronVarManager::kPairEff] : 1.0);
   }
@@ -48,7 +48,15 @@ AliHistogramManager::AliHistogramManager() :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(0)
+  fNVars(0),
+  fPlanHist(),
+  fPlanType(),
+  fPlanVarW(),
+  fPlanVarFirst(),
+  fPlanVars(),
+  fPlanClassFirst(),
+  fPlanClassSize(),
+  fPlanClassList()
 {
   //
   // Constructor
@@ -70,7 +78,15 @@ AliHistogramManager::AliHistogramManager(const Char_t* name, Int_t nvars) :
   fBinsAllocated(0),
   fVariableNames(),
   fVariableUnits(),
-  fNVars(nvars)
+  fNVars(nvars),
+  fPlanHist(),
+  fPlanType(),
+  fPlanVarW(),
+  fPlanVarFirst(),
+  fPlanVars(),
+  fPlanClassFirst(),
+  fPlanClassSize(),
+  fPlanClassList()
 {
   //
   // Constructor
@@ -609,131 +625,155 @@ void AliHistogramManager::FillHistClass(const Char_t* className, Float_t* values
     cout << "         Histogram list not filled" << endl; */
     return;
   }
-  if(!hList) {
-    return;
+  // the list unique ID holds the class id + 1 once the fill plan has been built
+  if(!hList->GetUniqueID()) BuildFillPlan();
+  FillHistClass(Int_t(hList->GetUniqueID())-1, values);
+}
+
+//__________________________________________________________________
+Int_t AliHistogramManager::GetHistClassId(const Char_t* className) {
+  //
+  //  return the integer id of a histogram class, -1 if it does not exist
+  //
+  THashList* hList = (THashList*)fMainList.FindObject(className);
+  if(!hList) return -1;
+  if(!hList->GetUniqueID() || Int_t(hList->GetUniqueID())>Int_t(fPlanClassList.size())) BuildFillPlan();
+  return Int_t(hList->GetUniqueID())-1;
+}
+
+//__________________________________________________________________
+void AliHistogramManager::FillHistClass(Int_t classId, Float_t* values) {
+  //
+  //  fill a class of histograms using the precompiled fill plan
+  //
+  if(classId<0) return;
+  if(classId>=Int_t(fPlanClassList.size()) || fPlanClassSize[classId]!=fPlanClassList[classId]->GetEntries()) {
+    BuildFillPlan();
+    if(classId>=Int_t(fPlanClassList.size())) return;
   }
-    
-  TIter next(hList);
-  TObject* h=0x0;
-  Bool_t isProfile;
-  Bool_t isTHn;
-  Int_t thnDim=0;
+  
   Double_t fillValues[20]={0.0};
-  Int_t uid = 0;
-  Int_t varX=-1, varY=-1, varZ=-1, varT=-1, varW=-1;
-  Int_t dimension=0;
-  while((h=next())) {
-    Bool_t allVarsGood = kTRUE;
-    uid = h->GetUniqueID();
-    isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
-    isTHn = ((uid%100)>10 ? kTRUE : kFALSE);      
-    if(isTHn) thnDim = (uid%100)-10;        // the excess over 10 from the last 2 digits give the dimension of the THn
-    dimension = 0;
-    if(!isTHn) dimension = ((TH1*)h)->GetDimension();
-        
-    uid = (uid-(uid%100))/100;
-    varX = -1;
-    varY = -1;
-    varZ = -1;
-    varT = -1;
-    varW = -1;
-    if(uid>0) {
-      varW = uid%(fNVars+1)-1;
-      if(varW==0) varW=AliReducedVarManager::kNothing;
-      uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
-      if(uid>0) varT = uid - 1;
-      //cout << "Filling " << h->GetName() << " with varT " << varT << endl;
+  for(Int_t ie=fPlanClassFirst[classId]; ie<fPlanClassFirst[classId+1]; ++ie) {
+    TObject* h = fPlanHist[ie];
+    const Int_t* vars = &fPlanVars[fPlanVarFirst[ie]];
+    const Int_t varW = fPlanVarW[ie];
+    const Bool_t hasW = (varW>AliReducedVarManager::kNothing);
+    switch(fPlanType[ie]) {
+      case kPlanTH1:
+        if(hasW) ((TH1F*)h)->Fill(values[vars[0]],values[varW]);
+        else ((TH1F*)h)->Fill(values[vars[0]]);
+        break;
+      case kPlanTProfile:
+        if(hasW) ((TProfile*)h)->Fill(values[vars[0]],values[vars[1]],values[varW]);
+        else ((TProfile*)h)->Fill(values[vars[0]],values[vars[1]]);
+        break;
+      case kPlanTH2:
+        if(hasW) ((TH2F*)h)->Fill(values[vars[0]],values[vars[1]],values[varW]);
+        else ((TH2F*)h)->Fill(values[vars[0]],values[vars[1]]);
+        break;
+      case kPlanTProfile2D:
+        if(hasW) ((TProfile2D*)h)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[varW]);
+        else ((TProfile2D*)h)->Fill(values[vars[0]],values[vars[1]],values[vars[2]]);
+        break;
+      case kPlanTH3:
+        if(hasW) ((TH3F*)h)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[varW]);
+        else ((TH3F*)h)->Fill(values[vars[0]],values[vars[1]],values[vars[2]]);
+        break;
+      case kPlanTProfile3D:
+        if(hasW) ((TProfile3D*)h)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[vars[3]],values[varW]);
+        else ((TProfile3D*)h)->Fill(values[vars[0]],values[vars[1]],values[vars[2]],values[vars[3]]);
+        break;
+      case kPlanTHn:
+        for(Int_t idim=0; idim<fPlanVarFirst[ie+1]-fPlanVarFirst[ie]; ++idim) fillValues[idim] = values[vars[idim]];
+        if(hasW) ((THnF*)h)->Fill(fillValues,values[varW]);
+        else ((THnF*)h)->Fill(fillValues);
+        break;
+      default:
+        break;
     }
-        
-    if(!isTHn) {
-      varX = ((TH1*)h)->GetXaxis()->GetUniqueID();
-      if(fUsedVars[varX]) {
-        switch(dimension) {
+  }
+}
+
+//__________________________________________________________________
+void AliHistogramManager::BuildFillPlan() {
+  //
+  //  decode the histogram type and variables of all histograms once, such that
+  //  the fill loop only reads flat arrays; histograms which would not be filled
+  //  because of unused variables are left out of the plan
+  //
+  fPlanHist.clear(); fPlanType.clear(); fPlanVarW.clear(); fPlanVarFirst.clear(); fPlanVars.clear();
+  fPlanClassFirst.clear(); fPlanClassSize.clear(); fPlanClassList.clear();
+  
+  TIter nextClass(&fMainList);
+  THashList* hList=0x0;
+  std::vector<Int_t> vars;
+  while((hList=(THashList*)nextClass())) {
+    fPlanClassList.push_back(hList);
+    hList->SetUniqueID(fPlanClassList.size());
+    fPlanClassFirst.push_back(fPlanHist.size());
+    fPlanClassSize.push_back(hList->GetEntries());
+    
+    TIter next(hList);
+    TObject* h=0x0;
+    while((h=next())) {
+      Int_t uid = h->GetUniqueID();
+      Bool_t isProfile = (uid%10==1 ? kTRUE : kFALSE);   // units digit encodes the isProfile
+      Bool_t isTHn = ((uid%100)>10 ? kTRUE : kFALSE);
+      Int_t thnDim = (isTHn ? (uid%100)-10 : 0);       // the excess over 10 from the last 2 digits give the dimension of the THn
+      uid = (uid-(uid%100))/100;
+      Int_t varT = -1, varW = -1;
+      if(uid>0) {
+        varW = uid%(fNVars+1)-1;
+        if(varW==0) varW=AliReducedVarManager::kNothing;
+        uid = (uid-(uid%(fNVars+1)))/(fNVars+1);
+        if(uid>0) varT = uid - 1;
+      }
+      
+      Int_t type = kPlanTHn;
+      vars.clear();
+      if(!isTHn) {
+        TH1* h1 = (TH1*)h;
+        vars.push_back(h1->GetXaxis()->GetUniqueID());
+        switch(h1->GetDimension()) {
           case 1:
-            if(isProfile) {
-              varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-              if(!fUsedVars[varY]) break;
-              if(varW>AliReducedVarManager::kNothing) { 
-                if(!fUsedVars[varW]) break;
-                ((TProfile*)h)->Fill(values[varX],values[varY],values[varW]);
-              }
-              else 
-                ((TProfile*)h)->Fill(values[varX],values[varY]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH1F*)h)->Fill(values[varX],values[varW]);
-              }
-              else
-                ((TH1F*)h)->Fill(values[varX]);
-            }
-          break;
+            type = (isProfile ? kPlanTProfile : kPlanTH1);
+            if(isProfile) vars.push_back(h1->GetYaxis()->GetUniqueID());
+            break;
           case 2:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
-            if(isProfile) {
-              varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-              if(!fUsedVars[varZ]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TProfile2D*)h)->Fill(values[varX],values[varY],values[varZ]);        
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH2F*)h)->Fill(values[varX],values[varY], values[varW]);
-              }
-              else
-                ((TH2F*)h)->Fill(values[varX],values[varY]);
-            }
-          break;
+            type = (isProfile ? kPlanTProfile2D : kPlanTH2);
+            vars.push_back(h1->GetYaxis()->GetUniqueID());
+            if(isProfile) vars.push_back(h1->GetZaxis()->GetUniqueID());
+            break;
           case 3:
-            varY = ((TH1*)h)->GetYaxis()->GetUniqueID();
-            if(!fUsedVars[varY]) break;
-            varZ = ((TH1*)h)->GetZaxis()->GetUniqueID();
-            if(!fUsedVars[varZ]) break;
-            if(isProfile) {
-              if(!fUsedVars[varT]) break;
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT],values[varW]);
-              }
-              else
-                ((TProfile3D*)h)->Fill(values[varX],values[varY],values[varZ],values[varT]);
-            }
-            else {
-              if(varW>AliReducedVarManager::kNothing) {
-                if(!fUsedVars[varW]) break;
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ],values[varW]);
-              }
-              else
-                ((TH3F*)h)->Fill(values[varX],values[varY],values[varZ]);
-            }
-          break;
+            type = (isProfile ? kPlanTProfile3D : kPlanTH3);
+            vars.push_back(h1->GetYaxis()->GetUniqueID());
+            vars.push_back(h1->GetZaxis()->GetUniqueID());
+            if(isProfile) vars.push_back(varT);
+            break;
           default:
-          break;
-        }  // end switch
-      }
-    }  // end if(!isTHn)
-    else {
-      for(Int_t idim=0;idim<thnDim;++idim) {
-        allVarsGood &= fUsedVars[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
-        fillValues[idim] = values[((THnF*)h)->GetAxis(idim)->GetUniqueID()];
-      }
-      if(allVarsGood) {
-        if(varW>AliReducedVarManager::kNothing) {
-          if(fUsedVars[varW])
-            ((THnF*)h)->Fill(fillValues,values[varW]);
+            continue;
         }
-        else
-          ((THnF*)h)->Fill(fillValues);
       }
+      else {
+        if(thnDim>20) continue;
+        for(Int_t idim=0;idim<thnDim;++idim) vars.push_back(((THnF*)h)->GetAxis(idim)->GetUniqueID());
+      }
+      
+      // same requirements as for filling: all variables must be in use
+      Bool_t allVarsGood = kTRUE;
+      for(UInt_t iv=0; iv<vars.size(); ++iv) allVarsGood &= (vars[iv]>=0 && fUsedVars[vars[iv]]);
+      if(varW>AliReducedVarManager::kNothing) allVarsGood &= fUsedVars[varW];
+      if(!allVarsGood) continue;
+      
+      fPlanHist.push_back(h);
+      fPlanType.push_back(type);
+      fPlanVarW.push_back(varW);
+      fPlanVarFirst.push_back(fPlanVars.size());
+      fPlanVars.insert(fPlanVars.end(), vars.begin(), vars.end());
     }
   }
+  fPlanClassFirst.push_back(fPlanHist.size());
+  fPlanVarFirst.push_back(fPlanVars.size());
 }
 
 //__________________________________________________________________
@@ -8,6 +8,8 @@
 #ifndef ALIHISTOGRAMMANAGER_H
 #define ALIHISTOGRAMMANAGER_H
 
+#include <vector>
+
 #include <TString.h>
 #include <TObject.h>
 #include <THn.h>
@@ -65,6 +67,9 @@ class AliHistogramManager : public TObject {
                         TAxis* axis);
   
   void FillHistClass(const Char_t* className, Float_t* values);
+  // NOTE: resolve the class id once and fill by id in loops, this avoids the name lookup per call
+  Int_t GetHistClassId(const Char_t* className);
+  void FillHistClass(Int_t classId, Float_t* values);
   
   void SetUseDefaultVariableNames(Bool_t flag) {fUseDefaultVariableNames = flag;};
   void SetDefaultVarNames(TString* vars, TString* units);
@@ -101,6 +106,21 @@ class AliHistogramManager : public TObject {
   TString fVariableUnits[AliReducedVarManager::kNVars];               //! variable units
   Int_t fNVars;                          // maximum number of variables
   
+  // Fill plan: the decoded variables of every histogram, one contiguous block per histogram class.
+  // Built from the histogram lists at the first fill, rebuilt if histograms or classes were added since
+  enum FillPlanTypes {
+    kPlanTH1=0, kPlanTProfile, kPlanTH2, kPlanTProfile2D, kPlanTH3, kPlanTProfile3D, kPlanTHn
+  };
+  std::vector<TObject*> fPlanHist;        //! histogram of each plan entry
+  std::vector<Int_t> fPlanType;           //! FillPlanTypes of each entry
+  std::vector<Int_t> fPlanVarW;           //! weight variable of each entry, -1 if none
+  std::vector<Int_t> fPlanVarFirst;       //! offset of the first variable of each entry in fPlanVars, [nentries+1]
+  std::vector<Int_t> fPlanVars;           //! variable indices of all entries
+  std::vector<Int_t> fPlanClassFirst;     //! first plan entry of each histogram class, [nclasses+1]
+  std::vector<Int_t> fPlanClassSize;      //! number of histograms of each class when the plan was built
+  std::vector<THashList*> fPlanClassList; //! histogram list of each class
+  
+  void BuildFillPlan();
   void MakeAxisLabels(TAxis* ax, const Char_t* labels);
   
   ClassDef(AliHistogramManager, 3)
@@ -10,6 +10,7 @@ using std::endl;
 
 #include <TClonesArray.h>
 #include <TIterator.h>
+#include <TMath.h>
 
 #include "AliReducedVarManager.h"
 #include "AliReducedEventInfo.h"
@@ -32,11 +33,13 @@ AliReducedAnalysisJpsi2ee::AliReducedAnalysisJpsi2ee() :
   fOptionRunOverMC(kFALSE),
   fOptionRunLikeSignPairing(kTRUE),
   fOptionLoopOverTracks(kTRUE),
+  fOptionUseTrackCutMatrix(kFALSE),
   fEventCuts(),
   fTrackCuts(),
   fPreFilterTrackCuts(),
   fPairCuts(),
   fPreFilterPairCuts(),
+  fTrackCutMatrix(),
   fPosTracks(),
   fNegTracks(),
   fPrefilterPosTracks(),
@@ -59,11 +62,13 @@ AliReducedAnalysisJpsi2ee::AliReducedAnalysisJpsi2ee(const Char_t* name, const C
   fOptionRunOverMC(kFALSE),
   fOptionRunLikeSignPairing(kTRUE),
   fOptionLoopOverTracks(kTRUE),
+  fOptionUseTrackCutMatrix(kFALSE),
   fEventCuts(),
   fTrackCuts(),
   fPreFilterTrackCuts(),
   fPairCuts(),
   fPreFilterPairCuts(),
+  fTrackCutMatrix(),
   fPosTracks(),
   fNegTracks(),
   fPrefilterPosTracks(),
@@ -136,6 +141,14 @@ Bool_t AliReducedAnalysisJpsi2ee::IsTrackSelected(AliReducedBaseTrack* track, Fl
   if(fTrackCuts.GetEntries()==0) return kTRUE;
   track->ResetFlags();
   
+  if(fOptionUseTrackCutMatrix && values) {
+    // all cut sets at once; (re)compile if cuts were added since the last call
+    if(fTrackCutMatrix.GetNCutSets()!=TMath::Min(fTrackCuts.GetEntries(),(Int_t)AliReducedCutMatrix::kNMaxCutSets)) 
+      fTrackCutMatrix.Compile(&fTrackCuts);
+    track->SetFlags(fTrackCutMatrix.Evaluate(track, values));
+    return (track->GetFlags()>0 ? kTRUE : kFALSE);
+  }
+  
   for(Int_t i=0; i<fTrackCuts.GetEntries(); ++i) {
     AliReducedInfoCut* cut = (AliReducedInfoCut*)fTrackCuts.At(i);
     if(values) { if(cut->IsSelected(track, values)) track->SetFlag(i); }
@@ -14,6 +14,7 @@
 #include "AliReducedTrackInfo.h"
 #include "AliHistogramManager.h"
 #include "AliMixingHandler.h"
+#include "AliReducedCutMatrix.h"
 
 
 //________________________________________________________________
@@ -41,6 +42,7 @@ public:
   void SetRunPairing(Bool_t option) {fOptionRunPairing = option;};
   void SetRunOverMC(Bool_t option) {fOptionRunOverMC = option;};
   void SetRunLikeSignPairing(Bool_t option) {fOptionRunLikeSignPairing = option;}
+  void SetUseTrackCutMatrix(Bool_t option=kTRUE) {fOptionUseTrackCutMatrix = option;}    // evaluate all track cut sets in one pass (AliReducedCutMatrix)
   void SetLoopOverTracks(Bool_t option) {
      fOptionLoopOverTracks = option; 
      if(!fOptionLoopOverTracks) {fOptionRunPairing = kFALSE; fOptionRunMixing = kFALSE; fOptionRunLikeSignPairing = kFALSE;}     
@@ -56,6 +58,7 @@ public:
   Bool_t GetRunEventMixing() {return fOptionRunMixing;}
   Bool_t GetRunPairing() {return fOptionRunPairing;}
   Bool_t GetLoopOverTracks() {return fOptionLoopOverTracks;}
+  Bool_t GetUseTrackCutMatrix() const {return fOptionUseTrackCutMatrix;}
   
 protected:
    AliHistogramManager* fHistosManager;   // Histogram manager
@@ -66,12 +69,14 @@ protected:
    Bool_t fOptionRunOverMC;  // true: trees contain MC info -> fill histos to compute efficiencies, false: run normally as on data
    Bool_t fOptionRunLikeSignPairing;   // true (default): performs the like sign pairing in addition to the opposite pairing
    Bool_t fOptionLoopOverTracks;       // true (default); if false do not loop over tracks and consequently no pairing
+   Bool_t fOptionUseTrackCutMatrix;   // true: evaluate the track cuts via the compiled cut matrix, false (default): one cut at a time
   
    TList fEventCuts;               // array of event cuts
    TList fTrackCuts;               // array of track cuts
    TList fPreFilterTrackCuts;  // track cuts to be used at the prefilter stage
    TList fPairCuts;                  // array of pair cuts
    TList fPreFilterPairCuts;     // pair cuts to be used at the prefilter stage
+   AliReducedCutMatrix fTrackCutMatrix;   //! compiled track cuts, built at the first use
    
    TList fPosTracks;               // list of selected positive tracks in the current event
    TList fNegTracks;              // list of selected negative tracks in the current event
@@ -97,7 +102,7 @@ protected:
   void FillPairHistograms(ULong_t mask, Int_t pairType, TString pairClass = "PairSE", Bool_t isMCTruth = kFALSE);
   void FillMCTruthHistograms();
   
-  ClassDef(AliReducedAnalysisJpsi2ee,3);
+  ClassDef(AliReducedAnalysisJpsi2ee,4);
 };
 
 #endif
@@ -0,0 +1,138 @@
+/*
+***********************************************************
+  Implementation of AliReducedCutMatrix class.
+  *********************************************************
+*/
+
+#include <iostream>
+using std::cout;
+using std::endl;
+
+#include <TList.h>
+#include <TMath.h>
+
+#ifndef ALIREDUCEDCUTMATRIX_H
+#include "AliReducedCutMatrix.h"
+#endif
+
+#include "AliReducedVarCut.h"
+#include "AliReducedTrackCut.h"
+
+ClassImp(AliReducedCutMatrix)
+
+//____________________________________________________________________________
+AliReducedCutMatrix::AliReducedCutMatrix() :
+  TObject(),
+  fNCutSets(0),
+  fNVariables(0),
+  fCompiledMask(0),
+  fTrackStatusMask(0),
+  fVariables(),
+  fVariableMask(),
+  fCutLow(),
+  fCutHigh(),
+  fCuts(0x0)
+{
+  //
+  // default constructor
+  //
+}
+
+//____________________________________________________________________________
+AliReducedCutMatrix::~AliReducedCutMatrix() {
+  //
+  // destructor
+  //
+}
+
+//____________________________________________________________________________
+void AliReducedCutMatrix::Compile(TList* cuts) {
+   //
+   // Build the bound arrays from the list of cut sets
+   // A cut set is compiled if it is exactly an AliReducedVarCut or AliReducedTrackCut and all its
+   // cuts are plain ranges (no exclusion, no dependent variable, no cut functions)
+   //
+   fCuts = cuts;
+   fNCutSets = 0; fNVariables = 0; fCompiledMask = 0; fTrackStatusMask = 0;
+   fVariables.clear(); fVariableMask.clear(); fCutLow.clear(); fCutHigh.clear();
+   if(!cuts) return;
+   
+   fNCutSets = cuts->GetEntries();
+   if(fNCutSets>kNMaxCutSets) {
+      cout << "AliReducedCutMatrix::Compile() Only the first " << kNMaxCutSets << " cut sets can be flagged, the others are ignored!" << endl;
+      fNCutSets = kNMaxCutSets;
+   }
+   
+   // collect the compilable cut sets and the variables they use
+   for(Int_t is=0; is<fNCutSets; ++is) {
+      TObject* obj = cuts->At(is);
+      if(!obj || (obj->IsA()!=AliReducedVarCut::Class() && obj->IsA()!=AliReducedTrackCut::Class())) continue;
+      AliReducedVarCut* cut = (AliReducedVarCut*)obj;
+      Bool_t compilable = kTRUE;
+      for(Int_t ic=0; ic<cut->GetNCuts(); ++ic) 
+         if(!cut->IsSimpleRangeCut(ic)) {compilable = kFALSE; break;}
+      if(!compilable) continue;
+      fCompiledMask |= (ULong_t(1)<<is);
+      if(obj->IsA()==AliReducedTrackCut::Class()) fTrackStatusMask |= (ULong_t(1)<<is);
+      for(Int_t ic=0; ic<cut->GetNCuts(); ++ic) {
+         Int_t var = cut->GetCutVariable(ic);
+         Bool_t found = kFALSE;
+         for(Int_t iv=0; iv<fNVariables; ++iv) if(fVariables[iv]==var) {found = kTRUE; break;}
+         if(!found) {fVariables.push_back(var); ++fNVariables;}
+      }
+   }
+   
+   // fill the bounds; several cuts on the same variable in one set are intersected
+   fVariableMask.assign(fNVariables, 0);
+   fCutLow.assign(fNVariables*fNCutSets, -TMath::Infinity());
+   fCutHigh.assign(fNVariables*fNCutSets, TMath::Infinity());
+   for(Int_t is=0; is<fNCutSets; ++is) {
+      if(!IsCompiled(is)) continue;
+      AliReducedVarCut* cut = (AliReducedVarCut*)cuts->At(is);
+      for(Int_t ic=0; ic<cut->GetNCuts(); ++ic) {
+         Int_t iv = 0;
+         while(fVariables[iv]!=cut->GetCutVariable(ic)) ++iv;
+         fVariableMask[iv] |= (ULong_t(1)<<is);
+         Float_t& low = fCutLow[iv*fNCutSets+is];
+         Float_t& high = fCutHigh[iv*fNCutSets+is];
+         if(cut->GetCutLow(ic)>low) low = cut->GetCutLow(ic);
+         if(cut->GetCutHigh(ic)<high) high = cut->GetCutHigh(ic);
+      }
+   }
+}
+
+//____________________________________________________________________________
+ULong_t AliReducedCutMatrix::Evaluate(TObject* obj, Float_t* values) const {
+   //
+   // Return the bitmask of the cut sets selecting this object; bit i corresponds to the i-th cut set
+   //
+   if(!fCuts || !values) return 0;
+   
+   // compiled cut sets: one pass over the variables, the inner loop runs over the cut sets
+   ULong_t selected = fCompiledMask;
+   for(Int_t iv=0; iv<fNVariables && selected; ++iv) {
+      const Float_t val = values[fVariables[iv]];
+      const Float_t* low = &fCutLow[iv*fNCutSets];
+      const Float_t* high = &fCutHigh[iv*fNCutSets];
+      ULong_t failed = 0;
+      for(Int_t is=0; is<fNCutSets; ++is)
+         failed |= (ULong_t)(!(val>=low[is] && val<=high[is])) << is;
+      selected &= ~(failed & fVariableMask[iv]);
+   }
+   
+   // track status requests of the compiled track cuts
+   ULong_t statusToCheck = selected & fTrackStatusMask;
+   for(Int_t is=0; is<fNCutSets && statusToCheck; ++is) {
+      if(!(statusToCheck&(ULong_t(1)<<is))) continue;
+      statusToCheck &= ~(ULong_t(1)<<is);
+      if(!((AliReducedTrackCut*)fCuts->At(is))->IsTrackStatusSelected(obj)) selected &= ~(ULong_t(1)<<is);
+   }
+   
+   // everything else is evaluated by the cut itself
+   for(Int_t is=0; is<fNCutSets; ++is) {
+      if(IsCompiled(is)) continue;
+      AliReducedInfoCut* cut = (AliReducedInfoCut*)fCuts->At(is);
+      if(cut && cut->IsSelected(obj, values)) selected |= (ULong_t(1)<<is);
+   }
+   return selected;
+}
@@ -0,0 +1,51 @@
+// Class for evaluating a list of parallel cut sets in one pass over the variables
+// The plain range cuts of all AliReducedVarCut / AliReducedTrackCut sets are compiled into
+// per-variable arrays of lower and upper bounds [variable][cut set], such that one
+// loop over the cut sets of a variable yields the bitmask of the sets which pass it.
+// Cut sets which cannot be expressed in this form are evaluated with their own IsSelected()
+
+#ifndef ALIREDUCEDCUTMATRIX_H
+#define ALIREDUCEDCUTMATRIX_H
+
+#include <vector>
+
+#include <TObject.h>
+
+class TList;
+
+//_________________________________________________________________________
+class AliReducedCutMatrix : public TObject {
+
+ public:
+  AliReducedCutMatrix();
+  virtual ~AliReducedCutMatrix();
+
+  enum Constants {
+     kNMaxCutSets=8*sizeof(ULong_t)       // maximum number of cut sets, one bit each in the returned mask
+  };
+
+  void Compile(TList* cuts);
+  ULong_t Evaluate(TObject* obj, Float_t* values) const;
+
+  Int_t GetNCutSets() const {return fNCutSets;}
+  Int_t GetNVariables() const {return fNVariables;}
+  Bool_t IsCompiled(Int_t icut) const {return (icut<fNCutSets ? (fCompiledMask&(ULong_t(1)<<icut)) : kFALSE);}
+
+ protected:
+  Int_t     fNCutSets;                   // number of cut sets
+  Int_t     fNVariables;                 // number of distinct variables used by the compiled cut sets
+  ULong_t   fCompiledMask;               // cut sets evaluated via the bound arrays
+  ULong_t   fTrackStatusMask;            // compiled cut sets which are AliReducedTrackCuts and need the track status requests
+  std::vector<Int_t>    fVariables;      //! variable index for each column
+  std::vector<ULong_t>  fVariableMask;   //! cut sets which actually cut on each variable
+  std::vector<Float_t>  fCutLow;         //! lower bounds, [fNVariables*fNCutSets]
+  std::vector<Float_t>  fCutHigh;        //! upper bounds, [fNVariables*fNCutSets]
+  TList*    fCuts;                       //! the cut sets (not owned)
+
+  AliReducedCutMatrix(const AliReducedCutMatrix &c);
+  AliReducedCutMatrix& operator= (const AliReducedCutMatrix &c);
+
+  ClassDef(AliReducedCutMatrix,1);
+};
+
+#endif
@@ -5,6 +5,7 @@
 
 #include <TTree.h>
 #include <TFile.h>
+#include <TObjArray.h>
 #include "AliReducedEventInputHandler.h"
 #include "AliReducedBaseEvent.h"
 #include "AliReducedEventInfo.h"
@@ -15,7 +16,9 @@ ClassImp(AliReducedEventInputHandler)
 AliReducedEventInputHandler::AliReducedEventInputHandler() :
     AliInputEventHandler(),
     fEventInputOption(kReducedBaseEvent),
-    fReducedEvent(0)
+    fReducedEvent(0),
+    fActiveBranches(""),
+    fInactiveBranches("")
 {
   // Default constructor
 }
@@ -24,7 +27,9 @@ AliReducedEventInputHandler::AliReducedEventInputHandler() :
 AliReducedEventInputHandler::AliReducedEventInputHandler(const char* name, const char* title):
   AliInputEventHandler(name, title),
   fEventInputOption(kReducedBaseEvent),
-  fReducedEvent(0)
+  fReducedEvent(0),
+  fActiveBranches(""),
+  fInactiveBranches("")
  {
     // Constructor
 }
@@ -46,6 +51,21 @@ Bool_t AliReducedEventInputHandler::Init(TTree* tree, Option_t* opt)
     SwitchOffBranches();
     SwitchOnBranches();
     
+    // if user set active branches, only those are read from the split event branch
+    TObjArray* aractive=fActiveBranches.Tokenize(";");
+    if(aractive->GetEntries()>0) {fTree->SetBranchStatus("*", 0);}
+    for(Int_t i=0; i<aractive->GetEntries(); i++){
+      fTree->SetBranchStatus(aractive->At(i)->GetName(), 1);
+    }
+    delete aractive;
+    
+    // if user set inactive branches
+    TObjArray* arinactive=fInactiveBranches.Tokenize(";");
+    for(Int_t i=0; i<arinactive->GetEntries(); i++){
+      fTree->SetBranchStatus(arinactive->At(i)->GetName(), 0);
+    }
+    delete arinactive;
+    
     // Get pointer to the event
     if (!fReducedEvent) {
        switch(fEventInputOption) {
@@ -6,6 +6,7 @@
 //     Author: Ionut-Cristian Arsene, iarsene@cern.ch, i.c.arsene@fys.uio.no
 //
 
+#include <TString.h>
 #include "AliInputEventHandler.h"
 #include "AliReducedBaseEvent.h"
 //#include "AliReducedEventInfo.h"
@@ -33,6 +34,9 @@ class AliReducedEventInputHandler : public AliInputEventHandler {
              
                  void                                SetInputEventType(Int_t type) {fEventInputOption = type;} ;
                  Int_t                               GetInputEventType() const {return fEventInputOption;};
+                 // read only a subset of the split event branches, e.g. "fTracks.fP*" or "fTracks.fTPCnSig*"
+                 void                                SetTreeActiveBranch(TString b)   {fActiveBranches+=b+";";}
+                 void                                SetTreeInactiveBranch(TString b) {fInactiveBranches+=b+";";}
                  
  private:
     AliReducedEventInputHandler(const AliReducedEventInputHandler& handler);             
@@ -40,9 +44,11 @@ class AliReducedEventInputHandler : public AliInputEventHandler {
     
     Int_t  fEventInputOption;                          // one of the options listed in EReducedEventInputType
     AliReducedBaseEvent* fReducedEvent;   //! Pointer to the event
+    TString fActiveBranches;                   // list of input tree branches to be read; all branches if empty
+    TString fInactiveBranches;                // list of input tree branches not to be read
     //AliReducedEventInfo* fReducedEvent;   //! Pointer to the event
     
-    ClassDef(AliReducedEventInputHandler, 2);
+    ClassDef(AliReducedEventInputHandler, 3);
 };
 
 #endif
@@ -77,6 +77,15 @@ Bool_t AliReducedTrackCut::IsSelected(TObject* obj, Float_t* values) {
    //
    // apply cuts
    //      
+   if(!IsTrackStatusSelected(obj)) return kFALSE;
+   return AliReducedVarCut::IsSelected(values);   
+}
+
+//____________________________________________________________________________
+Bool_t AliReducedTrackCut::IsTrackStatusSelected(TObject* obj) const {
+   //
+   // apply the track status and flag requests
+   //      
    if(!obj->InheritsFrom(AliReducedBaseTrack::Class())) return kFALSE;
    
    if(obj->InheritsFrom(AliReducedTrackInfo::Class())) {
@@ -95,5 +104,5 @@ Bool_t AliReducedTrackCut::IsSelected(TObject* obj, Float_t* values) {
    if(fRejectTaggedGamma && ((AliReducedBaseTrack*)obj)->IsGammaLeg()) return kFALSE;
    if(fRejectTaggedPureGamma && ((AliReducedBaseTrack*)obj)->IsPureGammaLeg()) return kFALSE;
    
-   return AliReducedVarCut::IsSelected(values);   
+   return kTRUE;
 }
@@ -39,6 +39,7 @@ class AliReducedTrackCut : public AliReducedVarCut {
   
   virtual Bool_t IsSelected(TObject* obj);
   virtual Bool_t IsSelected(TObject* obj, Float_t* values);
+  Bool_t IsTrackStatusSelected(TObject* obj) const;      // only the track status / flag requests, without the variable cuts
   
  protected: 
       
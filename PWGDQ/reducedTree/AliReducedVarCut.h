@@ -39,6 +39,13 @@ class AliReducedVarCut : public AliReducedInfoCut {
   virtual Bool_t IsSelected(Float_t* values);
   virtual Bool_t IsSelected(TObject* obj, Float_t* values);
   
+  // NOTE: accessors used by AliReducedCutMatrix to compile the plain range cuts
+  Int_t    GetNCuts() const {return fNCuts;}
+  Short_t GetCutVariable(Int_t i) const {return fCutVariables[i];}
+  Float_t GetCutLow(Int_t i) const {return fCutLow[i];}
+  Float_t GetCutHigh(Int_t i) const {return fCutHigh[i];}
+  Bool_t   IsSimpleRangeCut(Int_t i) const {return (i<fNCuts && !fCutExclude[i] && !fCutHasDependentVariable[i] && !fFuncCutLow[i] && !fFuncCutHigh[i]);}
+  
  protected: 
   
    Int_t       fNCuts;                                    // number of enabled cuts
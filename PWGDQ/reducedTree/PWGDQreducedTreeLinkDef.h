@@ -17,6 +17,7 @@
 #pragma link C++ class AliReducedBaseTrackCut+;
 #pragma link C++ class AliReducedBaseTrack+;
 #pragma link C++ class AliReducedCaloClusterInfo+;
+#pragma link C++ class AliReducedCutMatrix+;
 #pragma link C++ class AliReducedEventCut+;
 #pragma link C++ class AliReducedEventInfo+;
 #pragma link C++ class AliReducedEventInputHandler+;
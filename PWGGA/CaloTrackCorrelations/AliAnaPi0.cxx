@@ -65,7 +65,7 @@ fFillArmenterosThetaStar(0), fFillOnlyMCAcceptanceHisto(0),
 fFillSecondaryCellTiming(0), fFillOpAngleCutHisto(0),      fCheckAccInSector(0),
 fPairWithOtherDetector(0),   fOtherDetectorInputName(""),
 fPhotonMom1(),               fPhotonMom1Boost(),           fPhotonMom2(),                fMCPrimMesonMom(),
-fMCProdVertex(),
+fMCProdVertex(),             fPairKinematics(),            fPairIndex(),
 
 // Histograms
 fhReMod(0x0),                fhReSameSideEMCALMod(0x0),    fhReSameSectorEMCALMod(0x0),  fhReDiffPHOSMod(0x0),
@@ -4240,6 +4240,42 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
       
       fhEventMixBin->Fill(eventbin, GetEventWeight()) ;
       
+      //---------------------------------
+      // Copy the mixed event photons within the pT range
+      // into arrays, once for all photons of this event.
+      // Columns: E, px, py, pz of the photon, then
+      // mass, pT, asymmetry and opening angle of the pair.
+      //---------------------------------
+      if ( fPairKinematics.GetSize() < 8*nPhot2 ) fPairKinematics.Set(8*nPhot2);
+      if ( fPairIndex     .GetSize() <   nPhot2 ) fPairIndex     .Set(  nPhot2);
+      
+      Double_t * e2Arr    = fPairKinematics.GetArray();
+      Double_t * px2Arr   = e2Arr + nPhot2;
+      Double_t * py2Arr   = e2Arr + 2*nPhot2;
+      Double_t * pz2Arr   = e2Arr + 3*nPhot2;
+      Double_t * massArr  = e2Arr + 4*nPhot2;
+      Double_t * ptArr    = e2Arr + 5*nPhot2;
+      Double_t * asymArr  = e2Arr + 6*nPhot2;
+      Double_t * angleArr = e2Arr + 7*nPhot2;
+      
+      Int_t nSel2 = 0;
+      for(Int_t i2 = 0; i2 < nPhot2; i2++)
+      {
+        AliAODPWG4Particle * p2 = (AliAODPWG4Particle*) (ev2->At(i2)) ;
+        
+        // Select photons within a pT range
+        if ( p2->Pt() < GetMinPt() || p2->Pt()  > GetMaxPt() ) continue ;
+        
+        e2Arr [nSel2] = p2->E ();
+        px2Arr[nSel2] = p2->Px();
+        py2Arr[nSel2] = p2->Py();
+        pz2Arr[nSel2] = p2->Pz();
+        fPairIndex[nSel2] = i2;
+        nSel2++;
+      }
+      
+      if ( nSel2 == 0 ) continue ;
+      
       //---------------------------------
       // First loop on photons/clusters
       //---------------------------------
@@ -4257,27 +4293,22 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
         fPhotonMom1.SetPxPyPzE(p1->Px(),p1->Py(),p1->Pz(),p1->E());
         module1 = GetModuleNumber(p1);
         
+        // Kinematics of all the pairs of this cluster with the mixed event
+        CalculatePairKinematics(nSel2, p1->E(), p1->Px(), p1->Py(), p1->Pz(),
+                                e2Arr, px2Arr, py2Arr, pz2Arr,
+                                massArr, ptArr, asymArr, angleArr);
+        
         //---------------------------------
         // Second loop on other mixed event photons/clusters
         //---------------------------------
-        for(Int_t i2 = 0; i2 < nPhot2; i2++)
+        for(Int_t j2 = 0; j2 < nSel2; j2++)
         {
-          AliAODPWG4Particle * p2 = (AliAODPWG4Particle*) (ev2->At(i2)) ;
-          
-          // Select photons within a pT range
-          if ( p2->Pt() < GetMinPt() || p2->Pt()  > GetMaxPt() ) continue ;
-          
-          // Get kinematics of second cluster and calculate those of the pair
-          fPhotonMom2.SetPxPyPzE(p2->Px(),p2->Py(),p2->Pz(),p2->E());
-          m           = (fPhotonMom1+fPhotonMom2).M() ;
-          Double_t pt = (fPhotonMom1 + fPhotonMom2).Pt();
-          Double_t a  = TMath::Abs(p1->E()-p2->E())/(p1->E()+p2->E()) ;
+          Double_t angle = angleArr[j2];
           
           // Check if opening angle is too large or too small compared to what is expected
-          Double_t angle   = fPhotonMom1.Angle(fPhotonMom2.Vect());
-          if(fUseAngleEDepCut && !GetNeutralMesonSelection()->IsAngleInWindow((fPhotonMom1+fPhotonMom2).E(),angle+0.05))
+          if(fUseAngleEDepCut && !GetNeutralMesonSelection()->IsAngleInWindow(p1->E()+e2Arr[j2],angle+0.05))
           {
-            AliDebug(2,Form("Mix pair angle %f (deg) not in E %f window",RadToDeg(angle), (fPhotonMom1+fPhotonMom2).E()));
+            AliDebug(2,Form("Mix pair angle %f (deg) not in E %f window",RadToDeg(angle), p1->E()+e2Arr[j2]));
             continue;
           }
           
@@ -4287,6 +4318,14 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
             continue;
           }
           
+          AliAODPWG4Particle * p2 = (AliAODPWG4Particle*) (ev2->At(fPairIndex[j2])) ;
+          
+          // Get kinematics of second cluster and those of the pair
+          fPhotonMom2.SetPxPyPzE(p2->Px(),p2->Py(),p2->Pz(),p2->E());
+          m           = massArr[j2] ;
+          Double_t pt = ptArr  [j2] ;
+          Double_t a  = asymArr[j2] ;
+          
           AliDebug(2,Form("Mixed Event: pT: fPhotonMom1 %2.2f, fPhotonMom2 %2.2f; Pair: pT %2.2f, mass %2.3f, a %2.3f",p1->Pt(), p2->Pt(), pt,m,a));
           
           // In case we want only pairs in same (super) module, check their origin.
@@ -4609,6 +4648,39 @@ void AliAnaPi0::MakeAnalysisFillHistograms()
   AliDebug(1,"End fill histograms");
 }
 
+//________________________________________________________________________
+/// Kinematics of the pairs of one photon (e1, px1, py1, pz1) with n photons
+/// given as arrays: invariant mass, pT, energy asymmetry and opening angle.
+/// Same arithmetic as the TLorentzVector sum and TVector3::Angle, written
+/// as a single loop over the second photon so that it vectorizes.
+//________________________________________________________________________
+void AliAnaPi0::CalculatePairKinematics(Int_t n, Double_t e1, Double_t px1, Double_t py1, Double_t pz1,
+                                        const Double_t * e2, const Double_t * px2, const Double_t * py2, const Double_t * pz2,
+                                        Double_t * mass, Double_t * pt, Double_t * asym, Double_t * angle) const
+{
+  Double_t mag1 = px1*px1 + py1*py1 + pz1*pz1;
+  
+  for(Int_t j = 0; j < n; j++)
+  {
+    Double_t px = px1 + px2[j];
+    Double_t py = py1 + py2[j];
+    Double_t pz = pz1 + pz2[j];
+    Double_t e  = e1  + e2 [j];
+    
+    Double_t mm = e*e - (px*px + py*py + pz*pz);
+    mass[j] = mm < 0 ? -TMath::Sqrt(-mm) : TMath::Sqrt(mm);
+    pt  [j] = TMath::Sqrt(px*px + py*py);
+    asym[j] = TMath::Abs(e1-e2[j])/e;
+    
+    Double_t ptot2 = mag1*(px2[j]*px2[j] + py2[j]*py2[j] + pz2[j]*pz2[j]);
+    Double_t arg   = 1.;
+    if ( ptot2 > 0 ) arg = (px1*px2[j] + py1*py2[j] + pz1*pz2[j])/TMath::Sqrt(ptot2);
+    if ( arg >  1. ) arg =  1.;
+    if ( arg < -1. ) arg = -1.;
+    angle[j] = TMath::ACos(arg);
+  }
+}
+
 //________________________________________________________________________
 /// It retieves the event index and checks the vertex
 ///  * in the mixed buffer returns -2 if vertex NOK
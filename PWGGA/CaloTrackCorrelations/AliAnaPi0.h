@@ -28,6 +28,8 @@ class TList;
 class TH3F ;
 class TH2F ;
 class TObjString;
+#include <TArrayD.h>
+#include <TArrayI.h>
 
 // Analysis
 #include "AliAnaCaloTrackCorrBaseClass.h"
@@ -178,6 +180,10 @@ class AliAnaPi0 : public AliAnaCaloTrackCorrBaseClass {
   
   void         FillArmenterosThetaStar(Int_t pdg);
 
+  void         CalculatePairKinematics(Int_t n, Double_t e1, Double_t px1, Double_t py1, Double_t pz1,
+                                       const Double_t * e2, const Double_t * px2, const Double_t * py2, const Double_t * pz2,
+                                       Double_t * mass, Double_t * pt, Double_t * asym, Double_t * angle) const ;
+
   private:
 
   /// Containers for photons in stored events
@@ -235,6 +241,8 @@ class AliAnaPi0 : public AliAnaCaloTrackCorrBaseClass {
   TLorentzVector fPhotonMom2;          //!<! Photon cluster momentum, temporary array
   TLorentzVector fMCPrimMesonMom;      //!<! Pi0/Eta MC primary momentum, temporary array
   TVector3       fMCProdVertex;        //!<! Pi0/Eta MC Production vertex, temporary array
+  TArrayD        fPairKinematics;      //!<! Mixed event photon arrays and pair kinematics for CalculatePairKinematics, temporary array
+  TArrayI        fPairIndex;           //!<! Index in the mixed event of the photons in fPairKinematics, temporary array
     
   // ----------
   // Histograms
@@ -596,7 +604,7 @@ class AliAnaPi0 : public AliAnaCaloTrackCorrBaseClass {
   AliAnaPi0 & operator = (const AliAnaPi0 & api0) ;
   
   /// \cond CLASSIMP
-  ClassDef(AliAnaPi0,35) ;
+  ClassDef(AliAnaPi0,36) ;
   /// \endcond
   
 } ;
@@ -646,6 +646,7 @@ void AliAnalysisTaskGammaCalo::InitBack(){
                                   ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->GetNumberOfBGEvents(),
                                   ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->UseTrackMultiplicity(),
                                   4,8,7);
+        fBGHandler[iCut]->SetUseCompactPhotonPool(kTRUE);
       }
     }
   }
@@ -3817,13 +3818,14 @@ void AliAnalysisTaskGammaCalo::CalculateBackground(){
     mbin = fBGHandler[fiCut]->GetMultiplicityBinIndex(fClusterCandidates->GetEntries());
   }
   
+  AliAODConversionPhoton previousGoodV0; // refilled from the compact pool for every pair
   if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseTrackMultiplicity()){
     for(Int_t nEventsInBG=0;nEventsInBG<fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-      AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
+      AliGammaConversionAODBGHandler::AliGammaConversionPhotonRecordVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0Records(zbin,mbin,nEventsInBG);
       for(Int_t iCurrent=0;iCurrent<fClusterCandidates->GetEntries();iCurrent++){
         AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fClusterCandidates->At(iCurrent));
         for(Int_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-          AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+          AliGammaConversionAODBGHandler::FillPhotonFromRecord(previousEventV0s->at(iPrevious),&previousGoodV0);
           AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
           backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
         
@@ -3853,13 +3855,13 @@ void AliAnalysisTaskGammaCalo::CalculateBackground(){
     }
   } else {
     for(Int_t nEventsInBG=0;nEventsInBG <fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-      AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
+      AliGammaConversionAODBGHandler::AliGammaConversionPhotonRecordVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0Records(zbin,mbin,nEventsInBG);
       if(previousEventV0s){
         for(Int_t iCurrent=0;iCurrent<fClusterCandidates->GetEntries();iCurrent++){
           AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fClusterCandidates->At(iCurrent));
           for(Int_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
         
-            AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+            AliGammaConversionAODBGHandler::FillPhotonFromRecord(previousEventV0s->at(iPrevious),&previousGoodV0);
             AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
             backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
         
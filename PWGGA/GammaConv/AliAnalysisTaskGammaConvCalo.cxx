@@ -342,7 +342,9 @@ AliAnalysisTaskGammaConvCalo::AliAnalysisTaskGammaConvCalo(): AliAnalysisTaskSE(
   fDoConvGammaShowerShapeTree(kFALSE),
   fEnableSortForClusMC(kFALSE),
   fDoPrimaryTrackMatching(kFALSE),
-  fDoInvMassShowerShapeTree(kFALSE)
+  fDoInvMassShowerShapeTree(kFALSE),
+  fUseSharedPhotonSelection(kFALSE),
+  fSharedPhotonSelection()
 {
   
 }
@@ -629,7 +631,9 @@ AliAnalysisTaskGammaConvCalo::AliAnalysisTaskGammaConvCalo(const char *name):
   fDoConvGammaShowerShapeTree(kFALSE),
   fEnableSortForClusMC(kFALSE),
   fDoPrimaryTrackMatching(kFALSE),
-  fDoInvMassShowerShapeTree(kFALSE)
+  fDoInvMassShowerShapeTree(kFALSE),
+  fUseSharedPhotonSelection(kFALSE),
+  fSharedPhotonSelection()
 {
   // Define output slots here
   DefineOutput(1, TList::Class());
@@ -756,6 +760,14 @@ void AliAnalysisTaskGammaConvCalo::UserCreateOutputObjects(){
   fV0Reader = (AliV0ReaderV1*)AliAnalysisManager::GetAnalysisManager()->GetTask(fV0ReaderName.Data());
   if(!fV0Reader){printf("Error: No V0 Reader");return;}// GetV0Reader
 
+  // register the photon cuts for the selection shared via the V0 reader
+  fSharedPhotonSelection.assign(fnCuts,-1);
+  if(fUseSharedPhotonSelection){
+    for(Int_t iCut = 0; iCut<fnCuts;iCut++){
+      fSharedPhotonSelection[iCut] = fV0Reader->RegisterPhotonCuts((AliConversionPhotonCuts*)fCutArray->At(iCut));
+    }
+  }
+
   
   if (fIsMC > 1){
     fDoPhotonQA       = 0;
@@ -2811,7 +2823,9 @@ void AliAnalysisTaskGammaConvCalo::ProcessPhotonCandidates()
       if( (isNegFromMBHeader+isPosFromMBHeader) != 4) fIsFromMBHeader = kFALSE;
     }
     
-    if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->PhotonIsSelected(PhotonCandidate,fInputEvent)) continue;
+    if(fSharedPhotonSelection[fiCut] >= 0){
+      if(!fV0Reader->IsPhotonSelected(i,fSharedPhotonSelection[fiCut])) continue;
+    } else if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->PhotonIsSelected(PhotonCandidate,fInputEvent)) continue;
     if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->InPlaneOutOfPlaneCut(PhotonCandidate->GetPhotonPhi(),fEventPlaneAngle)) continue;
     if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->UseElecSharingCut() &&
     !((AliConversionPhotonCuts*)fCutArray->At(fiCut))->UseToCloseV0sCut()){
@@ -70,6 +70,7 @@ class AliAnalysisTaskGammaConvCalo : public AliAnalysisTaskSE {
     void SetDoMesonAnalysis             ( Bool_t flag )                                     { fDoMesonAnalysis = flag                     ;}
     void SetDoMesonQA                   ( Int_t flag )                                      { fDoMesonQA = flag                           ;}
     void SetDoPhotonQA                  ( Int_t flag )                                      { fDoPhotonQA = flag                          ;}
+    void SetUseSharedPhotonSelection    ( Bool_t flag )                                     { fUseSharedPhotonSelection = flag            ;}
     void SetDoClusterQA                 ( Int_t flag )                                      { fDoClusterQA = flag                         ;}
     void SetUseTHnSparse                ( Bool_t flag )                                     { fDoTHnSparse = flag                         ;}
     void SetPlotHistsExtQA              ( Bool_t flag )                                     { fSetPlotHistsExtQA = flag                   ;}
@@ -443,13 +444,15 @@ class AliAnalysisTaskGammaConvCalo : public AliAnalysisTaskSE {
     Bool_t                  fEnableSortForClusMC;                               // switch on sorting for MC labels in cluster
     Bool_t                  fDoPrimaryTrackMatching;                            // switch for basic track matching for primaries
     Bool_t                  fDoInvMassShowerShapeTree;                          // flag for producing tree tESDInvMassShowerShape
+    Bool_t                  fUseSharedPhotonSelection;                          // take the photon selection from the V0 reader, shared with other tasks using the same cut string
+    vector<Int_t>           fSharedPhotonSelection;                             //! index of the shared photon selection in the V0 reader per cut (-1: own evaluation)
     
     
   private:
     AliAnalysisTaskGammaConvCalo(const AliAnalysisTaskGammaConvCalo&); // Prevent copy-construction
     AliAnalysisTaskGammaConvCalo &operator=(const AliAnalysisTaskGammaConvCalo&); // Prevent assignment
 
-    ClassDef(AliAnalysisTaskGammaConvCalo, 37);
+    ClassDef(AliAnalysisTaskGammaConvCalo, 38);
 };
 
 #endif
@@ -262,7 +262,9 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(): AliAnalysisTaskSE(),
   fDoTHnSparse(kTRUE),
   fWeightJetJetMC(1),
   fEnableClusterCutsForTrigger(kFALSE),
-  fDoMaterialBudgetWeightingOfGammasForTrueMesons(kFALSE)
+  fDoMaterialBudgetWeightingOfGammasForTrueMesons(kFALSE),
+  fUseSharedPhotonSelection(kFALSE),
+  fSharedPhotonSelection()
 {
 
 }
@@ -470,7 +472,9 @@ AliAnalysisTaskGammaConvV1::AliAnalysisTaskGammaConvV1(const char *name):
   fDoTHnSparse(kTRUE),
   fWeightJetJetMC(1),
   fEnableClusterCutsForTrigger(kFALSE),
-  fDoMaterialBudgetWeightingOfGammasForTrueMesons(kFALSE)
+  fDoMaterialBudgetWeightingOfGammasForTrueMesons(kFALSE),
+  fUseSharedPhotonSelection(kFALSE),
+  fSharedPhotonSelection()
 {
   // Define output slots here
   DefineOutput(1, TList::Class());
@@ -571,6 +575,7 @@ void AliAnalysisTaskGammaConvV1::InitBack(){
                                   ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->GetNumberOfBGEvents(),
                                   ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->UseTrackMultiplicity(),
                                   0,8,5);
+        fBGHandler[iCut]->SetUseCompactPhotonPool(kTRUE);
         fBGHandlerRP[iCut] = NULL;
       } else {
         fBGHandlerRP[iCut] = new AliConversionAODBGHandlerRP(
@@ -1517,6 +1522,14 @@ void AliAnalysisTaskGammaConvV1::UserCreateOutputObjects(){
   fV0Reader=(AliV0ReaderV1*)AliAnalysisManager::GetAnalysisManager()->GetTask(fV0ReaderName.Data());
   if(!fV0Reader){printf("Error: No V0 Reader");return;} // GetV0Reader
 
+  // register the photon cuts for the selection shared via the V0 reader
+  fSharedPhotonSelection.assign(fnCuts,-1);
+  if(fUseSharedPhotonSelection){
+    for(Int_t iCut = 0; iCut<fnCuts;iCut++){
+      fSharedPhotonSelection[iCut] = fV0Reader->RegisterPhotonCuts((AliConversionPhotonCuts*)fCutArray->At(iCut));
+    }
+  }
+
   if(fV0Reader)
     if((AliConvEventCuts*)fV0Reader->GetEventCuts())
       if(((AliConvEventCuts*)fV0Reader->GetEventCuts())->GetCutHistograms())
@@ -1845,7 +1858,9 @@ void AliAnalysisTaskGammaConvV1::ProcessPhotonCandidates()
       if( (isNegFromMBHeader+isPosFromMBHeader) != 4) fIsFromMBHeader = kFALSE;
     }
   
-    if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->PhotonIsSelected(PhotonCandidate,fInputEvent)) continue;
+    if(fSharedPhotonSelection[fiCut] >= 0){
+      if(!fV0Reader->IsPhotonSelected(i,fSharedPhotonSelection[fiCut])) continue;
+    } else if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->PhotonIsSelected(PhotonCandidate,fInputEvent)) continue;
     if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->InPlaneOutOfPlaneCut(PhotonCandidate->GetPhotonPhi(),fEventPlaneAngle)) continue;
     if(!((AliConversionPhotonCuts*)fCutArray->At(fiCut))->UseElecSharingCut() &&
       !((AliConversionPhotonCuts*)fCutArray->At(fiCut))->UseToCloseV0sCut()){
@@ -3446,10 +3461,11 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
     }
   } else {
     AliGammaConversionAODBGHandler::GammaConversionVertex *bgEventVertex = NULL;
+    AliAODConversionPhoton previousGoodV0; // refilled from the compact pool for every pair
 
     if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseTrackMultiplicity()){
       for(Int_t nEventsInBG=0;nEventsInBG<fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-        AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
+        AliGammaConversionAODBGHandler::AliGammaConversionPhotonRecordVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0Records(zbin,mbin,nEventsInBG);
         if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
           bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
         }
@@ -3457,7 +3473,7 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
         for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
         AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
         for(Int_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-          AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+          AliGammaConversionAODBGHandler::FillPhotonFromRecord(previousEventV0s->at(iPrevious),&previousGoodV0);
           if(fMoveParticleAccordingToVertex == kTRUE){
             MoveParticleAccordingToVertex(&previousGoodV0,bgEventVertex);
           }
@@ -3484,7 +3500,7 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
       }
     } else {
       for(Int_t nEventsInBG=0;nEventsInBG <fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-        AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
+        AliGammaConversionAODBGHandler::AliGammaConversionPhotonRecordVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0Records(zbin,mbin,nEventsInBG);
         if(previousEventV0s){
         if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
           bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
@@ -3493,7 +3509,7 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
           AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
           for(Int_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
 
-            AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+            AliGammaConversionAODBGHandler::FillPhotonFromRecord(previousEventV0s->at(iPrevious),&previousGoodV0);
 
             if(fMoveParticleAccordingToVertex == kTRUE){
               MoveParticleAccordingToVertex(&previousGoodV0,bgEventVertex);
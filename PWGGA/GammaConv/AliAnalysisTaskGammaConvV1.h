@@ -38,6 +38,7 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
     void SetDoMesonAnalysis(Bool_t flag)                          { fDoMesonAnalysis            = flag    ;}
     void SetDoMesonQA(Int_t flag)                                 { fDoMesonQA                  = flag    ;}
     void SetDoPhotonQA(Int_t flag)                                { fDoPhotonQA                 = flag    ;}
+    void SetUseSharedPhotonSelection(Bool_t flag)                 { fUseSharedPhotonSelection   = flag    ;}
     void SetDoClusterSelectionForTriggerNorm(Bool_t flag)         { fEnableClusterCutsForTrigger= flag    ;}
     void SetDoChargedPrimary(Bool_t flag)                         { fDoChargedPrimary           = flag    ;}
     void SetDoPlotVsCentrality(Bool_t flag)                       { fDoPlotVsCentrality         = flag    ;}
@@ -300,12 +301,14 @@ class AliAnalysisTaskGammaConvV1 : public AliAnalysisTaskSE {
     Double_t*                         fWeightCentrality;                          //[fnCuts], weight for centrality flattening
     Bool_t                            fEnableClusterCutsForTrigger;                //enables ClusterCuts for Trigger
     Bool_t                            fDoMaterialBudgetWeightingOfGammasForTrueMesons;
+    Bool_t                            fUseSharedPhotonSelection;                  // take the photon selection from the V0 reader, shared with other tasks using the same cut string
+    vector<Int_t>                     fSharedPhotonSelection;                     //! index of the shared photon selection in the V0 reader per cut (-1: own evaluation)
     
   private:
 
     AliAnalysisTaskGammaConvV1(const AliAnalysisTaskGammaConvV1&); // Prevent copy-construction
     AliAnalysisTaskGammaConvV1 &operator=(const AliAnalysisTaskGammaConvV1&); // Prevent assignment
-    ClassDef(AliAnalysisTaskGammaConvV1, 39);
+    ClassDef(AliAnalysisTaskGammaConvV1, 40);
 };
 
 #endif
@@ -68,6 +68,10 @@ AliAnalysisTaskMaterialHistos::AliAnalysisTaskMaterialHistos() : AliAnalysisTask
   fMCStack(NULL),
 	fnCuts(0),
 	fiCut(0),
+	fEsdTrackCuts09(NULL),
+	fEsdTrackCuts0914(NULL),
+	fTrackLabels09(),
+	fTrackLabels0914(),
   hNEvents(NULL),
 	hNGoodESDTracks09(NULL),
 	hNGoodESDTracks14(NULL),
@@ -187,6 +191,10 @@ fConversionCutArray(NULL),
         fMCStack(NULL),
   fnCuts(0),							
   fiCut(0),
+  fEsdTrackCuts09(NULL),
+  fEsdTrackCuts0914(NULL),
+  fTrackLabels09(),
+  fTrackLabels0914(),
   hNEvents(NULL),
 	hNGoodESDTracks09(NULL),
 	hNGoodESDTracks14(NULL),
@@ -281,6 +289,8 @@ AliAnalysisTaskMaterialHistos::~AliAnalysisTaskMaterialHistos()
     delete fGammaCandidates;
     fGammaCandidates = 0x0;
   }
+  delete fEsdTrackCuts09;
+  delete fEsdTrackCuts0914;
 }
 //________________________________________________________________________
 void AliAnalysisTaskMaterialHistos::UserCreateOutputObjects()
@@ -773,6 +783,8 @@ void AliAnalysisTaskMaterialHistos::UserExec(Option_t *){
   
   
   fConversionGammas=fV0Reader->GetReconstructedGammas();// Gammas from default Cut
+
+  SelectTracks(); // tracks for the multiplicity, common to all cuts
 	
   // ------------------- BeginEvent ----------------------------
   
@@ -1205,39 +1217,65 @@ void AliAnalysisTaskMaterialHistos::ProcessPhotons(){
     
 }
   
+//________________________________________________________________________
+void AliAnalysisTaskMaterialHistos::SelectTracks(){
+	// Tracks passing the multiplicity track cuts, the same for all the cuts.
+	// Only the rejection of the added signals depends on the cut, it is done
+	// in CountTracks09 and CountTracks0914
+	fTrackLabels09.clear();
+	fTrackLabels0914.clear();
+	if(fInputEvent->IsA()!=AliESDEvent::Class()) return;
+
+	if(!fEsdTrackCuts09){
+		// Using standard function for setting Cuts
+		Bool_t selectPrimaries=kTRUE;
+		fEsdTrackCuts09 = AliESDtrackCuts::GetStandardITSTPCTrackCuts2010(selectPrimaries);
+		fEsdTrackCuts09->SetMaxDCAToVertexZ(2);
+		fEsdTrackCuts09->SetEtaRange(-0.9, 0.9);
+		fEsdTrackCuts09->SetPtRange(0.15);
+	}
+	if(!fEsdTrackCuts0914){
+		fEsdTrackCuts0914 = AliESDtrackCuts::GetStandardTPCOnlyTrackCuts();
+		fEsdTrackCuts0914->SetMaxDCAToVertexZ(5);
+		fEsdTrackCuts0914->SetPtRange(0.15);
+	}
+
+	for(Int_t iTracks = 0; iTracks < fInputEvent->GetNumberOfTracks(); iTracks++){
+		AliESDtrack* curTrack = (AliESDtrack*) fInputEvent->GetTrack(iTracks);
+		if(!curTrack) continue;
+		if(fEsdTrackCuts09->AcceptTrack(curTrack)) fTrackLabels09.push_back(TMath::Abs(curTrack->GetLabel()));
+	}
+	fEsdTrackCuts0914->SetEtaRange(0.9, 1.4);
+	for(Int_t iTracks = 0; iTracks < fInputEvent->GetNumberOfTracks(); iTracks++){
+		AliESDtrack* curTrack = (AliESDtrack*) fInputEvent->GetTrack(iTracks);
+		if(!curTrack) continue;
+		if(fEsdTrackCuts0914->AcceptTrack(curTrack)) fTrackLabels0914.push_back(TMath::Abs(curTrack->GetLabel()));
+	}
+	fEsdTrackCuts0914->SetEtaRange(-1.4, -0.9);
+	for(Int_t iTracks = 0; iTracks < fInputEvent->GetNumberOfTracks(); iTracks++){
+		AliESDtrack* curTrack = (AliESDtrack*) fInputEvent->GetTrack(iTracks);
+		if(!curTrack) continue;
+		if(fEsdTrackCuts0914->AcceptTrack(curTrack)) fTrackLabels0914.push_back(TMath::Abs(curTrack->GetLabel()));
+	}
+}
+
 //________________________________________________________________________
 Int_t AliAnalysisTaskMaterialHistos::CountTracks09(){
 	Int_t fNumberOfESDTracks = 0;
 	if(fInputEvent->IsA()==AliESDEvent::Class()){
-	// Using standard function for setting Cuts
-		
 		AliStack *fMCStack = NULL;
 		if (fMCEvent){
 			fMCStack= fMCEvent->Stack();
 			if (!fMCStack) return 0;
 		}	
-				
-		Bool_t selectPrimaries=kTRUE;
-               AliESDtrackCuts *EsdTrackCuts = AliESDtrackCuts::GetStandardITSTPCTrackCuts2010(selectPrimaries);
-		EsdTrackCuts->SetMaxDCAToVertexZ(2);
-		EsdTrackCuts->SetEtaRange(-0.9, 0.9);
-		EsdTrackCuts->SetPtRange(0.15);
-		
-		for(Int_t iTracks = 0; iTracks < fInputEvent->GetNumberOfTracks(); iTracks++){
-			AliESDtrack* curTrack = (AliESDtrack*) fInputEvent->GetTrack(iTracks);
-			if(!curTrack) continue;
-			if(EsdTrackCuts->AcceptTrack(curTrack) ){
-				if (fMCEvent){
-					if(fMCStack && ((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetSignalRejection() != 0){
-                        Int_t isFromMBHeader = ((AliConvEventCuts*)fEventCutArray->At(fiCut))->IsParticleFromBGEvent(TMath::Abs(curTrack->GetLabel()), fMCStack, fInputEvent);
-						if( (isFromMBHeader < 1) ) continue;
-					}					
-				}	
-				fNumberOfESDTracks++;
-			}	
+
+		AliConvEventCuts *eventCuts = (AliConvEventCuts*)fEventCutArray->At(fiCut);
+		if(!fMCStack || eventCuts->GetSignalRejection() == 0) return fTrackLabels09.size();
+		for(UInt_t iTracks = 0; iTracks < fTrackLabels09.size(); iTracks++){
+			Int_t isFromMBHeader = eventCuts->IsParticleFromBGEvent(fTrackLabels09[iTracks], fMCStack, fInputEvent);
+			if( (isFromMBHeader < 1) ) continue;
+			fNumberOfESDTracks++;
 		}
-		delete EsdTrackCuts;
-		EsdTrackCuts=0x0;
 	} 
 	return fNumberOfESDTracks;
 }
@@ -1246,48 +1284,19 @@ Int_t AliAnalysisTaskMaterialHistos::CountTracks09(){
 Int_t AliAnalysisTaskMaterialHistos::CountTracks0914(){
 	Int_t fNumberOfESDTracks = 0;
 	if(fInputEvent->IsA()==AliESDEvent::Class()){
-		// Using standard function for setting Cuts
-		
 		AliStack *fMCStack = NULL;
 		if (fMCEvent){
 			fMCStack= fMCEvent->Stack();
 			if (!fMCStack) return 0;
 		}	
 
-		AliESDtrackCuts *EsdTrackCuts = AliESDtrackCuts::GetStandardTPCOnlyTrackCuts();
-		EsdTrackCuts->SetMaxDCAToVertexZ(5);
-		EsdTrackCuts->SetEtaRange(0.9, 1.4);
-		EsdTrackCuts->SetPtRange(0.15);
-		
-		for(Int_t iTracks = 0; iTracks < fInputEvent->GetNumberOfTracks(); iTracks++){
-			AliESDtrack* curTrack = (AliESDtrack*) fInputEvent->GetTrack(iTracks);
-			if(!curTrack) continue;
-			if(EsdTrackCuts->AcceptTrack(curTrack) ){
-				if (fMCEvent){
-					if(fMCStack && ((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetSignalRejection() != 0){
-                        Int_t isFromMBHeader = ((AliConvEventCuts*)fEventCutArray->At(fiCut))->IsParticleFromBGEvent(TMath::Abs(curTrack->GetLabel()), fMCStack, fInputEvent);
-						if( (isFromMBHeader < 1) ) continue;
-					}					
-				}	
-				fNumberOfESDTracks++;
-			}
-		}
-		EsdTrackCuts->SetEtaRange(-1.4, -0.9);
-		for(Int_t iTracks = 0; iTracks < fInputEvent->GetNumberOfTracks(); iTracks++){
-			AliESDtrack* curTrack =(AliESDtrack*) fInputEvent->GetTrack(iTracks);
-			if(!curTrack) continue;
-			if(EsdTrackCuts->AcceptTrack(curTrack) ){
-				if (fMCEvent){
-					if(fMCStack && ((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetSignalRejection() != 0){
-                        Int_t isFromMBHeader = ((AliConvEventCuts*)fEventCutArray->At(fiCut))->IsParticleFromBGEvent(TMath::Abs(curTrack->GetLabel()), fMCStack, fInputEvent);
-						if( (isFromMBHeader < 1) ) continue;
-					}					
-				}	
-				fNumberOfESDTracks++;
-			}	
+		AliConvEventCuts *eventCuts = (AliConvEventCuts*)fEventCutArray->At(fiCut);
+		if(!fMCStack || eventCuts->GetSignalRejection() == 0) return fTrackLabels0914.size();
+		for(UInt_t iTracks = 0; iTracks < fTrackLabels0914.size(); iTracks++){
+			Int_t isFromMBHeader = eventCuts->IsParticleFromBGEvent(fTrackLabels0914[iTracks], fMCStack, fInputEvent);
+			if( (isFromMBHeader < 1) ) continue;
+			fNumberOfESDTracks++;
 		}
-		delete EsdTrackCuts;
-		EsdTrackCuts=0x0;
 	} 
 	
 	return fNumberOfESDTracks;
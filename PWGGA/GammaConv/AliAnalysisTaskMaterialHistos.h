@@ -19,6 +19,8 @@
 
 using namespace std;
 
+class AliESDtrackCuts;
+
 
 class AliAnalysisTaskMaterialHistos : public AliAnalysisTaskSE{
 
@@ -52,6 +54,7 @@ class AliAnalysisTaskMaterialHistos : public AliAnalysisTaskSE{
 		void FillMCTree(Int_t stackPos);
 		Int_t CountTracks0914();
 		Int_t CountTracks09();
+		void SelectTracks();
 
 		AliV0ReaderV1 		*fV0Reader;					// 
         TString              fV0ReaderName;
@@ -86,6 +89,10 @@ class AliAnalysisTaskMaterialHistos : public AliAnalysisTaskSE{
 		AliStack*         fMCStack;                                   //
 		Int_t             fnCuts;                      //
 		Int_t             fiCut;                       //
+		AliESDtrackCuts*  fEsdTrackCuts09;             //! track cuts for the multiplicity in |eta|<0.9
+		AliESDtrackCuts*  fEsdTrackCuts0914;           //! track cuts for the multiplicity in 0.9<|eta|<1.4
+		vector<Int_t>     fTrackLabels09;              //! labels of the selected tracks in |eta|<0.9 in the event
+		vector<Int_t>     fTrackLabels0914;            //! labels of the selected tracks in 0.9<|eta|<1.4 in the event
 		TH1F**            hNEvents         ;           //!
 		TH1F**            hNGoodESDTracks09;           //!
 		TH1F**            hNGoodESDTracks14;           //!
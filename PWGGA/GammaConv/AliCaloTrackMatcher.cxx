@@ -39,6 +39,7 @@
 #include <vector>
 #include <map>
 #include <utility>
+#include <algorithm>
 
 class iostream;
 
@@ -67,6 +68,12 @@ AliCaloTrackMatcher::AliCaloTrackMatcher(const char *name, Int_t clusterType) :
   fSecVectorDeltaEtaDeltaPhi(0),
   fSecMap_TrID_ClID_ToIndex(),
   fSecMap_TrID_ClID_AlreadyTried(),
+  fClusterPositions(),
+  fClusterZOrder(),
+  fSecSurfaceIndex(),
+  fSecSurfaceParams(),
+  fSecSurfaceStatus(),
+  fSecSurfaceEtaPhi(),
   fListHistos(NULL),
   fHistControlMatches(NULL),
   fSecHistControlMatches(NULL)
@@ -164,6 +171,11 @@ void AliCaloTrackMatcher::Initialize(Int_t runNumber){
   fSecMap_TrID_ClID_ToIndex.clear();
   fSecMap_TrID_ClID_AlreadyTried.clear();
 
+  fSecSurfaceIndex.clear();
+  fSecSurfaceParams.clear();
+  fSecSurfaceStatus.clear();
+  fSecSurfaceEtaPhi.clear();
+
   if(fRunNumber == -1 || fRunNumber != runNumber){
     if(fClusterType == 1 || fClusterType == 3){
       fGeomEMCAL = AliEMCALGeometry::GetInstanceFromRunNumber(runNumber);
@@ -211,6 +223,19 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
     }
   }
 
+  // cluster positions are needed for every track, get them once per event and order the clusters in z:
+  // a cluster can only be within the matching window if its z is, so only this range has to be looped over
+  fClusterPositions.resize(3*nClus);
+  fClusterZOrder.clear();
+  for(Int_t iclus=0;iclus < nClus;iclus++){
+    AliVCluster* cluster = event->GetCaloCluster(iclus);
+    if (!cluster) continue;
+    cluster->GetPosition(&fClusterPositions[3*iclus]);
+    fClusterZOrder.push_back(make_pair(fClusterPositions[3*iclus+2],iclus));
+  }
+  sort(fClusterZOrder.begin(),fClusterZOrder.end());
+  vector<Int_t> clusterCandidates;
+
   for (Int_t itr=0;itr<event->GetNumberOfTracks();itr++){
     AliExternalTrackParam *trackParam = 0;
     AliVTrack *inTrack = 0x0;
@@ -285,17 +310,27 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
     Float_t dEta=-999, dPhi=-999;
     Float_t clsPos[3] = {0.,0.,0.};
     Double_t exPos[3] = {0.,0.,0.};
-    if (!emcParam.GetXYZ(exPos)){ fHistControlMatches->Fill(2.,inTrack->Pt()); continue;}
+    if (!emcParam.GetXYZ(exPos)){ delete trackParam; fHistControlMatches->Fill(2.,inTrack->Pt()); continue;}
 
 //cout << inTrack->GetID() << " - " << trackParam << endl;
 //cout << "eta/phi: " << eta << ", " << phi << endl;
 //cout << "nClus: " << nClus << endl;
+    // clusters within the matching window in z (with 1 cm margin for the float rounding of the positions),
+    // processed in the original cluster order; the exact distance check is done below
+    clusterCandidates.clear();
+    vector<pair<Float_t,Int_t> >::iterator itZ = lower_bound(fClusterZOrder.begin(),fClusterZOrder.end(),make_pair((Float_t)(exPos[2]-fMatchingWindow-1.),-1));
+    for(; itZ != fClusterZOrder.end() && itZ->first <= exPos[2]+fMatchingWindow+1.; ++itZ) clusterCandidates.push_back(itZ->second);
+    sort(clusterCandidates.begin(),clusterCandidates.end());
+
     Int_t nClusterMatchesToTrack = 0;
-    for(Int_t iclus=0;iclus < nClus;iclus++){
+    for(UInt_t iCand=0;iCand < clusterCandidates.size();iCand++){
+      Int_t iclus = clusterCandidates[iCand];
       AliVCluster* cluster = event->GetCaloCluster(iclus);
       if (!cluster) continue;
 //cout << "-------------------------LOOPING: " << iclus << ", " << cluster->GetID() << endl;
-      cluster->GetPosition(clsPos);
+      clsPos[0] = fClusterPositions[3*iclus];
+      clsPos[1] = fClusterPositions[3*iclus+1];
+      clsPos[2] = fClusterPositions[3*iclus+2];
       Double_t dR = TMath::Sqrt(TMath::Power(exPos[0]-clsPos[0],2)+TMath::Power(exPos[1]-clsPos[1],2)+TMath::Power(exPos[2]-clsPos[2],2));
 //cout << "dR: " << dR << endl;
       if (dR > fMatchingWindow) continue;
@@ -391,68 +426,37 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
     }
   }
 
-  AliExternalTrackParam *trackParam = 0;
-  if (esdt) {
-    const AliExternalTrackParam *in = esdt->GetInnerParam();
-    if (!in){
-      AliDebug(2, "Could not get InnerParam of Track, continue");
-      fSecHistControlMatches->Fill(1.,inSecTrack->Pt());
-      fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
-      return kFALSE;
-    }
-    trackParam = new AliExternalTrackParam(*in);
-  } else {
-    Double_t xyz[3] = {0}, pxpypz[3] = {0}, cv[21] = {0};
-    aodt->GetPxPyPz(pxpypz);
-    aodt->GetXYZ(xyz);
-    aodt->GetCovarianceXYZPxPyPz(cv);
-    trackParam = new AliExternalTrackParam(xyz,pxpypz,cv,aodt->Charge());
-  }
-  if(!trackParam){
-    AliError("Could not get TrackParameters, continue");
-    fSecHistControlMatches->Fill(1.,inSecTrack->Pt());
-    fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
-    return kFALSE;
-  }
-
   Bool_t propagated = kFALSE;
-  AliExternalTrackParam emcParam(*trackParam);
   Float_t dPhiTemp = 0;
   Float_t dEtaTemp = 0;
 
+  AliExternalTrackParam *trackParam = 0;
   if(cluster->IsEMCAL()){
-    Float_t eta = 0;Float_t phi = 0;Float_t pt = 0;
-    propagated = AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(&emcParam, 430, 0.000510999, 20, eta, phi, pt);
-    if(propagated){
-      if( TMath::Abs(eta) > 0.8 ) {
-        delete trackParam;
-        fSecHistControlMatches->Fill(3.,inSecTrack->Pt());
-        fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
-        return kFALSE;
-      }
-      // Save some time and memory in case of no DCal present
-      if( nModules < 13 && ( phi < 60*TMath::DegToRad() || phi > 200*TMath::DegToRad())){
-        delete trackParam;
-        fSecHistControlMatches->Fill(3.,inSecTrack->Pt());
-        fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
-        return kFALSE;
-      }
-
-      propagated = AliEMCALRecoUtils::ExtrapolateTrackToCluster(&emcParam, cluster, 0.000510999, 5, dEtaTemp, dPhiTemp);
-      if(!propagated){
-        delete trackParam;
-        fSecHistControlMatches->Fill(4.,inSecTrack->Pt());
-        fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
-        return kFALSE;
-      }
-    }else{
+    // the extrapolation to the EMCal surface does not depend on the cluster, it is done once per track and event
+    Int_t surfaceIndex = GetSecTrackEMCalSurfaceIndex(inSecTrack,esdt,aodt,nModules);
+    Int_t surfaceStatus = fSecSurfaceStatus[surfaceIndex];
+    if(surfaceStatus != 0){
+      fSecHistControlMatches->Fill(surfaceStatus,inSecTrack->Pt());
+      fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
+      return kFALSE;
+    }
+    trackParam = new AliExternalTrackParam(fSecSurfaceParams[surfaceIndex]);
+    propagated = AliEMCALRecoUtils::ExtrapolateTrackToCluster(trackParam, cluster, 0.000510999, 5, dEtaTemp, dPhiTemp);
+    if(!propagated){
       delete trackParam;
-      fSecHistControlMatches->Fill(2.,inSecTrack->Pt());
+      fSecHistControlMatches->Fill(4.,inSecTrack->Pt());
       fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
       return kFALSE;
     }
 
   }else if(cluster->IsPHOS()){
+    trackParam = CreateSecTrackParam(esdt,aodt);
+    if(!trackParam){
+      fSecHistControlMatches->Fill(1.,inSecTrack->Pt());
+      fSecMap_TrID_ClID_AlreadyTried[make_pair(inSecTrack->GetID(),cluster->GetID())] = 1.;
+      return kFALSE;
+    }
+    AliExternalTrackParam emcParam(*trackParam);
     propagated = AliTrackerBase::PropagateTrackToBxByBz(&emcParam, clusterR, 0.000510999, 20, kTRUE, 0.8, -1);
     if (propagated){
       Double_t trkPos[3] = {0,0,0};
@@ -517,6 +521,66 @@ Bool_t AliCaloTrackMatcher::PropagateV0TrackToClusterAndGetMatchingResidual(AliV
 //________________________________________________________________________
 //________________________________________________________________________
 //________________________________________________________________________
+//________________________________________________________________________
+AliExternalTrackParam* AliCaloTrackMatcher::CreateSecTrackParam(AliESDtrack* esdt, AliAODTrack* aodt){
+  // starting parameters of a V0-track for the propagation, 0 if not available; the caller owns the returned object
+  if (esdt) {
+    const AliExternalTrackParam *in = esdt->GetInnerParam();
+    if (!in){
+      AliDebug(2, "Could not get InnerParam of Track, continue");
+      return 0;
+    }
+    return new AliExternalTrackParam(*in);
+  } else if (aodt) {
+    Double_t xyz[3] = {0}, pxpypz[3] = {0}, cv[21] = {0};
+    aodt->GetPxPyPz(pxpypz);
+    aodt->GetXYZ(xyz);
+    aodt->GetCovarianceXYZPxPyPz(cv);
+    return new AliExternalTrackParam(xyz,pxpypz,cv,aodt->Charge());
+  }
+  return 0;
+}
+
+//________________________________________________________________________
+Bool_t AliCaloTrackMatcher::GetSecTrackEMCalSurfaceEtaPhi(Int_t trackID, Float_t &eta, Float_t &phi){
+  // (eta, phi) of a V0-track at the EMCal surface, only available once it has been propagated in this event
+  map<Int_t,Int_t>::iterator it = fSecSurfaceIndex.find(trackID);
+  if(it == fSecSurfaceIndex.end() || fSecSurfaceStatus[it->second] != 0) return kFALSE;
+  eta = fSecSurfaceEtaPhi[it->second].first;
+  phi = fSecSurfaceEtaPhi[it->second].second;
+  return kTRUE;
+}
+
+//________________________________________________________________________
+Int_t AliCaloTrackMatcher::GetSecTrackEMCalSurfaceIndex(AliVTrack* inSecTrack, AliESDtrack* esdt, AliAODTrack* aodt, Int_t nModules){
+  // index of the V0-track in the per-event store of EMCal surface extrapolations, the extrapolation is done on first request
+  // status: 0 = at surface, 1 = no track parameters, 2 = propagation failed, 3 = outside of the acceptance (bins of fSecHistControlMatches)
+
+  map<Int_t,Int_t>::iterator it = fSecSurfaceIndex.find(inSecTrack->GetID());
+  if(it != fSecSurfaceIndex.end()) return it->second;
+
+  Int_t index = fSecSurfaceStatus.size();
+  fSecSurfaceIndex[inSecTrack->GetID()] = index;
+
+  Int_t status = 0;
+  Float_t eta = 0;Float_t phi = 0;Float_t pt = 0;
+  AliExternalTrackParam *trackParam = CreateSecTrackParam(esdt,aodt);
+  if(!trackParam){
+    status = 1;
+    fSecSurfaceParams.push_back(AliExternalTrackParam());
+  } else {
+    if(!AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(trackParam, 430, 0.000510999, 20, eta, phi, pt)) status = 2;
+    else if( TMath::Abs(eta) > 0.8 ) status = 3;
+    // Save some time and memory in case of no DCal present
+    else if( nModules < 13 && ( phi < 60*TMath::DegToRad() || phi > 200*TMath::DegToRad())) status = 3;
+    fSecSurfaceParams.push_back(*trackParam);
+    delete trackParam;
+  }
+  fSecSurfaceStatus.push_back(status);
+  fSecSurfaceEtaPhi.push_back(make_pair(eta,phi));
+  return index;
+}
+
 //________________________________________________________________________
 Bool_t AliCaloTrackMatcher::GetTrackClusterMatchingResidual(Int_t trackID, Int_t clusterID, Float_t &dEta, Float_t &dPhi){
   Int_t position = fMap_TrID_ClID_ToIndex[make_pair(trackID,clusterID)];
@@ -4,11 +4,14 @@
 #include "AliAnalysisTaskSE.h"
 #include "AliEMCALGeometry.h"
 #include "AliPHOSGeometry.h"
+#include "AliExternalTrackParam.h"
 #include <vector>
 #include <map>
 #include <utility>
 
 class TF1;
+class AliESDtrack;
+class AliAODTrack;
 
 using namespace std;
 
@@ -53,6 +56,7 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     Bool_t PropagateV0TrackToClusterAndGetMatchingResidual(AliVTrack* inSecTrack, AliVCluster* cluster, AliVEvent* event, Float_t &dEta, Float_t &dPhi);
     Bool_t IsSecTrackClusterAlreadyTried(Int_t trackID, Int_t clusterID);
     Bool_t GetSecTrackClusterMatchingResidual(Int_t trackID, Int_t clusterID, Float_t &dEta, Float_t &dPhi);
+    Bool_t GetSecTrackEMCalSurfaceEtaPhi(Int_t trackID, Float_t &eta, Float_t &phi);
 
     Int_t GetNMatchedClusterIDsForSecTrack(AliVEvent *event, Int_t clusterID, Float_t dEtaMax, Float_t dEtaMin, Float_t dPhiMax, Float_t dPhiMin);
     Int_t GetNMatchedClusterIDsForSecTrack(AliVEvent *event, Int_t clusterID, TF1* fFuncPtDepEta, TF1* fFuncPtDepPhi);
@@ -86,6 +90,8 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     void Initialize(Int_t runNumber);
     void ProcessEvent(AliVEvent *event);
     void SetLogBinningYTH2(TH2* histoRebin);
+    AliExternalTrackParam* CreateSecTrackParam(AliESDtrack* esdt, AliAODTrack* aodt);
+    Int_t GetSecTrackEMCalSurfaceIndex(AliVTrack* inSecTrack, AliESDtrack* esdt, AliAODTrack* aodt, Int_t nModules);
 
     // debug methods
     void DebugMatching();
@@ -117,12 +123,20 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     mapT                  fSecMap_TrID_ClID_ToIndex;  // map tuple of (V0-trackID,clusterID) to index in vector fSecVectorDeltaEtaDeltaPhi
     mapT                  fSecMap_TrID_ClID_AlreadyTried;  // map tuple of (V0-trackID,clusterID) to matching outcome, successful or not
 
+    // per-event stores shared by all users of the matcher
+    vector<Float_t>       fClusterPositions;          //! cluster positions (x,y,z) of the current event
+    vector<pair<Float_t,Int_t> > fClusterZOrder;      //! (z, cluster index) of the current event ordered in z
+    map<Int_t,Int_t>      fSecSurfaceIndex;           //! V0-trackID -> index in the EMCal surface store below
+    vector<AliExternalTrackParam> fSecSurfaceParams;  //! V0-track parameters at the EMCal surface
+    vector<Int_t>         fSecSurfaceStatus;          //! 0: at surface, otherwise bin of fSecHistControlMatches for the failure
+    vector<pairFloat>     fSecSurfaceEtaPhi;          //! (eta, phi) of the V0-track at the EMCal surface
+
     //histos
     TList*                fListHistos;             // list with histogram(s)
     TH2F*                 fHistControlMatches;     // bookkeeping for processed tracks/clusters and succesful matches
     TH2F*                 fSecHistControlMatches;  // bookkeeping for processed V0-tracks/clusters and succesful matches
 
-    ClassDef(AliCaloTrackMatcher,2)
+    ClassDef(AliCaloTrackMatcher,3)
 };
 
 #endif
@@ -216,7 +216,8 @@ AliConversionPhotonCuts::AliConversionPhotonCuts(const char *name,const char *ti
   fPreSelCut(kFALSE),
   fProcessAODCheck(kFALSE),
   fProfileContainingMaterialBudgetWeights(NULL),
-  fMaterialBudgetWeightsInitialized(kFALSE)
+  fMaterialBudgetWeightsInitialized(kFALSE),
+  fNPhotonCutSteps(-1)
 {
   InitPIDResponse();
   for(Int_t jj=0;jj<kNCuts;jj++){fCuts[jj]=0;}
@@ -349,7 +350,8 @@ AliConversionPhotonCuts::AliConversionPhotonCuts(const AliConversionPhotonCuts &
   fPreSelCut(ref.fPreSelCut),
   fProcessAODCheck(ref.fProcessAODCheck),
   fProfileContainingMaterialBudgetWeights(ref.fProfileContainingMaterialBudgetWeights),
-  fMaterialBudgetWeightsInitialized(ref.fMaterialBudgetWeightsInitialized)
+  fMaterialBudgetWeightsInitialized(ref.fMaterialBudgetWeightsInitialized),
+  fNPhotonCutSteps(-1)
 {
   // Copy Constructor
   for(Int_t jj=0;jj<kNCuts;jj++){fCuts[jj]=ref.fCuts[jj];}
@@ -784,130 +786,121 @@ Bool_t AliConversionPhotonCuts::PhotonIsSelectedAODMC(AliAODMCParticle *particle
   return kFALSE;
 }
 
+///________________________________________________________________________
+void AliConversionPhotonCuts::CompilePhotonCuts(){
+  // Translates the decoded cut settings into the ordered list of steps evaluated in PhotonCuts.
+  // Steps which cannot reject a photon with the current settings are left out:
+  //   - Qt, asymmetry and photon quality selection when switched off
+  //   - PID probability when both thresholds are <= 0 (probabilities are non-negative)
+  //   - corrected TPC cluster cut when the minimum ratio is <= 0 (ratios are non-negative)
+
+  fNPhotonCutSteps = 0;
+  if(fDoQtGammaSelection) fPhotonCutSteps[fNPhotonCutSteps++] = kStepQt;
+  fPhotonCutSteps[fNPhotonCutSteps++] = kStepChi2;
+  fPhotonCutSteps[fNPhotonCutSteps++] = kStepAcceptance;
+  if(fDoPhotonAsymmetryCut) fPhotonCutSteps[fNPhotonCutSteps++] = kStepAsymmetry;
+  if(fPIDProbabilityCutNegativeParticle > 0 || fPIDProbabilityCutPositiveParticle > 0) fPhotonCutSteps[fNPhotonCutSteps++] = kStepPIDProbability;
+  if(fMinClsTPCToF > 0) fPhotonCutSteps[fNPhotonCutSteps++] = kStepCorrectedTPCCluster;
+  fPhotonCutSteps[fNPhotonCutSteps++] = kStepPsiPair;
+  fPhotonCutSteps[fNPhotonCutSteps++] = kStepCosPAngle;
+  fPhotonCutSteps[fNPhotonCutSteps++] = kStepDCAPrimVtx;
+  if(fDoPhotonQualitySelectionCut) fPhotonCutSteps[fNPhotonCutSteps++] = kStepPhotonQuality;
+}
+
 ///________________________________________________________________________
 Bool_t AliConversionPhotonCuts::PhotonCuts(AliConversionPhotonBase *photon,AliVEvent *event){   // Specific Photon Cuts
 
-  Int_t cutIndex = 0;
-  if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt());
-  cutIndex++;
+  if(fNPhotonCutSteps < 0) CompilePhotonCuts();
+
+  if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(0., photon->GetPhotonPt());
 
   // Fill Histos before Cuts
   if(fHistoInvMassbefore)fHistoInvMassbefore->Fill(photon->GetMass());
   if(fHistoArmenterosbefore)fHistoArmenterosbefore->Fill(photon->GetArmenterosAlpha(),photon->GetArmenterosQt());
 
-  // Gamma selection based on QT from Armenteros
-  if(fDoQtGammaSelection == kTRUE){
-    if(!ArmenterosQtCut(photon)){
-      if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //1
-      return kFALSE;
-    }
-  }
-  cutIndex++; //2
-
-  // Chi Cut
-  if(photon->GetChi2perNDF() > fChi2CutConversion || photon->GetChi2perNDF() <=0){
-    {
-      if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //2
-      return kFALSE;
-    }
-  }
-  cutIndex++;//3
-
-  // Reconstruction Acceptance Cuts
-  if(!AcceptanceCuts(photon)){
-    if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //3
-    return kFALSE;
-  }
-
-  cutIndex++; //4
-  // Asymmetry Cut
-  if(fDoPhotonAsymmetryCut == kTRUE){
-    if(!AsymmetryCut(photon,event)){
-      if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //4
-      return kFALSE;
-    }
-  }
-
-  //Check the pid probability
-  cutIndex++; //5
-  if(!PIDProbabilityCut(photon, event)) {
-    if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //5
-    return kFALSE;
-  }
-
-  cutIndex++; //6
-  if(!CorrectedTPCClusterCut(photon, event)) {
-    if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //6
-    return kFALSE;
-  }
-
-  Double_t magField = event->GetMagneticField();
-  if( magField  < 0.0 ){
-    magField =  1.0;
-  } else {
-    magField =  -1.0;
-  }
-  
-  AliVTrack * electronCandidate = GetTrack(event,photon->GetTrackLabelNegative());
-  AliVTrack * positronCandidate = GetTrack(event,photon->GetTrackLabelPositive());
-  Double_t deltaPhi = magField * TVector2::Phi_mpi_pi( electronCandidate->Phi()-positronCandidate->Phi());
-
-  cutIndex++; //7
-  if(!PsiPairCut(photon)) {
-    if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //7
-    return kFALSE;
-  }
-
-  cutIndex++; //8
-  if(!CosinePAngleCut(photon, event)) {
-    if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //8
-    return kFALSE;
-  }
-
   AliAODConversionPhoton* photonAOD = dynamic_cast<AliAODConversionPhoton*>(photon);
-  if (photonAOD){
-    photonAOD->CalculateDistanceOfClossetApproachToPrimVtx(event->GetPrimaryVertex());
 
-    cutIndex++; //9
-    if(photonAOD->GetDCArToPrimVtx() > fDCARPrimVtxCut) { //DCA R cut of photon to primary vertex
-      if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //9
-      return kFALSE;
+  for(Int_t iStep = 0; iStep < fNPhotonCutSteps; iStep++){
+    Int_t cutIndex = fPhotonCutSteps[iStep];
+    Bool_t passed = kTRUE;
+    switch(cutIndex){
+      case kStepQt:                   // Gamma selection based on QT from Armenteros
+        passed = ArmenterosQtCut(photon);
+        break;
+      case kStepChi2:                 // Chi Cut
+        passed = !(photon->GetChi2perNDF() > fChi2CutConversion || photon->GetChi2perNDF() <=0);
+        break;
+      case kStepAcceptance:           // Reconstruction Acceptance Cuts
+        passed = AcceptanceCuts(photon);
+        break;
+      case kStepAsymmetry:            // Asymmetry Cut
+        passed = AsymmetryCut(photon,event);
+        break;
+      case kStepPIDProbability:       //Check the pid probability
+        passed = PIDProbabilityCut(photon, event);
+        break;
+      case kStepCorrectedTPCCluster:
+        passed = CorrectedTPCClusterCut(photon, event);
+        break;
+      case kStepPsiPair:
+        passed = PsiPairCut(photon);
+        break;
+      case kStepCosPAngle:
+        passed = CosinePAngleCut(photon, event);
+        break;
+      case kStepDCAPrimVtx:           // DCA R and Z cut of photon to primary vertex (AOD photons only)
+        if (photonAOD){
+          photonAOD->CalculateDistanceOfClossetApproachToPrimVtx(event->GetPrimaryVertex());
+          if(photonAOD->GetDCArToPrimVtx() > fDCARPrimVtxCut) { //DCA R cut of photon to primary vertex
+            passed = kFALSE;
+          } else if(TMath::Abs(photonAOD->GetDCAzToPrimVtx()) > fDCAZPrimVtxCut) { //DCA Z cut of photon to primary vertex
+            cutIndex++;
+            passed = kFALSE;
+          }
+        }
+        break;
+      case kStepPhotonQuality:
+        if (photonAOD){
+          UChar_t photonQuality = 0;
+          AliAODEvent * aodEvent = dynamic_cast<AliAODEvent*>(event);
+          if(aodEvent) {
+            photonQuality = DeterminePhotonQualityAOD(photonAOD, event);
+          } else {
+            photonQuality = photonAOD->GetPhotonQuality();
+          }
+          passed = (photonQuality == fPhotonQualityCut);
+        }
+        break;
     }
-
-    cutIndex++; //10
-    if(TMath::Abs(photonAOD->GetDCAzToPrimVtx()) > fDCAZPrimVtxCut) { //DCA Z cut of photon to primary vertex
-      if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //10
+    if(!passed){
+      if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt());
       return kFALSE;
     }
-  } else {
-    cutIndex++; //9
-    cutIndex++; //10
   }
-  cutIndex++; //11
 
-  if (photonAOD){
-    UChar_t photonQuality = 0;
-      AliAODEvent * aodEvent = dynamic_cast<AliAODEvent*>(event);
-      if(aodEvent) {
-        photonQuality = DeterminePhotonQualityAOD(photonAOD, event);
-      } else {
-        photonQuality = photonAOD->GetPhotonQuality();
-      }	
-      if (fDoPhotonQualitySelectionCut && photonQuality != fPhotonQualityCut){
-        if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //11
-        return kFALSE;
-      }	
-  } 
-  cutIndex++; //12
-  if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(cutIndex, photon->GetPhotonPt()); //11
+  if(fHistoPhotonCuts)fHistoPhotonCuts->Fill(kStepPhotonQuality+1, photon->GetPhotonPt()); //12
 
   // Histos after Cuts
   if(fHistoInvMassafter)fHistoInvMassafter->Fill(photon->GetMass());
   if(fHistoArmenterosafter)fHistoArmenterosafter->Fill(photon->GetArmenterosAlpha(),photon->GetArmenterosQt());
-  if(fHistoPsiPairDeltaPhiafter)fHistoPsiPairDeltaPhiafter->Fill(deltaPhi,photon->GetPsiPair());
   if(fHistoKappaafter)fHistoKappaafter->Fill(photon->GetPhotonPt(), GetKappaTPC(photon, event));
-  if(fHistoAsymmetryafter){
-    if(photon->GetPhotonP()!=0 && electronCandidate->P()!=0)fHistoAsymmetryafter->Fill(photon->GetPhotonP(),electronCandidate->P()/photon->GetPhotonP());
+  if(fHistoPsiPairDeltaPhiafter || fHistoAsymmetryafter){
+    // the tracks are only needed for the QA histograms
+    AliVTrack * electronCandidate = GetTrack(event,photon->GetTrackLabelNegative());
+    AliVTrack * positronCandidate = GetTrack(event,photon->GetTrackLabelPositive());
+    if(fHistoPsiPairDeltaPhiafter){
+      Double_t magField = event->GetMagneticField();
+      if( magField  < 0.0 ){
+        magField =  1.0;
+      } else {
+        magField =  -1.0;
+      }
+      Double_t deltaPhi = magField * TVector2::Phi_mpi_pi( electronCandidate->Phi()-positronCandidate->Phi());
+      fHistoPsiPairDeltaPhiafter->Fill(deltaPhi,photon->GetPsiPair());
+    }
+    if(fHistoAsymmetryafter){
+      if(photon->GetPhotonP()!=0 && electronCandidate->P()!=0)fHistoAsymmetryafter->Fill(photon->GetPhotonP(),electronCandidate->P()/photon->GetPhotonP());
+    }
   }
   return kTRUE;
 
@@ -1593,6 +1586,8 @@ Bool_t AliConversionPhotonCuts::AcceptanceCut(TParticle *particle, TParticle * e
 Bool_t AliConversionPhotonCuts::UpdateCutString() {
   ///Update the cut string (if it has been created yet)
 
+  fNPhotonCutSteps = -1; // the photon selection has to be compiled again
+
   if(fCutString && fCutString->GetString().Length() == kNCuts) {
     fCutString->SetString(GetCutNumber());
   } else {
@@ -84,6 +84,22 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
         kPhotonOut
     };
 
+    // steps of the compiled photon specific selection (see CompilePhotonCuts), the value is the 
+    // bin of the step in fHistoPhotonCuts
+    enum photonCutSteps {
+        kStepQt=1,
+        kStepChi2,
+        kStepAcceptance,
+        kStepAsymmetry,
+        kStepPIDProbability,
+        kStepCorrectedTPCCluster,
+        kStepPsiPair,
+        kStepCosPAngle,
+        kStepDCAPrimVtx,            // fills bin 9 (DCA R) or 10 (DCA z)
+        kStepPhotonQuality=11,
+        kNPhotonCutSteps=10         // number of different steps
+    };
+
 
     Bool_t SetCutIds(TString cutString); 
     Int_t fCuts[kNCuts];
@@ -160,6 +176,7 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
       else return kFALSE;
     }
     Bool_t PhotonCuts(AliConversionPhotonBase *photon,AliVEvent *event);
+    void CompilePhotonCuts();
     Bool_t CorrectedTPCClusterCut(AliConversionPhotonBase *photon, AliVEvent * event);
     Bool_t PsiPairCut(const AliConversionPhotonBase * photon) const;
     Bool_t CosinePAngleCut(const AliConversionPhotonBase * photon, AliVEvent * event) const;
@@ -344,10 +361,12 @@ class AliConversionPhotonCuts : public AliAnalysisCuts {
     Bool_t            fPreSelCut;                           // Flag for preselection cut used in V0Reader
     Bool_t            fProcessAODCheck;                     // Flag for processing check for AOD to be contained in AliAODs.root and AliAODGammaConversion.root
     TProfile*         fProfileContainingMaterialBudgetWeights;      
+    Int_t             fNPhotonCutSteps;                     //! number of active steps of the photon specific selection, -1: not compiled
+    Int_t             fPhotonCutSteps[kNPhotonCutSteps];    //! active steps of the photon specific selection in order of evaluation
 
   private:
   
-    ClassDef(AliConversionPhotonCuts,13)
+    ClassDef(AliConversionPhotonCuts,14)
 };
 
 #endif
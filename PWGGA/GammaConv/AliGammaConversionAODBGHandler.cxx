@@ -44,7 +44,9 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler() :
 	fBinLimitsArrayMultiplicity(NULL),
 	fBGEvents(),
 	fBGEventsENeg(),
-	fBGEventsMeson()
+	fBGEventsMeson(),
+	fUseCompactPhotonPool(kFALSE),
+	fBGPhotonRecords()
 {
 	// constructor
 }
@@ -64,7 +66,9 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(Int_t binsZ,Int_t
 	fBinLimitsArrayMultiplicity(NULL),
 	fBGEvents(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsENeg(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
-	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents)))
+	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents))),
+	fUseCompactPhotonPool(kFALSE),
+	fBGPhotonRecords()
 {
 	// constructor
 }
@@ -86,7 +90,9 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(Int_t collisionSy
 	fBinLimitsArrayMultiplicity(NULL),
 	fBGEvents(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsENeg(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
-	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents)))
+	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents))),
+	fUseCompactPhotonPool(kFALSE),
+	fBGPhotonRecords()
 {
 	// constructor
     if(fNBinsZ>8) fNBinsZ = 8;
@@ -357,7 +363,9 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(const AliGammaCon
 	fBinLimitsArrayMultiplicity(original.fBinLimitsArrayMultiplicity),
 	fBGEvents(original.fBGEvents),
 	fBGEventsENeg(original.fBGEventsENeg),
-	fBGEventsMeson(original.fBGEventsMeson)
+	fBGEventsMeson(original.fBGEventsMeson),
+	fUseCompactPhotonPool(original.fUseCompactPhotonPool),
+	fBGPhotonRecords(original.fBGPhotonRecords)
 {
 	//copy constructor	
 }
@@ -583,6 +591,29 @@ void AliGammaConversionAODBGHandler::AddEvent(TList* const eventGammas,Double_t
 	fBGEventVertex[z][m][eventCounter].fZ = zvalue;
 	fBGEventVertex[z][m][eventCounter].fEP = epvalue;
 
+	if(fUseCompactPhotonPool){
+		// overwrite the records of the oldest event in place, the slot keeps its capacity
+		AliGammaConversionPhotonRecordVector &records = fBGPhotonRecords[(z*fNBinsMultiplicity+m)*fNEvents+eventCounter];
+		records.resize(eventGammas->GetEntries());
+		for(Int_t i=0; i< eventGammas->GetEntries();i++){
+			AliAODConversionPhoton *gamma = (AliAODConversionPhoton*)(eventGammas->At(i));
+			GammaConversionPhotonRecord &record = records[i];
+			record.fPx = gamma->Px();
+			record.fPy = gamma->Py();
+			record.fPz = gamma->Pz();
+			record.fE = gamma->E();
+			record.fConversionPoint[0] = gamma->GetConversionX();
+			record.fConversionPoint[1] = gamma->GetConversionY();
+			record.fConversionPoint[2] = gamma->GetConversionZ();
+			record.fLabel[0] = gamma->GetTrackLabelPositive();
+			record.fLabel[1] = gamma->GetTrackLabelNegative();
+			record.fV0Index = gamma->GetV0Index();
+			record.fQuality = gamma->GetPhotonQuality();
+		}
+		fBGEventCounter[z][m]++;
+		return;
+	}
+
 	//first clear the vector
 	// cout<<"Size of vector: "<<fBGEvents[z][m][eventCounter].size()<<endl;
 	//  cout<<"Checking the entries: Z="<<z<<", M="<<m<<", eventCounter="<<eventCounter<<endl;
@@ -620,7 +651,7 @@ void AliGammaConversionAODBGHandler::AddMesonEvent(TList* const eventMothers, Do
 	fBGEventVertex[z][m][eventCounter].fEP = epvalue;
 
 	//first clear the vector
-    for(Int_t d=0;d<fBGEvents[z][m][eventCounter].size();d++){
+    for(Int_t d=0;d<fBGEventsMeson[z][m][eventCounter].size();d++){
 		delete (AliAODConversionMother*)(fBGEventsMeson[z][m][eventCounter][d]);
 	}
 	fBGEventsMeson[z][m][eventCounter].clear();
@@ -669,6 +700,28 @@ AliGammaConversionAODVector* AliGammaConversionAODBGHandler::GetBGGoodV0s(Int_t
 	return &(fBGEvents[zbin][mbin][event]);
 }
 
+//_____________________________________________________________________________________________________________________________
+void AliGammaConversionAODBGHandler::SetUseCompactPhotonPool(Bool_t useCompact){
+	// switch AddEvent to photon records, one ring slot per (z, multiplicity, event)
+	fUseCompactPhotonPool = useCompact;
+	if(fUseCompactPhotonPool){
+		fBGPhotonRecords.assign(fNBinsZ*fNBinsMultiplicity*fNEvents,AliGammaConversionPhotonRecordVector());
+	} else {
+		fBGPhotonRecords.clear();
+	}
+}
+
+//_____________________________________________________________________________________________________________________________
+void AliGammaConversionAODBGHandler::FillPhotonFromRecord(const GammaConversionPhotonRecord &record, AliAODConversionPhoton *photon){
+	// set the kinematics, conversion point, labels and quality of a (reused) photon from a pool record
+	photon->SetPxPyPzE(record.fPx,record.fPy,record.fPz,record.fE);
+	Double_t conversionPoint[3] = {record.fConversionPoint[0],record.fConversionPoint[1],record.fConversionPoint[2]};
+	photon->SetConversionPoint(conversionPoint);
+	photon->SetTrackLabels(record.fLabel[0],record.fLabel[1]);
+	photon->SetV0Index(record.fV0Index);
+	photon->SetPhotonQuality(record.fQuality);
+}
+
 //_____________________________________________________________________________________________________________________________
 AliGammaConversionMotherAODVector* AliGammaConversionAODBGHandler::GetBGGoodMesons(Int_t zbin, Int_t mbin, Int_t event){
 	//see headerfile for documentation
@@ -40,6 +40,21 @@ class AliGammaConversionAODBGHandler : public TObject {
 	
 	typedef struct GammaConversionVertex GammaConversionVertex; 																//!
 
+	// compact copy of a photon in the mixing pool: everything the meson background needs
+	struct GammaConversionPhotonRecord{
+		Double_t fPx;
+		Double_t fPy;
+		Double_t fPz;
+		Double_t fE;
+		Double_t fConversionPoint[3];
+		Int_t fLabel[2];
+		Int_t fV0Index;
+		UChar_t fQuality;
+	};
+
+	typedef struct GammaConversionPhotonRecord GammaConversionPhotonRecord; 													//!
+	typedef vector<GammaConversionPhotonRecord> AliGammaConversionPhotonRecordVector;
+
 	typedef vector<AliGammaConversionAODVector> AliGammaConversionBGEventVector;
 	typedef vector<AliGammaConversionBGEventVector> AliGammaConversionMultipicityVector;
 	typedef vector<AliGammaConversionMultipicityVector> AliGammaConversionBGVector;
@@ -69,6 +84,11 @@ class AliGammaConversionAODBGHandler : public TObject {
 
 	// Get BG photons
 	AliGammaConversionAODVector* GetBGGoodV0s(Int_t zbin, Int_t mbin, Int_t event);
+	// Compact photon pool: AddEvent stores photon records instead of full copies, read them with GetBGGoodV0Records
+	void SetUseCompactPhotonPool(Bool_t useCompact = kTRUE);
+	Bool_t GetUseCompactPhotonPool() const {return fUseCompactPhotonPool;}
+	AliGammaConversionPhotonRecordVector* GetBGGoodV0Records(Int_t zbin, Int_t mbin, Int_t event){return &fBGPhotonRecords[(zbin*fNBinsMultiplicity+mbin)*fNEvents+event];}
+	static void FillPhotonFromRecord(const GammaConversionPhotonRecord &record, AliAODConversionPhoton *photon);
 	// Get BG mesons
 	AliGammaConversionMotherAODVector* GetBGGoodMesons(Int_t zbin, Int_t mbin, Int_t event);
 	// Get BG electron
@@ -95,7 +115,9 @@ class AliGammaConversionAODBGHandler : public TObject {
 		AliGammaConversionBGVector 			fBGEvents; 						// photon background events
 		AliGammaConversionBGVector 			fBGEventsENeg; 					// electron background electron events
 		AliGammaConversionMotherBGVector 	fBGEventsMeson; 				// neutral meson background events
+		Bool_t								fUseCompactPhotonPool;			// store photon records instead of photon copies
+		vector<AliGammaConversionPhotonRecordVector> fBGPhotonRecords;		//! photon record ring buffers, [(z*fNBinsMultiplicity+m)*fNEvents+event]
 		
-	ClassDef(AliGammaConversionAODBGHandler,5)
+	ClassDef(AliGammaConversionAODBGHandler,6)
 };
 #endif
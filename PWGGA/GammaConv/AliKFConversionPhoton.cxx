@@ -65,6 +65,20 @@ AliConversionPhotonBase()
 }
 
 
+AliKFConversionPhoton::AliKFConversionPhoton(const AliKFParticle &fCurrentPairKFParticle,const AliKFParticle &fCurrentNegativeKFParticle,const AliKFParticle &fCurrentPositiveKFParticle) :
+AliKFParticle(fCurrentPairKFParticle),
+AliConversionPhotonBase()
+{
+    // Same as the constructor from the two daughters, without redoing the
+    // combination when the pair is already available
+    SetArmenterosQtAlpha(fArmenteros,fCurrentNegativeKFParticle,fCurrentPositiveKFParticle);
+
+    if(GetNDF())fChi2perNDF=GetChi2()/GetNDF();
+    else{fChi2perNDF=-1;}
+
+}
+
+
 AliKFConversionPhoton::AliKFConversionPhoton(const AliKFConversionPhoton & original) :
 AliKFParticle(original),
 AliConversionPhotonBase(original)
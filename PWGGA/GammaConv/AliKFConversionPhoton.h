@@ -33,6 +33,8 @@ class AliKFConversionPhoton : public AliKFParticle, public AliConversionPhotonBa
   AliKFConversionPhoton(AliKFParticle &kfparticle);
 //   AliKFConversionPhoton(AliV0Reader *fV0Reader);
   AliKFConversionPhoton(const AliKFParticle &fCurrentNegativeKFParticle,const AliKFParticle &fCurrentPositiveKFParticle);
+  // from the already combined pair of the two daughters
+  AliKFConversionPhoton(const AliKFParticle &fCurrentPairKFParticle,const AliKFParticle &fCurrentNegativeKFParticle,const AliKFParticle &fCurrentPositiveKFParticle);
 
   //Copy Constructor
   AliKFConversionPhoton(const AliKFConversionPhoton & g);           
@@ -36,6 +36,7 @@
 #include "TObjArray.h"
 #include "AliVTrack.h"
 #include "AliKFParticle.h"
+#include "AliV0Table.h"
 
 class iostream;
 
@@ -138,6 +139,9 @@ Bool_t AliV0ReaderStrange::ProcessEvent(AliVEvent *inputEvent,AliMCEvent *mcEven
   // Set Magnetic Field
   AliKFParticle::SetField(fInputEvent->GetMagneticField());
 
+  // V0 topology of the event, shared with the other strangeness wagons
+  AliV0Table::Instance()->Update(fInputEvent);
+
   if(fInputEvent->IsA()==AliESDEvent::Class()){
     ProcessESDV0s();
   }
@@ -189,7 +193,7 @@ AliV0ParticleStrange *AliV0ReaderStrange::ReconstructV0(AliESDEvent *fESDEvent,
 //       Double_t lV0CosineOfPointingAngle = fCurrentV0->GetV0CosineOfPointingAngle();
 //       GetV0CosineOfPointingAngle(lBestPrimaryVtxPos[0],lBestPrimaryVtxPos[1],lBestPrimaryVtxPos[2]);
  
-    if(fCurrentV0->GetV0CosineOfPointingAngle() < 0.98) return 0x0;
+    if(AliV0Table::Instance()->GetCosPointingAngle(currentV0Index) < 0.98) return 0x0;
   
     AliVTrack * pos = (AliVTrack*)fESDEvent->GetTrack(fCurrentV0->GetPindex());
     AliVTrack * neg = (AliVTrack*)fESDEvent->GetTrack(fCurrentV0->GetNindex());
@@ -319,8 +323,7 @@ AliV0ParticleStrange *AliV0ReaderStrange::ReconstructV0(AliAODEvent *fAODEvent,
 //       Double_t lV0CosineOfPointingAngle = fCurrentV0->GetV0CosineOfPointingAngle();
 //       GetV0CosineOfPointingAngle(lBestPrimaryVtxPos[0],lBestPrimaryVtxPos[1],lBestPrimaryVtxPos[2]);
  
-    AliAODVertex *vertex = fAODEvent->GetPrimaryVertex();
-    if(fCurrentV0->CosPointingAngle(vertex) < 0.98) return 0x0;
+    if(AliV0Table::Instance()->GetCosPointingAngle(currentV0Index) < 0.98) return 0x0;
     
     AliVTrack* pos = (AliVTrack*)fCurrentV0->GetDaughter(0);
     AliVTrack* neg = (AliVTrack*)fCurrentV0->GetDaughter(1);
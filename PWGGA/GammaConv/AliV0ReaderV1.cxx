@@ -143,7 +143,10 @@ AliV0ReaderV1::AliV0ReaderV1(const char *name) : AliAnalysisTaskSE(name),
   fHistoRdiff(NULL),
   fHistoImpactParameterStudy(NULL),
   fImpactParamTree(NULL),
-  fVectorFoundGammas(0)
+  fVectorFoundGammas(0),
+  fRegisteredPhotonCuts(),
+  fPhotonCutsEvaluated(),
+  fPhotonCutsPassed()
 {
   // Default constructor
 
@@ -570,6 +573,8 @@ Bool_t AliV0ReaderV1::ProcessEvent(AliVEvent *inputEvent,AliMCEvent *mcEvent)
 
   //Reset the TClonesArray
   fConversionGammas->Delete();
+  fPhotonCutsEvaluated.clear();
+  fPhotonCutsPassed.clear();
 
   fInputEvent=inputEvent;
   fMCEvent=mcEvent;
@@ -609,8 +614,53 @@ Bool_t AliV0ReaderV1::ProcessEvent(AliVEvent *inputEvent,AliMCEvent *mcEvent)
     GetAODConversionGammas();
   }
 
+  // no photon selection of the registered cut sets has been evaluated yet
+  fPhotonCutsEvaluated.assign(fConversionGammas->GetEntriesFast(),0);
+  fPhotonCutsPassed.assign(fConversionGammas->GetEntriesFast(),0);
+
   return kTRUE;
 }
+
+///________________________________________________________________________
+Int_t AliV0ReaderV1::RegisterPhotonCuts(AliConversionPhotonCuts *cuts)
+{
+  // Registers a photon cut set for the shared selection and returns its index for IsPhotonSelected.
+  // Cut sets with the same cut string share one index, the decision is then taken by the cut object
+  // registered first (only this object fills its cut histograms). Returns -1 if the cut set cannot
+  // be registered, the caller then has to apply the cuts itself.
+
+  if(!cuts) return -1;
+  TString cutNumber = cuts->GetCutNumber();
+  for(Int_t i = 0; i < fRegisteredPhotonCuts.GetEntriesFast(); i++){
+    if(((AliConversionPhotonCuts*)fRegisteredPhotonCuts.At(i))->GetCutNumber().CompareTo(cutNumber) == 0) return i;
+  }
+  if(fRegisteredPhotonCuts.GetEntriesFast() >= 64){
+    AliWarning(Form("Too many photon cut sets registered, %s is not shared",cutNumber.Data()));
+    return -1;
+  }
+  fRegisteredPhotonCuts.Add(cuts);
+  AliInfo(Form("Registered photon cut set %s as shared selection %d",cutNumber.Data(),fRegisteredPhotonCuts.GetEntriesFast()-1));
+  return fRegisteredPhotonCuts.GetEntriesFast()-1;
+}
+
+///________________________________________________________________________
+Bool_t AliV0ReaderV1::IsPhotonSelected(Int_t iGamma, Int_t iCutSelection)
+{
+  // Decision of the registered cut set iCutSelection for the reconstructed photon iGamma of the current event,
+  // the cuts are evaluated on the first request and the result is kept until the next event
+
+  if(iCutSelection < 0 || iCutSelection >= fRegisteredPhotonCuts.GetEntriesFast()) return kFALSE;
+  if(iGamma < 0 || iGamma >= (Int_t)fPhotonCutsEvaluated.size()) return kFALSE;
+
+  const ULong64_t bit = (ULong64_t)1 << iCutSelection;
+  if(!(fPhotonCutsEvaluated[iGamma] & bit)){
+    AliConversionPhotonBase *photon = dynamic_cast<AliConversionPhotonBase*>(fConversionGammas->At(iGamma));
+    if(photon && ((AliConversionPhotonCuts*)fRegisteredPhotonCuts.At(iCutSelection))->PhotonIsSelected(photon,fInputEvent))
+      fPhotonCutsPassed[iGamma] |= bit;
+    fPhotonCutsEvaluated[iGamma] |= bit;
+  }
+  return (fPhotonCutsPassed[iGamma] & bit) != 0;
+}
 ///________________________________________________________________________
 void AliV0ReaderV1::FillAODOutput()
 {
@@ -777,12 +827,15 @@ AliKFConversionPhoton *AliV0ReaderV1::ReconstructV0(AliESDv0 *fCurrentV0,Int_t c
   //    cout << currentTrackLabels[0] << "\t" << currentTrackLabels[1] << endl;
   //    cout << "construct gamma " <<fUseConstructGamma << endl;
 
+  // Unconstrained pair, for the invariant mass and the photon without ConstructGamma
+  AliKFParticle fCurrentMotherKFForMass(fCurrentNegativeKFParticle,fCurrentPositiveKFParticle);
+
   // Reconstruct Gamma
   if(fUseConstructGamma){
     fCurrentMotherKF = new AliKFConversionPhoton();
     fCurrentMotherKF->ConstructGamma(fCurrentNegativeKFParticle,fCurrentPositiveKFParticle);
   }else{
-    fCurrentMotherKF = new AliKFConversionPhoton(fCurrentNegativeKFParticle,fCurrentPositiveKFParticle);
+    fCurrentMotherKF = new AliKFConversionPhoton(fCurrentMotherKFForMass,fCurrentNegativeKFParticle,fCurrentPositiveKFParticle);
     fCurrentMotherKF->SetMassConstraint(0,0.0001);
   }
 
@@ -853,7 +906,6 @@ AliKFConversionPhoton *AliV0ReaderV1::ReconstructV0(AliESDv0 *fCurrentV0,Int_t c
 
   // Calculating invariant mass
   Double_t mass=-99.0, mass_width=-99.0, Pt=-99.0, Pt_width=-99.0;
-  AliKFParticle fCurrentMotherKFForMass(fCurrentNegativeKFParticle,fCurrentPositiveKFParticle);
   fCurrentMotherKFForMass.GetMass(mass,mass_width);
   fCurrentMotherKFForMass.GetPt(Pt,Pt_width);
   fCurrentInvMassPair=mass;
@@ -17,6 +17,7 @@
 #include "TF1.h"
 #include "TRandom3.h"
 #include "AliAnalysisManager.h"
+#include "TObjArray.h"
 
 class AliConversionPhotonBase;
 class TRandom3;
@@ -112,6 +113,12 @@ class AliV0ReaderV1 : public AliAnalysisTaskSE {
     Bool_t             CheckVectorOnly(vector<Int_t> &vec, Int_t tobechecked);
     Bool_t             CheckVectorForDoubleCount(vector<Int_t> &vec, Int_t tobechecked);
 
+    // Photon selections shared between tasks: cut sets registered here are evaluated at most once per
+    // candidate and event, tasks with the same cut string reuse the decision instead of re-running the cuts
+    Int_t              RegisterPhotonCuts(AliConversionPhotonCuts *cuts);
+    Int_t              GetNRegisteredPhotonCuts()                       {return fRegisteredPhotonCuts.GetEntriesFast();}
+    Bool_t             IsPhotonSelected(Int_t iGamma, Int_t iCutSelection);
+
 
   protected:
     // Reconstruct Gammas
@@ -199,12 +206,15 @@ class AliV0ReaderV1 : public AliAnalysisTaskSE {
     TTree         *fImpactParamTree;               // tree with y, pt and conversion radius 
    
     vector<Int_t>  fVectorFoundGammas;            // vector with found MC labels of gammas
+    TObjArray      fRegisteredPhotonCuts;         //! photon cut sets registered by the tasks (not owned), index = bit in the masks below
+    vector<ULong64_t> fPhotonCutsEvaluated;       //! per candidate: bit i set if cut set i has been evaluated in this event
+    vector<ULong64_t> fPhotonCutsPassed;          //! per candidate: bit i set if the candidate passed cut set i
 
   private:
     AliV0ReaderV1(AliV0ReaderV1 &original);
     AliV0ReaderV1 &operator=(const AliV0ReaderV1 &ref);
 
-    ClassDef(AliV0ReaderV1, 12)
+    ClassDef(AliV0ReaderV1, 13)
 
 };
 
@@ -35,6 +35,7 @@
 #include "AliAnalysisTaskSE.h"
 #include "AliAnalysisTaskPi0.h"
 #include "AliCaloPhoton.h"
+#include "AliCaloPhotonPool.h"
 #include "AliPHOSGeometry.h"
 #include "AliESDEvent.h"
 #include "AliESDCaloCells.h"
@@ -56,6 +57,7 @@ AliAnalysisTaskPi0::AliAnalysisTaskPi0(const char *name)
 : AliAnalysisTaskSE(name),
   fESDtrackCuts(0),
   fOutputContainer(0),
+  fPHOSPool(0),
   fPHOSEvent(0),
   fnCINT1B(0),
   fnCINT1A(0),
@@ -67,12 +69,6 @@ AliAnalysisTaskPi0::AliAnalysisTaskPi0(const char *name)
   fTriggerAnalysis(new AliTriggerAnalysis)
 {
   // Constructor
-  Int_t nBin=10 ;
-  for(Int_t i=0;i<nBin;i++){
-    for(Int_t j=0;j<2;j++)
-      fPHOSEvents[i][j]=0 ;
-  }
-  
   // Output slots #0 write into a TH1 container
   DefineOutput(1,TList::Class());
 
@@ -105,6 +101,10 @@ void AliAnalysisTaskPi0::UserCreateOutputObjects()
   fOutputContainer = new THashList();
   fOutputContainer->SetOwner(kTRUE);
 
+  // Mixing pool, 10 vertex x 2 centrality bins, 100 events per bin
+  if(!fPHOSPool)
+    fPHOSPool = new AliCaloPhotonPool(20,100) ;
+
   fOutputContainer->Add(new TH1I("hCellMultEvent"  ,"PHOS cell multiplicity per event"    ,2000,0,2000));
   fOutputContainer->Add(new TH1I("hCellMultEventM1","PHOS cell multiplicity per event, M1",2000,0,2000));
   fOutputContainer->Add(new TH1I("hCellMultEventM2","PHOS cell multiplicity per event, M2",2000,0,2000));
@@ -435,8 +435,7 @@ void AliAnalysisTaskPi0::UserExec(Option_t *)
 
   Int_t centr=0 ;
   //always zero centrality
-  if(!fPHOSEvents[zvtx][centr]) fPHOSEvents[zvtx][centr]=new TList() ;
-  TList * prevPHOS = fPHOSEvents[zvtx][centr] ;
+  Int_t mixBin = zvtx*2+centr ;
 
   if(trackMult<=2)
     centr=0 ;
@@ -821,25 +820,29 @@ void AliAnalysisTaskPi0::UserExec(Option_t *)
   } // end of loop i1
   
   //now mixed
+  //pair kinematics of each photon with a whole pool event at once
+  AliCaloPhotonPool::Photon phRec ;
   for (Int_t i1=0; i1<inPHOS; i1++) {
     AliCaloPhoton * ph1=(AliCaloPhoton*)fPHOSEvent->At(i1) ;
-    for(Int_t ev=0; ev<prevPHOS->GetSize();ev++){
-      TClonesArray * mixPHOS = static_cast<TClonesArray*>(prevPHOS->At(ev)) ;
-      for(Int_t i2=0; i2<mixPHOS->GetEntriesFast();i2++){
-      AliCaloPhoton * ph2=(AliCaloPhoton*)mixPHOS->At(i2) ;
-      p12  = *ph1  + *ph2;
-      pv12 = *(ph1->GetMomV2()) + *(ph2->GetMomV2());
+    AliCaloPhotonPool::FillPhoton(ph1,phRec) ;
+    for(Int_t ev=0; ev<fPHOSPool->GetNEvents(mixBin);ev++){
+      const AliCaloPhotonPool::Photon * mixPHOS = fPHOSPool->GetPhotons(mixBin,ev) ;
+      Int_t nMix = fPHOSPool->PairKinematics(phRec,mixBin,ev) ;
+      for(Int_t i2=0; i2<nMix;i2++){
+      const AliCaloPhotonPool::Photon * ph2 = &mixPHOS[i2] ;
       Bool_t mainBC = (ph1->GetBC()==0 && ph2->GetBC()==0);
       Bool_t mainBC1= (ph1->GetBC()==0 || ph2->GetBC()==0);
       Bool_t diffBC = ((ph1->GetBC()==0 && ph2->GetBC()!=ph1->GetBC()) || 
 		       (ph2->GetBC()==0 && ph2->GetBC()!=ph1->GetBC()));
-      Double_t asym  = TMath::Abs((ph1->Energy()-ph2->Energy())/(ph1->Energy()+ph2->Energy()));
-      Double_t ma12 = p12.M();
-      Double_t pt12 = p12.Pt();
+      Double_t asym  = fPHOSPool->GetPairAsym(i2);
+      Double_t ma12 = fPHOSPool->GetPairMass(i2);
+      Double_t pt12 = fPHOSPool->GetPairPt(i2);
+      Double_t mv12 = fPHOSPool->GetPairMassV2(i2);
+      Double_t ptv12= fPHOSPool->GetPairPtV2(i2);
 
       if (ph1->GetNCells()>2 && ph2->GetNCells()>2) {
         FillHistogram("hMiMassPtA10",ma12 ,pt12 );
-        FillHistogram("hMiMassPtvA10",pv12.M(),pv12.Pt());
+        FillHistogram("hMiMassPtvA10",mv12,ptv12);
         FillHistogram("hMiMassPtCA10",ma12 ,pt12, centr+0.5);
         FillHistogram("hMiMassSingle_all",ma12,ph1->Pt()) ;
         FillHistogram("hMiMassSingle_all",ma12,ph2->Pt()) ;
@@ -887,7 +890,7 @@ void AliAnalysisTaskPi0::UserExec(Option_t *)
         }
         if (asym<0.7) {
           FillHistogram("hMiMassPtA07",ma12,pt12);
- 	  FillHistogram("hMiMassPtvA07",pv12.M(),pv12.Pt());
+ 	  FillHistogram("hMiMassPtvA07",mv12,ptv12);
 	  FillHistogram("hMiMassPtCA07",ma12 ,pt12, centr+0.5);
 	  if(!eventVtxExist)
 	    FillHistogram("hMiMassPtA07nvtx",ma12 ,pt12 );
@@ -950,15 +953,8 @@ void AliAnalysisTaskPi0::UserExec(Option_t *)
   
   //Now we either add current events to stack or remove
   //If no photons in current event - no need to add it to mixed
-  if(fPHOSEvent->GetEntriesFast()>0){
-    prevPHOS->AddFirst(fPHOSEvent) ;
-    fPHOSEvent=0;
-    if(prevPHOS->GetSize()>100){//Remove redundant events
-      TClonesArray * tmp = static_cast<TClonesArray*>(prevPHOS->Last()) ;
-      prevPHOS->RemoveLast() ;
-      delete tmp ;
-    }
-  }
+  if(fPHOSEvent->GetEntriesFast()>0)
+    fPHOSPool->AddEvent(mixBin,fPHOSEvent) ;
   // Post output data.
   PostData(1, fOutputContainer);
   fEventCounter++;
@@ -16,6 +16,7 @@ class TH3F;
 class AliESDtrackCuts;
 class AliPHOSGeometry;
 class AliTriggerAnalysis;
+class AliCaloPhotonPool;
 
 #include "TH2I.h"
 #include "AliAnalysisTaskSE.h"
@@ -55,7 +56,7 @@ private:
 private:
   AliESDtrackCuts *fESDtrackCuts; // Track cut
   TList * fOutputContainer;       //final histogram container
-  TList * fPHOSEvents[10][2] ;    //Container for PHOS photons
+  AliCaloPhotonPool * fPHOSPool ; //! PHOS photons of previous events per vertex and centrality bin, for mixing
   TClonesArray * fPHOSEvent ;     //PHOS photons in current event
  
   Int_t fnCINT1B;           // Number of CINT1B triggers
@@ -72,7 +73,7 @@ private:
   Int_t fEventCounter;         // number of analyzed events
   AliTriggerAnalysis *fTriggerAnalysis; //! Trigger Analysis for Normalisation
 
-  ClassDef(AliAnalysisTaskPi0, 3); // PHOS analysis task
+  ClassDef(AliAnalysisTaskPi0, 4); // PHOS analysis task
 };
 
 #endif
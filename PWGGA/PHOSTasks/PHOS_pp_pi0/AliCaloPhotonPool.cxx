@@ -0,0 +1,158 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+/* $Id$ */
+ 
+//_________________________________________________________________________
+// Pool of PHOS photons of previous events for mixed event backgrounds,
+// packed photon records and batched pair kinematics
+//
+
+#include "TClonesArray.h"
+#include "AliCaloPhoton.h"
+#include "AliCaloPhotonPool.h"
+ClassImp(AliCaloPhotonPool) 
+//===============================================
+AliCaloPhotonPool::AliCaloPhotonPool() :
+  TObject(),
+  fNBins(0),
+  fDepth(0),
+  fNEvents(),
+  fNext(),
+  fEvents(),
+  fPairMass(),
+  fPairPt(),
+  fPairMassV2(),
+  fPairPtV2(),
+  fPairAsym()
+{
+}
+//===============================================
+AliCaloPhotonPool::AliCaloPhotonPool(Int_t nBins, Int_t depth) :
+  TObject(),
+  fNBins(0),
+  fDepth(0),
+  fNEvents(),
+  fNext(),
+  fEvents(),
+  fPairMass(),
+  fPairPt(),
+  fPairMassV2(),
+  fPairPtV2(),
+  fPairAsym()
+{
+  Configure(nBins,depth) ;
+}
+//===============================================
+void AliCaloPhotonPool::Configure(Int_t nBins, Int_t depth)
+{
+  //Set the number of mixing bins and of events kept per bin, empty the pool
+  fNBins = nBins ;
+  fDepth = depth ;
+  fNEvents.Set(fNBins) ;
+  fNEvents.Reset() ;
+  fNext.Set(fNBins) ;
+  fNext.Reset() ;
+  fEvents.clear() ;
+  fEvents.resize(fNBins*fDepth) ;
+}
+//===============================================
+void AliCaloPhotonPool::FillPhoton(const AliCaloPhoton * ph, Photon & rec)
+{
+  //Pack the information of the photon used for the pairs
+  rec.fPx = ph->Px() ;
+  rec.fPy = ph->Py() ;
+  rec.fPz = ph->Pz() ;
+  rec.fE  = ph->E() ;
+  const TLorentzVector * v2 = ph->GetMomV2() ;
+  rec.fPxV2 = v2->Px() ;
+  rec.fPyV2 = v2->Py() ;
+  rec.fPzV2 = v2->Pz() ;
+  rec.fEV2  = v2->E() ;
+  rec.fZ      = ph->EMCz() ;
+  rec.fBC     = ph->GetBC() ;
+  rec.fNCells = ph->GetNCells() ;
+  rec.fModule = ph->Module() ;
+  rec.fPID    = 0 ;
+  if(ph->IsCPVOK())   rec.fPID |= kCPV ;
+  if(ph->IsCPV2OK())  rec.fPID |= kCPV2 ;
+  if(ph->IsDispOK())  rec.fPID |= kDisp ;
+  if(ph->IsDisp2OK()) rec.fPID |= kDisp2 ;
+  if(ph->IsTOFOK())   rec.fPID |= kTOF ;
+}
+//===============================================
+void AliCaloPhotonPool::AddEvent(Int_t bin, const TClonesArray * photons)
+{
+  //Copy the photons of this event in the bin, in place of the oldest event once the bin is full
+  if(bin<0 || bin>=fNBins) return ;
+  
+  Int_t slot = fNext[bin] ;
+  std::vector<Photon> & event = fEvents[bin*fDepth+slot] ;
+  
+  Int_t n = photons->GetEntriesFast() ;
+  event.resize(n) ;
+  for(Int_t i=0; i<n; i++)
+    FillPhoton(static_cast<const AliCaloPhoton*>(photons->At(i)),event[i]) ;
+  
+  fNext[bin] = (slot+1)%fDepth ;
+  if(fNEvents[bin]<fDepth) fNEvents[bin]++ ;
+}
+//===============================================
+Int_t AliCaloPhotonPool::PairKinematics(const Photon & ph1, Int_t bin, Int_t event)
+{
+  //Mass, pT and asymmetry of the pairs of ph1 with all photons of one pool event.
+  //Same operations as TLorentzVector::M() and Pt() of the sum, 
+  //in separate loops over the event photons without object access
+  const std::vector<Photon> & photons = fEvents[bin*fDepth+event] ;
+  Int_t n = photons.size() ;
+  if(n==0) return 0 ;
+  
+  if(fPairMass.GetSize()<n){
+    fPairMass  .Set(2*n) ;
+    fPairPt    .Set(2*n) ;
+    fPairMassV2.Set(2*n) ;
+    fPairPtV2  .Set(2*n) ;
+    fPairAsym  .Set(2*n) ;
+  }
+  
+  const Photon * ph2 = &(photons[0]) ;
+  Double_t * mass   = fPairMass  .GetArray() ;
+  Double_t * pt     = fPairPt    .GetArray() ;
+  Double_t * massV2 = fPairMassV2.GetArray() ;
+  Double_t * ptV2   = fPairPtV2  .GetArray() ;
+  Double_t * asym   = fPairAsym  .GetArray() ;
+  
+  for(Int_t i=0; i<n; i++){
+    Double_t px = ph1.fPx+ph2[i].fPx ;
+    Double_t py = ph1.fPy+ph2[i].fPy ;
+    Double_t pz = ph1.fPz+ph2[i].fPz ;
+    Double_t e  = ph1.fE +ph2[i].fE ;
+    Double_t mm = e*e-(px*px+py*py+pz*pz) ;
+    mass[i] = mm < 0.0 ? -TMath::Sqrt(-mm) : TMath::Sqrt(mm) ;
+    pt[i]   = TMath::Sqrt(px*px+py*py) ;
+    asym[i] = TMath::Abs((ph1.fE-ph2[i].fE)/(ph1.fE+ph2[i].fE)) ;
+  }
+  
+  for(Int_t i=0; i<n; i++){
+    Double_t px = ph1.fPxV2+ph2[i].fPxV2 ;
+    Double_t py = ph1.fPyV2+ph2[i].fPyV2 ;
+    Double_t pz = ph1.fPzV2+ph2[i].fPzV2 ;
+    Double_t e  = ph1.fEV2 +ph2[i].fEV2 ;
+    Double_t mm = e*e-(px*px+py*py+pz*pz) ;
+    massV2[i] = mm < 0.0 ? -TMath::Sqrt(-mm) : TMath::Sqrt(mm) ;
+    ptV2[i]   = TMath::Sqrt(px*px+py*py) ;
+  }
+  
+  return n ;
+}
@@ -0,0 +1,100 @@
+#ifndef ALICALOPHOTONPOOL_H
+#define ALICALOPHOTONPOOL_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice     */
+/* $Id$ */
+
+//_________________________________________________________________________
+// Pool of PHOS photons of previous events for the mixed event background
+// of the two-photon invariant mass distributions.
+// For each mixing bin (vertex, centrality, reaction plane ...) the last
+// events are kept in a ring as packed photon records instead of lists of
+// AliCaloPhoton, and the pair kinematics of one photon with all photons of
+// a pool event are calculated in one batch, see PairKinematics().
+// The PID bits of the records allow to fill several selections of the
+// pair in one pass.
+
+class AliCaloPhoton;
+class TClonesArray;
+
+#include <vector>
+#include "TObject.h"
+#include "TMath.h"
+#include "TArrayD.h"
+#include "TArrayI.h"
+
+class AliCaloPhotonPool : public TObject {
+
+ public:
+
+  enum EPIDBits { kCPV = BIT(0), kCPV2 = BIT(1), kDisp = BIT(2), kDisp2 = BIT(3), kTOF = BIT(4) } ;
+
+  // Packed photon record, accessors named as in AliCaloPhoton
+  struct Photon {
+    Double_t fPx, fPy, fPz, fE ;           // momentum
+    Double_t fPxV2, fPyV2, fPzV2, fEV2 ;   // alternative momentum
+    Double_t fZ ;                          // cluster z in ALICE ref system
+    Int_t    fBC ;                         // bunch crossing
+    Short_t  fNCells ;                     // number of cells in cluster
+    UChar_t  fModule ;                     // module number
+    UChar_t  fPID ;                        // EPIDBits
+
+    Double_t Pt()        const { return TMath::Sqrt(fPx*fPx+fPy*fPy) ; }
+    Double_t Energy()    const { return fE ; }
+    Double_t EMCz()      const { return fZ ; }
+    Int_t    GetBC()     const { return fBC ; }
+    Int_t    GetNCells() const { return fNCells ; }
+    Int_t    Module()    const { return fModule ; }
+    Bool_t   IsCPVOK()   const { return (fPID & kCPV ) != 0 ; }
+    Bool_t   IsCPV2OK()  const { return (fPID & kCPV2) != 0 ; }
+    Bool_t   IsDispOK()  const { return (fPID & kDisp) != 0 ; }
+    Bool_t   IsDisp2OK() const { return (fPID & kDisp2) != 0 ; }
+    Bool_t   IsTOFOK()   const { return (fPID & kTOF ) != 0 ; }
+  } ;
+
+  AliCaloPhotonPool() ;
+  AliCaloPhotonPool(Int_t nBins, Int_t depth) ;
+  virtual ~AliCaloPhotonPool() {}
+
+  void  Configure(Int_t nBins, Int_t depth) ;                    // number of mixing bins and events kept per bin
+  void  AddEvent(Int_t bin, const TClonesArray * photons) ;       // copy the AliCaloPhotons of this event to the bin, replacing the oldest event
+
+  Int_t GetNBins()                          const { return fNBins ; }
+  Int_t GetDepth()                          const { return fDepth ; }
+  Int_t GetNEvents(Int_t bin)               const { return fNEvents[bin] ; }
+  Int_t GetNPhotons(Int_t bin, Int_t event) const { return fEvents[bin*fDepth+event].size() ; }
+  const Photon * GetPhotons(Int_t bin, Int_t event) const
+    { return fEvents[bin*fDepth+event].empty() ? 0 : &(fEvents[bin*fDepth+event][0]) ; }
+
+  // Kinematics of the pairs of ph1 with the photons of one pool event,
+  // same values as with TLorentzVector sums; return the number of pairs
+  Int_t PairKinematics(const Photon & ph1, Int_t bin, Int_t event) ;
+
+  Double_t GetPairMass  (Int_t i) const { return fPairMass  [i] ; }
+  Double_t GetPairPt    (Int_t i) const { return fPairPt    [i] ; }
+  Double_t GetPairMassV2(Int_t i) const { return fPairMassV2[i] ; }
+  Double_t GetPairPtV2  (Int_t i) const { return fPairPtV2  [i] ; }
+  Double_t GetPairAsym  (Int_t i) const { return fPairAsym  [i] ; }
+
+  static void FillPhoton(const AliCaloPhoton * ph, Photon & rec) ;
+
+ private:
+  AliCaloPhotonPool(const AliCaloPhotonPool&); // not implemented
+  AliCaloPhotonPool& operator=(const AliCaloPhotonPool&); // not implemented
+
+  Int_t fNBins ;                            // number of mixing bins
+  Int_t fDepth ;                            // number of events kept per bin
+  TArrayI fNEvents ;                        // number of events filled per bin
+  TArrayI fNext ;                           // slot to fill next per bin
+  std::vector< std::vector<Photon> > fEvents ; //! [fNBins*fDepth] photons of the pool events
+
+  TArrayD fPairMass ;                       //! pair mass, filled by PairKinematics()
+  TArrayD fPairPt ;                         //! pair pT
+  TArrayD fPairMassV2 ;                     //! pair mass with alternative momenta
+  TArrayD fPairPtV2 ;                       //! pair pT with alternative momenta
+  TArrayD fPairAsym ;                       //! pair energy asymmetry
+
+  ClassDef(AliCaloPhotonPool,1) ;           // mixed event pool of PHOS photons
+} ;
+
+#endif // #ifdef ALICALOPHOTONPOOL_H
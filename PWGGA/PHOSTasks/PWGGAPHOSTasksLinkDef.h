@@ -9,6 +9,7 @@
 
 // PHOS_pp_pi0
 #pragma link C++ class AliCaloPhoton+;
+#pragma link C++ class AliCaloPhotonPool+;
 #pragma link C++ class AliAnalysisTaskPi0+;
 #pragma link C++ class AliAnalysisTaskPi0Conversion+;
 #pragma link C++ class AliAnalysisTaskPi0PP+;
@@ -85,6 +85,7 @@ fVecHisto(0),
   fIspPb(kFALSE),
   fUseCorrelatedSystematicsForWidths(kFALSE),
   fPlotV2SystSeparately(kFALSE),
+  fUseReferenceFitAsStart(kFALSE),
   fSaveDotC(kFALSE),
   fSaveRoot(kFALSE),
   fSavePng(kFALSE),
@@ -981,6 +982,8 @@ Bool_t AliHFCorrFitSystematics::RunFits(){
             
             fFitter->SetFixMeanType(3);
             fFitter->SetFuncType(fFitFuncType[iSystMode]);
+            if(fUseReferenceFitAsStart && fFitFuncType[iSystMode]==fFitFuncType[fReferenceIndex] && (Int_t)fFitFunctions.size()==fVecSize)
+                fFitter->SetStartingParameters(fFitFunctions[iPtBin]);
             fFitter->Fitting();
             fFitter->DrawLegendWithParameters();
             pave->Draw("same");
@@ -997,15 +1000,15 @@ Bool_t AliHFCorrFitSystematics::RunFits(){
             fValueHistoASSigma->SetBinError(iPtBin+1,fFitter->GetASSigmaError());
             fValueHistoPedestal->SetBinError(iPtBin+1,fFitter->GetPedestalError());
             
-            
-            if(!ComputeRatios(fReferenceHistoNSYield, fValueHistoNSYield, fRatioHistoNSYield)) return kFALSE;
-            if(!ComputeRatios(fReferenceHistoNSSigma, fValueHistoNSSigma, fRatioHistoNSSigma)) return kFALSE;
-            if(!ComputeRatios(fReferenceHistoASYield, fValueHistoASYield, fRatioHistoASYield)) return kFALSE;
-            if(!ComputeRatios(fReferenceHistoASSigma, fValueHistoASSigma, fRatioHistoASSigma)) return kFALSE;
-            if(!ComputeRatios(fReferenceHistoPedestal, fValueHistoPedestal, fRatioHistoPedestal)) return kFALSE;
-            
         }// end loop on D meson pt
         
+        // ratios to the reference, once all the pt bins of this mode are fitted
+        if(!ComputeRatios(fReferenceHistoNSYield, fValueHistoNSYield, fRatioHistoNSYield)) return kFALSE;
+        if(!ComputeRatios(fReferenceHistoNSSigma, fValueHistoNSSigma, fRatioHistoNSSigma)) return kFALSE;
+        if(!ComputeRatios(fReferenceHistoASYield, fValueHistoASYield, fRatioHistoASYield)) return kFALSE;
+        if(!ComputeRatios(fReferenceHistoASSigma, fValueHistoASSigma, fRatioHistoASSigma)) return kFALSE;
+        if(!ComputeRatios(fReferenceHistoPedestal, fValueHistoPedestal, fRatioHistoPedestal)) return kFALSE;
+        
             //Int_t index = GetBinIndex(Int_t ptbinindex, Int_t systematicIndex)
       
         
@@ -81,6 +81,7 @@ public:
     
     
     void SetCombineSystematicsMode(SystCombination mode){fCombineSystematics = mode;}
+    void SetUseReferenceFitAsStart(Bool_t k){fUseReferenceFitAsStart = k;} // start the fits of the variations from the reference fit of the same pt bin
     
     void SetFitRange(Double_t min, Double_t max){fMinFitRange = min; fMaxFitRange = max;}
     void SetReferenceBaselineEstimationRange(Double_t min, Double_t max){fMinReferenceBaselineEstimationRange = min; fMaxReferenceBaselineEstimationRange = max;}
@@ -175,6 +176,7 @@ private:
     Bool_t fIspPb;
     Bool_t fUseCorrelatedSystematicsForWidths;
     Bool_t fPlotV2SystSeparately;
+    Bool_t fUseReferenceFitAsStart;
     
     Bool_t fSaveDotC;
     Bool_t fSaveRoot;
@@ -322,7 +324,7 @@ private:
     TCanvas *fCanvasRefernce;
     TCanvas **fCanvasFitting;
 
-    ClassDef(AliHFCorrFitSystematics,4);    
+    ClassDef(AliHFCorrFitSystematics,5);    
     
 };
 
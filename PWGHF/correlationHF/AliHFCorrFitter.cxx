@@ -72,7 +72,8 @@ AliHFCorrFitter::AliHFCorrFitter():
   fMaxBaselineRange(0.5*TMath::Pi()),
   fTypeOfFitfunc(kTwoGausPeriodicity),
   fDmesonType(AliHFCorrelationUtils::kDaverage),
-  fIsReflected(kFALSE)
+  fIsReflected(kFALSE),
+  fStartPars()
 {
   //Default Constructor......... fix me
 
@@ -101,7 +102,8 @@ fMinBaselineRange(0.25*TMath::Pi()),
 fMaxBaselineRange(0.5*TMath::Pi()),
 fTypeOfFitfunc(kTwoGausPeriodicity),
 fDmesonType(AliHFCorrelationUtils::kDaverage),
-fIsReflected(kFALSE)
+fIsReflected(kFALSE),
+fStartPars()
 {
   if(isowner)fHist=histoToFit;
   else fHist=(TH1F*)histoToFit->Clone("fHist");
@@ -132,7 +134,8 @@ AliHFCorrFitter::AliHFCorrFitter(const AliHFCorrFitter &source):
   fMaxBaselineRange(source.fMaxBaselineRange),
   fTypeOfFitfunc(source.fTypeOfFitfunc),
   fDmesonType(source.fDmesonType),
-  fIsReflected(source.fIsReflected)
+  fIsReflected(source.fIsReflected),
+  fStartPars(source.fStartPars)
 {
   //copy constructor
 }
@@ -179,6 +182,7 @@ AliHFCorrFitter& AliHFCorrFitter::operator=(const AliHFCorrFitter &cfit)
   fTypeOfFitfunc=cfit.fTypeOfFitfunc;
   fDmesonType=cfit.fDmesonType;
   fIsReflected=cfit.fIsReflected;
+  fStartPars=cfit.fStartPars;
   
   return *this;
 
@@ -186,6 +190,13 @@ AliHFCorrFitter& AliHFCorrFitter::operator=(const AliHFCorrFitter &cfit)
 
 //________________ |Class Functios Implementation|___________________________________
 
+void AliHFCorrFitter::SetStartingParameters(const TF1 *fit){
+  // the parameters of fit are used as starting values in Fitting, if the number of
+  // parameters matches the one of the function set there; NULL restores the defaults
+  if(!fit) {fStartPars.Set(0); return;}
+  fStartPars.Set(fit->GetNpar(),fit->GetParameters());
+}
+
 void AliHFCorrFitter::SetHisto(const TH1F *histoToFit){
 
   fHist = new TH1F(*histoToFit);
@@ -632,6 +643,10 @@ void AliHFCorrFitter::Fitting(Bool_t drawSplitTerm)
   }   
   Printf("AliHFCorrFitter::Fitting, Setting Function");
   SetFunction();
+  if(fStartPars.GetSize()==fFit->GetNpar()){
+    Printf("AliHFCorrFitter::Fitting, Using the starting parameters of a previous fit");
+    fFit->SetParameters(fStartPars.GetArray());
+  }
 
   if(fFixBase!=0){
     fFit->FixParameter(0,fBaseline);
@@ -17,6 +17,7 @@
 #include <TH1F.h>
 #include <TCanvas.h>
 #include <TLatex.h>
+#include <TArrayD.h>
 
 class TH1F;
 class TCanvas;
@@ -56,6 +57,7 @@ class AliHFCorrFitter{
   void SetHistoIsReflected(Bool_t isrefl){
     fIsReflected=isrefl;
   }
+  void SetStartingParameters(const TF1 *fit); // start the fit from the parameters of a previous fit with the same function type
   //---------------------Getters----------->
   Double_t GetNSSigma(){
     if(fTypeOfFitfunc==kConstThreeGausPeriodicity){// other cases to be implemented
@@ -127,6 +129,7 @@ class AliHFCorrFitter{
   Int_t        fTypeOfFitfunc;     //type of functions
   Int_t           fDmesonType;
   Bool_t         fIsReflected;  // label to signal if the histogram is in 2pi range or pi (reflected)
-  ClassDef(AliHFCorrFitter,2);
+  TArrayD        fStartPars;    // starting values of the fit parameters, default ones if empty
+  ClassDef(AliHFCorrFitter,3);
 };
 #endif
@@ -38,6 +38,7 @@
 #include "AliEventPoolManager.h"
 #include "AliReducedParticle.h"
 #include "AliCentrality.h"
+#include "AliAnalysisManager.h"
 #include "AliAODMCParticle.h"
 
 using std::cout;
@@ -91,7 +92,13 @@ fnMultBinLimits(1),
 fMultBinLimits(0),
 fMinMultCand(-1.),
 fMaxMultCand(100000.),
-fStoreInfoSoftPiME(kFALSE)
+fStoreInfoSoftPiME(kFALSE),
+fReducedCache(0x0),
+fReducedCacheTracks(0x0),
+fReducedCacheEvent(0x0),
+fReducedCacheEntry(-1),
+fReducedCacheSelect(kUndefined),
+fReducedCacheK0InvMass(0)
 {
 	// default constructor	
 }
@@ -142,7 +149,13 @@ fnMultBinLimits(1),
 fMultBinLimits(0),
 fMinMultCand(-1.),
 fMaxMultCand(100000.),
-fStoreInfoSoftPiME(kFALSE)
+fStoreInfoSoftPiME(kFALSE),
+fReducedCache(0x0),
+fReducedCacheTracks(0x0),
+fReducedCacheEvent(0x0),
+fReducedCacheEntry(-1),
+fReducedCacheSelect(kUndefined),
+fReducedCacheK0InvMass(0)
 {
 	fhadcuts = cuts;
      if(!fDMesonCutObject) AliInfo("D meson cut object not loaded - if using centrality the estimator will be V0M!");
@@ -192,7 +205,13 @@ fnMultBinLimits(1),
 fMultBinLimits(0),
 fMinMultCand(-1.),
 fMaxMultCand(100000.),
-fStoreInfoSoftPiME(kFALSE)
+fStoreInfoSoftPiME(kFALSE),
+fReducedCache(0x0),
+fReducedCacheTracks(0x0),
+fReducedCacheEvent(0x0),
+fReducedCacheEntry(-1),
+fReducedCacheSelect(kUndefined),
+fReducedCacheK0InvMass(0)
 {
 	fhadcuts = cuts;
     fDMesonCutObject = cutObject;
@@ -234,6 +253,8 @@ AliHFCorrelator::~AliHFCorrelator()
 	
 	if(fk0InvMass) fk0InvMass=0;
 	if(fMultBinLimits) {delete [] fMultBinLimits; fMultBinLimits=0;}
+	if(fReducedCache) {delete fReducedCache; fReducedCache=0;}
+	if(fReducedCacheTracks) {delete fReducedCacheTracks; fReducedCacheTracks=0;}
 }
 
 //---------------------------------------------------------------------------
@@ -464,8 +485,65 @@ Int_t AliHFCorrelator::MultBin(Double_t Mult) const {
   return Multbin;
 }
 
+//_____________________________________________________
+void AliHFCorrelator::ClearReducedCache(){
+  // forget the selected associated particles, to be called when the event changes
+  if(fReducedCache) fReducedCache->Delete();
+  if(fReducedCacheTracks) fReducedCacheTracks->Clear();
+  fReducedCacheEvent = 0x0;
+  fReducedCacheEntry = -1;
+}
+
+//_____________________________________________________
+Bool_t AliHFCorrelator::IsReducedCacheValid(AliAODEvent* inputEvent, Int_t select) const {
+  // the cache is only used inside the event loop of the analysis manager, for the event it was filled with
+  if(!fReducedCacheEvent || fReducedCacheEvent!=inputEvent || fReducedCacheSelect!=select) return kFALSE;
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  if(!mgr || mgr->GetCurrentEntry()<0) return kFALSE;
+  return fReducedCacheEntry==mgr->GetCurrentEntry();
+}
+
 //_____________________________________________________
 TObjArray*  AliHFCorrelator::AcceptAndReduceTracks(AliAODEvent* inputEvent){
+  // returns a new array (owner) with the selected hadrons or kaons of the event;
+  // the candidate independent selection is done once per event, the charge
+  // and the soft pion check depend on the current trigger candidate
+
+  if(!IsReducedCacheValid(inputEvent,kHadron)){
+    if(!fReducedCache){
+      fReducedCache = new TObjArray;
+      fReducedCache->SetOwner(kTRUE);
+      fReducedCacheTracks = new TObjArray;
+      fReducedCacheTracks->SetOwner(kFALSE);
+    }
+    ClearReducedCache();
+    FillReducedTracksCache(inputEvent);
+    AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+    fReducedCacheEvent = inputEvent;
+    fReducedCacheEntry = mgr ? mgr->GetCurrentEntry() : -1;
+    fReducedCacheSelect = kHadron;
+  }
+
+  TObjArray* tracksClone = new TObjArray(fReducedCache->GetEntriesFast());
+  tracksClone->SetOwner(kTRUE);
+  for(Int_t i=0; i<fReducedCache->GetEntriesFast(); i++){
+    AliReducedParticle *part = new AliReducedParticle(*(static_cast<AliReducedParticle*>(fReducedCache->UncheckedAt(i))));
+    AliAODTrack *track = static_cast<AliAODTrack*>(fReducedCacheTracks->UncheckedAt(i));
+    if(track){ // reconstructed track
+      if(!fhadcuts->Charge(fDCharge,track)) { delete part; continue; } // apply selection on charge, if required
+      Bool_t rejectsoftpi = kTRUE;// TO BE CHECKED: DO WE WANT IT TO kTRUE AS A DEFAULT?
+      if(fD0cand && !fmixing) rejectsoftpi = fhadcuts->InvMassDstarRejection(fD0cand,track,fhypD0); // TO BE CHECKED: WHY NOT FOR EM?
+      part->SetCheckSoftPi(rejectsoftpi);
+    }
+    tracksClone->Add(part);
+  }
+  return tracksClone;
+}
+
+//_____________________________________________________
+void AliHFCorrelator::FillReducedTracksCache(AliAODEvent* inputEvent){
+  // candidate independent part of the selection of the associated hadrons and kaons,
+  // the charge and the soft pion check are applied in AcceptAndReduceTracks
 
   Double_t weight=1.;
   Int_t nTracks = inputEvent->GetNumberOfTracks();
@@ -478,8 +556,7 @@ TObjArray*  AliHFCorrelator::AcceptAndReduceTracks(AliAODEvent* inputEvent){
   Double_t Bz = inputEvent->GetMagneticField();
 	
   
-  TObjArray* tracksClone = new TObjArray;
-  tracksClone->SetOwner(kTRUE);
+  TObjArray* tracksClone = fReducedCache;
   
   //*******************************************************
   // use reconstruction
@@ -488,7 +565,6 @@ TObjArray*  AliHFCorrelator::AcceptAndReduceTracks(AliAODEvent* inputEvent){
       AliAODTrack* track = dynamic_cast<AliAODTrack*>(inputEvent->GetTrack(iTrack));
       if (!track) continue;
       if(!fhadcuts->IsHadronSelected(track,&vESD,Bz)) continue; // apply ESD level selections
-      if(!fhadcuts->Charge(fDCharge,track)) continue; // apply selection on charge, if required
 
       Double_t pT = track->Pt();
       
@@ -511,16 +587,14 @@ TObjArray*  AliHFCorrelator::AcceptAndReduceTracks(AliAODEvent* inputEvent){
       }
       
       if(!fhadcuts->CheckHadronKinematic(pT,d0)) continue; // apply kinematic cuts
-      Bool_t rejectsoftpi = kTRUE;// TO BE CHECKED: DO WE WANT IT TO kTRUE AS A DEFAULT?
-      if(fD0cand && !fmixing) rejectsoftpi = fhadcuts->InvMassDstarRejection(fD0cand,track,fhypD0); // TO BE CHECKED: WHY NOT FOR EM?
-      
       
       if(fselect ==kKaon){	
 	if(!fhadcuts->CheckKaonCompatibility(track,fmontecarlo,fmcArray,fPIDmode)) continue; // check if it is a Kaon - data and MC
       }
       weight=fhadcuts->GetTrackWeight(pT,track->Eta(),pos[2]);
-      if(fStoreInfoSoftPiME) tracksClone->Add(new AliReducedParticle(track->Eta(), track->Phi(), pT,track->GetLabel(),track->GetID(),d0,rejectsoftpi,track->Charge(),weight,track->Px(),track->Py(),track->Pz(),track->E(0.1396)));
-      else tracksClone->Add(new AliReducedParticle(track->Eta(), track->Phi(), pT,track->GetLabel(),track->GetID(),d0,rejectsoftpi,track->Charge(),weight));
+      if(fStoreInfoSoftPiME) tracksClone->Add(new AliReducedParticle(track->Eta(), track->Phi(), pT,track->GetLabel(),track->GetID(),d0,kTRUE,track->Charge(),weight,track->Px(),track->Py(),track->Pz(),track->E(0.1396)));
+      else tracksClone->Add(new AliReducedParticle(track->Eta(), track->Phi(), pT,track->GetLabel(),track->GetID(),d0,kTRUE,track->Charge(),weight));
+      fReducedCacheTracks->Add(track);
     } // end loop on tracks
   } // end if use reconstruction kTRUE
   
@@ -547,19 +621,45 @@ if(fselect ==kHadron) {if(!((PDG==321)||(PDG==211)||(PDG==2212)||(PDG==13)||(PDG
       if(!fhadcuts->CheckHadronKinematic(pT,d0)) continue; // apply kinematic cuts
       
       tracksClone->Add(new AliReducedParticle(mcPart->Eta(), mcPart->Phi(), pT,iPart,-1,d0,kFALSE,mcPart->Charge()));
+      fReducedCacheTracks->Add(0x0);
     }
     
   } // end if use  MC truth
-  
-  
-  return tracksClone;
 }
 
 //_____________________________________________________
 TObjArray*  AliHFCorrelator::AcceptAndReduceKZero(AliAODEvent* inputEvent){
+	// returns a new array with the selected kzeros of the event, the selection is done once per event
+
+	if(!IsReducedCacheValid(inputEvent,kKZero)){
+		if(!fReducedCache){
+			fReducedCache = new TObjArray;
+			fReducedCache->SetOwner(kTRUE);
+			fReducedCacheTracks = new TObjArray;
+			fReducedCacheTracks->SetOwner(kFALSE);
+		}
+		ClearReducedCache();
+		FillReducedKZeroCache(inputEvent);
+		AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+		fReducedCacheEvent = inputEvent;
+		fReducedCacheEntry = mgr ? mgr->GetCurrentEntry() : -1;
+		fReducedCacheSelect = kKZero;
+		fReducedCacheK0InvMass = fk0InvMass;
+	}
+	fk0InvMass = fReducedCacheK0InvMass;
+
+	TObjArray* KZeroClone = new TObjArray(fReducedCache->GetEntriesFast());
+	for(Int_t i=0; i<fReducedCache->GetEntriesFast(); i++)
+		KZeroClone->Add(new AliReducedParticle(*(static_cast<AliReducedParticle*>(fReducedCache->UncheckedAt(i)))));
+	return KZeroClone;
+}
+
+//_____________________________________________________
+void AliHFCorrelator::FillReducedKZeroCache(AliAODEvent* inputEvent){
+	// selection of the associated kzeros, it does not depend on the trigger candidate
 	
 	Int_t nOfVZeros = inputEvent->GetNumberOfV0s();
-	TObjArray* KZeroClone = new TObjArray;
+	TObjArray* KZeroClone = fReducedCache;
 	AliAODVertex *vertex1 = (AliAODVertex*)inputEvent->GetPrimaryVertex();
 
  // use reconstruction	 	
@@ -618,6 +718,7 @@ TObjArray*  AliHFCorrelator::AcceptAndReduceKZero(AliAODEvent* inputEvent){
 		
 		if(TMath::Abs(fk0InvMass-mPDGK0)>3*0.004) continue; // select candidates within 3 sigma
 		KZeroClone->Add(new AliReducedParticle(k0eta,k0Phi,k0pt,v0label));
+		fReducedCacheTracks->Add(0x0);
 		
 	}
      } // end if use reconstruction kTRUE
@@ -643,11 +744,9 @@ TObjArray*  AliHFCorrelator::AcceptAndReduceKZero(AliAODEvent* inputEvent){
 			if(!fhadcuts->CheckHadronKinematic(pT,d0)) continue; // apply kinematic cuts
 			
 			KZeroClone->Add(new AliReducedParticle(mcPart->Eta(), mcPart->Phi(), pT,iPart,-1,d0,kTRUE,mcPart->Charge()));
+			fReducedCacheTracks->Add(0x0);
 		}
 		
 	} // end if use  MC truth
 
-
-
-	return KZeroClone;
 }
@@ -75,7 +75,7 @@ class AliHFCorrelator : public TNamed
 	
 	
 	void SetAssociatedParticleType(Int_t type){fselect = type;}
-	void SetAODEvent(AliAODEvent* inputevent){fAODEvent = inputevent;}
+	void SetAODEvent(AliAODEvent* inputevent){fAODEvent = inputevent; ClearReducedCache();}
 	void SetMCArray(TClonesArray* mcArray){fmcArray = mcArray;}
 	void SetUseMC(Bool_t useMC){fmontecarlo = useMC;}
 	void SetApplyDisplacementCut(Int_t applycut){fUseImpactParameter = applycut;}
@@ -123,6 +123,7 @@ class AliHFCorrelator : public TNamed
 	// methods to reduce the tracks to correlate with track selection cuts applied here
 	TObjArray*  AcceptAndReduceTracks(AliAODEvent* inputEvent); // selecting hadrons and kaons
 	TObjArray*  AcceptAndReduceKZero(AliAODEvent* inputEvent); // selecting kzeros
+	void ClearReducedCache(); // forget the selected associated particles of the current event
 	
 	
  private:
@@ -130,6 +131,10 @@ class AliHFCorrelator : public TNamed
 	AliHFCorrelator(const AliHFCorrelator& vtxr);
 	AliHFCorrelator& operator=(const AliHFCorrelator& vtxr );
 
+	Bool_t IsReducedCacheValid(AliAODEvent* inputEvent, Int_t select) const; // selected particles of inputEvent already in the cache
+	void FillReducedTracksCache(AliAODEvent* inputEvent); // candidate independent selection of hadrons and kaons
+	void FillReducedKZeroCache(AliAODEvent* inputEvent); // selection of kzeros
+
 	AliEventPoolManager* fPoolMgr;         //! event pool manager
 	AliEventPool * fPool; //! Pool for event mixing
 	AliHFAssociatedTrackCuts* fhadcuts;//! hadron cuts
@@ -176,7 +181,17 @@ class AliHFCorrelator : public TNamed
 
     Bool_t fStoreInfoSoftPiME; //save info on px, py, pz, E to use soft-pi cut in ME online analysis
 
-	ClassDef(AliHFCorrelator,4); // class for HF correlations
+	// the selection of the associated particles does not depend on the trigger candidate,
+	// except for the charge and the soft pion check: it is done once per event and the
+	// candidate dependent part is applied when the reduced arrays are copied from the cache
+	TObjArray* fReducedCache; //! selected associated particles of the current event (owner)
+	TObjArray* fReducedCacheTracks; //! AOD track of each cached particle, NULL for MC particles and kzeros
+	AliAODEvent* fReducedCacheEvent; //! event of the cache
+	Long64_t fReducedCacheEntry; //! analysis manager entry of the cache
+	Int_t fReducedCacheSelect; //! kHadron (hadrons and kaons) or kKZero, particles in the cache
+	Double_t fReducedCacheK0InvMass; //! fk0InvMass after the kzero selection
+
+	ClassDef(AliHFCorrelator,5); // class for HF correlations
 };
 
 
@@ -64,6 +64,7 @@ class AliReducedParticle : public AliVParticle
   virtual int GetPtBin() const  {return fPtBin;}
   virtual int GetOriginMother() const {return fOriginMother;}
   void SetWeight(Double_t weight){fWeight=weight;}
+  void SetCheckSoftPi(Bool_t checkSoftPi){fCheckSoftPi=checkSoftPi;}
   Double_t GetWeight(){return fWeight;}
   virtual Double_t Px()         const { return fpx; }
   virtual Double_t Py()         const { return fpy; }
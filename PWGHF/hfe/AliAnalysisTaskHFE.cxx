@@ -125,6 +125,14 @@ AliAnalysisTaskSE("PID efficiency Analysis")
   , fWeightBackGround(0.)
   , fVz(0.0)
   , fContainer(NULL)
+  , fRecTrackContReco(NULL)
+  , fRecTrackContMC(NULL)
+  , fCutStepsTaskName()
+  , fCutStepsTask(NULL)
+  , fTrackCutStepsEvaluated()
+  , fTrackCutStepsPassed()
+  , fTrackCutStepsEntry(-1)
+  , fCurrentTrack(-1)
   , fVarManager(NULL)
   , fSignalCuts(NULL)
   , fCFM(NULL)
@@ -203,6 +211,14 @@ AliAnalysisTaskHFE::AliAnalysisTaskHFE(const char * name):
   , fWeightBackGround(0.)
   , fVz(0.0)
   , fContainer(NULL)
+  , fRecTrackContReco(NULL)
+  , fRecTrackContMC(NULL)
+  , fCutStepsTaskName()
+  , fCutStepsTask(NULL)
+  , fTrackCutStepsEvaluated()
+  , fTrackCutStepsPassed()
+  , fTrackCutStepsEntry(-1)
+  , fCurrentTrack(-1)
   , fVarManager(NULL)
   , fSignalCuts(NULL)
   , fCFM(NULL)
@@ -293,6 +309,14 @@ AliAnalysisTaskHFE::AliAnalysisTaskHFE(const AliAnalysisTaskHFE &ref):
   , fWeightBackGround(ref.fWeightBackGround)
   , fVz(ref.fVz)
   , fContainer(NULL)
+  , fRecTrackContReco(NULL)
+  , fRecTrackContMC(NULL)
+  , fCutStepsTaskName()
+  , fCutStepsTask(NULL)
+  , fTrackCutStepsEvaluated()
+  , fTrackCutStepsPassed()
+  , fTrackCutStepsEntry(-1)
+  , fCurrentTrack(-1)
   , fVarManager(NULL)
   , fSignalCuts(NULL)
   , fCFM(NULL)
@@ -378,6 +402,10 @@ void AliAnalysisTaskHFE::Copy(TObject &o) const {
   target.fWeightBackGround = fWeightBackGround;
   target.fVz = fVz;
   target.fContainer = fContainer;
+  target.fRecTrackContReco = fRecTrackContReco;
+  target.fRecTrackContMC = fRecTrackContMC;
+  target.fCutStepsTaskName = fCutStepsTaskName;
+  target.fCutStepsTask = fCutStepsTask;
   target.fVarManager = fVarManager;
   target.fSignalCuts = fSignalCuts;
   target.fCFM = fCFM;
@@ -523,6 +551,9 @@ void AliAnalysisTaskHFE::UserCreateOutputObjects(){
   fCFM->SetNStepParticle(kNcutSteps);
   MakeParticleContainer();
   MakeEventContainer();
+  // Resolve the containers filled for every track once
+  fRecTrackContReco = fContainer->GetCFContainer("recTrackContReco");
+  fRecTrackContMC = fContainer->GetCFContainer("recTrackContMC");
   // Temporary fix: Initialize particle cuts with NULL
   for(Int_t istep = 0; istep < kNcutSteps; istep++)
     fCFM->SetParticleCutsList(istep, NULL);
@@ -541,6 +572,15 @@ void AliAnalysisTaskHFE::UserCreateOutputObjects(){
   if(fCuts->IsQAOn()) fQA->Add(fCuts->GetQAhistograms());
   fSignalCuts = new AliHFEsignalCuts("HFEsignalCuts", "HFE MC Signal definition");
   fVarManager->SetSignalCuts(fSignalCuts);
+
+  // Task with the same track cuts, running before this one, whose cut step results are used
+  if(fCutStepsTaskName.Length()){
+    fCutStepsTask = dynamic_cast<AliAnalysisTaskHFE *>(AliAnalysisManager::GetAnalysisManager()->GetTask(fCutStepsTaskName.Data()));
+    if(!fCutStepsTask || fCutStepsTask == this){
+      AliError(Form("Task %s for the cut step results not found, cuts are evaluated by this task", fCutStepsTaskName.Data()));
+      fCutStepsTask = NULL;
+    }
+  }
  
   // add output objects to the List
   fOutput->AddAt(fContainer, 0);
@@ -1067,7 +1107,9 @@ void AliAnalysisTaskHFE::ProcessESD(){
   //
   AliDebug(3, Form("Number of Tracks: %d", fESD->GetNumberOfTracks()));
   Bool_t kinkmother(kFALSE), kinkdaughter(kFALSE); Double_t kinkstatus(0);
+  ResetTrackCutSteps(fESD->GetNumberOfTracks());
   for(Int_t itrack = 0; itrack < fESD->GetNumberOfTracks(); itrack++){
+    fCurrentTrack = itrack;
     AliDebug(4, "New ESD track");
     track = fESD->GetTrack(itrack);
     track->SetESDEvent(fESD);
@@ -1118,8 +1160,8 @@ void AliAnalysisTaskHFE::ProcessESD(){
 
     if(fFillNoCuts) {
       if(signal || !fFillSignalOnly){
-        fVarManager->FillContainer(fContainer, "recTrackContReco", AliHFEcuts::kStepRecNoCut, kFALSE);
-        fVarManager->FillContainer(fContainer, "recTrackContMC", AliHFEcuts::kStepRecNoCut, kTRUE);
+        if(fRecTrackContReco) fVarManager->FillContainer(fRecTrackContReco, AliHFEcuts::kStepRecNoCut, kFALSE);
+        if(fRecTrackContMC) fVarManager->FillContainer(fRecTrackContMC, AliHFEcuts::kStepRecNoCut, kTRUE);
       }
     }
   
@@ -1687,7 +1729,9 @@ void AliAnalysisTaskHFE::ProcessAOD(){
 
   //printf("Number of track %d\n",(Int_t) fAOD->GetNumberOfTracks());
   Bool_t kinkmother(kFALSE), kinkdaughter(kFALSE); Double_t kinkstatus(0);
+  ResetTrackCutSteps(fAOD->GetNumberOfTracks());
   for(Int_t itrack = 0; itrack < fAOD->GetNumberOfTracks(); itrack++){
+    fCurrentTrack = itrack;
     kinkmother=kFALSE;
     kinkdaughter=kFALSE;
     kinkstatus = 0.;
@@ -1728,8 +1772,8 @@ void AliAnalysisTaskHFE::ProcessAOD(){
     
     if(fFillNoCuts) {
       if(signal || !fFillSignalOnly){
-        fVarManager->FillContainer(fContainer, "recTrackContReco", AliHFEcuts::kStepRecNoCut, kFALSE);
-        fVarManager->FillContainer(fContainer, "recTrackContMC", AliHFEcuts::kStepRecNoCut, kTRUE);
+        if(fRecTrackContReco) fVarManager->FillContainer(fRecTrackContReco, AliHFEcuts::kStepRecNoCut, kFALSE);
+        if(fRecTrackContMC) fVarManager->FillContainer(fRecTrackContMC, AliHFEcuts::kStepRecNoCut, kTRUE);
       }
     }
 
@@ -2376,13 +2420,48 @@ Bool_t AliAnalysisTaskHFE::ProcessCutStep(Int_t cutStep, AliVParticle *track){
   // Fill the particle container
   //
   const Int_t kMCOffset = AliHFEcuts::kNcutStepsMCTrack;
-  if(!fCFM->CheckParticleCuts(cutStep + kMCOffset, track)) return kFALSE;
+  Bool_t passed = kFALSE;
+  if(!fCutStepsTask || !fCutStepsTask->GetTrackCutStep(Entry(), fCurrentTrack, cutStep, passed))
+    passed = fCFM->CheckParticleCuts(cutStep + kMCOffset, track);
+  // Keep the result for tasks with the same cuts
+  if(fCurrentTrack >= 0 && fCurrentTrack < fTrackCutStepsEvaluated.GetSize() && cutStep < 32){
+    fTrackCutStepsEvaluated[fCurrentTrack] |= BIT(cutStep);
+    if(passed) fTrackCutStepsPassed[fCurrentTrack] |= BIT(cutStep);
+  }
+  if(!passed) return kFALSE;
   if(fVarManager->IsSignalTrack()) {
-    fVarManager->FillContainer(fContainer, "recTrackContReco", cutStep, kFALSE);
-    fVarManager->FillContainer(fContainer, "recTrackContMC", cutStep, kTRUE);
+    if(fRecTrackContReco) fVarManager->FillContainer(fRecTrackContReco, cutStep, kFALSE);
+    if(fRecTrackContMC) fVarManager->FillContainer(fRecTrackContMC, cutStep, kTRUE);
   }
   return kTRUE;
 }
+//___________________________________________________
+void AliAnalysisTaskHFE::ResetTrackCutSteps(Int_t ntracks){
+  //
+  // Clear the cut step results at the beginning of the track loop
+  //
+  fTrackCutStepsEntry = Entry();
+  fTrackCutStepsEvaluated.Set(ntracks);
+  fTrackCutStepsPassed.Set(ntracks);
+  fTrackCutStepsEvaluated.Reset();
+  fTrackCutStepsPassed.Reset();
+  fCurrentTrack = -1;
+}
+
+//___________________________________________________
+Bool_t AliAnalysisTaskHFE::GetTrackCutStep(Long64_t entry, Int_t itrack, Int_t cutStep, Bool_t &passed) const {
+  //
+  // Result of a track cut step of this task in the current event,
+  // for another task with the same track cuts (see SetCutStepsFromTask)
+  // Returns false if the cut step was not evaluated for this track
+  //
+  if(entry != fTrackCutStepsEntry) return kFALSE;
+  if(itrack < 0 || itrack >= fTrackCutStepsEvaluated.GetSize() || cutStep >= 32) return kFALSE;
+  if(!(fTrackCutStepsEvaluated[itrack] & BIT(cutStep))) return kFALSE;
+  passed = (fTrackCutStepsPassed[itrack] & BIT(cutStep)) != 0;
+  return kTRUE;
+}
+
 //___________________________________________________
 Bool_t AliAnalysisTaskHFE::ReadCentrality() {
   //
@@ -30,6 +30,7 @@
 
 #ifndef ROOT_TBits
 #include <TBits.h>
+#include <TArrayI.h>
 #endif
 
 class AliAnalysisUtils;
@@ -49,6 +50,7 @@ class AliHFEvarManager;
 class AliHFEtaggedTrackAnalysis;
 class AliHFEV0taginfo;
 class AliCFManager;
+class AliCFContainer;
 class AliMCEvent;
 class AliOADBContainer;
 class AliAODMCHeader;
@@ -124,6 +126,8 @@ class AliAnalysisTaskHFE : public AliAnalysisTaskSE{
     AliHFENonPhotonicElectron *GetHFEBackgroundSubtraction() const { return fBackgroundSubtraction; }
 
     void SetHFECuts(AliHFEcuts * const cuts) { fCuts = cuts; };
+    void SetCutStepsFromTask(const char *taskname) { fCutStepsTaskName = taskname; }
+    Bool_t GetTrackCutStep(Long64_t entry, Int_t itrack, Int_t cutStep, Bool_t &passed) const;
     void SetTaggedTrackCuts(AliHFEcuts * const cuts) { fTaggedTrackCuts = cuts; }
     void SetCleanTaggedTrack(Bool_t clean) { fCleanTaggedTrack = clean; };
     void SetVariablesTRDTaggedTrack(Bool_t variablesTRD) { fVariablesTRDTaggedTrack = variablesTRD; };
@@ -215,6 +219,7 @@ class AliAnalysisTaskHFE : public AliAnalysisTaskSE{
     Bool_t PreSelectTrack(AliESDtrack *track) const;
     Bool_t ProcessMCtrack(AliVParticle *track);
     Bool_t ProcessCutStep(Int_t cutStep, AliVParticle *track);
+    void ResetTrackCutSteps(Int_t ntracks);
     AliAODMCHeader *fAODMCHeader;         // ! MC info AOD
     TClonesArray *fAODArrayMCInfo;        // ! MC info particle AOD
     ULong_t fQAlevel;                     // QA level
@@ -250,6 +255,14 @@ class AliAnalysisTaskHFE : public AliAnalysisTaskSE{
     Double_t fBinLimit[kBgPtBins+1];      // Electron pt bin edges
     Float_t fCentralityLimits[12];        // Limits for centrality bins
     AliHFEcontainer *fContainer;          //! The HFE container
+    AliCFContainer *fRecTrackContReco;    //! Reconstructed track container, from fContainer
+    AliCFContainer *fRecTrackContMC;      //! Reconstructed track container with MC values, from fContainer
+    TString fCutStepsTaskName;            // Task with the same track cuts whose cut step results are used
+    AliAnalysisTaskHFE *fCutStepsTask;    //! Task with the same track cuts, from fCutStepsTaskName
+    TArrayI fTrackCutStepsEvaluated;      //! Per track of the event, bit set for each evaluated cut step
+    TArrayI fTrackCutStepsPassed;         //! Per track of the event, bit set for each passed cut step
+    Long64_t fTrackCutStepsEntry;         //! Entry of the event of the cut step results
+    Int_t fCurrentTrack;                  //! Index of the track being processed
     AliHFEvarManager *fVarManager;        // The var manager as the backbone of the analysis
     AliHFEsignalCuts *fSignalCuts;        //! MC true signal (electron coming from certain source) 
     AliCFManager *fCFM;                   //! Correction Framework Manager
@@ -288,7 +301,7 @@ class AliAnalysisTaskHFE : public AliAnalysisTaskSE{
     AliHFEcollection *fQACollection;      //! Tasks own QA collection
     //---------------------------------------
 
-    ClassDef(AliAnalysisTaskHFE, 4)       // The electron Analysis Task
+    ClassDef(AliAnalysisTaskHFE, 6)       // The electron Analysis Task
 };
 #endif
 
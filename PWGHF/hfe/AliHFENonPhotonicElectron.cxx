@@ -84,6 +84,7 @@ ClassImp(AliHFENonPhotonicElectron)
     ,fMaxOpening3D	(TMath::Pi())
     ,fMaxInvMass		(1000)
     ,fSetMassConstraint	(kFALSE)
+    ,fPairMassPreselection	(-1.)
     ,fSelectCategory1tracks(kTRUE)
     ,fSelectCategory2tracks(kFALSE)
     ,fITSmeanShift(0.)
@@ -141,6 +142,7 @@ ClassImp(AliHFENonPhotonicElectron)
     ,fMaxOpening3D	(TMath::TwoPi())
     ,fMaxInvMass		(1000)
     ,fSetMassConstraint	(kFALSE)
+    ,fPairMassPreselection	(-1.)
     ,fSelectCategory1tracks(kTRUE)
     ,fSelectCategory2tracks(kFALSE)
     ,fITSmeanShift(0.)
@@ -198,6 +200,7 @@ ClassImp(AliHFENonPhotonicElectron)
     ,fMaxOpening3D	(ref.fMaxOpening3D)
     ,fMaxInvMass		(ref.fMaxInvMass)
     ,fSetMassConstraint	(ref.fSetMassConstraint)
+    ,fPairMassPreselection	(ref.fPairMassPreselection)
     ,fSelectCategory1tracks(ref.fSelectCategory1tracks)
     ,fSelectCategory2tracks(ref.fSelectCategory2tracks)
     ,fITSmeanShift(ref.fITSmeanShift)
@@ -689,6 +692,17 @@ Int_t AliHFENonPhotonicElectron::LookAtNonHFE(Int_t iTrack1, AliVTrack *track1,
 
     Float_t fCharge1 = track1->Charge();							//Charge from track1
 
+    // Optional preselection of the pairs on the invariant mass, before the pair reconstruction.
+    // With electron mass neglected, m^2 >= 2 p1 p2 (1 - cos(theta)), from the momenta at the
+    // primary vertex. The pair mass is computed at the DCA of the tracks (or by the KF fit),
+    // hence the margin on the cut. Not used with the mass constraint of the KF package, which
+    // adds every pair to the primary vertex.
+    Bool_t preselect = (fPairMassPreselection >= 0.) && (fAlgorithmMA || !fSetMassConstraint);
+    Double_t maxMass2 = (1. + fPairMassPreselection) * fMaxInvMass;
+    maxMass2 *= maxMass2;
+    Double_t p1[3] = {track1->Px(), track1->Py(), track1->Pz()};
+    Double_t pmag1 = track1->P();
+
     Bool_t kUSignPhotonic = kFALSE;
     Bool_t kLSignPhotonic = kFALSE;
 
@@ -737,6 +751,12 @@ Int_t AliHFENonPhotonicElectron::LookAtNonHFE(Int_t iTrack1, AliVTrack *track1,
         if(iTrack2==iTrack1) continue;
         AliDebug(2,"Different");
 
+        if(preselect){
+            Double_t pmag2 = track2->P();
+            Double_t p1p2 = p1[0]*track2->Px() + p1[1]*track2->Py() + p1[2]*track2->Pz();
+            if(2.*(pmag1*pmag2 - p1p2) > maxMass2) continue;
+        }
+
         // if MC look
         if(fMCEvent || fAODArrayMCInfo){
             AliDebug(2, "Checking for source");
@@ -79,6 +79,7 @@ class AliHFENonPhotonicElectron : public TNamed {
   void  SetStudyRadius		(Bool_t studyRadius)	 	{ fStudyRadius		= studyRadius; };
   void  SetAlgorithmMA		(Bool_t algorithmMA)	 	{ fAlgorithmMA		= algorithmMA; };
   void  SetMassConstraint	(Bool_t MassConstraint)		{ fSetMassConstraint	= MassConstraint; };
+  void  SetPairMassPreselection	(Double_t margin = 0.2)		{ fPairMassPreselection	= margin; };
   void  SetITSMeanShift         (Double_t meanshift)            { fITSmeanShift = meanshift; }
   void  SetITSnSigmaHigh        (Double_t nSigmaHigh)           { fITSnSigmaHigh = nSigmaHigh; }
   void  SetITSnSigmaLow         (Double_t nSigmaLow)            { fITSnSigmaLow = nSigmaLow; }
@@ -153,6 +154,7 @@ class AliHFENonPhotonicElectron : public TNamed {
   Double_t                  fMaxOpening3D;                  // Limit opening 3D
   Double_t                  fMaxInvMass;                    // Limit invariant mass
   Bool_t                    fSetMassConstraint;             // Set mass constraint
+  Double_t                  fPairMassPreselection;          // If >= 0, skip pairs with mass lower bound above (1+this)*fMaxInvMass before the pair reconstruction
   Bool_t                    fSelectCategory1tracks;         // Category 1 tracks: Standard track cuts
   Bool_t                    fSelectCategory2tracks;         // Category 2 tracks: tracks below 300 MeV/c
   Double_t                  fITSmeanShift;                  // Shift of the mean in the ITS
@@ -184,7 +186,7 @@ class AliHFENonPhotonicElectron : public TNamed {
 
   AliHFENonPhotonicElectron(const AliHFENonPhotonicElectron &ref); 
 
-  ClassDef(AliHFENonPhotonicElectron, 5); //!example of analysis
+  ClassDef(AliHFENonPhotonicElectron, 6); //!example of analysis
 };
 
 #endif
@@ -27,6 +27,7 @@
 #include <THashList.h>
 #include <THnSparse.h>
 #include <TList.h>
+#include <TMath.h>
 #include <TObjArray.h>
 #include <TObjString.h>
 #include <TString.h>
@@ -352,6 +353,33 @@ void AliHFEcontainer::FillCFContainerStepname(const Char_t *name, const Char_t *
   cont->Fill(content, mystep, weight);
 }
 
+//__________________________________________________________________
+Int_t AliHFEcontainer::GetStep(const Char_t *name, const Char_t *steptitle) const{
+  //
+  // Find the step with the given title in the container, -1 if not found
+  // To be resolved once, and used with the container from GetCFContainer
+  // in the event loop instead of FillCFContainerStepname
+  //
+  AliCFContainer *cont = GetCFContainer(name);
+  if(!cont) return -1;
+  for(Int_t istep = 0; istep < cont->GetNStep(); istep++){
+    TString tstept = cont->GetStepTitle(istep);
+    if(!tstept.CompareTo(steptitle)) return istep;
+  }
+  return -1;
+}
+
+//__________________________________________________________________
+void AliHFEcontainer::FillCFContainerSteps(AliCFContainer *cont, UInt_t lastStep, const Double_t * const content, Double_t weight) const {
+  //
+  // Fill steps 0 to lastStep of the container, for a candidate which passed all of them
+  // The container is resolved once with GetCFContainer
+  //
+  if(!cont) return;
+  Int_t nsteps = TMath::Min(static_cast<Int_t>(lastStep) + 1, cont->GetNStep());
+  for(Int_t istep = 0; istep < nsteps; istep++) cont->Fill(content, istep, weight);
+}
+
 //__________________________________________________________________
 AliCFContainer *AliHFEcontainer::MakeMergedCFContainer(const Char_t *name, const Char_t *title, const Char_t* contnames) const {
   //
@@ -547,6 +547,16 @@ void AliHFEsecVtx::FindSECVTXCandid(AliVTrack *track)
 
   Int_t nPairs = HFEpairs()->GetEntriesFast(); 
 
+  // KF particles of the electron (entry 0) and of the paired tracks (entry ip+1),
+  // created once here instead of once per track combination below
+  AliVTrack *kftracks[21];
+  AliKFParticle kfTrack[21];
+  Int_t trkid[21];
+  Bool_t kfok[21];
+  kftracks[0] = track;
+  for (int ip=0; ip<nPairs; ip++) kftracks[ip+1] = htrack[ip];
+  if (nPairs > 1) MakeKFTracks(nPairs+1, kftracks, kfTrack, trkid, kfok);
+
 
   // 1 electron candidate + 1 track 
   if (nPairs == 1){
@@ -559,7 +569,8 @@ void AliHFEsecVtx::FindSECVTXCandid(AliVTrack *track)
 
   // 1 electron candidate + 2 tracks 
   if (nPairs == 2){
-    CalcSECVTXProperty(track, htrack[0], htrack[1]); // calculate secondary vertex property
+    const Int_t combAll[3] = {0, 1, 2};
+    CalcSECVTXProperty(3, combAll, kfTrack, trkid, kfok); // calculate secondary vertex property
 
     if (fKFchi2 < fVtxchi2Loosecut) { // -> here you apply rather loose cut
       Fill3TrkSECVTX(track, 0, 1);
@@ -578,7 +589,8 @@ void AliHFEsecVtx::FindSECVTXCandid(AliVTrack *track)
 
   // 1 electron candidate + 3 tracks 
   if (nPairs == 3){
-    CalcSECVTXProperty(track, htrack[0], htrack[1], htrack[2]); // calculate secondary vertex property
+    const Int_t combAll[4] = {0, 1, 2, 3};
+    CalcSECVTXProperty(4, combAll, kfTrack, trkid, kfok); // calculate secondary vertex property
 
     if (fKFchi2 < fVtxchi2Loosecut) {
       Fill4TrkSECVTX(track, 0, 1, 2);
@@ -587,7 +599,8 @@ void AliHFEsecVtx::FindSECVTXCandid(AliVTrack *track)
       fArethereSecVtx=0;
       for (int i=0; i<nPairs-1; i++){
          for (int j=i+1; j<nPairs; j++){
-            CalcSECVTXProperty(track, htrack[i], htrack[j]);
+            const Int_t comb[3] = {0, i+1, j+1};
+            CalcSECVTXProperty(3, comb, kfTrack, trkid, kfok);
             if (fKFchi2 < fVtxchi2Loosecut) {
               fArethereSecVtx++;
               Fill3TrkSECVTX(track, i, j);
@@ -613,7 +626,8 @@ void AliHFEsecVtx::FindSECVTXCandid(AliVTrack *track)
     for (int ih1=0; ih1<nPairs-2; ih1++){
       for (int ih2=ih1+1; ih2<nPairs-1; ih2++){
         for (int ih3=ih2+1; ih3<nPairs; ih3++){
-          CalcSECVTXProperty(track, htrack[ih1], htrack[ih2], htrack[ih3]); // calculate secondary vertex property
+          const Int_t comb[4] = {0, ih1+1, ih2+1, ih3+1};
+          CalcSECVTXProperty(4, comb, kfTrack, trkid, kfok); // calculate secondary vertex property
           if (fKFchi2 < fVtxchi2Loosecut) {
             fArethereSecVtx++;
             Fill4TrkSECVTX(track, ih1, ih2, ih3);
@@ -625,7 +639,8 @@ void AliHFEsecVtx::FindSECVTXCandid(AliVTrack *track)
       fArethereSecVtx=0;
       for (int i=0; i<nPairs-1; i++){
         for (int j=i+1; j<nPairs; j++){
-          CalcSECVTXProperty(track, htrack[i], htrack[j]);
+          const Int_t comb[3] = {0, i+1, j+1};
+          CalcSECVTXProperty(3, comb, kfTrack, trkid, kfok);
           if (fKFchi2 < fVtxchi2Loosecut) {
             fArethereSecVtx++;
             Fill3TrkSECVTX(track, i, j);
@@ -810,76 +825,14 @@ void AliHFEsecVtx::CalcSECVTXProperty(AliVTrack* track1, AliVTrack* track2, AliV
   // calculate secondary vertex properties
   //
 
-  // get KF particle input pid
-  Int_t pdg1 = GetPDG(track1);
-  Int_t pdg2 = GetPDG(track2);
-  Int_t pdg3 = GetPDG(track3);
-
-  if(pdg1==-1 || pdg2==-1 || pdg3==-1) {
-    //printf("out if considered pid range \n");
-    return;
-  }
-
-  // create KF particle of pair
-  if(IsAODanalysis()) AliKFParticle::SetField(fAOD1->GetMagneticField());
-  else AliKFParticle::SetField(fESD1->GetMagneticField());
+  AliVTrack *tracks[3] = {track1, track2, track3};
   AliKFParticle kfTrack[3];
-  kfTrack[0] = AliKFParticle(*track1, pdg1);
-  kfTrack[1] = AliKFParticle(*track2, pdg2);
-  kfTrack[2] = AliKFParticle(*track3, pdg3);
-
-  AliKFParticle kfSecondary(kfTrack[0],kfTrack[1],kfTrack[2]);
-  //AliKFParticle kfSecondary(kfTrack1,kfTrack2,kfTrack3);
-        
-  //secondary vertex point from kf particle
-  Double_t kfx = kfSecondary.GetX();
-  Double_t kfy = kfSecondary.GetY();
-  //Double_t kfz = kfSecondary.GetZ();
-
-  //momentum at the decay point from kf particle
-  Double_t kfpx = kfSecondary.GetPx();
-  Double_t kfpy = kfSecondary.GetPy();
-  //Double_t kfpz = kfSecondary.GetPz();
-
-  Double_t dx = kfx-fPVx;
-  Double_t dy = kfy-fPVy;
-
-  // discriminating variables ----------------------------------------------------------
-
-  if(kfSecondary.GetNDF()>0) fKFchi2 = TMath::Sqrt(TMath::Abs(kfSecondary.GetChi2()/kfSecondary.GetNDF())); 
-
-  // invariant mass of the KF particle
-  kfSecondary.GetMass(fInvmass,fInvmassSigma);
-
-  // DCA from primary to e-h KF particle (impact parameter of KF particle)
-  Double_t vtx[2]={fPVx, fPVy};
-  fKFip = kfSecondary.GetDistanceFromVertexXY(vtx);
-
-  if((dx*kfpx+dy*kfpy)>0) fSignedLxy= TMath::Sqrt(dx*dx+dy*dy);
-  if((dx*kfpx+dy*kfpy)<0) fSignedLxy= -1*TMath::Sqrt(dx*dx+dy*dy);
-  //[the other way to think about] - projection of kf vertex vector to the kf momentum direction
-  //Double_t psqr = kfpx*kfpx+kfpy*kfpy;
-  //if(psqr>0) fSignedLxy=(dx*kfpx+dy*kfpy)/TMath::Sqrt(psqr);  
-
-
-  //recalculating primary vertex after removing secvtx tracks --------------------------
   Int_t trkid[3];
-  trkid[0] = track1->GetID();
-  trkid[1] = track2->GetID();
-  trkid[2] = track3->GetID();
-
-  RecalcPrimvtx(3, trkid, kfTrack);
-  Double_t dx2 = kfx-fPVx2;
-  Double_t dy2 = kfy-fPVy2;
+  Bool_t kfok[3];
+  MakeKFTracks(3, tracks, kfTrack, trkid, kfok);
 
-  // IP of sec particle recalculated based on recalculated primary vertex
-  Double_t vtx2[2]={fPVx2, fPVy2};
-  fKFip2 = kfSecondary.GetDistanceFromVertexXY(vtx2);
-  // signed Lxy recalculated based on recalculated primary vertex
-  if((dx2*kfpx+dy2*kfpy)>0) fSignedLxy2= TMath::Sqrt(dx2*dx2+dy2*dy2);
-  if((dx2*kfpx+dy2*kfpy)<0) fSignedLxy2= -1*TMath::Sqrt(dx2*dx2+dy2*dy2);
-  //------------------------------------------------------------------------------------
-  
+  const Int_t comb[3] = {0, 1, 2};
+  CalcSECVTXProperty(3, comb, kfTrack, trkid, kfok);
 }
 
 //_______________________________________________________________________________________________
@@ -889,28 +842,58 @@ void AliHFEsecVtx::CalcSECVTXProperty(AliVTrack* track1, AliVTrack* track2, AliV
   // calculate secondary vertex properties
   //
 
-  // get KF particle input pid
-  Int_t pdg1 = GetPDG(track1);
-  Int_t pdg2 = GetPDG(track2);
-  Int_t pdg3 = GetPDG(track3);
-  Int_t pdg4 = GetPDG(track4);
+  AliVTrack *tracks[4] = {track1, track2, track3, track4};
+  AliKFParticle kfTrack[4];
+  Int_t trkid[4];
+  Bool_t kfok[4];
+  MakeKFTracks(4, tracks, kfTrack, trkid, kfok);
 
-  if(pdg1==-1 || pdg2==-1 || pdg3==-1 || pdg4==-1) {
-    //printf("out if considered pid range \n");
-    return;
-  }
+  const Int_t comb[4] = {0, 1, 2, 3};
+  CalcSECVTXProperty(4, comb, kfTrack, trkid, kfok);
+}
+
+//_______________________________________________________________________________________________
+void AliHFEsecVtx::MakeKFTracks(Int_t ntrk, AliVTrack * const * const tracks, AliKFParticle * const kftrk, Int_t * const trkid, Bool_t * const kfok)
+{
+  //
+  // create the KF particles of the tracks with their input pid,
+  // kfok is false for the tracks out of the considered pid range
+  //
 
-  // create KF particle of pair
   if(IsAODanalysis()) AliKFParticle::SetField(fAOD1->GetMagneticField());
   else AliKFParticle::SetField(fESD1->GetMagneticField());
 
+  for(Int_t i=0; i<ntrk; i++){
+    Int_t pdg = GetPDG(tracks[i]);
+    kfok[i] = (pdg != -1);
+    trkid[i] = tracks[i]->GetID();
+    if(kfok[i]) kftrk[i] = AliKFParticle(*tracks[i], pdg);
+  }
+}
+
+//_______________________________________________________________________________________________
+void AliHFEsecVtx::CalcSECVTXProperty(Int_t ntrk, const Int_t * const comb, const AliKFParticle * const kftrk, const Int_t * const trkid, const Bool_t * const kfok)
+{
+  //
+  // calculate secondary vertex properties of the 3 or 4 KF particles
+  // kftrk[comb[0]], ..., kftrk[comb[ntrk-1]]
+  //
+
+  if(ntrk<3 || ntrk>4) return;
+
   AliKFParticle kfTrack[4];
-  kfTrack[0] = AliKFParticle(*track1, pdg1);
-  kfTrack[1] = AliKFParticle(*track2, pdg2);
-  kfTrack[2] = AliKFParticle(*track3, pdg3);
-  kfTrack[3] = AliKFParticle(*track4, pdg4);
+  Int_t trkidSel[4];
+  for(Int_t i=0; i<ntrk; i++){
+    if(!kfok[comb[i]]) {
+      //printf("out if considered pid range \n");
+      return;
+    }
+    kfTrack[i] = kftrk[comb[i]];
+    trkidSel[i] = trkid[comb[i]];
+  }
 
-  AliKFParticle kfSecondary(kfTrack[0],kfTrack[1],kfTrack[2],kfTrack[3]);
+  AliKFParticle kfSecondary = (ntrk == 3) ? AliKFParticle(kfTrack[0],kfTrack[1],kfTrack[2])
+                                          : AliKFParticle(kfTrack[0],kfTrack[1],kfTrack[2],kfTrack[3]);
 
   //secondary vertex point from kf particle
   Double_t kfx = kfSecondary.GetX();
@@ -943,13 +926,7 @@ void AliHFEsecVtx::CalcSECVTXProperty(AliVTrack* track1, AliVTrack* track2, AliV
   //if(psqr>0) fSignedLxy=(dx*kfpx+dy*kfpy)/TMath::Sqrt(psqr);  
 
   //recalculating primary vertex after removing secvtx tracks --------------------------
-  Int_t trkid[4];
-  trkid[0] = track1->GetID();
-  trkid[1] = track2->GetID();
-  trkid[2] = track3->GetID();
-  trkid[3] = track4->GetID();
-
-  RecalcPrimvtx(4, trkid, kfTrack);
+  RecalcPrimvtx(ntrk, trkidSel, kfTrack);
   Double_t dx2 = kfx-fPVx2;
   Double_t dy2 = kfy-fPVy2;
 
@@ -107,6 +107,8 @@ class AliHFEsecVtx : public TObject {
     void FindSECVTXCandid(AliVTrack *track);
     void CalcSECVTXProperty(AliVTrack* track1, AliVTrack* track2, AliVTrack* track3); // calculated distinctive variables
     void CalcSECVTXProperty(AliVTrack* track1, AliVTrack* track2, AliVTrack* track3, AliVTrack* track4); // calculated distinctive variables
+    void CalcSECVTXProperty(Int_t ntrk, const Int_t * const comb, const AliKFParticle * const kftrk, const Int_t * const trkid, const Bool_t * const kfok); // same for a combination of prepared KF particles
+    void MakeKFTracks(Int_t ntrk, AliVTrack * const * const tracks, AliKFParticle * const kftrk, Int_t * const trkid, Bool_t * const kfok); // KF particles of the tracks with their input pid
 
     void Fill4TrkSECVTX(AliVTrack* track, Int_t ipair, Int_t jpair, Int_t kpair);
     void Fill3TrkSECVTX(AliVTrack* track, Int_t ipair, Int_t jpair);
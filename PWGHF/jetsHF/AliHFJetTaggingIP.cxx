@@ -37,6 +37,7 @@
 #include "TVector3.h"
 #include "AliPicoTrack.h"
 #include "AliExternalTrackParam.h"
+#include "AliAnalysisManager.h"
 // c std lib
 #include <vector>
 #include <utility>
@@ -54,6 +55,9 @@ AliHFJetTaggingIP::AliHFJetTaggingIP(void)
 , fDiscriminators()
 , fTrackDCA(0)
 , fJetIndices()
+, fDCACacheIndex()
+, fDCACache()
+, fDCACacheEntry(-1)
 , fThresholdFuction(NULL)
 , fEvent(NULL)
 , fVertex(NULL)
@@ -67,6 +71,7 @@ AliHFJetTaggingIP::AliHFJetTaggingIP(void)
 	memset(fSelectionCuts, 0, sizeof fSelectionCuts);
 	memset(fCurrentTrack, 0, sizeof fCurrentTrack);
 	memset(fCurrentTrackDCAz, 0, sizeof fCurrentTrackDCAz);
+	memset(fCurrentVertexXYZ, 0, sizeof fCurrentVertexXYZ);
 	fAnaTypeAOD = kFALSE;
 	this->InitTrackSelectionParams(0x0);
 }
@@ -282,52 +287,16 @@ Bool_t AliHFJetTaggingIP::GetImpactParameter(AliVTrack* bTrack, Double_t* bSign,
 	//========================================================================
 	if(!bTrack || !this->fEvent || !this->fJet)
 		return kFALSE;
-	Int_t bSkipped[2];
-	Float_t bDiamondcovxy[3];
-	Double_t bPosAtDCA[2] = { -999, -999 };
-	Double_t bCovar[3] = { -999, -999, -999 };
-	Double_t bpV[3] = { 0., 0., 0. };
-	Double_t bpTrack[3] = { 0., 0., 0. };
-	Double_t bpTrackP[3] = { 0., 0., 0. };
-
-	const Double_t kBeampiperadius = 2.6;
-
-	this->fVertex = (AliVVertex*)this->fEvent->GetPrimaryVertex();
-	AliVertexerTracks* bVertexer = new AliVertexerTracks(fEvent->GetMagneticField());
-
-	bVertexer->SetITSMode();
-	bVertexer->SetMinClusters(4);
-	bSkipped[0] = bTrack->GetID();
-	bVertexer->SetSkipTracks(1, bSkipped);
-	bVertexer->SetConstraintOn();
-	fEvent->GetDiamondCovXY(bDiamondcovxy);
-
-	Double_t bpos[3] = { this->fEvent->GetDiamondX(), this->fEvent->GetDiamondY(), 0. };
-	Double_t bcov[6] = { bDiamondcovxy[0], bDiamondcovxy[1], bDiamondcovxy[2], 0., 0., 10. };
-	AliESDVertex* bDiamond = new AliESDVertex(bpos, bcov, 1., 1);
-
-	bVertexer->SetVtxStart(bDiamond);
-
-	this->fVertexRecalculated = bVertexer->FindPrimaryVertex(fEvent);
-	delete bDiamond;
-	bDiamond = 0x0;
-	delete bVertexer;
-	bVertexer = NULL;
-	if(this->fVertexRecalculated)
-		this->fVertex = this->fVertexRecalculated;
-
-	AliExternalTrackParam betp;
-	betp.CopyFromVTrack(bTrack);
-	if(!(betp.PropagateToDCA(fVertex, fEvent->GetMagneticField(), kBeampiperadius, bPosAtDCA, bCovar))) {
-		if(this->fVertexRecalculated) {
-			delete this->fVertexRecalculated;
-			this->fVertexRecalculated = NULL;
-		}
+	const Double_t* bCached = GetCachedTrackAtDCA(bTrack);
+	if(!bCached)
 		return kFALSE;
-	}
-	fVertex->GetXYZ(bpV);
-	betp.GetXYZ(bpTrack);
-	betp.GetPxPyPz(bpTrackP);
+	const Double_t* bpV = bCached + 1;
+	const Double_t* bpTrack = bCached + 4;
+	const Double_t* bpTrackP = bCached + 7;
+	const Double_t* bPosAtDCA = bCached + 10;
+	const Double_t* bCovar = bCached + 12;
+	for(Int_t i = 0; i < 3; ++i)
+		fCurrentVertexXYZ[i] = bpV[i];
 
 	Double_t bIPVector[3] = { bpTrack[0] - bpV[0], bpTrack[1] - bpV[1], bpTrack[2] - bpV[2] };
 	Double_t absIP =
@@ -347,7 +316,10 @@ Bool_t AliHFJetTaggingIP::GetImpactParameter(AliVTrack* bTrack, Double_t* bSign,
 	Double_t pJetArray[3];
 	fJet->PxPyPz(pJetArray);
 	if(fUseSignAtlas) {
-		*bSign = GetSignAtlasDefinition(bpTrack, bpTrackP, bpV, pJetArray);
+		Double_t bxDCA[3] = { bpTrack[0], bpTrack[1], bpTrack[2] };
+		Double_t bpDCA[3] = { bpTrackP[0], bpTrackP[1], bpTrackP[2] };
+		Double_t bxVtx[3] = { bpV[0], bpV[1], bpV[2] };
+		*bSign = GetSignAtlasDefinition(bxDCA, bpDCA, bxVtx, pJetArray);
 	}
 	*bIp2d = ptrIP;
 
@@ -364,6 +336,108 @@ Bool_t AliHFJetTaggingIP::GetImpactParameter(AliVTrack* bTrack, Double_t* bSign,
 
 	return kTRUE;
 }
+
+Bool_t AliHFJetTaggingIP::GetTrackAtDCA(AliVTrack* bTrack, Double_t* bValues)
+{
+	//========================================================================
+	// Re-calculates the event vertex without the track and propagates the track
+	// to its DCA. bValues: [0] status, [1-3] vertex, [4-6] track position and
+	// [7-9] momentum at the DCA, [10-11] impact parameters, [12-14] covariance
+	//========================================================================
+	Int_t bSkipped[2];
+	Float_t bDiamondcovxy[3];
+	Double_t bPosAtDCA[2] = { -999, -999 };
+	Double_t bCovar[3] = { -999, -999, -999 };
+
+	const Double_t kBeampiperadius = 2.6;
+
+	bValues[0] = 0.;
+	AliVVertex* bVertex = (AliVVertex*)this->fEvent->GetPrimaryVertex();
+	AliVertexerTracks* bVertexer = new AliVertexerTracks(fEvent->GetMagneticField());
+
+	bVertexer->SetITSMode();
+	bVertexer->SetMinClusters(4);
+	bSkipped[0] = bTrack->GetID();
+	bVertexer->SetSkipTracks(1, bSkipped);
+	bVertexer->SetConstraintOn();
+	fEvent->GetDiamondCovXY(bDiamondcovxy);
+
+	Double_t bpos[3] = { this->fEvent->GetDiamondX(), this->fEvent->GetDiamondY(), 0. };
+	Double_t bcov[6] = { bDiamondcovxy[0], bDiamondcovxy[1], bDiamondcovxy[2], 0., 0., 10. };
+	AliESDVertex* bDiamond = new AliESDVertex(bpos, bcov, 1., 1);
+
+	bVertexer->SetVtxStart(bDiamond);
+
+	AliESDVertex* bVertexRecalculated = bVertexer->FindPrimaryVertex(fEvent);
+	delete bDiamond;
+	bDiamond = 0x0;
+	delete bVertexer;
+	bVertexer = NULL;
+	if(bVertexRecalculated)
+		bVertex = bVertexRecalculated;
+
+	AliExternalTrackParam betp;
+	betp.CopyFromVTrack(bTrack);
+	Bool_t bPropagated = betp.PropagateToDCA(bVertex, fEvent->GetMagneticField(), kBeampiperadius, bPosAtDCA, bCovar);
+	if(bPropagated) {
+		bVertex->GetXYZ(bValues + 1);
+		betp.GetXYZ(bValues + 4);
+		betp.GetPxPyPz(bValues + 7);
+		bValues[10] = bPosAtDCA[0];
+		bValues[11] = bPosAtDCA[1];
+		bValues[12] = bCovar[0];
+		bValues[13] = bCovar[1];
+		bValues[14] = bCovar[2];
+		bValues[0] = 1.;
+	}
+	if(bVertexRecalculated)
+		delete bVertexRecalculated;
+	return bPropagated;
+}
+
+const Double_t* AliHFJetTaggingIP::GetCachedTrackAtDCA(AliVTrack* bTrack)
+{
+	//========================================================================
+	// Track at its DCA to the vertex recalculated without it, computed once per
+	// track and event inside the event loop of the analysis manager
+	// NULL if the propagation failed
+	//========================================================================
+	AliAnalysisManager* bManager = AliAnalysisManager::GetAnalysisManager();
+	Long64_t bEntry = bManager ? bManager->GetCurrentEntry() : -1;
+	if(bEntry < 0) {
+		// no event loop, no caching
+		ClearDCACache();
+		fDCACache.resize(kDCACacheSize);
+		if(!GetTrackAtDCA(bTrack, &fDCACache[0]))
+			return NULL;
+		return &fDCACache[0];
+	}
+	if(bEntry != fDCACacheEntry) {
+		ClearDCACache();
+		fDCACacheEntry = bEntry;
+	}
+	std::map<const AliVTrack*, Int_t>::const_iterator bFound = fDCACacheIndex.find(bTrack);
+	Int_t bOffset = 0;
+	if(bFound != fDCACacheIndex.end()) {
+		bOffset = bFound->second;
+	} else {
+		bOffset = fDCACache.size();
+		fDCACache.resize(bOffset + kDCACacheSize);
+		fDCACacheIndex[bTrack] = bOffset;
+		GetTrackAtDCA(bTrack, &fDCACache[bOffset]);
+	}
+	if(fDCACache[bOffset] < 0.5)
+		return NULL;
+	return &fDCACache[bOffset];
+}
+
+void AliHFJetTaggingIP::ClearDCACache()
+{
+	fDCACacheIndex.clear();
+	fDCACache.clear();
+	fDCACacheEntry = -1;
+}
+
 Double_t AliHFJetTaggingIP::GetDecayLength(AliVTrack* bTrack)
 {
 	//========================================================================
@@ -378,7 +452,8 @@ Double_t AliHFJetTaggingIP::GetDecayLength(AliVTrack* bTrack)
 	Double_t xa = 0., xb = 0.;
 	Double_t xyz[3] = { 0., 0., 0. };
 	Double_t xyzb[3] = { 0., 0., 0. };
-	this->fVertex->GetXYZ(bpos);
+	for(Int_t i = 0; i < 3; ++i)
+		bpos[i] = fCurrentVertexXYZ[i]; // vertex of the current track, see GetImpactParameter
 	AliExternalTrackParam bjetparam(bpos, bpxpypz, bcv, (Short_t)0);
 	AliExternalTrackParam betp;
 	betp.CopyFromVTrack(bTrack);
@@ -2,6 +2,7 @@
 #define ALIHFJETTAGGINGIP_H
 /* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
 * See cxx source for full Copyright notice */
+#include <map>
 #include <utility>
 #include <vector>
 
@@ -17,6 +18,7 @@ class AliHFJetTaggingIP
 {
 public:
     enum { S_ITSNCLS, S_MINNTRACKS, S_PTTRACK, S_DECAYLENGTH, S_TRANSVERSEIP, S_TRACKCHI2, S_MAXDCAJETTRACK,S_MAXDCAZ };
+    enum { kDCACacheSize = 15 };
 
     AliHFJetTaggingIP();
     virtual ~AliHFJetTaggingIP();
@@ -25,6 +27,7 @@ public:
     void SetEvent(AliVEvent* bEvent)
     {
 	fEvent = bEvent;
+	ClearDCACache();
     };
     void SetParticleContainer(AliParticleContainer* particles)
     {
@@ -52,6 +55,9 @@ private:
     Double_t GetSignAtlasDefinition(Double_t* xDCA, Double_t* pDCA, Double_t* xVtx, Double_t* pJet);
     static bool mysort(const std::pair<Int_t, Double_t>& i, const std::pair<Int_t, Double_t>& j);
     void SetCurrentDCAz();
+    Bool_t GetTrackAtDCA(AliVTrack* bTrack, Double_t* bValues);
+    const Double_t* GetCachedTrackAtDCA(AliVTrack* bTrack);
+    void ClearDCACache();
     Bool_t fUseThresholdFuction;
     Bool_t fAnaTypeAOD;
     Bool_t fUseSignAtlas;
@@ -66,6 +72,13 @@ private:
     std::vector<Double_t> fDiscriminators;              //
     std::vector<std::pair<Int_t, Double_t> > fTrackDCA; //
     std::vector<unsigned int> fJetIndices; // //Indices to get matched MC jet
+    // The vertex refitted without the track and the track at its DCA to it do not
+    // depend on the jet: they are computed once per track and event and reused
+    // for all the jets and quality classes, only the sign is evaluated per jet
+    std::map<const AliVTrack*, Int_t> fDCACacheIndex; //! offset of each track in fDCACache
+    std::vector<Double_t> fDCACache;                  //! kDCACacheSize values per track, see GetTrackAtDCA
+    Long64_t fDCACacheEntry;                          //! analysis manager entry of the cache
+    Double_t fCurrentVertexXYZ[3];                    //! vertex used for the current track
 	
     TF1* fThresholdFuction;           //!
     AliVEvent* fEvent;                //!
@@ -74,6 +87,6 @@ private:
     AliEmcalJet* fJet;                //!
     AliParticleContainer* fParticles; //! Particle container containing AliVTracks
 
-    ClassDef(AliHFJetTaggingIP, 1);
+    ClassDef(AliHFJetTaggingIP, 2);
 };
 #endif
@@ -109,6 +109,9 @@ public:
   void SetPtThresholdTPC(Double_t ptThresholdTPC){fPtThresholdTPC=ptThresholdTPC;return;}
   void SetMaxTrackMomForCombinedPID(Double_t mom){fMaxTrackMomForCombinedPID=mom;}
   void SetPidResponse(AliPIDResponse *pidResp) {fPidResponse=pidResp;return;}
+  /// take the n-sigmas from the per event AliPIDResponseCache shared with the other wagons,
+  /// only for tracks of the current input event (not for event mixing pools)
+  void SetUsePIDResponseCache(Bool_t flag=kTRUE) {fUsePIDResponseCache=flag;return;}
   void SetCombDetectors(ECombDetectors pidComb) {
     fCombDetectors=pidComb;
   }
@@ -155,6 +158,7 @@ public:
   Double_t GetnSigmaCompatTPC() const{return fnSigmaCompat[0];}
   Double_t GetnSigmaCompatTOF() const{return fnSigmaCompat[1];}
   Bool_t GetOldPid(){return fOldPid;}
+  Bool_t GetUsePIDResponseCache() const {return fUsePIDResponseCache;}
   Double_t GetPtThresholdTPC(){return fPtThresholdTPC;}
   Double_t GetMaxTrackMomForCombinedPID(){return fMaxTrackMomForCombinedPID;}
   AliPIDResponse *GetPidResponse() const {return fPidResponse;}
@@ -230,6 +234,7 @@ protected:
 private:
 
   AliAODPidHF& operator=(const AliAODPidHF& pid);
+  Float_t GetPidResponseNSigma(AliPIDResponse::EDetector detector, AliAODTrack *track, AliPID::EParticleType type) const;
 
   Int_t fnNSigma; /// number of sigmas
   /// sigma for the raw signal PID: 0-2 for TPC, 3 for TOF, 4 for ITS
@@ -283,6 +288,7 @@ private:
   ECombDetectors fCombDetectors; /// detectors to be involved for combined PID
   Bool_t fUseCombined; /// detectors to be involved for combined PID
   Bool_t fDefaultPriors; /// use default priors for combined PID
+  Bool_t fUsePIDResponseCache; /// n-sigmas from AliPIDResponseCache
 
   /// Storage of identification/compatibility band for different species and detectors:
   TF1 *fIdBandMin[AliPID::kSPECIES][4];
@@ -291,7 +297,7 @@ private:
   TF1 *fCompBandMax[AliPID::kSPECIES][4];
 
   /// \cond CLASSIMP
-  ClassDef(AliAODPidHF,24); /// AliAODPid for heavy flavor PID
+  ClassDef(AliAODPidHF,25); /// AliAODPid for heavy flavor PID
   /// \endcond
 
 };
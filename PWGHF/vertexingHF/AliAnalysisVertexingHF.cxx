@@ -138,6 +138,10 @@ fFindVertexForDstar(kTRUE),
 fFindVertexForCascades(kTRUE),
 fV0TypeForCascadeVertex(0),
 fMassCutBeforeVertexing(kFALSE),
+fUseHelixPreselection(kFALSE),
+fUseVertexCache(kFALSE),
+fVtxCacheIndex(),
+fVtxCacheValues(),
 fMassCalc2(0),
 fMassCalc3(0),
 fMassCalc4(0),
@@ -233,6 +237,10 @@ fFindVertexForDstar(source.fFindVertexForDstar),
 fFindVertexForCascades(source.fFindVertexForCascades),
 fV0TypeForCascadeVertex(source.fV0TypeForCascadeVertex),
 fMassCutBeforeVertexing(source.fMassCutBeforeVertexing),
+fUseHelixPreselection(source.fUseHelixPreselection),
+fUseVertexCache(source.fUseVertexCache),
+fVtxCacheIndex(),
+fVtxCacheValues(),
 fMassCalc2(source.fMassCalc2),
 fMassCalc3(source.fMassCalc3),
 fMassCalc4(source.fMassCalc4),
@@ -327,6 +335,8 @@ AliAnalysisVertexingHF &AliAnalysisVertexingHF::operator=(const AliAnalysisVerte
   fFindVertexForCascades = source.fFindVertexForCascades;
   fV0TypeForCascadeVertex = source.fV0TypeForCascadeVertex;
   fMassCutBeforeVertexing = source.fMassCutBeforeVertexing;
+  fUseHelixPreselection = source.fUseHelixPreselection;
+  fUseVertexCache = source.fUseVertexCache;
   fMassCalc2 = source.fMassCalc2;
   fMassCalc3 = source.fMassCalc3;
   fMassCalc4 = source.fMassCalc4;
@@ -618,6 +628,17 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   AliDebug(1,Form(" Selected tracks: %d",nSeleTrks));
   fnSeleTrksTotal += nSeleTrks;
 
+  // transverse helix circles of the tracks at the primary vertex,
+  // used to reject combinations before computing the DCA between tracks
+  Double_t *helixCircles = 0x0;
+  if(fUseHelixPreselection) {
+    helixCircles = new Double_t[5*nSeleTrks];
+    for(Int_t iTrk=0; iTrk<nSeleTrks; iTrk++)
+      GetHelixCircle((AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrk),&helixCircles[5*iTrk]);
+  }
+  fVtxCacheIndex.clear();
+  fVtxCacheValues.clear();
+
 
   TObjArray *twoTrackArray1    = new TObjArray(2);
   TObjArray *twoTrackArray2    = new TObjArray(2);
@@ -867,13 +888,14 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
       negtrack1->GetPxPyPz(momneg1);
 
       // DCA between the two tracks
+      if(helixCircles && GetDCALowerBound(&helixCircles[5*iTrkP1],&helixCircles[5*iTrkN1])>dcaMax) { negtrack1=0; continue; }
       dcap1n1 = postrack1->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
       if(dcap1n1>dcaMax) { negtrack1=0; continue; }
 
       // Vertexing
       twoTrackArray1->AddAt(postrack1,0);
       twoTrackArray1->AddAt(negtrack1,1);
-      AliAODVertex *vertexp1n1 = ReconstructSecondaryVertex(twoTrackArray1,dispersion);
+      AliAODVertex *vertexp1n1 = ReconstructSecondaryVertexCached(twoTrackArray1,iTrkP1,iTrkN1,nSeleTrks,dispersion);
       if(!vertexp1n1) {
 	twoTrackArray1->Clear();
 	negtrack1=0;
@@ -1131,6 +1153,8 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
 	//printf("********** %d %d %d\n",postrack1->GetID(),postrack2->GetID(),negtrack1->GetID());
 
+	if(helixCircles && (GetDCALowerBound(&helixCircles[5*iTrkP2],&helixCircles[5*iTrkN1])>dcaMax ||
+			    GetDCALowerBound(&helixCircles[5*iTrkP2],&helixCircles[5*iTrkP1])>dcaMax)) { postrack2=0; continue; }
 	dcap2n1 = postrack2->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
 	if(dcap2n1>dcaMax) { postrack2=0; continue; }
 	dcap1p2 = postrack2->GetDCA(postrack1,fBzkG,xdummy,ydummy);
@@ -1169,7 +1193,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	// Vertexing
 	twoTrackArray2->AddAt(postrack2,0);
 	twoTrackArray2->AddAt(negtrack1,1);
-	AliAODVertex *vertexp2n1 = ReconstructSecondaryVertex(twoTrackArray2,dispersion);
+	AliAODVertex *vertexp2n1 = ReconstructSecondaryVertexCached(twoTrackArray2,iTrkP2,iTrkN1,nSeleTrks,dispersion);
 	if(!vertexp2n1) {
 	  twoTrackArray2->Clear();
 	  postrack2=0;
@@ -1275,6 +1299,8 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    SetParametersAtVertex(postrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkP2));
 	    SetParametersAtVertex(negtrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN2));
 
+	    if(helixCircles && (GetDCALowerBound(&helixCircles[5*iTrkP1],&helixCircles[5*iTrkN2])>fCutsD0toKpipipi->GetDCACut() ||
+				GetDCALowerBound(&helixCircles[5*iTrkP2],&helixCircles[5*iTrkN2])>fCutsD0toKpipipi->GetDCACut())) { negtrack2=0; continue; }
 	    dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
 	    if(dcap1n2 > fCutsD0toKpipipi->GetDCACut()) { negtrack2=0; continue; }
             dcap2n2 = postrack2->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
@@ -1409,6 +1435,8 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	SetParametersAtVertex(negtrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN2));
 	//printf("********** %d %d %d\n",postrack1->GetID(),negtrack1->GetID(),negtrack2->GetID());
 
+	if(helixCircles && (GetDCALowerBound(&helixCircles[5*iTrkP1],&helixCircles[5*iTrkN2])>dcaMax ||
+			    GetDCALowerBound(&helixCircles[5*iTrkN1],&helixCircles[5*iTrkN2])>dcaMax)) { negtrack2=0; continue; }
 	dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
 	if(dcap1n2>dcaMax) { negtrack2=0; continue; }
 	dcan1n2 = negtrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
@@ -1438,7 +1466,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	twoTrackArray2->AddAt(postrack1,0);
 	twoTrackArray2->AddAt(negtrack2,1);
 
-	AliAODVertex *vertexp1n2 = ReconstructSecondaryVertex(twoTrackArray2,dispersion);
+	AliAODVertex *vertexp1n2 = ReconstructSecondaryVertexCached(twoTrackArray2,iTrkP1,iTrkN2,nSeleTrks,dispersion);
 	if(!vertexp1n2) {
 	  twoTrackArray2->Clear();
 	  negtrack2=0;
@@ -1545,6 +1573,9 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   threeTrackArray->Delete(); delete threeTrackArray;
   fourTrackArray->Delete();  delete fourTrackArray;
   delete [] seleFlags; seleFlags=NULL;
+  if(helixCircles) {delete [] helixCircles; helixCircles=NULL;}
+  fVtxCacheIndex.clear();
+  fVtxCacheValues.clear();
   if(evtNumber) {delete [] evtNumber; evtNumber=NULL;}
   tracksAtVertex.Delete();
 
@@ -2895,6 +2926,7 @@ void AliAnalysisVertexingHF::PrintStatus() const {
   }
   if(fRecoPrimVtxSkippingTrks) printf("RecoPrimVtxSkippingTrks\n");
   if(fRmTrksFromPrimVtx) printf("RmTrksFromPrimVtx\n");
+  if(fUseHelixPreselection) printf("Track combinations preselected with helix DCA lower bound\n");
   if(fD0toKpi) {
     printf("Reconstruct D0->Kpi candidates with cuts:\n");
     if(fCutsD0toKpi) fCutsD0toKpi->PrintAll();
@@ -3001,6 +3033,43 @@ AliAODVertex* AliAnalysisVertexingHF::ReconstructSecondaryVertex(TObjArray *trkA
   return vertexAOD;
 }
 //-----------------------------------------------------------------------------
+AliAODVertex* AliAnalysisVertexingHF::ReconstructSecondaryVertexCached(TObjArray *twoTrkArray,
+								       Int_t iTrk1,Int_t iTrk2,Int_t nSeleTrks,
+								       Double_t &dispersion)
+{
+  /// 2-prong secondary vertex for the selected tracks iTrk1 and iTrk2 (in this order).
+  /// The same pairs are fitted again as seeds of the 3-prong candidates, with the tracks
+  /// reset to the same parameters at the primary vertex: the fit result is kept for the
+  /// event and a new identical AliAODVertex is returned for the following requests
+
+  if(!fUseVertexCache) return ReconstructSecondaryVertex(twoTrkArray,dispersion);
+
+  Long64_t key=(Long64_t)iTrk1*nSeleTrks+iTrk2;
+  std::map<Long64_t,Int_t>::const_iterator it=fVtxCacheIndex.find(key);
+  if(it!=fVtxCacheIndex.end()) {
+    if(it->second<0) return 0x0;
+    const Double_t *val=&fVtxCacheValues[it->second];
+    dispersion=val[10];
+    return new AliAODVertex(&val[0],&val[3],val[9],0x0,-1,AliAODVertex::kUndef,0);
+  }
+
+  AliAODVertex *vertexAOD=ReconstructSecondaryVertex(twoTrkArray,dispersion);
+  if(!vertexAOD) {
+    fVtxCacheIndex[key]=-1;
+    return vertexAOD;
+  }
+  fVtxCacheIndex[key]=fVtxCacheValues.size();
+  Double_t pos[3],cov[6];
+  vertexAOD->GetXYZ(pos);
+  vertexAOD->GetCovarianceMatrix(cov);
+  fVtxCacheValues.insert(fVtxCacheValues.end(),pos,pos+3);
+  fVtxCacheValues.insert(fVtxCacheValues.end(),cov,cov+6);
+  fVtxCacheValues.push_back(vertexAOD->GetChi2perNDF());
+  fVtxCacheValues.push_back(dispersion);
+
+  return vertexAOD;
+}
+//-----------------------------------------------------------------------------
 Bool_t AliAnalysisVertexingHF::SelectInvMassAndPt3prong(TObjArray *trkArray){
   /// Invariant mass cut on tracks
   //AliCodeTimerAuto("",0);
@@ -3695,6 +3764,49 @@ void AliAnalysisVertexingHF::SetParametersAtVertex(AliESDtrack* esdt, const AliE
   return;
 }
 //-----------------------------------------------------------------------------
+void AliAnalysisVertexingHF::GetHelixCircle(const AliExternalTrackParam* extpar, Double_t *par) const {
+  /// Store the centre and radius of the transverse projection of the track helix
+  /// and the track position errors: par = {xc, yc, R, sigmaY2, sigmaZ2}.
+  /// R<0 flags straight tracks, for which no bound is computed
+
+  Double_t pos[3],mom[3];
+  extpar->GetXYZ(pos);
+  extpar->GetPxPyPz(mom);
+  Double_t pt=TMath::Sqrt(mom[0]*mom[0]+mom[1]*mom[1]);
+  Double_t crv=extpar->GetC(fBzkG);
+  par[3]=extpar->GetSigmaY2();
+  par[4]=extpar->GetSigmaZ2();
+  if(pt<kAlmost0 || TMath::Abs(crv)<kAlmost0) {
+    par[0]=pos[0]; par[1]=pos[1]; par[2]=-1.;
+    return;
+  }
+  // the centre lies on the left of the direction of motion for positive curvature
+  Double_t r=1./crv;
+  par[0]=pos[0]-r*mom[1]/pt;
+  par[1]=pos[1]+r*mom[0]/pt;
+  par[2]=TMath::Abs(r);
+  return;
+}
+//-----------------------------------------------------------------------------
+Double_t AliAnalysisVertexingHF::GetDCALowerBound(const Double_t *par1, const Double_t *par2) const {
+  /// Lower bound on AliExternalTrackParam::GetDCA() between two tracks from the
+  /// distance of their transverse circles. GetDCA() returns a distance weighted
+  /// with (sigmaZ2/sigmaY2)^(1/4) in the transverse plane, hence the factor.
+  /// Combinations with a bound above the DCA cut would fail the cut anyway
+
+  if(par1[2]<0. || par2[2]<0.) return 0.;
+  Double_t sy2=par1[3]+par2[3];
+  Double_t sz2=par1[4]+par2[4];
+  if(sy2<=0. || sz2<=0.) return 0.;
+  Double_t dx=par1[0]-par2[0];
+  Double_t dy=par1[1]-par2[1];
+  Double_t d=TMath::Sqrt(dx*dx+dy*dy);
+  Double_t gap=TMath::Max(d-(par1[2]+par2[2]),TMath::Abs(par1[2]-par2[2])-d);
+  if(gap<=0.) return 0.;
+  Double_t weight=TMath::Min(1.,TMath::Sqrt(TMath::Sqrt(sz2/sy2)));
+  return gap*weight;
+}
+//-----------------------------------------------------------------------------
 void AliAnalysisVertexingHF::SetMasses(){
   /// Set the hadron mass values from TDatabasePDG
 
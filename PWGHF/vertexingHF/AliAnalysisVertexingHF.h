@@ -13,6 +13,8 @@
 /// \author Contact: andrea.dainese@pd.infn.it
 //-------------------------------------------------------------------------
 
+#include <map>
+#include <vector>
 #include <TNamed.h>
 #include <TList.h>
 
@@ -179,6 +181,8 @@ class AliAnalysisVertexingHF : public TNamed {
   void SetCutsDStartoKpipi(AliRDHFCutsDStartoKpipi* cuts) { fCutsDStartoKpipi = cuts; }
   AliRDHFCutsDStartoKpipi* GetCutsDStartoKpipi() const { return fCutsDStartoKpipi; }
   void SetMassCutBeforeVertexing(Bool_t flag) { fMassCutBeforeVertexing=flag; }
+  void SetUseHelixPreselection(Bool_t flag=kTRUE) { fUseHelixPreselection=flag; }
+  void SetUseVertexCache(Bool_t flag=kTRUE) { fUseVertexCache=flag; }
 
   void SetMasses();
   Bool_t CheckCutsConsistency();
@@ -324,6 +328,10 @@ class AliAnalysisVertexingHF : public TNamed {
   Bool_t fFindVertexForCascades;  /// reconstruct a secondary vertex or assume it's from the primary vertex
   Int_t  fV0TypeForCascadeVertex;  /// Select which V0 type we want to use for the cascas
   Bool_t fMassCutBeforeVertexing; /// to go faster in PbPb
+  Bool_t fUseHelixPreselection; /// reject track combinations by a lower bound on their DCA before GetDCA
+  Bool_t fUseVertexCache; /// reuse the 2-prong vertices fitted for a track pair within the event
+  std::map<Long64_t,Int_t> fVtxCacheIndex; //! track pair -> offset in fVtxCacheValues, -1 if the fit failed
+  std::vector<Double_t> fVtxCacheValues;  //! position, covariance, chi2/ndf and dispersion of the cached vertices
   // dummies for invariant mass calculation
   AliAODRecoDecay *fMassCalc2; /// for 2 prong
   AliAODRecoDecay *fMassCalc3; /// for 3 prong
@@ -393,6 +401,7 @@ class AliAnalysisVertexingHF : public TNamed {
   void MapAODtracks(AliVEvent *aod);
   AliAODVertex* PrimaryVertex(const TObjArray *trkArray=0x0,AliVEvent *event=0x0) const;
   AliAODVertex* ReconstructSecondaryVertex(TObjArray *trkArray,Double_t &dispersion,Bool_t useTRefArray=kTRUE) const;
+  AliAODVertex* ReconstructSecondaryVertexCached(TObjArray *twoTrkArray,Int_t iTrk1,Int_t iTrk2,Int_t nSeleTrks,Double_t &dispersion);
 
   Bool_t SelectInvMassAndPt3prong(Double_t *px,Double_t *py,Double_t *pz, Int_t pidLcStatus=3);
   Bool_t SelectInvMassAndPt4prong(Double_t *px,Double_t *py,Double_t *pz);
@@ -411,6 +420,8 @@ class AliAnalysisVertexingHF : public TNamed {
 				   Int_t &nSeleTrks,
 				   UChar_t *seleFlags,Int_t *evtNumber);
   void SetParametersAtVertex(AliESDtrack* esdt, const AliExternalTrackParam* extpar) const;
+  void GetHelixCircle(const AliExternalTrackParam* extpar, Double_t *par) const;
+  Double_t GetDCALowerBound(const Double_t *par1, const Double_t *par2) const;
 
   Bool_t SingleTrkCuts(AliESDtrack *trk,Float_t centralityperc, Bool_t &okDisplaced,Bool_t &okSoftPi, Bool_t &ok3prong, Bool_t &okBachelor) const;
 
@@ -420,7 +431,7 @@ class AliAnalysisVertexingHF : public TNamed {
 				  TObjArray *twoTrackArrayV0);
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisVertexingHF,27);  // Reconstruction of HF decay candidates
+  ClassDef(AliAnalysisVertexingHF,28);  // Reconstruction of HF decay candidates
   /// \endcond
 };
 
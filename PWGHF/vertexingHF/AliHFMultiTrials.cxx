@@ -65,6 +65,7 @@ AliHFMultiTrials::AliHFMultiTrials() :
   fUseFixSigFixMean(kTRUE),
   fSaveBkgVal(kFALSE),
   fDrawIndividualFits(kFALSE),
+  fUseWarmStart(kFALSE),
   fHistoRawYieldDistAll(0x0),
   fHistoRawYieldTrialAll(0x0),
   fHistoSigmaTrialAll(0x0),
@@ -199,6 +200,16 @@ Bool_t AliHFMultiTrials::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad){
   fMaxYieldGlob=0.;
   Float_t xnt[15];
 
+  // mean and sigma of the last accepted fit of each case, used as starting values
+  // for the next trial of the same case (neighbouring fit range) if fUseWarmStart
+  const Int_t nCases=kNBkgFuncCases*kNFitConfCases;
+  Double_t lastMean[nCases];
+  Double_t lastSigma[nCases];
+  for(Int_t ic=0; ic<nCases; ic++){
+    lastMean[ic]=-1.;
+    lastSigma[ic]=-1.;
+  }
+
   for(Int_t ir=0; ir<fNumOfRebinSteps; ir++){
     Int_t rebin=fRebinSteps[ir];
     for(Int_t iFirstBin=1; iFirstBin<=fNumOfFirstBinSteps; iFirstBin++) {
@@ -248,13 +259,19 @@ Bool_t AliHFMultiTrials::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad){
 	      fitter->SetReflectionSigmaFactor(0);
 	      //if D0 Reflection
 	      if(fhTemplRefl){
+		delete fitter;
 		fitter=new AliHFMassFitterVAR(hRebinned,hmin,hmax,1,typeb,2);
 		fitter->SetTemplateReflections((TH1*)fhTemplRefl);
 		fitter->SetFixReflOverS(fFixRefloS,kTRUE);
 	      }
 	      if(fFitOption==1) fitter->SetUseChi2Fit();
-	      fitter->SetInitialGaussianMean(fMassD);
-	      fitter->SetInitialGaussianSigma(fSigmaGausMC);
+	      if(fUseWarmStart && lastSigma[theCase]>0.){
+		fitter->SetInitialGaussianMean(lastMean[theCase]);
+		fitter->SetInitialGaussianSigma(lastSigma[theCase]);
+	      }else{
+		fitter->SetInitialGaussianMean(fMassD);
+		fitter->SetInitialGaussianSigma(fSigmaGausMC);
+	      }
 	      xnt[0]=rebin;
 	      xnt[1]=iFirstBin;
 	      xnt[2]=minMassForFit;
@@ -373,6 +390,8 @@ Bool_t AliHFMultiTrials::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad){
 
 		if(ry<fMinYieldGlob) fMinYieldGlob=ry;
 		if(ry>fMaxYieldGlob) fMaxYieldGlob=ry;
+		lastMean[theCase]=pos;
+		lastSigma[theCase]=sigma;
 		fHistoRawYieldDist[theCase]->Fill(ry);
 		fHistoRawYieldTrial[theCase]->SetBinContent(itrial,ry);
 		fHistoRawYieldTrial[theCase]->SetBinError(itrial,ery);
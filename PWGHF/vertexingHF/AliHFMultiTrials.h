@@ -80,6 +80,7 @@ class AliHFMultiTrials : public TNamed {
   void SetSaveBkgValue(Bool_t opt=kTRUE, Double_t nsigma=3) {fSaveBkgVal=opt; fnSigmaForBkgEval=nsigma;}
 
   void SetDrawIndividualFits(Bool_t opt=kTRUE){fDrawIndividualFits=opt;}
+  void SetUseWarmStart(Bool_t opt=kTRUE){fUseWarmStart=opt;}
 
   Bool_t DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad=0x0);
   void SaveToRoot(TString fileName, TString option="recreate") const;
@@ -137,6 +138,7 @@ class AliHFMultiTrials : public TNamed {
   Bool_t fSaveBkgVal;		/// switch for saving bkg values in nsigma
 
   Bool_t fDrawIndividualFits; /// flag for drawing fits
+  Bool_t fUseWarmStart;       /// seed mean and sigma from the last accepted fit of the same case
  
   TH1F* fHistoRawYieldDistAll;  /// histo with yield from all trials
   TH1F* fHistoRawYieldTrialAll; /// histo with yield from all trials
@@ -169,7 +171,7 @@ class AliHFMultiTrials : public TNamed {
   Double_t fMaxYieldGlob;   /// maximum yield
 
   /// \cond CLASSIMP    
-  ClassDef(AliHFMultiTrials,5); /// class for multiple trials of invariant mass fit
+  ClassDef(AliHFMultiTrials,6); /// class for multiple trials of invariant mass fit
   /// \endcond
 };
 
@@ -542,13 +542,22 @@ void  AliMultiDimVector::GetFillRange(Int_t iVar, Int_t iCell, Int_t& minbin, In
 //_____________________________________________________________________________ 
 void AliMultiDimVector::Integrate(){
   // integrates the matrix
+  // the counts above each cell are obtained with one cumulative sum
+  // along each cut variable (from tight to loose cuts), instead of
+  // summing the whole hyper-rectangle above every cell
   if(fIsIntegrated){
     AliError("MultiDimVector already integrated");
     return;
   }
-  TArrayF integral(fNTotCells);
-  for(ULong64_t i=0;i<fNTotCells;i++) integral[i]=CountsAboveCell(i);
-  for(ULong64_t i=0;i<fNTotCells;i++) fVett[i]= integral[i];
+  ULong64_t stride[fgkMaxNVariables];
+  GetStrides(stride);
+  for(Int_t i=0;i<fNVariables;i++){
+    ULong64_t nLast=fNCutSteps[i]-1;
+    for(ULong64_t j=fNTotCells;j>0;j--){
+      ULong64_t globadd=j-1;
+      if((globadd/stride[i])%fNCutSteps[i]<nLast) fVett[globadd]+=fVett[globadd+stride[i]];
+    }
+  }
   fIsIntegrated=kTRUE;
 }//_____________________________________________________________________________ 
 ULong64_t* AliMultiDimVector::GetGlobalAddressesAboveCuts(const Float_t *values, Int_t ptbin, Int_t& nVals) const{
@@ -560,38 +569,22 @@ ULong64_t* AliMultiDimVector::GetGlobalAddressesAboveCuts(const Float_t *values,
     nVals=0;
     return 0x0;
   }
-  for(Int_t i=fNVariables; i<fgkMaxNVariables; i++) ind[i]=0;
   Int_t mink[fgkMaxNVariables];
   Int_t maxk[fgkMaxNVariables];
   Int_t size=1;
-  for(Int_t i=0;i<fgkMaxNVariables;i++){
+  for(Int_t i=0;i<fNVariables;i++){
     GetFillRange(i,ind[i],mink[i],maxk[i]);
     size*=(maxk[i]-mink[i]+1);
   }
   ULong64_t* indexes=new ULong64_t[size];
   nVals=0;
-  for(Int_t k0=mink[0]; k0<=maxk[0]; k0++){
-    for(Int_t k1=mink[1]; k1<=maxk[1]; k1++){
-      for(Int_t k2=mink[2]; k2<=maxk[2]; k2++){
-	for(Int_t k3=mink[3]; k3<=maxk[3]; k3++){
-	  for(Int_t k4=mink[4]; k4<=maxk[4]; k4++){
-	    for(Int_t k5=mink[5]; k5<=maxk[5]; k5++){
-	      for(Int_t k6=mink[6]; k6<=maxk[6]; k6++){
-		for(Int_t k7=mink[7]; k7<=maxk[7]; k7++){
-		  for(Int_t k8=mink[8]; k8<=maxk[8]; k8++){
-		    for(Int_t k9=mink[9]; k9<=maxk[9]; k9++){
-		      Int_t currentBin[fgkMaxNVariables]={k0,k1,k2,k3,k4,k5,k6,k7,k8,k9};
-		      indexes[nVals++]=GetGlobalAddressFromIndices(currentBin,ptbin);
-		    }
-		  }
-		}
-	      }
-	    }
-	  }
-	}
-      }
-    }
-  }
+  ULong64_t stride[fgkMaxNVariables];
+  GetStrides(stride);
+  Int_t k[fgkMaxNVariables];
+  ULong64_t globadd=StartBox(mink,ptbin,stride,k);
+  do{
+    indexes[nVals++]=globadd;
+  }while(NextInBox(mink,maxk,stride,k,globadd));
   return indexes;
 }
 //_____________________________________________________________________________ 
@@ -600,35 +593,19 @@ Float_t AliMultiDimVector::CountsAboveCell(ULong64_t globadd) const{
   Int_t ind[fgkMaxNVariables];
   Int_t ptbin;
   GetIndicesFromGlobalAddress(globadd,ind,ptbin);
-  for(Int_t i=fNVariables; i<fgkMaxNVariables; i++) ind[i]=0;
   Int_t mink[fgkMaxNVariables];
   Int_t maxk[fgkMaxNVariables];
-  for(Int_t i=0;i<fgkMaxNVariables;i++){
+  for(Int_t i=0;i<fNVariables;i++){
     GetIntegrationLimits(i,ind[i],mink[i],maxk[i]);
   }
+  ULong64_t stride[fgkMaxNVariables];
+  GetStrides(stride);
+  Int_t k[fgkMaxNVariables];
+  ULong64_t cell=StartBox(mink,ptbin,stride,k);
   Float_t sumcont=0.;
-  for(Int_t k0=mink[0]; k0<=maxk[0]; k0++){
-    for(Int_t k1=mink[1]; k1<=maxk[1]; k1++){
-      for(Int_t k2=mink[2]; k2<=maxk[2]; k2++){
-	for(Int_t k3=mink[3]; k3<=maxk[3]; k3++){
-	  for(Int_t k4=mink[4]; k4<=maxk[4]; k4++){
-	    for(Int_t k5=mink[5]; k5<=maxk[5]; k5++){
-	      for(Int_t k6=mink[6]; k6<=maxk[6]; k6++){
-		for(Int_t k7=mink[7]; k7<=maxk[7]; k7++){
-		  for(Int_t k8=mink[8]; k8<=maxk[8]; k8++){
-		    for(Int_t k9=mink[9]; k9<=maxk[9]; k9++){
-		      Int_t currentBin[fgkMaxNVariables]={k0,k1,k2,k3,k4,k5,k6,k7,k8,k9};
-		      sumcont+=GetElement(currentBin,ptbin);
-		    }
-		  }
-		}
-	      }
-	    }
-	  }
-	}
-      }
-    }
-  }
+  do{
+    sumcont+=fVett[cell];
+  }while(NextInBox(mink,maxk,stride,k,cell));
   return sumcont;
 }
 //_____________________________________________________________________________ 
@@ -646,40 +623,56 @@ void AliMultiDimVector::Fill(Float_t* values, Int_t ptbin){
 //_____________________________________________________________________________ 
 void AliMultiDimVector::FillAndIntegrate(Float_t* values, Int_t ptbin){
   // fills the cells of AliMultiDimVector passing the cuts
-  // The number of nested loops must match fgkMaxNVariables!!!!
   fIsIntegrated=kTRUE;
   Int_t ind[fgkMaxNVariables];
   Bool_t retcode=GetIndicesFromValues(values,ind);
   if(!retcode) return;
-  for(Int_t i=fNVariables; i<fgkMaxNVariables; i++) ind[i]=0;
   Int_t mink[fgkMaxNVariables];
   Int_t maxk[fgkMaxNVariables];
-  for(Int_t i=0;i<fgkMaxNVariables;i++){
+  for(Int_t i=0;i<fNVariables;i++){
     GetFillRange(i,ind[i],mink[i],maxk[i]);
   }
-  for(Int_t k0=mink[0]; k0<=maxk[0]; k0++){
-    for(Int_t k1=mink[1]; k1<=maxk[1]; k1++){
-      for(Int_t k2=mink[2]; k2<=maxk[2]; k2++){
-	for(Int_t k3=mink[3]; k3<=maxk[3]; k3++){
-	  for(Int_t k4=mink[4]; k4<=maxk[4]; k4++){
-	    for(Int_t k5=mink[5]; k5<=maxk[5]; k5++){
-	      for(Int_t k6=mink[6]; k6<=maxk[6]; k6++){
-		for(Int_t k7=mink[7]; k7<=maxk[7]; k7++){
-		  for(Int_t k8=mink[8]; k8<=maxk[8]; k8++){
-		    for(Int_t k9=mink[9]; k9<=maxk[9]; k9++){
-		      Int_t currentBin[fgkMaxNVariables]={k0,k1,k2,k3,k4,k5,k6,k7,k8,k9};
-		      IncrementElement(currentBin,ptbin);
-		    }
-		  }
-		}
-	      }
-	    }
-	  }
-	}
-      }
+  ULong64_t stride[fgkMaxNVariables];
+  GetStrides(stride);
+  Int_t k[fgkMaxNVariables];
+  ULong64_t globadd=StartBox(mink,ptbin,stride,k);
+  do{
+    fVett[globadd]+=1.;
+  }while(NextInBox(mink,maxk,stride,k,globadd));
+}
+//_____________________________________________________________________________ 
+void AliMultiDimVector::GetStrides(ULong64_t *stride) const{
+  // address step for a unit step in each cut variable (pt bin has step 1)
+  ULong64_t prod=fNPtBins;
+  for(Int_t i=fNVariables-1;i>=0;i--){
+    stride[i]=prod;
+    prod*=fNCutSteps[i];
+  }
+}
+//_____________________________________________________________________________ 
+ULong64_t AliMultiDimVector::StartBox(const Int_t *mink, Int_t ptbin, const ULong64_t *stride, Int_t *k) const{
+  // first cell of the box [mink,maxk] of cut indices, k is set to mink
+  ULong64_t globadd=ptbin;
+  for(Int_t i=0;i<fNVariables;i++){
+    k[i]=mink[i];
+    globadd+=mink[i]*stride[i];
+  }
+  return globadd;
+}
+//_____________________________________________________________________________ 
+Bool_t AliMultiDimVector::NextInBox(const Int_t *mink, const Int_t *maxk, const ULong64_t *stride, Int_t *k, ULong64_t &globadd) const{
+  // step to the next cell of the box, last variable running fastest as in
+  // the global address; the address is updated incrementally
+  for(Int_t i=fNVariables-1;i>=0;i--){
+    if(k[i]<maxk[i]){
+      k[i]++;
+      globadd+=stride[i];
+      return kTRUE;
     }
+    globadd-=(k[i]-mink[i])*stride[i];
+    k[i]=mink[i];
   }
-
+  return kFALSE;
 }
 //_____________________________________________________________________________ 
 void AliMultiDimVector::SuppressZeroBKGEffect(const AliMultiDimVector* mvBKG){
@@ -131,6 +131,9 @@ class AliMultiDimVector :  public TNamed{
   void GetIntegrationLimits(Int_t iVar, Int_t iCell, Int_t& minbin, Int_t& maxbin) const;
   void GetFillRange(Int_t iVar, Int_t iCell, Int_t& minbin, Int_t& maxbin) const;
   Float_t   CountsAboveCell(ULong64_t globadd) const;
+  void      GetStrides(ULong64_t *stride) const;
+  ULong64_t StartBox(const Int_t *mink, Int_t ptbin, const ULong64_t *stride, Int_t *k) const;
+  Bool_t    NextInBox(const Int_t *mink, const Int_t *maxk, const ULong64_t *stride, Int_t *k, ULong64_t &globadd) const;
 
   //void SetMinLimits(Int_t nvar, Float_t* minlim);
   //void SetMaxLimits(Int_t nvar, Float_t* maxlim);
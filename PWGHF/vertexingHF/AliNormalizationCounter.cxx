@@ -36,6 +36,7 @@
 #include <TH2F.h>
 #include <TList.h>
 #include <TObjArray.h>
+#include <TExMap.h>
 #include <TString.h>
 #include <TCanvas.h>
 #include <AliPhysicsSelection.h>
@@ -45,6 +46,13 @@
 ClassImp(AliNormalizationCounter);
 /// \endcond
 
+namespace {
+  // keys of the Event rubric filled per event, in the order of Init()
+  const Int_t kNEventKeys=11;
+  const char *kEventKeys[kNEventKeys]={"triggered","V0AND","PileUp","PbPbC0SMH-B-NOPF-ALLNOTRD","Candles0.3","PrimaryV",
+                                       "countForNorm","noPrimaryV","zvtxGT10","!V0A&Candle03","!V0A&PrimaryV"};
+}
+
 //____________________________________________
 AliNormalizationCounter::AliNormalizationCounter(): 
 TNamed(),
@@ -57,7 +65,10 @@ fSpherocitySteps(100.),
 fHistTrackFilterEvMult(0),
 fHistTrackAnaEvMult(0),
 fHistTrackFilterSpdMult(0),
-fHistTrackAnaSpdMult(0)
+fHistTrackAnaSpdMult(0),
+fBufferCounts(kFALSE),
+fBufferedCounts(0),
+fBufferedRun(-1)
 {
   // empty constructor
 }
@@ -74,7 +85,10 @@ fSpherocitySteps(100.),
 fHistTrackFilterEvMult(0),
 fHistTrackAnaEvMult(0),
 fHistTrackFilterSpdMult(0),
-fHistTrackAnaSpdMult(0)
+fHistTrackAnaSpdMult(0),
+fBufferCounts(kFALSE),
+fBufferedCounts(0),
+fBufferedRun(-1)
 {
   ;
 }
@@ -99,6 +113,8 @@ AliNormalizationCounter::~AliNormalizationCounter()
     delete fHistTrackAnaSpdMult;
     fHistTrackAnaSpdMult=0;
   }
+  delete fBufferedCounts;
+  fBufferedCounts=0;
 }
 
 //______________________________________________
@@ -148,6 +164,7 @@ Long64_t AliNormalizationCounter::Merge(TCollection* list){
 }
 //_______________________________________
 void AliNormalizationCounter::Add(const AliNormalizationCounter *norm){
+  FlushCounts();
   fCounters.Add(&(norm->fCounters));
   fHistTrackFilterEvMult->Add(norm->fHistTrackFilterEvMult);
   fHistTrackAnaEvMult->Add(norm->fHistTrackAnaEvMult);
@@ -285,28 +302,25 @@ void AliNormalizationCounter::StoreCandidates(AliVEvent *event,Int_t nCand,Bool_
       fCounters.Count(Form("Event:Candid(Filter)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
     else 
       fCounters.Count(Form("Event:Candid(Filter)/Run:%d",runNumber));
-    for(Int_t i=0;i<nCand;i++){ 
-      if(fMultiplicity) 
-	fCounters.Count(Form("Event:NCandid(Filter)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
-      else 
-	fCounters.Count(Form("Event:NCandid(Filter)/Run:%d",runNumber));
-    }
+    if(fMultiplicity) 
+      fCounters.Count(Form("Event:NCandid(Filter)/Run:%d/Multiplicity:%d",runNumber,multiplicity),nCand);
+    else 
+      fCounters.Count(Form("Event:NCandid(Filter)/Run:%d",runNumber),nCand);
   }else{
     if(fMultiplicity) 
       fCounters.Count(Form("Event:Candid(Analysis)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
     else
       fCounters.Count(Form("Event:Candid(Analysis)/Run:%d",runNumber));
-    for(Int_t i=0;i<nCand;i++){ 
-      if(fMultiplicity) 
-	fCounters.Count(Form("Event:NCandid(Analysis)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
-      else
-	fCounters.Count(Form("Event:NCandid(Analysis)/Run:%d",runNumber));
-    }
+    if(fMultiplicity) 
+      fCounters.Count(Form("Event:NCandid(Analysis)/Run:%d/Multiplicity:%d",runNumber,multiplicity),nCand);
+    else 
+      fCounters.Count(Form("Event:NCandid(Analysis)/Run:%d",runNumber),nCand);
   }
   return;
 }
 //_______________________________________________________________________
 TH1D* AliNormalizationCounter::DrawAgainstRuns(TString candle,Bool_t drawHist){
+  FlushCounts();
   //
   fCounters.SortRubric("Run");
   TString selection;
@@ -319,6 +333,7 @@ TH1D* AliNormalizationCounter::DrawAgainstRuns(TString candle,Bool_t drawHist){
 }
 //___________________________________________________________________________
 TH1D* AliNormalizationCounter::DrawRatio(TString candle1,TString candle2){
+  FlushCounts();
   //
   fCounters.SortRubric("Run");
   TString name;
@@ -337,10 +352,12 @@ TH1D* AliNormalizationCounter::DrawRatio(TString candle1,TString candle2){
 }
 //___________________________________________________________________________
 void AliNormalizationCounter::PrintRubrics(){
+  FlushCounts();
   fCounters.PrintKeyWords();
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetSum(TString candle){
+  FlushCounts();
   TString selection="event:";
   selection.Append(candle);
   return fCounters.GetSum(selection.Data());
@@ -367,11 +384,13 @@ TH2F* AliNormalizationCounter::GetHist(Bool_t filtercuts,Bool_t spdtracklets,Boo
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNorm(){
+  FlushCounts();
   Double_t noVtxzGT10=GetSum("noPrimaryV")*GetSum("zvtxGT10")/GetSum("PrimaryV");
   return GetSum("countForNorm")-noVtxzGT10;
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t runnumber){
+  FlushCounts();
   TString listofruns = fCounters.GetKeyWords("RUN");
   if(!listofruns.Contains(Form("%d",runnumber))){
     printf("WARNING: %d is not a valid run number\n",runnumber);
@@ -389,6 +408,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t runnumber){
 
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t maxmultiplicity){
+  FlushCounts();
 
   if(!fMultiplicity) {
     AliInfo("Sorry, you didn't activate the multiplicity in the counter!");
@@ -420,6 +440,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t maxmultiplicity, Double_t minspherocity, Double_t maxspherocity){
+  FlushCounts();
 
   if(!fMultiplicity || !fSpherocity) {
     AliInfo("You must activate both multiplicity and spherocity in the counters to use this method!");
@@ -461,6 +482,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t
 
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNormSpheroOnly(Double_t minspherocity, Double_t maxspherocity){
+  FlushCounts();
 
   if(!fSpherocity) {
     AliInfo("Sorry, you didn't activate the sphericity in the counter!");
@@ -496,6 +518,7 @@ Double_t AliNormalizationCounter::GetNEventsForNormSpheroOnly(Double_t minsphero
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetSum(TString candle,Int_t minmultiplicity, Int_t maxmultiplicity){
+  FlushCounts();
   // counts events of given type in a given multiplicity range
 
   if(!fMultiplicity) {
@@ -520,6 +543,7 @@ Double_t AliNormalizationCounter::GetSum(TString candle,Int_t minmultiplicity, I
 
 //___________________________________________________________________________
 TH1D* AliNormalizationCounter::DrawNEventsForNorm(Bool_t drawRatio){
+  FlushCounts();
   //usare algebra histos
   fCounters.SortRubric("Run");
   TString selection;
@@ -579,13 +603,60 @@ void AliNormalizationCounter::FillCounters(TString name, Int_t runNumber, Int_t
 
 
   Int_t sphToInteger=spherocity*fSpherocitySteps;
+
+  if(fBufferCounts){
+    // index of the name in the Event rubric, see Init()
+    Int_t iname=-1;
+    for(Int_t i=0; i<kNEventKeys; i++){
+      if(name==kEventKeys[i]){ iname=i; break; }
+    }
+    Int_t mult=fMultiplicity ? multiplicity : 0;
+    Int_t sph=fSpherocity ? sphToInteger : 0;
+    if(iname>=0 && mult>=0 && mult<65536 && sph>=0 && sph<65536){
+      if(runNumber!=fBufferedRun) FlushCounts();
+      if(!fBufferedCounts) fBufferedCounts=new TExMap();
+      fBufferedRun=runNumber;
+      Long64_t key=(Long64_t)(iname+1) | ((Long64_t)mult<<8) | ((Long64_t)sph<<24);
+      (*fBufferedCounts)(key)+=1;
+      return;
+    }
+  }
+
+  fCounters.Count(CounterKey(name.Data(),runNumber,multiplicity,sphToInteger));
+  return;
+}
+
+//___________________________________________________________________________
+TString AliNormalizationCounter::CounterKey(const char *name, Int_t runNumber, Int_t multiplicity, Int_t sphToInteger) const{
+  //
+  // key of the counter collection for the Event rubric name
+  //
+  TString key;
   if(fMultiplicity  && !fSpherocity) 
-    fCounters.Count(Form("Event:%s/Run:%d/Multiplicity:%d",name.Data(),runNumber,multiplicity));
+    key.Form("Event:%s/Run:%d/Multiplicity:%d",name,runNumber,multiplicity);
   else if(fMultiplicity  && fSpherocity) 
-    fCounters.Count(Form("Event:%s/Run:%d/Multiplicity:%d/Spherocity:%d",name.Data(),runNumber,multiplicity,sphToInteger));
+    key.Form("Event:%s/Run:%d/Multiplicity:%d/Spherocity:%d",name,runNumber,multiplicity,sphToInteger);
   else if(!fMultiplicity  && fSpherocity) 
-    fCounters.Count(Form("Event:%s/Run:%d/Spherocity:%d",name.Data(),runNumber,sphToInteger));
+    key.Form("Event:%s/Run:%d/Spherocity:%d",name,runNumber,sphToInteger);
   else 
-    fCounters.Count(Form("Event:%s/Run:%d",name.Data(),runNumber));
-  return;
+    key.Form("Event:%s/Run:%d",name,runNumber);
+  return key;
+}
+
+//___________________________________________________________________________
+void AliNormalizationCounter::FlushCounts(){
+  //
+  // add the buffered event counts of the current run to the counter collection
+  //
+  if(!fBufferedCounts || fBufferedCounts->GetSize()==0) return;
+
+  TExMapIter iter(fBufferedCounts);
+  Long64_t key=0, count=0;
+  while(iter.Next(key,count)){
+    Int_t iname=(Int_t)(key&0xff)-1;
+    Int_t mult=(Int_t)((key>>8)&0xffff);
+    Int_t sph=(Int_t)((key>>24)&0xffff);
+    fCounters.Count(CounterKey(kEventKeys[iname],fBufferedRun,mult,sph),(Int_t)count);
+  }
+  fBufferedCounts->Delete();
 }
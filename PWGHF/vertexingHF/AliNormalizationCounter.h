@@ -45,6 +45,8 @@
 #include "AliRDHFCuts.h"
 //#include "AliAnalysisVertexingHF.h"
 
+class TExMap;
+
 class AliNormalizationCounter : public TNamed
 {
  public:
@@ -54,7 +56,7 @@ class AliNormalizationCounter : public TNamed
   virtual ~AliNormalizationCounter();
   Long64_t Merge(TCollection* list);
 
-  AliCounterCollection* GetCounter(){return &fCounters;}
+  AliCounterCollection* GetCounter(){FlushCounts(); return &fCounters;}
   void Init();
   void Add(const AliNormalizationCounter*);
   void SetESD(Bool_t flag){fESD=flag;}
@@ -63,6 +65,11 @@ class AliNormalizationCounter : public TNamed
     fSpherocitySteps=nsteps;}
   void StoreEvent(AliVEvent*,AliRDHFCuts *,Bool_t mc=kFALSE, Int_t multiplicity=-9999, Double_t spherocity=-99.);
   void StoreCandidates(AliVEvent*, Int_t nCand=0,Bool_t flagFilter=kTRUE);
+  /// keep the event counts of the current run in memory and add them to the
+  /// counter collection when the run changes or in FlushCounts(); a task using
+  /// this has to call FlushCounts() in its FinishTaskOutput()
+  void SetBufferCounts(Bool_t flag=kTRUE){fBufferCounts=flag;}
+  void FlushCounts();
   TH1D* DrawAgainstRuns(TString candle="candid(filter)",Bool_t drawHist=kTRUE);
   TH1D* DrawRatio(TString candle1="candid(filter)",TString candle2="triggered");
   void PrintRubrics();
@@ -84,6 +91,7 @@ class AliNormalizationCounter : public TNamed
   AliNormalizationCounter& operator=(const AliNormalizationCounter& source);
   Int_t Multiplicity(AliVEvent* event);
   void FillCounters(TString name, Int_t runNumber, Int_t multiplicity, Double_t spherocity);
+  TString CounterKey(const char *name, Int_t runNumber, Int_t multiplicity, Int_t sphToInteger) const;
 
 
   AliCounterCollection fCounters; /// internal counter
@@ -96,9 +104,12 @@ class AliNormalizationCounter : public TNamed
   TH2F *fHistTrackAnaEvMult;/// hist to store no of analysis candidates vs no of tracks in the event
   TH2F *fHistTrackFilterSpdMult; /// hist to store no of filter candidates vs  SPD multiplicity
   TH2F *fHistTrackAnaSpdMult;/// hist to store no of analysis candidates vs SPD multiplicity 
+  Bool_t fBufferCounts; /// buffer the event counts of the current run, see SetBufferCounts()
+  TExMap *fBufferedCounts; //! packed (event, multiplicity, spherocity) -> count of the current run
+  Int_t fBufferedRun; //! run of the buffered counts
 
   /// \cond CLASSIMP    
-  ClassDef(AliNormalizationCounter,7);
+  ClassDef(AliNormalizationCounter,8);
   /// \endcond
 };
 #endif
@@ -51,6 +51,8 @@
 #include <TF1.h>
 #include <TFile.h>
 #include <TKey.h>
+#include <TExMap.h>
+#include <TObjArray.h>
 
 using std::cout;
 using std::endl;
@@ -124,7 +126,11 @@ fCutGeoNcrNclLength(130.),
 fCutGeoNcrNclGeom1Pt(1.5),
 fCutGeoNcrNclFractionNcr(0.85),
 fCutGeoNcrNclFractionNcl(0.7),
-fUseV0ANDSelectionOffline(kFALSE)
+fUseV0ANDSelectionOffline(kFALSE),
+fCacheOwnPrimaryVtx(kFALSE),
+fOwnPrimaryVtxIndex(0),
+fOwnPrimaryVtxCache(0),
+fOwnPrimaryVtxCacheShared(kFALSE)
 {
   //
   // Default Constructor
@@ -196,7 +202,11 @@ AliRDHFCuts::AliRDHFCuts(const AliRDHFCuts &source) :
   fCutGeoNcrNclGeom1Pt(source.fCutGeoNcrNclGeom1Pt),
   fCutGeoNcrNclFractionNcr(source.fCutGeoNcrNclFractionNcr),
   fCutGeoNcrNclFractionNcl(source.fCutGeoNcrNclFractionNcl),
-  fUseV0ANDSelectionOffline(source.fUseV0ANDSelectionOffline)
+  fUseV0ANDSelectionOffline(source.fUseV0ANDSelectionOffline),
+  fCacheOwnPrimaryVtx(source.fCacheOwnPrimaryVtx),
+  fOwnPrimaryVtxIndex(0),
+  fOwnPrimaryVtxCache(0),
+  fOwnPrimaryVtxCacheShared(kFALSE)
 {
   //
   // Copy constructor
@@ -295,6 +305,13 @@ AliRDHFCuts &AliRDHFCuts::operator=(const AliRDHFCuts &source)
   fCutGeoNcrNclFractionNcr=source.fCutGeoNcrNclFractionNcr;
   fCutGeoNcrNclFractionNcl=source.fCutGeoNcrNclFractionNcl;
   fUseV0ANDSelectionOffline=source.fUseV0ANDSelectionOffline;
+  fCacheOwnPrimaryVtx=source.fCacheOwnPrimaryVtx;
+  if(fOwnPrimaryVtxCacheShared) {
+    fOwnPrimaryVtxIndex=0;
+    fOwnPrimaryVtxCache=0;
+    fOwnPrimaryVtxCacheShared=kFALSE;
+  }
+  ResetOwnPrimaryVtxCache();
 
   PrintAll();
 
@@ -325,6 +342,12 @@ AliRDHFCuts::~AliRDHFCuts() {
     f1CutMinNCrossedRowsTPCPtDep = 0;
   }
 
+  if(!fOwnPrimaryVtxCacheShared) {
+    delete fOwnPrimaryVtxIndex;
+    delete fOwnPrimaryVtxCache;
+  }
+  fOwnPrimaryVtxIndex=0;
+  fOwnPrimaryVtxCache=0;
 }
 //---------------------------------------------------------------------------
 Int_t AliRDHFCuts::IsEventSelectedInCentrality(AliVEvent *event) {
@@ -492,6 +515,9 @@ Bool_t AliRDHFCuts::IsEventSelected(AliVEvent *event) {
   fEvRejectionBits=0;
   Bool_t accept=kTRUE;
 
+  // primary vertices without daughters of the previous event
+  ResetOwnPrimaryVtxCache();
+
 
   // check if it's MC
   Bool_t isMC=kFALSE;
@@ -1116,6 +1142,7 @@ void AliRDHFCuts::PrintAll() const {
   printf("Min SPD mult %d\n",fMinSPDMultiplicity);
   printf("Use PID %d  OldPid=%d\n",(Int_t)fUsePID,fPidHF ? fPidHF->GetOldPid() : -1);
   printf("Remove daughters from vtx %d\n",(Int_t)fRemoveDaughtersFromPrimary);
+  if(fCacheOwnPrimaryVtx) printf("Primary vertices without daughters kept per event\n");
   printf("Physics selection: %s\n",fUsePhysicsSelection ? "Yes" : "No");
   printf("Pileup rejection: %s\n",(fOptPileup > 0) ? "Yes" : "No");
   if(fOptPileup==1) printf(" -- Reject pileup event");
@@ -1575,7 +1602,31 @@ Bool_t AliRDHFCuts::RecalcOwnPrimaryVtx(AliAODRecoDecayHF *d,
     return 0;
   }   
 
+  // same candidate already selected in this event
+  Long64_t key=-1;
+  if(fCacheOwnPrimaryVtx && fOwnPrimaryVtxIndex) key=OwnPrimaryVtxCacheKey(d);
+  if(key>=0) {
+    Long64_t index=fOwnPrimaryVtxIndex->GetValue(key);
+    if(index>0) {
+      AliAODVertex *cachedvtx=(AliAODVertex*)fOwnPrimaryVtxCache->At(index-1);
+      if(!cachedvtx){
+        AliDebug(2,"Removal of daughter tracks failed");
+        return kFALSE;
+      }
+      d->SetOwnPrimaryVtx(cachedvtx);
+      d->RecalculateImpPars(cachedvtx,aod);
+      return kTRUE;
+    }
+  }
+
   AliAODVertex *recvtx=d->RemoveDaughtersFromPrimaryVtx(aod);
+
+  if(key>=0) {
+    Int_t index=fOwnPrimaryVtxIndex->GetSize();
+    fOwnPrimaryVtxCache->AddAtAndExpand(recvtx ? new AliAODVertex(*recvtx) : 0,index);
+    fOwnPrimaryVtxIndex->Add(key,index+1);
+  }
+
   if(!recvtx){
     AliDebug(2,"Removal of daughter tracks failed");
     return kFALSE;
@@ -1589,6 +1640,70 @@ Bool_t AliRDHFCuts::RecalcOwnPrimaryVtx(AliAODRecoDecayHF *d,
   return kTRUE;
 }
 //--------------------------------------------------------------------------
+Long64_t AliRDHFCuts::OwnPrimaryVtxCacheKey(AliAODRecoDecayHF *d) const
+{
+  //
+  // Key of the cache of the primary vertices without daughters: the IDs of
+  // the (up to 3) daughters packed in 21 bits each, -1 if they do not fit
+  //
+
+  Int_t ndg=d->GetNDaughters();
+  if(ndg<1 || ndg>3) return -1;
+
+  Long64_t key=0;
+  for(Int_t i=0; i<ndg; i++) {
+    AliAODTrack *t=(AliAODTrack*)d->GetDaughter(i);
+    if(!t) return -1;
+    Long64_t id=(Long64_t)t->GetID()+(1<<20);
+    if(id<0 || id>=(1<<21)) return -1;
+    key|=(id<<(21*i));
+  }
+
+  return key;
+}
+//--------------------------------------------------------------------------
+void AliRDHFCuts::ResetOwnPrimaryVtxCache()
+{
+  //
+  // Drop the primary vertices without daughters of the previous event
+  //
+
+  if(fOwnPrimaryVtxCacheShared) return; // reset by the owner
+
+  if(fOwnPrimaryVtxIndex) fOwnPrimaryVtxIndex->Delete();
+  if(fOwnPrimaryVtxCache) fOwnPrimaryVtxCache->Delete();
+
+  if(fCacheOwnPrimaryVtx && !fOwnPrimaryVtxIndex) {
+    fOwnPrimaryVtxIndex=new TExMap();
+    fOwnPrimaryVtxCache=new TObjArray();
+    fOwnPrimaryVtxCache->SetOwner(kTRUE);
+  }
+}
+//--------------------------------------------------------------------------
+void AliRDHFCuts::ShareOwnPrimaryVtxCache(AliRDHFCuts *owner)
+{
+  //
+  // Use the primary vertices without daughters kept by owner, for several
+  // cut configurations applied to the same candidates (AliRDHFCutsCollection).
+  // The cache is reset by owner->IsEventSelected(), which has to be called
+  // for each event before the candidates are selected.
+  //
+
+  if(!owner || owner==this) return;
+
+  owner->fCacheOwnPrimaryVtx=kTRUE;
+  owner->ResetOwnPrimaryVtxCache();
+
+  if(!fOwnPrimaryVtxCacheShared) {
+    delete fOwnPrimaryVtxIndex;
+    delete fOwnPrimaryVtxCache;
+  }
+  fCacheOwnPrimaryVtx=kTRUE;
+  fOwnPrimaryVtxIndex=owner->fOwnPrimaryVtxIndex;
+  fOwnPrimaryVtxCache=owner->fOwnPrimaryVtxCache;
+  fOwnPrimaryVtxCacheShared=kTRUE;
+}
+//--------------------------------------------------------------------------
 Bool_t AliRDHFCuts::SetMCPrimaryVtx(AliAODRecoDecayHF *d,AliAODEvent *aod) const
 {
   //
@@ -24,6 +24,8 @@ class AliAODRecoDecayHF;
 class AliESDVertex;
 class TF1;
 class TFormula;
+class TExMap;
+class TObjArray;
 
 class AliRDHFCuts : public AliAnalysisCuts 
 {
@@ -214,6 +216,10 @@ class AliRDHFCuts : public AliAnalysisCuts
     fPidHF=new AliAODPidHF(*pidObj);
   }
   void SetRemoveDaughtersFromPrim(Bool_t removeDaughtersPrim) {fRemoveDaughtersFromPrimary=removeDaughtersPrim;}
+  /// keep the primary vertex without daughters of each candidate until the next
+  /// IsEventSelected() call, for tasks selecting the same candidate more than once
+  void SetCacheOwnPrimaryVtx(Bool_t flag=kTRUE) {fCacheOwnPrimaryVtx=flag; return;}
+  void ShareOwnPrimaryVtxCache(AliRDHFCuts *owner);
   void SetMinPtCandidate(Double_t ptCand=-1.) {fMinPtCand=ptCand; return;}
   void SetMaxPtCandidate(Double_t ptCand=1000.) {fMaxPtCand=ptCand; return;}
   void SetMaxRapidityCandidate(Double_t ycand) {fMaxRapidityCand=ycand; return;}
@@ -349,6 +355,8 @@ class AliRDHFCuts : public AliAnalysisCuts
   Bool_t RecalcOwnPrimaryVtx(AliAODRecoDecayHF *d,AliAODEvent *aod) const;
   Bool_t SetMCPrimaryVtx(AliAODRecoDecayHF *d,AliAODEvent *aod) const;
   void   CleanOwnPrimaryVtx(AliAODRecoDecayHF *d,AliAODEvent *aod,AliAODVertex *origownvtx) const;
+  Long64_t OwnPrimaryVtxCacheKey(AliAODRecoDecayHF *d) const;
+  void   ResetOwnPrimaryVtxCache();
 
   Bool_t CountEventForNormalization() const 
   { if(fWhyRejection==0) {return kTRUE;} else {return kFALSE;} }
@@ -448,10 +456,14 @@ class AliRDHFCuts : public AliAnalysisCuts
   Double_t fCutGeoNcrNclFractionNcr; /// 4th parameter of GeoNcrNcl cut
   Double_t fCutGeoNcrNclFractionNcl; /// 5th parameter of GeoNcrNcl cut
   Bool_t fUseV0ANDSelectionOffline; ///flag to apply V0AND selection offline
+  Bool_t fCacheOwnPrimaryVtx; /// keep the primary vertices without daughters of this event
+  TExMap *fOwnPrimaryVtxIndex; //! daughter IDs -> 1+index in fOwnPrimaryVtxCache
+  TObjArray *fOwnPrimaryVtxCache; //! primary vertices without daughters of this event (0 if removal failed)
+  Bool_t fOwnPrimaryVtxCacheShared; //! cache owned and reset by another AliRDHFCuts, see ShareOwnPrimaryVtxCache
   
 
   /// \cond CLASSIMP    
-  ClassDef(AliRDHFCuts,39);  /// base class for cuts on AOD reconstructed heavy-flavour decays
+  ClassDef(AliRDHFCuts,41);  /// base class for cuts on AOD reconstructed heavy-flavour decays
   /// \endcond
 };
 
@@ -0,0 +1,167 @@
+/**************************************************************************
+ * Copyright(c) 1998-2010, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+/////////////////////////////////////////////////////////////
+//
+// Set of AliRDHFCuts configurations applied to the same candidates,
+// for cut-variation studies filling one output per configuration
+// in a single task instead of one task per configuration
+//
+/////////////////////////////////////////////////////////////
+
+#include <Riostream.h>
+
+#include "AliRDHFCutsCollection.h"
+#include "AliRDHFCuts.h"
+#include "AliVEvent.h"
+#include "AliAODEvent.h"
+#include "AliLog.h"
+
+using std::cout;
+using std::endl;
+
+/// \cond CLASSIMP
+ClassImp(AliRDHFCutsCollection);
+/// \endcond
+
+//--------------------------------------------------------------------------
+AliRDHFCutsCollection::AliRDHFCutsCollection(const char* name, const char* title) :
+TNamed(name,title),
+fCuts(),
+fSelection(),
+fCachesShared(kFALSE)
+{
+  //
+  // Default Constructor
+  //
+  fCuts.SetOwner(kTRUE);
+}
+//--------------------------------------------------------------------------
+AliRDHFCutsCollection::AliRDHFCutsCollection(const AliRDHFCutsCollection& source) :
+  TNamed(source),
+  fCuts(),
+  fSelection(),
+  fCachesShared(kFALSE)
+{
+  //
+  // Copy constructor
+  //
+  fCuts.SetOwner(kTRUE);
+  for(Int_t i=0; i<source.GetNCuts(); i++) AddCuts(source.GetCuts(i));
+}
+//--------------------------------------------------------------------------
+AliRDHFCutsCollection &AliRDHFCutsCollection::operator=(const AliRDHFCutsCollection &source)
+{
+  //
+  // assignment operator
+  //
+  if(&source == this) return *this;
+
+  TNamed::operator=(source);
+  fCuts.Delete();
+  fSelection.Set(0);
+  fCachesShared=kFALSE;
+  for(Int_t i=0; i<source.GetNCuts(); i++) AddCuts(source.GetCuts(i));
+
+  return *this;
+}
+//--------------------------------------------------------------------------
+AliRDHFCutsCollection::~AliRDHFCutsCollection()
+{
+  //
+  // Destructor, the cuts are owned
+  //
+}
+//--------------------------------------------------------------------------
+Int_t AliRDHFCutsCollection::AddCuts(const AliRDHFCuts *cuts)
+{
+  //
+  // Add a copy of cuts, return its index in the bit maps (-1 if not added)
+  //
+  if(!cuts) return -1;
+  if(GetNCuts()>=kMaxCuts) {
+    AliError(Form("At most %d cut configurations, %s not added",(Int_t)kMaxCuts,cuts->GetName()));
+    return -1;
+  }
+
+  fCuts.AddLast(cuts->Clone());
+  fSelection.Set(GetNCuts());
+  fCachesShared=kFALSE;
+
+  return GetNCuts()-1;
+}
+//--------------------------------------------------------------------------
+void AliRDHFCutsCollection::ShareCaches()
+{
+  //
+  // The configurations removing the daughters from the primary vertex
+  // use the vertices refitted by the first of them
+  //
+  AliRDHFCuts *owner=0x0;
+  for(Int_t i=0; i<GetNCuts(); i++) {
+    AliRDHFCuts *cuts=GetCuts(i);
+    if(!cuts->GetIsPrimaryWithoutDaughters() || cuts->GetUseMCVertex()) continue;
+    if(!owner) owner=cuts;
+    else cuts->ShareOwnPrimaryVtxCache(owner);
+  }
+  fCachesShared=kTRUE;
+}
+//--------------------------------------------------------------------------
+ULong64_t AliRDHFCutsCollection::IsEventSelected(AliVEvent *event)
+{
+  //
+  // Event selection of all configurations, to be called for each event
+  // before IsSelected(). Bit i is set if configuration i accepts the event.
+  //
+  if(!fCachesShared) ShareCaches();
+
+  ULong64_t selected=0;
+  for(Int_t i=0; i<GetNCuts(); i++) {
+    if(GetCuts(i)->IsEventSelected(event)) selected|=(1ULL<<i);
+  }
+
+  return selected;
+}
+//--------------------------------------------------------------------------
+ULong64_t AliRDHFCutsCollection::IsSelected(TObject *obj, Int_t selectionLevel, AliAODEvent *aod)
+{
+  //
+  // Candidate selection of all configurations. Bit i is set if configuration i
+  // selects the candidate, the value returned by its IsSelected (e.g. D0/D0bar
+  // hypotheses) is given by GetSelection(i).
+  //
+  ULong64_t selected=0;
+  for(Int_t i=0; i<GetNCuts(); i++) {
+    Int_t sel=GetCuts(i)->IsSelected(obj,selectionLevel,aod);
+    fSelection[i]=sel;
+    if(sel) selected|=(1ULL<<i);
+  }
+
+  return selected;
+}
+//--------------------------------------------------------------------------
+void AliRDHFCutsCollection::PrintAll() const
+{
+  //
+  // print all the configurations
+  //
+  cout<<GetName()<<": "<<GetNCuts()<<" cut configurations"<<endl;
+  for(Int_t i=0; i<GetNCuts(); i++) {
+    cout<<"--- configuration "<<i<<": "<<GetCuts(i)->GetName()<<endl;
+    GetCuts(i)->PrintAll();
+  }
+}
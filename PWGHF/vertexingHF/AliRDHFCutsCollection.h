@@ -0,0 +1,61 @@
+#ifndef ALIRDHFCUTSCOLLECTION_H
+#define ALIRDHFCUTSCOLLECTION_H
+/* Copyright(c) 1998-2010, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//***********************************************************
+/// \class Class AliRDHFCutsCollection
+/// \brief set of AliRDHFCuts configurations applied to the same candidates
+///
+/// For cut-variation studies within one task: each candidate is selected
+/// with all the configurations in one IsSelected() call, which returns the
+/// bit map of the configurations passed. The primary vertex without the
+/// candidate daughters is refitted once and shared by all configurations.
+//***********************************************************
+
+#include <TNamed.h>
+#include <TObjArray.h>
+#include <TArrayI.h>
+
+class AliRDHFCuts;
+class AliVEvent;
+class AliAODEvent;
+
+class AliRDHFCutsCollection : public TNamed
+{
+ public:
+
+  enum {kMaxCuts=64};
+
+  AliRDHFCutsCollection(const char* name="RDHFCutsCollection", const char* title="");
+  AliRDHFCutsCollection(const AliRDHFCutsCollection& source);
+  AliRDHFCutsCollection& operator=(const AliRDHFCutsCollection& source);
+  virtual ~AliRDHFCutsCollection();
+
+  Int_t AddCuts(const AliRDHFCuts *cuts);
+  Int_t GetNCuts() const {return fCuts.GetEntriesFast();}
+  AliRDHFCuts *GetCuts(Int_t i) const {return (AliRDHFCuts*)fCuts.At(i);}
+
+  ULong64_t IsEventSelected(AliVEvent *event);
+  ULong64_t IsSelected(TObject *obj, Int_t selectionLevel, AliAODEvent *aod);
+  /// return value of AliRDHFCuts::IsSelected of configuration i for the last candidate
+  Int_t GetSelection(Int_t i) const {return fSelection.At(i);}
+
+  virtual void PrintAll() const;
+
+ private:
+
+  void ShareCaches();
+
+  TObjArray fCuts;        /// the cut configurations (owned)
+  TArrayI fSelection;     //! outcome of each configuration for the last candidate
+  Bool_t fCachesShared;   //! primary vertex caches shared among the configurations
+
+  /// \cond CLASSIMP
+  ClassDef(AliRDHFCutsCollection,1); /// set of AliRDHFCuts applied to the same candidates
+  /// \endcond
+};
+
+#endif
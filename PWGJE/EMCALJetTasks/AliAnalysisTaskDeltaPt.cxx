@@ -11,6 +11,7 @@
 #include <TList.h>
 #include <TLorentzVector.h>
 #include <TRandom3.h>
+#include <TVector2.h>
 
 #include "AliVCluster.h"
 #include "AliVParticle.h"
@@ -37,6 +38,8 @@ AliAnalysisTaskDeltaPt::AliAnalysisTaskDeltaPt() :
   fConeMaxEta(0.9),
   fConeMinPhi(0),
   fConeMaxPhi(TMath::Pi()*2),
+  fUseConeSumImage(kFALSE),
+  fConeSumImageCell(0.05),
   fJetsCont(0),
   fTracksCont(0),
   fCaloClustersCont(0),
@@ -45,6 +48,8 @@ AliAnalysisTaskDeltaPt::AliAnalysisTaskDeltaPt() :
   fEmbCaloClustersCont(0),
   fRandTracksCont(0),
   fRandCaloClustersCont(0),
+  fConeImage(),
+  fRandConeImage(),
   fHistRhovsCent(0),
   fHistRCPhiEta(0), 
   fHistRCPt(0),
@@ -107,6 +112,8 @@ AliAnalysisTaskDeltaPt::AliAnalysisTaskDeltaPt(const char *name) :
   fConeMaxEta(0.9),
   fConeMinPhi(0),
   fConeMaxPhi(TMath::Pi()*2),
+  fUseConeSumImage(kFALSE),
+  fConeSumImageCell(0.05),
   fJetsCont(0),
   fTracksCont(0),
   fCaloClustersCont(0),
@@ -115,6 +122,8 @@ AliAnalysisTaskDeltaPt::AliAnalysisTaskDeltaPt(const char *name) :
   fEmbCaloClustersCont(0),
   fRandTracksCont(0),
   fRandCaloClustersCont(0),
+  fConeImage(),
+  fRandConeImage(),
   fHistRhovsCent(0),
   fHistRCPhiEta(0), 
   fHistRCPt(0),
@@ -450,6 +459,16 @@ Bool_t AliAnalysisTaskDeltaPt::FillHistograms()
   Float_t RCeta = 0;
   Float_t RCphi = 0;
 
+  // the images cover the eta range of the cones, they are used for all the random cones of the event
+  if (fUseConeSumImage) {
+    if (fTracksCont || fCaloClustersCont)
+      fConeImage.Build(fTracksCont, fCaloClustersCont, fVertex, fConeMinEta - fConeRadius, fConeMaxEta + fConeRadius, fConeSumImageCell);
+    if (fRandTracksCont || fRandCaloClustersCont)
+      fRandConeImage.Build(fRandTracksCont, fRandCaloClustersCont, fVertex, fConeMinEta - fConeRadius, fConeMaxEta + fConeRadius, fConeSumImageCell);
+  }
+  const ConeSumImage *image = fUseConeSumImage ? &fConeImage : 0;
+  const ConeSumImage *randImage = fUseConeSumImage ? &fRandConeImage : 0;
+
   if (fTracksCont || fCaloClustersCont) {
 
     for (Int_t i = 0; i < fRCperEvent; i++) {
@@ -457,7 +476,7 @@ Bool_t AliAnalysisTaskDeltaPt::FillHistograms()
       RCpt = 0;
       RCeta = 0;
       RCphi = 0;
-      GetRandomCone(RCpt, RCeta, RCphi, fTracksCont, fCaloClustersCont, 0);
+      GetRandomCone(RCpt, RCeta, RCphi, fTracksCont, fCaloClustersCont, 0, kFALSE, image);
       if (RCpt > 0) {
         fHistRCPhiEta->Fill(RCeta, RCphi);
         fHistRhoVSRCPt[fCentBin]->Fill(fJetsCont->GetRhoVal() * rcArea, RCpt);
@@ -479,7 +498,7 @@ Bool_t AliAnalysisTaskDeltaPt::FillHistograms()
         RCpt = 0;
         RCeta = 0;
         RCphi = 0;
-        GetRandomCone(RCpt, RCeta, RCphi, fTracksCont, fCaloClustersCont, jet);
+        GetRandomCone(RCpt, RCeta, RCphi, fTracksCont, fCaloClustersCont, jet, kFALSE, image);
         if (RCpt > 0) {
           if (jet) {
             Float_t dphi = RCphi - jet->Phi();
@@ -497,7 +516,7 @@ Bool_t AliAnalysisTaskDeltaPt::FillHistograms()
           RCpt = 0;
           RCeta = 0;
           RCphi = 0;
-          GetRandomCone(RCpt, RCeta, RCphi, fTracksCont, fCaloClustersCont, jet, kTRUE);
+          GetRandomCone(RCpt, RCeta, RCphi, fTracksCont, fCaloClustersCont, jet, kTRUE, image);
 
           if (RCpt > 0) {
             if (jet) {
@@ -519,7 +538,7 @@ Bool_t AliAnalysisTaskDeltaPt::FillHistograms()
     RCpt = 0;
     RCeta = 0;
     RCphi = 0;
-    GetRandomCone(RCpt, RCeta, RCphi, fRandTracksCont, fRandCaloClustersCont, 0);
+    GetRandomCone(RCpt, RCeta, RCphi, fRandTracksCont, fRandCaloClustersCont, 0, kFALSE, randImage);
     if (RCpt > 0) {
       fHistRCPtRand[fCentBin]->Fill(RCpt);
       fHistDeltaPtRCRand[fCentBin]->Fill(RCpt - rcArea * fJetsCont->GetRhoVal());
@@ -584,7 +603,7 @@ AliEmcalJet* AliAnalysisTaskDeltaPt::NextEmbeddedJet(Bool_t reset)
 //________________________________________________________________________
 void AliAnalysisTaskDeltaPt::GetRandomCone(Float_t &pt, Float_t &eta, Float_t &phi,
     AliParticleContainer* tracks, AliClusterContainer* clusters,
-    AliEmcalJet *jet, Bool_t bPartialExclusion) const
+    AliEmcalJet *jet, Bool_t bPartialExclusion, const ConeSumImage *image) const
 {
   // Get rigid cone.
 
@@ -642,6 +661,11 @@ void AliAnalysisTaskDeltaPt::GetRandomCone(Float_t &pt, Float_t &eta, Float_t &p
     return;
   }
 
+  if (image && image->IsValid()) {
+    pt = image->ConeSum(eta, phi, fConeRadius);
+    return;
+  }
+
   if (clusters) {
     clusters->ResetCurrentID();
     AliVCluster* cluster = clusters->GetNextAcceptCluster();
@@ -731,6 +755,12 @@ void AliAnalysisTaskDeltaPt::ExecOnce()
   if (fMinRC2LJ < 0)
     fMinRC2LJ = fConeRadius * 1.5;
 
+  if (fUseConeSumImage && (fConeSumImageCell <= 0 || 2 * (fConeRadius + fConeSumImageCell) >= TMath::Pi())) {
+    AliWarning(Form("%s: Cell size %f not usable with cone radius %f, the cones will be summed particle by particle",
+        GetName(), fConeSumImageCell, fConeRadius));
+    fUseConeSumImage = kFALSE;
+  }
+
   const Float_t maxDist = TMath::Max(fConeMaxPhi - fConeMinPhi, fConeMaxEta - fConeMinEta) / 2;
   if (fMinRC2LJ > maxDist) {
     AliWarning(Form("The parameter fMinRC2LJ = %f is too large for the considered acceptance. "
@@ -766,3 +796,168 @@ Double_t AliAnalysisTaskDeltaPt::GetNColl() const {
     return -1.;
   }
 }
+
+//________________________________________________________________________
+void AliAnalysisTaskDeltaPt::ConeSumImage::Build(AliParticleContainer* tracks, AliClusterContainer* clusters, const Double_t *vertex,
+    Double_t minEta, Double_t maxEta, Double_t cellSize)
+{
+  // Fill the image with the accepted tracks and clusters in minEta < eta < maxEta.
+
+  Reset();
+  if (maxEta <= minEta || cellSize <= 0) return;
+
+  fEta.clear();
+  fPhi.clear();
+  fPt.clear();
+
+  if (clusters) {
+    clusters->ResetCurrentID();
+    AliVCluster* cluster = clusters->GetNextAcceptCluster();
+    while (cluster) {
+      TLorentzVector nPart;
+      cluster->GetMomentum(nPart, const_cast<Double_t*>(vertex));
+      if (nPart.Eta() >= minEta && nPart.Eta() < maxEta) {
+        fEta.push_back(nPart.Eta());
+        fPhi.push_back(TVector2::Phi_0_2pi(nPart.Phi()));
+        fPt.push_back(nPart.Pt());
+      }
+      cluster = clusters->GetNextAcceptCluster();
+    }
+  }
+
+  if (tracks) {
+    tracks->ResetCurrentID();
+    AliVParticle* track = tracks->GetNextAcceptParticle();
+    while (track) {
+      if (track->Eta() >= minEta && track->Eta() < maxEta) {
+        fEta.push_back(track->Eta());
+        fPhi.push_back(TVector2::Phi_0_2pi(track->Phi()));
+        fPt.push_back(track->Pt());
+      }
+      track = tracks->GetNextAcceptParticle();
+    }
+  }
+
+  fNEta = TMath::CeilNint((maxEta - minEta) / cellSize);
+  fNPhi = TMath::CeilNint(TMath::TwoPi() / cellSize);
+  fMinEta = minEta;
+  fCellEta = (maxEta - minEta) / fNEta;
+  fCellPhi = TMath::TwoPi() / fNPhi;
+
+  // sort the particles by cell (counting sort)
+  const Int_t nCells = fNEta * fNPhi;
+  const Int_t nPart = fPt.size();
+  std::vector<Int_t> cell(nPart);
+  fCellStart.assign(nCells + 1, 0);
+  for (Int_t k = 0; k < nPart; k++) {
+    Int_t i = TMath::Min(Int_t((fEta[k] - fMinEta) / fCellEta), fNEta - 1);
+    Int_t j = TMath::Min(Int_t(fPhi[k] / fCellPhi), fNPhi - 1);
+    cell[k] = i * fNPhi + j;
+    fCellStart[cell[k] + 1]++;
+  }
+  for (Int_t c = 0; c < nCells; c++) fCellStart[c + 1] += fCellStart[c];
+
+  std::vector<Int_t> next(fCellStart.begin(), fCellStart.end() - 1);
+  std::vector<Double_t> eta(nPart), phi(nPart), pt(nPart);
+  for (Int_t k = 0; k < nPart; k++) {
+    Int_t pos = next[cell[k]]++;
+    eta[pos] = fEta[k];
+    phi[pos] = fPhi[k];
+    pt[pos] = fPt[k];
+  }
+  fEta.swap(eta);
+  fPhi.swap(phi);
+  fPt.swap(pt);
+
+  // integral image of the cell sums
+  const Int_t row = fNPhi + 1;
+  fIntegral.assign((fNEta + 1) * row, 0.);
+  for (Int_t i = 0; i < fNEta; i++) {
+    Double_t rowSum = 0;
+    for (Int_t j = 0; j < fNPhi; j++) {
+      const Int_t c = i * fNPhi + j;
+      for (Int_t k = fCellStart[c]; k < fCellStart[c + 1]; k++) rowSum += fPt[k];
+      fIntegral[(i + 1) * row + j + 1] = fIntegral[i * row + j + 1] + rowSum;
+    }
+  }
+}
+
+//________________________________________________________________________
+Double_t AliAnalysisTaskDeltaPt::ConeSumImage::CellRangeSum(Int_t row, Int_t j0, Int_t j1) const
+{
+  // Sum of the cells j0 <= j <= j1 of an eta row, j is not wrapped (at most fNPhi cells).
+
+  const Int_t w = fNPhi + 1;
+  Double_t sum = 0;
+  while (j0 <= j1) {
+    const Int_t a = WrapPhiCell(j0);
+    const Int_t b = TMath::Min(a + j1 - j0, fNPhi - 1);
+    sum += fIntegral[(row + 1) * w + b + 1] - fIntegral[row * w + b + 1] - fIntegral[(row + 1) * w + a] + fIntegral[row * w + a];
+    j0 += b - a + 1;
+  }
+  return sum;
+}
+
+//________________________________________________________________________
+Double_t AliAnalysisTaskDeltaPt::ConeSumImage::Sum(Double_t eta, Double_t phi, Double_t hEta, Double_t hPhi, Bool_t circle) const
+{
+  // Sum of the pt in the circle of radius hEta (= hPhi) or in the rectangle |deta| <= hEta, |dphi| <= hPhi
+  // around (eta, phi). The phi extent must be smaller than pi.
+
+  if (!IsValid()) return 0;
+
+  Double_t sum = 0;
+  const Int_t i0 = TMath::Max(TMath::FloorNint((eta - hEta - fMinEta) / fCellEta), 0);
+  const Int_t i1 = TMath::Min(TMath::FloorNint((eta + hEta - fMinEta) / fCellEta), fNEta - 1);
+  for (Int_t i = i0; i <= i1; i++) {
+    // distance in eta of the closest and farthest edge of the row
+    const Double_t lo = fMinEta + i * fCellEta;
+    const Double_t hi = lo + fCellEta;
+    const Double_t dMin = (eta < lo) ? lo - eta : ((eta > hi) ? eta - hi : 0.);
+    const Double_t dMax = TMath::Max(TMath::Abs(lo - eta), TMath::Abs(hi - eta));
+
+    // half width in phi of the region touched by the row and of the region where the full row is inside
+    Double_t hOut = -1, hIn = -1;
+    if (circle) {
+      if (dMin > hEta) continue;
+      hOut = TMath::Sqrt(hEta * hEta - dMin * dMin);
+      if (dMax < hEta) hIn = TMath::Sqrt(hEta * hEta - dMax * dMax);
+    }
+    else {
+      if (dMin > hEta) continue;
+      hOut = hPhi;
+      if (dMax <= hEta) hIn = hPhi;
+    }
+
+    const Int_t jOut0 = TMath::FloorNint((phi - hOut) / fCellPhi);
+    const Int_t jOut1 = TMath::FloorNint((phi + hOut) / fCellPhi);
+    Int_t jIn0 = jOut1 + 1, jIn1 = jOut1;
+    if (hIn >= 0) {
+      jIn0 = TMath::CeilNint((phi - hIn) / fCellPhi);
+      jIn1 = TMath::FloorNint((phi + hIn) / fCellPhi) - 1;
+    }
+
+    // cells fully inside from the integral image
+    if (jIn0 <= jIn1) sum += CellRangeSum(i, jIn0, jIn1);
+
+    // boundary cells particle by particle
+    for (Int_t j = jOut0; j <= jOut1; j++) {
+      if (j >= jIn0 && j <= jIn1) continue;
+      const Int_t jw = WrapPhiCell(j);
+      const Double_t phiShift = (j - jw) / fNPhi * TMath::TwoPi();
+      const Int_t c = i * fNPhi + jw;
+      for (Int_t k = fCellStart[c]; k < fCellStart[c + 1]; k++) {
+        const Double_t deta = fEta[k] - eta;
+        const Double_t dphi = fPhi[k] + phiShift - phi;
+        if (circle) {
+          if (deta * deta + dphi * dphi <= hEta * hEta) sum += fPt[k];
+        }
+        else {
+          if (TMath::Abs(deta) <= hEta && TMath::Abs(dphi) <= hPhi) sum += fPt[k];
+        }
+      }
+    }
+  }
+
+  return sum;
+}
@@ -12,6 +12,8 @@ class AliJetContainer;
 class AliParticleContainer;
 class AliClusterContainer;
 
+#include <vector>
+
 #include "AliAnalysisTaskEmcalJet.h"
 
 class AliAnalysisTaskDeltaPt : public AliAnalysisTaskEmcalJet {
@@ -31,6 +33,40 @@ class AliAnalysisTaskDeltaPt : public AliAnalysisTaskEmcalJet {
   void                        SetConeEtaPhiTPC()   ;
   void                        SetConeEtaLimits(Float_t min, Float_t max)           { fConeMinEta = min, fConeMaxEta = max  ; }
   void                        SetConePhiLimits(Float_t min, Float_t max)           { fConeMinPhi = min, fConeMaxPhi = max  ; }
+  void                        SetConeSumImage(Bool_t b, Double_t cell=0.05)        { fUseConeSumImage = b, fConeSumImageCell = cell; }
+
+  // Per event (eta, phi) image of the track and cluster pt: cells of about cellSize x cellSize
+  // with an integral image of the cell sums and the particles sorted by cell.
+  // The sum in a cone (or rectangle) takes the cells fully inside from the integral image
+  // and tests the particles of the boundary cells one by one, so it is the exact sum.
+  class ConeSumImage {
+  public:
+    ConeSumImage() : fNEta(0), fNPhi(0), fMinEta(0), fCellEta(0), fCellPhi(0), fCellStart(), fIntegral(), fEta(), fPhi(), fPt() {}
+
+    void                      Build(AliParticleContainer* tracks, AliClusterContainer* clusters, const Double_t *vertex,
+                                    Double_t minEta, Double_t maxEta, Double_t cellSize);
+    void                      Reset()                                                                         { fNEta = 0; }
+    Bool_t                    IsValid() const                                                                 { return fNEta > 0; }
+    Double_t                  GetCellPhi() const                                                              { return fCellPhi; }
+    Double_t                  ConeSum(Double_t eta, Double_t phi, Double_t r) const                           { return Sum(eta, phi, r, r, kTRUE); }
+    Double_t                  RectangleSum(Double_t eta, Double_t phi, Double_t hEta, Double_t hPhi) const    { return Sum(eta, phi, hEta, hPhi, kFALSE); }
+
+  private:
+    Double_t                  Sum(Double_t eta, Double_t phi, Double_t hEta, Double_t hPhi, Bool_t circle) const;
+    Double_t                  CellRangeSum(Int_t row, Int_t j0, Int_t j1) const;
+    Int_t                     WrapPhiCell(Int_t j) const                                                      { return ((j % fNPhi) + fNPhi) % fNPhi; }
+
+    Int_t                     fNEta;                       // Number of cells in eta, 0 if not built
+    Int_t                     fNPhi;                       // Number of cells in phi (full azimuth)
+    Double_t                  fMinEta;                     // Lower eta edge of the image
+    Double_t                  fCellEta;                    // Cell size in eta
+    Double_t                  fCellPhi;                    // Cell size in phi
+    std::vector<Int_t>        fCellStart;                  // First particle of each cell (fNEta*fNPhi+1)
+    std::vector<Double_t>     fIntegral;                   // Integral image, pt of the cells of rows < i and columns < j ((fNEta+1)*(fNPhi+1))
+    std::vector<Double_t>     fEta;                        // Eta of the particles sorted by cell
+    std::vector<Double_t>     fPhi;                        // Phi of the particles sorted by cell, in [0, 2pi)
+    std::vector<Double_t>     fPt;                         // Pt of the particles sorted by cell
+  };
 
  protected:
   void                        AllocateHistogramArrays()                                                                     ;
@@ -41,7 +77,7 @@ class AliAnalysisTaskDeltaPt : public AliAnalysisTaskEmcalJet {
   void                        DoEmbTrackLoop()                                                                              ;
   void                        DoEmbClusterLoop()                                                                            ;
   void                        GetRandomCone(Float_t &pt, Float_t &eta, Float_t &phi, AliParticleContainer* tracks, AliClusterContainer* clusters,
-					    AliEmcalJet *jet = 0, Bool_t bPartialExclusion = 0) const;
+					    AliEmcalJet *jet = 0, Bool_t bPartialExclusion = 0, const ConeSumImage *image = 0) const;
   Double_t                    GetNColl() const;
 
 
@@ -53,6 +89,8 @@ class AliAnalysisTaskDeltaPt : public AliAnalysisTaskEmcalJet {
   Float_t                     fConeMaxEta;                 // Maximum eta of the random cones
   Float_t                     fConeMinPhi;                 // Minimum phi of the random cones
   Float_t                     fConeMaxPhi;                 // Maximum phi of the random cones
+  Bool_t                      fUseConeSumImage;            // Sum the random cones with the (eta, phi) image of the event
+  Double_t                    fConeSumImageCell;           // Cell size of the (eta, phi) image
 
   AliJetContainer            *fJetsCont;                   //!Jets
   AliParticleContainer       *fTracksCont;                 //!Tracks
@@ -62,6 +100,8 @@ class AliAnalysisTaskDeltaPt : public AliAnalysisTaskEmcalJet {
   AliClusterContainer        *fEmbCaloClustersCont;        //!Embedded clusters  
   AliParticleContainer       *fRandTracksCont;             //!Randomized tracks
   AliClusterContainer        *fRandCaloClustersCont;       //!Randomized clusters
+  ConeSumImage                fConeImage;                  //!(eta, phi) image of the tracks and clusters of the event
+  ConeSumImage                fRandConeImage;              //!(eta, phi) image of the randomized tracks and clusters of the event
 
   // General
   TH2                        *fHistRhovsCent;              //!Rho vs. centrality
@@ -98,6 +138,6 @@ class AliAnalysisTaskDeltaPt : public AliAnalysisTaskEmcalJet {
   AliAnalysisTaskDeltaPt(const AliAnalysisTaskDeltaPt&);            // not implemented
   AliAnalysisTaskDeltaPt &operator=(const AliAnalysisTaskDeltaPt&); // not implemented
 
-  ClassDef(AliAnalysisTaskDeltaPt, 5) // deltaPt analysis task
+  ClassDef(AliAnalysisTaskDeltaPt, 6) // deltaPt analysis task
 };
 #endif
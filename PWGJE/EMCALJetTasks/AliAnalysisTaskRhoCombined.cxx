@@ -0,0 +1,344 @@
+// $Id$
+//
+// Calculation of several rho estimates from one collection of kt jets:
+// - median of pt/area of the kt jets ("fOutRhoName", as AliAnalysisTaskRho)
+// - the same, excluding kt jets which share constituents with signal jets ("_Sparse")
+// - the sparse rho times the occupancy correction ("_CMS", as AliAnalysisTaskRhoSparse)
+// - median of the track pt density in a fixed (eta,phi) grid ("_Grid"), no jets needed
+// - optionally the median rho as AliLocalRhoParameter ("_Local"), to be used
+//   where a local rho is expected but no flow modulation is fitted
+// One task and one kt jet finder replace a set of rho tasks running on the same jets.
+//
+// If scale function is given the scaled rho will be exported
+// with the name as "fOutRhoName".apppend("_Scaled").
+
+#include "AliAnalysisTaskRhoCombined.h"
+
+#include <TClonesArray.h>
+#include <TH2F.h>
+#include <TMath.h>
+#include <TVector2.h>
+
+#include "AliEmcalJet.h"
+#include "AliLog.h"
+#include "AliRhoParameter.h"
+#include "AliLocalRhoParameter.h"
+#include "AliJetContainer.h"
+#include "AliParticleContainer.h"
+
+ClassImp(AliAnalysisTaskRhoCombined)
+
+//________________________________________________________________________
+AliAnalysisTaskRhoCombined::AliAnalysisTaskRhoCombined() : 
+  AliAnalysisTaskRhoBase("AliAnalysisTaskRhoCombined"),
+  fNExclLeadJets(0),
+  fSignalJetMinPt(5),
+  fGridCellSize(0.4),
+  fDoGridRho(kTRUE),
+  fDoLocalRho(kFALSE),
+  fOutRhoSparse(0),
+  fOutRhoCMS(0),
+  fOutRhoGrid(0),
+  fOutRhoLocal(0),
+  fOccCorr(0),
+  fRhoVec(),
+  fRhoSparseVec(),
+  fGridPt(),
+  fHistOccCorrvsCent(0),
+  fHistRhoSparsevsCent(0),
+  fHistRhoCMSvsCent(0),
+  fHistRhoGridvsCent(0)
+{
+  // Constructor.
+}
+
+//________________________________________________________________________
+AliAnalysisTaskRhoCombined::AliAnalysisTaskRhoCombined(const char *name, Bool_t histo) :
+  AliAnalysisTaskRhoBase(name, histo),
+  fNExclLeadJets(0),
+  fSignalJetMinPt(5),
+  fGridCellSize(0.4),
+  fDoGridRho(kTRUE),
+  fDoLocalRho(kFALSE),
+  fOutRhoSparse(0),
+  fOutRhoCMS(0),
+  fOutRhoGrid(0),
+  fOutRhoLocal(0),
+  fOccCorr(0),
+  fRhoVec(),
+  fRhoSparseVec(),
+  fGridPt(),
+  fHistOccCorrvsCent(0),
+  fHistRhoSparsevsCent(0),
+  fHistRhoCMSvsCent(0),
+  fHistRhoGridvsCent(0)
+{
+  // Constructor.
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskRhoCombined::UserCreateOutputObjects()
+{
+  if (!fCreateHisto) return;
+
+  AliAnalysisTaskRhoBase::UserCreateOutputObjects();
+  
+  fHistOccCorrvsCent = new TH2F("OccCorrvsCent", "OccCorrvsCent", 101, -1, 100, 2000, 0 , 2);
+  fOutput->Add(fHistOccCorrvsCent);
+
+  fHistRhoSparsevsCent = new TH2F("fHistRhoSparsevsCent", "fHistRhoSparsevsCent", 101, -1,  100, fNbins, fMinBinPt, fMaxBinPt*2);
+  fHistRhoSparsevsCent->GetXaxis()->SetTitle("Centrality (%)");
+  fHistRhoSparsevsCent->GetYaxis()->SetTitle("#rho_{sparse} (GeV/c * rad^{-1})");
+  fOutput->Add(fHistRhoSparsevsCent);
+
+  fHistRhoCMSvsCent = new TH2F("fHistRhoCMSvsCent", "fHistRhoCMSvsCent", 101, -1,  100, fNbins, fMinBinPt, fMaxBinPt*2);
+  fHistRhoCMSvsCent->GetXaxis()->SetTitle("Centrality (%)");
+  fHistRhoCMSvsCent->GetYaxis()->SetTitle("#rho_{CMS} (GeV/c * rad^{-1})");
+  fOutput->Add(fHistRhoCMSvsCent);
+
+  if (fDoGridRho) {
+    fHistRhoGridvsCent = new TH2F("fHistRhoGridvsCent", "fHistRhoGridvsCent", 101, -1,  100, fNbins, fMinBinPt, fMaxBinPt*2);
+    fHistRhoGridvsCent->GetXaxis()->SetTitle("Centrality (%)");
+    fHistRhoGridvsCent->GetYaxis()->SetTitle("#rho_{grid} (GeV/c * rad^{-1})");
+    fOutput->Add(fHistRhoGridvsCent);
+  }
+}
+
+//________________________________________________________________________
+AliRhoParameter *AliAnalysisTaskRhoCombined::PublishRho(AliRhoParameter *rho)
+{
+  // Attach an additional rho object to the event, same policy as the base class.
+
+  if (fAttachToEvent) {
+    if (!(InputEvent()->FindListObject(rho->GetName()))) {
+      InputEvent()->AddObject(rho);
+    } else {
+      AliFatal(Form("%s: Container with same name %s already present. Aborting", GetName(), rho->GetName()));
+    }
+  }
+  return rho;
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskRhoCombined::ExecOnce() 
+{
+  // Init the analysis.
+
+  if (!fOutRhoSparse) fOutRhoSparse = PublishRho(new AliRhoParameter(GetOutRhoSparseName(), 0));
+  if (!fOutRhoCMS)    fOutRhoCMS    = PublishRho(new AliRhoParameter(GetOutRhoCMSName(), 0));
+  if (fDoGridRho && !fOutRhoGrid) {
+    fOutRhoGrid = PublishRho(new AliRhoParameter(GetOutRhoGridName(), 0));
+  }
+  if (fDoLocalRho && !fOutRhoLocal) {
+    fOutRhoLocal = new AliLocalRhoParameter(GetOutRhoLocalName(), 0);
+    PublishRho(fOutRhoLocal);
+  }
+
+  AliAnalysisTaskRhoBase::ExecOnce();
+}
+
+//________________________________________________________________________
+Bool_t AliAnalysisTaskRhoCombined::IsJetOverlapping(AliEmcalJet* jet1, AliEmcalJet* jet2) const
+{
+  for (Int_t i = 0; i < jet1->GetNumberOfTracks(); ++i)
+  {
+    Int_t jet1Track = jet1->TrackAt(i);
+    for (Int_t j = 0; j < jet2->GetNumberOfTracks(); ++j)
+    {
+      Int_t jet2Track = jet2->TrackAt(j);
+      if (jet1Track == jet2Track)
+        return kTRUE;
+    }
+  }
+  return kFALSE;
+}
+
+//________________________________________________________________________
+Double_t AliAnalysisTaskRhoCombined::GetGridRho()
+{
+  // Median of the summed track pt per unit area in a fixed (eta,phi) grid
+  // covering the acceptance of the particle container; empty cells count.
+
+  AliParticleContainer *tracks = GetParticleContainer(0);
+  if (!tracks) return 0;
+
+  Double_t etaMin = tracks->GetParticleEtaMin();
+  Double_t etaMax = tracks->GetParticleEtaMax();
+  Double_t phiMin = tracks->GetParticlePhiMin();
+  Double_t phiMax = tracks->GetParticlePhiMax();
+  if (phiMax - phiMin > TMath::TwoPi()) {
+    phiMin = 0;
+    phiMax = TMath::TwoPi();
+  }
+  if (etaMax <= etaMin || phiMax <= phiMin || fGridCellSize <= 0) return 0;
+
+  Int_t nEta = TMath::Max(1, TMath::Nint((etaMax - etaMin) / fGridCellSize));
+  Int_t nPhi = TMath::Max(1, TMath::Nint((phiMax - phiMin) / fGridCellSize));
+  Double_t dEta = (etaMax - etaMin) / nEta;
+  Double_t dPhi = (phiMax - phiMin) / nPhi;
+  Bool_t fullPhi = (phiMax - phiMin) >= TMath::TwoPi() - 1e-6;
+
+  fGridPt.assign(nEta * nPhi, 0.);
+
+  AliVParticle *track = 0;
+  tracks->ResetCurrentID();
+  while ((track = tracks->GetNextAcceptParticle())) {
+    Double_t phi = fullPhi ? TVector2::Phi_0_2pi(track->Phi() - phiMin) : track->Phi() - phiMin;
+    Int_t ieta = TMath::FloorNint((track->Eta() - etaMin) / dEta);
+    Int_t iphi = TMath::FloorNint(phi / dPhi);
+    if (ieta < 0 || ieta >= nEta || iphi < 0 || iphi >= nPhi) continue;
+    fGridPt[ieta * nPhi + iphi] += track->Pt();
+  }
+
+  Double_t area = dEta * dPhi;
+  for (UInt_t i = 0; i < fGridPt.size(); i++) fGridPt[i] /= area;
+
+  return TMath::Median(fGridPt.size(), &fGridPt[0]);
+}
+
+//________________________________________________________________________
+Bool_t AliAnalysisTaskRhoCombined::Run() 
+{
+  // Run the analysis: one pass over the kt jets fills all jet-based estimates.
+
+  fOutRho->SetVal(0);
+  if (fOutRhoScaled)
+    fOutRhoScaled->SetVal(0);
+  fOutRhoSparse->SetVal(0);
+  fOutRhoCMS->SetVal(0);
+  if (fOutRhoGrid)
+    fOutRhoGrid->SetVal(0);
+  if (fOutRhoLocal)
+    fOutRhoLocal->SetVal(0);
+  fOccCorr = 0;
+
+  if (fOutRhoGrid)
+    fOutRhoGrid->SetVal(GetGridRho());
+
+  if (!fJets)
+    return kFALSE;
+
+  const Int_t Njets = fJets->GetEntries();
+
+  Int_t maxJetIds[]   = {-1, -1};
+  Float_t maxJetPts[] = { 0,  0};
+
+  if (fNExclLeadJets > 0) {
+    for (Int_t ij = 0; ij < Njets; ++ij) {
+      AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(ij));
+      if (!jet) {
+	AliError(Form("%s: Could not receive jet %d", GetName(), ij));
+	continue;
+      } 
+
+      if (!AcceptJet(jet))
+        continue;
+
+      if (jet->Pt() > maxJetPts[0]) {
+	maxJetPts[1] = maxJetPts[0];
+	maxJetIds[1] = maxJetIds[0];
+	maxJetPts[0] = jet->Pt();
+	maxJetIds[0] = ij;
+      } else if (jet->Pt() > maxJetPts[1]) {
+	maxJetPts[1] = jet->Pt();
+	maxJetIds[1] = ij;
+      }
+    }
+    if (fNExclLeadJets < 2) {
+      maxJetIds[1] = -1;
+      maxJetPts[1] = 0;
+    }
+  }
+
+  // signal jets are selected once, not for each kt jet
+  AliJetContainer *sigjets = static_cast<AliJetContainer*>(fJetCollArray.At(1));
+  std::vector<AliEmcalJet*> signalJets;
+  if (sigjets) {
+    for (Int_t j = 0; j < sigjets->GetNJets(); j++) {
+      AliEmcalJet* signalJet = sigjets->GetAcceptJet(j);
+      if (signalJet && signalJet->Pt() > fSignalJetMinPt) signalJets.push_back(signalJet);
+    }
+  }
+
+  fRhoVec.clear();
+  fRhoSparseVec.clear();
+  Double_t TotaljetArea=0;
+  Double_t TotaljetAreaPhys=0;
+
+  for (Int_t iJets = 0; iJets < Njets; ++iJets) {
+
+    // exlcuding lead jets
+    if (iJets == maxJetIds[0] || iJets == maxJetIds[1])
+      continue;
+
+    AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(iJets));
+    if (!jet) {
+      AliError(Form("%s: Could not receive jet %d", GetName(), iJets));
+      continue;
+    } 
+
+    TotaljetArea+=jet->Area();
+    
+    if(jet->Pt()>0.1){
+      TotaljetAreaPhys+=jet->Area();
+    }
+
+    if (!AcceptJet(jet))
+      continue;
+
+    fRhoVec.push_back(jet->Pt() / jet->Area());
+
+    if (jet->Pt() <= 0.1)
+      continue;
+
+    Bool_t isOverlapping = kFALSE;
+    for (UInt_t j = 0; j < signalJets.size(); j++) {
+      if (IsJetOverlapping(signalJets[j], jet)) {
+        isOverlapping = kTRUE;
+        break;
+      }
+    }
+
+    if (!isOverlapping)
+      fRhoSparseVec.push_back(jet->Pt() / jet->Area());
+  }
+
+  if(TotaljetArea>0) fOccCorr=TotaljetAreaPhys/TotaljetArea;
+
+  if (!fRhoVec.empty()) {
+    Double_t rho = TMath::Median(fRhoVec.size(), &fRhoVec[0]);
+    fOutRho->SetVal(rho);
+    if (fOutRhoLocal)
+      fOutRhoLocal->SetVal(rho);
+
+    if (fOutRhoScaled) {
+      Double_t rhoScaled = rho * GetScaleFactor(fCent);
+      fOutRhoScaled->SetVal(rhoScaled);
+    }
+  }
+
+  if (!fRhoSparseVec.empty()) {
+    Double_t rho = TMath::Median(fRhoSparseVec.size(), &fRhoSparseVec[0]);
+    fOutRhoSparse->SetVal(rho);
+    fOutRhoCMS->SetVal(rho * fOccCorr);
+  }
+
+  return kTRUE;
+}
+
+//________________________________________________________________________
+Bool_t AliAnalysisTaskRhoCombined::FillHistograms() 
+{
+  // Fill histograms.
+
+  if (!AliAnalysisTaskRhoBase::FillHistograms())
+    return kFALSE;
+
+  fHistOccCorrvsCent->Fill(fCent, fOccCorr);
+  fHistRhoSparsevsCent->Fill(fCent, fOutRhoSparse->GetVal());
+  fHistRhoCMSvsCent->Fill(fCent, fOutRhoCMS->GetVal());
+  if (fHistRhoGridvsCent)
+    fHistRhoGridvsCent->Fill(fCent, fOutRhoGrid->GetVal());
+
+  return kTRUE;
+}
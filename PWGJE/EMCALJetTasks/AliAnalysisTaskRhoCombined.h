@@ -0,0 +1,65 @@
+#ifndef ALIANALYSISTASKRHOCOMBINED_H
+#define ALIANALYSISTASKRHOCOMBINED_H
+
+// $Id$
+
+#include <vector>
+
+class AliLocalRhoParameter;
+
+#include "AliAnalysisTaskRhoBase.h"
+
+class AliAnalysisTaskRhoCombined : public AliAnalysisTaskRhoBase {
+
+ public:
+  AliAnalysisTaskRhoCombined();
+  AliAnalysisTaskRhoCombined(const char *name, Bool_t histo=kFALSE);
+  virtual ~AliAnalysisTaskRhoCombined() {}
+
+  void             UserCreateOutputObjects();
+  void             SetExcludeLeadJets(UInt_t n)    { fNExclLeadJets = n    ; }
+  void             SetSignalJetMinPt(Double_t pt)  { fSignalJetMinPt = pt  ; }
+  void             SetGridCellSize(Double_t s)     { fGridCellSize = s     ; }
+  void             SetDoGridRho(Bool_t b)          { fDoGridRho = b        ; }
+  void             SetDoLocalRho(Bool_t b)         { fDoLocalRho = b       ; }
+
+  TString          GetOutRhoSparseName()  const { return fOutRhoName + "_Sparse"; }
+  TString          GetOutRhoCMSName()     const { return fOutRhoName + "_CMS"; }
+  TString          GetOutRhoGridName()    const { return fOutRhoName + "_Grid"; }
+  TString          GetOutRhoLocalName()   const { return fOutRhoName + "_Local"; }
+
+ protected:
+  void             ExecOnce();
+  Bool_t           Run();
+  Bool_t           FillHistograms();
+
+  AliRhoParameter *PublishRho(AliRhoParameter *rho);
+  Bool_t           IsJetOverlapping(AliEmcalJet* jet1, AliEmcalJet* jet2) const;
+  Double_t         GetGridRho();
+
+  UInt_t           fNExclLeadJets;                 // number of leading jets to be excluded from the median calculation
+  Double_t         fSignalJetMinPt;                // minimum pt of the signal jets whose overlapping kt jets are excluded (Sparse/CMS)
+  Double_t         fGridCellSize;                  // cell size in eta and phi of the grid-median estimate
+  Bool_t           fDoGridRho;                     // calculate the grid-median rho from the tracks
+  Bool_t           fDoLocalRho;                    // publish the median rho also as a local rho parameter
+
+  AliRhoParameter      *fOutRhoSparse;             //!median of the kt jets not overlapping with signal jets
+  AliRhoParameter      *fOutRhoCMS;                //!sparse rho times the occupancy correction
+  AliRhoParameter      *fOutRhoGrid;               //!grid-median rho
+  AliLocalRhoParameter *fOutRhoLocal;              //!median rho as local rho parameter
+  Double_t              fOccCorr;                  //!occupancy correction of the current event
+  std::vector<Double_t> fRhoVec;                   //!pt/area of the accepted kt jets
+  std::vector<Double_t> fRhoSparseVec;             //!pt/area of the accepted kt jets not overlapping with signal jets
+  std::vector<Double_t> fGridPt;                   //!summed track pt per grid cell
+
+  TH2F            *fHistOccCorrvsCent;             //!occupancy correction vs. centrality
+  TH2F            *fHistRhoSparsevsCent;           //!sparse rho vs. centrality
+  TH2F            *fHistRhoCMSvsCent;              //!CMS rho vs. centrality
+  TH2F            *fHistRhoGridvsCent;             //!grid-median rho vs. centrality
+
+  AliAnalysisTaskRhoCombined(const AliAnalysisTaskRhoCombined&);             // not implemented
+  AliAnalysisTaskRhoCombined& operator=(const AliAnalysisTaskRhoCombined&);  // not implemented
+  
+  ClassDef(AliAnalysisTaskRhoCombined, 1); // Rho task publishing several estimates from one kt clustering
+};
+#endif
@@ -69,6 +69,10 @@ AliEmcalJetTask::AliEmcalJetTask() :
   fTrackEfficiency(1.),
   fUtilities(0),
   fLocked(0),
+  fExtraJetAlgo(),
+  fExtraRadius(),
+  fExtraRecombScheme(),
+  fUseGhostTemplate(kFALSE),
   fJetsName(),
   fIsInit(0),
   fIsPSelSet(0),
@@ -76,7 +80,10 @@ AliEmcalJetTask::AliEmcalJetTask() :
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
   fJets(0),
-  fFastJetWrapper("AliEmcalJetTask","AliEmcalJetTask")
+  fFastJetWrapper("AliEmcalJetTask","AliEmcalJetTask"),
+  fExtraWrappers(),
+  fExtraJets(),
+  fAcceptanceBounds()
 {
 }
 
@@ -101,6 +108,10 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
   fTrackEfficiency(1.),
   fUtilities(0),
   fLocked(0),
+  fExtraJetAlgo(),
+  fExtraRadius(),
+  fExtraRecombScheme(),
+  fUseGhostTemplate(kFALSE),
   fJetsName(),
   fIsInit(0),
   fIsPSelSet(0),
@@ -108,7 +119,10 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
   fJets(0),
-  fFastJetWrapper(name,name)
+  fFastJetWrapper(name,name),
+  fExtraWrappers(),
+  fExtraJets(),
+  fAcceptanceBounds()
 {
 }
 
@@ -117,6 +131,22 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
  */
 AliEmcalJetTask::~AliEmcalJetTask()
 {
+  for (UInt_t i = 0; i < fExtraWrappers.size(); i++) delete fExtraWrappers[i];
+}
+
+/**
+ * Add a jet definition to be run on the same constituents as the main one.
+ * The jet branch name is generated in the same way as for the main definition.
+ * @param algo Jet algorithm
+ * @param radius Jet radius
+ * @param reco Recombination scheme
+ */
+void AliEmcalJetTask::AddJetDefinition(EJetAlgo_t algo, Double_t radius, ERecoScheme_t reco)
+{
+  if (IsLocked()) return;
+  fExtraJetAlgo.push_back(algo);
+  fExtraRadius.push_back(radius);
+  fExtraRecombScheme.push_back(reco);
 }
 
 /**
@@ -187,14 +217,18 @@ void AliEmcalJetTask::TerminateUtilities()
  */
 Bool_t AliEmcalJetTask::Run()
 {
-  // clear the jet array (normally a null operation)
+  // clear the jet arrays (normally a null operation)
   fJets->Delete();
+  for (UInt_t i = 0; i < fExtraJets.size(); i++) fExtraJets[i]->Delete();
 
   Int_t n = FindJets();
 
   if (n == 0) return kFALSE;
 
   FillJetBranch();
+  for (UInt_t i = 0; i < fExtraWrappers.size(); i++) {
+    FillJetBranch(*fExtraWrappers[i], fExtraJets[i], fExtraWrappers[i]->GetR(), kFALSE);
+  }
 
   return kTRUE;
 }
@@ -258,8 +292,17 @@ Int_t AliEmcalJetTask::FindJets()
 
   // run jet finder
   fFastJetWrapper.Run();
+  Int_t n = fFastJetWrapper.GetInclusiveJets().size();
+
+  // additional jet definitions run on the same input vectors (user indexes are kept)
+  for (UInt_t i = 0; i < fExtraWrappers.size(); i++) {
+    fExtraWrappers[i]->Clear();
+    fExtraWrappers[i]->AddInputVectors(fFastJetWrapper.GetInputVectors());
+    fExtraWrappers[i]->Run();
+    n += fExtraWrappers[i]->GetInclusiveJets().size();
+  }
 
-  return fFastJetWrapper.GetInclusiveJets().size();
+  return n;
 }
 
 /**
@@ -269,10 +312,22 @@ Int_t AliEmcalJetTask::FindJets()
  */
 void AliEmcalJetTask::FillJetBranch()
 {
-  PrepareUtilities();
+  FillJetBranch(fFastJetWrapper, fJets, fRadius, kTRUE);
+}
+
+/**
+ * This method fills a jet output branch with the jets found by a FastJet wrapper.
+ * @param wrapper FastJet wrapper that ran the jet finding
+ * @param jets Output jet branch
+ * @param radius Jet radius, used for the acceptance type
+ * @param utilities If kTRUE the utilities are executed
+ */
+void AliEmcalJetTask::FillJetBranch(AliFJWrapper& wrapper, TClonesArray* jets, Double_t radius, Bool_t utilities)
+{
+  if (utilities) PrepareUtilities();
 
   // loop over fastjet jets
-  std::vector<fastjet::PseudoJet> jets_incl = fFastJetWrapper.GetInclusiveJets();
+  std::vector<fastjet::PseudoJet> jets_incl = wrapper.GetInclusiveJets();
   // sort jets according to jet pt
   static Int_t indexes[9999] = {-1};
   GetSortedArray(indexes, jets_incl);
@@ -280,27 +335,27 @@ void AliEmcalJetTask::FillJetBranch()
   AliDebug(1,Form("%d jets found", (Int_t)jets_incl.size()));
   for (UInt_t ijet = 0, jetCount = 0; ijet < jets_incl.size(); ++ijet) {
     Int_t ij = indexes[ijet];
-    AliDebug(3,Form("Jet pt = %f, area = %f", jets_incl[ij].perp(), fFastJetWrapper.GetJetArea(ij)));
+    AliDebug(3,Form("Jet pt = %f, area = %f", jets_incl[ij].perp(), wrapper.GetJetArea(ij)));
 
     if (jets_incl[ij].perp() < fMinJetPt) continue;
-    if (fFastJetWrapper.GetJetArea(ij) < fMinJetArea) continue;
+    if (wrapper.GetJetArea(ij) < fMinJetArea) continue;
     if ((jets_incl[ij].eta() < fJetEtaMin) || (jets_incl[ij].eta() > fJetEtaMax) ||
         (jets_incl[ij].phi() < fJetPhiMin) || (jets_incl[ij].phi() > fJetPhiMax))
       continue;
 
-    AliEmcalJet *jet = new ((*fJets)[jetCount])
+    AliEmcalJet *jet = new ((*jets)[jetCount])
     		          AliEmcalJet(jets_incl[ij].perp(), jets_incl[ij].eta(), jets_incl[ij].phi(), jets_incl[ij].m());
     jet->SetLabel(ij);
 
-    fastjet::PseudoJet area(fFastJetWrapper.GetJetAreaVector(ij));
+    fastjet::PseudoJet area(wrapper.GetJetAreaVector(ij));
     jet->SetArea(area.perp());
     jet->SetAreaEta(area.eta());
     jet->SetAreaPhi(area.phi());
     jet->SetAreaE(area.E());
-    jet->SetJetAcceptanceType(FindJetAcceptanceType(jet->Eta(), jet->Phi_0_2pi(), fRadius));
+    jet->SetJetAcceptanceType(FindJetAcceptanceType(jet->Eta(), jet->Phi_0_2pi(), radius));
 
     // Fill constituent info
-    std::vector<fastjet::PseudoJet> constituents(fFastJetWrapper.GetJetConstituents(ij));
+    std::vector<fastjet::PseudoJet> constituents(wrapper.GetJetConstituents(ij));
     FillJetConstituents(jet, constituents, constituents);
 
     if (fGeom) {
@@ -311,13 +366,13 @@ void AliEmcalJetTask::FillJetBranch()
         jet->SetAxisInEmcal(kTRUE);
     }
 
-    ExecuteUtilities(jet, ij);
+    if (utilities) ExecuteUtilities(jet, ij);
 
     AliDebug(2,Form("Added jet n. %d, pt = %f, area = %f, constituents = %d", jetCount, jet->Pt(), jet->Area(), jet->GetNumberOfConstituents()));
     jetCount++;
   }
 
-  TerminateUtilities();
+  if (utilities) TerminateUtilities();
 }
 
 /**
@@ -376,12 +431,36 @@ void AliEmcalJetTask::ExecOnce()
   fFastJetWrapper.SetAlgorithm(ConvertToFJAlgo(fJetAlgo));
   fFastJetWrapper.SetRecombScheme(ConvertToFJRecoScheme(fRecombScheme));
   fFastJetWrapper.SetMaxRap(1);
+  fFastJetWrapper.SetUseGhostTemplate(fUseGhostTemplate);
 
   // setting legacy mode
   if (fLegacyMode) {
     fFastJetWrapper.SetLegacyMode(kTRUE);
   }
 
+  // additional jet definitions: same settings and constituents, own branch
+  for (UInt_t i = 0; i < fExtraRadius.size(); i++) {
+    EJetAlgo_t algo = static_cast<EJetAlgo_t>(fExtraJetAlgo[i]);
+    ERecoScheme_t reco = static_cast<ERecoScheme_t>(fExtraRecombScheme[i]);
+    TString jetsName = AliJetContainer::GenerateJetName(fJetType, algo, reco, fExtraRadius[i], GetParticleContainer(0), GetClusterContainer(0), fJetsTag);
+    if (InputEvent()->FindListObject(jetsName)) {
+      AliError(Form("%s: Object with name %s already in event! Skipping this jet definition", GetName(), jetsName.Data()));
+      continue;
+    }
+    TClonesArray* jets = new TClonesArray("AliEmcalJet");
+    jets->SetName(jetsName);
+    ::Info("AliEmcalJetTask::ExecOnce", "Jet collection with name '%s' has been added to the event.", jetsName.Data());
+    InputEvent()->AddObject(jets);
+
+    AliFJWrapper* wrapper = new AliFJWrapper(jetsName, jetsName);
+    wrapper->CopySettingsFrom(fFastJetWrapper);
+    wrapper->SetR(fExtraRadius[i]);
+    wrapper->SetAlgorithm(ConvertToFJAlgo(algo));
+    wrapper->SetRecombScheme(ConvertToFJRecoScheme(reco));
+    fExtraWrappers.push_back(wrapper);
+    fExtraJets.push_back(jets);
+  }
+
   InitUtilities();
 
   AliAnalysisTaskEmcal::ExecOnce();
@@ -788,52 +867,141 @@ fastjet::RecombinationScheme AliEmcalJetTask::ConvertToFJRecoScheme(ERecoScheme_
 UInt_t AliEmcalJetTask::FindJetAcceptanceType(Double_t eta, Double_t phi, Double_t r) {
   
   //This method has to be called after the run number is known because it needs the EMCal geometry object.
+  //Same conditions as IsJetInEmcal, IsJetInDcal, IsJetInDcalOnly and IsJetInPhos, with the bounds
+  //computed once per radius and run (see GetAcceptanceBounds)
   
+  const AcceptanceBounds& b = GetAcceptanceBounds(r);
+
   UInt_t jetAcceptanceType = AliEmcalJet::kUser; // all jets satify the "no acceptance cut" condition
+
+  Bool_t in[2][kNAccRegions];
+  for (Int_t k = 0; k < 2; k++) {
+    for (Int_t i = 0; i < kNAccRegions; i++) {
+      in[k][i] = (eta < b.fEtaMax[k][i] && eta > b.fEtaMin[k][i] && phi < b.fPhiMax[k][i] && phi > b.fPhiMin[k][i]);
+    }
+    if (!b.fHasGeom) in[k][kAccEMCAL] = in[k][kAccDCAL] = kFALSE;
+  }
   
-  // Check if TPC
-  if( eta < 0.9 && eta > -0.9 ) {
+  // Check if TPC (no phi bounds)
+  if( eta < b.fEtaMax[0][kAccTPC] && eta > b.fEtaMin[0][kAccTPC] ) {
     jetAcceptanceType |= AliEmcalJet::kTPC;
     // Check if TPCfid
-    if (eta < 0.9 - r && eta > -0.9 + r)
+    if (eta < b.fEtaMax[1][kAccTPC] && eta > b.fEtaMin[1][kAccTPC])
       jetAcceptanceType |= AliEmcalJet::kTPCfid;
   }
     
   // Check if EMCAL
-  if( IsJetInEmcal(eta, phi, 0) ) {
+  if( in[0][kAccEMCAL] ) {
     jetAcceptanceType |= AliEmcalJet::kEMCAL;
     // Check if EMCALfid
-    if( IsJetInEmcal(eta, phi, r) )
+    if( in[1][kAccEMCAL] )
       jetAcceptanceType |= AliEmcalJet::kEMCALfid;
   }
   
   // Check if DCAL (i.e. eta-phi rectangle spanning DCal, which includes most of PHOS)
-  if( IsJetInDcal(eta, phi, 0) ) {
+  if( in[0][kAccDCAL] ) {
     jetAcceptanceType |= AliEmcalJet::kDCAL;
     // Check if DCALfid
-    if( IsJetInDcal(eta, phi, r) )
+    if( in[1][kAccDCAL] )
       jetAcceptanceType |= AliEmcalJet::kDCALfid;
   }
   
   // Check if DCALonly (i.e. ONLY DCal, does not include any of PHOS region)
-  if( IsJetInDcalOnly(eta, phi, 0) ) {
+  Bool_t inDcalOnly[2];
+  for (Int_t k = 0; k < 2; k++) {
+    inDcalOnly[k] = in[k][kAccDCAL] && (TMath::Abs(eta) > b.fDcalOnlyEta[k] || (b.fDcalOnlyPhiCut[k] && phi > b.fDcalStandardPhiMax));
+  }
+  if( inDcalOnly[0] ) {
     jetAcceptanceType |= AliEmcalJet::kDCALonly;
     // Check if DCALonlyfid
-    if( IsJetInDcalOnly(eta, phi, r) )
+    if( inDcalOnly[1] )
       jetAcceptanceType |= AliEmcalJet::kDCALonlyfid;
   }
   
   // Check if PHOS
-  if( IsJetInPhos(eta, phi, 0) ) {
+  if( in[0][kAccPHOS] ) {
     jetAcceptanceType |= AliEmcalJet::kPHOS;
     // Check if PHOSfid
-    if( IsJetInPhos(eta, phi, r) )
+    if( in[1][kAccPHOS] )
       jetAcceptanceType |= AliEmcalJet::kPHOSfid;
   }
  
   return jetAcceptanceType;
 }
 
+/**
+ * Bounds of the acceptance regions for the jet radius r in the current run,
+ * computed at the first call with the same expressions as IsJetInEmcal, IsJetInDcal,
+ * IsJetInDcalOnly and IsJetInPhos.
+ * @param r jet radius
+ * @return bounds for r = 0 (index 0) and r (index 1)
+ */
+const AliEmcalJetTask::AcceptanceBounds& AliEmcalJetTask::GetAcceptanceBounds(Double_t r)
+{
+  for (UInt_t i = 0; i < fAcceptanceBounds.size(); i++) {
+    if (fAcceptanceBounds[i].fRadius == r && fAcceptanceBounds[i].fRunNumber == fRunNumber &&
+        fAcceptanceBounds[i].fHasGeom == (fGeom != 0)) return fAcceptanceBounds[i];
+  }
+
+  AcceptanceBounds b;
+  b.fRadius = r;
+  b.fRunNumber = fRunNumber;
+  b.fHasGeom = (fGeom != 0);
+  b.fDcalStandardPhiMax = 0;
+
+  // PHOS
+  Double_t phosPhiMin = 260; // Run 1
+  if (fRunNumber > 209121)
+    phosPhiMin = 250; // Run 2
+
+  for (Int_t k = 0; k < 2; k++) {
+    const Double_t rk = (k == 0) ? 0 : r;
+
+    b.fEtaMin[k][kAccTPC] = -0.9 + rk;
+    b.fEtaMax[k][kAccTPC] = 0.9 - rk;
+    b.fPhiMin[k][kAccTPC] = -TMath::Infinity();
+    b.fPhiMax[k][kAccTPC] = TMath::Infinity();
+
+    b.fEtaMin[k][kAccPHOS] = -0.130 + rk;
+    b.fEtaMax[k][kAccPHOS] = 0.130 - rk;
+    b.fPhiMin[k][kAccPHOS] = phosPhiMin * TMath::DegToRad() + rk;
+    b.fPhiMax[k][kAccPHOS] = 320 * TMath::DegToRad() - rk;
+
+    b.fDcalOnlyPhiCut[k] = (rk < 1e-6);
+
+    if (fGeom) {
+      b.fEtaMin[k][kAccEMCAL] = fGeom->GetArm1EtaMin() + rk;
+      b.fEtaMax[k][kAccEMCAL] = fGeom->GetArm1EtaMax() - rk;
+      if(fRunNumber >= 177295 && fRunNumber <= 197470) {//small SM masked in 2012 and 2013
+        b.fPhiMin[k][kAccEMCAL] = 1.405 + rk;
+        b.fPhiMax[k][kAccEMCAL] = 3.135 - rk;
+      }
+      else {
+        b.fPhiMin[k][kAccEMCAL] = fGeom->GetArm1PhiMin() * TMath::DegToRad() + rk;
+        b.fPhiMax[k][kAccEMCAL] = fGeom->GetEMCALPhiMax() * TMath::DegToRad() - rk;
+      }
+
+      b.fEtaMin[k][kAccDCAL] = fGeom->GetArm1EtaMin() + rk;
+      b.fEtaMax[k][kAccDCAL] = fGeom->GetArm1EtaMax() - rk;
+      b.fPhiMin[k][kAccDCAL] = fGeom->GetDCALPhiMin() * TMath::DegToRad() + rk;
+      b.fPhiMax[k][kAccDCAL] = fGeom->GetDCALPhiMax() * TMath::DegToRad() - rk;
+
+      b.fDcalOnlyEta[k] = fGeom->GetDCALInnerExtandedEta() + rk;
+      b.fDcalStandardPhiMax = fGeom->GetEMCGeometry()->GetDCALStandardPhiMax() * TMath::DegToRad();
+    }
+    else {
+      for (Int_t i = kAccEMCAL; i <= kAccDCAL; i++) {
+        b.fEtaMin[k][i] = b.fPhiMin[k][i] = 0;
+        b.fEtaMax[k][i] = b.fPhiMax[k][i] = 0;
+      }
+      b.fDcalOnlyEta[k] = 0;
+    }
+  }
+
+  fAcceptanceBounds.push_back(b);
+  return fAcceptanceBounds.back();
+}
+
 /**
  * Returns whether or not jet with given eta, phi, R is in EMCal.
  */
@@ -9,6 +9,8 @@ class TObjArray;
 class AliVEvent;
 class AliEmcalJetUtility;
 
+#include <vector>
+
 #include <AliLog.h>
 
 #include "AliAnalysisTaskEmcal.h"
@@ -41,6 +43,12 @@ namespace fastjet {
  * and its derived classes. Utilities can be added via the AddUtility(AliEmcalJetUtility*) method.
  * All the utilities added in the list will be executed. Users can implement new utilities
  * deriving a new class from AliEmcalJetUtility to interface functionalities of the FastJet contribs.
+ *
+ * Additional jet definitions (algorithm, radius, recombination scheme) can be added
+ * via AddJetDefinition(). They share the constituents selected for the main definition:
+ * the containers are read and the FastJet input vectors are prepared only once per event,
+ * and each additional definition produces its own jet branch. Utilities only run on the
+ * main definition.
  */
 class AliEmcalJetTask : public AliAnalysisTaskEmcal {
  public:
@@ -73,6 +81,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   void                   SetTrackEfficiency(Double_t t)             { if (IsLocked()) return; fTrackEfficiency  = t     ; }
   void                   SetLegacyMode(Bool_t mode)                 { if (IsLocked()) return; fLegacyMode       = mode  ; }
   void                   SetFillGhost(Bool_t b=kTRUE)               { if (IsLocked()) return; fFillGhost        = b     ; }
+  void                   SetUseGhostTemplate(Bool_t b=kTRUE)        { if (IsLocked()) return; fUseGhostTemplate = b     ; }
   void                   SetRadius(Double_t r)                      { if (IsLocked()) return; fRadius           = r     ; }
 
   void                   SetEtaRange(Double_t emi, Double_t ema);
@@ -82,6 +91,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   void                   SetPhiRange(Double_t pmi, Double_t pma);
 
   AliEmcalJetUtility*    AddUtility(AliEmcalJetUtility* utility);
+  void                   AddJetDefinition(EJetAlgo_t algo, Double_t radius, ERecoScheme_t reco = AliJetContainer::pt_scheme);
 
   Double_t               GetGhostArea()                   { return fGhostArea         ; }
   const char*            GetJetsName()                    { return fJetsName.Data()   ; }
@@ -100,6 +110,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   Double_t               GetTrackEfficiency()             { return fTrackEfficiency   ; }
 
   TClonesArray*          GetJets()                        { return fJets              ; }
+  Int_t                  GetNumberOfJetDefinitions() const { return fExtraRadius.size() + 1; }
   TObjArray*             GetUtilities()                   { return fUtilities         ; }
 
   void                   FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet::PseudoJet>& constituents,
@@ -138,6 +149,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
 
   Int_t                  FindJets();
   void                   FillJetBranch();
+  void                   FillJetBranch(AliFJWrapper& wrapper, TClonesArray* jets, Double_t radius, Bool_t utilities);
   void                   ExecOnce();
   void                   InitUtilities();
   void                   PrepareUtilities();
@@ -149,6 +161,24 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   Bool_t                 IsJetInDcalOnly(Double_t eta, Double_t phi, Double_t r);
   Bool_t                 IsJetInPhos(Double_t eta, Double_t phi, Double_t r);
 
+  // Acceptance regions of FindJetAcceptanceType, each an eta-phi rectangle
+  enum EAcceptanceRegion_t { kAccTPC = 0, kAccEMCAL, kAccDCAL, kAccPHOS, kNAccRegions };
+
+  // Bounds of the acceptance regions for one jet radius and run, index 0 for r = 0 and 1 for r (fiducial)
+  struct AcceptanceBounds {
+    Double_t             fRadius;                              // jet radius
+    Int_t                fRunNumber;                           // run of the bounds (masked EMCal SM, PHOS acceptance)
+    Bool_t               fHasGeom;                             // EMCal geometry available (EMCal, DCal regions)
+    Double_t             fEtaMin[2][kNAccRegions];             // lower eta bound (exclusive)
+    Double_t             fEtaMax[2][kNAccRegions];             // upper eta bound (exclusive)
+    Double_t             fPhiMin[2][kNAccRegions];             // lower phi bound (exclusive)
+    Double_t             fPhiMax[2][kNAccRegions];             // upper phi bound (exclusive)
+    Double_t             fDcalOnlyEta[2];                      // DCal only: |eta| above the inner extended eta
+    Bool_t               fDcalOnlyPhiCut[2];                   // DCal only: accept phi above the DCal standard phi max (r = 0)
+    Double_t             fDcalStandardPhiMax;                  // DCal standard phi max (rad)
+  };
+  const AcceptanceBounds& GetAcceptanceBounds(Double_t r);
+
   TString                fJetsTag;                // tag of jet collection (usually = "Jets")
 
   EJetType_t             fJetType;                // jet type (full, charged, neutral)
@@ -165,6 +195,10 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   Double_t               fTrackEfficiency;        // artificial tracking inefficiency (0...1)
   TObjArray             *fUtilities;              // jet utilities (gen subtractor, constituent subtractor etc.)
   Bool_t                 fLocked;                 // true if lock is set
+  std::vector<Int_t>     fExtraJetAlgo;           // jet algorithms of the additional jet definitions
+  std::vector<Double_t>  fExtraRadius;            // jet radii of the additional jet definitions
+  std::vector<Int_t>     fExtraRecombScheme;      // recombination schemes of the additional jet definitions
+  Bool_t                 fUseGhostTemplate;       // generate the ghosts once and rotate them in each event
 
   TString                fJetsName;               //!name of jet collection
   Bool_t                 fIsInit;                 //!=true if already initialized
@@ -175,6 +209,9 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
 
   TClonesArray          *fJets;                   //!jet collection
   AliFJWrapper           fFastJetWrapper;         //!fastjet wrapper
+  std::vector<AliFJWrapper*> fExtraWrappers;      //!fastjet wrappers of the additional jet definitions
+  std::vector<TClonesArray*> fExtraJets;          //!jet collections of the additional jet definitions
+  std::vector<AcceptanceBounds> fAcceptanceBounds; //!acceptance bounds per jet radius, see FindJetAcceptanceType
 
   static const Int_t     fgkConstIndexShift;      //!contituent index shift
 
@@ -182,8 +219,8 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   AliEmcalJetTask(const AliEmcalJetTask&);            // not implemented
   AliEmcalJetTask &operator=(const AliEmcalJetTask&); // not implemented
 
-  /// \cond CLASSIMP
-  ClassDef(AliEmcalJetTask, 23);
-  /// \endcond
+  // \cond CLASSIMP
+  ClassDef(AliEmcalJetTask, 26);
+  // \endcond
 };
 #endif
@@ -15,6 +15,8 @@ AliEmcalJetUtilityConstSubtractor::AliEmcalJetUtilityConstSubtractor() :
   fRhomName(""),
   fRho(1e-6),
   fRhom(1e-6),
+  fEventWise(kFALSE),
+  fMaxDeltaR(0.25),
   fJetsSub(0x0),
   fParticlesSub(0x0),
   fRhoParam(0),
@@ -34,6 +36,8 @@ AliEmcalJetUtilityConstSubtractor::AliEmcalJetUtilityConstSubtractor(const char*
   fRhomName(""),
   fRho(1e-6),
   fRhom(1e-6),
+  fEventWise(kFALSE),
+  fMaxDeltaR(0.25),
   fJetsSub(0x0),
   fParticlesSub(0x0),
   fRhoParam(0),
@@ -52,6 +56,8 @@ AliEmcalJetUtilityConstSubtractor::AliEmcalJetUtilityConstSubtractor(const AliEm
   fRhomName(other.fRhomName),
   fRho(other.fRho),
   fRhom(other.fRhom),
+  fEventWise(other.fEventWise),
+  fMaxDeltaR(other.fMaxDeltaR),
   fJetsSub(other.fJetsSub),
   fParticlesSub(other.fParticlesSub),
   fRhoParam(other.fRhoParam),
@@ -74,6 +80,8 @@ AliEmcalJetUtilityConstSubtractor& AliEmcalJetUtilityConstSubtractor::operator=(
   fRhomName = other.fRhomName;
   fRho = other.fRho;
   fRhom = other.fRhom;
+  fEventWise = other.fEventWise;
+  fMaxDeltaR = other.fMaxDeltaR;
   fJetsSub = other.fJetsSub;
   fParticlesSub = other.fParticlesSub;
   fRhoParam = other.fRhoParam;
@@ -150,7 +158,8 @@ void AliEmcalJetUtilityConstSubtractor::Prepare(AliFJWrapper& fjw)
   if (fJetsSub) fJetsSub->Delete();
 
   fjw.SetUseExternalBkg(fUseExternalBkg, fRho, fRhom);
-  fjw.DoConstituentSubtraction();
+  if (fEventWise) fjw.DoEventConstituentSubtraction(fMaxDeltaR);
+  else            fjw.DoConstituentSubtraction();
 }
 
 //______________________________________________________________________________
@@ -25,6 +25,7 @@ class AliEmcalJetUtilityConstSubtractor : public AliEmcalJetUtility
   void                   SetRhoName(const char *n)           { fRhoName      = n         ; }
   void                   SetRhomName(const char *n)          { fRhomName     = n         ; }
   void                   SetUseExternalBkg(Bool_t b)         { fUseExternalBkg   = b     ; }
+  void                   SetEventWise(Bool_t b, Double_t maxDeltaR = 0.25) { fEventWise = b; fMaxDeltaR = maxDeltaR; }
 
   void                   SetJetsSubName(const char *n)       { fJetsSubName      = n     ; }
   void                   SetParticlesSubName(const char *n)  { fParticlesSubName = n     ; }
@@ -43,12 +44,14 @@ class AliEmcalJetUtilityConstSubtractor : public AliEmcalJetUtility
   TString                fRhomName;                           // name of rhom
   Double_t               fRho;                                // pT background density
   Double_t               fRhom;                               // mT background density
+  Bool_t                 fEventWise;                          // event-wide subtraction (AliFJWrapper::DoEventConstituentSubtraction) instead of the contrib subtractor per jet
+  Double_t               fMaxDeltaR;                          // max distance between ghost and particle for the event-wide subtraction
 
   TClonesArray          *fJetsSub;                            //!subtracted jet collection
   TClonesArray          *fParticlesSub;                       //!subtracted particle collection
   AliRhoParameter       *fRhoParam;                           //!event rho
   AliRhoParameter       *fRhomParam;                          //!event rhom
 
-  ClassDef(AliEmcalJetUtilityConstSubtractor, 1) // Emcal jet utility that implements the constituent subtractor form the fastjet contrib
+  ClassDef(AliEmcalJetUtilityConstSubtractor, 2) // Emcal jet utility that implements the constituent subtractor form the fastjet contrib
 };
 #endif
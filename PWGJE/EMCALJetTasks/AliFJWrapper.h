@@ -4,7 +4,11 @@
 #if !defined(__CINT__)
 
 #include <vector>
+#include <map>
+#include <algorithm>
 #include <TString.h>
+#include <TMath.h>
+#include <TRandom3.h>
 #include "AliLog.h"
 #include "FJ_includes.h"
 #include "AliJetShape.h"
@@ -19,13 +23,15 @@ class AliFJWrapper
   virtual void  AddInputVector (Double_t px, Double_t py, Double_t pz, Double_t E, Int_t index = -99999);
   virtual void  AddInputVector (const fastjet::PseudoJet& vec,                Int_t index = -99999);
   virtual void  AddInputVectors(const std::vector<fastjet::PseudoJet>& vecs,  Int_t offsetIndex = -99999);
+  void          ReserveInputVectors(UInt_t n) { fInputVectors.reserve(n); }
   virtual void  AddInputGhost  (Double_t px, Double_t py, Double_t pz, Double_t E, Int_t index = -99999);
   virtual const char *ClassName()                            const { return "AliFJWrapper";              }
   virtual void  Clear(const Option_t* /*opt*/ = "");
   virtual void  ClearMemory();
   virtual void  CopySettingsFrom (const AliFJWrapper& wrapper);
   virtual void  GetMedianAndSigma(Double_t& median, Double_t& sigma, Int_t remove = 0) const;
-  fastjet::ClusterSequenceArea*           GetClusterSequence() const   { return fClustSeq;                 }
+  fastjet::ClusterSequenceArea*           GetClusterSequence() const   { return fClustSeq;                 } // NULL in ghost template mode
+  fastjet::ClusterSequenceAreaBase*       GetAreaClusterSequence() const { return fAreaSeq;              }
   fastjet::ClusterSequence*               GetClusterSequenceSA() const { return fClustSeqSA;               }
   fastjet::ClusterSequenceActiveAreaExplicitGhosts* GetClusterSequenceGhosts() const { return fClustSeqActGhosts; }
   const std::vector<fastjet::PseudoJet>&  GetInputVectors()    const { return fInputVectors;               }
@@ -37,6 +43,7 @@ class AliFJWrapper
   Double_t                                GetMedianUsedForBgSubtraction() const { return fMedUsedForBgSub; }
   const char*                             GetName()            const { return fName;                       }
   const char*                             GetTitle()           const { return fTitle;                      }
+  Double_t                                GetR()               const { return fR;                          }
   Double_t                                GetJetArea         (UInt_t idx) const;
   fastjet::PseudoJet                      GetJetAreaVector   (UInt_t idx) const;
   Double_t                                GetFilteredJetArea (UInt_t idx) const;
@@ -60,7 +67,9 @@ class AliFJWrapper
   const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJet3subjettiness_kt()       const {return fGenSubtractorInfoJet3subjettiness_kt ; }
   const std::vector<fastjet::contrib::GenericSubtractorInfo> GetGenSubtractorInfoJetOpeningAngle_kt()       const {return fGenSubtractorInfoJetOpeningAngle_kt ; }
   const std::vector<fastjet::PseudoJet>                      GetConstituentSubtrJets()            const {return fConstituentSubtrJets            ; }
+  const std::vector<fastjet::PseudoJet>&                     GetEventSubtrParticles()             const {return fEventSubtrParticles             ; }
   const std::vector<fastjet::PseudoJet>                      GetGroomedJets()            const {return fGroomedJets            ; }
+  const fastjet::PseudoJet&                                  GetCAReclusteredJet(UInt_t idx);
   Int_t CreateGenSub();          // fastjet::contrib::GenericSubtractor
   Int_t CreateConstituentSub();  // fastjet::contrib::ConstituentSubtractor
   Int_t CreateSoftDrop();
@@ -87,6 +96,7 @@ class AliFJWrapper
   virtual Int_t DoGenericSubtractionJet3subjettiness_kt();
   virtual Int_t DoGenericSubtractionJetOpeningAngle_kt();
   virtual Int_t DoConstituentSubtraction();
+  virtual Int_t DoEventConstituentSubtraction(Double_t maxDeltaR = 0.25);
   virtual Int_t DoSoftDrop();
   
   void SetName(const char* name)        { fName           = name;    }
@@ -114,6 +124,12 @@ class AliFJWrapper
   void SetRMaxAndStep(Double_t rmax, Double_t dr) {fRMax = rmax; fDRStep = dr; }
   void SetRhoRhom (Double_t rho, Double_t rhom) { fUseExternalBkg = kTRUE; fRho = rho; fRhom = rhom;} // if using rho,rhom then fUseExternalBkg is true
   void SetMinJetPt(Double_t MinPt) {fMinJetPt=MinPt;}
+  // ghost template: for active_area_explicit_ghosts with one repetition the ghosts are
+  // generated once per ghost configuration and rotated in phi by a random angle in each event
+  void SetUseGhostTemplate(Bool_t b = kTRUE)   { fUseGhostTemplate = b;     }
+  void SetGhostTemplateSeed(UInt_t seed)       { fGhostRandom.SetSeed(seed); }
+  Bool_t GetUseGhostTemplate()           const { return fUseGhostTemplate && fAreaType == fastjet::active_area_explicit_ghosts && fNGhostRepeats == 1; }
+  const std::vector<fastjet::PseudoJet>&  GetGhostTemplate()   const { return fGhostTemplate;              }
 
  protected:
   TString                                fName;               //!
@@ -177,6 +193,7 @@ class AliFJWrapper
   std::vector<fastjet::contrib::GenericSubtractorInfo> fGenSubtractorInfoJet2subjettiness_kt;       //!
   std::vector<fastjet::contrib::GenericSubtractorInfo> fGenSubtractorInfoJet3subjettiness_kt;       //!
   std::vector<fastjet::contrib::GenericSubtractorInfo> fGenSubtractorInfoJetOpeningAngle_kt;       //!
+  std::vector<fastjet::PseudoJet>          fCAJets;          //! C/A reclustering of the inclusive jets, built on demand, reset with the inclusive jets
 #endif
   Bool_t                                   fDoFilterArea;         //!
   Bool_t                                   fLegacyMode;           //!
@@ -189,8 +206,18 @@ class AliFJWrapper
   std::vector<double>                      fGRDenominator;    //!
   std::vector<double>                      fGRNumeratorSub;   //!
   std::vector<double>                      fGRDenominatorSub; //!
+  fastjet::ClusterSequenceAreaBase        *fAreaSeq;          //! cluster sequence of the last Run(), fClustSeq or fClustSeqTemplate
+  fastjet::ClusterSequenceActiveAreaExplicitGhosts *fClustSeqTemplate; //! cluster sequence with the template ghosts
+  Bool_t                                   fUseGhostTemplate; //! use the ghost template (if the area type allows it)
+  std::vector<fastjet::PseudoJet>          fGhostTemplate;    //! ghosts generated for the current configuration
+  std::vector<fastjet::PseudoJet>          fEventGhosts;      //! ghosts of the current event (rotated template)
+  Double_t                                 fGhostTemplateActualArea; //! actual area of each template ghost
+  Double_t                                 fGhostTemplateConf[5]; //! max rap, ghost area, grid, kt scatter, mean kt of the template
+  TRandom3                                 fGhostRandom;      //! per-event rotation of the template
+  std::vector<fastjet::PseudoJet>          fEventSubtrParticles; //! input vectors after the event-wide constituent subtraction
 
   virtual void   SubtractBackground(const Double_t median_pt = -1);
+  virtual void   PrepareGhostTemplate();
 
  private:
   AliFJWrapper();
@@ -263,6 +290,7 @@ AliFJWrapper::AliFJWrapper(const char *name, const char *title)
   , fGenSubtractorInfoJet2subjettiness_kt ( )
   , fGenSubtractorInfoJet3subjettiness_kt ( )
   , fGenSubtractorInfoJetOpeningAngle_kt ( )
+  , fCAJets            ( )
 #endif
   , fDoFilterArea      (false)
   , fLegacyMode        (false)
@@ -275,8 +303,17 @@ AliFJWrapper::AliFJWrapper(const char *name, const char *title)
   , fGRDenominator()
   , fGRNumeratorSub()
   , fGRDenominatorSub()
+  , fAreaSeq           (0)
+  , fClustSeqTemplate  (0)
+  , fUseGhostTemplate  (kFALSE)
+  , fGhostTemplate     ( )
+  , fEventGhosts       ( )
+  , fGhostTemplateActualArea(0)
+  , fGhostRandom       (0)
+  , fEventSubtrParticles( )
 {
   // Constructor.
+  for (Int_t i = 0; i < 5; i++) fGhostTemplateConf[i] = -1;
 }
 
 //_________________________________________________________________________________________________
@@ -299,6 +336,8 @@ void AliFJWrapper::ClearMemory()
   if (fClustSeq)          { delete fClustSeq;          fClustSeq        = NULL; }
   if (fClustSeqSA)        { delete fClustSeqSA;        fClustSeqSA        = NULL; }
   if (fClustSeqActGhosts) { delete fClustSeqActGhosts; fClustSeqActGhosts = NULL; }
+  if (fClustSeqTemplate)  { delete fClustSeqTemplate;  fClustSeqTemplate  = NULL; }
+  fAreaSeq = NULL;
   #ifdef FASTJET_VERSION
   if (fBkrdEstimator)          { delete fBkrdEstimator; fBkrdEstimator = NULL; }
   if (fGenSubtractor)          { delete fGenSubtractor; fGenSubtractor = NULL; }
@@ -333,6 +372,7 @@ void AliFJWrapper::CopySettingsFrom(const AliFJWrapper& wrapper)
   fUseExternalBkg   = wrapper.fUseExternalBkg;
   fRho              = wrapper.fRho;
   fRhom             = wrapper.fRhom;
+  fUseGhostTemplate = wrapper.fUseGhostTemplate;
 }
 
 //_________________________________________________________________________________________________
@@ -343,6 +383,10 @@ void AliFJWrapper::Clear(const Option_t */*opt*/)
   // Reset the median to zero.
 
   fInputVectors.clear();
+  fEventSubtrParticles.clear();
+#ifdef FASTJET_VERSION
+  fCAJets.clear();
+#endif
   fInputGhosts.clear();
   fMedUsedForBgSub = 0;
 
@@ -433,7 +477,7 @@ Double_t AliFJWrapper::GetJetArea(UInt_t idx) const
 
   Double_t retval = -1; // really wrong area..
   if ( idx < fInclusiveJets.size() ) {
-    retval = fClustSeq->area(fInclusiveJets[idx]);
+    retval = fAreaSeq->area(fInclusiveJets[idx]);
   } else {
     AliError(Form("[e] ::GetJetArea wrong index: %d",idx));
   }
@@ -460,7 +504,7 @@ fastjet::PseudoJet AliFJWrapper::GetJetAreaVector(UInt_t idx) const
   // Get the jet area as vector.
   fastjet::PseudoJet retval;
   if ( idx < fInclusiveJets.size() ) {
-    retval = fClustSeq->area_4vector(fInclusiveJets[idx]);
+    retval = fAreaSeq->area_4vector(fInclusiveJets[idx]);
   } else {
     AliError(Form("[e] ::GetJetArea wrong index: %d",idx));
   }
@@ -514,7 +558,7 @@ AliFJWrapper::GetJetConstituents(UInt_t idx) const
   std::vector<fastjet::PseudoJet> retval;
 
   if ( idx < fInclusiveJets.size() ) {
-    retval = fClustSeq->constituents(fInclusiveJets[idx]);
+    retval = fAreaSeq->constituents(fInclusiveJets[idx]);
   } else {
     AliError(Form("[e] ::GetJetConstituents wrong index: %d",idx));
   }
@@ -546,7 +590,7 @@ void AliFJWrapper::GetMedianAndSigma(Double_t &median, Double_t &sigma, Int_t re
   // Get the median and sigma from fastjet.
   // User can also do it on his own because the cluster sequence is exposed (via a getter)
 
-  if (!fClustSeq) {
+  if (!fAreaSeq) {
     AliError("[e] Run the jfinder first.");
     return;
   }
@@ -554,11 +598,11 @@ void AliFJWrapper::GetMedianAndSigma(Double_t &median, Double_t &sigma, Int_t re
   Double_t mean_area = 0;
   try {
     if(0 == remove) {
-      fClustSeq->get_median_rho_and_sigma(*fRange, fUseArea4Vector, median, sigma, mean_area);
+      fAreaSeq->get_median_rho_and_sigma(*fRange, fUseArea4Vector, median, sigma, mean_area);
     }  else {
-      std::vector<fastjet::PseudoJet> input_jets = sorted_by_pt(fClustSeq->inclusive_jets());
+      std::vector<fastjet::PseudoJet> input_jets = sorted_by_pt(fAreaSeq->inclusive_jets());
       input_jets.erase(input_jets.begin(), input_jets.begin() + remove);
-      fClustSeq->get_median_rho_and_sigma(input_jets, *fRange, fUseArea4Vector, median, sigma, mean_area);
+      fAreaSeq->get_median_rho_and_sigma(input_jets, *fRange, fUseArea4Vector, median, sigma, mean_area);
       input_jets.clear();
     }
   } catch (fj::Error) {
@@ -623,7 +667,14 @@ Int_t AliFJWrapper::Run()
   }
 
   try {
-    fClustSeq = new fj::ClusterSequenceArea(fInputVectors, *fJetDef, *fAreaDef);
+    if (GetUseGhostTemplate()) {
+      PrepareGhostTemplate();
+      fClustSeqTemplate = new fj::ClusterSequenceActiveAreaExplicitGhosts(fInputVectors, *fJetDef, fEventGhosts, fGhostTemplateActualArea);
+      fAreaSeq = fClustSeqTemplate;
+    } else {
+      fClustSeq = new fj::ClusterSequenceArea(fInputVectors, *fJetDef, *fAreaDef);
+      fAreaSeq = fClustSeq;
+    }
   } catch (fj::Error) {
     AliError(" [w] FJ Exception caught.");
     return -1;
@@ -638,11 +689,45 @@ Int_t AliFJWrapper::Run()
 
   // inclusive jets:
   fInclusiveJets.clear();
-  fInclusiveJets = fClustSeq->inclusive_jets(0.0);
+  fInclusiveJets = fAreaSeq->inclusive_jets(0.0);
+#ifdef FASTJET_VERSION
+  fCAJets.clear();
+#endif
 
   return 0;
 }
 
+//_________________________________________________________________________________________________
+void AliFJWrapper::PrepareGhostTemplate()
+{
+  // Generate the ghosts if the ghost configuration changed, then
+  // rotate them by a random angle in phi for the current event.
+  // The rotation keeps the ghost density uniform and only needs
+  // one cos/sin per event; the storage of the ghosts is reused.
+
+  Double_t conf[5] = {fMaxRap, fGhostArea, fGridScatter, fKtScatter, fMeanGhostKt};
+  Bool_t changed = fGhostTemplate.empty();
+  for (Int_t i = 0; i < 5; i++) {
+    if (conf[i] != fGhostTemplateConf[i]) changed = kTRUE;
+  }
+  if (changed) {
+    fj::GhostedAreaSpec spec(fMaxRap, 1, fGhostArea, fGridScatter, fKtScatter, fMeanGhostKt);
+    fGhostTemplate.clear();
+    spec.add_ghosts(fGhostTemplate);
+    fGhostTemplateActualArea = spec.actual_ghost_area();
+    for (Int_t i = 0; i < 5; i++) fGhostTemplateConf[i] = conf[i];
+  }
+
+  Double_t dphi = fGhostRandom.Uniform(TMath::TwoPi());
+  Double_t c = TMath::Cos(dphi);
+  Double_t s = TMath::Sin(dphi);
+  fEventGhosts.resize(fGhostTemplate.size());
+  for (UInt_t i = 0; i < fGhostTemplate.size(); i++) {
+    const fj::PseudoJet& g = fGhostTemplate[i];
+    fEventGhosts[i].reset(g.px()*c - g.py()*s, g.px()*s + g.py()*c, g.pz(), g.E());
+  }
+}
+
 //_________________________________________________________________________________________________
 Int_t AliFJWrapper::Filter()
 {
@@ -716,7 +801,7 @@ void AliFJWrapper::SubtractBackground(Double_t median_pt)
   // check what was specified (default is -1)
   if (median_pt < 0) {
     try {
-      fClustSeq->get_median_rho_and_sigma(*fRange, fUseArea4Vector, median, sigma, mean_area);
+      fAreaSeq->get_median_rho_and_sigma(*fRange, fUseArea4Vector, median, sigma, mean_area);
     }
 
     catch (fj::Error) {
@@ -742,13 +827,13 @@ void AliFJWrapper::SubtractBackground(Double_t median_pt)
   for (unsigned i = 0; i < fInclusiveJets.size(); i++) {
     if ( fUseArea4Vector ) {
       // subtract the background using the area4vector
-      fj::PseudoJet area4v = fClustSeq->area_4vector(fInclusiveJets[i]);
+      fj::PseudoJet area4v = fAreaSeq->area_4vector(fInclusiveJets[i]);
       fj::PseudoJet jet_sub = fInclusiveJets[i] - area4v * fMedUsedForBgSub;
       fSubtractedJetsPt.push_back(jet_sub.perp()); // here we put only the pt of the jet - note: this can be negative
     } else {
       // subtract the background using scalars
       // fj::PseudoJet jet_sub = fInclusiveJets[i] - area * fMedUsedForBgSub_;
-      Double_t area = fClustSeq->area(fInclusiveJets[i]);
+      Double_t area = fAreaSeq->area(fInclusiveJets[i]);
       // standard subtraction
       Double_t pt_sub = fInclusiveJets[i].perp() - fMedUsedForBgSub * area;
       fSubtractedJetsPt.push_back(pt_sub); // here we put only the pt of the jet - note: this can be negative
@@ -1042,6 +1127,132 @@ Int_t AliFJWrapper::DoConstituentSubtraction() {
   return 0;
 }
 
+//_________________________________________________________________________________________________
+Int_t AliFJWrapper::DoEventConstituentSubtraction(Double_t maxDeltaR) {
+  // Constituent subtraction for the whole event, instead of one call of the
+  // contrib subtractor per jet: the ghosts of a grid over |y| < fMaxRap carry
+  // pT = rho*A and m_delta = rhom*A; all ghost-particle pairs with
+  // DeltaR < maxDeltaR are found once with a (y,phi) cell index of size maxDeltaR,
+  // sorted by DeltaR and matched in this order as in the contrib algorithm
+  // (alpha = 0). The subtracted particles do not depend on the jet definition;
+  // the subtracted jet of each inclusive jet is made of the subtracted
+  // versions of its constituents, ghosts are not kept.
+#ifdef FASTJET_VERSION
+  fEventSubtrParticles.clear();
+  fConstituentSubtrJets.clear();
+
+  // the event-wide subtraction uses rho, rhom of the event (e.g. from AliAnalysisTaskRho)
+  if (!fUseExternalBkg) {
+    AliError("The event-wide constituent subtraction needs an external background (SetUseExternalBkg)");
+    return -1;
+  }
+  const Double_t rho = fRho, rhom = fRhom;
+  if (maxDeltaR <= 0) {
+    AliError(Form("Max DeltaR %f not allowed for the event-wide constituent subtraction", maxDeltaR));
+    return -1;
+  }
+
+  // grid of ghosts
+  const Double_t ghostSize = TMath::Sqrt(fGhostArea);
+  const Int_t nGhostRap = TMath::Max(1, TMath::Nint(2*fMaxRap/ghostSize));
+  const Int_t nGhostPhi = TMath::Max(1, TMath::Nint(TMath::TwoPi()/ghostSize));
+  const Double_t dGhostRap = 2*fMaxRap/nGhostRap;
+  const Double_t dGhostPhi = TMath::TwoPi()/nGhostPhi;
+  const Int_t nGhosts = nGhostRap*nGhostPhi;
+  std::vector<double> ghostPt(nGhosts, rho*dGhostRap*dGhostPhi);
+  std::vector<double> ghostMDelta(nGhosts, rhom*dGhostRap*dGhostPhi);
+
+  // particles: pT, m_delta = mT - pT, and (y,phi) cell index
+  const Int_t nPart = fInputVectors.size();
+  std::vector<double> partPt(nPart), partMDelta(nPart);
+  const Double_t cellRapMin = -fMaxRap - maxDeltaR;
+  const Int_t nCellRap = TMath::CeilNint(2*(fMaxRap + maxDeltaR)/maxDeltaR);
+  const Int_t nCellPhi = TMath::Max(1, Int_t(TMath::TwoPi()/maxDeltaR));  // cells at least maxDeltaR wide
+  const Double_t dCellPhi = TMath::TwoPi()/nCellPhi;
+  std::vector< std::vector<int> > cells(nCellRap*nCellPhi);
+  for (Int_t i = 0; i < nPart; i++) {
+    const fj::PseudoJet &p = fInputVectors[i];
+    partPt[i] = p.perp();
+    partMDelta[i] = p.mt() - p.perp();
+    Int_t iRap = Int_t((p.rap() - cellRapMin)/maxDeltaR);
+    if (iRap < 0 || iRap >= nCellRap) continue; // too far from all ghosts
+    Int_t iPhi = TMath::Min(nCellPhi-1, Int_t(p.phi()/dCellPhi));
+    cells[iRap*nCellPhi+iPhi].push_back(i);
+  }
+
+  // ghost-particle pairs in the 3x3 neighbouring cells of each ghost
+  std::vector< std::pair<double, std::pair<int,int> > > pairs;
+  pairs.reserve(nGhosts*16);
+  const Double_t maxDeltaR2 = maxDeltaR*maxDeltaR;
+  for (Int_t ig = 0; ig < nGhosts; ig++) {
+    const Double_t gRap = -fMaxRap + (ig/nGhostPhi + 0.5)*dGhostRap;
+    const Double_t gPhi = (ig%nGhostPhi + 0.5)*dGhostPhi;
+    const Int_t iRap = Int_t((gRap - cellRapMin)/maxDeltaR);
+    const Int_t iPhi = TMath::Min(nCellPhi-1, Int_t(gPhi/dCellPhi));
+    for (Int_t jRap = TMath::Max(0, iRap-1); jRap <= TMath::Min(nCellRap-1, iRap+1); jRap++) {
+      for (Int_t k = -1; k <= 1; k++) {
+        if (nCellPhi < 3 && k != 0) continue; // cells already cover all phi
+        const Int_t jPhi = (iPhi + k + nCellPhi) % nCellPhi;
+        const std::vector<int> &cell = cells[jRap*nCellPhi+jPhi];
+        for (UInt_t c = 0; c < cell.size(); c++) {
+          const fj::PseudoJet &p = fInputVectors[cell[c]];
+          Double_t dPhi = TMath::Abs(p.phi() - gPhi);
+          if (dPhi > TMath::Pi()) dPhi = TMath::TwoPi() - dPhi;
+          const Double_t dRap = p.rap() - gRap;
+          const Double_t dR2 = dRap*dRap + dPhi*dPhi;
+          if (dR2 < maxDeltaR2) pairs.push_back(std::make_pair(dR2, std::make_pair(cell[c], ig)));
+        }
+      }
+    }
+  }
+  std::sort(pairs.begin(), pairs.end());
+
+  // iterative matching, closest pairs first
+  for (UInt_t ip = 0; ip < pairs.size(); ip++) {
+    const Int_t i = pairs[ip].second.first;
+    const Int_t ig = pairs[ip].second.second;
+    if (partPt[i] > 0 && ghostPt[ig] > 0) {
+      if (partPt[i] >= ghostPt[ig]) { partPt[i] -= ghostPt[ig]; ghostPt[ig] = 0; }
+      else                          { ghostPt[ig] -= partPt[i]; partPt[i] = 0; }
+    }
+    if (partMDelta[i] > 0 && ghostMDelta[ig] > 0) {
+      if (partMDelta[i] >= ghostMDelta[ig]) { partMDelta[i] -= ghostMDelta[ig]; ghostMDelta[ig] = 0; }
+      else                                  { ghostMDelta[ig] -= partMDelta[i]; partMDelta[i] = 0; }
+    }
+  }
+
+  // subtracted particles, same rapidity, phi and user index
+  std::map<int, int> userIndexToInput;
+  fEventSubtrParticles.resize(nPart);
+  for (Int_t i = 0; i < nPart; i++) {
+    const fj::PseudoJet &p = fInputVectors[i];
+    const Double_t mt = partPt[i] + partMDelta[i];
+    const Double_t m = TMath::Sqrt(TMath::Max(0., mt*mt - partPt[i]*partPt[i]));
+    fj::PseudoJet sub(0., 0., 0., 0.);
+    if (partPt[i] > 0) sub.reset_PtYPhiM(partPt[i], p.rap(), p.phi(), m);
+    sub.set_user_index(p.user_index());
+    fEventSubtrParticles[i] = sub;
+    userIndexToInput[p.user_index()] = i;
+  }
+
+  // subtracted jets from the subtracted constituents
+  for (UInt_t ij = 0; ij < fInclusiveJets.size(); ij++) {
+    std::vector<fj::PseudoJet> constituents;
+    if (fInclusiveJets[ij].perp() > 0.) {
+      std::vector<fj::PseudoJet> unsub(fInclusiveJets[ij].constituents());
+      for (UInt_t ic = 0; ic < unsub.size(); ic++) {
+        if (unsub[ic].perp() < 1.e-10) continue; // ghost of the area
+        std::map<int, int>::const_iterator it = userIndexToInput.find(unsub[ic].user_index());
+        if (it == userIndexToInput.end()) continue;
+        if (fEventSubtrParticles[it->second].perp() > 0) constituents.push_back(fEventSubtrParticles[it->second]);
+      }
+    }
+    fConstituentSubtrJets.push_back(constituents.empty() ? fj::PseudoJet(0.,0.,0.,0.) : fj::join(constituents));
+  }
+#endif
+  return 0;
+}
+
 //_________________________________________________________________________________________________
 Int_t AliFJWrapper::DoSoftDrop() {
   //Do grooming
@@ -1054,10 +1265,14 @@ Int_t AliFJWrapper::DoSoftDrop() {
   //fSoftDrop->set_subtractor(&fjsub);
   //fSoftDrop->set_input_jet_is_subtracted(false); //??
   
+  // the jets are declustered from the cached C/A reclustering, shared with the other users of GetCAReclusteredJet()
+  fSoftDrop->set_reclustering(false);
   for (unsigned i = 0; i < fInclusiveJets.size(); i++) {
     fj::PseudoJet groomed_jet(0.,0.,0.,0.);
     if(fInclusiveJets[i].perp()>0.){
-      groomed_jet = (*fSoftDrop)(fInclusiveJets[i]);
+      const fj::PseudoJet &caJet = GetCAReclusteredJet(i);
+      if (!caJet.has_associated_cluster_sequence()) continue;
+      groomed_jet = (*fSoftDrop)(caJet);
       groomed_jet.set_user_index(i); //index of the corresponding inclusve jet
       if(groomed_jet!=0) fGroomedJets.push_back(groomed_jet);
     }
@@ -1069,6 +1284,38 @@ Int_t AliFJWrapper::DoSoftDrop() {
   return 0;
 }
 
+#ifdef FASTJET_VERSION
+//_________________________________________________________________________________________________
+const fastjet::PseudoJet& AliFJWrapper::GetCAReclusteredJet(UInt_t idx) {
+  // Inclusive jet idx reclustered with Cambridge/Aachen and R = max allowable R,
+  // as done by the contrib groomers: all constituents (ghosts included) end up
+  // in one jet whose history is the C/A declustering tree. It is built at the
+  // first request in the event and kept until the next Run() or Clear(), so the
+  // groomers and shape calculators of the same jet share one reclustering.
+  // A jet without cluster sequence is returned if the reclustering fails.
+  static const fj::PseudoJet kNoJet;
+  if (idx >= fInclusiveJets.size()) return kNoJet;
+  if (fCAJets.size() != fInclusiveJets.size()) fCAJets.assign(fInclusiveJets.size(), fj::PseudoJet());
+  if (!fCAJets[idx].has_associated_cluster_sequence()) {
+    try {
+      fj::JetDefinition caDef(fj::cambridge_algorithm, fj::JetDefinition::max_allowable_R);
+      fj::ClusterSequence *cs = new fj::ClusterSequence(fInclusiveJets[idx].constituents(), caDef);
+      std::vector<fj::PseudoJet> caJets = cs->inclusive_jets(0.);
+      if (caJets.empty()) {
+        delete cs;
+        return kNoJet;
+      }
+      fCAJets[idx] = caJets[0];
+      cs->delete_self_when_unused();
+    } catch (fj::Error) {
+      AliError(" [w] FJ Exception caught.");
+      return kNoJet;
+    }
+  }
+  return fCAJets[idx];
+}
+#endif
+
 //_________________________________________________________________________________________________
 Int_t AliFJWrapper::CreateSoftDrop() {
   //Do grooming
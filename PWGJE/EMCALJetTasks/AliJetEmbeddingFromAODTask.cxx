@@ -81,10 +81,15 @@ AliJetEmbeddingFromAODTask::AliJetEmbeddingFromAODTask() :
   fTotalFiles(2050),
   fAttempts(5),
   fEmbedCentrality(kFALSE),
+  fReadOnlyEmbeddedBranches(kTRUE),
+  fAODTreeCacheSize(-1),
+  fAsyncOpenNextFile(kTRUE),
   fEsdTreeMode(kFALSE),
   fCurrentFileID(0),
   fCurrentAODFileID(0),
   fCurrentAODFile(0),
+  fNextAODFileHandle(0),
+  fNextAODFileID(-1),
   fPicoTrackVersion(0),
   fCurrentAODTree(0),
   fAODHeader(0),
@@ -154,10 +159,15 @@ AliJetEmbeddingFromAODTask::AliJetEmbeddingFromAODTask(const char *name, Bool_t
   fTotalFiles(2050),
   fAttempts(5),
   fEmbedCentrality(kFALSE),
+  fReadOnlyEmbeddedBranches(kTRUE),
+  fAODTreeCacheSize(-1),
+  fAsyncOpenNextFile(kTRUE),
   fEsdTreeMode(kFALSE),
   fCurrentFileID(0),
   fCurrentAODFileID(0),
   fCurrentAODFile(0),
+  fNextAODFileHandle(0),
+  fNextAODFileID(-1),
   fPicoTrackVersion(0),
   fCurrentAODTree(0),
   fAODHeader(0),
@@ -198,6 +208,11 @@ AliJetEmbeddingFromAODTask::~AliJetEmbeddingFromAODTask()
     fCurrentAODFile->Close();
     delete fCurrentAODFile;
   }
+
+  if (fNextAODFileHandle) {
+    TFile *next = TFile::Open(fNextAODFileHandle);
+    delete next;
+  }
 }
 
 //________________________________________________________________________
@@ -302,6 +317,27 @@ Bool_t AliJetEmbeddingFromAODTask::OpenNextFile()
     return kFALSE;
   }
 
+  ReadPicoTrackVersion();
+
+  fCurrentAODTree = static_cast<TTree*>(fCurrentAODFile->Get(fAODTreeName));
+  if (!fCurrentAODTree) {
+    AliError(Form("Could not get tree %s from file %s", fAODTreeName.Data(), fCurrentAODFile->GetName()));
+    return kFALSE;
+  }
+
+  InitCurrentAODTree();
+
+  if (fAsyncOpenNextFile && !fRandomAccess)
+    AsyncOpenNextFile();
+  
+  return kTRUE;
+}
+
+//________________________________________________________________________
+void AliJetEmbeddingFromAODTask::ReadPicoTrackVersion()
+{
+  // Version of the AliPicoTrack class in fCurrentAODFile
+
   const TList *clist = fCurrentAODFile->GetStreamerInfoCache();
   if(clist) {
     TStreamerInfo *cinfo = static_cast<TStreamerInfo*>(clist->FindObject("AliPicoTrack"));
@@ -310,12 +346,12 @@ Bool_t AliJetEmbeddingFromAODTask::OpenNextFile()
     else
       fPicoTrackVersion = 0;
   }
+}
 
-  fCurrentAODTree = static_cast<TTree*>(fCurrentAODFile->Get(fAODTreeName));
-  if (!fCurrentAODTree) {
-    AliError(Form("Could not get tree %s from file %s", fAODTreeName.Data(), fCurrentAODFile->GetName()));
-    return kFALSE;
-  }
+//________________________________________________________________________
+void AliJetEmbeddingFromAODTask::InitCurrentAODTree()
+{
+  // Connect the branches of fCurrentAODTree and set the entry range
 
   if (!fAODHeaderName.IsNull()) 
     fCurrentAODTree->SetBranchAddress(fAODHeaderName, &fAODHeader);
@@ -334,6 +370,8 @@ Bool_t AliJetEmbeddingFromAODTask::OpenNextFile()
   
   if (!fAODMCParticlesName.IsNull()) 
     fCurrentAODTree->SetBranchAddress(fAODMCParticlesName, &fAODMCParticles);
+
+  SetupAODTreeReading();
   
   if (fRandomAccess) {
     fFirstAODEntry = TMath::Nint(gRandom->Rndm()*fCurrentAODTree->GetEntries())-1;
@@ -351,8 +389,56 @@ Bool_t AliJetEmbeddingFromAODTask::OpenNextFile()
     fHistFileMatching->Fill(fCurrentFileID, fCurrentAODFileID-1);
 
   fEmbeddingCount = 0;
-  
-  return kTRUE;
+}
+
+//________________________________________________________________________
+void AliJetEmbeddingFromAODTask::SetupAODTreeReading()
+{
+  // Read only the branches which are embedded or used in the event selection,
+  // and fill the tree cache with them.
+
+  const TString *names[6] = {&fAODHeaderName, &fAODVertexName, &fAODTrackName,
+                             &fAODClusName, &fAODCellsName, &fAODMCParticlesName};
+
+  if (fReadOnlyEmbeddedBranches) {
+    fCurrentAODTree->SetBranchStatus("*", 0);
+    for (Int_t i = 0; i < 6; i++) {
+      if (names[i]->IsNull()) continue;
+      UInt_t found = 0; // no error printed for the sub-branches of a non split branch
+      fCurrentAODTree->SetBranchStatus(names[i]->Data(), 1, &found);
+      fCurrentAODTree->SetBranchStatus(Form("%s.*", names[i]->Data()), 1, &found);
+    }
+  }
+
+  if (fAODTreeCacheSize >= 0) {
+    fCurrentAODTree->SetCacheSize(fAODTreeCacheSize);
+    if (fAODTreeCacheSize > 0) {
+      for (Int_t i = 0; i < 6; i++) {
+        if (names[i]->IsNull()) continue;
+        fCurrentAODTree->AddBranchToCache(names[i]->Data(), kTRUE);
+      }
+      fCurrentAODTree->StopCacheLearningPhase();
+    }
+  }
+}
+
+//________________________________________________________________________
+void AliJetEmbeddingFromAODTask::AsyncOpenNextFile()
+{
+  // Start opening the file that GetNextFile() will return next (sequential access),
+  // so that the connection to the storage is ready at the file switch.
+
+  if (fNextAODFileHandle) return;
+
+  Int_t nextID = fCurrentAODFileID + 1;
+  if (nextID >= fFileList->GetEntriesFast()) return;
+
+  TString fileName(static_cast<TObjString*>(fFileList->At(nextID))->GetString());
+  if (fileName.BeginsWith("alien://") && !gGrid) return;
+
+  AliDebug(3,Form("Opening file %s in the background...", fileName.Data()));
+  fNextAODFileHandle = TFile::AsyncOpen(fileName);
+  fNextAODFileID = nextID;
 }
 
 //________________________________________________________________________
@@ -387,8 +473,20 @@ TFile* AliJetEmbeddingFromAODTask::GetNextFile()
     return 0;
   }
 
-  AliDebug(3,Form("Trying to open file %s...", fileName.Data()));
-  TFile *file = TFile::Open(fileName);
+  TFile *file = 0;
+  if (fNextAODFileHandle) {
+    file = TFile::Open(fNextAODFileHandle);
+    fNextAODFileHandle = 0;
+    if (fNextAODFileID != fCurrentAODFileID) { // not the expected file
+      delete file;
+      file = 0;
+    }
+  }
+
+  if (!file) {
+    AliDebug(3,Form("Trying to open file %s...", fileName.Data()));
+    file = TFile::Open(fileName);
+  }
 
   if (!file || file->IsZombie()) {
     AliError(Form("Unable to open file: %s!", fileName.Data()));
@@ -9,6 +9,7 @@
 // $Id$
 
 class TFile;
+class TFileOpenHandle;
 class TObjArray;
 class TClonesArray;
 class TString;
@@ -59,6 +60,9 @@ class AliJetEmbeddingFromAODTask : public AliJetModelBaseTask {
   void           SetMaxVertexDist(Double_t d)                      { fMaxVertexDist      = d     ; }
   void           SetParticlePtRange(Double_t min, Double_t max, Byte_t t=1) { fParticleMinPt = min; fParticleMaxPt = max; fParticleSelection = t; }
   void           SetEmbedCentrality(Bool_t d)                      { fEmbedCentrality    = d     ; }
+  void           SetReadOnlyEmbeddedBranches(Bool_t b=kTRUE)       { fReadOnlyEmbeddedBranches = b ; }
+  void           SetAODTreeCacheSize(Int_t s)                      { fAODTreeCacheSize   = s     ; }
+  void           SetAsyncOpenNextFile(Bool_t b=kTRUE)              { fAsyncOpenNextFile  = b     ; }
 
  protected:
   Bool_t          ExecOnce()            ;// intialize task
@@ -69,6 +73,10 @@ class AliJetEmbeddingFromAODTask : public AliJetModelBaseTask {
   virtual Bool_t  IsAODEventSelected()  ;// AOD event trigger/centrality selection
   TLorentzVector  GetLeadingJet(TClonesArray *tracks, TClonesArray *clusters=0);  // get the leading jet
   Bool_t          FindParticleInRange(TClonesArray *array);// Find particle in array within range (fParticleMinPt, fParticleMaxPt)
+  void            ReadPicoTrackVersion();// AliPicoTrack version of fCurrentAODFile
+  void            InitCurrentAODTree()  ;// connect the branches of fCurrentAODTree
+  void            SetupAODTreeReading() ;// branch status and cache of fCurrentAODTree
+  void            AsyncOpenNextFile()   ;// start opening the file following fCurrentAODFileID
 
   TObjArray     *fFileList            ;//  List of AOD files 
   Bool_t         fRandomAccess        ;//  Random access to file number and event
@@ -106,10 +114,15 @@ class AliJetEmbeddingFromAODTask : public AliJetModelBaseTask {
   Int_t          fTotalFiles          ;//  Total number of files per pt hard bin
   Int_t          fAttempts            ;//  Attempts to be tried before giving up in opening the next file
   Bool_t         fEmbedCentrality     ;//  If true, embed centrality (only works when running on AOD) - carefull: it overwrites the event centrality (if any) 
+  Bool_t         fReadOnlyEmbeddedBranches;// Read only the branches set with SetAOD*Name()
+  Int_t          fAODTreeCacheSize    ;//  Size of the TTreeCache of the embedded tree, <0 = ROOT default
+  Bool_t         fAsyncOpenNextFile   ;//  Open the next file of the list in the background (sequential access only)
   Bool_t         fEsdTreeMode         ;//! True = embed from ESD (must be a skimmed ESD!)
   Int_t          fCurrentFileID       ;//! Current file being processed (via the event handler)
   Int_t          fCurrentAODFileID    ;//! Current file ID
   TFile         *fCurrentAODFile      ;//! Current open file
+  TFileOpenHandle *fNextAODFileHandle ;//! Handle of the file being opened in the background
+  Int_t          fNextAODFileID       ;//! File ID of fNextAODFileHandle
   Int_t          fPicoTrackVersion    ;//! Version of the PicoTrack class (if any) in fCurrentAODFile
   TTree         *fCurrentAODTree      ;//! Current open tree
   AliVHeader    *fAODHeader           ;//! AOD header
@@ -133,6 +146,6 @@ class AliJetEmbeddingFromAODTask : public AliJetModelBaseTask {
   AliJetEmbeddingFromAODTask(const AliJetEmbeddingFromAODTask&);            // not implemented
   AliJetEmbeddingFromAODTask &operator=(const AliJetEmbeddingFromAODTask&); // not implemented
 
-  ClassDef(AliJetEmbeddingFromAODTask, 13) // Jet embedding from AOD task
+  ClassDef(AliJetEmbeddingFromAODTask, 14) // Jet embedding from AOD task
 };
 #endif
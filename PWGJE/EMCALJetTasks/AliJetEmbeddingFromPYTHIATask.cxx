@@ -7,6 +7,9 @@
 #include "AliJetEmbeddingFromPYTHIATask.h"
 
 #include <TFile.h>
+#include <TTree.h>
+#include <TClonesArray.h>
+#include <TProfile.h>
 #include <TMath.h>
 #include <TString.h>
 #include <TRandom.h>
@@ -31,6 +34,7 @@ AliJetEmbeddingFromPYTHIATask::AliJetEmbeddingFromPYTHIATask() :
   fFileTable(0),
   fUseAsVetoTable(kTRUE),
   fMinEntriesPerPtHardBin(1),
+  fPYTHIAPoolPath(),
   fCurrentPtHardBin(-1),
   fPtHardBinParam(0),
   fPtHardBinCount(0),
@@ -53,6 +57,7 @@ AliJetEmbeddingFromPYTHIATask::AliJetEmbeddingFromPYTHIATask(const char *name, B
   fFileTable(0),
   fUseAsVetoTable(kTRUE),
   fMinEntriesPerPtHardBin(1),
+  fPYTHIAPoolPath(),
   fCurrentPtHardBin(-1),
   fPtHardBinParam(0),
   fPtHardBinCount(0),
@@ -108,6 +113,13 @@ void AliJetEmbeddingFromPYTHIATask::UserCreateOutputObjects()
 //________________________________________________________________________
 Bool_t AliJetEmbeddingFromPYTHIATask::ExecOnce() 
 {
+  if (!fPYTHIAPoolPath.IsNull()) {
+    // the pool is read with random access, the same trees are used many times
+    fRandomAccess = kTRUE;
+    if (fPtHardBinScaling.GetSize() == 0)
+      LoadPoolPtHardBinScaling();
+  }
+
   if (fPtHardBinScaling.GetSize() > 0) {
     Double_t sum = 0;
     for (Int_t i = 0; i < fPtHardBinScaling.GetSize(); i++) 
@@ -259,3 +271,99 @@ TFile* AliJetEmbeddingFromPYTHIATask::GetNextFile()
 
   return file;
 }
+
+//________________________________________________________________________
+Bool_t AliJetEmbeddingFromPYTHIATask::OpenPool()
+{
+  // Open the pool file, it stays open for the whole job
+
+  if (fCurrentAODFile)
+    return kTRUE;
+
+  if (fPYTHIAPoolPath.BeginsWith("alien://") && !gGrid) {
+    AliInfo("Trying to connect to AliEn ...");
+    TGrid::Connect("alien://");
+  }
+
+  AliDebug(3,Form("Trying to open pool %s...", fPYTHIAPoolPath.Data()));
+  fCurrentAODFile = TFile::Open(fPYTHIAPoolPath);
+
+  if (!fCurrentAODFile || fCurrentAODFile->IsZombie()) {
+    AliError(Form("Unable to open pool: %s!", fPYTHIAPoolPath.Data()));
+    delete fCurrentAODFile;
+    fCurrentAODFile = 0;
+    return kFALSE;
+  }
+
+  ReadPicoTrackVersion();
+
+  return kTRUE;
+}
+
+//________________________________________________________________________
+void AliJetEmbeddingFromPYTHIATask::LoadPoolPtHardBinScaling()
+{
+  // Probability of each pt hard bin proportional to xsection*events/trials,
+  // from the weights stored in the pool
+
+  if (!OpenPool())
+    return;
+
+  TProfile *histXsection = dynamic_cast<TProfile*>(fCurrentAODFile->Get("fHistXsection"));
+  TH1 *histTrials = dynamic_cast<TH1*>(fCurrentAODFile->Get("fHistTrials"));
+  TH1 *histEvents = dynamic_cast<TH1*>(fCurrentAODFile->Get("fHistEvents"));
+  if (!histXsection || !histTrials || !histEvents) {
+    AliWarning(Form("No pt hard bin weights in the pool %s!", fPYTHIAPoolPath.Data()));
+    return;
+  }
+
+  const Int_t nPtHard = histEvents->GetNbinsX();
+  fPtHardBinScaling.Set(nPtHard);
+  for (Int_t i = 0; i < nPtHard; i++) {
+    Double_t trials = histTrials->GetBinContent(i+1);
+    fPtHardBinScaling[i] = trials > 0 ? histXsection->GetBinContent(i+1) * histEvents->GetBinContent(i+1) / trials : 0;
+  }
+  AliInfo(Form("Pt hard bin scaling taken from the pool %s.", fPYTHIAPoolPath.Data()));
+}
+
+//________________________________________________________________________
+Bool_t AliJetEmbeddingFromPYTHIATask::OpenNextFile()
+{
+  // Without pool, open the next PYTHIA file. With the pool, switch to the tree of the pt hard bin:
+  // the pool is opened once and the entries are taken with random access.
+
+  if (fPYTHIAPoolPath.IsNull())
+    return AliJetEmbeddingFromAODTask::OpenNextFile();
+
+  if (!OpenPool())
+    return kFALSE;
+
+  if (fMinEntriesPerPtHardBin < 0) {
+    fCurrentPtHardBin = GetRandomPtHardBin();
+    fPtHardBinParam->SetVal(fCurrentPtHardBin);
+  }
+  fCurrentAODFileID = fCurrentPtHardBin;
+
+  if (fCurrentAODTree) {
+    // the objects read by the previous tree are deleted with it
+    delete fCurrentAODTree;
+    fCurrentAODTree = 0;
+    fAODHeader = 0;
+    fAODVertex = 0;
+    fAODTracks = 0;
+    fAODClusters = 0;
+    fAODCaloCells = 0;
+    fAODMCParticles = 0;
+  }
+
+  TString treeName(GetPoolTreeName(fAODTreeName, fCurrentPtHardBin));
+  fCurrentAODTree = static_cast<TTree*>(fCurrentAODFile->Get(treeName));
+  if (!fCurrentAODTree || fCurrentAODTree->GetEntries() == 0) {
+    AliError(Form("Could not get tree %s from pool %s", treeName.Data(), fPYTHIAPoolPath.Data()));
+    return kFALSE;
+  }
+
+  InitCurrentAODTree();
+
+  return kTRUE;
+}
@@ -32,12 +32,18 @@ class AliJetEmbeddingFromPYTHIATask : public AliJetEmbeddingFromAODTask {
   void           SetFileTable(THashTable *t)                       { fFileTable                                 = t ; }
   void           SetUseAsVetoTable(Bool_t v)                       { fUseAsVetoTable                            = v ; }
   void           SetMinEntriesPerPtHardBin(Int_t r)                { fMinEntriesPerPtHardBin                    = r ; }
+  void           SetPYTHIAPoolPath(const char* p)                  { fPYTHIAPoolPath                            = p ; }
+
+  static TString GetPoolTreeName(const char *treeName, Int_t ptHardBin) { return TString::Format("%s_PtHard%d", treeName, ptHardBin); }
 
  protected:
   Bool_t           ExecOnce()               ;// intialize task
   Bool_t           GetNextEntry()           ;// get next entry in current tree
   Int_t            GetRandomPtHardBin()     ;// get a radnom pt hard bin according to fPtHardBinScaling
   TFile           *GetNextFile()            ;// get next file
+  Bool_t           OpenNextFile()           ;// open next file, or next tree of the pool
+  Bool_t           OpenPool()               ;// open the pool file
+  void             LoadPoolPtHardBinScaling();// pt hard bin scaling from the weights of the pool
 
   TString          fPYTHIAPath              ;// Path of the PYTHIA production
   TArrayD          fPtHardBinScaling        ;// Pt hard bin scaling
@@ -46,6 +52,7 @@ class AliJetEmbeddingFromPYTHIATask : public AliJetEmbeddingFromAODTask {
   THashTable      *fFileTable               ;// Table of allowed/vetoed files
   Bool_t           fUseAsVetoTable          ;// Use fFileTable as a veto table
   Int_t            fMinEntriesPerPtHardBin  ;// Minimum number of embedded events before changing pt hard bin, if < 0 change pt hard bin only when reach eof 
+  TString          fPYTHIAPoolPath          ;// Path of the embedding pool (see macros/MakePYTHIAEmbeddingPool.C), if set fPYTHIAPath is not used
   Int_t            fCurrentPtHardBin        ;//!Pt hard bin of the current open file
   TParameter<int> *fPtHardBinParam          ;//!Pt hard bin param
   Int_t            fPtHardBinCount          ;//!Number of event embedded from the current pt hard bin
@@ -56,6 +63,6 @@ class AliJetEmbeddingFromPYTHIATask : public AliJetEmbeddingFromAODTask {
   AliJetEmbeddingFromPYTHIATask(const AliJetEmbeddingFromPYTHIATask&);            // not implemented
   AliJetEmbeddingFromPYTHIATask &operator=(const AliJetEmbeddingFromPYTHIATask&); // not implemented
 
-  ClassDef(AliJetEmbeddingFromPYTHIATask, 4) // Jet embedding from PYTHIA task
+  ClassDef(AliJetEmbeddingFromPYTHIATask, 5) // Jet embedding from PYTHIA task
 };
 #endif
@@ -119,6 +119,8 @@ void AliJetFastSimulation::ExecOnce()
 
   if(!fRandom) fRandom = new TRandom3(0);
 
+  FillMomentumResolutionTables();
+
   if (!fTracksOutName.IsNull()) {
     fTracksOut = new TClonesArray("AliPicoTrack");
     fTracksOut->SetName(fTracksOutName);
@@ -298,12 +300,10 @@ Double_t AliJetFastSimulation::GetMomentumSmearing(Int_t cat, Double_t pt) {
   // Get smearing on generated momentum
   //
 
-  TProfile *fMomRes = 0x0;
-  if(cat==1 && fMomResH1) fMomRes = (TProfile*)fMomResH1->Clone("fMomRes");
-  if(cat==2 && fMomResH2) fMomRes = (TProfile*)fMomResH2->Clone("fMomRes");
-  if(cat==3 && fMomResH3) fMomRes = (TProfile*)fMomResH3->Clone("fMomRes");
-
-  if(!fMomRes)
+  if(cat<1 || cat>3)
+    return 0.;
+  const std::vector<Double_t> &table = fMomResTable[cat-1];
+  if(table.empty())
     return 0.;
 
   Double_t smear = 0.;
@@ -313,15 +313,33 @@ Double_t AliJetFastSimulation::GetMomentumSmearing(Int_t cat, Double_t pt) {
     if(cat==3 && fMomResH3Fit) smear = fMomResH3Fit->Eval(pt);
   }
   else {
-    Int_t bin = fMomRes->FindBin(pt);
-    smear = fRandom->Gaus(fMomRes->GetBinContent(bin),fMomRes->GetBinError(bin));
+    const TProfile *momRes = cat==1 ? fMomResH1 : (cat==2 ? fMomResH2 : fMomResH3);
+    Int_t bin = momRes->GetXaxis()->FindFixBin(pt);
+    smear = fRandom->Gaus(table[2*bin],table[2*bin+1]);
   }
-  
-  if(fMomRes) delete fMomRes;
 
   return smear;
 }
 
+//________________________________________________________________________
+void AliJetFastSimulation::FillMomentumResolutionTables() {
+  //
+  // Keep the content and the error of each bin of the momentum resolution
+  // profiles, read per track in GetMomentumSmearing
+  //
+  const TProfile *momRes[3] = {fMomResH1, fMomResH2, fMomResH3};
+  for(Int_t i = 0; i<3; i++) {
+    fMomResTable[i].clear();
+    if(!momRes[i]) continue;
+    const Int_t nBins = momRes[i]->GetNbinsX()+2;
+    fMomResTable[i].resize(2*nBins);
+    for(Int_t bin = 0; bin<nBins; bin++) {
+      fMomResTable[i][2*bin]   = momRes[i]->GetBinContent(bin);
+      fMomResTable[i][2*bin+1] = momRes[i]->GetBinError(bin);
+    }
+  }
+}
+
 //________________________________________________________________________
 void AliJetFastSimulation::LoadTrPtResolutionRootFileFromOADB() {
 
@@ -8,6 +8,8 @@ class TRandom3;
 class AliVParticle;
 class AliPicoTrack;
 
+#include <vector>
+
 #include "AliAnalysisTaskEmcal.h"
 
 class AliJetFastSimulation : public AliAnalysisTaskEmcal {
@@ -38,6 +40,7 @@ class AliJetFastSimulation : public AliAnalysisTaskEmcal {
   AliPicoTrack          *SmearPt(AliPicoTrack *vp, Double_t eff[3], Double_t rnd);
   Double_t               GetMomentumSmearing(Int_t cat, Double_t pt);
   void                   FitMomentumResolution();
+  void                   FillMomentumResolutionTables();
   void                   LoadTrEfficiencyRootFileFromOADB();
   void                   LoadTrPtResolutionRootFileFromOADB();
   void                   SetMomentumResolutionHybrid(TProfile *p1, TProfile *p2, TProfile *p3);
@@ -54,6 +57,7 @@ class AliJetFastSimulation : public AliAnalysisTaskEmcal {
   TF1      *fMomResH1Fit;                      // fit to momentum resolution
   TF1      *fMomResH2Fit;                      // fit to momentum resolution
   TF1      *fMomResH3Fit;                      // fit to momentum resolution
+  std::vector<Double_t> fMomResTable[3];        //! content and error of each bin of the momentum resolution profiles
   TH1      *fhEffH1;                           // Efficiency for Spectra Hybrid Category 1
   TH1      *fhEffH2;                           // Efficiency for Spectra Hybrid Category 2
   TH1      *fhEffH3;                           // Efficiency for Spectra Hybrid Category 3
@@ -0,0 +1,62 @@
+// $Id$
+//
+// Input of the JETAN jet finders from the particle containers of the EMCal framework.
+//   Replaces AliJetFillCalTrkTrack in AliJetReader (AliJetReader::SetFillEventTracks), the
+//   AliJetCalTrkEvent is filled with references to the accepted particles of the containers,
+//   the selection of the containers is used instead of the cuts of the reader header and the
+//   particles are neither copied nor selected a second time. The detector option of the reader
+//   header has to include the tracks.
+
+#include <TMath.h>
+
+#include "AliVEvent.h"
+#include "AliVParticle.h"
+#include "AliLog.h"
+#include "AliParticleContainer.h"
+#include "AliJetCalTrk.h"
+
+#include "AliJetFillCalTrkContainer.h"
+
+ClassImp(AliJetFillCalTrkContainer)
+
+//________________________________________________________________________
+AliJetFillCalTrkContainer::AliJetFillCalTrkContainer() :
+  AliJetFillCalTrkEvent(),
+  fParticleContainers(),
+  fVEvt(0)
+{
+  // Constructor.
+}
+
+//________________________________________________________________________
+AliJetFillCalTrkContainer::~AliJetFillCalTrkContainer()
+{
+  // Destructor, the containers belong to the caller.
+}
+
+//________________________________________________________________________
+void AliJetFillCalTrkContainer::Exec(const Option_t * /*option*/)
+{
+  // Add the accepted particles of all containers to the CalTrk event.
+
+  if (!fCalTrkEvent) {
+    AliError("No CalTrk event");
+    return;
+  }
+
+  for (Int_t i = 0; i < fParticleContainers.GetEntriesFast(); i++) {
+    AliParticleContainer *cont = static_cast<AliParticleContainer*>(fParticleContainers.At(i));
+    if (fVEvt) cont->SetArray(fVEvt);
+    cont->NextEvent();
+    if (!cont->GetArray()) continue;
+
+    cont->ResetCurrentID();
+    AliVParticle *part = cont->GetNextAcceptParticle();
+    while (part) {
+      // same signal flag as AliJetFillCalTrkTrack
+      Bool_t signal = TMath::Abs(part->GetLabel()) < 10000;
+      fCalTrkEvent->AddCalTrkTrack(part, kTRUE, signal);
+      part = cont->GetNextAcceptParticle();
+    }
+  }
+}
@@ -0,0 +1,35 @@
+#ifndef ALIJETFILLCALTRKCONTAINER_H
+#define ALIJETFILLCALTRKCONTAINER_H
+
+// $Id$
+
+class AliVEvent;
+class AliParticleContainer;
+
+#include <TObjArray.h>
+
+#include "AliJetFillCalTrkEvent.h"
+
+class AliJetFillCalTrkContainer : public AliJetFillCalTrkEvent
+{
+ public:
+  AliJetFillCalTrkContainer();
+  virtual ~AliJetFillCalTrkContainer();
+
+  void                  AddParticleContainer(AliParticleContainer *cont)    { fParticleContainers.Add((TObject*)cont); }
+  void                  SetVEvent(AliVEvent *evt)                           { fVEvt = evt; }
+  void                  Exec(const Option_t *option);
+
+  Int_t                 GetNParticleContainers()                 const      { return fParticleContainers.GetEntriesFast(); }
+
+ protected:
+  TObjArray             fParticleContainers;  // Particle containers, not owned
+  AliVEvent            *fVEvt;                // Input event
+
+ private:
+  AliJetFillCalTrkContainer(const AliJetFillCalTrkContainer&);            // not implemented
+  AliJetFillCalTrkContainer &operator=(const AliJetFillCalTrkContainer&); // not implemented
+
+  ClassDef(AliJetFillCalTrkContainer, 1) // Fill the AliJetCalTrkEvent of the JETAN finders from EMCal framework containers
+};
+#endif
@@ -19,8 +19,12 @@
 
 #include "AliJetResponseMaker.h"
 
+#include <algorithm>
+
 #include <TClonesArray.h>
 #include <TH2F.h>
+#include <TH2D.h>
+#include <TH1D.h>
 #include <THnSparse.h>
 
 #include "AliTLorentzVector.h"
@@ -56,8 +60,19 @@ AliJetResponseMaker::AliJetResponseMaker() :
   fDBCAxis(0),
   fFlavourZAxis(0),
   fFlavourPtAxis(0),
+  fUseJetGrid(kFALSE),
+  fResponseObservables(),
+  fResponseTemplates(),
   fIsJet1Rho(kFALSE),
   fIsJet2Rho(kFALSE),
+  fJetGrid(),
+  fJetCandidates(),
+  fMatchedJets(),
+  fHistResponse(),
+  fHistResponse1(),
+  fHistResponse2(),
+  fHistUnmatched1(),
+  fHistUnmatched2(),
   fHistRejectionReason1(0),
   fHistRejectionReason2(0),
   fHistJets1(0),
@@ -121,6 +136,8 @@ AliJetResponseMaker::AliJetResponseMaker() :
 {
   // Default constructor.
 
+  fResponseTemplates.SetOwner(kTRUE);
+
   SetMakeGeneralHistograms(kTRUE);
 }
 
@@ -143,8 +160,19 @@ AliJetResponseMaker::AliJetResponseMaker(const char *name) :
   fDBCAxis(0),
   fFlavourZAxis(0),
   fFlavourPtAxis(0),
+  fUseJetGrid(kFALSE),
+  fResponseObservables(),
+  fResponseTemplates(),
   fIsJet1Rho(kFALSE),
   fIsJet2Rho(kFALSE),
+  fJetGrid(),
+  fJetCandidates(),
+  fMatchedJets(),
+  fHistResponse(),
+  fHistResponse1(),
+  fHistResponse2(),
+  fHistUnmatched1(),
+  fHistUnmatched2(),
   fHistRejectionReason1(0),
   fHistRejectionReason2(0),
   fHistJets1(0),
@@ -209,6 +237,7 @@ AliJetResponseMaker::AliJetResponseMaker(const char *name) :
   // Standard constructor.
 
   SetMakeGeneralHistograms(kTRUE);
+  fResponseTemplates.SetOwner(kTRUE);
 }
 
 //________________________________________________________________________
@@ -995,9 +1024,11 @@ void AliJetResponseMaker::UserCreateOutputObjects()
 
   if (fHistoType==0)
     AllocateTH2();
-  else 
+  else if (fHistoType==1)
     AllocateTHnSparse();
 
+  AllocateResponses();
+
   PostData(1, fOutput); // Post data for ALL output slots > 0 here, to get at least an empty histogram
 }
 
@@ -1374,8 +1405,35 @@ void AliJetResponseMaker::DoJetLoop()
   AliEmcalJet* jet1 = 0;
   AliEmcalJet* jet2 = 0;
 
+  Bool_t useGrid = fUseJetGrid && fMatching == kGeometrical;
+  if (useGrid) fJetGrid.Reset();
+
   jets2->ResetCurrentID();
-  while ((jet2 = jets2->GetNextJet())) jet2->ResetMatching();
+  while ((jet2 = jets2->GetNextJet())) {
+    jet2->ResetMatching();
+    if (useGrid) fJetGrid.AddJet(jet2, jets2->GetCurrentID());
+  }
+
+  if (useGrid) {
+    // Only pairs closer than the larger matching parameter can end up matched,
+    // so it is enough to visit the jets 2 in the grid cells around each jet 1.
+    // The candidates come in collection order, hence the closest jets are the same as in the full loop.
+    fJetGrid.Build();
+    Double_t maxDist = TMath::Max(fMatchingPar1, fMatchingPar2);
+
+    jets1->ResetCurrentID();
+    while ((jet1 = jets1->GetNextJet())) {
+      jet1->ResetMatching();
+
+      if (jet1->MCPt() < fMinJetMCPt) continue;
+
+      fJetGrid.FindCandidates(jet1->Eta(), jet1->Phi(), maxDist, fJetCandidates);
+      for (UInt_t i = 0; i < fJetCandidates.size(); i++) {
+        SetMatchingLevel(jet1, fJetGrid.GetJet(fJetCandidates[i]), fMatching);
+      }
+    }
+    return;
+  }
 
   jets1->ResetCurrentID();
   while ((jet1 = jets1->GetNextJet())) {
@@ -1864,9 +1922,13 @@ Bool_t AliJetResponseMaker::FillHistograms()
 
   if (!jets1 || !jets1->GetArray() || !jets2 || !jets2->GetArray()) return kFALSE;
 
+  const Bool_t fillHistos = (fHistoType == 0 || fHistoType == 1);
+
   AliEmcalJet* jet1 = 0;  
   AliEmcalJet* jet2 = 0;
 
+  fMatchedJets.Clear();
+
   jets2->ResetCurrentID();
   while ((jet2 = jets2->GetNextJet())) {
 
@@ -1875,17 +1937,28 @@ Bool_t AliJetResponseMaker::FillHistograms()
     if (jet2->Pt() < jets2->GetJetPtCut()) continue;
 
     UInt_t rejectionReason = 0;
-    if (jets2->AcceptJet(jet2, rejectionReason))
-      FillJetHisto(jet2, 2);
-    else
+    Bool_t accepted2 = jets2->AcceptJet(jet2, rejectionReason);
+    if (accepted2) {
+      if (fillHistos) FillJetHisto(jet2, 2);
+    }
+    else {
       fHistRejectionReason2->Fill(jets2->GetRejectionReasonBitPosition(rejectionReason), jet2->Pt());
+    }
 
     jet1 = jet2->MatchedJet();
 
-    if (!jet1) continue;
-    rejectionReason = 0;
-    if (!jets1->AcceptJet(jet1, rejectionReason)) continue;
-    if (jet1->MCPt() < fMinJetMCPt) continue;
+    if (jet1) {
+      rejectionReason = 0;
+      if (!jets1->AcceptJet(jet1, rejectionReason) || jet1->MCPt() < fMinJetMCPt) jet1 = 0;
+    }
+
+    if (!jet1) {
+      if (accepted2) {
+        for (Int_t i = 0; i < kNResponseObservables; i++)
+          fMatchedJets.fUnmatched2[i].push_back(GetResponseObservable(jet2, jets2, i));
+      }
+      continue;
+    }
 
     Double_t d=-1, ce1=-1, ce2=-1;
     if (jet2->GetMatchingType() == kGeometrical) {
@@ -1903,9 +1976,25 @@ Bool_t AliJetResponseMaker::FillHistograms()
       ce2 = jet2->ClosestJetDistance();
     }
 
-    FillMatchingHistos(jet1, jet2, d, ce1, ce2);
+    if (fillHistos) FillMatchingHistos(jet1, jet2, d, ce1, ce2);
+
+    if (!accepted2) continue; // jet 1 counted as unmatched below
+
+    fMatchedJets.fJet1.push_back(jet1);
+    fMatchedJets.fJet2.push_back(jet2);
+    fMatchedJets.fDistance.push_back(d);
+    fMatchedJets.fCommonEnergy1.push_back(ce1);
+    fMatchedJets.fCommonEnergy2.push_back(ce2);
+    for (Int_t i = 0; i < kNResponseObservables; i++) {
+      fMatchedJets.fObservable1[i].push_back(GetResponseObservable(jet1, jets1, i));
+      fMatchedJets.fObservable2[i].push_back(GetResponseObservable(jet2, jets2, i));
+    }
   }
 
+  // jets 1 of the matched pairs, sorted for the search below
+  std::vector<AliEmcalJet*> matched1(fMatchedJets.fJet1);
+  std::sort(matched1.begin(), matched1.end());
+
   jets1->ResetCurrentID();
   while ((jet1 = jets1->GetNextJet())) {
     UInt_t rejectionReason = 0;
@@ -1916,7 +2005,160 @@ Bool_t AliJetResponseMaker::FillHistograms()
     if (jet1->MCPt() < fMinJetMCPt) continue;
     AliDebug(2,Form("Processing jet (1) %d", jets1->GetCurrentID()));
 
-    FillJetHisto(jet1, 1);
+    if (fillHistos) FillJetHisto(jet1, 1);
+
+    if (!std::binary_search(matched1.begin(), matched1.end(), jet1)) {
+      for (Int_t i = 0; i < kNResponseObservables; i++)
+        fMatchedJets.fUnmatched1[i].push_back(GetResponseObservable(jet1, jets1, i));
+    }
   }
+
+  FillResponses();
+
   return kTRUE;
 }
+
+//________________________________________________________________________
+void AliJetResponseMaker::MatchedJetTable::Clear()
+{
+  // Clear the table, keep the allocated memory for the next event.
+
+  fJet1.clear();
+  fJet2.clear();
+  fDistance.clear();
+  fCommonEnergy1.clear();
+  fCommonEnergy2.clear();
+  fObservable1.resize(kNResponseObservables);
+  fObservable2.resize(kNResponseObservables);
+  fUnmatched1.resize(kNResponseObservables);
+  fUnmatched2.resize(kNResponseObservables);
+  for (Int_t i = 0; i < kNResponseObservables; i++) {
+    fObservable1[i].clear();
+    fObservable2[i].clear();
+    fUnmatched1[i].clear();
+    fUnmatched2[i].clear();
+  }
+}
+
+//________________________________________________________________________
+Int_t AliJetResponseMaker::AddResponse(const char *name, EResponseObservable_t obs, Int_t nbins1, Double_t min1, Double_t max1, Int_t nbins2, Double_t min2, Double_t max2)
+{
+  // Add a response of the observable obs with fixed bins, x = jet 1, y = jet 2.
+  // Return the index of the response.
+
+  TH2D *h = new TH2D(name, name, nbins1, min1, max1, nbins2, min2, max2);
+  h->SetDirectory(0);
+  fResponseTemplates.Add(h);
+  fResponseObservables.push_back(obs);
+
+  return fResponseObservables.size() - 1;
+}
+
+//________________________________________________________________________
+Int_t AliJetResponseMaker::AddResponse(const char *name, EResponseObservable_t obs, Int_t nbins1, const Double_t *bins1, Int_t nbins2, const Double_t *bins2)
+{
+  // Add a response of the observable obs with variable bins, x = jet 1, y = jet 2.
+  // Return the index of the response.
+
+  TH2D *h = new TH2D(name, name, nbins1, bins1, nbins2, bins2);
+  h->SetDirectory(0);
+  fResponseTemplates.Add(h);
+  fResponseObservables.push_back(obs);
+
+  return fResponseObservables.size() - 1;
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::AllocateResponses()
+{
+  // Create the responses added with AddResponse. For each response <name>: the response
+  // <name> (x = jet 1, y = jet 2) and the projections <name>Jets1 (all accepted jets 1),
+  // <name>Jets2 (all accepted jets 2), <name>Unmatched1 and <name>Unmatched2, as needed by
+  // RooUnfoldResponse(measured, truth, response) and its Fake() and Miss().
+
+  const char *obsTitle[kNResponseObservables] = {"#it{p}_{T}", "#it{p}_{T}^{corr}", "#it{M}", "NEF", "#it{z}_{g}", "#it{R}_{g}"};
+
+  for (Int_t i = 0; i < fResponseTemplates.GetEntriesFast(); i++) {
+    TH2 *tmpl = static_cast<TH2*>(fResponseTemplates.At(i));
+    TString name(tmpl->GetName());
+    TString title(obsTitle[fResponseObservables[i]]);
+
+    TH2 *response = static_cast<TH2*>(tmpl->Clone(name));
+    response->SetTitle(name);
+    response->GetXaxis()->SetTitle(title + " (1)");
+    response->GetYaxis()->SetTitle(title + " (2)");
+    response->GetZaxis()->SetTitle("counts");
+    response->Sumw2();
+    fOutput->Add(response);
+    fHistResponse.push_back(response);
+
+    TH1 *h1 = tmpl->ProjectionX(name + "Jets1");
+    h1->Reset();
+    h1->SetTitle(name + "Jets1");
+    h1->GetXaxis()->SetTitle(title + " (1)");
+    fOutput->Add(h1);
+    fHistResponse1.push_back(h1);
+
+    TH1 *h2 = tmpl->ProjectionY(name + "Jets2");
+    h2->Reset();
+    h2->SetTitle(name + "Jets2");
+    h2->GetXaxis()->SetTitle(title + " (2)");
+    fOutput->Add(h2);
+    fHistResponse2.push_back(h2);
+
+    TH1 *u1 = static_cast<TH1*>(h1->Clone(name + "Unmatched1"));
+    u1->SetTitle(name + "Unmatched1");
+    fOutput->Add(u1);
+    fHistUnmatched1.push_back(u1);
+
+    TH1 *u2 = static_cast<TH1*>(h2->Clone(name + "Unmatched2"));
+    u2->SetTitle(name + "Unmatched2");
+    fOutput->Add(u2);
+    fHistUnmatched2.push_back(u2);
+  }
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::FillResponses()
+{
+  // Fill all responses from the jet table of the event.
+
+  for (UInt_t i = 0; i < fHistResponse.size(); i++) {
+    const Int_t obs = fResponseObservables[i];
+    const std::vector<Double_t> &obs1 = fMatchedJets.fObservable1[obs];
+    const std::vector<Double_t> &obs2 = fMatchedJets.fObservable2[obs];
+    for (UInt_t j = 0; j < obs1.size(); j++) {
+      fHistResponse[i]->Fill(obs1[j], obs2[j]);
+      fHistResponse1[i]->Fill(obs1[j]);
+      fHistResponse2[i]->Fill(obs2[j]);
+    }
+    const std::vector<Double_t> &unmatched1 = fMatchedJets.fUnmatched1[obs];
+    for (UInt_t j = 0; j < unmatched1.size(); j++) {
+      fHistResponse1[i]->Fill(unmatched1[j]);
+      fHistUnmatched1[i]->Fill(unmatched1[j]);
+    }
+    const std::vector<Double_t> &unmatched2 = fMatchedJets.fUnmatched2[obs];
+    for (UInt_t j = 0; j < unmatched2.size(); j++) {
+      fHistResponse2[i]->Fill(unmatched2[j]);
+      fHistUnmatched2[i]->Fill(unmatched2[j]);
+    }
+  }
+}
+
+//________________________________________________________________________
+Double_t AliJetResponseMaker::GetResponseObservable(AliEmcalJet* jet, AliJetContainer* jets, Int_t obs) const
+{
+  // Observable obs of the jet (EResponseObservable_t).
+
+  const AliEmcalJetShapeProperties *shape = static_cast<const AliEmcalJet*>(jet)->GetShapeProperties();
+
+  switch (obs) {
+  case kResponsePt:     return jet->Pt();
+  case kResponseCorrPt: return jet->Pt() - jets->GetRhoVal() * jet->Area();
+  case kResponseMass:   return jet->M();
+  case kResponseNEF:    return jet->NEF();
+  case kResponseZg:     return shape ? shape->GetSoftDropZg() : -1;
+  case kResponseRg:     return shape ? shape->GetSoftDropdR() : -1;
+  default:              return -1;
+  }
+}
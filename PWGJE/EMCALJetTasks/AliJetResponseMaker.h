@@ -20,11 +20,17 @@
 //-----------------------------------------------------------------------
 
 class TClonesArray;
+class TH1;
 class TH2;
 class THnSparse;
 class AliNamedArrayI;
 
+#include <vector>
+
+#include <TObjArray.h>
+
 #include "AliEmcalJet.h"
+#include "AliEmcalJetGrid.h"
 #include "AliAnalysisTaskEmcalJet.h"
 
 class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
@@ -40,6 +46,35 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
     kSameCollections = 3
   };
 
+  enum EResponseObservable_t {
+    kResponsePt     = 0,   // jet pt
+    kResponseCorrPt = 1,   // jet pt - rho * area
+    kResponseMass   = 2,   // jet mass
+    kResponseNEF    = 3,   // neutral energy fraction
+    kResponseZg     = 4,   // SoftDrop zg
+    kResponseRg     = 5,   // SoftDrop deltaR
+    kNResponseObservables
+  };
+
+  // Jets of one event for the response objects, one entry per jet or pair (structure of arrays).
+  // Filled once per event in FillHistograms(), the tasks after the response maker can read it with GetMatchedJets().
+  struct MatchedJetTable {
+    std::vector<AliEmcalJet*>              fJet1;          // jet 1 of each matched pair
+    std::vector<AliEmcalJet*>              fJet2;          // jet 2 of each matched pair
+    std::vector<Double_t>                  fDistance;      // distance of each matched pair
+    std::vector<Double_t>                  fCommonEnergy1; // common energy 1 of each matched pair
+    std::vector<Double_t>                  fCommonEnergy2; // common energy 2 of each matched pair
+    std::vector< std::vector<Double_t> >   fObservable1;   // [observable][pair] jet 1 observables
+    std::vector< std::vector<Double_t> >   fObservable2;   // [observable][pair] jet 2 observables
+    std::vector< std::vector<Double_t> >   fUnmatched1;    // [observable][jet] accepted jets 1 without accepted match
+    std::vector< std::vector<Double_t> >   fUnmatched2;    // [observable][jet] accepted jets 2 without accepted match
+
+    UInt_t GetNPairs()                                                const { return fJet1.size()               ; }
+    UInt_t GetNUnmatched1()                                           const { return fUnmatched1.empty() ? 0 : fUnmatched1[0].size(); }
+    UInt_t GetNUnmatched2()                                           const { return fUnmatched2.empty() ? 0 : fUnmatched2[0].size(); }
+    void   Clear();
+  };
+
   void                        UserCreateOutputObjects();
 
   void                        SetMatching(MatchingType t, Double_t p1=1, Double_t p2=1)       { fMatching = t; fMatchingPar1 = p1; fMatchingPar2 = p2; }
@@ -57,6 +92,11 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   void                        SetdRAxis(Int_t b)                                              { fdRAxis            = b         ; }
   void                        SetPtgAxis(Int_t b)                                             { fPtgAxis           = b         ; }
   void                        SetDBCAxis(Int_t b)                                             { fDBCAxis           = b         ; }
+  void                        SetUseJetGrid(Bool_t b=kTRUE)                                   { fUseJetGrid        = b         ; }
+  Int_t                       AddResponse(const char *name, EResponseObservable_t obs, Int_t nbins1, Double_t min1, Double_t max1, Int_t nbins2, Double_t min2, Double_t max2);
+  Int_t                       AddResponse(const char *name, EResponseObservable_t obs, Int_t nbins1, const Double_t *bins1, Int_t nbins2, const Double_t *bins2);
+
+  const MatchedJetTable&      GetMatchedJets()                                          const { return fMatchedJets                  ; }
 
  protected:
   void                        ExecOnce();
@@ -72,13 +112,16 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   void                        FillJetHisto(AliEmcalJet* jet, Int_t Set);
   void                        AllocateTH2();
   void                        AllocateTHnSparse();
+  void                        AllocateResponses();
+  void                        FillResponses();
+  Double_t                    GetResponseObservable(AliEmcalJet* jet, AliJetContainer* jets, Int_t obs) const;
 
   MatchingType                fMatching;                               // matching type
   Double_t                    fMatchingPar1;                           // matching parameter for jet1-jet2 matching
   Double_t                    fMatchingPar2;                           // matching parameter for jet2-jet1 matching
   Bool_t                      fUseCellsToMatch;                        // use cells instead of clusters to match jets (slower but sometimes needed)
   Double_t                    fMinJetMCPt;                             // minimum jet MC pt
-  Int_t                       fHistoType;                              // histogram type (0=TH2, 1=THnSparse)
+  Int_t                       fHistoType;                              // histogram type (0=TH2, 1=THnSparse, 2=only the responses of AddResponse)
   Int_t                       fDeltaPtAxis;                            // add delta pt axis in THnSparse (default=0)
   Int_t                       fDeltaEtaDeltaPhiAxis;                   // add delta eta and delta phi axes in THnSparse (default=0)
   Int_t                       fNEFAxis;                                // add NEF axis in matching THnSparse (default=0)
@@ -90,9 +133,20 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   Int_t                       fdRAxis;                                 // add dR axis in matching THnSparse (default=0)
   Int_t                       fPtgAxis;                                // add Ptg axis in matching THnSparse (default=0)
   Int_t                       fDBCAxis;                                // add DBC (number of soft dropped branches) axis in matching THnSparse (default=0)
+  Bool_t                      fUseJetGrid;                             // use an (eta,phi) grid of jets 2 for the geometrical matching
+  std::vector<Int_t>          fResponseObservables;                    // observable of each response (EResponseObservable_t)
+  TObjArray                   fResponseTemplates;                      // binning of each response (TH2D, x = jet 1, y = jet 2)
 
   Bool_t                      fIsJet1Rho;                              //!whether the jet1 collection has to be average subtracted
   Bool_t                      fIsJet2Rho;                              //!whether the jet2 collection has to be average subtracted
+  AliEmcalJetGrid             fJetGrid;                                //!(eta,phi) grid of jets 2
+  std::vector<Int_t>          fJetCandidates;                          //!candidates for the matching of one jet 1
+  MatchedJetTable             fMatchedJets;                            //!jets and matched pairs of the event
+  std::vector<TH2*>           fHistResponse;                           //!response of each AddResponse (x = jet 1, y = jet 2)
+  std::vector<TH1*>           fHistResponse1;                          //!all accepted jets 1 of each response (measured)
+  std::vector<TH1*>           fHistResponse2;                          //!all accepted jets 2 of each response (truth)
+  std::vector<TH1*>           fHistUnmatched1;                         //!accepted jets 1 without match of each response (fakes)
+  std::vector<TH1*>           fHistUnmatched2;                         //!accepted jets 2 without match of each response (misses)
 
   TH2                        *fHistRejectionReason1;                   //!Rejection reason vs. jet pt
   TH2                        *fHistRejectionReason2;                   //!Rejection reason vs. jet pt
@@ -170,6 +224,6 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   AliJetResponseMaker(const AliJetResponseMaker&);            // not implemented
   AliJetResponseMaker &operator=(const AliJetResponseMaker&); // not implemented
 
-  ClassDef(AliJetResponseMaker, 28) // Jet response matrix producing task
+  ClassDef(AliJetResponseMaker, 30) // Jet response matrix producing task
 };
 #endif
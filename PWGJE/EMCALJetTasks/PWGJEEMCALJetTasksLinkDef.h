@@ -6,6 +6,7 @@
 
 #pragma link C++ class AliAnalysisTaskRhoBase+;
 #pragma link C++ class AliAnalysisTaskRho+;
+#pragma link C++ class AliAnalysisTaskRhoCombined+;
 #pragma link C++ class AliAnalysisTaskRhoFlow+;
 #pragma link C++ class AliAnalysisTaskRhoAverage+;
 #pragma link C++ class AliAnalysisTaskRhoMass+;
@@ -202,6 +203,7 @@
 #pragma link C++ class AliEmcalJetUtilitySoftDrop+;
 #pragma link C++ class AliEmcalJetTask+;
 #pragma link C++ class AliEmcalJetFinder+;
+#pragma link C++ class AliJetFillCalTrkContainer+;
 #pragma link C++ class AliJetEmbeddingFromAODTask+;
 #pragma link C++ class AliJetEmbeddingFromPYTHIATask+;
 #pragma link C++ class AliAnalysisTaskFullpAJets+;
@@ -39,7 +39,9 @@ AliAnalysisTaskEmcalJetTagger::AliAnalysisTaskEmcalJetTagger() :
   fh2PtJet1VsPtJet2(0),
   fh2PtJet2VsRelPt(0),
   fh3PtJetDEtaDPhiConst(0),
-  fh3PtJetAreaDRConst(0)
+  fh3PtJetAreaDRConst(0),
+  fJetGrid1(),
+  fJetGrid2()
 {
   // Default constructor.
 
@@ -86,7 +88,9 @@ AliAnalysisTaskEmcalJetTagger::AliAnalysisTaskEmcalJetTagger(const char *name) :
   fh2PtJet1VsPtJet2(0),
   fh2PtJet2VsRelPt(0),
   fh3PtJetDEtaDPhiConst(0),
-  fh3PtJetAreaDRConst(0)
+  fh3PtJetAreaDRConst(0),
+  fJetGrid1(),
+  fJetGrid2()
 {
   // Standard constructor.
 
@@ -372,11 +376,10 @@ void AliAnalysisTaskEmcalJetTagger::MatchJetsGeo(Int_t c1, Int_t c2,
   faMatchIndex2.Set(nJets1+1);
   faMatchIndex2.Reset(-1);
 
-  static TArrayS iFlag(nJets1*nJets2);
-  if(iFlag.GetSize()<(nJets1*nJets2)){
-    iFlag.Set(nJets1*nJets2+1);
-  }
-  iFlag.Reset(0);
+  // (eta,phi) grids of the accepted jets: only the jets in the cells around
+  // a jet are compared, instead of all jets of the other container
+  fJetGrid1.Fill(GetJetContainer(c1), kTRUE);
+  fJetGrid2.Fill(GetJetContainer(c2), kTRUE);
 
   //AliJetContainer *cont1 = GetJetContainer(c1);
   //AliJetContainer *cont2 = GetJetContainer(c2);
@@ -401,21 +404,11 @@ void AliAnalysisTaskEmcalJetTagger::MatchJetsGeo(Int_t c1, Int_t c2,
     AliEmcalJet *jet1 = static_cast<AliEmcalJet*>(GetAcceptJetFromArray(i, c1));
     if(!jet1) continue;
 
-    Float_t dist = maxDist;
-    
-    for(int j = 0;j <nJets2; j++){
-      AliEmcalJet *jet2 = static_cast<AliEmcalJet*>(GetAcceptJetFromArray(j, c2));
-      if(!jet2) continue;
-
-      Double_t dR = jet1->DeltaR(jet2);
-      if(dR<dist && dR<maxDist){
-	faMatchIndex2[i]=j;
-	dist = dR;
-      }
-    }//j jet loop
-    if(faMatchIndex2[i]>=0) {
-      iFlag[i*nJets2+faMatchIndex2[i]]+=1;//j closest to i
-      if(iDebug>10) Printf("Full Distance (%d)--(%d) %3.3f flag[%d] = %d",i,faMatchIndex2[i],dist,i*nJets2+faMatchIndex2[i],iFlag[i*nJets2+faMatchIndex2[i]]);
+    Double_t dist = maxDist;
+    Int_t entry = fJetGrid2.FindClosest(jet1, maxDist, dist);
+    if(entry>=0) {
+      faMatchIndex2[i]=fJetGrid2.GetJetIndex(entry);//j closest to i
+      if(iDebug>10) Printf("Full Distance (%d)--(%d) %3.3f",i,faMatchIndex2[i],dist);
     }
   }//i jet loop
 
@@ -425,47 +418,35 @@ void AliAnalysisTaskEmcalJetTagger::MatchJetsGeo(Int_t c1, Int_t c2,
     if(!jet2)
       continue;
 
-    Float_t dist = maxDist;
-    for(int i = 0;i<nJets1;i++){
-      AliEmcalJet *jet1 = static_cast<AliEmcalJet*>(GetAcceptJetFromArray(i, c1));
-      if(!jet1)	continue;
-
-      Double_t dR = jet1->DeltaR(jet2);
-      if(dR<dist && dR<maxDist){
-	faMatchIndex1[j]=i;
-        dist = dR;
-      }   
-    }
-    if(faMatchIndex1[j]>=0) {
-      iFlag[faMatchIndex1[j]*nJets2+j]+=2;//i closest to j
-      if(iDebug>10) Printf("Other way Distance (%d)--(%d) %3.3f flag[%d] = %d",faMatchIndex1[j],j,dist,faMatchIndex1[j]*nJets2+j,iFlag[faMatchIndex1[j]*nJets2+j]);
+    Double_t dist = maxDist;
+    Int_t entry = fJetGrid1.FindClosest(jet2, maxDist, dist);
+    if(entry>=0) {
+      faMatchIndex1[j]=fJetGrid1.GetJetIndex(entry);//i closest to j
+      if(iDebug>10) Printf("Other way Distance (%d)--(%d) %3.3f",faMatchIndex1[j],j,dist);
     }
   }
     
   // check for "true" correlations
   for(int i = 0;i<nJets1;i++){
+    Int_t j = faMatchIndex2[i];
+    if(j<0 || faMatchIndex1[j]!=i) continue;
+
+    // we have a uniqe correlation
     AliEmcalJet *jet1 = static_cast<AliEmcalJet*>(GetJetFromArray(i, c1));
-    for(int j = 0;j<nJets2;j++){
-      AliEmcalJet *jet2 = static_cast<AliEmcalJet*>(GetJetFromArray(j, c2));
-      AliDebug(11,Form("%s: Flag[%d][%d] %d ",GetName(),i,j,iFlag[i*nJets2+j]));
-      
-      // we have a uniqe correlation
-      if(iFlag[i*nJets2+j]==3) {
-        Double_t dR = jet1->DeltaR(jet2);
-	if(iDebug>1) Printf("closest jets %d  %d  dR =  %f",j,i,dR);
-	
-	if(fJetTaggingType==kTag) {
-	  jet1->SetTaggedJet(jet2);
-	  jet1->SetTagStatus(1);
-	  
-	  jet2->SetTaggedJet(jet1);
-	  jet2->SetTagStatus(1);
-	}
-	else if(fJetTaggingType==kClosest) {
-	  jet1->SetClosestJet(jet2,dR);
-	  jet2->SetClosestJet(jet1,dR);
-	}
-      }
+    AliEmcalJet *jet2 = static_cast<AliEmcalJet*>(GetJetFromArray(j, c2));
+    Double_t dR = jet1->DeltaR(jet2);
+    if(iDebug>1) Printf("closest jets %d  %d  dR =  %f",j,i,dR);
+
+    if(fJetTaggingType==kTag) {
+      jet1->SetTaggedJet(jet2);
+      jet1->SetTagStatus(1);
+
+      jet2->SetTaggedJet(jet1);
+      jet2->SetTagStatus(1);
+    }
+    else if(fJetTaggingType==kClosest) {
+      jet1->SetClosestJet(jet2,dR);
+      jet2->SetClosestJet(jet1,dR);
     }
   }
   fMatchingDone = kTRUE;
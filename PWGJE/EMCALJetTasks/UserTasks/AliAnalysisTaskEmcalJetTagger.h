@@ -7,6 +7,7 @@ class TH3;
 class AliJetContainer;
 
 #include "AliAnalysisTaskEmcalJet.h"
+#include "AliEmcalJetGrid.h"
 
 class AliAnalysisTaskEmcalJetTagger : public AliAnalysisTaskEmcalJet {
  public:
@@ -76,6 +77,8 @@ class AliAnalysisTaskEmcalJetTagger : public AliAnalysisTaskEmcalJet {
   TH3F             *fh3PtJetDEtaDPhiConst;        //!pt jet vs delta eta vs delta phi of constituents
   TH3F             *fh3PtJetAreaDRConst;          //!pt jet vs Area vs delta R of constituents
   TH1              *fNAccJets;                    //! number of jets per event
+  AliEmcalJetGrid   fJetGrid1;                    //! (eta,phi) grid of the base jets
+  AliEmcalJetGrid   fJetGrid2;                    //! (eta,phi) grid of the tag jets
   AliAnalysisTaskEmcalJetTagger(const AliAnalysisTaskEmcalJetTagger&);            // not implemented
   AliAnalysisTaskEmcalJetTagger &operator=(const AliAnalysisTaskEmcalJetTagger&); // not implemented
 
@@ -149,10 +149,16 @@ AliJetFlowTools::AliJetFlowTools() :
     fSubdueError        (kTRUE),
     fUnfoldedSpectrumIn (0x0),
     fUnfoldedSpectrumOut(0x0),
-    fHarmonic(2) { // class constructor
+    fHarmonic(2),
+    fCacheResponse(kTRUE) { // class constructor
 #ifdef ALIJETFLOWTOOLS_DEBUG_FLAG
     printf("__FILE__ = %s \n __LINE __ %i , __FUNC__ %s \n ", __FILE__, __LINE__, __func__);
 #endif
+        for(Int_t i(0); i < 2; i++) {
+            fCachedDpt[i] = 0x0;
+            fCachedDetector[i] = 0x0;
+            fCachedResponse[i] = 0x0;
+        }
         fResponseMaker->SetRMMergeWeightFunction(new TF1("weightFunction", "x*TMath::Power(1.+(1./(8.*0.9))*x, -8.)", 0, 200));
         for(Int_t i(0); i < fPower->GetNpar(); i++) fPower->SetParameter(i, 0.);
 }
@@ -214,8 +220,8 @@ void AliJetFlowTools::Make(TH1* customIn, TH1* customOut) {
     // so that unfolding should return the initial spectrum
     if(!fTestMode) {
         if(fUseDptResponse && fUseDetectorResponse) {
-            fFullResponseIn = MatrixMultiplication(fDptIn, fDetectorResponse);
-            fFullResponseOut = MatrixMultiplication(fDptOut, fDetectorResponse);
+            fFullResponseIn = GetFullResponse(fDptIn, fDetectorResponse, 0);
+            fFullResponseOut = GetFullResponse(fDptOut, fDetectorResponse, 1);
         } else if (fUseDptResponse && !fUseDetectorResponse) {
             fFullResponseIn = fDptIn;
             fFullResponseOut = fDptOut;
@@ -1486,14 +1492,21 @@ TH2D* AliJetFlowTools::MatrixMultiplication(TH2D* a, TH2D* b, TString name)
     printf("__FILE__ = %s \n __LINE __ %i , __FUNC__ %s \n ", __FILE__, __LINE__, __func__);
 #endif
     // multiply two matrices
+    // the bin contents are read from the arrays of the histograms (global bin x + (nx+2)*y)
+    // instead of GetBinContent, the sums are done in the same order
     if (a->GetNbinsX() != b->GetNbinsY()) return 0x0;
     TH2D* c = (TH2D*)a->Clone("c");
-    for (Int_t y1 = 1; y1 <= a->GetNbinsY(); y1++) {
-        for (Int_t x2 = 1; x2 <= b->GetNbinsX(); x2++) {
+    const Int_t nx1(a->GetNbinsX()), ny1(a->GetNbinsY()), nx2(b->GetNbinsX());
+    const Int_t rowA(nx1+2), rowB(nx2+2);
+    const Double_t* contentA(a->GetArray());
+    const Double_t* contentB(b->GetArray());
+    for (Int_t y1 = 1; y1 <= ny1; y1++) {
+        const Double_t* rA(contentA + rowA*y1);
+        for (Int_t x2 = 1; x2 <= nx2; x2++) {
             Double_t val = 0;
-            for (Int_t x1 = 1; x1 <= a->GetNbinsX(); x1++) {
+            for (Int_t x1 = 1; x1 <= nx1; x1++) {
                 Int_t y2 = x1;
-	        val += a->GetBinContent(x1, y1) * b->GetBinContent(x2, y2);
+	        val += rA[x1] * contentB[x2 + rowB*y2];
             }
             c->SetBinContent(x2, y1, val);
             c->SetBinError(x2, y1, 0.);
@@ -1503,6 +1516,51 @@ TH2D* AliJetFlowTools::MatrixMultiplication(TH2D* a, TH2D* b, TString name)
     return c;
 }
 //_____________________________________________________________________________
+Bool_t AliJetFlowTools::HaveSameContent(TH2D* a, TH2D* b)
+{
+#ifdef ALIJETFLOWTOOLS_DEBUG_FLAG
+    printf("__FILE__ = %s \n __LINE __ %i , __FUNC__ %s \n ", __FILE__, __LINE__, __func__);
+#endif
+    // check if two matrices have the same binning and bin contents (including under- and overflow)
+    if(!a || !b) return kFALSE;
+    const Int_t nx(a->GetNbinsX()), ny(a->GetNbinsY());
+    if(nx != b->GetNbinsX() || ny != b->GetNbinsY()) return kFALSE;
+    for(Int_t i(1); i <= nx+1; i++) if(a->GetXaxis()->GetBinLowEdge(i) != b->GetXaxis()->GetBinLowEdge(i)) return kFALSE;
+    for(Int_t i(1); i <= ny+1; i++) if(a->GetYaxis()->GetBinLowEdge(i) != b->GetYaxis()->GetBinLowEdge(i)) return kFALSE;
+    const Double_t* contentA(a->GetArray());
+    const Double_t* contentB(b->GetArray());
+    for(Int_t i(0); i < (nx+2)*(ny+2); i++) if(contentA[i] != contentB[i]) return kFALSE;
+    return kTRUE;
+}
+//_____________________________________________________________________________
+TH2D* AliJetFlowTools::GetFullResponse(TH2D* dpt, TH2D* detector, Int_t slot)
+{
+#ifdef ALIJETFLOWTOOLS_DEBUG_FLAG
+    printf("__FILE__ = %s \n __LINE __ %i , __FUNC__ %s \n ", __FILE__, __LINE__, __func__);
+#endif
+    // full response dpt x detector response. in a scan over unfolding settings the
+    // response is usually the same at each call of Make(), so the product is kept in
+    // the slot (0 in plane, 1 out of plane) and a copy is returned as long as the dpt
+    // matrix and the detector response have the same content as at the last multiplication.
+    // the returned matrix is modified by the caller (normalization, name), the cache is not
+    if(!fCacheResponse || slot < 0 || slot > 1) return MatrixMultiplication(dpt, detector);
+    if(fCachedResponse[slot] && HaveSameContent(dpt, fCachedDpt[slot]) && HaveSameContent(detector, fCachedDetector[slot])) {
+        return (TH2D*)fCachedResponse[slot]->Clone("CombinedResponse");
+    }
+    TH2D* response(MatrixMultiplication(dpt, detector));
+    if(!response) return 0x0;
+    delete fCachedDpt[slot];
+    delete fCachedDetector[slot];
+    delete fCachedResponse[slot];
+    fCachedDpt[slot] = (TH2D*)dpt->Clone(Form("cachedDpt_%i", slot));
+    fCachedDetector[slot] = (TH2D*)detector->Clone(Form("cachedDetector_%i", slot));
+    fCachedResponse[slot] = (TH2D*)response->Clone(Form("cachedResponse_%i", slot));
+    fCachedDpt[slot]->SetDirectory(0);
+    fCachedDetector[slot]->SetDirectory(0);
+    fCachedResponse[slot]->SetDirectory(0);
+    return response;
+}
+//_____________________________________________________________________________
 TH1D* AliJetFlowTools::NormalizeTH1D(TH1D* histo, Double_t scale) 
 {
 #ifdef ALIJETFLOWTOOLS_DEBUG_FLAG
@@ -4653,7 +4711,7 @@ void AliJetFlowTools::MakeAU() {
         fDetectorResponse = NormalizeTH2D(fDetectorResponse);
         // get the full response matrix. if test mode is chosen, the full response is replace by a unity matrix
         // so that unfolding should return the initial spectrum
-        if(fUseDptResponse && fUseDetectorResponse) fFullResponseIn = MatrixMultiplication(fDptIn, fDetectorResponse);
+        if(fUseDptResponse && fUseDetectorResponse) fFullResponseIn = GetFullResponse(fDptIn, fDetectorResponse, 0);
         else if (fUseDptResponse && !fUseDetectorResponse) fFullResponseIn = fDptIn;
         else if (!fUseDptResponse && fUseDetectorResponse) fFullResponseIn = fDetectorResponse;
         else if (!fUseDptResponse && !fUseDetectorResponse && !fUnfoldingAlgorithm == AliJetFlowTools::kNone) return;
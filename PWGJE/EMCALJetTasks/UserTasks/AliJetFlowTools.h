@@ -169,6 +169,7 @@ class AliJetFlowTools {
         void            SetEventPlaneResolution(Double_t r)     {fEventPlaneRes         = r;}
         void            SetUseDetectorResponse(Bool_t r)        {fUseDetectorResponse   = r;}
         void            SetUseDptResponse(Bool_t r)             {fUseDptResponse        = r;}
+        void            SetCacheResponse(Bool_t c)              {fCacheResponse         = c;}
         void            SetTrainPowerFit(Bool_t t)              {fTrainPower            = t;}
         void            SetDphiUnfolding(Bool_t i)              {fDphiUnfolding         = i;}
         void            SetDphiDptUnfolding(Bool_t i)           {fDphiDptUnfolding      = i;}
@@ -267,7 +268,9 @@ class AliJetFlowTools {
         static TH1*     Bootstrap(TH1* hist, Bool_t kill = kTRUE);
         static TH1D*    RebinTH1D(TH1D* histo, TArrayD* bins, TString suffix = "", Bool_t kill = kTRUE);
         TH2D*           RebinTH2D(TH2D* histo, TArrayD* binsTrue, TArrayD* binsRec, TString suffix = "");
+        TH2D*           GetFullResponse(TH2D* dpt, TH2D* detector, Int_t slot);
         static TH2D*    MatrixMultiplication(TH2D* a, TH2D* b, TString name = "CombinedResponse");
+        static Bool_t   HaveSameContent(TH2D* a, TH2D* b);
         static TH1D*    NormalizeTH1D(TH1D* histo, Double_t scale = 1.);
         static TH1D*    MergeSpectrumBins(TArrayI* bins, TH1D* spectrum, TH2D* corr);
         static TGraphErrors*    GetRatio(TH1 *h1 = 0x0, TH1* h2 = 0x0, TString name = "", Bool_t appendFit = kFALSE, Int_t xmax = -1);
@@ -577,6 +580,10 @@ TLatex* tex = new TLatex(xmin, ymax, string.Data());
         TH1*                    fUnfoldedSpectrumIn;    // unfolded spectrum in plane
         TH1*                    fUnfoldedSpectrumOut;   // unfolded spectrum out of plane
         Int_t                   fHarmonic;              // vn harmonic
+        Bool_t                  fCacheResponse;         // reuse the full response if dpt and detector response are unchanged
+        TH2D*                   fCachedDpt[2];          // copy of the dpt matrix of the cached response, in and out of plane
+        TH2D*                   fCachedDetector[2];     // copy of the detector response of the cached response
+        TH2D*                   fCachedResponse[2];     // cached full response (dpt x detector response)
 
         static TArrayD*         gV2;                    // internal use only, do not touch these
         static TArrayD*         gStat;                  // internal use only, do not touch these
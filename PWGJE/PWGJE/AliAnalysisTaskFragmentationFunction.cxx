@@ -35,6 +35,8 @@
 #include "TRandom3.h"
 #include "TAxis.h"
 
+#include <algorithm>
+
 #include "AliAODInputHandler.h" 
 #include "AliAODHandler.h" 
 #include "AliAODHeader.h" 
@@ -2139,6 +2141,7 @@ void AliAnalysisTaskFragmentationFunction::UserExec(Option_t *)
   // Called for each event
   if(fDebug > 1) Printf("AliAnalysisTaskFragmentationFunction::UserExec()");
   
+  fTrackListIndex.clear();
   
   if(fDebug > 1) Printf("Analysis event #%5d", (Int_t) fEntry);
 
@@ -3582,11 +3585,56 @@ void AliAnalysisTaskFragmentationFunction::SetProperties(TH1* h,const char* x, c
   h->GetZaxis()->SetTitleColor(1);
 }
 
+// ________________________________________________________________________________________________________________________________________________________
+const AliAnalysisTaskFragmentationFunction::TrackListIndex& AliAnalysisTaskFragmentationFunction::GetTrackListIndex(TList* list)
+{
+  // eta, phi of the tracks of the list, sorted in eta
+  // built at the first call in the event and reused for all jets and radii
+
+  for(UInt_t i=0; i<fTrackListIndex.size(); i++){
+    if(fTrackListIndex[i].fList == list && fTrackListIndex[i].fSize == list->GetSize()) return fTrackListIndex[i];
+  }
+
+  fTrackListIndex.push_back(TrackListIndex());
+  TrackListIndex& index = fTrackListIndex.back();
+  index.fList = list;
+  index.fSize = list->GetSize();
+  index.fEta.assign(index.fSize, 0.);
+  index.fPhi.assign(index.fSize, 0.);
+
+  std::vector<std::pair<Double_t, Int_t> > order;
+  order.reserve(index.fSize);
+  for (Int_t itrack=0; itrack<index.fSize; itrack++){
+
+    AliVParticle* track = dynamic_cast<AliVParticle*>(list->At(itrack));
+    if(!track)continue;
+    Double_t trackMom[3];
+    track->PxPyPz(trackMom);
+    TVector3 track3mom(trackMom);
+
+    index.fEta[itrack] = track3mom.Eta();
+    index.fPhi[itrack] = track3mom.Phi();
+    order.push_back(std::make_pair(index.fEta[itrack], itrack));
+  }
+  std::sort(order.begin(), order.end());
+
+  index.fOrder.resize(order.size());
+  index.fSortedEta.resize(order.size());
+  for(UInt_t i=0; i<order.size(); i++){
+    index.fSortedEta[i] = order[i].first;
+    index.fOrder[i]     = order[i].second;
+  }
+
+  return index;
+}
+
 // ________________________________________________________________________________________________________________________________________________________
 void AliAnalysisTaskFragmentationFunction::GetJetTracksPointing(TList* inputlist, TList* outputlist, const AliAODJet* jet, 
 								   Double_t radius, Double_t& sumPt, Double_t minPtL, Double_t maxPt, Bool_t& isBadPt)
 {
   // fill list of tracks in cone around jet axis  
+  // only the tracks in the eta window of the cone are tested, from the index of the input list,
+  // they are added in the order of the input list as when testing all tracks
 
   sumPt = 0;
   Bool_t isBadMaxPt = kFALSE;
@@ -3595,16 +3643,27 @@ void AliAnalysisTaskFragmentationFunction::GetJetTracksPointing(TList* inputlist
   Double_t jetMom[3];
   jet->PxPyPz(jetMom);
   TVector3 jet3mom(jetMom);
+  const Double_t jetEta = jet3mom.Eta();
+  const Double_t jetPhi = jet3mom.Phi();
 
-  for (Int_t itrack=0; itrack<inputlist->GetSize(); itrack++){
+  const TrackListIndex& index = GetTrackListIndex(inputlist);
 
-    AliVParticle* track = dynamic_cast<AliVParticle*>(inputlist->At(itrack));
-    if(!track)continue;
-    Double_t trackMom[3];
-    track->PxPyPz(trackMom);
-    TVector3 track3mom(trackMom);
+  // candidates in the eta window, the margin keeps the tracks at the edge for the exact test below
+  const Double_t margin = 1e-9;
+  Int_t first = std::lower_bound(index.fSortedEta.begin(), index.fSortedEta.end(), jetEta - radius - margin) - index.fSortedEta.begin();
+  Int_t last  = std::upper_bound(index.fSortedEta.begin(), index.fSortedEta.end(), jetEta + radius + margin) - index.fSortedEta.begin();
+  std::vector<Int_t> candidates(index.fOrder.begin() + first, index.fOrder.begin() + TMath::Max(first, last));
+  std::sort(candidates.begin(), candidates.end());
 
-    Double_t dR = jet3mom.DeltaR(track3mom);
+  for (UInt_t icand=0; icand<candidates.size(); icand++){
+
+    Int_t itrack = candidates[icand];
+    AliVParticle* track = static_cast<AliVParticle*>(inputlist->At(itrack));
+
+    // same as TVector3::DeltaR
+    Double_t deta = jetEta - index.fEta[itrack];
+    Double_t dphi = TVector2::Phi_mpi_pi(jetPhi - index.fPhi[itrack]);
+    Double_t dR = TMath::Sqrt(deta*deta + dphi*dphi);
 
     if(dR<radius){
 
@@ -25,6 +25,8 @@ class TArrayS;
 class AliAODTrack;
 class AliAODMCParticle;
 
+#include <vector>
+
 #include "AliAnalysisTaskSE.h"
 #include "TAxis.h"
 #include "THnSparse.h"
@@ -576,7 +578,20 @@ class AliAnalysisTaskFragmentationFunction : public AliAnalysisTaskSE {
   
   TRandom3*                   fRandom;          // TRandom3 for background estimation 
 
-  ClassDef(AliAnalysisTaskFragmentationFunction, 12);
+  // eta, phi of the tracks of an input list, computed once per event for all jets (see GetJetTracksPointing)
+  struct TrackListIndex {
+    TList*                fList;       // indexed track list
+    Int_t                 fSize;       // size of the list when indexed
+    std::vector<Double_t> fEta;        // eta of the track momentum, per list entry
+    std::vector<Double_t> fPhi;        // phi of the track momentum, per list entry
+    std::vector<Int_t>    fOrder;      // list entries sorted in eta
+    std::vector<Double_t> fSortedEta;  // eta of fOrder
+  };
+  const TrackListIndex& GetTrackListIndex(TList* list);
+
+  std::vector<TrackListIndex> fTrackListIndex; //! indexed track lists of the current event
+
+  ClassDef(AliAnalysisTaskFragmentationFunction, 13);
 };
 
 #endif
@@ -11,6 +11,43 @@
 #include <TFileMerger.h>
 #include <TBits.h>
 #include <TTree.h>
+#include <map>
+#include <string>
+
+namespace {
+  /** 
+   * Process-wide cache of correction objects read from the OADB.
+   * The objects in the cache are never deleted, as they are shared
+   * between all corrections that read them.
+   */
+  struct CachedCorrection
+  {
+    TObject* fObject; // The data
+    TString  fEntry;  // Text representation of the entry
+  };
+  typedef std::map<std::string,CachedCorrection> CorrectionCache;
+  CorrectionCache& GetCorrectionCache()
+  {
+    static CorrectionCache cache;
+    return cache;
+  }
+  std::string CorrectionKey(const char* table, const char* file,
+			    ULong_t run, UShort_t sys, UShort_t sNN,
+			    Short_t fld, Bool_t mc, Bool_t sat, Bool_t fbk)
+  {
+    return Form("%s:%s:%lu:%hu:%hu:%hd:%d:%d:%d", file, table, run, sys,
+		sNN, fld, mc, sat, fbk);
+  }
+  Bool_t IsCachedCorrection(const TObject* o)
+  {
+    if (!o) return false;
+    CorrectionCache& cache = GetCorrectionCache();
+    for (CorrectionCache::const_iterator i = cache.begin(); 
+	 i != cache.end(); ++i) 
+      if (i->second.fObject == o) return true;
+    return false;
+  }
+}
 
 //____________________________________________________________________
 AliCorrectionManagerBase::AliCorrectionManagerBase()
@@ -564,6 +601,13 @@ AliCorrectionManagerBase::Correction::Correction(const Correction& o)
     fObject(o.fObject)
 {}
 
+//____________________________________________________________________
+AliCorrectionManagerBase::Correction::~Correction()
+{
+  // Objects from the shared cache are owned by the cache 
+  if (!IsCachedCorrection(fObject)) delete fObject;
+}
+
 //____________________________________________________________________
 AliCorrectionManagerBase::Correction&
 AliCorrectionManagerBase::Correction::operator=(const Correction& o)
@@ -662,6 +706,17 @@ AliCorrectionManagerBase::Correction::ReadIt(AliOADBForward* db,
   // Massage fields according to settings 
   MassageFields(run, sys, sNN, fld, mc, sat);
 
+  // Check if we already read this object 
+  CorrectionCache& cache = GetCorrectionCache();
+  std::string      key   = CorrectionKey(fName, fTitle, run, sys, sNN,
+					 fld, mc, sat, fallback);
+  CorrectionCache::const_iterator cached = cache.find(key);
+  if (cached != cache.end()) { 
+    fObject    = cached->second.fObject;
+    fLastEntry = cached->second.fEntry;
+    return true;
+  }
+
   if (!OpenIt(db, vrb, fallback)) return false;
 
   // Query database 
@@ -694,6 +749,11 @@ AliCorrectionManagerBase::Correction::ReadIt(AliOADBForward* db,
   fObject    = o;
   fLastEntry = e->GetTitle();
 
+  // Share with later queries for the same conditions 
+  CachedCorrection& c = cache[key];
+  c.fObject = fObject;
+  c.fEntry  = fLastEntry;
+
   return true;
 }
 
@@ -306,9 +306,13 @@ public:
     /** 
      * Destructor
      */
-    ~Correction() { delete fObject; }
+    ~Correction();
     /** 
-     * Read the correction
+     * Read the correction.  Objects read are kept in a process-wide
+     * cache keyed on the table, file and massaged query fields, so
+     * that the same object is only queried from the database once,
+     * even if the conditions change in fields this correction does
+     * not depend on, or several managers read the same table.
      * 
      * @param db   Database interface 
      * @param run  Run number
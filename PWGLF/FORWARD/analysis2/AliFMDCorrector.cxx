@@ -169,6 +169,57 @@ AliFMDCorrector::DivideMap(TH2* num, const TH2* denom,
   Int_t first = (alsoUnderOver ? 0 : 1);
   Int_t lastX = num->GetNbinsX() + (alsoUnderOver ? 1 : 0);
   Int_t lastY = num->GetNbinsY() + (alsoUnderOver ? 1 : 0);
+
+  // If both are TH2D with errors, work directly on the contiguous
+  // content and error arrays rather than the per-bin accessors.  The
+  // result, including the number of entries, is the same as below up
+  // to the rounding of taking the square root of the errors.
+  TH2D*       dnum = dynamic_cast<TH2D*>(num);
+  const TH2D* dden = dynamic_cast<const TH2D*>(denom);
+  if (dnum && dden && 
+      dnum->GetSumw2N() == dnum->GetSize() && 
+      dden->GetSumw2N() == dden->GetSize() && 
+      dnum->GetSize()   == dden->GetSize() && 
+      lastX >= first && lastY >= first) {
+    Double_t*       nc   = dnum->GetArray();
+    Double_t*       ne2  = dnum->GetSumw2()->GetArray();
+    const Double_t* dc   = dden->GetArray();
+    const Double_t* de2  = dden->GetSumw2()->GetArray();
+    Int_t           last = num->GetBin(lastX, lastY);
+    for (Int_t ix = first; ix <= lastX; ix++) {
+      for (Int_t iy = first; iy <= lastY; iy++) { 
+	Int_t    bin = num->GetBin(ix,iy);
+	if (bin == last) continue; // Set below
+	Double_t c0  = nc[bin];
+	Double_t c1  = dc[bin];
+	if (!c1) { 
+	  nc[bin]  = 0;
+	  ne2[bin] = 0;
+	  continue;
+	}
+	Double_t c12 = c1*c1;
+	nc[bin]      = c0 / c1;
+	ne2[bin]     = (ne2[bin]*c1*c1 + de2[bin]*c0*c0)/(c12*c12);
+      }
+    }
+    // Each SetBinContent counts an entry - the last bin is set via
+    // the histogram to also invalidate the statistics 
+    Int_t nSet = (lastX - first + 1) * (lastY - first + 1);
+    num->SetEntries(num->GetEntries() + nSet - 1);
+    Double_t c0 = nc[last];
+    Double_t c1 = dc[last];
+    if (!c1) { 
+      num->SetBinContent(last, 0);
+      ne2[last] = 0;
+    }
+    else { 
+      Double_t c12 = c1*c1;
+      Double_t e2  = (ne2[last]*c1*c1 + de2[last]*c0*c0)/(c12*c12);
+      num->SetBinContent(last, c0 / c1);
+      ne2[last] = e2;
+    }
+    return;
+  }
   
   for (Int_t ix = first; ix <= lastX; ix++) {
     for (Int_t iy = first; iy <= lastY; iy++) { 
@@ -60,7 +60,11 @@ AliFMDDensityCalculator::AliFMDDensityCalculator()
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fNParticlesTableBins(0),
+    fNParticlesTableMax(20),
+    fNParticlesTableEta(0),
+    fNParticlesTable()
 {
   // 
   // Constructor 
@@ -98,7 +102,11 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const char* title)
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fNParticlesTableBins(0),
+    fNParticlesTableMax(20),
+    fNParticlesTableEta(0),
+    fNParticlesTable()
 {
   // 
   // Constructor 
@@ -167,7 +175,11 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const
     fDoTiming(o.fDoTiming),
     fHTiming(o.fHTiming), 
   fMaxOutliers(o.fMaxOutliers),
-  fOutlierCut(o.fOutlierCut)
+  fOutlierCut(o.fOutlierCut),
+  fNParticlesTableBins(o.fNParticlesTableBins),
+  fNParticlesTableMax(o.fNParticlesTableMax),
+  fNParticlesTableEta(o.fNParticlesTableEta),
+  fNParticlesTable(o.fNParticlesTable)
 {
   // 
   // Copy constructor 
@@ -232,6 +244,10 @@ AliFMDDensityCalculator::operator=(const AliFMDDensityCalculator& o)
   fHTiming            = o.fHTiming;
   fMaxOutliers        = o.fMaxOutliers;
   fOutlierCut         = o.fOutlierCut;
+  fNParticlesTableBins= o.fNParticlesTableBins;
+  fNParticlesTableMax = o.fNParticlesTableMax;
+  fNParticlesTableEta = o.fNParticlesTableEta;
+  fNParticlesTable    = o.fNParticlesTable;
 
   fRingHistos.Delete();
   TIter    next(&o.fRingHistos);
@@ -496,7 +512,10 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	  // --- Now caluculate Nch for this strip using fits --------
 	  START_TIMER(timer);
 	  Double_t n   = 0;
-	  if (cut > 0 && mult > cut) n = NParticles(mult,d,r,eta,lowFlux);
+	  if (cut > 0 && mult > cut) 
+	    n = (fNParticlesTableBins > 0 ? 
+		 NParticlesFromTable(mult,d,r,eta,lowFlux) :
+		 NParticles(mult,d,r,eta,lowFlux));
 	  rh->fELoss->Fill(mult);
 	  // rh->fEvsN->Fill(mult,n);
 	  // rh->fEtaVsN->Fill(eta, n);
@@ -770,6 +789,53 @@ AliFMDDensityCalculator::CacheMaxWeights(const TAxis& axis)
 
   // Cache cuts in histogram
   fCuts.FillHistogram(fLowCuts);
+
+  // Tabulate N_ch(Delta) if requested 
+  CacheNParticles(cor);
+}
+
+//_____________________________________________________________________
+void
+AliFMDDensityCalculator::CacheNParticles(const AliFMDCorrELossFit* cor)
+{
+  // 
+  // Make the tables of N_ch(Delta) for all rings and eta bins of the
+  // energy loss fits.  The same fits and maximum weights as in
+  // NParticles are used.
+  // 
+  // Parameters:
+  //    cor  Energy loss fits 
+  //
+  fNParticlesTableEta = 0;
+  fNParticlesTable.Set(0);
+  if (fNParticlesTableBins <= 0 || fNParticlesTableMax <= 0) return;
+  DGUARD(fDebug, 2, "Tabulate N_ch(Delta) in FMD density calculator");
+
+  const Int_t    nEta  = cor->GetEtaAxis().GetNbins();
+  const Int_t    nPnt  = fNParticlesTableBins + 1;
+  const Double_t dx    = fNParticlesTableMax / fNParticlesTableBins;
+  fNParticlesTableEta  = nEta;
+  fNParticlesTable.Set(5 * nEta * nPnt);
+  fNParticlesTable.Reset(-1);
+
+  const UShort_t ds[] = { 1,   2,   2,   3,   3 };
+  const Char_t   rs[] = { 'I', 'I', 'O', 'I', 'O' };
+  Int_t nTables = 0;
+  for (Int_t q = 0; q < 5; q++) { 
+    for (Int_t iEta = 1; iEta <= nEta; iEta++) { 
+      AliFMDCorrELossFit::ELossFit* fit = cor->FindFit(ds[q],rs[q],iEta,-1);
+      Int_t m = GetMaxWeight(ds[q], rs[q], iEta-1);
+      if (!fit || m < 1) continue;
+
+      UShort_t  n   = TMath::Min(fMaxParticles, UShort_t(m));
+      Double_t* tab = fNParticlesTable.GetArray() + (q * nEta + iEta - 1) * nPnt;
+      for (Int_t j = 0; j < nPnt; j++) 
+	tab[j] = fit->EvaluateWeighted(j * dx, n);
+      nTables++;
+    }
+  }
+  AliInfoF("Tabulated N_ch(Delta) in %d points up to %f for %d ring/eta bins",
+	   nPnt, fNParticlesTableMax, nTables);
 }
 
 //_____________________________________________________________________
@@ -889,6 +955,58 @@ AliFMDDensityCalculator::NParticles(Float_t  mult,
   return ret;
 }
 
+//_____________________________________________________________________
+Float_t 
+AliFMDDensityCalculator::NParticlesFromTable(Float_t  mult, 
+					     UShort_t d, 
+					     Char_t   r, 
+					     Float_t  eta,
+					     Bool_t   lowFlux) const
+{
+  // 
+  // Get the number of particles corresponding to the signal mult by
+  // linear interpolation in the tables made by CacheNParticles.  If
+  // there is no table, or mult is beyond the table, use NParticles.
+  // 
+  // Parameters:
+  //    mult     Signal
+  //    d        Detector
+  //    r        Ring 
+  //    eta      Pseudo-rapidity 
+  //    lowFlux  Low-flux flag 
+  // 
+  // Return:
+  //    The number of particles 
+  //
+  if (lowFlux) return 1;
+  if (fNParticlesTableEta <= 0 || mult < 0 || mult >= fNParticlesTableMax) 
+    return NParticles(mult, d, r, eta, lowFlux);
+
+  Int_t q = -1;
+  switch (d) { 
+  case 1:  q = 0;                                  break;
+  case 2:  q = (r == 'I' || r == 'i' ? 1 : 2);     break;
+  case 3:  q = (r == 'I' || r == 'i' ? 3 : 4);     break;
+  }
+  AliForwardCorrectionManager&  fcm  = AliForwardCorrectionManager::Instance();
+  Int_t                         iEta = fcm.GetELossFit()->FindEtaBin(eta);
+  if (q < 0 || iEta <= 0 || iEta > fNParticlesTableEta) 
+    return NParticles(mult, d, r, eta, lowFlux);
+  
+  const Int_t     nPnt = fNParticlesTableBins + 1;
+  const Double_t* tab  = fNParticlesTable.GetArray() + (q*fNParticlesTableEta+iEta-1)*nPnt;
+  if (tab[0] < 0) return NParticles(mult, d, r, eta, lowFlux);
+
+  Double_t u   = mult / fNParticlesTableMax * fNParticlesTableBins;
+  Int_t    j   = TMath::Min(Int_t(u), fNParticlesTableBins - 1);
+  Double_t ret = tab[j] + (u - j) * (tab[j+1] - tab[j]);
+
+  fWeightedSum->Fill(ret);
+  fSumOfWeights->Fill(ret);
+  
+  return ret;
+}
+
 //_____________________________________________________________________
 Float_t 
 AliFMDDensityCalculator::Correction(UShort_t d, 
@@ -1119,6 +1237,7 @@ AliFMDDensityCalculator::CreateOutputObjects(TList* dir)
   d->Add(AliForwardUtil::MakeParameter("maxOutliers",  fMaxOutliers));
   d->Add(AliForwardUtil::MakeParameter("outlierCut",   fOutlierCut));
   d->Add(AliForwardUtil::MakeParameter("hitThreshold", fHitThreshold));
+  d->Add(AliForwardUtil::MakeParameter("nParticlesTable", fNParticlesTableBins));
   d->Add(nFiles);
   // d->Add(nxi);
   fCuts.Output(d,"lCuts");
@@ -1200,6 +1319,8 @@ AliFMDDensityCalculator::Print(Option_t* option) const
   PFV("Threshold(hit)",         fHitThreshold);
   PFV("Max(outliers)",          fMaxOutliers);
   PFV("Cut(outlier)",           fOutlierCut);
+  PFV("N_ch(Delta) table bins", fNParticlesTableBins);
+  PFV("N_ch(Delta) table max",  fNParticlesTableMax);
   PFV("Lower cut", "");
   fCuts.Print();
 
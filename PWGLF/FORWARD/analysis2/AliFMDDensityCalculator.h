@@ -16,6 +16,7 @@
 #include <TNamed.h>
 #include <TList.h>
 #include <TArrayI.h>
+#include <TArrayD.h>
 #include <TVector3.h>
 #include "AliForwardUtil.h"
 #include "AliFMDMultCuts.h"
@@ -211,6 +212,23 @@ public:
    * @param cut Cut value 
    */
   void SetHitThreshold(Double_t cut=0.9) { fHitThreshold = cut; }
+  /** 
+   * Use tabulated values of @f$ N_{ch}(\Delta)@f$ (see NParticles)
+   * instead of evaluating the energy loss fits for each strip.  The
+   * tables are made for each ring and @f$\eta@f$ bin of the energy
+   * loss fits, in @a nBins equidistant points of @f$\Delta@f$ from 0
+   * to @a maxDelta, and are linearly interpolated.  Signals above @a
+   * maxDelta are still evaluated from the fits.  Note, the result
+   * differs from the direct evaluation by the interpolation error.
+   * 
+   * @param nBins    Number of bins, 0 to disable (default) 
+   * @param maxDelta Largest @f$\Delta@f$ tabulated 
+   */
+  void SetNParticlesTable(UShort_t nBins, Double_t maxDelta=20) 
+  { 
+    fNParticlesTableBins = nBins; 
+    fNParticlesTableMax  = maxDelta; 
+  }
   /** 
    * Get the multiplicity cut.  If the user has set fMultCut (via
    * SetMultCut) then that value is used.  If not, then the lower
@@ -319,6 +337,32 @@ protected:
    * @return max weight or <= 0 in case of problems 
    */
   Int_t GetMaxWeight(UShort_t d, Char_t r, Float_t eta) const;
+  /** 
+   * Make the tables of @f$ N_{ch}(\Delta)@f$ for all rings and
+   * @f$\eta@f$ bins, if requested with SetNParticlesTable
+   * 
+   * @param cor Energy loss fits 
+   */
+  void CacheNParticles(const AliFMDCorrELossFit* cor);
+  /** 
+   * Get the number of particles corresponding to the signal mult
+   * from the tables made by CacheNParticles.  If there is no table
+   * for this ring and @f$\eta@f$ bin, or if @a mult is beyond the
+   * table, NParticles is used.
+   * 
+   * @param mult     Signal
+   * @param d        Detector
+   * @param r        Ring 
+   * @param eta      Pseudo-rapidity 
+   * @param lowFlux  Low-flux flag 
+   * 
+   * @return The number of particles 
+   */
+  Float_t NParticlesFromTable(Float_t  mult, 
+			      UShort_t d, 
+			      Char_t   r, 
+			      Float_t  eta, 
+			      Bool_t   lowFlux) const;
 
   /** 
    * Get the number of particles corresponding to the signal mult
@@ -503,8 +547,12 @@ protected:
   TProfile*              fHTiming;
   Double_t               fMaxOutliers; // Maximum ratio of outlier bins 
   Double_t               fOutlierCut;  // Maximum relative diviation 
+  UShort_t fNParticlesTableBins; // Bins of the N_ch(Delta) tables, 0: not used
+  Double_t fNParticlesTableMax;  // Largest Delta of the N_ch(Delta) tables
+  Int_t    fNParticlesTableEta;  //! Number of eta bins of the tables
+  TArrayD  fNParticlesTable;     //! [ring][eta][Delta] N_ch(Delta), <0 if none
 
-  ClassDef(AliFMDDensityCalculator,15); // Calculate Nch density 
+  ClassDef(AliFMDDensityCalculator,16); // Calculate Nch density 
 };
 
 #endif
@@ -999,7 +999,12 @@ AliForwardFlowTaskQC::VertexBin::VertexBin()
     fdNdedpRefAcc(), // Diagnostics histogram for acc. maps
     fdNdedpDiffAcc(),// Diagnostics histogram for acc. maps
     fOutliers(),     // Histogram for sigma distribution
-    fDebug()         // Debug level
+    fDebug(),        // Debug level
+    fCosPhiTable(),  // cos(n*phi) at phi bin centers
+    fSinPhiTable(),  // sin(n*phi) at phi bin centers
+    fPhiTableNBins(0), // Number of phi bins of the table
+    fPhiTableMin(0), // Lower phi limit of the table
+    fPhiTableMax(0)  // Upper phi limit of the table
 {
   //
   //  Default constructor
@@ -1027,7 +1032,12 @@ AliForwardFlowTaskQC::VertexBin::VertexBin(Int_t vLow, Int_t vHigh,
     fdNdedpRefAcc(),     // Diagnostics histogram for acc. maps
     fdNdedpDiffAcc(),    // Diagnostics histogram for acc. maps
     fOutliers(),         // Histogram for sigma distribution
-    fDebug(0)            // Debug level
+    fDebug(0),           // Debug level
+    fCosPhiTable(),      // cos(n*phi) at phi bin centers
+    fSinPhiTable(),      // sin(n*phi) at phi bin centers
+    fPhiTableNBins(0),   // Number of phi bins of the table
+    fPhiTableMin(0),     // Lower phi limit of the table
+    fPhiTableMax(0)      // Upper phi limit of the table
 {
   //
   //  Constructor
@@ -1093,6 +1103,7 @@ AliForwardFlowTaskQC::VertexBin::operator=(const AliForwardFlowTaskQC::VertexBin
   fdNdedpDiffAcc = o.fdNdedpDiffAcc;
   fOutliers      = o.fOutliers;
   fDebug         = o.fDebug;
+  fPhiTableNBins = 0; // Remade on next use
   for (UInt_t i = 0; i < sizeof(fEtaLims)/sizeof(Double_t); i++) fEtaLims[i] = o.fEtaLims[i];
 
   return *this;
@@ -1250,6 +1261,35 @@ void AliForwardFlowTaskQC::VertexBin::AddOutput(TList* outputlist, TAxis* centAx
   return;
 }
 //_____________________________________________________________________
+void AliForwardFlowTaskQC::VertexBin::MakePhiTable(const TAxis& phiAxis)
+{
+  //
+  //  Make the table of cos(n*phi) and sin(n*phi), n = 0..2*fMaxMoment,
+  //  at the phi bin centers - the same for all eta bins and events
+  //
+  //  Parameters:
+  //   phiAxis: phi axis of the input histogram
+  //
+  Int_t nPhi = phiAxis.GetNbins();
+  if (fPhiTableNBins == nPhi && 
+      fPhiTableMin == phiAxis.GetXmin() && 
+      fPhiTableMax == phiAxis.GetXmax()) return;
+
+  Int_t nMom = 2*fMaxMoment+1;
+  fCosPhiTable.Set((nPhi+1)*nMom);
+  fSinPhiTable.Set((nPhi+1)*nMom);
+  for (Int_t phiBin = 1; phiBin <= nPhi; phiBin++) {
+    Double_t phi = phiAxis.GetBinCenter(phiBin);
+    for (Int_t n = 1; n < nMom; n++) {
+      fCosPhiTable[phiBin*nMom+n] = TMath::Cos(n*phi);
+      fSinPhiTable[phiBin*nMom+n] = TMath::Sin(n*phi);
+    }
+  }
+  fPhiTableNBins = nPhi;
+  fPhiTableMin   = phiAxis.GetXmin();
+  fPhiTableMax   = phiAxis.GetXmax();
+}
+//_____________________________________________________________________
 Bool_t AliForwardFlowTaskQC::VertexBin::FillHists(TH2D& dNdetadphi, Double_t cent, UShort_t mode) 
 {
   // 
@@ -1272,6 +1312,18 @@ Bool_t AliForwardFlowTaskQC::VertexBin::FillHists(TH2D& dNdetadphi, Double_t cen
   // and fill it in the reference and differential histograms
   Int_t nBadBins = 0;
   Double_t limit = 9999.;
+  // The phi dependence and the output bins of the moments do not
+  // change with eta, and the content is read directly from the array
+  MakePhiTable(*dNdetadphi.GetYaxis());
+  const Int_t     nMom    = 2*fMaxMoment+1;
+  const Double_t* cosTab  = fCosPhiTable.GetArray();
+  const Double_t* sinTab  = fSinPhiTable.GetArray();
+  const Double_t* content = dNdetadphi.GetArray();
+  TArrayD cosBins(nMom), sinBins(nMom);
+  for (Int_t n = 1; n < nMom; n++) {
+    cosBins[n] = fCumuDiff->GetYaxis()->GetBinCenter(GetBinNumberCos(n));
+    sinBins[n] = fCumuDiff->GetYaxis()->GetBinCenter(GetBinNumberSin(n));
+  }
   for (Int_t etaBin = 1; etaBin <= dNdetadphi.GetNbinsX(); etaBin++) {
     Double_t eta = dNdetadphi.GetXaxis()->GetBinCenter(etaBin);
     // Numbers to cut away bad events
@@ -1282,7 +1334,7 @@ Bool_t AliForwardFlowTaskQC::VertexBin::FillHists(TH2D& dNdetadphi, Double_t cen
     for (Int_t phiBin = 0; phiBin <= dNdetadphi.GetNbinsY(); phiBin++) {
       // Check for acceptance
       if (phiBin == 0) {
-        if (dNdetadphi.GetBinContent(etaBin, 0) == 0) break;
+        if (content[dNdetadphi.GetBin(etaBin, 0)] == 0) break;
         // Central limit for eta gap break for reference flow
 	if ((fFlags & kEtaGap) && (mode & kFillRef) && 
 	     TMath::Abs(eta) < fEtaGap) break;
@@ -1296,7 +1348,7 @@ Bool_t AliForwardFlowTaskQC::VertexBin::FillHists(TH2D& dNdetadphi, Double_t cen
 	continue;
       } // End of phiBin == 0
       Double_t phi = dNdetadphi.GetYaxis()->GetBinCenter(phiBin);
-      Double_t weight = dNdetadphi.GetBinContent(etaBin, phiBin);
+      Double_t weight = content[dNdetadphi.GetBin(etaBin, phiBin)];
         
       // We calculate the average Nch per. bin
       avgSqr += weight*weight;
@@ -1313,11 +1365,13 @@ Bool_t AliForwardFlowTaskQC::VertexBin::FillHists(TH2D& dNdetadphi, Double_t cen
 	fCumuDiff->Fill(eta, 0., weight);
         fdNdedpDiffAcc->Fill(eta, phi, weight);
       }
+      const Double_t* cosnPhis = cosTab + phiBin*nMom;
+      const Double_t* sinnPhis = sinTab + phiBin*nMom;
       for (Int_t n = 1; n <= 2*fMaxMoment; n++) {
-	Double_t cosBin = fCumuDiff->GetYaxis()->GetBinCenter(GetBinNumberCos(n));
-	Double_t sinBin = fCumuDiff->GetYaxis()->GetBinCenter(GetBinNumberSin(n));
-	Double_t cosnPhi = weight*TMath::Cos(n*phi);
-	Double_t sinnPhi = weight*TMath::Sin(n*phi);
+	Double_t cosBin = cosBins[n];
+	Double_t sinBin = sinBins[n];
+	Double_t cosnPhi = weight*cosnPhis[n];
+	Double_t sinnPhi = weight*sinnPhis[n];
         // fill ref
 	if ((mode & kFillRef) && !((fFlags & kTracks) && (fFlags & kMC) && TMath::Abs(eta) > 0.75)) {
 	  fCumuRef->Fill(eta, cosBin, cosnPhi);
@@ -333,7 +333,7 @@ protected:
      * 
      * @return VertexBin
      */
-    VertexBin(const VertexBin& o){;}
+    VertexBin(const VertexBin& o) : TNamed(), fPhiTableNBins(0) {;}
     /**
      * Assignment operator 
      * 
@@ -524,6 +524,13 @@ protected:
      * @return hist
      */
     TH2D* MakeOutputHist(Int_t qc, Int_t n, const Char_t* ctype, UInt_t nua) const;
+    /**
+     * Make the table of cos(n*phi) and sin(n*phi) at the phi bin
+     * centers of the input, unless already made for this phi axis
+     *
+     * @param phiAxis phi axis of the input histogram
+     */
+    void MakePhiTable(const TAxis& phiAxis);
 
     UShort_t   fMaxMoment;     // Max flow moment 
     Int_t      fVzMin;         // z-vertex min must be in whole [cm]
@@ -542,6 +549,11 @@ protected:
     TH2F*      fdNdedpDiffAcc; // Diagnostics histogram for acc. maps
     TH2F*      fOutliers;      // Sigma <M> histogram 
     UShort_t   fDebug;         // Debug flag
+    TArrayD    fCosPhiTable;   //! cos(n*phi) per [phiBin*(2*fMaxMoment+1)+n]
+    TArrayD    fSinPhiTable;   //! sin(n*phi) per [phiBin*(2*fMaxMoment+1)+n]
+    Int_t      fPhiTableNBins; //! Number of phi bins of the table
+    Double_t   fPhiTableMin;   //! Lower phi limit of the table
+    Double_t   fPhiTableMax;   //! Upper phi limit of the table
 
     // ClassDef(VertexBin, 4); // object for eta dependent cumulants ananlysis
   };
@@ -162,6 +162,16 @@ public:
    * Number of steps to do in the Landau, Gaussiam convolution 
    */
   static Int_t NSteps() { return 100; }
+  /** 
+   * Gaussian weights of the steps of the Landau, Gaussian
+   * convolution (see F).  The integration points are at fixed
+   * numbers of @f$\sigma'@f$ from @f$ x@f$, so the weights do not
+   * depend on @f$ x@f$ nor on @f$\sigma'@f$, and are calculated only
+   * once.
+   * 
+   * @return Array of NSteps()/2+1 weights 
+   */
+  static const Double_t* GausKernel();
   /* @} */
 
   //__________________________________________________________________
@@ -523,27 +533,46 @@ AliLandauGaus::Fl(Double_t x, Double_t delta, Double_t xi)
   return TMath::Landau(x, deltaP, xi, true);
 }
 //____________________________________________________________________
+inline const Double_t* 
+AliLandauGaus::GausKernel()
+{
+  // Step i is at x -/+ (nSigma - (i-.5) 2 nSigma/nSteps) sigma'
+  static Double_t* kernel = 0;
+  if (!kernel) { 
+    const Int_t    nSteps = NSteps();
+    const Double_t nSigma = NSigma();
+    Double_t*      w      = new Double_t[nSteps/2+1];
+    for (Int_t i = 0; i <= nSteps/2; i++) { 
+      const Double_t u = nSigma - (i - .5) * 2 * nSigma / nSteps;
+      w[i] = TMath::Exp(-.5 * u * u);
+    }
+    kernel = w;
+  }
+  return kernel;
+}
+//____________________________________________________________________
 inline Double_t 
 AliLandauGaus::F(Double_t x, Double_t delta, Double_t xi,
 		 Double_t sigma, Double_t sigmaN)
 {
   if (xi <= 0) return 0;
 
-  const Int_t    nSteps = NSteps();
-  const Double_t nSigma = NSigma();
-  const Double_t deltaP = delta; // - sigma * sigmaShift; // + sigma * mpshift;
-  const Double_t sigma2 = sigmaN*sigmaN + sigma*sigma;
-  const Double_t sigma1 = sigmaN == 0 ? sigma : TMath::Sqrt(sigma2);
-  const Double_t xlow   = x - nSigma * sigma1;
-  const Double_t xhigh  = x + nSigma * sigma1;
-  const Double_t step   = (xhigh - xlow) / nSteps;
-  Double_t       sum    = 0;
+  const Int_t     nSteps = NSteps();
+  const Double_t  nSigma = NSigma();
+  const Double_t  deltaP = delta; // - sigma * sigmaShift; // + sigma * mpshift;
+  const Double_t  sigma2 = sigmaN*sigmaN + sigma*sigma;
+  const Double_t  sigma1 = sigmaN == 0 ? sigma : TMath::Sqrt(sigma2);
+  const Double_t  xlow   = x - nSigma * sigma1;
+  const Double_t  xhigh  = x + nSigma * sigma1;
+  const Double_t  step   = (xhigh - xlow) / nSteps;
+  const Double_t* w      = GausKernel();
+  Double_t        sum    = 0;
   
+  // The two points of a step have the same Gaussian weight
   for (Int_t i = 0; i <= nSteps/2; i++) { 
     const Double_t x1 = xlow  + (i - .5) * step;
     const Double_t x2 = xhigh - (i - .5) * step;
-    sum += Fl(x1, deltaP, xi) * TMath::Gaus(x, x1, sigma1);
-    sum += Fl(x2, deltaP, xi) * TMath::Gaus(x, x2, sigma1);
+    sum += (Fl(x1, deltaP, xi) + Fl(x2, deltaP, xi)) * w[i];
   }
   return step * sum * InvSq2Pi() / sigma1;
 }
@@ -18,6 +18,7 @@
 #include "AliAnalysisManager.h"
 #include "AliCentrality.h"
 #include "AliPDG.h"
+#include "AliPIDResponseCache.h"
 #include "AliMultSelection.h"
 #include "AliTPCPIDResponse.h"
 #include "AliTOFPIDResponse.h"
@@ -380,9 +381,9 @@ void AliAnalysisTaskNucleiYield::UserExec(Option_t *){
       const int iC = (track->Charge() > 0) ? 1 : 0;
       fTPCeLoss[iC]->Fill(track->GetTPCmomentum(),track->GetTPCsignal());
 
-      if (!PassesPIDSelection(track)) continue;
       float tpc_n_sigma = GetTPCsigmas(track);
-      float tof_n_sigma = iTof ? fPID->NumberOfSigmas(AliPIDResponse::kTOF, track, fParticle) : -999.f;
+      if (!PassesPIDSelection(track, tpc_n_sigma)) continue;
+      float tof_n_sigma = iTof ? GetTOFsigmas(track) : -999.f;
 
       for (int iR = iTof; iR >= 0; iR--) {
         if (fabs(tpc_n_sigma) < 4 && (fabs(tof_n_sigma) < 4. || !iTof)) {
@@ -573,13 +574,24 @@ float AliAnalysisTaskNucleiYield::GetTPCsigmas(AliVTrack* t) {
 
 }
 
+/// TOF number of sigmas of the track for the nucleus of the task. The value comes from the
+/// process wide AliPIDResponseCache: it is evaluated once per track and event for all
+/// the nuclei wagons of the train, whatever the hypothesis they ask for.
+///
+/// \param t Track
+/// \return Number of sigmas from the TOF expected signal
+///
+float AliAnalysisTaskNucleiYield::GetTOFsigmas(AliVTrack* t) {
+  return AliPIDResponseCache::Instance()->NumberOfSigmasTOF(fPID, t, fParticle);
+}
+
 /// This function checks if the track passes the PID selection
 ///
 /// \param t Track to be tested
-/// \param sigmas Number of sigmas
+/// \param tpcSigmas TPC number of sigmas of the track, from GetTPCsigmas
 /// \return Boolean value: true means that the track passes the PID selection
 ///
-Bool_t AliAnalysisTaskNucleiYield::PassesPIDSelection(AliAODTrack *t) {
+Bool_t AliAnalysisTaskNucleiYield::PassesPIDSelection(AliAODTrack *t, float tpcSigmas) {
   bool tofPID = true, itsPID = true, tpcPID = true;
   if (fRequireITSpidSigmas > 0 && t->Pt() < fDisableITSatHighPt) {
     AliITSPIDResponse &itsPidResp = fPID->GetITSResponse();
@@ -587,13 +599,12 @@ Bool_t AliAnalysisTaskNucleiYield::PassesPIDSelection(AliAODTrack *t) {
   }
 
   if (fRequireTOFpidSigmas > 0) {
-    tofPID = TMath::Abs(fPID->NumberOfSigmasTOF(t, fParticle)) < fRequireTOFpidSigmas;
+    tofPID = TMath::Abs(GetTOFsigmas(t)) < fRequireTOFpidSigmas;
   }
 
   if (t->Pt() < fDisableTPCpidAtHighPt) {
     if (fCustomTPCpid.GetSize() < 6 || fIsMC) {
-      AliTPCPIDResponse &tpcPidResp = fPID->GetTPCResponse();
-      tpcPID = TMath::Abs(tpcPidResp.GetNumberOfSigmas(t, fParticle)) < fRequireTPCpidSigmas;
+      tpcPID = TMath::Abs(tpcSigmas) < fRequireTPCpidSigmas;
     } else {
       const float p = t->GetTPCmomentum() / fPDGMassOverZ;
       const float r = AliExternalTrackParam::BetheBlochAleph(p, fCustomTPCpid[0], fCustomTPCpid[1],
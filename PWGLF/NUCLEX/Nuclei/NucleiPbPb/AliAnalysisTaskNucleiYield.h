@@ -99,9 +99,10 @@ private:
   AliAnalysisTaskNucleiYield &operator=(const AliAnalysisTaskNucleiYield &source);
 
   Bool_t  AcceptTrack(AliAODTrack *t, Double_t dca[2]);
-  Bool_t  PassesPIDSelection(AliAODTrack *t);
+  Bool_t  PassesPIDSelection(AliAODTrack *t, float tpcSigmas);
   Float_t HasTOF(AliAODTrack *t);
   float   GetTPCsigmas(AliVTrack *t);
+  float   GetTOFsigmas(AliVTrack *t);
 
   Bool_t Flatten(float cent);
   void PtCorrection(float &pt, bool positiveCharge);
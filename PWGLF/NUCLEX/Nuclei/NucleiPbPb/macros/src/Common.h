@@ -35,6 +35,7 @@ const string kSystematicsOutput = kBaseOutputDir + "systematics.root";
 const string kFinalOutput = kBaseOutputDir + "final.root";
 
 const bool   kPrintFigures{true};
+const int    kNumCPU{1}; // processes used by RooFit for the likelihood of each fit
 const string kFiguresFolder = "/tmp/images/";
 const string kMacrosFolder = "/tmp/images/macros/";
 
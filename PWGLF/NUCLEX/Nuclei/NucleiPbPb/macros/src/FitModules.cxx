@@ -32,10 +32,14 @@
 
 void FitModule::FitData(TH1* dat,TString &name, TString &title, TString range) {
   RooDataHist data("data","data",RooArgList(*mX),Import(*dat));
+  FitData(data, name, title, range);
+}
+
+void FitModule::FitData(RooDataHist &data,TString &name, TString &title, TString range) {
   mPlot = mX->frame();
   mPlot->SetTitle(title.Data());
   mPlot->SetName(name.Data());
-  for (int i = 2; i--;) RooFitResult *res = mTemplate->fitTo(data,Extended(),Verbose(kFALSE),PrintLevel(-1),Range(range));
+  for (int i = 2; i--;) RooFitResult *res = mTemplate->fitTo(data,Extended(),Verbose(kFALSE),PrintLevel(-1),Range(range),NumCPU(mNumCPU));
   data.plotOn(mPlot,Name("data"));
   mTemplate->plotOn(mPlot,Name("model"),Range(range),NormRange(range));
   mTemplate->plotOn(mPlot,Components(*mBackground),LineStyle(kDashed),Range(range),NormRange(range));
@@ -22,6 +22,7 @@ class RooPlot;
 class RooAddPdf;
 class RooExponential;
 class RooChebychev;
+class RooDataHist;
 
 class FitModule {
 public:
@@ -31,9 +32,15 @@ public:
   , mSigCounts(new RooRealVar("mSigCounts","Sig counts",1000.,0.,1.e8))
   , mMu(new RooRealVar("mMu","Mu",-0.1,0.1))
   , mSigma(new RooRealVar("mSigma","Sigma",0.02,.61))
+  , mNumCPU(1)
     {}
 
   virtual void FitData(TH1* h, TString &name, TString &title, TString range = "");
+  /// Same fit on an already imported histogram: the macros fitting the same projection
+  /// with several modules or ranges import it once
+  virtual void FitData(RooDataHist &data, TString &name, TString &title, TString range = "");
+  /// Number of processes used by RooFit to evaluate the likelihood of each fit
+  void SetNumCPU(int n) { mNumCPU = n > 1 ? n : 1; }
   RooPlot* GetPlot() { return mPlot; }
   static RooPlot* FitAndPlot(RooRealVar &x, RooAbsData &data, RooAbsPdf &model, RooAbsPdf &sig,
                              RooAbsPdf &bkg,TString range) {
@@ -68,6 +75,7 @@ public:
   RooAbsPdf   *mSignal;
   RooAbsPdf   *mBackground;
   float        mChi2;
+  int          mNumCPU;
 };
 
 class FitExpGaus : public FitModule {
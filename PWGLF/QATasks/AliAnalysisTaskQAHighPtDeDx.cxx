@@ -56,6 +56,7 @@
 #include <AliAODTrack.h> 
 #include <AliAODPid.h> 
 #include <AliAODMCHeader.h> 
+#include "AliDeDxTrackTable.h"
 
 // STL includes
 #include <iostream>
@@ -1092,7 +1093,11 @@ AliAODMCParticle* AliAnalysisTaskQAHighPtDeDx::FindPrimaryMotherAODV0(AliAODMCPa
 //__________________________________________________________________
 void AliAnalysisTaskQAHighPtDeDx::ProduceArrayTrksESD( AliESDEvent *ESDevent ){
 
-	const Int_t nESDTracks = ESDevent->GetNumberOfTracks();
+	// dE/dx variables and filter decisions of the tracks, shared with the
+	// other dE/dx wagons of the train
+	AliDeDxTrackTable* table = AliDeDxTrackTable::Instance();
+	table->Update(ESDevent);
+	const Int_t nESDTracks = table->GetNTracks();
 	//Int_t trackmult=0;
 
 
@@ -1101,16 +1106,13 @@ void AliAnalysisTaskQAHighPtDeDx::ProduceArrayTrksESD( AliESDEvent *ESDevent ){
 	//get multiplicity tpc only track cuts
 	for(Int_t iT = 0; iT < nESDTracks; iT++) {
 
-		AliESDtrack* esdTrack = ESDevent->GetTrack(iT);
-
-
-		if(TMath::Abs(esdTrack->Eta()) > fEtaCut)
+		if(TMath::Abs(table->GetEta(iT)) > fEtaCut)
 			continue;
 
 		//only golden track cuts
 		UInt_t selectDebug = 0;
 		if (fTrackFilterTPC) {
-			selectDebug = fTrackFilterTPC->IsSelected(esdTrack);
+			selectDebug = table->IsSelected(fTrackFilterTPC, iT);
 			if (!selectDebug) {
 				continue;
 			}
@@ -1124,55 +1126,40 @@ void AliAnalysisTaskQAHighPtDeDx::ProduceArrayTrksESD( AliESDEvent *ESDevent ){
 
 	for(Int_t iT = 0; iT < nESDTracks; iT++) {
 
-		AliESDtrack* esdTrack = ESDevent->GetTrack(iT);
-
-
-		if(TMath::Abs(esdTrack->Eta()) > fEtaCut)
+		if(TMath::Abs(table->GetEta(iT)) > fEtaCut)
 			continue;
 
 		//only golden track cuts
 		UInt_t selectDebug = 0;
 		if (fTrackFilterGolden) {
-			selectDebug = fTrackFilterGolden->IsSelected(esdTrack);
+			selectDebug = table->IsSelected(fTrackFilterGolden, iT);
 			if (!selectDebug) {
 				continue;
 			}
 		}
 
-		Short_t ncl     = esdTrack->GetTPCsignalN();
+		Short_t ncl     = table->GetTPCsignalN(iT);
 
 
 		if(ncl<70)
 			continue;
-		Double_t eta  = esdTrack->Eta();
-		Double_t phi  = esdTrack->Phi();
-		Double_t momentum = esdTrack->P();
-		Float_t  dedx    = esdTrack->GetTPCsignal();
+		Double_t eta  = table->GetEta(iT);
+		Double_t phi  = table->GetPhi(iT);
+		Double_t momentum = table->GetP(iT);
+		Float_t  dedx    = table->GetTPCsignal(iT);
 
-		if(!PhiCut(esdTrack->Pt(), phi, esdTrack->Charge(), magf, cutLow, cutHigh))
+		if(!PhiCut(table->GetPt(iT), phi, table->GetCharge(iT), magf, cutLow, cutHigh))
 			continue;
 
 
 		//TOF
-
-		Bool_t IsTOFout=kFALSE;
-		if ((esdTrack->GetStatus()&AliESDtrack::kTOFout)==0)
-			IsTOFout=kTRUE;
-		Float_t lengthtrack=esdTrack->GetIntegratedLength();
-		Float_t timeTOF=esdTrack->GetTOFsignal();
-		Double_t inttime[5]={0,0,0,0,0}; 
-		esdTrack->GetIntegratedTimes(inttime);// Returns the array with integrated times for each particle hypothesis
-		Float_t beta = -99;
-		if ( !IsTOFout ){
-			if ( ( lengthtrack != 0 ) && ( timeTOF != 0) )
-				beta = inttime[0] / timeTOF;
-		}
+		Float_t beta = table->GetTOFBeta(iT);
 
 		Short_t pidCode     = 0; 
 
 		if(fAnalysisMC) {
 
-			const Int_t label = TMath::Abs(esdTrack->GetLabel());
+			const Int_t label = TMath::Abs(table->GetLabel(iT));
 			TParticle* mcTrack = fMCStack->Particle(label);	    
 			if (mcTrack){
 
@@ -1208,8 +1195,8 @@ void AliAnalysisTaskQAHighPtDeDx::ProduceArrayTrksESD( AliESDEvent *ESDevent ){
 
 
 			if(fAnalysisMC){
-				hMcOut[0][nh]->Fill(esdTrack->Pt());
-				hMcOut[pidCode][nh]->Fill(esdTrack->Pt());
+				hMcOut[0][nh]->Fill(table->GetPt(iT));
+				hMcOut[pidCode][nh]->Fill(table->GetPt(iT));
 			}
 
 			histAllCh[nh]->Fill(momentum, dedx);
@@ -1257,6 +1244,9 @@ void AliAnalysisTaskQAHighPtDeDx::ProduceArrayTrksESD( AliESDEvent *ESDevent ){
 void AliAnalysisTaskQAHighPtDeDx::ProduceArrayTrksAOD( AliAODEvent *AODevent ){
 
 
+	// dE/dx variables of the tracks, shared with the other dE/dx wagons of the train
+	AliDeDxTrackTable* table = AliDeDxTrackTable::Instance();
+	table->Update(AODevent);
 	Int_t nAODTracks = AODevent->GetNumberOfTracks();
 	Int_t multTPC = 0;
 
@@ -1307,39 +1297,13 @@ void AliAnalysisTaskQAHighPtDeDx::ProduceArrayTrksAOD( AliAODEvent *AODevent ){
 
 
 
-		AliAODPid* aodPid = aodTrack->GetDetPid();
-		Short_t ncl     = -10;
-		Float_t dedx    = -10;
+		// TPC and TOF signals from AliAODPid, -10 and -99 without it;
+		// in aod we do not have the track length, beta is inttime/timeTOF
+		Short_t ncl     = table->GetTPCsignalN(iT);
+		Float_t dedx    = table->GetTPCsignal(iT);
 
 		//TOF    
-		Float_t beta = -99;
-
-
-		if(aodPid) {
-			ncl     = aodPid->GetTPCsignalN();
-			dedx    = aodPid->GetTPCsignal();
-			//TOF
-			Bool_t IsTOFout=kFALSE;
-			Float_t lengthtrack=-999;//in aod we do not have that information, beta must be: beta=inttime/timeTOF 
-			Float_t timeTOF=-999;
-
-			if ((aodTrack->GetStatus()&AliESDtrack::kTOFout)==0)
-				IsTOFout=kTRUE;
-
-			lengthtrack=-999;//in aod we do not have that information, beta must be: beta=inttime/timeTOF 
-
-			timeTOF=aodPid->GetTOFsignal();
-
-			Double_t inttime[5]={0,0,0,0,0}; 
-			aodPid->GetIntegratedTimes(inttime);// Returns the array with integrated times for each particle hypothesis
-
-
-			if ( !IsTOFout ){
-				if ( ( lengthtrack != 0 ) && ( timeTOF != 0) )
-					beta = inttime[0] / timeTOF;
-			}
-
-		}
+		Float_t beta = table->GetTOFBeta(iT);
 
 
 		if(ncl<70)
@@ -27,7 +27,9 @@ AliRsnCutSet::AliRsnCutSet() :
    fIsScheme(kFALSE),
    fExpression(0),
    fMonitors(),
-   fUseMonitor(kFALSE)
+   fUseMonitor(kFALSE),
+   fTruthTableCuts(-1),
+   fTruthTable()
 {
 //
 // Constructor without name (not recommended)
@@ -48,7 +50,9 @@ AliRsnCutSet::AliRsnCutSet(const char *name, RSNTARGET target) :
    fIsScheme(kFALSE),
    fExpression(0),
    fMonitors(),
-   fUseMonitor(kFALSE)
+   fUseMonitor(kFALSE),
+   fTruthTableCuts(-1),
+   fTruthTable()
 {
 //
 // Constructor with argument name (recommended)
@@ -70,7 +74,9 @@ AliRsnCutSet::AliRsnCutSet(const AliRsnCutSet &copy) :
    fIsScheme(copy.fIsScheme),
    fExpression(copy.fExpression),
    fMonitors(copy.fMonitors),
-   fUseMonitor(copy.fUseMonitor)
+   fUseMonitor(copy.fUseMonitor),
+   fTruthTableCuts(-1),
+   fTruthTable()
 {
 //
 // Copy constructor
@@ -104,6 +110,7 @@ AliRsnCutSet &AliRsnCutSet::operator=(const AliRsnCutSet &copy)
    fExpression = copy.fExpression;
    fMonitors = copy.fMonitors;
    fUseMonitor = copy.fUseMonitor;
+   fTruthTableCuts = -1;
 
    if (fBoolValues) delete [] fBoolValues;
 
@@ -151,6 +158,7 @@ void AliRsnCutSet::AddCut(AliRsnCut *cut)
    AliInfo(Form("====> Adding a new cut: [%s]", cut->GetName()));
    //cut->Print();
    fNumOfCuts++;
+   fTruthTableCuts = -1;
 
    if (fBoolValues) delete [] fBoolValues;
 
@@ -224,6 +232,7 @@ void AliRsnCutSet::SetCutScheme(const char *theValue)
    fCutScheme = theValue;
    SetCutSchemeIndexed(theValue);
    fIsScheme = kTRUE;
+   fTruthTableCuts = -1;
    AliDebug(AliLog::kDebug, "->");
 }
 
@@ -275,9 +284,44 @@ Bool_t AliRsnCutSet::Passed()
 
    if (fCuts.IsEmpty()) return kTRUE;
 
+   // with few cuts, look up the result of this combination of cut results
+   // instead of walking the expression tree
+   if (fNumOfCuts <= kMaxTruthTableCuts) {
+      if (fTruthTableCuts != fNumOfCuts) MakeTruthTable();
+      Int_t i, index = 0;
+      for (i = 0; i < fNumOfCuts; i++) if (fBoolValues[i]) index |= (1 << i);
+      return fTruthTable[index];
+   }
+
    return fExpression->Value(*GetCuts());
 }
 
+//_____________________________________________________________________________
+void AliRsnCutSet::MakeTruthTable()
+{
+//
+// Evaluate the expression once for each combination of the cut results,
+// bit i of the table index being the result of cut i.
+// The expression only combines the cut results with logical operators,
+// so the table gives the same answer as the expression.
+//
+
+   Int_t i, index, n = 1 << fNumOfCuts;
+   Bool_t *saved = new Bool_t[fNumOfCuts];
+   for (i = 0; i < fNumOfCuts; i++) saved[i] = fBoolValues[i];
+
+   AliRsnExpression::fgCutSet = this;
+   fTruthTable.Set(n);
+   for (index = 0; index < n; index++) {
+      for (i = 0; i < fNumOfCuts; i++) fBoolValues[i] = ((index >> i) & 1);
+      fTruthTable[index] = fExpression->Value(*GetCuts());
+   }
+
+   for (i = 0; i < fNumOfCuts; i++) fBoolValues[i] = saved[i];
+   delete [] saved;
+   fTruthTableCuts = fNumOfCuts;
+}
+
 //_____________________________________________________________________________
 Bool_t AliRsnCutSet::IsValidScheme()
 {
@@ -14,6 +14,7 @@
 
 #include <TNamed.h>
 #include <TObjArray.h>
+#include <TArrayC.h>
 
 #include "AliRsnTarget.h"
 #include "AliRsnListOutput.h"
@@ -64,6 +65,9 @@ public:
 
 private:
 
+   enum { kMaxTruthTableCuts = 12 };     // max number of cuts for which the scheme is tabulated
+   void      MakeTruthTable();
+
    TObjArray         fCuts;                  // array of cuts
    Int_t             fNumOfCuts;             // number of cuts
    TString           fCutScheme;             // cut scheme
@@ -75,8 +79,10 @@ private:
    AliRsnExpression *fExpression;            // pointer to AliRsnExpression
    TObjArray         fMonitors;              // array of monitor object
    Bool_t            fUseMonitor;            // flag if monitoring should be used
+   Int_t             fTruthTableCuts;        //! number of cuts of fTruthTable, -1 if not made
+   TArrayC           fTruthTable;            //! result of the scheme for all 2^fNumOfCuts combinations of cut results
 
-   ClassDef(AliRsnCutSet, 3)   // ROOT dictionary
+   ClassDef(AliRsnCutSet, 4)   // ROOT dictionary
 };
 
 #endif
@@ -14,11 +14,16 @@
 //
 
 #include <Riostream.h>
+#include <vector>
+#include <map>
+#include <algorithm>
 
 #include <TH1.h>
 #include <TList.h>
 #include <TTree.h>
 #include <TStopwatch.h>
+#include <TFile.h>
+#include <TSystem.h>
 #include "TRandom.h"
 
 #include "AliLog.h"
@@ -44,6 +49,16 @@
 
 #include "AliRsnMiniAnalysisTask.h"
 
+namespace {
+   // "|i1|i2|...|" representation of a list of matched events, for debug messages
+   TString MatchList(const std::vector<Int_t> &matched)
+   {
+      TString out("|");
+      for (UInt_t i = 0; i < matched.size(); i++) out += Form("%d|", matched[i]);
+      return out;
+   }
+}
+
 
 ClassImp(AliRsnMiniAnalysisTask)
 
@@ -78,6 +93,8 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask() :
    fTrackCuts(0),
    fRsnEvent(),
    fEvBuffer(0x0),
+   fEvBufferFileName(),
+   fEvBufferFile(0x0),
    fTriggerAna(0x0),
    fESDtrackCuts(0x0),
    fMiniEvent(0x0),
@@ -130,6 +147,8 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const char *name, Bool_t useMC) :
    fTrackCuts(0),
    fRsnEvent(),
    fEvBuffer(0x0),
+   fEvBufferFileName(),
+   fEvBufferFile(0x0),
    fTriggerAna(0x0),
    fESDtrackCuts(0x0),
    fMiniEvent(0x0),
@@ -187,6 +206,8 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const AliRsnMiniAnalysisTask &cop
    fTrackCuts(copy.fTrackCuts),
    fRsnEvent(),
    fEvBuffer(0x0),
+   fEvBufferFileName(copy.fEvBufferFileName),
+   fEvBufferFile(0x0),
    fTriggerAna(copy.fTriggerAna),
    fESDtrackCuts(copy.fESDtrackCuts),
    fMiniEvent(0x0),
@@ -250,6 +271,7 @@ AliRsnMiniAnalysisTask &AliRsnMiniAnalysisTask::operator=(const AliRsnMiniAnalys
    fTriggerAna = copy.fTriggerAna;
    fESDtrackCuts = copy.fESDtrackCuts;
    fBigOutput = copy.fBigOutput;
+   fEvBufferFileName = copy.fEvBufferFileName;
    fMixPrintRefresh = copy.fMixPrintRefresh;
    fMaxNDaughters = copy.fMaxNDaughters;
    fCheckP = copy.fCheckP;
@@ -276,7 +298,7 @@ AliRsnMiniAnalysisTask::~AliRsnMiniAnalysisTask()
 
    if (fOutput && !AliAnalysisManager::GetAnalysisManager()->IsProofMode()) {
       delete fOutput;
-      delete fEvBuffer;
+      DeleteEventBuffer();
    }
 }
 
@@ -374,8 +396,7 @@ void AliRsnMiniAnalysisTask::UserCreateOutputObjects()
 
    // create temporary tree for filtered events
    if (fMiniEvent) delete fMiniEvent;
-   fEvBuffer = new TTree("EventBuffer", "Temporary buffer for mini events");
-   fEvBuffer->Branch("events", "AliRsnMiniEvent", &fMiniEvent);
+   CreateEventBuffer();
 
    // create one histogram per each stored definition (event histograms)
    Int_t i, ndef = fHistograms.GetEntries();
@@ -522,22 +543,43 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    // if no mixing is required, stop here and post the output
    if (fNMix < 1) {
       AliDebugClass(2, "Stopping here, since no mixing is required");
+      if (fEvBufferFile) DeleteEventBuffer();
       PostData(1, fOutput);
       return;
    }
 
    // initialize mixing counter
-   Int_t    nmatched[nEvents];
-   TString *smatched = new TString[nEvents];
-   for (ievt = 0; ievt < nEvents; ievt++) {
-      smatched[ievt] = "|";
-      nmatched[ievt] = 0;
-   }
-
+   std::vector<Int_t> nmatched(nEvents, 0);
+   std::vector< std::vector<Int_t> > matched(nEvents);
 
    AliInfo(Form("[%s] Std.Event %d/%d",GetName(), nEvents,nEvents));
    timer.Stop(); timer.Print(); timer.Start(); fflush(stdout);
 
+   // read the mixing variables of all events once, rather than the
+   // full event for each tested pair of events
+   std::vector<Float_t> vz(nEvents), mult(nEvents), angle(nEvents);
+   for (ievt = 0; ievt < nEvents; ievt++) {
+      fEvBuffer->GetEntry(ievt);
+      vz[ievt]    = fMiniEvent->Vz();
+      mult[ievt]  = fMiniEvent->Mult();
+      angle[ievt] = fMiniEvent->Angle();
+   }
+
+   // for binned mixing, only events in the same bin can match:
+   // list the events of each bin, in increasing order
+   typedef std::pair<Int_t, std::pair<Int_t, Int_t> > MixBin_t;
+   std::map< MixBin_t, std::vector<Int_t> > binEvents;
+   std::vector<const std::vector<Int_t>*> evBin(nEvents, (const std::vector<Int_t>*)0x0);
+   if (!fContinuousMix) {
+      for (ievt = 0; ievt < nEvents; ievt++) {
+         MixBin_t bin((Int_t)(vz[ievt] / fMaxDiffVz),
+                      std::make_pair((Int_t)(mult[ievt] / fMaxDiffMult), (Int_t)(angle[ievt] / fMaxDiffAngle)));
+         std::vector<Int_t> &events = binEvents[bin];
+         events.push_back(ievt);
+         evBin[ievt] = &events;
+      }
+   }
+
    // search for good matchings
    for (ievt = 0; ievt < nEvents; ievt++) {
       if (printNum&&(ievt%printNum==0)) {
@@ -545,47 +587,53 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
          timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
       }
       if (nmatched[ievt] >= fNMix) continue;
-      fEvBuffer->GetEntry(ievt);
-      AliRsnMiniEvent evMain(*fMiniEvent);
-      for (iloop = 1; iloop < nEvents; iloop++) {
-         imix = ievt + iloop;
-         if (imix >= nEvents) imix -= nEvents;
+      // candidates are tested in the order ievt+1, ..., nEvents-1, 0, ..., ievt-1;
+      // for binned mixing, only the events of the same bin in that order
+      const std::vector<Int_t> *candidates = evBin[ievt];
+      Int_t ncand = candidates ? (Int_t)candidates->size() : nEvents;
+      Int_t first = 0;
+      if (candidates)
+         first = std::upper_bound(candidates->begin(), candidates->end(), ievt) - candidates->begin();
+      for (iloop = 1; iloop < ncand; iloop++) {
+         if (candidates) {
+            imix = (*candidates)[(first + iloop - 1) % ncand];
+         } else {
+            imix = ievt + iloop;
+            if (imix >= nEvents) imix -= nEvents;
+            // skip if events are not matched
+            if (TMath::Abs(vz[ievt]    - vz[imix]   ) > fMaxDiffVz   ) continue;
+            if (TMath::Abs(mult[ievt]  - mult[imix] ) > fMaxDiffMult ) continue;
+            if (TMath::Abs(angle[ievt] - angle[imix]) > fMaxDiffAngle) continue;
+         }
          if (imix == ievt) continue;
-         // text next entry
-         fEvBuffer->GetEntry(imix);
-         // skip if events are not matched
-         if (!EventsMatch(&evMain, fMiniEvent)) continue;
-         // check that the array of good matches for mixed does not already contain main event
-         if (smatched[imix].Contains(Form("|%d|", ievt))) continue;
          // check that the found good events has not enough matches already
          if (nmatched[imix] >= fNMix) continue;
+         // check that the array of good matches for mixed does not already contain main event
+         if (std::find(matched[imix].begin(), matched[imix].end(), ievt) != matched[imix].end()) continue;
          // add new mixing candidate
-         smatched[ievt].Append(Form("%d|", imix));
+         matched[ievt].push_back(imix);
          nmatched[ievt]++;
          nmatched[imix]++;
          if (nmatched[ievt] >= fNMix) break;
       }
-      AliDebugClass(1, Form("Matches for event %5d = %d [%s] (missing are declared above)", evMain.ID(), nmatched[ievt], smatched[ievt].Data()));
+      AliDebugClass(1, Form("Matches for event %5d = %d [%s] (missing are declared above)", ievt, nmatched[ievt], MatchList(matched[ievt]).Data()));
    }
 
    AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout); timer.Start();
 
    // perform mixing
-   TObjArray *list = 0x0;
-   TObjString *os = 0x0;
    for (ievt = 0; ievt < nEvents; ievt++) {
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] EventMixing %d/%d",GetName(),ievt,nEvents));
          timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
       }
       ifill = 0;
+      if (matched[ievt].empty()) continue;
       fEvBuffer->GetEntry(ievt);
       AliRsnMiniEvent evMain(*fMiniEvent);
-      list = smatched[ievt].Tokenize("|");
-      TObjArrayIter next(list);
-      while ( (os = (TObjString *)next()) ) {
-         imix = os->GetString().Atoi();
+      for (UInt_t im = 0; im < matched[ievt].size(); im++) {
+         imix = matched[ievt][im];
          fEvBuffer->GetEntry(imix);
          for (idef = 0; idef < nDefs; idef++) {
             def = (AliRsnMiniOutput *)fHistograms[idef];
@@ -598,11 +646,8 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
             }
          }
       }
-      delete list;
    }
 
-   delete [] smatched;
-
    AliInfo(Form("[%s] EventMixing %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout);
 
@@ -639,10 +684,62 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    }
    */
 
+   if (fEvBufferFile) DeleteEventBuffer();
+
    // post computed data
    PostData(1, fOutput);
 }
 
+//__________________________________________________________________________________________________
+void AliRsnMiniAnalysisTask::CreateEventBuffer()
+{
+//
+// Create the temporary tree where the mini-events are stored for the mixing.
+// By default it is kept in the current directory, i.e. in memory (or in the output file
+// with UseBigOutput()). With UseEventBufferFile() it is written to an uncompressed
+// temporary file instead, so that the memory used is bounded by the tree baskets
+// and reading back the events in FinishTaskOutput() does not need to decompress them.
+//
+
+   TDirectory *savedir = gDirectory;
+   if (!fEvBufferFileName.IsNull()) {
+      TString fileName(Form("%s_%s_%d.root", fEvBufferFileName.Data(), GetName(), gSystem->GetPid()));
+      fEvBufferFile = TFile::Open(fileName.Data(), "RECREATE", "Temporary buffer for mini events", 0);
+      if (!fEvBufferFile || fEvBufferFile->IsZombie()) {
+         AliError(Form("Cannot open temporary file '%s', keeping the mini-event buffer in memory", fileName.Data()));
+         delete fEvBufferFile;
+         fEvBufferFile = 0x0;
+      } else {
+         AliInfo(Form("Mini-event buffer kept in '%s'", fileName.Data()));
+      }
+   }
+
+   fEvBuffer = new TTree("EventBuffer", "Temporary buffer for mini events");
+   fEvBuffer->Branch("events", "AliRsnMiniEvent", &fMiniEvent);
+   if (savedir) savedir->cd();
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniAnalysisTask::DeleteEventBuffer()
+{
+//
+// Delete the temporary tree of mini-events, and its file if any.
+//
+
+   if (!fEvBufferFile) {
+      delete fEvBuffer;
+      fEvBuffer = 0x0;
+      return;
+   }
+
+   TString fileName(fEvBufferFile->GetName());
+   fEvBufferFile->Close(); // also deletes the tree
+   delete fEvBufferFile;
+   fEvBufferFile = 0x0;
+   fEvBuffer = 0x0;
+   gSystem->Unlink(fileName.Data());
+}
+
 //__________________________________________________________________________________________________
 void AliRsnMiniAnalysisTask::Terminate(Option_t *)
 {
@@ -24,6 +24,7 @@
 #include "AliRsnCutPrimaryVertex.h"
 
 class TList;
+class TFile;
 
 class AliTriggerAnalysis;
 class AliRsnMiniEvent;
@@ -69,6 +70,7 @@ public:
    Short_t             GetMaxNDaughters()                 {return fMaxNDaughters;}
    void                SetEventQAHist(TString type,TH2F *histo);
    void                UseBigOutput(Bool_t b=kTRUE) { fBigOutput = b; }
+   void                UseEventBufferFile(const char *name = "RsnEventBuffer") { fEvBufferFileName = name; }
 
    virtual void        UserCreateOutputObjects();
    virtual void        UserExec(Option_t *);
@@ -95,6 +97,8 @@ private:
    void     FillTrueMotherAOD(AliRsnMiniEvent *event);
    void     StoreTrueMother(AliRsnMiniPair *pair, AliRsnMiniEvent *event);
    Bool_t   EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2);
+   void     CreateEventBuffer();
+   void     DeleteEventBuffer();
 
    Bool_t               fUseMC;           //  use or not MC info
    Int_t                fEvNum;           //! absolute event counter
@@ -127,6 +131,8 @@ private:
    TObjArray            fTrackCuts;       //  list of single track cuts
    AliRsnEvent          fRsnEvent;        //! interface object to the event
    TTree               *fEvBuffer;        //! mini-event buffer
+   TString              fEvBufferFileName; //  if not empty, keep the mini-event buffer in a temporary file with this name
+   TFile               *fEvBufferFile;    //! temporary file of the mini-event buffer
    AliTriggerAnalysis  *fTriggerAna;      //! trigger analysis
    AliESDtrackCuts     *fESDtrackCuts;    //! quality cut for ESD tracks
    AliRsnMiniEvent     *fMiniEvent;       //! mini-event cursor
@@ -144,7 +150,7 @@ private:
    Float_t              fMotherAcceptanceCutMaxEta;             // cut value to apply when selecting the mothers inside a defined acceptance
    Bool_t               fKeepMotherInAcceptance;                // flag to keep also mothers in acceptance
 
-   ClassDef(AliRsnMiniAnalysisTask, 12);   // AliRsnMiniAnalysisTask
+   ClassDef(AliRsnMiniAnalysisTask, 13);   // AliRsnMiniAnalysisTask
 };
 
 
@@ -59,6 +59,7 @@ Remiders:
 #include <AliAODTrack.h> 
 #include <AliAODPid.h> 
 #include <AliAODMCHeader.h> 
+#include "AliDeDxTrackTable.h"
 #include <iostream>
 
  
@@ -1329,6 +1330,10 @@ void AliAnalysisTaskHighPtDeDx::Sort(TClonesArray* array, Bool_t isMC)
 void AliAnalysisTaskHighPtDeDx::ProduceArrayTrksESD( AliESDEvent *ESDevent, AnalysisMode analysisMode ){
   
   const Int_t nESDTracks = ESDevent->GetNumberOfTracks();
+  // dE/dx variables and filter decisions of the tracks, shared with the
+  // other dE/dx wagons of the train (the QA task)
+  AliDeDxTrackTable* table = AliDeDxTrackTable::Instance();
+  table->Update(ESDevent);
   Int_t trackmult=0;
 
 
@@ -1378,14 +1383,14 @@ void AliAnalysisTaskHighPtDeDx::ProduceArrayTrksESD( AliESDEvent *ESDevent, Anal
       AliESDtrack* esdTrack = ESDevent->GetTrack(iT);
       
       
-      if(TMath::Abs(esdTrack->Eta()) > fEtaCut)
+      if(TMath::Abs(table->GetEta(iT)) > fEtaCut)
 	continue;
       
       UShort_t filterFlag = 0;
       
       UInt_t selectDebug = 0;
       if (fTrackFilterGolden) {
-	selectDebug = fTrackFilterGolden->IsSelected(esdTrack);
+	selectDebug = table->IsSelected(fTrackFilterGolden, iT);
 	if (selectDebug) {
 	  filterFlag +=1;
 	}
@@ -1393,7 +1398,7 @@ void AliAnalysisTaskHighPtDeDx::ProduceArrayTrksESD( AliESDEvent *ESDevent, Anal
       
       if (fTrackFilterTPC) {
 	
-	selectDebug = fTrackFilterTPC->IsSelected(esdTrack);
+	selectDebug = table->IsSelected(fTrackFilterTPC, iT);
 	if (selectDebug){//only tracks which pass the TPC-only track cuts
 	  filterFlag +=2;
 	  
@@ -1402,7 +1407,7 @@ void AliAnalysisTaskHighPtDeDx::ProduceArrayTrksESD( AliESDEvent *ESDevent, Anal
       }
       
       if (fTrackFilter) {
-	selectDebug = fTrackFilter->IsSelected(esdTrack);
+	selectDebug = table->IsSelected(fTrackFilter, iT);
 	if (selectDebug) {
 	  filterFlag +=4;
 	}
@@ -1421,7 +1426,7 @@ void AliAnalysisTaskHighPtDeDx::ProduceArrayTrksESD( AliESDEvent *ESDevent, Anal
       
       // Here we want to add histograms!
       
-      if (esdTrack->Pt() < fMinPt) {
+      if (table->GetPt(iT) < fMinPt) {
 	
 	// Keep small fraction of low pT tracks
 	if(fRandom->Rndm() > fLowPtFraction)
@@ -1430,15 +1435,15 @@ void AliAnalysisTaskHighPtDeDx::ProduceArrayTrksESD( AliESDEvent *ESDevent, Anal
       // Here we want to add the high pt part of the histograms!
       //    }
     
-      Short_t charge  = esdTrack->Charge();
-      Float_t pt      = esdTrack->Pt();
-      Float_t p       = esdTrack->P(); 
-      Float_t eta     = esdTrack->Eta();
-      Float_t phi     = esdTrack->Phi();
-      Short_t ncl     = esdTrack->GetTPCsignalN();
+      Short_t charge  = table->GetCharge(iT);
+      Float_t pt      = table->GetPt(iT);
+      Float_t p       = table->GetP(iT); 
+      Float_t eta     = table->GetEta(iT);
+      Float_t phi     = table->GetPhi(iT);
+      Short_t ncl     = table->GetTPCsignalN(iT);
       Short_t neff    = Short_t(esdTrack->GetTPCClusterInfo(2, 1)); // effective track length for pT res
       //	  Short_t nclf    = esdTrack->GetTPCNclsF();
-      Float_t dedx    = esdTrack->GetTPCsignal();
+      Float_t dedx    = table->GetTPCsignal(iT);
       // Float_t tpcchi  = 0;
       // if(esdTrack->GetTPCNcls() > 0)
       // 	tpcchi = esdTrack->GetTPCchi2()/Float_t(esdTrack->GetTPCNcls());
@@ -91,7 +91,9 @@ AliTransverseEventShape::AliTransverseEventShape():TObject(),
 	fhptSoMC(0),
 	fhetaStMC(0),
 	fhphiStMC(0),
-	fhptStMC(0)
+	fhptStMC(0),
+	fExactSpherocityESA(kFALSE),
+	fEventShape()
 
 {
 	// Default contructor
@@ -132,7 +134,9 @@ AliTransverseEventShape::AliTransverseEventShape(const AliTransverseEventShape &
 	fhptSoMC(0),
 	fhetaStMC(0),
 	fhphiStMC(0),
-	fhptStMC(0)
+	fhptStMC(0),
+	fExactSpherocityESA(kFALSE),
+	fEventShape()
 
 {
 	//
@@ -458,6 +462,21 @@ Float_t AliTransverseEventShape::AnalyseGetSpherocity( Bool_t fillHist, const ve
 
 	}
 
+	if(fExactSpherocityESA){
+		fEventShape.Reset();
+		for(Int_t i1 = 0; i1 < fNrec; ++i1)
+			fEventShape.AddParticle( pt[i1], phi[i1] );
+		return fEventShape.GetSpherocity();
+	}
+
+	//transverse momenta, computed once for all the axes
+	vector<Float_t> pxA( fNrec );
+	vector<Float_t> pyA( fNrec );
+	for(Int_t i1 = 0; i1 < fNrec; ++i1){
+		pxA[i1] = pt[i1] * TMath::Cos( phi[i1] );
+		pyA[i1] = pt[i1] * TMath::Sin( phi[i1] );
+	}
+
 	//Getting thrust
 	for(Int_t i = 0; i < 360/(fSizeStepESA); ++i){
 		Float_t numerador = 0;
@@ -469,10 +488,7 @@ Float_t AliTransverseEventShape::AnalyseGetSpherocity( Bool_t fillHist, const ve
 		ny = TMath::Sin(phiparam);            // y component of an unitary vector n
 		for(Int_t i1 = 0; i1 < fNrec; ++i1){
 
-			Float_t pxA = pt[i1] * TMath::Cos( phi[i1] );
-			Float_t pyA = pt[i1] * TMath::Sin( phi[i1] );
-
-			numerador += TMath::Abs( ny * pxA - nx * pyA );//product between p  proyection in XY plane and the unitary vector
+			numerador += TMath::Abs( ny * pxA[i1] - nx * pyA[i1] );//product between p  proyection in XY plane and the unitary vector
 		}
 		pFull=TMath::Power( (numerador / sumapt),2 );
 		if(pFull < Spherocity)//maximization of pFull
@@ -14,6 +14,7 @@
 
 #include <AliAnalysisFilter.h>
 #include <vector>
+#include "AliEventShapeCalculator.h"
 
 class AliVEvent;
 class AliVVertex;
@@ -50,6 +51,7 @@ class AliTransverseEventShape : public TObject {
   void  SetTrackEtaMaxESA(Float_t etamaxF) {fEtaMaxCutESA = etamaxF;}
   void  SetTrackPtMinESA(Float_t ptminF)   {fPtMinCutESA = ptminF;}
   void  SetTrackPtMaxESA(Float_t ptmaxF)   {fPtMaxCutESA = ptmaxF;}
+  void  SetExactSpherocityESA(Bool_t exact) {fExactSpherocityESA = exact;} // exact minimum instead of the scan in steps of fSizeStepESA
   
   void SaveHistosSo(const char* folder = 0 );
   void SaveHistosSt(const char* folder = 0 );  
@@ -116,9 +118,10 @@ class AliTransverseEventShape : public TObject {
   TH1D    *fhetaStMC;
   TH1D    *fhphiStMC;
   TH1D    *fhptStMC;
+  Bool_t  fExactSpherocityESA;
+  AliEventShapeCalculator fEventShape; //! particles of the event for the exact spherocity
 
-
-  ClassDef(AliTransverseEventShape,2) // base helper class
+  ClassDef(AliTransverseEventShape,3) // base helper class
 };
 #endif
 
@@ -329,15 +329,18 @@ Int_t AliAnalysisEtReconstructed::AnalyseEvent(AliVEvent* ev)
         TVector3 cp(pos);
 	fClusterPositionAll->Fill(cp.Phi(), cp.PseudoRapidity());
 	Float_t fReconstructedE = cluster->E();
+	// the nominal correction and sin(theta) of the cluster are used by all the Et sums below, compute them once
+	const Double_t corrMod = GetCorrectionModification(*cluster,0,0,cent);
+	const Double_t sinTheta = TMath::Sin(cp.Theta());
 	Float_t lostEnergy = 0.0;
 	Float_t lostTrackPt = 0.0;
-	fClusterPositionAllEnergy->Fill(cp.Phi(), cp.PseudoRapidity(),GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE);
+	fClusterPositionAllEnergy->Fill(cp.Phi(), cp.PseudoRapidity(),corrMod*fReconstructedE);
 
 	//if(TMath::Abs(cp.Eta())> fCuts->fCuts->GetGeometryEmcalEtaAccCut() || cp.Phi() >  fCuts->GetGeometryEmcalPhiAccMaxCut()*TMath::Pi()/180. ||  cp.Phi() >  fCuts->GetGeometryEmcalPhiAccMinCut()*TMath::Pi()/180.) continue;//Do not accept if cluster is not in the acceptance
-	fTotAllRawEt += TMath::Sin(cp.Theta())*GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE;
-	fTotAllRawEtEffCorr +=GetCorrectionModification(*cluster,0,0,cent)* CorrectForReconstructionEfficiency(*cluster,cent);
+	fTotAllRawEt += sinTheta*corrMod*fReconstructedE;
+	fTotAllRawEtEffCorr +=corrMod* CorrectForReconstructionEfficiency(*cluster,cent);
 
-	fClusterEnergyCent->Fill(GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE,cent);
+	fClusterEnergyCent->Fill(corrMod*fReconstructedE,cent);
         Bool_t matched = kTRUE;//default to no track matched
 	Bool_t countasmatched = kFALSE;
 	Bool_t correctedcluster = kFALSE;
@@ -351,9 +354,9 @@ Int_t AliAnalysisEtReconstructed::AnalyseEvent(AliVEvent* ev)
 	    //if this is a good track, accept track will return true.  The track matched is good, so not track matched is false
 	    matched = fEsdtrackCutsTPC->AcceptTrack(track);//If the track is bad, don't count it
 	    if(matched){//if it is still matched see if the track p was less than the energy
-	      Float_t rcorr = TMath::Sin(cp.Theta())*GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE;
+	      Float_t rcorr = sinTheta*corrMod*fReconstructedE;
 	      fHistRecoRCorrVsPtVsCent->Fill(rcorr,track->Pt(), fCentClass);
-	      if(fSelector->PassMinEnergyCut( (fReconstructedE - fsub* track->P())*TMath::Sin(cp.Theta()) )  ){//if more energy was deposited than the momentum of the track  and more than one particle led to the cluster
+	      if(fSelector->PassMinEnergyCut( (fReconstructedE - fsub* track->P())*sinTheta )  ){//if more energy was deposited than the momentum of the track  and more than one particle led to the cluster
 		// 	      if(fReconstructedE - fsub* track->P() > 0.0){
 		//cout<<"match corrected"<<endl;
 		fReconstructedE = fReconstructedE - fsub* track->P();
@@ -362,7 +365,7 @@ Int_t AliAnalysisEtReconstructed::AnalyseEvent(AliVEvent* ev)
 		correctedcluster = kTRUE;
 		lostEnergy = fsub* track->P();
 		lostTrackPt = track->Pt();
-		fClusterEnergyModifiedTrackMatchesCent->Fill(GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE,cent);
+		fClusterEnergyModifiedTrackMatchesCent->Fill(corrMod*fReconstructedE,cent);
 	      }
 // 	      else{
 // 		    cerr<<"match passed ";
@@ -386,7 +389,7 @@ Int_t AliAnalysisEtReconstructed::AnalyseEvent(AliVEvent* ev)
                 }
                 else {
 		  totalMatchedPt +=track->Pt();
-		  fClusterEnergyCentMatched->Fill(GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE,cent);
+		  fClusterEnergyCentMatched->Fill(corrMod*fReconstructedE,cent);
 		  fHistMatchedClusterSizeVsCent->Fill(cluster->GetNCells(),cent);
 
 		  float eff = fTmCorrections->TrackMatchingEfficiency(track->Pt(),cent);
@@ -394,39 +397,37 @@ Int_t AliAnalysisEtReconstructed::AnalyseEvent(AliVEvent* ev)
 		  //cout<<"pt "<<track->Pt()<<" eff "<<eff<<" total "<<nChargedHadronsTotal<<endl;
 		  nChargedHadronsMeasured++;
 		  nChargedHadronsTotal += 1/eff;
-		  Double_t effCorrEt = GetCorrectionModification(*cluster,0,0,cent) * CorrectForReconstructionEfficiency(*cluster,fReconstructedE,cent);
-		  nChargedHadronsEtMeasured+= TMath::Sin(cp.Theta())*GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE;
+		  Double_t effCorrEt = corrMod * CorrectForReconstructionEfficiency(*cluster,fReconstructedE,cent);
+		  nChargedHadronsEtMeasured+= sinTheta*corrMod*fReconstructedE;
 		  //One efficiency is the gamma efficiency and the other is the track matching efficiency.
-		  nChargedHadronsEtTotal+= 1/eff *TMath::Sin(cp.Theta())*GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE;
-		  //cout<<"nFound "<<1<<" nFoundTotal "<<1/eff<<" etMeas "<<TMath::Sin(cp.Theta())*fReconstructedE<<" ET total "<< 1/eff *TMath::Sin(cp.Theta())*fReconstructedE<<endl;
+		  nChargedHadronsEtTotal+= 1/eff *sinTheta*corrMod*fReconstructedE;
+		  //cout<<"nFound "<<1<<" nFoundTotal "<<1/eff<<" etMeas "<<sinTheta*fReconstructedE<<" ET total "<< 1/eff *sinTheta*fReconstructedE<<endl;
 
 		  Float_t nSigmaPion = fPIDResponse->NumberOfSigmasTPC(track, AliPID::kPion); 
 		  Float_t nSigmaProton = fPIDResponse->NumberOfSigmasTPC(track, AliPID::kProton); 
 		  bool isProton = (nSigmaPion>3.0 && nSigmaProton<3.0 && track->Pt()<0.9);
 		  //cout<<"NSigmaProton "<<nSigmaProton<<endl;
 		  etPiKPMatched += effCorrEt;
-		  etPiKPMatchedNoEff  +=TMath::Sin(cp.Theta())*GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE;
+		  etPiKPMatchedNoEff  +=sinTheta*corrMod*fReconstructedE;
 		  if(isProton){
 		    if(track->Charge()>0){
 		      etPIDProtons += effCorrEt;
-		      etPIDProtonsNoEff +=TMath::Sin(cp.Theta())*GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE;
+		      etPIDProtonsNoEff +=sinTheta*corrMod*fReconstructedE;
 		    }
 		    else{
-		      etPIDAntiProtonsNoEff +=TMath::Sin(cp.Theta())*GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE;
+		      etPIDAntiProtonsNoEff +=sinTheta*corrMod*fReconstructedE;
 		      etPIDAntiProtons += effCorrEt;
 		    }
 		  }
-		  if(TMath::Sin(cp.Theta())*GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE>0.5){
+		  if(sinTheta*corrMod*fReconstructedE>0.5){
 		    nChargedHadronsMeasured500MeV++;
 		    nChargedHadronsTotal500MeV += 1/eff;
-		    nChargedHadronsEtMeasured500MeV+= TMath::Sin(cp.Theta())*GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE;
-		    nChargedHadronsEtTotal500MeV+= 1/eff *TMath::Sin(cp.Theta())*GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE;
+		    nChargedHadronsEtMeasured500MeV+= sinTheta*corrMod*fReconstructedE;
+		    nChargedHadronsEtTotal500MeV+= 1/eff *sinTheta*corrMod*fReconstructedE;
 		  }
-		  cluster->GetPosition(pos);	  
-		  TVector3 p2(pos);
-		  uncorrEt += TMath::Sin(p2.Theta())*GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE;
+		  uncorrEt += sinTheta*corrMod*fReconstructedE;
 		  if(correctedcluster || fReconstructedE <fsubmeanhade* track->P() ){//if more energy was deposited than the momentum of the track  and more than one particle led to the cluster and the corrected energy is greater than zero
-		    fHistMatchedTracksEvspTvsCent->Fill(track->P(),TMath::Sin(cp.Theta())*GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE,cent);
+		    fHistMatchedTracksEvspTvsCent->Fill(track->P(),sinTheta*corrMod*fReconstructedE,cent);
 		    fHistMatchedTracksEvspTvsCentEffCorr->Fill(track->P(),effCorrEt,cent);
 		    //Weighed by the number of tracks we didn't find
 		    fHistMatchedTracksEvspTvsCentEffTMCorr->Fill(track->P(), effCorrEt,cent, (1/eff-1) );
@@ -434,7 +435,7 @@ Int_t AliAnalysisEtReconstructed::AnalyseEvent(AliVEvent* ev)
 		      for(int cbtest = 0; cbtest<20; cbtest++){//then we calculate the deposit matched to hadrons with different centrality bins' efficiencies
 			float efftest = fTmCorrections->TrackMatchingEfficiency(track->Pt(),cbtest);
 			if(TMath::Abs(efftest)<1e-5) efftest = 1.0;
-			Double_t effCorrEttest = GetCorrectionModification(*cluster,0,0,cent)*CorrectForReconstructionEfficiency(*cluster,fReconstructedE,cbtest);
+			Double_t effCorrEttest = corrMod*CorrectForReconstructionEfficiency(*cluster,fReconstructedE,cbtest);
 			fHistPeripheralMatchedTracksEvspTvsCentEffTMCorr->Fill(track->P(), effCorrEttest,cbtest, (1/efftest-1) );
 		      }
 		    }
@@ -457,7 +458,7 @@ Int_t AliAnalysisEtReconstructed::AnalyseEvent(AliVEvent* ev)
                         }
 		      if (fCuts->GetHistMakeTreeDeposit() && fDepositTree)
                         {
-			  fEnergyDeposited =GetCorrectionModification(*cluster,0,0,cent)* fReconstructedE;
+			  fEnergyDeposited =corrMod* fReconstructedE;
 			  fMomentumTPC = track->P();
 			  fCharge = track->Charge();
 			  fParticlePid = maxpid;
@@ -484,24 +485,24 @@ Int_t AliAnalysisEtReconstructed::AnalyseEvent(AliVEvent* ev)
 
                                 if (track->Charge() == 1)
                                 {
-                                    fHistProtonEnergyDeposit->Fill(GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE, track->E());
+                                    fHistProtonEnergyDeposit->Fill(corrMod*fReconstructedE, track->E());
                                 }
                                 else if (track->Charge() == -1)
                                 {
-                                    fHistAntiProtonEnergyDeposit->Fill(GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE, track->E());
+                                    fHistAntiProtonEnergyDeposit->Fill(corrMod*fReconstructedE, track->E());
                                 }
                             }
                             else if (maxpid == AliPID::kPion)
                             {
-                                fHistChargedPionEnergyDeposit->Fill(GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE, track->E());
+                                fHistChargedPionEnergyDeposit->Fill(corrMod*fReconstructedE, track->E());
                             }
                             else if (maxpid == AliPID::kKaon)
                             {
-                                fHistChargedKaonEnergyDeposit->Fill(GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE, track->E());
+                                fHistChargedKaonEnergyDeposit->Fill(corrMod*fReconstructedE, track->E());
                             }
                             else if (maxpid == AliPID::kMuon)
                             {
-                                fHistMuonEnergyDeposit->Fill(GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE, track->E());
+                                fHistMuonEnergyDeposit->Fill(corrMod*fReconstructedE, track->E());
                             }
                         }
                     }
@@ -525,22 +526,22 @@ Int_t AliAnalysisEtReconstructed::AnalyseEvent(AliVEvent* ev)
 	    nChargedHadronsMeasured++;
 	    nChargedHadronsTotal += 1/eff;
 	    //Double_t effCorrEt = CorrectForReconstructionEfficiency(*cluster,lostEnergy,cent);
-	    nChargedHadronsEtMeasured+= TMath::Sin(cp.Theta())*lostEnergy;
+	    nChargedHadronsEtMeasured+= sinTheta*lostEnergy;
 	    //One efficiency is the gamma efficiency and the other is the track matching efficiency.
-	    nChargedHadronsEtTotal+= 1/eff *TMath::Sin(cp.Theta())*lostEnergy;	      
+	    nChargedHadronsEtTotal+= 1/eff *sinTheta*lostEnergy;	      
 	  }
 	  fClusterPositionAccepted->Fill(p2.Phi(), p2.PseudoRapidity());
-	  fClusterPositionAcceptedEnergy->Fill(p2.Phi(), p2.PseudoRapidity(),GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE);
-	  fClusterEnergy->Fill(GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE);
-	  fClusterEnergyCentNotMatched->Fill(GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE,cent);
+	  fClusterPositionAcceptedEnergy->Fill(p2.Phi(), p2.PseudoRapidity(),corrMod*fReconstructedE);
+	  fClusterEnergy->Fill(corrMod*fReconstructedE);
+	  fClusterEnergyCentNotMatched->Fill(corrMod*fReconstructedE,cent);
 	  fHistClusterSizeVsCent->Fill(cluster->GetNCells(),cent);
-	  fClusterEt->Fill(TMath::Sin(p2.Theta())*GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE,cent);
-	  uncorrEt += TMath::Sin(p2.Theta())*GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE;
-	  float myuncorrEt = TMath::Sin(p2.Theta())*GetCorrectionModification(*cluster,0,0,cent)*fReconstructedE;
+	  fClusterEt->Fill(sinTheta*corrMod*fReconstructedE,cent);
+	  uncorrEt += sinTheta*corrMod*fReconstructedE;
+	  float myuncorrEt = sinTheta*corrMod*fReconstructedE;
 	  fTotRawEt += myuncorrEt;
 	  nUsedClusters++;
 	  
-	  Double_t effCorrEt = CorrectForReconstructionEfficiency(*cluster,fReconstructedE,cent)*GetCorrectionModification(*cluster,0,0,cent);
+	  Double_t effCorrEt = CorrectForReconstructionEfficiency(*cluster,fReconstructedE,cent)*corrMod;
 	  rawSignal += myuncorrEt;
 	  effCorrSignal +=effCorrEt;
 	  //cout<<"cluster energy "<<fReconstructedE<<" eff corr Et "<<effCorrEt<<endl;
@@ -48,6 +48,9 @@
 #include "TList.h"
 #include "TObjArray.h"
 #include "TFile.h"
+#include "TBranch.h"
+#include "TLeaf.h"
+#include "TObjString.h"
 #include "TMatrixD.h"
 #include "TRandom3.h"
 
@@ -114,6 +117,9 @@ ClassImp(AliAnalysisTaskFilteredTree)
   , fLowPtTrackDownscaligF(0)
   , fLowPtV0DownscaligF(0)
   , fFriendDownscaling(-3.)   
+  , fCompressionSettings(-1)
+  , fDisabledBranches("")
+  , fDisabledBranchesDone()
   , fProcessAll(kFALSE)
   , fProcessCosmics(kFALSE)
   , fProcessITSTPCmatchOut(kFALSE)  // swittch to process ITS/TPC standalone tracks
@@ -195,7 +201,9 @@ void AliAnalysisTaskFilteredTree::UserCreateOutputObjects()
 
   //
   //get the output file to make sure the trees will be associated to it
-  OpenFile(1);
+  TFile *outputFile = OpenFile(1);
+  // the branches created by the TTreeSRedirector take the compression of the file
+  if (outputFile && fCompressionSettings>=0) outputFile->SetCompressionSettings(fCompressionSettings);
   fTreeSRedirector = new TTreeSRedirector();
 
   //
@@ -358,6 +366,12 @@ void AliAnalysisTaskFilteredTree::UserExec(Option_t *)
     fFriendDownscaling=env.Atof();
     AliInfo(Form(" fFriendDownscaling=%f",fFriendDownscaling));
   }
+  env = gSystem->Getenv("AliAnalysisTaskFilteredTree_fDisabledBranches");
+  if (!env.IsNull() && env!=fDisabledBranches){
+    fDisabledBranches=env;
+    fDisabledBranchesDone.ResetAllBits();
+    AliInfo(Form("fDisabledBranches=%s",fDisabledBranches.Data()));
+  }
   //
   //
   //
@@ -374,9 +388,48 @@ void AliAnalysisTaskFilteredTree::UserExec(Option_t *)
   if (fProcessCosmics) { ProcessCosmics(fESD,fESDfriend); }
   if(fMC) { ProcessMCEff(fESD,fMC,fESDfriend);}
   if (fProcessITSTPCmatchOut) ProcessITSTPCmatchOut(fESD, fESDfriend);
+  DisableBranches();
   printf("processed event %d\n", Int_t(Entry()));
 }
 
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::DisableBranches()
+{
+  //
+  // Stop storing the branches given by SetDisabledBranches
+  // The TTreeSRedirector creates the branches of a tree with its first entry,
+  // so each entry is applied once the tree has been filled, and the first entries
+  // of the disabled branches are dropped - these branches stay empty in the output
+  //
+  if (fDisabledBranches.IsNull() || !fTreeSRedirector) return;
+  TObjArray *entries = fDisabledBranches.Tokenize(";");
+  for (Int_t ientry=0; ientry<entries->GetEntriesFast(); ientry++){
+    if (fDisabledBranchesDone.TestBitNumber(ientry)) continue;
+    TString entry = ((TObjString*)entries->At(ientry))->String();
+    Ssiz_t pos = entry.First(':');
+    if (pos<=0 || pos==entry.Length()-1) {
+      AliError(Form("Invalid disabled branch entry \"%s\", expected \"tree:branchPattern\"",entry.Data()));
+      fDisabledBranchesDone.SetBitNumber(ientry);
+      continue;
+    }
+    TString treeName = entry(0,pos);
+    TString pattern  = entry(pos+1,entry.Length()-pos-1);
+    TTree *tree = ((*fTreeSRedirector)<<treeName.Data()).GetTree();
+    if (!tree || tree->GetEntries()==0) continue;
+    tree->SetBranchStatus(pattern.Data(),0);
+    TIter nextLeaf(tree->GetListOfLeaves());
+    while (TLeaf *leaf = (TLeaf*)nextLeaf()) {
+      TBranch *branch = leaf->GetBranch();
+      TBranch *mother = branch->GetMother();
+      if (mother && mother->TestBit(TBranch::kDoNotProcess)) branch = mother;
+      if (branch->TestBit(TBranch::kDoNotProcess) && branch->GetEntries()>0) branch->Reset();
+    }
+    AliInfo(Form("%s: branches %s not stored",treeName.Data(),pattern.Data()));
+    fDisabledBranchesDone.SetBitNumber(ientry);
+  }
+  delete entries;
+}
+
 //_____________________________________________________________________________
 void AliAnalysisTaskFilteredTree::ProcessCosmics(AliESDEvent *const event, AliESDfriend* esdFriend)
 {
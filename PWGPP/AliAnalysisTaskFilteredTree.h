@@ -31,6 +31,8 @@ class TTreeSRedirector;
 class TParticle;
 class TH3D;
 
+#include "TBits.h"
+#include "TString.h"
 #include "AliTriggerAnalysis.h"
 #include "AliAnalysisTaskSE.h"
 
@@ -99,6 +101,11 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   void SetLowPtTrackDownscaligF(Double_t fact) { fLowPtTrackDownscaligF = fact; }
   void SetLowPtV0DownscaligF(Double_t fact)    { fLowPtV0DownscaligF = fact; }
   void SetFriendDownscaling(Double_t fact)    { fFriendDownscaling = fact; }
+  //
+  // output size / speed: compression of the output trees (TFile::SetCompressionSettings, -1 = file default)
+  // and branches not to store, "tree:branchPattern" entries separated by ';', e.g. "highPt:friendTrack.*;V0s:friendTrack?.*"
+  void SetCompressionSettings(Int_t settings)       { fCompressionSettings = settings; }
+  void SetDisabledBranches(const char *branches)    { fDisabledBranches = branches; }
   
   void   SetProcessCosmics(Bool_t flag) { fProcessCosmics = flag; }
   Bool_t GetProcessCosmics() { return fProcessCosmics; }
@@ -116,6 +123,7 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   void FillHistograms(AliESDtrack* const ptrack, AliExternalTrackParam* const ptpcInnerC, Double_t centralityF, Double_t chi2TPCInnerC);
   static void SetDefaultAliasesV0(TTree *treeV0);
  private:
+  void DisableBranches();
 
   AliESDEvent *fESD;    //! ESD event
   AliMCEvent *fMC;      //! MC event
@@ -142,6 +150,9 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   Double_t fLowPtTrackDownscaligF; // low pT track downscaling factor
   Double_t fLowPtV0DownscaligF;    // low pT V0 downscaling factor
   Double_t fFriendDownscaling;     // friend info downscaling )absolute value used), Modes>=1 downscaling in respect to the amount of tracks, Mode<=-1 (downscaling in respect to the data volume)
+  Int_t    fCompressionSettings;   // compression settings of the output file, -1 = default
+  TString  fDisabledBranches;      // branches not stored, "tree:branchPattern" entries separated by ';'
+  TBits    fDisabledBranchesDone;  //! entries of fDisabledBranches already applied
   Double_t fProcessAll; // Calculate all track properties including MC
   
   Bool_t fProcessCosmics; // look for cosmic pairs from random trigger
@@ -170,7 +181,7 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
 
   AliAnalysisTaskFilteredTree(const AliAnalysisTaskFilteredTree&); // not implemented
   AliAnalysisTaskFilteredTree& operator=(const AliAnalysisTaskFilteredTree&); // not implemented
-  ClassDef(AliAnalysisTaskFilteredTree, 1); // example of analysis
+  ClassDef(AliAnalysisTaskFilteredTree, 2); // example of analysis
 };
 
 #endif
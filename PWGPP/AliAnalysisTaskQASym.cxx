@@ -20,6 +20,7 @@
 #include "AliMultiplicity.h"
 
 #include "AliAnalysisTaskQASym.h"
+#include "AliQATrendingAccumulator.h"
 #include "AliExternalTrackParam.h"
 #include "AliTrackReference.h"
 #include "AliHeader.h"
@@ -165,6 +166,8 @@ ClassImp(AliAnalysisTaskQASym)
     ,fITSlayerPhi(0)
 
     ,fCuts(0)
+    ,fTrending(kFALSE)
+    ,fTrend(0)
 
 {
   // Constructor
@@ -199,6 +202,8 @@ ClassImp(AliAnalysisTaskQASym)
     fDcaSigmaNeg[i] =0;
   }
 
+  for(Int_t i = 0;i< 7;++i) fTrendVar[i]=-1;
+
   for(Int_t i = 0;i< 3;i++){
     for(Int_t j = 0;j< 2;j++){
       fEtaBinPt[i][j]=0;
@@ -214,6 +219,15 @@ ClassImp(AliAnalysisTaskQASym)
   
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskQASym::SetTrending(Bool_t b)
+{
+  // Summary statistics of the main QA variables in output slot 2,
+  // so that the trending does not need to read the histograms
+  fTrending = b;
+  if(fTrending) DefineOutput(2, AliQATrendingAccumulator::Class());
+}
+
 
 //________________________________________________________________________
 void AliAnalysisTaskQASym::UserCreateOutputObjects()
@@ -1091,6 +1105,20 @@ void AliAnalysisTaskQASym::UserCreateOutputObjects()
   TH1::AddDirectory(oldStatus);
   PostData(1, fHists);
 
+  if(fTrending){
+    // the sketch ranges follow the histograms
+    fTrend = new AliQATrendingAccumulator(Form("%s_trending", GetName()));
+    Double_t dcaRange = range*(1+Int_t(fTrackType/2)*9);
+    fTrendVar[0] = fTrend->AddVariable("nTracks",   5000,   0., 5000.);
+    fTrendVar[1] = fTrend->AddVariable("vertexZ",    400, -20.,   20.);
+    fTrendVar[2] = fTrend->AddVariable("pt",        2000,   0.,     pt);
+    fTrendVar[3] = fTrend->AddVariable("eta",        400,  -2.,    2.);
+    fTrendVar[4] = fTrend->AddVariable("phi",        360,   0., TMath::TwoPi());
+    fTrendVar[5] = fTrend->AddVariable("dca",       1000, -dcaRange, dcaRange);
+    fTrendVar[6] = fTrend->AddVariable("dcaZ",      1000,  -3.,    3.);
+    PostData(2, fTrend);
+  }
+
 }
 
 //__________________________________________________________
@@ -1183,6 +1211,7 @@ void AliAnalysisTaskQASym::UserExec(Option_t *)
   if (TMath::Abs(vz) > 10.) return;
 
   fNumber->Fill(event->GetNumberOfTracks());
+  if(fTrend) fTrend->Fill(fTrendVar[1], vz);
 
   AliESDtrack *tpcP = 0x0;
   Int_t fNTracksAccepted=0;
@@ -1366,6 +1395,14 @@ void AliAnalysisTaskQASym::UserExec(Option_t *)
     tpcP->GetImpactParameters(fXY,fZ);
     fDiffDcaD->Fill(fSignedDca+fXY);
     fDcaZ->Fill(fZ);
+
+    if(fTrend){
+      fTrend->Fill(fTrendVar[2], tpcP->Pt());
+      fTrend->Fill(fTrendVar[3], tpcP->Eta());
+      fTrend->Fill(fTrendVar[4], phiIn);
+      fTrend->Fill(fTrendVar[5], fSignedDca);
+      fTrend->Fill(fTrendVar[6], fZ);
+    }
     
     if(fTrackType==2) fCompareTPCparam->Fill(fZ,tpcPin->GetTgl());
 
@@ -1551,6 +1588,7 @@ void AliAnalysisTaskQASym::UserExec(Option_t *)
   }//first track loop
 
   fNumberAfterCut->Fill(fNTracksAccepted);
+  if(fTrend) fTrend->Fill(fTrendVar[0], fNTracksAccepted);
   
   //second track loop
  
@@ -1624,6 +1662,7 @@ void AliAnalysisTaskQASym::UserExec(Option_t *)
   // Post output data.
   // PostData(1, fHistPt);
   PostData(1, fHists);
+  if(fTrend) PostData(2, fTrend);
 }      
 
 
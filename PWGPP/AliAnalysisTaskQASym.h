@@ -13,6 +13,7 @@ class TList;
 class AliESDEvent;
 class AliESDtrack;
 class AliESDtrackCuts;
+class AliQATrendingAccumulator;
 
 
 #include "AliAnalysisTaskSE.h"
@@ -40,6 +41,8 @@ class AliAnalysisTaskQASym : public AliAnalysisTaskSE {
      {fCuts = cuts;}
 
   virtual void   SetFieldOn(Bool_t b = kTRUE){fFieldOn = b;} 
+  // summary statistics for the trending in output slot 2, to be set before connecting the outputs
+  virtual void   SetTrending(Bool_t b = kTRUE);
 
   
  private:
@@ -184,6 +187,10 @@ class AliAnalysisTaskQASym : public AliAnalysisTaskSE {
 
   AliESDtrackCuts* fCuts;               // List of cuts
 
+  Bool_t      fTrending;                // fill the trending summary
+  AliQATrendingAccumulator *fTrend;     //! summary statistics for the trending
+  Int_t       fTrendVar[7];             //! indices of the trending variables
+
   // four different vertex types: primary, spd, tracks, tpc
   TH1F * fVertexX[4];             // x of vertex
   TH1F * fVertexY[4];             // y of vertex
@@ -225,7 +232,7 @@ class AliAnalysisTaskQASym : public AliAnalysisTaskSE {
   AliAnalysisTaskQASym(const AliAnalysisTaskQASym&); // not implemented
   AliAnalysisTaskQASym& operator=(const AliAnalysisTaskQASym&); // not implemented
   
-  ClassDef(AliAnalysisTaskQASym, 1); // Basic QA exploiting symmetries
+  ClassDef(AliAnalysisTaskQASym, 2); // Basic QA exploiting symmetries
 };
 
 #endif
@@ -0,0 +1,287 @@
+/**************************************************************************
+ * Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+//-------------------------------------------------------------------------
+//     Mergeable summary statistics of the QA variables for the trending
+//-------------------------------------------------------------------------
+
+#include <TMath.h>
+#include <TObjString.h>
+#include <TCollection.h>
+#include "TTreeStream.h"
+#include "AliQATrendingAccumulator.h"
+
+ClassImp(AliQATrendingAccumulator);
+
+//______________________________________________________________________________
+AliQATrendingAccumulator::AliQATrendingAccumulator() :
+  TNamed(),
+  fNVar(0),
+  fNames(),
+  fEntries(),
+  fSumW(),
+  fSumW2(),
+  fMean(),
+  fM2(),
+  fMin(),
+  fMax(),
+  fNBins(),
+  fLow(),
+  fHigh(),
+  fOffset(),
+  fSketch()
+{
+  // Default constructor
+  fNames.SetOwner(kTRUE);
+}
+
+//______________________________________________________________________________
+AliQATrendingAccumulator::AliQATrendingAccumulator(const char* name, const char* title) :
+  TNamed(name, title),
+  fNVar(0),
+  fNames(),
+  fEntries(),
+  fSumW(),
+  fSumW2(),
+  fMean(),
+  fM2(),
+  fMin(),
+  fMax(),
+  fNBins(),
+  fLow(),
+  fHigh(),
+  fOffset(),
+  fSketch()
+{
+  // Constructor
+  fNames.SetOwner(kTRUE);
+}
+
+//______________________________________________________________________________
+Int_t AliQATrendingAccumulator::AddVariable(const char* name, Int_t nBins, Double_t low, Double_t high)
+{
+  // Register a variable and return its index, the index of the variable
+  // if it is already registered
+  Int_t i = GetIndex(name);
+  if (i >= 0) return i;
+  if (nBins < 1 || !(high > low)) {
+    Error("AddVariable", "Invalid sketch range for %s: %d bins in [%g,%g]", name, nBins, low, high);
+    return -1;
+  }
+
+  i = fNVar++;
+  fNames.Add(new TObjString(name));
+  fEntries.Set(fNVar);
+  fSumW.Set(fNVar);
+  fSumW2.Set(fNVar);
+  fMean.Set(fNVar);
+  fM2.Set(fNVar);
+  fMin.Set(fNVar);
+  fMax.Set(fNVar);
+  fNBins.Set(fNVar);
+  fLow.Set(fNVar);
+  fHigh.Set(fNVar);
+  fOffset.Set(fNVar);
+
+  fEntries[i] = 0;
+  fSumW[i] = fSumW2[i] = fMean[i] = fM2[i] = 0;
+  fMin[i] = fMax[i] = 0;
+  fNBins[i] = nBins;
+  fLow[i] = low;
+  fHigh[i] = high;
+  fOffset[i] = fSketch.GetSize();
+  fSketch.Set(fOffset[i] + nBins + 2);
+  return i;
+}
+
+//______________________________________________________________________________
+Int_t AliQATrendingAccumulator::GetIndex(const char* name) const
+{
+  // Index of a variable, -1 if it is not registered
+  for (Int_t i = 0; i < fNVar; i++) {
+    if (!strcmp(fNames.At(i)->GetName(), name)) return i;
+  }
+  return -1;
+}
+
+//______________________________________________________________________________
+void AliQATrendingAccumulator::Fill(Int_t i, Double_t x, Double_t w)
+{
+  // Add the value x with weight w to the variable i (West's weighted update)
+  if (i < 0 || i >= fNVar) return;
+  if (!(w > 0) || !TMath::Finite(x)) return;
+
+  if (fEntries[i] == 0) fMin[i] = fMax[i] = x;
+  else if (x < fMin[i]) fMin[i] = x;
+  else if (x > fMax[i]) fMax[i] = x;
+  fEntries[i]++;
+  fSumW[i] += w;
+  fSumW2[i] += w * w;
+  const Double_t delta = x - fMean[i];
+  fMean[i] += delta * w / fSumW[i];
+  fM2[i] += w * delta * (x - fMean[i]);
+
+  Int_t bin = 0;
+  if (x >= fHigh[i]) bin = fNBins[i] + 1;
+  else if (x >= fLow[i]) bin = 1 + TMath::Min(fNBins[i] - 1, Int_t((x - fLow[i]) / (fHigh[i] - fLow[i]) * fNBins[i]));
+  fSketch[fOffset[i] + bin] += w;
+}
+
+//______________________________________________________________________________
+void AliQATrendingAccumulator::Reset(Option_t* /*option*/)
+{
+  // Remove the content, the variables stay registered
+  for (Int_t i = 0; i < fNVar; i++) {
+    fEntries[i] = 0;
+    fSumW[i] = fSumW2[i] = fMean[i] = fM2[i] = 0;
+    fMin[i] = fMax[i] = 0;
+  }
+  fSketch.Reset();
+}
+
+//______________________________________________________________________________
+void AliQATrendingAccumulator::Add(Int_t i, const AliQATrendingAccumulator* other, Int_t j)
+{
+  // Add the variable j of other to the variable i (Chan's pairwise combination)
+  const Double_t wB = other->fSumW[j];
+  if (!(wB > 0)) return;
+  const Double_t wA = fSumW[i];
+  if (fEntries[i] == 0) {
+    fMin[i] = other->fMin[j];
+    fMax[i] = other->fMax[j];
+  } else {
+    fMin[i] = TMath::Min(fMin[i], other->fMin[j]);
+    fMax[i] = TMath::Max(fMax[i], other->fMax[j]);
+  }
+  const Double_t delta = other->fMean[j] - fMean[i];
+  const Double_t w = wA + wB;
+  fMean[i] += delta * wB / w;
+  fM2[i] += other->fM2[j] + delta * delta * wA * wB / w;
+  fSumW[i] = w;
+  fSumW2[i] += other->fSumW2[j];
+  fEntries[i] += other->fEntries[j];
+  for (Int_t b = 0; b < fNBins[i] + 2; b++) fSketch[fOffset[i] + b] += other->fSketch[other->fOffset[j] + b];
+}
+
+//______________________________________________________________________________
+Long64_t AliQATrendingAccumulator::Merge(TCollection* list)
+{
+  // Merge the accumulators of list, the variables are matched by name
+  if (!list) return 0;
+  TIter next(list);
+  TObject* obj = 0;
+  while ((obj = next())) {
+    const AliQATrendingAccumulator* other = dynamic_cast<const AliQATrendingAccumulator*>(obj);
+    if (!other) {
+      Error("Merge", "Cannot merge a %s", obj->ClassName());
+      continue;
+    }
+    for (Int_t j = 0; j < other->fNVar; j++) {
+      const char* name = other->GetVariableName(j);
+      Int_t i = AddVariable(name, other->fNBins[j], other->fLow[j], other->fHigh[j]);
+      if (i < 0) continue;
+      if (fNBins[i] != other->fNBins[j] || fLow[i] != other->fLow[j] || fHigh[i] != other->fHigh[j]) {
+        Error("Merge", "Different sketch ranges for %s, skipped", name);
+        continue;
+      }
+      Add(i, other, j);
+    }
+  }
+  Long64_t entries = 0;
+  for (Int_t i = 0; i < fNVar; i++) entries += fEntries[i];
+  return entries;
+}
+
+//______________________________________________________________________________
+Double_t AliQATrendingAccumulator::GetRMS(Int_t i) const
+{
+  // Weighted standard deviation
+  if (!(fSumW[i] > 0)) return 0;
+  return TMath::Sqrt(TMath::Max(fM2[i], 0.) / fSumW[i]);
+}
+
+//______________________________________________________________________________
+Double_t AliQATrendingAccumulator::GetMeanError(Int_t i) const
+{
+  // Error of the mean with the effective number of entries
+  if (!(fSumW2[i] > 0)) return 0;
+  const Double_t nEff = fSumW[i] * fSumW[i] / fSumW2[i];
+  return GetRMS(i) / TMath::Sqrt(nEff);
+}
+
+//______________________________________________________________________________
+Double_t AliQATrendingAccumulator::GetQuantile(Int_t i, Double_t q) const
+{
+  // Quantile q from the sketch, linear inside the bins. The underflow and
+  // overflow bins extend to the minimum and maximum.
+  if (fEntries[i] == 0) return 0;
+  const Double_t* sketch = fSketch.GetArray() + fOffset[i];
+  const Int_t nBins = fNBins[i];
+  Double_t total = 0;
+  for (Int_t b = 0; b < nBins + 2; b++) total += sketch[b];
+  if (!(total > 0)) return 0;
+
+  const Double_t target = TMath::Min(TMath::Max(q, 0.), 1.) * total;
+  const Double_t width = (fHigh[i] - fLow[i]) / nBins;
+  Double_t sum = 0;
+  for (Int_t b = 0; b < nBins + 2; b++) {
+    if (sketch[b] > 0 && sum + sketch[b] >= target) {
+      Double_t lo = fLow[i] + (b - 1) * width;
+      Double_t hi = lo + width;
+      if (b == 0) { lo = fMin[i]; hi = fLow[i]; }
+      else if (b == nBins + 1) { lo = fHigh[i]; hi = fMax[i]; }
+      const Double_t x = lo + (target - sum) / sketch[b] * (hi - lo);
+      return TMath::Min(TMath::Max(x, fMin[i]), fMax[i]);
+    }
+    sum += sketch[b];
+  }
+  return fMax[i];
+}
+
+//______________________________________________________________________________
+Double_t AliQATrendingAccumulator::GetRobustWidth(Int_t i) const
+{
+  // Half distance between the 15.87% and 84.13% quantiles, the sigma of a gaussian
+  return 0.5 * (GetQuantile(i, 0.8413) - GetQuantile(i, 0.1587));
+}
+
+//______________________________________________________________________________
+void AliQATrendingAccumulator::FillTrending(TTreeSRedirector* pcstream, const char* treeName, const char* prefix) const
+{
+  // Stream the summary of all the variables in the current entry of the trending tree
+  if (!pcstream) return;
+  for (Int_t i = 0; i < fNVar; i++) {
+    TString name = Form("%s.%s", prefix, GetVariableName(i));
+    Double_t entries = fEntries[i];
+    Double_t mean = GetMean(i);
+    Double_t meanError = GetMeanError(i);
+    Double_t rms = GetRMS(i);
+    Double_t median = GetMedian(i);
+    Double_t width = GetRobustWidth(i);
+    Double_t min = GetMin(i);
+    Double_t max = GetMax(i);
+    // One statement per branch, the Form buffer is not kept along a chain of <<
+    (*pcstream)<<treeName<<Form("%s.Entries=", name.Data())<<entries;
+    (*pcstream)<<treeName<<Form("%s.Mean=", name.Data())<<mean;
+    (*pcstream)<<treeName<<Form("%s.MeanError=", name.Data())<<meanError;
+    (*pcstream)<<treeName<<Form("%s.RMS=", name.Data())<<rms;
+    (*pcstream)<<treeName<<Form("%s.Median=", name.Data())<<median;
+    (*pcstream)<<treeName<<Form("%s.Width=", name.Data())<<width;
+    (*pcstream)<<treeName<<Form("%s.Min=", name.Data())<<min;
+    (*pcstream)<<treeName<<Form("%s.Max=", name.Data())<<max;
+  }
+}
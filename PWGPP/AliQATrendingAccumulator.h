@@ -0,0 +1,83 @@
+#ifndef ALIQATRENDINGACCUMULATOR_H
+#define ALIQATRENDINGACCUMULATOR_H
+/* Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+//-------------------------------------------------------------------------
+//     Summary statistics of the QA variables accumulated during the
+//     processing, written as a small mergeable output next to the QA
+//     histograms. Per variable: weighted mean and variance (Welford),
+//     minimum, maximum and a fixed binning quantile sketch giving the
+//     median and the fit-free width (q84-q16)/2. A fraction is the mean
+//     of a variable filled with 0 or 1.
+//     The trending (macros/simpleTrending.C) only reads these objects
+//     instead of the full histogram lists.
+//-------------------------------------------------------------------------
+
+#include <TNamed.h>
+#include <TObjArray.h>
+#include <TArrayD.h>
+#include <TArrayI.h>
+#include <TArrayL64.h>
+
+class TCollection;
+class TTreeSRedirector;
+
+class AliQATrendingAccumulator : public TNamed {
+
+ public :
+  AliQATrendingAccumulator();
+  AliQATrendingAccumulator(const char* name, const char* title = "");
+  virtual ~AliQATrendingAccumulator() {}
+
+  // Register a variable, the sketch range should contain the bulk of the distribution
+  Int_t    AddVariable(const char* name, Int_t nBins, Double_t low, Double_t high);
+  Int_t    GetIndex(const char* name) const;
+  Int_t    GetNVariables()                const {return fNVar;}
+  const char* GetVariableName(Int_t i)    const {return fNames.At(i)->GetName();}
+
+  void     Fill(Int_t i, Double_t x, Double_t w = 1.);
+  virtual void Reset(Option_t* option = "");
+  virtual Long64_t Merge(TCollection* list);
+
+  Long64_t GetEntries(Int_t i)            const {return fEntries[i];}
+  Double_t GetSumOfWeights(Int_t i)       const {return fSumW[i];}
+  Double_t GetMean(Int_t i)               const {return fMean[i];}
+  Double_t GetRMS(Int_t i)                const;
+  Double_t GetMeanError(Int_t i)          const;
+  Double_t GetMin(Int_t i)                const {return fMin[i];}
+  Double_t GetMax(Int_t i)                const {return fMax[i];}
+  Double_t GetQuantile(Int_t i, Double_t q) const;
+  Double_t GetMedian(Int_t i)             const {return GetQuantile(i, 0.5);}
+  Double_t GetRobustWidth(Int_t i)        const;
+
+  // One entry per variable: <prefix>.<variable>.Entries, Mean, MeanError, RMS, Median, Width, Min, Max
+  void     FillTrending(TTreeSRedirector* pcstream, const char* treeName, const char* prefix) const;
+
+ private:
+  AliQATrendingAccumulator(const AliQATrendingAccumulator& acc); // not implemented
+  AliQATrendingAccumulator& operator=(const AliQATrendingAccumulator& acc); // not implemented
+
+  void     Add(Int_t i, const AliQATrendingAccumulator* other, Int_t j);
+
+  Int_t      fNVar;          // number of variables
+  TObjArray  fNames;         // names of the variables
+  TArrayL64  fEntries;       // number of fills
+  TArrayD    fSumW;          // sum of the weights
+  TArrayD    fSumW2;         // sum of the squared weights
+  TArrayD    fMean;          // weighted mean
+  TArrayD    fM2;            // weighted sum of the squared deviations from the mean
+  TArrayD    fMin;           // minimum
+  TArrayD    fMax;           // maximum
+  TArrayI    fNBins;         // number of bins of the sketch
+  TArrayD    fLow;           // lower edge of the sketch
+  TArrayD    fHigh;          // upper edge of the sketch
+  TArrayI    fOffset;        // first bin of the sketch of each variable in fSketch
+  TArrayD    fSketch;        // sum of the weights per bin, with underflow and overflow
+
+  ClassDef(AliQATrendingAccumulator, 1); // Mergeable summary statistics for the QA trending
+};
+
+#endif
@@ -35,6 +35,7 @@
 #include "AliRelAlignerKalmanArray.h"
 #include "TList.h"
 #include "TBrowser.h"
+#include <vector>
 
 ClassImp(AliRelAlignerKalmanArray)
 
@@ -139,21 +140,30 @@ AliRelAlignerKalman* AliRelAlignerKalmanArray::GetAlignerTemplate()
 Long64_t AliRelAlignerKalmanArray::Merge( TCollection* list )
 {
   //Merge all the arrays
-  //tlihe merge is vertical, meaning matching entries in tree are merged
+  //the merge is vertical, meaning matching entries in tree are merged
+  //the slots are independent: each slot is merged with the matching slots of all the
+  //compatible arrays in turn, in the order of the list, so that its state and covariance
+  //stay in cache while the inputs are traversed
 
-  AliRelAlignerKalmanArray *arrayFromList;
   if (!list) return 0;
+  std::vector<AliRelAlignerKalmanArray*> arrays;
+  arrays.reserve(list->GetEntries());
   TIter next(list);
+  AliRelAlignerKalmanArray *arrayFromList;
   while ( (arrayFromList = dynamic_cast<AliRelAlignerKalmanArray*>(next())) )
   {
     if (fT0 != arrayFromList->fT0) continue;
     if (fTimebinWidth != arrayFromList->fTimebinWidth) continue;
     if (fSize != arrayFromList->fSize) continue;
+    arrays.push_back(arrayFromList);
+  }
 
-    for (Int_t i=0; i<GetSize(); i++)
+  for (Int_t i=0; i<GetSize(); i++)
+  {
+    for (UInt_t j=0; j<arrays.size(); j++)
     {
       AliRelAlignerKalman* a1 = fPArray[i];
-      AliRelAlignerKalman* a2 = arrayFromList->fPArray[i];
+      AliRelAlignerKalman* a2 = arrays[j]->fPArray[i];
       if (a1 && a2)
       {
         a1->SetRejectOutliers(kFALSE);
@@ -410,8 +420,8 @@ AliRelAlignerKalmanArray* AliRelAlignerKalmanArray::MakeSmoothArray() const
   tmpaligner->SetOutRejSigma(fOutRejSigmaOnSmooth);
   //copy the first filled slot
   Int_t n=0;
-  while (!fPArray[n]) {n++;}
-  if (n==fSize) return NULL;
+  while (n<fSize && !fPArray[n]) {n++;}
+  if (n==fSize) {delete outputarr; return NULL;}
   *tmpaligner   = *fPArray[n];
   if (fPArray[n]->GetNUpdates()>10)
   (*outputarr)[n] = new AliRelAlignerKalman(*(fPArray[n]));
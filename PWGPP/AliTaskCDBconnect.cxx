@@ -39,7 +39,9 @@ AliTaskCDBconnect::AliTaskCDBconnect():
   fLock(0),
   fStorage(),
   fSpecCDBUri(),
-  fGRPManager(NULL)
+  fGRPManager(NULL),
+  fSnapshotDir(),
+  fSnapshotRun(0)
 {
   // Dummy constructor
   fSpecCDBUri.SetOwner();
@@ -53,7 +55,9 @@ AliTaskCDBconnect::AliTaskCDBconnect(const char* name, const char *storage, Int_
    fLock(0),
    fStorage(storage),
    fSpecCDBUri(),
-   fGRPManager(NULL)
+   fGRPManager(NULL),
+   fSnapshotDir(),
+   fSnapshotRun(0)
 {
   // Default constructor
   fSpecCDBUri.SetOwner();
@@ -73,6 +77,7 @@ void AliTaskCDBconnect::InitGRP()
 {
   // Initialize geometry and mag. field
   AliCDBManager *cdb = AliCDBManager::Instance();
+  WriteSnapshot(); // entries of the previous run
 
   if (!cdb->IsDefaultStorageSet()) {
     //  
@@ -138,6 +143,18 @@ void AliTaskCDBconnect::InitGRP()
     fLock = cdb->SetLock(kTRUE,fLock);
   }
   if (gSystem->AccessPathName("OCDB.root",kFileExists)==0) cdb->SetSnapshotMode("OCDB.root"); 
+  else if (!fSnapshotDir.IsNull()) {
+    // per run snapshot of the site cache, or write one with the entries used by this job
+    TString snapshot = GetSnapshotFileName(fRun);
+    if (gSystem->AccessPathName(snapshot.Data(),kReadPermission)==0) {
+      AliInfoF("Using OCDB snapshot %s",snapshot.Data());
+      cdb->SetSnapshotMode(snapshot.Data());
+    }
+    else {
+      cdb->UnsetSnapshotMode();
+      fSnapshotRun = fRun;
+    }
+  }
   //
   if (!fGRPManager) fGRPManager = new AliGRPManager();
   AliInfo("AliCDBconnect: #### Loading GRP to init B-field...");
@@ -206,6 +223,41 @@ void AliTaskCDBconnect::Exec(Option_t* /*option*/)
   }
 }
 
+//______________________________________________________________________________
+void AliTaskCDBconnect::FinishTaskOutput()
+{
+  // Write the snapshot of the last run
+  WriteSnapshot();
+}
+
+//______________________________________________________________________________
+TString AliTaskCDBconnect::GetSnapshotFileName(Int_t run) const
+{
+  // Name of the OCDB snapshot of the run in the snapshot directory
+  return TString::Format("%s/OCDB_%09d.root", gSystem->ExpandPathName(fSnapshotDir.Data()), run);
+}
+
+//______________________________________________________________________________
+void AliTaskCDBconnect::WriteSnapshot()
+{
+  // Dump the OCDB entries retrieved for fSnapshotRun to its snapshot file.
+  // The file is written under a temporary name and renamed, so that concurrent
+  // jobs never see a partial snapshot.
+  if (fSnapshotRun<=0) return;
+  TString snapshot = GetSnapshotFileName(fSnapshotRun);
+  fSnapshotRun = 0;
+  if (gSystem->AccessPathName(snapshot.Data(),kFileExists)==0) return; // written by another job
+  TString dir = gSystem->DirName(snapshot.Data());
+  if (gSystem->AccessPathName(dir.Data(),kFileExists)) gSystem->mkdir(dir.Data(),kTRUE);
+  TString tmpName = TString::Format("%s.%d.tmp", snapshot.Data(), gSystem->GetPid());
+  AliInfoF("Writing OCDB snapshot %s",snapshot.Data());
+  AliCDBManager::Instance()->DumpToSnapshotFile(tmpName.Data(), kFALSE);
+  if (gSystem->Rename(tmpName.Data(), snapshot.Data())) {
+    AliWarningF("Could not move the OCDB snapshot to %s",snapshot.Data());
+    gSystem->Unlink(tmpName.Data());
+  }
+}
+
 //______________________________________________________________________________
 void AliTaskCDBconnect::SetSpecificStorage(const char* calibType, const char* dbString, Int_t version, Int_t subVersion)
 {
@@ -22,10 +22,13 @@ private:
   TString                   fStorage;        // Storage (if cvmfs                   
   TObjArray                 fSpecCDBUri;     // Array with specific CDB storages
   AliGRPManager            *fGRPManager;     //! Pointer to GRP manager
+  TString                   fSnapshotDir;    // Directory with the per run OCDB snapshots
+  Int_t                     fSnapshotRun;    //! Run whose OCDB entries are to be written to a snapshot
   AliTaskCDBconnect(const AliTaskCDBconnect &other);
   AliTaskCDBconnect& operator=(const AliTaskCDBconnect &other);
 
   void                      InitGRP();
+  void                      WriteSnapshot();
   //
 public:
   AliTaskCDBconnect();
@@ -36,10 +39,14 @@ public:
   virtual void              Exec(Option_t *option);
   virtual void              CreateOutputObjects();
   virtual void              ConnectInputData(Option_t *option = "");
+  virtual void              FinishTaskOutput();
   void                      SetSpecificStorage(const char* calibType, const char* dbString,
                                                Int_t version = -1, Int_t subVersion = -1);
   void                      SetFallBackToRaw(Bool_t v)       {fFallBackToRaw = v;}
   Bool_t                    GetFallBackToRaw()         const {return fFallBackToRaw;}
-  ClassDef(AliTaskCDBconnect,5)  // Class giving CDB connectivity
+  void                      SetSnapshotDir(const char* dir)  {fSnapshotDir = dir;}
+  const char*               GetSnapshotDir()           const {return fSnapshotDir.Data();}
+  TString                   GetSnapshotFileName(Int_t run) const;
+  ClassDef(AliTaskCDBconnect,6)  // Class giving CDB connectivity
 };
 #endif
@@ -78,7 +78,11 @@ AliCentralityGlauberFit::AliCentralityGlauberFit(const char *filename) :
   fOutrootfilename(0),
   fOutntuplename(0),
   fAncfilename("ancestor_hists.root"),
-  fHistnames()
+  fHistnames(),
+  fNtNpart(),
+  fNtNcoll(),
+  fNtB(),
+  fNtTaa()
 {
   // Standard constructor.
   TFile *f = 0;
@@ -353,10 +357,7 @@ TH1F *AliCentralityGlauberFit::GlauberHisto(Double_t mu, Double_t k, Double_t al
       if (weights <= 0) continue;
       Int_t trials = (Int_t) (20 * nanc * (Int_t) mu);
       if (trials <=0) continue;
-      for (Int_t j=0; j<trials; j++) {
-       	Double_t nbdvalue = NBD(j, mu * nanc, k * nanc);
-       	h1->Fill((Double_t) j, nbdvalue * weights);
-      }
+      FillNBD(h1, trials, mu * nanc, k * nanc, weights);
     }
     return h1;
   }
@@ -377,7 +378,7 @@ TH1F *AliCentralityGlauberFit::GlauberHisto(Double_t mu, Double_t k, Double_t al
 
   for (Int_t i=0;i<fNevents;++i) {
     if (fGlauntuple)
-      fGlauntuple->GetEntry(i % nents);
+      GetGlauberEntry(i % nents);
     else {
       fNpart = 2;
       fNcoll = 1;
@@ -519,6 +520,60 @@ Double_t AliCentralityGlauberFit::NBD(Int_t n, Double_t mu, Double_t k) const
 
 }
 
+//--------------------------------------------------------------------------------------------------
+void AliCentralityGlauberFit::FillNBD(TH1F *h, Int_t nmax, Double_t mu, Double_t k, Double_t weight) const
+{
+  // Fill NBD(j, mu, k)*weight at j for j=0,...,nmax-1.
+  // NBD is evaluated once at the mode, the other values follow from
+  // P(j+1)/P(j) = (j+k)/(j+1) * mu/(mu+k), instead of three LnGamma per j.
+
+  if (nmax<=0) return;
+  Double_t r = mu/(mu+k);
+  Int_t mode = (k>1) ? (Int_t)((k-1)*mu/k) : 0;
+  if (mode>nmax-1) mode = nmax-1;
+
+  Double_t pmode = NBD(mode, mu, k);
+  h->Fill((Double_t) mode, pmode * weight);
+
+  Double_t p = pmode;
+  for (Int_t j=mode; j>0; j--) {
+    p *= j / ((j - 1 + k) * r);
+    h->Fill((Double_t) (j-1), p * weight);
+  }
+  p = pmode;
+  for (Int_t j=mode+1; j<nmax; j++) {
+    p *= (j - 1 + k) / j * r;
+    h->Fill((Double_t) j, p * weight);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+void AliCentralityGlauberFit::GetGlauberEntry(Int_t i)
+{
+  // Set fNpart, fNcoll, fB and fTaa of entry i of the glauber ntuple.
+  // The ntuple is read once, the fits loop on it for every grid point.
+
+  if (fNtNpart.empty()) {
+    Int_t nents = fGlauntuple->GetEntries();
+    fNtNpart.resize(nents);
+    fNtNcoll.resize(nents);
+    fNtB.resize(nents);
+    fNtTaa.resize(nents);
+    for (Int_t j=0; j<nents; ++j) {
+      fGlauntuple->GetEntry(j);
+      fNtNpart[j] = fNpart;
+      fNtNcoll[j] = fNcoll;
+      fNtB[j]     = fB;
+      fNtTaa[j]   = fTaa;
+    }
+  }
+
+  fNpart = fNtNpart[i];
+  fNcoll = fNtNcoll[i];
+  fB     = fNtB[i];
+  fTaa   = fNtTaa[i];
+}
+
 //--------------------------------------------------------------------------------------------------
 TH1F *AliCentralityGlauberFit::NBDhist(Double_t mu, Double_t k)
 {
@@ -590,7 +645,7 @@ TH1F *AliCentralityGlauberFit::MakeAncestor(Double_t alpha)
   fhAncestor->SetDirectory(0);
   Int_t nents = fGlauntuple->GetEntries(); 
   for (Int_t i=0;i<nents;++i) {
-    fGlauntuple->GetEntry(i % nents);
+    GetGlauberEntry(i % nents);
     Int_t n=0;
     if (fAncestor == 1)    n = (Int_t) (TMath::Power(fNpart,alpha));
     //if (fAncestor == 1)      n = (Int_t) (TMath::Power(fNcoll,alpha));
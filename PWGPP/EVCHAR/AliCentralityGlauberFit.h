@@ -85,6 +85,10 @@ class AliCentralityGlauberFit : public TObject {
   TString fOutntuplename;           // output Glauber ntuple
   TString fAncfilename;             // ancestor file name
   std::vector<TString> fHistnames;  // histogram names
+  std::vector<Float_t> fNtNpart;    //! Npart of the glauber ntuple entries, read once
+  std::vector<Float_t> fNtNcoll;    //! Ncoll of the glauber ntuple entries
+  std::vector<Float_t> fNtB;        //! B of the glauber ntuple entries
+  std::vector<Float_t> fNtTaa;      //! tAA of the glauber ntuple entries
 
   Double_t  CalculateChi2(TH1F *hDATA, TH1F *thistGlau);
   TH1F     *GetTriggerEfficiencyFunction(TH1F *hist1, TH1F *hist2);
@@ -93,6 +97,8 @@ class AliCentralityGlauberFit : public TObject {
   TH1F     *MakeAncestor(Double_t alpha);
   Double_t  NBD(Int_t n, Double_t mu, Double_t k) const;
   TH1F     *NBDhist(Double_t mu, Double_t k);
+  void      FillNBD(TH1F *h, Int_t nmax, Double_t mu, Double_t k, Double_t weight) const;
+  void      GetGlauberEntry(Int_t i);
   TH1F     *NormalizeHisto(TString hdistributionName);
   void      SaveHisto(TH1F *hist1,TH1F *hist2,TH1F *heffi, TFile *outrootfile);
 
@@ -102,6 +108,6 @@ class AliCentralityGlauberFit : public TObject {
   AliCentralityGlauberFit(const AliCentralityGlauberFit&);
   AliCentralityGlauberFit &operator=(const AliCentralityGlauberFit&);
 
-  ClassDef(AliCentralityGlauberFit, 1)  
+  ClassDef(AliCentralityGlauberFit, 2)  
 };
 #endif
@@ -35,7 +35,10 @@ ClassImp(AliQnCorrectionsHistogramBase);
 AliQnCorrectionsHistogramBase::AliQnCorrectionsHistogramBase() :
   TNamed(),
   fEventClassVariables(),
-  fBinAxesValues(NULL) {
+  fBinAxesValues(NULL),
+  fBinAxesCoordinates(NULL),
+  fCoordinatesVariables(NULL),
+  fCoordinatesHistogram(NULL) {
 
   fErrorMode = kERRORMEAN;
   fMinNoOfEntriesToValidate = nDefaultMinNoOfEntriesValidated;
@@ -47,6 +50,10 @@ AliQnCorrectionsHistogramBase::AliQnCorrectionsHistogramBase() :
 AliQnCorrectionsHistogramBase::~AliQnCorrectionsHistogramBase() {
   if (fBinAxesValues != NULL)
     delete [] fBinAxesValues;
+  if (fBinAxesCoordinates != NULL)
+    delete [] fBinAxesCoordinates;
+  if (fCoordinatesVariables != NULL)
+    delete [] fCoordinatesVariables;
 }
 
 /// Normal constructor
@@ -73,10 +80,15 @@ AliQnCorrectionsHistogramBase::AliQnCorrectionsHistogramBase(const char *name,
     Option_t *option) :
   TNamed(name, title),
   fEventClassVariables(ecvs),
-  fBinAxesValues(NULL) {
+  fBinAxesValues(NULL),
+  fBinAxesCoordinates(NULL),
+  fCoordinatesVariables(NULL),
+  fCoordinatesHistogram(NULL) {
 
   /* one place more for storing the channel number by inherited classes */
   fBinAxesValues = new Double_t[fEventClassVariables.GetEntries() + 1];
+  fBinAxesCoordinates = new Int_t[fEventClassVariables.GetEntries() + 1];
+  fCoordinatesVariables = new Float_t[fEventClassVariables.GetEntries()];
 
   TString opt = option;
   opt.ToLower();
@@ -26,7 +26,10 @@
 ///     's'            the bin are the standard deviation of of the bin values
 ///
 /// The encapsulated bin axes values provide an efficient
-/// runtime storage for computing bin numbers.
+/// runtime storage for computing bin numbers. The bin coordinates
+/// of the event class are also kept, so that the many fills of
+/// an event (channels, harmonics, components) only look up
+/// the axes whose variable content changed.
 ///
 /// Provides the interface for the whole set of histogram
 /// classes providing error information that helps debugging.
@@ -109,16 +112,20 @@ public:
 
 protected:
   void FillBinAxesValues(const Float_t *variableContainer, Int_t chgrpId = -1);
+  const Int_t *FillBinAxesCoordinates(const Float_t *variableContainer, const THnBase *histogram, Int_t chgrpId = -1);
   THnF* DivideTHnF(THnF* values, THnI* entries, THnC *valid = NULL);
   void CopyTHnF(THnF *hDest, THnF *hSource, Int_t *binsArray);
   void CopyTHnFDimension(THnF *hDest, THnF *hSource, Int_t *binsArray, Int_t dimension);
 
   AliQnCorrectionsEventClassVariablesSet fEventClassVariables;  //!<! The variables set that determines the event classes
   Double_t *fBinAxesValues;                                  //!<! Runtime place holder for computing bin number
+  Int_t *fBinAxesCoordinates;                                //!<! Runtime place holder for the bin coordinates on each axis
+  Float_t *fCoordinatesVariables;                            //!<! Variables content the event class coordinates were computed for
+  const THnBase *fCoordinatesHistogram;                      //!<! Histogram whose axes gave the event class coordinates, NULL if none
   QnCorrectionHistogramErrorMode fErrorMode;                 //!<! The error type for the current instance
   Int_t fMinNoOfEntriesToValidate;                           ///< the minimum number of entries for validating a bin content
   /// \cond CLASSIMP
-  ClassDef(AliQnCorrectionsHistogramBase, 2);
+  ClassDef(AliQnCorrectionsHistogramBase, 3);
   /// \endcond
   static const char *szChannelAxisTitle;                 ///< The title for the channel extra axis
   static const char *szGroupAxisTitle;                   ///< The title for the channel group extra axis
@@ -154,5 +161,33 @@ inline void AliQnCorrectionsHistogramBase::FillBinAxesValues(const Float_t *vari
   fBinAxesValues[fEventClassVariables.GetEntriesFast()] = chgrpId;
 }
 
+/// Fills the bin coordinates for the current passed variable container
+///
+/// Equivalent to FillBinAxesValues followed by the axes bin lookup
+/// of the histogram but the event class coordinates are only looked
+/// up again for the variables whose content changed since the previous
+/// call on an histogram with the same axes (any of the histograms
+/// sharing the event class axes of the instance). The optional channel
+/// or group Id takes the axis after the event class ones.
+///
+/// \param variableContainer the current variables content addressed by var Id
+/// \param histogram the histogram whose axes provide the coordinates
+/// \param chgrpId additional optional channel or group Id
+/// \return the bin coordinates, for THnBase::GetBin(const Int_t *)
+inline const Int_t *AliQnCorrectionsHistogramBase::FillBinAxesCoordinates(const Float_t *variableContainer, const THnBase *histogram, Int_t chgrpId) {
+  Int_t nVariables = fEventClassVariables.GetEntriesFast();
+  Bool_t sameAxes = (histogram == fCoordinatesHistogram);
+  for (Int_t var = 0; var < nVariables; var++) {
+    Float_t value = variableContainer[fEventClassVariables.At(var)->GetVariableId()];
+    if (sameAxes && value == fCoordinatesVariables[var]) continue;
+    fCoordinatesVariables[var] = value;
+    fBinAxesCoordinates[var] = histogram->GetAxis(var)->FindBin(Double_t(value));
+  }
+  fCoordinatesHistogram = histogram;
+  if (nVariables < histogram->GetNdimensions())
+    fBinAxesCoordinates[nVariables] = histogram->GetAxis(nVariables)->FindBin(Double_t(chgrpId));
+  return fBinAxesCoordinates;
+}
+
 
 #endif
@@ -155,9 +155,8 @@ Bool_t AliQnCorrectionsHistogramChannelizedSparse::CreateChannelizedHistogram(TL
 /// \return the associated bin to the current variables content
 Long64_t AliQnCorrectionsHistogramChannelizedSparse::GetBin(const Float_t *variableContainer, Int_t nChannel) {
 
-  FillBinAxesValues(variableContainer, fChannelMap[nChannel]);
-  /* store the channel number */
-  return fValues->GetBin(fBinAxesValues);
+  /* the event class coordinates are kept among the channels of the event */
+  return fValues->GetBin(FillBinAxesCoordinates(variableContainer, fValues, fChannelMap[nChannel]));
 }
 
 /// Check the validity of the content of the passed bin
@@ -207,9 +206,10 @@ void AliQnCorrectionsHistogramChannelizedSparse::Fill(const Float_t *variableCon
   /* keep the total entries in fValues updated */
   Double_t nEntries = fValues->GetEntries();
 
-  FillBinAxesValues(variableContainer, fChannelMap[nChannel]);
+  /* the event class coordinates are kept among the channels of the event */
+  Long64_t bin = fValues->GetBin(FillBinAxesCoordinates(variableContainer, fValues, fChannelMap[nChannel]));
   /* and now update the bin */
-  fValues->Fill(fBinAxesValues, weight);
+  fValues->FillBin(bin, weight);
   fValues->SetEntries(nEntries + 1);
 }
 
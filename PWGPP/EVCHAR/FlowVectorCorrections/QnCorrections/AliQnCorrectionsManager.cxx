@@ -75,6 +75,8 @@ AliQnCorrectionsManager::AliQnCorrectionsManager() :
   fFillQAHistograms = kFALSE;
   fFillNveQAHistograms = kFALSE;
   fFillQnVectorTree = kFALSE;
+  fOnlineCalibration = kFALSE;
+  fOnlineCalibrationMinNoOfEntries = 100;
   fProcessesNames = NULL;
 }
 
@@ -307,7 +309,7 @@ void AliQnCorrectionsManager::InitializeQnCorrectionsFramework() {
   /* now get the process list on the calibration histograms list if any */
   /* and pass it to the detectors for input calibration histograms attachment, */
   if (fCalibrationHistogramsList != NULL) {
-    TList *processList = (TList *)fCalibrationHistogramsList->FindObject((const char *)fProcessListName);
+    TList *processList = GetCalibrationProcessList();
     if (processList != NULL) {
       AliInfo(Form("Assigned process list %s as the calibration histograms list",
           processList->GetName()));
@@ -403,7 +405,7 @@ void AliQnCorrectionsManager::SetCurrentProcessListName(const char *name) {
       /* and pass it to the detectors for input calibration histograms attachment, */
       fProcessListName = name;
       if (fCalibrationHistogramsList != NULL) {
-        TList *processList = (TList *)fCalibrationHistogramsList->FindObject((const char *)fProcessListName);
+        TList *processList = GetCalibrationProcessList();
         if (processList != NULL) {
           AliInfo(Form("Assigned process list %s as the calibration histograms list",
               processList->GetName()));
@@ -472,7 +474,7 @@ void AliQnCorrectionsManager::SetCurrentProcessListName(const char *name) {
       /* and pass it to the detectors for input calibration histograms attachment, */
       fProcessListName = name;
       if (fCalibrationHistogramsList != NULL) {
-        TList *processList = (TList *)fCalibrationHistogramsList->FindObject((const char *)fProcessListName);
+        TList *processList = GetCalibrationProcessList();
         if (processList != NULL) {
           AliInfo(Form("Assigned process list %s as the calibration histograms list",
               processList->GetName()));
@@ -742,6 +744,26 @@ void AliQnCorrectionsManager::PrintFrameworkConfiguration() const {
 }
 
 
+/// Gets the calibration histograms list for the current process
+///
+/// With online calibration, if the calibration histograms do not have
+/// a list for the current process, the list with the data of all the
+/// processes is taken as warm start, e.g. the one of the previous run
+/// \return the calibration histograms list, NULL if none
+TList *AliQnCorrectionsManager::GetCalibrationProcessList() const {
+  if (fCalibrationHistogramsList == NULL) return NULL;
+
+  TList *processList = (TList *)fCalibrationHistogramsList->FindObject((const char *)fProcessListName);
+  if (processList == NULL && fOnlineCalibration) {
+    processList = (TList *)fCalibrationHistogramsList->FindObject(szAllProcessesListName);
+    if (processList != NULL) {
+      AliInfo(Form("No calibration histograms for process %s, %s taken as warm start for the online calibration",
+          fProcessListName.Data(), szAllProcessesListName));
+    }
+  }
+  return processList;
+}
+
 /// Produce the final output and release the framework.
 /// Produce the all data lists that collect data from all concurrent processes.
 void AliQnCorrectionsManager::FinalizeQnCorrectionsFramework() {
@@ -80,6 +80,18 @@ public:
   /// Enables disables the output of Qn vector on a TTree structure
   /// \param enable kTRUE for enabling Qn vector output into a TTree
   void SetShouldFillQnVectorTree(Bool_t enable = kTRUE) { fFillQnVectorTree = enable; }
+  /// Enables disables the online calibration
+  ///
+  /// The correction steps supporting it apply, already in the calibration pass,
+  /// the correction parameters accumulated so far in the ongoing pass once the
+  /// event class has the requested number of entries. The calibration
+  /// histograms of the previous run, i.e. the "all data" list of the calibration
+  /// file, are used as warm start when the file has no list for the current process.
+  /// Must be configured before the framework initialization.
+  /// \param enable kTRUE for enabling the online calibration
+  /// \param nMinNoOfEntries the minimum number of entries of an event class for applying its online parameters
+  void SetOnlineCalibration(Bool_t enable = kTRUE, Int_t nMinNoOfEntries = 100)
+  { fOnlineCalibration = enable; fOnlineCalibrationMinNoOfEntries = nMinNoOfEntries; }
 
   void AddDetector(AliQnCorrectionsDetector *detector);
 
@@ -104,6 +116,12 @@ public:
   /// Get whether the Qn vector tree should be populated
   /// \return kTRUE if the Qn vector should be written into a TTree
   Bool_t GetShouldFillQnVectorTree() const { return fFillQnVectorTree; }
+  /// Get whether the online calibration is enabled
+  /// \return kTRUE if the online calibration is enabled
+  Bool_t GetOnlineCalibration() const { return fOnlineCalibration; }
+  /// Get the minimum number of entries of an event class for applying its online parameters
+  /// \return the online calibration entries threshold
+  Int_t GetOnlineCalibrationMinNoOfEntries() const { return fOnlineCalibrationMinNoOfEntries; }
   /// Gets the output histograms list
   /// \return the list of histograms for building correction parameters
   TList *GetOutputHistogramsList() const { return fSupportHistogramsList; }
@@ -144,6 +162,8 @@ public:
   void FinalizeQnCorrectionsFramework();
 
 private:
+  TList *GetCalibrationProcessList() const;
+
   static const Int_t nMaxNoOfDetectors;              ///< the highest detector id currently supported by the framework
   static const Int_t nMaxNoOfDataVariables;          ///< the maximum number of variables currently supported by the framework
   static const char *szCalibrationHistogramsKeyName; ///< the name of the key under which calibration histograms lists are stored
@@ -164,6 +184,8 @@ private:
   Bool_t fFillQAHistograms;             ///< kTRUE if QA histograms must be filled
   Bool_t fFillNveQAHistograms;          ///< kTRUE if non validated entries QA histograms must be filled
   Bool_t fFillQnVectorTree;             ///< kTRUE if Qn vectors must be written in a TTree structure
+  Bool_t fOnlineCalibration;            ///< kTRUE if the correction parameters are applied while being accumulated
+  Int_t fOnlineCalibrationMinNoOfEntries; ///< entries of an event class for applying its online correction parameters
   TString fProcessListName;             ///< the name of the list associated to the current process
   TObjArray *fProcessesNames;           ///< array with the list of processes names
 
@@ -176,7 +198,7 @@ private:
   AliQnCorrectionsManager& operator= (const AliQnCorrectionsManager &);
 
 /// \cond CLASSIMP
-  ClassDef(AliQnCorrectionsManager, 5);
+  ClassDef(AliQnCorrectionsManager, 6);
 /// \endcond
 };
 
@@ -184,9 +184,8 @@ Bool_t AliQnCorrectionsProfileChannelized::CreateProfileHistograms(TList *histog
 /// \return the associated bin to the current variables content
 Long64_t AliQnCorrectionsProfileChannelized::GetBin(const Float_t *variableContainer, Int_t nChannel) {
 
-  FillBinAxesValues(variableContainer, fChannelMap[nChannel]);
-  /* store the channel number */
-  return fEntries->GetBin(fBinAxesValues);
+  /* the event class coordinates are kept among the channels of the event */
+  return fEntries->GetBin(FillBinAxesCoordinates(variableContainer, fEntries, fChannelMap[nChannel]));
 }
 
 /// Check the validity of the content of the passed bin
@@ -272,10 +271,12 @@ void AliQnCorrectionsProfileChannelized::Fill(const Float_t *variableContainer,
   /* keep the total entries in fValues updated */
   Double_t nEntries = fValues->GetEntries();
 
-  FillBinAxesValues(variableContainer, fChannelMap[nChannel]);
+  /* values and entries share the axes so, the bin is the same */
+  /* and the event class coordinates are kept among the channels of the event */
+  Long64_t bin = fEntries->GetBin(FillBinAxesCoordinates(variableContainer, fEntries, fChannelMap[nChannel]));
   /* and now update the bin */
-  fValues->Fill(fBinAxesValues, weight);
+  fValues->FillBin(bin, weight);
   fValues->SetEntries(nEntries + 1);
-  fEntries->Fill(fBinAxesValues, 1.0);
+  fEntries->FillBin(bin, 1.0);
 }
 
@@ -234,6 +234,7 @@ Bool_t AliQnCorrectionsProfileComponents::AttachHistograms(TList *histogramList)
   fXharmonicFillMask = 0x0000;
   fYharmonicFillMask = 0x0000;
   fFullFilled = 0x0000;
+  fCoordinatesHistogram = NULL;
 
   fEntries = (THnI *) histogramList->FindObject((const char*) entriesHistoName);
   if (fEntries != NULL && fEntries->GetEntries() != 0) {
@@ -272,8 +273,7 @@ Bool_t AliQnCorrectionsProfileComponents::AttachHistograms(TList *histogramList)
 /// \param variableContainer the current variables content addressed by var Id
 /// \return the associated bin to the current variables content
 Long64_t AliQnCorrectionsProfileComponents::GetBin(const Float_t *variableContainer) {
-  FillBinAxesValues(variableContainer);
-  return fEntries->GetBin(fBinAxesValues);
+  return fEntries->GetBin(FillBinAxesCoordinates(variableContainer, fEntries));
 }
 
 /// Check the validity of the content of the passed bin
@@ -457,8 +457,10 @@ void AliQnCorrectionsProfileComponents::FillX(Int_t harmonic, const Float_t *var
   /* keep total entries in fValues updated */
   Double_t nEntries = fXValues[harmonic]->GetEntries();
 
-  FillBinAxesValues(variableContainer);
-  fXValues[harmonic]->Fill(fBinAxesValues, weight);
+  /* the components and entries share the axes so, the bin is the same */
+  /* and the event class coordinates are kept among the harmonics of the event */
+  Long64_t bin = fEntries->GetBin(FillBinAxesCoordinates(variableContainer, fEntries));
+  fXValues[harmonic]->FillBin(bin, weight);
   fXValues[harmonic]->SetEntries(nEntries + 1);
 
   /* update harmonic fill mask */
@@ -468,7 +470,7 @@ void AliQnCorrectionsProfileComponents::FillX(Int_t harmonic, const Float_t *var
   if (fXharmonicFillMask != fFullFilled) return;
   if (fYharmonicFillMask != fFullFilled) return;
   /* update entries and reset the masks */
-  fEntries->Fill(fBinAxesValues, 1.0);
+  fEntries->FillBin(bin, 1.0);
   fXharmonicFillMask = 0x0000;
   fYharmonicFillMask = 0x0000;
 }
@@ -500,8 +502,10 @@ void AliQnCorrectionsProfileComponents::FillY(Int_t harmonic, const Float_t *var
   /* keep total entries in fValues updated */
   Double_t nEntries = fYValues[harmonic]->GetEntries();
 
-  FillBinAxesValues(variableContainer);
-  fYValues[harmonic]->Fill(fBinAxesValues, weight);
+  /* the components and entries share the axes so, the bin is the same */
+  /* and the event class coordinates are kept among the harmonics of the event */
+  Long64_t bin = fEntries->GetBin(FillBinAxesCoordinates(variableContainer, fEntries));
+  fYValues[harmonic]->FillBin(bin, weight);
   fYValues[harmonic]->SetEntries(nEntries + 1);
 
   /* update harmonic fill mask */
@@ -511,7 +515,7 @@ void AliQnCorrectionsProfileComponents::FillY(Int_t harmonic, const Float_t *var
   if (fYharmonicFillMask != fFullFilled) return;
   if (fXharmonicFillMask != fFullFilled) return;
   /* update entries and reset the masks */
-  fEntries->Fill(fBinAxesValues, 1.0);
+  fEntries->FillBin(bin, 1.0);
   fXharmonicFillMask = 0x0000;
   fYharmonicFillMask = 0x0000;
 }
@@ -35,6 +35,7 @@
 #include "AliQnCorrectionsProfileComponents.h"
 #include "AliQnCorrectionsHistogramSparse.h"
 #include "AliQnCorrectionsDetector.h"
+#include "AliQnCorrectionsManager.h"
 #include "AliLog.h"
 #include "AliQnCorrectionsQnVectorRecentering.h"
 
@@ -60,6 +61,8 @@ AliQnCorrectionsQnVectorRecentering::AliQnCorrectionsQnVectorRecentering() :
   fQAQnAverageHistogram = NULL;
   fApplyWidthEqualization = kFALSE;
   fMinNoOfEntriesToValidate = fDefaultMinNoOfEntries;
+  fOnlineCalibration = kFALSE;
+  fOnlineCorrected = kFALSE;
 }
 
 /// Default destructor
@@ -112,6 +115,12 @@ Bool_t AliQnCorrectionsQnVectorRecentering::CreateSupportHistograms(TList *list)
   fCalibrationHistograms = new AliQnCorrectionsProfileComponents((const char *) histoNameAndTitle, (const char *) histoNameAndTitle,
       fDetectorConfiguration->GetEventClassVariablesSet(), "s");
 
+  /* with online calibration the averages being collected are validated with the manager threshold */
+  AliQnCorrectionsManager *manager = fDetectorConfiguration->GetCorrectionsManager();
+  fOnlineCalibration = (manager != NULL) && manager->GetOnlineCalibration();
+  if (fOnlineCalibration)
+    fCalibrationHistograms->SetNoOfEntriesThreshold(manager->GetOnlineCalibrationMinNoOfEntries());
+
   /* get information about the configured harmonics to pass it for histogram creation */
   Int_t nNoOfHarmonics = fDetectorConfiguration->GetNoOfHarmonics();
   Int_t *harmonicsMap = new Int_t[nNoOfHarmonics];
@@ -170,15 +179,49 @@ Bool_t AliQnCorrectionsQnVectorRecentering::CreateNveQAHistograms(TList *list) {
   return kTRUE;
 }
 
+/// Recenters (and equalizes the width of) the current Qn vector
+///
+/// The result is stored in the corrected Qn vector
+/// \param histograms the histograms with the averages per event class
+/// \param bin the event class of the current event, already validated
+void AliQnCorrectionsQnVectorRecentering::CorrectQnVector(AliQnCorrectionsProfileComponents *histograms, Long64_t bin) {
+  Int_t harmonic = fDetectorConfiguration->GetCurrentQnVector()->GetFirstHarmonic();
+  while (harmonic != -1) {
+    Float_t widthX = 1.0;
+    Float_t widthY = 1.0;
+    if (fApplyWidthEqualization) {
+      widthX = histograms->GetXBinError(harmonic, bin);
+      widthY = histograms->GetYBinError(harmonic, bin);
+    }
+    fCorrectedQnVector->SetQx(harmonic, (fDetectorConfiguration->GetCurrentQnVector()->Qx(harmonic)
+        - histograms->GetXBinContent(harmonic, bin))
+        / widthX);
+    fCorrectedQnVector->SetQy(harmonic, (fDetectorConfiguration->GetCurrentQnVector()->Qy(harmonic)
+        - histograms->GetYBinContent(harmonic, bin))
+        / widthY);
+    harmonic = fDetectorConfiguration->GetCurrentQnVector()->GetNextHarmonic(harmonic);
+  }
+}
+
 /// Processes the correction step
 ///
 /// Pure virtual function
 /// \return kTRUE if the correction step was applied
 Bool_t AliQnCorrectionsQnVectorRecentering::ProcessCorrections(const Float_t *variableContainer) {
-  Int_t harmonic;
   switch (fState) {
   case QCORRSTEP_calibration:
     /* collect the data needed to further produce correction parameters if the current Qn vector is good enough */
+    /* with online calibration apply the averages already collected if the event class has enough entries */
+    if (fOnlineCalibration && fDetectorConfiguration->GetCurrentQnVector()->IsGoodQuality()) {
+      Long64_t bin = fCalibrationHistograms->GetBin(variableContainer);
+      if (fCalibrationHistograms->BinContentValidated(bin)) {
+        fCorrectedQnVector->Set(fDetectorConfiguration->GetCurrentQnVector(),kFALSE);
+        CorrectQnVector(fCalibrationHistograms, bin);
+        fDetectorConfiguration->UpdateCurrentQnVector(fCorrectedQnVector);
+        fOnlineCorrected = kTRUE;
+        return kTRUE;
+      }
+    }
     /* we have not perform any correction yet */
     return kFALSE;
     break;
@@ -190,27 +233,21 @@ Bool_t AliQnCorrectionsQnVectorRecentering::ProcessCorrections(const Float_t *va
     if (fDetectorConfiguration->GetCurrentQnVector()->IsGoodQuality()) {
       /* we get the properties of the current Qn vector but its name */
       fCorrectedQnVector->Set(fDetectorConfiguration->GetCurrentQnVector(),kFALSE);
-      harmonic = fDetectorConfiguration->GetCurrentQnVector()->GetFirstHarmonic();
 
       /* let's check the correction histograms */
+      AliQnCorrectionsProfileComponents *histograms = fInputHistograms;
       Long64_t bin = fInputHistograms->GetBin(variableContainer);
-      if (fInputHistograms->BinContentValidated(bin)) {
-        /* correction information validated */
-        while (harmonic != -1) {
-          Float_t widthX = 1.0;
-          Float_t widthY = 1.0;
-          if (fApplyWidthEqualization) {
-            widthX = fInputHistograms->GetXBinError(harmonic, bin);
-            widthY = fInputHistograms->GetYBinError(harmonic, bin);
-          }
-          fCorrectedQnVector->SetQx(harmonic, (fDetectorConfiguration->GetCurrentQnVector()->Qx(harmonic)
-              - fInputHistograms->GetXBinContent(harmonic, bin))
-              / widthX);
-          fCorrectedQnVector->SetQy(harmonic, (fDetectorConfiguration->GetCurrentQnVector()->Qy(harmonic)
-              - fInputHistograms->GetYBinContent(harmonic, bin))
-              / widthY);
-          harmonic = fDetectorConfiguration->GetCurrentQnVector()->GetNextHarmonic(harmonic);
+      if (fOnlineCalibration && (fState == QCORRSTEP_applyCollect)) {
+        /* the input histograms are the warm start, the averages of the ongoing pass take over once validated */
+        Long64_t onlineBin = fCalibrationHistograms->GetBin(variableContainer);
+        if (fCalibrationHistograms->BinContentValidated(onlineBin)) {
+          histograms = fCalibrationHistograms;
+          bin = onlineBin;
         }
+      }
+      if (histograms->BinContentValidated(bin)) {
+        /* correction information validated */
+        CorrectQnVector(histograms, bin);
       } /* correction information not validated, we leave the Q vector untouched */
       else {
         if (fQANotValidatedBin != NULL) fQANotValidatedBin->Fill(variableContainer, 1.0);
@@ -249,8 +286,19 @@ Bool_t AliQnCorrectionsQnVectorRecentering::ProcessDataCollection(const Float_t
         harmonic = fInputQnVector->GetNextHarmonic(harmonic);
       }
     }
+    /* with online calibration the event could have been already corrected, otherwise */
     /* we have not perform any correction yet */
-    return kFALSE;
+    if (!fOnlineCorrected)
+      return kFALSE;
+    /* provide QA info if required */
+    if (fQAQnAverageHistogram != NULL) {
+      harmonic = fCorrectedQnVector->GetFirstHarmonic();
+      while (harmonic != -1) {
+        fQAQnAverageHistogram->FillX(harmonic, variableContainer, fCorrectedQnVector->Qx(harmonic));
+        fQAQnAverageHistogram->FillY(harmonic, variableContainer, fCorrectedQnVector->Qy(harmonic));
+        harmonic = fCorrectedQnVector->GetNextHarmonic(harmonic);
+      }
+    }
     break;
   case QCORRSTEP_applyCollect:
     AliInfo(Form("Recentering process in detector %s: collecting data.", fDetectorConfiguration->GetName()));
@@ -287,6 +335,7 @@ Bool_t AliQnCorrectionsQnVectorRecentering::ProcessDataCollection(const Float_t
 void AliQnCorrectionsQnVectorRecentering::ClearCorrectionStep() {
 
   fCorrectedQnVector->Reset();
+  fOnlineCorrected = kFALSE;
 }
 
 /// Reports if the correction step is being applied
@@ -296,8 +345,8 @@ Bool_t AliQnCorrectionsQnVectorRecentering::IsBeingApplied() const {
   switch (fState) {
   case QCORRSTEP_calibration:
     /* we are collecting */
-    /* but not applying */
-    return kFALSE;
+    /* and applying only with online calibration */
+    return fOnlineCalibration;
     break;
   case QCORRSTEP_applyCollect:
     /* we are collecting */
@@ -324,8 +373,10 @@ Bool_t AliQnCorrectionsQnVectorRecentering::ReportUsage(TList *calibrationList,
   case QCORRSTEP_calibration:
     /* we are collecting */
     calibrationList->Add(new TObjString(szCorrectionName));
-    /* but not applying */
-    return kFALSE;
+    /* and applying only with online calibration */
+    if (!fOnlineCalibration)
+      return kFALSE;
+    applyList->Add(new TObjString(szCorrectionName));
     break;
   case QCORRSTEP_applyCollect:
     /* we are collecting */
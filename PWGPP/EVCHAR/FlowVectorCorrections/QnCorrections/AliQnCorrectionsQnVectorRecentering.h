@@ -50,6 +50,11 @@
 ///
 /// Correction and data collecting during calibration is performed for all harmonics
 /// defined within the involved detector configuration
+///
+/// With the online calibration of the framework manager the averages collected
+/// so far in the ongoing pass are applied, also in the calibration status, to the
+/// event classes that have the required number of entries. This lets the further
+/// correction steps collect their data in the same pass.
 
 #include "AliQnCorrectionsCorrectionOnQvector.h"
 
@@ -137,6 +142,8 @@ public:
   virtual Bool_t ReportUsage(TList *calibrationList, TList *applyList);
 
 private:
+  void CorrectQnVector(AliQnCorrectionsProfileComponents *histograms, Long64_t bin);
+
   static const Int_t fDefaultMinNoOfEntries;         ///< the minimum number of entries for bin content validation
   static const char *szCorrectionName;               ///< the name of the correction step
   static const char *szKey;                          ///< the key of the correction step for ordering purpose
@@ -151,9 +158,11 @@ private:
 
   Bool_t fApplyWidthEqualization;              ///< apply the width equalization step
   Int_t fMinNoOfEntriesToValidate;              ///< number of entries for bin content validation threshold
+  Bool_t fOnlineCalibration;                   //!<! apply the averages being collected in the ongoing pass
+  Bool_t fOnlineCorrected;                     //!<! the current event was corrected with the online averages
 
 /// \cond CLASSIMP
-  ClassDef(AliQnCorrectionsQnVectorRecentering, 3);
+  ClassDef(AliQnCorrectionsQnVectorRecentering, 4);
 /// \endcond
 };
 
@@ -82,6 +82,7 @@
 #pragma link C++ class AliAnalysisTaskITSTPCalignment+;
 
 #pragma link C++ class AliAnalysisTaskQASym+;
+#pragma link C++ class AliQATrendingAccumulator+;
 #pragma link C++ class AliAnaVZEROQA+;
 #pragma link C++ class AliAnaVZEROPbPb+;
 
@@ -601,6 +601,16 @@ TH1F* AliPerformanceMC::MakeResol(TH2F * his, Int_t integ, Bool_t type, Int_t cu
     return hisr;
 }
 
+//_____________________________________________________________________________
+TH1F* AliPerformanceMC::MakeResolAndMean(TH2F * his, TH1F *&hisMean, Int_t integ, Int_t cut){
+  // Create resolution and mean histograms with one set of bin fits
+  // (MakeResol() fits all bins to return one of the two);
+  // the bin fits are not drawn into a canvas of their own
+ 
+  if (!gPad) new TCanvas;
+  return AliTreeDraw::CreateResHistoII(his,&hisMean,integ,kFALSE,cut);
+}
+
 //_____________________________________________________________________________
 void AliPerformanceMC::Analyse() {
   // Analyse comparison information and store output histograms
@@ -631,7 +641,9 @@ void AliPerformanceMC::Analyse() {
 
       h2D = (TH2F*)fResolHisto->Projection(i,j);
 
-      h = AliPerformanceMC::MakeResol(h2D,1,0,20);
+      TH1F *hMean = 0;
+      h = AliPerformanceMC::MakeResolAndMean(h2D,hMean,1,20);
+      delete h2D;
       snprintf(name,256,"h_res_%d_vs_%d",i,j);
       h->SetName(name);
 
@@ -644,7 +656,7 @@ void AliPerformanceMC::Analyse() {
       if(j==9) h->SetBit(TH1::kLogX);    
       aFolderObj->Add(h);
 
-      h = AliPerformanceMC::MakeResol(h2D,1,1,20);
+      h = hMean;
       //h = (TH1F*)arr->At(1);
       snprintf(name,256,"h_mean_res_%d_vs_%d",i,j);
       h->SetName(name);
@@ -670,7 +682,9 @@ void AliPerformanceMC::Analyse() {
 
       h2D = (TH2F*)fPullHisto->Projection(i,j);
 
-      h = AliPerformanceMC::MakeResol(h2D,1,0,20);
+      TH1F *hMeanPull = 0;
+      h = AliPerformanceMC::MakeResolAndMean(h2D,hMeanPull,1,20);
+      delete h2D;
       snprintf(name,256,"h_pull_%d_vs_%d",i,j);
       h->SetName(name);
 
@@ -683,7 +697,7 @@ void AliPerformanceMC::Analyse() {
       //if(j==9) h->SetBit(TH1::kLogX);    
       aFolderObj->Add(h);
 
-      h = AliPerformanceMC::MakeResol(h2D,1,1,20);
+      h = hMeanPull;
       snprintf(name,256,"h_mean_pull_%d_vs_%d",i,j);
       h->SetName(name);
 
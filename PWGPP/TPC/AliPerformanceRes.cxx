@@ -1005,6 +1005,16 @@ TH1F* AliPerformanceRes::MakeResol(TH2F * his, Int_t integ, Bool_t type, Int_t c
     return hisr;
 }
 
+//_____________________________________________________________________________
+TH1F* AliPerformanceRes::MakeResolAndMean(TH2F * his, TH1F *&hisMean, Int_t integ, Int_t cut){
+  // Create resolution and mean histograms with one set of bin fits
+  // (MakeResol() fits all bins to return one of the two);
+  // the bin fits are not drawn into a canvas of their own
+ 
+  if (!gPad) new TCanvas;
+  return AliTreeDraw::CreateResHistoII(his,&hisMean,integ,kFALSE,cut);
+}
+
 //_____________________________________________________________________________
 void AliPerformanceRes::Analyse() {
   // Analyse comparison information and store output histograms
@@ -1034,7 +1044,9 @@ void AliPerformanceRes::Analyse() {
 
       h2D = (TH2F*)fResolHisto->Projection(i,j);
 
-      h = AliPerformanceRes::MakeResol(h2D,1,0,100);
+      TH1F *hMean = 0;
+      h = AliPerformanceRes::MakeResolAndMean(h2D,hMean,1,100);
+      delete h2D;
       snprintf(name,256,"h_res_%d_vs_%d",i,j);
       h->SetName(name);
 
@@ -1047,7 +1059,7 @@ void AliPerformanceRes::Analyse() {
       if(j==9) h->SetBit(TH1::kLogX);    
       aFolderObj->Add(h);
 
-      h = AliPerformanceRes::MakeResol(h2D,1,1,100);
+      h = hMean;
       //h = (TH1F*)arr->At(1);
       snprintf(name,256,"h_mean_res_%d_vs_%d",i,j);
       h->SetName(name);
@@ -1074,7 +1086,9 @@ void AliPerformanceRes::Analyse() {
 
       h2D = (TH2F*)fPullHisto->Projection(i,j);
 
-      h = AliPerformanceRes::MakeResol(h2D,1,0,100);
+      TH1F *hMeanPull = 0;
+      h = AliPerformanceRes::MakeResolAndMean(h2D,hMeanPull,1,100);
+      delete h2D;
       snprintf(name,256,"h_pull_%d_vs_%d",i,j);
       h->SetName(name);
 
@@ -1087,7 +1101,7 @@ void AliPerformanceRes::Analyse() {
       //if(j==9) h->SetBit(TH1::kLogX);    
       aFolderObj->Add(h);
 
-      h = AliPerformanceRes::MakeResol(h2D,1,1,100);
+      h = hMeanPull;
       snprintf(name,256,"h_mean_pull_%d_vs_%d",i,j);
       h->SetName(name);
 
@@ -74,6 +74,7 @@ public :
   AliMCInfoCuts*   GetAliMCInfoCuts()  const {return fCutsMC;}  
 
   TH1F*  MakeResol(TH2F * his, Int_t integ=0, Bool_t type=kFALSE, Int_t cut=0); 
+  TH1F*  MakeResolAndMean(TH2F * his, TH1F *&hisMean, Int_t integ=0, Int_t cut=0);
 
   // getters
   //
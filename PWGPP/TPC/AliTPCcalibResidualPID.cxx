@@ -1377,6 +1377,32 @@ void AliTPCcalibResidualPID::Terminate(const Option_t *)
 
 
 
+//________________________________________________________________________
+THnSparse* AliTPCcalibResidualPID::ProjectSelectionAxes(THnSparse *h)
+{
+  //
+  // The residual graphs only select on the axes 0-5 of the pidQA histo (see InitialisePIDQAHist),
+  // everything else (centrality) is integrated over in each of their projections.
+  // Integrate it out once, so that the many projections run over a much smaller sparse histo.
+  // Returns h itself if there is nothing to integrate out or if a range is set on any axis
+  // (the projections of h are then made exactly as before)
+  //
+  const Int_t kNdimSelection = 6;
+  if (h->GetNdimensions() <= kNdimSelection) return h;
+  for (Int_t i = 0; i < h->GetNdimensions(); i++) {
+    if (h->GetAxis(i)->TestBit(TAxis::kAxisRange)) return h;
+  }
+  Int_t dims[kNdimSelection];
+  for (Int_t i = 0; i < kNdimSelection; i++) dims[i] = i;
+  
+  THnSparse *hProj = h->Projection(kNdimSelection, dims, h->GetCalculateErrors() ? "E" : "");
+  // same name as h, the projections of hProj are then named as those of h
+  hProj->SetNameTitle(h->GetName(), h->GetTitle());
+  
+  return hProj;
+}
+
+
 //________________________________________________________________________
 void AliTPCcalibResidualPID::BinLogAxis(THnSparseF *h, Int_t axisNumber)
 {
@@ -1592,7 +1618,7 @@ TObjArray * AliTPCcalibResidualPID::GetResidualGraphs(THnSparseF * histPidQA, co
   Int_t cutForFitting = 10;
   Double_t heightFractionForFittingRange = 0.1;
   //
-  THnSparse * hist = histPidQA;
+  THnSparse * hist = ProjectSelectionAxes(histPidQA);
   //
   TCanvas * canvasQAtpc = new TCanvas("canvasQAtpcResGraph","Control canvas for residual graphs (TPC)",100,10,1380,800);
   canvasQAtpc->Divide(2,2);
@@ -2750,6 +2776,8 @@ TObjArray * AliTPCcalibResidualPID::GetResidualGraphs(THnSparseF * histPidQA, co
   canvasQAv0DeDxPurityPi->SaveAs("V0_dEdx_purity_Pi.root");
   canvasQAv0DeDxPurityPr->SaveAs("V0_dEdx_purity_Pr.root");
 
+  if (hist != histPidQA) delete hist;
+
   return arrGraphs;
 
 }
@@ -2768,7 +2796,7 @@ TObjArray * AliTPCcalibResidualPID::GetResidualGraphsMC(THnSparseF * histPidQA,
   Double_t heightFractionForFittingRange = 0.1; 
   
   //
-  THnSparse * hist = histPidQA;
+  THnSparse * hist = ProjectSelectionAxes(histPidQA);
   //
   TCanvas * canvasQAmc = new TCanvas("canvasQAmcResGraph","Control canvas for residual graphs (MC)",100,10,1380,800);
   canvasQAmc->Divide(2,2);
@@ -3083,6 +3111,8 @@ TObjArray * AliTPCcalibResidualPID::GetResidualGraphsMC(THnSparseF * histPidQA,
   
   canvasQAmc->SaveAs("splines_QA_ResidualGraphsTPC.root");
 
+  if (hist != histPidQA) delete hist;
+
   return arrGraphs;
 
 }
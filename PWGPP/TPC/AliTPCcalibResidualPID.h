@@ -33,6 +33,7 @@ class TArrayF;
 template <class X>
 class THnSparseT;
 typedef class THnSparseT<TArrayF> THnSparseF;
+class THnSparse;
 class TFile;
 class TGraphErrors;
 class AliESDEvent;
@@ -157,6 +158,7 @@ class AliTPCcalibResidualPID : public AliAnalysisTaskSE {
   static Double_t SaturatedLund(Double_t* xx, Double_t* par);
   
   static void BinLogAxis(THnSparseF *h, Int_t axisNumber);
+  static THnSparse* ProjectSelectionAxes(THnSparse *h);
   static THnSparseF* InitialisePIDQAHist(TString name, TString title);
   static void  SetAxisNamesFromTitle(const THnSparseF *h);
 
@@ -69,7 +69,7 @@ AliAnalysisTaskUpcFilter::AliAnalysisTaskUpcFilter(const char *name)
  :AliAnalysisTaskSE(name),
   fIsESD(0), fIsMC(0), fFillSPD(0), fMuonCuts(0x0), fTriggerAna(0x0), fCutsList(0x0), fPIDResponse(0x0), fMuonCutsPassName(0x0),
   fHistList(0x0), fCounter(0x0), fTriggerCounter(0x0), fMuonCounter(0x0),
-  fUPCEvent(0x0), fUPCTree(0x0)
+  fUPCEvent(0x0), fUPCTree(0x0), fTrgBits(0), fNtracks(0), fNmuons(0)
 {
 
   // Constructor
@@ -241,6 +241,11 @@ void AliAnalysisTaskUpcFilter::UserCreateOutputObjects()
   fUPCTree = new TTree("fUPCTree", "fUPCTree");
   pwd->cd();
   fUPCTree->Branch("fUPCEvent", &fUPCEvent);
+  //summary of the event in separate small branches, allows to select the events
+  //without reading them, see AliUPCEvent::MakeEntryList
+  fUPCTree->Branch("fTrgBits", &fTrgBits, "fTrgBits/l");
+  fUPCTree->Branch("fNtracks", &fNtracks, "fNtracks/I");
+  fUPCTree->Branch("fNmuons", &fNmuons, "fNmuons/I");
 
   PostData(1, fUPCTree);
   PostData(2, fHistList);
@@ -432,6 +437,10 @@ void AliAnalysisTaskUpcFilter::UserExec(Option_t *)
 
   fCounter->Fill( kWritten ); // events written to the tree (ESD and AOD)
 
+  fTrgBits = fUPCEvent->GetTriggerBits();
+  fNtracks = fUPCEvent->GetNumberOfTracks();
+  fNmuons = fUPCEvent->GetNumberOfMuonTracks();
+
   fUPCTree ->Fill();
 
   PostData(1, fUPCTree);
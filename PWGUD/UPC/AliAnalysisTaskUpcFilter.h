@@ -59,11 +59,14 @@ class AliAnalysisTaskUpcFilter : public AliAnalysisTaskSE {
   TH1I *fMuonCounter;
   AliUPCEvent *fUPCEvent; // output UPC event
   TTree *fUPCTree; // output tree
+  ULong64_t fTrgBits; // summary branch, fired trigger classes as bits (AliUPCEvent::MakeEntryList)
+  Int_t fNtracks; // summary branch, number of central tracks
+  Int_t fNmuons; // summary branch, number of muon tracks
 
   enum EvtCount{ kAna=1, kTrg, kSpecific, kPass1, kPass2, kPassX, kWritten, kAOD, kMunTrack, kCenTrack, kESD, kPidErr };
   enum MuonCount{kMunAll=1, kMunRabs, kMunEta, kMunPDCA};
 
-  ClassDef(AliAnalysisTaskUpcFilter, 1); 
+  ClassDef(AliAnalysisTaskUpcFilter, 2); 
 };
 
 #endif
@@ -13,6 +13,9 @@
 #include "TClonesArray.h"
 #include "TParticle.h"
 #include "TBits.h"
+#include "TTree.h"
+#include "TBranch.h"
+#include "TEntryList.h"
 
 #include "AliUPCTrack.h"
 #include "AliUPCMuonTrack.h"
@@ -353,6 +356,69 @@ Bool_t AliUPCEvent::GetFlagBit(UChar_t ibit) const
 
 }
 
+//_____________________________________________________________________________
+ULong64_t AliUPCEvent::GetTriggerBits(void) const
+{
+  // fired trigger classes as bits, bit idx for trigger class idx
+
+  ULong64_t bits = 0;
+  for(Int_t itrg=0; itrg<fgkNtrg; itrg++) {
+    if( fTrgClasses[itrg] ) bits |= (1ULL << itrg);
+  }
+  return bits;
+}
+
+//_____________________________________________________________________________
+TEntryList *AliUPCEvent::MakeEntryList(TTree *tree, Int_t trgClass, Int_t ntracks, Int_t nmuons)
+{
+  // list of the entries of the upc filter tree with the trigger class trgClass fired,
+  // ntracks central tracks and nmuons muon tracks, -1 = no selection;
+  // only the summary branches fTrgBits, fNtracks and fNmuons of AliAnalysisTaskUpcFilter
+  // are read, the list is given to tree->SetEntryList() to read only the selected events;
+  // the caller owns the list
+
+  if(!tree) return 0x0;
+  TBranch *brTrg = tree->GetBranch("fTrgBits");
+  TBranch *brTrk = tree->GetBranch("fNtracks");
+  TBranch *brMun = tree->GetBranch("fNmuons");
+  if( !brTrg || !brTrk || !brMun ) {
+    ::Error("AliUPCEvent::MakeEntryList", "tree %s has no summary branches", tree->GetName());
+    return 0x0;
+  }
+
+  ULong64_t trgBits = 0;
+  Int_t nTrk = 0, nMun = 0;
+  brTrg->SetAddress(&trgBits);
+  brTrk->SetAddress(&nTrk);
+  brMun->SetAddress(&nMun);
+
+  TEntryList *list = new TEntryList(Form("%s_list", tree->GetName()), tree->GetName(), tree);
+  const Long64_t nent = tree->GetEntries();
+  for(Long64_t ient=0; ient<nent; ient++) {
+    Long64_t local = tree->LoadTree(ient);
+    if(local < 0) break;
+    if(trgClass >= 0) {
+      brTrg->GetEntry(local);
+      if( !(trgBits & (1ULL << trgClass)) ) continue;
+    }
+    if(ntracks >= 0) {
+      brTrk->GetEntry(local);
+      if(nTrk != ntracks) continue;
+    }
+    if(nmuons >= 0) {
+      brMun->GetEntry(local);
+      if(nMun != nmuons) continue;
+    }
+    list->Enter(ient, tree);
+  }
+
+  tree->ResetBranchAddress(brTrg);
+  tree->ResetBranchAddress(brTrk);
+  tree->ResetBranchAddress(brMun);
+
+  return list;
+}
+
 //_____________________________________________________________________________
 Bool_t AliUPCEvent::GetTriggerClass(Int_t idx) const
 {
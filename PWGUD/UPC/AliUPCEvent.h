@@ -10,6 +10,8 @@
 
 class TBits;
 class TParticle;
+class TTree;
+class TEntryList;
 class AliUPCTrack;
 class AliUPCMuonTrack;
 
@@ -165,6 +167,11 @@ public:
   TArrayI *GetArrayInt(void) const { return fArrayInt; }
   TArrayD *GetArrayD(void) const { return fArrayD; }
 
+  ULong64_t GetTriggerBits(void) const;
+
+  //selection on the summary branches of the filter tree, without reading the events
+  static TEntryList *MakeEntryList(TTree *tree, Int_t trgClass=-1, Int_t ntracks=-1, Int_t nmuons=-1);
+
 protected:
   AliUPCEvent(const AliUPCEvent &o); // not implemented
   AliUPCEvent &operator=(const AliUPCEvent &o); // not implemented
@@ -125,6 +125,8 @@ Long64_t AliCorrectionMatrix::Merge(TCollection* list)
   if (list->IsEmpty())
     return 1;
 
+  FlushFills();
+
   TIterator* iter = list->MakeIterator();
   TObject* obj;
 
@@ -139,6 +141,7 @@ Long64_t AliCorrectionMatrix::Merge(TCollection* list)
     if (entry == 0) 
       continue;
 
+    entry->FlushFills();
     collectionMeas->Add(entry->GetMeasuredHistogram());
     collectionGene->Add(entry->GetGeneratedHistogram());
 
@@ -160,6 +163,8 @@ void AliCorrectionMatrix::Divide()
   // divides generated by measured to get the correction
   //
 
+  FlushFills();
+
   if (!fhMeas || !fhGene || !fhCorr) {
     AliDebug(AliLog::kError, "measured or generated histograms not available");
     return;
@@ -185,6 +190,8 @@ void AliCorrectionMatrix::Multiply()
   // multiplies measured with correction to get the generated
   //
 
+  FlushFills();
+
   if (!fhMeas || !fhGene || !fhCorr)
     return;
 
@@ -198,6 +205,9 @@ void AliCorrectionMatrix::Add(AliCorrectionMatrix* aMatrixToAdd, Float_t c) {
   // 
   // NB: the correction will naturally stay the same
   
+  FlushFills();
+  aMatrixToAdd->FlushFills();
+
   fhMeas->Add(aMatrixToAdd->GetMeasuredHistogram(), c);
   fhGene->Add(aMatrixToAdd->GetGeneratedHistogram(), c);
 }
@@ -264,6 +274,8 @@ void AliCorrectionMatrix::SaveHistograms()
   // saves the histograms
   //
 
+  FlushFills();
+
   gDirectory->mkdir(GetName());
   gDirectory->cd(GetName());
 
@@ -287,6 +299,8 @@ void AliCorrectionMatrix::DrawHistograms(const Char_t* canvasName)
   // if canvasName is 0 the name of this object is taken
   //
 
+  FlushFills();
+
   if (!canvasName)
     canvasName = Form("%s_canvas", GetName());
 
@@ -317,6 +331,8 @@ void AliCorrectionMatrix::ReduceInformation()
   // this function deletes the measured and generated histograms to reduce the amount of data
   // in memory
 
+  FlushFills();
+
   if (fhMeas)
   {
     delete fhMeas;
@@ -335,6 +351,8 @@ void AliCorrectionMatrix::Reset(Option_t* option)
 {
   // resets the histograms
 
+  FlushFills();
+
   if (fhGene)
     fhGene->Reset(option);
 
@@ -369,6 +387,8 @@ void AliCorrectionMatrix::Scale(Double_t factor)
 
   Printf("Scaling histograms with %f", factor);
 
+  FlushFills();
+
   fhMeas->Scale(factor);
   fhGene->Scale(factor);
 }
@@ -58,6 +58,8 @@ public:
 
   virtual void Reset(Option_t* option = "");
 
+  virtual void FlushFills() {}
+
 protected:
   TH1*    fhMeas;  // histogram of measured particles (or tracks)
   TH1*    fhGene;  // histogram of generated particles
@@ -23,16 +23,77 @@
 //____________________________________________________________________
 ClassImp(AliCorrectionMatrix3D)
 
+namespace
+{
+  // maximum number of buffered fills (x, y, z, weight) per histogram before they are added
+  const UInt_t kMaxBatchSize = 4 * 10000;
+
+  // bin lookup on one axis with the same result as TAxis::FindBin
+  // for variable bins the bin is first estimated with the average inverse bin width and then
+  // moved to the right one, this is one or two comparisons for (almost) uniform bins
+  class AxisLookup
+  {
+  public:
+    AxisLookup(TAxis* axis) :
+      fAxis(axis),
+      fNBins(axis->GetNbins()),
+      fMin(axis->GetXmin()),
+      fMax(axis->GetXmax()),
+      fInvWidth(axis->GetNbins() / (axis->GetXmax() - axis->GetXmin())),
+      fEdges((axis->GetXbins()->GetSize() > 0) ? axis->GetXbins()->GetArray() : 0)
+    {
+    }
+
+    Int_t FindBin(Double_t x) const
+    {
+      // fixed bins and non-finite values are left to TAxis
+      if (!fEdges || !TMath::Finite(x))
+        return fAxis->FindBin(x);
+
+      if (x < fMin)
+        return 0;
+      if (!(x < fMax))
+        return fNBins + 1;
+
+      Int_t bin = 1 + (Int_t) ((x - fMin) * fInvWidth);
+      if (bin > fNBins)
+        bin = fNBins;
+      while (bin > 1 && x < fEdges[bin-1])
+        --bin;
+      while (bin < fNBins && x >= fEdges[bin])
+        ++bin;
+
+      return bin;
+    }
+
+    Bool_t IsOverflow(Int_t bin) const { return (bin == 0 || bin > fNBins); }
+
+  private:
+    TAxis* fAxis;            // axis
+    Int_t fNBins;            // number of bins
+    Double_t fMin;           // lower edge
+    Double_t fMax;           // upper edge
+    Double_t fInvWidth;      // inverse of the average bin width
+    const Double_t* fEdges;  // bin edges, 0 for fixed bins
+  };
+}
+
 //____________________________________________________________________
 AliCorrectionMatrix3D::AliCorrectionMatrix3D() :
-  AliCorrectionMatrix()
+  AliCorrectionMatrix(),
+  fBatchFill(kFALSE),
+  fBatchMeas(),
+  fBatchGene()
 {
   // default constructor
 }
 
 //____________________________________________________________________
 AliCorrectionMatrix3D::AliCorrectionMatrix3D(const AliCorrectionMatrix3D& c)
-  : AliCorrectionMatrix(c)
+  : AliCorrectionMatrix(c),
+  fBatchFill(kFALSE),
+  fBatchMeas(),
+  fBatchGene()
 {
   // copy constructor
   ((AliCorrectionMatrix3D &)c).Copy(*this);
@@ -54,7 +115,10 @@ AliCorrectionMatrix3D::AliCorrectionMatrix3D(const Char_t* name, const Char_t* t
               Int_t nBinX, Float_t Xmin, Float_t Xmax,
               Int_t nBinY, Float_t Ymin, Float_t Ymax,
               Int_t nBinZ, Float_t Zmin, Float_t Zmax)
-  : AliCorrectionMatrix(name, title)
+  : AliCorrectionMatrix(name, title),
+  fBatchFill(kFALSE),
+  fBatchMeas(),
+  fBatchGene()
 {
   //
   // constructor
@@ -83,7 +147,10 @@ AliCorrectionMatrix3D::AliCorrectionMatrix3D(const Char_t* name, const Char_t* t
       Int_t nBinX, Float_t Xmin, Float_t Xmax,
       Int_t nBinY, Float_t Ymin, Float_t Ymax,
       Int_t nBinZ, const Float_t* zbins)
-  : AliCorrectionMatrix(name, title)
+  : AliCorrectionMatrix(name, title),
+  fBatchFill(kFALSE),
+  fBatchMeas(),
+  fBatchGene()
 {
   // constructor with variable bin sizes
 
@@ -102,7 +169,10 @@ AliCorrectionMatrix3D::AliCorrectionMatrix3D(const Char_t* name, const Char_t* t
 }
 
 AliCorrectionMatrix3D::AliCorrectionMatrix3D(const Char_t* name, const Char_t* title, TH3* hBinning)
-  : AliCorrectionMatrix(name, title)
+  : AliCorrectionMatrix(name, title),
+  fBatchFill(kFALSE),
+  fBatchMeas(),
+  fBatchGene()
 {
   // constructor with variable bin sizes (uses binning of hBinning)
 
@@ -166,6 +236,8 @@ AliCorrectionMatrix3D::~AliCorrectionMatrix3D()
 TH3* AliCorrectionMatrix3D::GetGeneratedHistogram()
 {
   // return generated histogram casted to correct type
+  if (!fBatchGene.empty())
+    FillBatch(dynamic_cast<TH3F*> (fhGene), fBatchGene);
   return dynamic_cast<TH3F*> (fhGene);
 }
 
@@ -173,6 +245,8 @@ TH3* AliCorrectionMatrix3D::GetGeneratedHistogram()
 TH3* AliCorrectionMatrix3D::GetMeasuredHistogram()
 {
   // return measured histogram casted to correct type
+  if (!fBatchMeas.empty())
+    FillBatch(dynamic_cast<TH3F*> (fhMeas), fBatchMeas);
   return dynamic_cast<TH3F*> (fhMeas);
 }
 
@@ -285,6 +359,18 @@ TH1* AliCorrectionMatrix3D::Get1DCorrectionHistogram(Option_t* opt, Float_t aMin
 void AliCorrectionMatrix3D::FillMeas(Float_t ax, Float_t ay, Float_t az, Double_t weight)
 {
   // add value to measured histogram
+
+  if (fBatchFill)
+  {
+    fBatchMeas.push_back(ax);
+    fBatchMeas.push_back(ay);
+    fBatchMeas.push_back(az);
+    fBatchMeas.push_back(weight);
+    if (fBatchMeas.size() >= kMaxBatchSize)
+      FillBatch(dynamic_cast<TH3F*> (fhMeas), fBatchMeas);
+    return;
+  }
+
   GetMeasuredHistogram()->Fill(ax, ay, az, weight);
 }
 
@@ -292,9 +378,124 @@ void AliCorrectionMatrix3D::FillMeas(Float_t ax, Float_t ay, Float_t az, Double_
 void AliCorrectionMatrix3D::FillGene(Float_t ax, Float_t ay, Float_t az, Double_t weight)
 {
   // add value to generated histogram
+
+  if (fBatchFill)
+  {
+    fBatchGene.push_back(ax);
+    fBatchGene.push_back(ay);
+    fBatchGene.push_back(az);
+    fBatchGene.push_back(weight);
+    if (fBatchGene.size() >= kMaxBatchSize)
+      FillBatch(dynamic_cast<TH3F*> (fhGene), fBatchGene);
+    return;
+  }
+
   GetGeneratedHistogram()->Fill(ax, ay, az, weight);
 }
 
+//____________________________________________________________________
+void AliCorrectionMatrix3D::SetBatchFill(Bool_t flag)
+{
+  //
+  // if flag is set, FillMeas and FillGene only buffer the values, they are added to the histograms
+  // by FlushFills (which is called by Divide, Merge, SaveHistograms, ... and by the histogram getters)
+  // the buffered fills are not streamed: call FlushFills at the end of each event before the
+  // object is written or copied
+  //
+
+  if (!flag)
+    FlushFills();
+
+  fBatchFill = flag;
+}
+
+//____________________________________________________________________
+void AliCorrectionMatrix3D::FlushFills()
+{
+  // adds the buffered fills to the measured and generated histograms
+
+  if (!fBatchMeas.empty())
+    FillBatch(dynamic_cast<TH3F*> (fhMeas), fBatchMeas);
+  if (!fBatchGene.empty())
+    FillBatch(dynamic_cast<TH3F*> (fhGene), fBatchGene);
+}
+
+//____________________________________________________________________
+void AliCorrectionMatrix3D::FillBatch(TH3* hist, std::vector<Double_t>& batch)
+{
+  //
+  // adds the buffered fills in batch to hist and clears batch
+  // the bins are found with the precomputed axis lookup and the statistics are updated once,
+  // the result is the same as with TH3::Fill for each entry
+  //
+
+  if (!hist)
+  {
+    batch.clear();
+    return;
+  }
+
+  const UInt_t nEntries = batch.size() / 4;
+
+  // with a range set on an axis the statistics are recomputed by TH1::GetStats, keep TH3::Fill
+  if (hist->GetXaxis()->TestBit(TAxis::kAxisRange) || hist->GetYaxis()->TestBit(TAxis::kAxisRange) || hist->GetZaxis()->TestBit(TAxis::kAxisRange))
+  {
+    for (UInt_t i=0; i<nEntries; ++i)
+      hist->Fill(batch[4*i], batch[4*i+1], batch[4*i+2], batch[4*i+3]);
+    batch.clear();
+    return;
+  }
+
+  AxisLookup lookupX(hist->GetXaxis());
+  AxisLookup lookupY(hist->GetYaxis());
+  AxisLookup lookupZ(hist->GetZaxis());
+
+  Double_t* sumw2 = (hist->GetSumw2N() > 0) ? hist->GetSumw2()->GetArray() : 0;
+  const Bool_t statOverflows = TH1::StatOverflows();
+
+  // sumw, sumw2, sumwx, sumwx2, sumwy, sumwy2, sumwxy, sumwz, sumwz2, sumwxz, sumwyz
+  Double_t stats[11];
+  hist->GetStats(stats);
+
+  for (UInt_t i=0; i<nEntries; ++i)
+  {
+    const Double_t x = batch[4*i];
+    const Double_t y = batch[4*i+1];
+    const Double_t z = batch[4*i+2];
+    const Double_t w = batch[4*i+3];
+
+    const Int_t binX = lookupX.FindBin(x);
+    const Int_t binY = lookupY.FindBin(y);
+    const Int_t binZ = lookupZ.FindBin(z);
+    const Int_t bin = hist->GetBin(binX, binY, binZ);
+
+    hist->AddBinContent(bin, w);
+    if (sumw2)
+      sumw2[bin] += w * w;
+
+    if (!statOverflows && (lookupX.IsOverflow(binX) || lookupY.IsOverflow(binY) || lookupZ.IsOverflow(binZ)))
+      continue;
+
+    stats[0] += w;
+    stats[1] += w * w;
+    stats[2] += w * x;
+    stats[3] += w * x * x;
+    stats[4] += w * y;
+    stats[5] += w * y * y;
+    stats[6] += w * x * y;
+    stats[7] += w * z;
+    stats[8] += w * z * z;
+    stats[9] += w * x * z;
+    stats[10] += w * y * z;
+  }
+
+  const Double_t entries = hist->GetEntries();
+  hist->PutStats(stats);
+  hist->SetEntries(entries + nEntries);
+
+  batch.clear();
+}
+
 //____________________________________________________________________
 Float_t AliCorrectionMatrix3D::GetCorrection(Float_t ax, Float_t ay, Float_t az) const
 {
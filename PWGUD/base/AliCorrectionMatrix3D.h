@@ -9,6 +9,8 @@
 //
 // ------------------------------------------------------
 
+#include <vector>
+
 #include <AliCorrectionMatrix.h>
 #include <AliCorrectionMatrix2D.h>
 
@@ -53,6 +55,10 @@ public:
   void FillMeas(Float_t ax, Float_t ay, Float_t az, Double_t weight = 1.);
   void FillGene(Float_t ax, Float_t ay, Float_t az, Double_t weight = 1.);
 
+  void SetBatchFill(Bool_t flag = kTRUE);
+  Bool_t GetBatchFill() const { return fBatchFill; }
+  virtual void FlushFills();
+
   Float_t GetCorrection(Float_t ax, Float_t ay, Float_t az) const;
 
   void RemoveEdges(Float_t cut=2, Int_t nBinsXedge = 0, Int_t nBinsYedge = 0, Int_t nBinsZedge = 0);
@@ -64,7 +70,13 @@ public:
 
 
 protected:
-  ClassDef(AliCorrectionMatrix3D,1)
+  void FillBatch(TH3* hist, std::vector<Double_t>& batch);
+
+  Bool_t fBatchFill;                 //! if true FillMeas and FillGene are buffered until FlushFills
+  std::vector<Double_t> fBatchMeas;  //! buffered fills of the measured histogram (x, y, z, weight)
+  std::vector<Double_t> fBatchGene;  //! buffered fills of the generated histogram (x, y, z, weight)
+
+  ClassDef(AliCorrectionMatrix3D,2)
 };
 
 #endif
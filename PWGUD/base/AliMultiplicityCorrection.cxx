@@ -1448,7 +1448,7 @@ TH1* AliMultiplicityCorrection::CalculateStdDev(TH1** results, Int_t max)
 }
 
 //____________________________________________________________________
-TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType methodType, Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType, Int_t zeroBinEvents, Bool_t randomizeMeasured, Bool_t randomizeResponse, const TH1* compareTo)
+TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType methodType, Int_t inputRange, Bool_t fullPhaseSpace, EventType eventType, Int_t zeroBinEvents, Bool_t randomizeMeasured, Bool_t randomizeResponse, const TH1* compareTo, Bool_t startFromFirstResult)
 {
   //
   // evaluates the uncertainty that arises from the non-infinite statistics in the response matrix
@@ -1457,6 +1457,10 @@ TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType
   // these unfolded results are compared to the first result gained with the default response OR to the histogram given
   // in <compareTo> (optional)
   //
+  // if <startFromFirstResult> is set (chi2 minimization only), the randomized samples are unfolded starting
+  // from the first unfolded result instead of the default initial conditions, the minimizations then start
+  // close to their minimum and need much fewer function calls
+  //
   // returns the error assigned to the measurement
   //
 
@@ -1477,6 +1481,7 @@ TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType
 
   TH1* maxError = 0;
   TH1* firstResult = 0;
+  TH1* firstUnfolded = 0;
 
   TH1** results = new TH1*[kErrorIterations];
 
@@ -1551,13 +1556,22 @@ TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType
     {
       result = (TH1*) fMultiplicityESDCorrected[correlationID]->Clone(Form("result_%d", n));
 
-      Int_t returnCode = AliUnfolding::Unfold(fCurrentCorrelation, fCurrentEfficiency, measured, 0, result);
+      TH1* initialConditions = 0;
+      if (firstUnfolded)
+        initialConditions = (TH1*) firstUnfolded->Clone("initialConditions");
+
+      Int_t returnCode = AliUnfolding::Unfold(fCurrentCorrelation, fCurrentEfficiency, measured, initialConditions, result);
+
+      delete initialConditions;
 
       if (returnCode != 0)
       {
 	n--;
 	continue;
       }
+
+      if (startFromFirstResult && methodType == AliUnfolding::kChi2Minimization && !firstUnfolded)
+        firstUnfolded = (TH1*) result->Clone("firstUnfolded");
     }
 
     // normalize
@@ -1686,6 +1700,7 @@ TH1* AliMultiplicityCorrection::StatisticalUncertainty(AliUnfolding::MethodType
   for (Int_t n=0; n<kErrorIterations; ++n)
     delete results[n];
   delete[] results;
+  delete firstUnfolded;
 
   // fill into result histogram
   for (Int_t i=1; i<=fMultiplicityESDCorrected[correlationID]->GetNbinsX(); ++i)
@@ -369,6 +369,35 @@ void AlidNdEtaCorrection::FillEvent(Float_t vtx, Float_t n, Bool_t trigger, Bool
   fVertexRecoCorrection->GetEventCorrection()->FillMeas(vtx, n);
 }
 
+//____________________________________________________________________
+void AlidNdEtaCorrection::SetBatchFill(Bool_t flag)
+{
+  //
+  // buffers the fills of the track level corrections, see AliCorrectionMatrix3D::SetBatchFill
+  // FlushFills has to be called at the end of each event
+  //
+
+  fTrack2ParticleCorrection         ->GetTrackCorrection()->SetBatchFill(flag);
+  fVertexRecoCorrection             ->GetTrackCorrection()->SetBatchFill(flag);
+  fTriggerBiasCorrectionMBToINEL    ->GetTrackCorrection()->SetBatchFill(flag);
+  fTriggerBiasCorrectionMBToNSD     ->GetTrackCorrection()->SetBatchFill(flag);
+  fTriggerBiasCorrectionMBToND      ->GetTrackCorrection()->SetBatchFill(flag);
+  fTriggerBiasCorrectionMBToOnePart ->GetTrackCorrection()->SetBatchFill(flag);
+}
+
+//____________________________________________________________________
+void AlidNdEtaCorrection::FlushFills()
+{
+  // adds the buffered fills of the track level corrections to their histograms
+
+  fTrack2ParticleCorrection         ->GetTrackCorrection()->FlushFills();
+  fVertexRecoCorrection             ->GetTrackCorrection()->FlushFills();
+  fTriggerBiasCorrectionMBToINEL    ->GetTrackCorrection()->FlushFills();
+  fTriggerBiasCorrectionMBToNSD     ->GetTrackCorrection()->FlushFills();
+  fTriggerBiasCorrectionMBToND      ->GetTrackCorrection()->FlushFills();
+  fTriggerBiasCorrectionMBToOnePart ->GetTrackCorrection()->FlushFills();
+}
+
 //____________________________________________________________________
 Float_t AlidNdEtaCorrection::GetMeasuredFraction(CorrectionType correctionType, Float_t ptCutOff, Float_t eta, Int_t vertexBegin, Int_t vertexEnd, Bool_t debug)
 {
@@ -46,6 +46,9 @@ public:
   void FillTrackedParticle(Float_t vtx, Float_t eta, Float_t pt, Double_t weight=1.);
   void FillEvent(Float_t vtx, Float_t n, Bool_t trigger, Bool_t vertex, Int_t processType);
 
+  void SetBatchFill(Bool_t flag = kTRUE);
+  void FlushFills();
+
   void Finish();
 
   AliCorrection* GetTrack2ParticleCorrection()  {return fTrack2ParticleCorrection;}
@@ -260,6 +260,8 @@ void AlidNdEtaCorrectionTask::CreateOutputObjects()
 
   fdNdEtaCorrection = new AlidNdEtaCorrection("dndeta_correction", "dndeta_correction", fAnalysisMode);
   fOutput->Add(fdNdEtaCorrection);
+  if (fOption.Contains("batch-fill"))
+    fdNdEtaCorrection->SetBatchFill();
 
   fPIDParticles = new TH1F("fPIDParticles", "PID of generated primary particles", 10001, -5000.5, 5000.5);
   fOutput->Add(fPIDParticles);
@@ -304,6 +306,11 @@ void AlidNdEtaCorrectionTask::CreateOutputObjects()
       fOutput->Add(fdNdEtaCorrectionSpecial[i]);
   }
 
+  if (fOption.Contains("batch-fill"))
+    for (Int_t i=0; i<4; i++)
+      if (fdNdEtaCorrectionSpecial[i])
+        fdNdEtaCorrectionSpecial[i]->SetBatchFill();
+
   
   //fTemp1 = new TH2F("fTemp1", "fTemp1", 4, 0.5, 4.5, 101, -1.5, 99.5); // nsd study
   fTemp1 = new TH2F("fTemp1", "fTemp1", 300, -15, 15, 80, -2.0, 2.0); 
@@ -1271,6 +1278,12 @@ void AlidNdEtaCorrectionTask::Exec(Option_t*)
     for (Int_t id=0; id<4; id++)
       fdNdEtaCorrectionSpecial[id]->FillEvent(vtxMC[2], multAxis, eventTriggered, eventVertex, processType2);
 
+  // add the buffered track level fills of this event (option batch-fill)
+  fdNdEtaCorrection->FlushFills();
+  for (Int_t i=0; i<4; i++)
+    if (fdNdEtaCorrectionSpecial[i])
+      fdNdEtaCorrectionSpecial[i]->FlushFills();
+
   if (etaArr)
     delete[] etaArr;
   if (labelArr)
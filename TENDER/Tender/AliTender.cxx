@@ -17,6 +17,7 @@
 
 #include <TChain.h>
 #include <TFile.h>
+#include <TSystem.h>
  
 #include "AliTender.h"
 #include "AliTenderSupply.h"
@@ -41,7 +42,11 @@ AliTender::AliTender():
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fRequiredFields(AliTenderSupply::kAllFields),
+           fActiveSupplies(NULL),
+           fCDBSnapshotDir(),
+           fSnapshotRun(0)
 {
 // Dummy constructor
 }
@@ -58,7 +63,11 @@ AliTender::AliTender(const char* name):
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fRequiredFields(AliTenderSupply::kAllFields),
+           fActiveSupplies(NULL),
+           fCDBSnapshotDir(),
+           fSnapshotRun(0)
 {
 // Default constructor
   DefineOutput(1,  AliESDEvent::Class());
@@ -72,6 +81,7 @@ AliTender::~AliTender()
     fSupplies->Delete();
     delete fSupplies;
   }
+  delete fActiveSupplies;
 }
 
 //______________________________________________________________________________
@@ -121,15 +131,38 @@ void AliTender::ConnectInputData(Option_t* option)
     if (!fDefaultStorage.Length()) AliFatal("Default CDB storage not set.");
     // SetDefault storage. Specific storages must be set by AliTenderSupply::Init()
     fCDB->SetDefaultStorage(fDefaultStorage);
-    // Unlock CDB
-    fCDBkey = fCDB->SetLock(kFALSE, fCDBkey);
-    if(run){ fCDB->SetRun(fRun); }
-    // Lock CDB
-    fCDBkey = fCDB->SetLock(kTRUE, fCDBkey);
+    if(run){ SetCDBRun(); }
   }
   TIter next(fSupplies);
   AliTenderSupply *supply;
   while ((supply=(AliTenderSupply*)next())) supply->Init();
+  SelectSupplies();
+}
+
+//______________________________________________________________________________
+void AliTender::SelectSupplies()
+{
+// Select the supplies to execute. Going backwards from the fields required by
+// the train, a supply is kept if it produces a field still needed, and then
+// the fields it reads are needed from the supplies before it.
+  if (!fActiveSupplies) fActiveSupplies = new TObjArray();
+  fActiveSupplies->Clear();
+  if (!fSupplies) return;
+  Int_t nsupplies = fSupplies->GetEntriesFast();
+  TObjArray selected(nsupplies);
+  UInt_t needed = fRequiredFields;
+  for (Int_t i=nsupplies-1; i>=0; i--) {
+    AliTenderSupply *supply = (AliTenderSupply*)fSupplies->At(i);
+    if (!supply) continue;
+    UInt_t output = supply->GetOutputFields();
+    if (output && !(output & needed)) {
+      Info("SelectSupplies", "Tender supply %s skipped, its output is not used", supply->GetName());
+      continue;
+    }
+    needed |= supply->GetInputFields();
+    selected.AddAt(supply, i);
+  }
+  for (Int_t i=0; i<nsupplies; i++) if (selected.At(i)) fActiveSupplies->Add(selected.At(i));
 }
 
 //______________________________________________________________________________
@@ -162,15 +195,10 @@ void AliTender::UserExec(Option_t* option)
     fRunChanged = kTRUE;
     fRun = fESD->GetRunNumber();
     fCDB = AliCDBManager::Instance();
-    if(fHandleCDB){
-      // Unlock CDB
-      fCDBkey = fCDB->SetLock(kFALSE, fCDBkey);
-      fCDB->SetRun(fRun);
-      // Lock CDB
-      fCDBkey = fCDB->SetLock(kTRUE, fCDBkey);
-    } 
+    if(fHandleCDB) SetCDBRun();
   }
-  TIter next(fSupplies);
+  if (!fActiveSupplies) SelectSupplies();
+  TIter next(fActiveSupplies);
   AliTenderSupply *supply;
   while ((supply=(AliTenderSupply*)next())) supply->ProcessEvent();
   fRunChanged = kFALSE;
@@ -181,6 +209,62 @@ void AliTender::UserExec(Option_t* option)
   if (!opt.Contains("NoPost")) PostData(1, fESD);
 }
 
+//______________________________________________________________________________
+void AliTender::FinishTaskOutput()
+{
+// Write the OCDB snapshot of the last run.
+  WriteCDBSnapshot();
+}
+
+//______________________________________________________________________________
+void AliTender::SetCDBRun()
+{
+// Switch the CDB manager to fRun, using the run snapshot if there is one.
+  WriteCDBSnapshot(); // entries of the previous run, the cache is cleared by SetRun
+  // Unlock CDB
+  fCDBkey = fCDB->SetLock(kFALSE, fCDBkey);
+  fCDB->SetRun(fRun);
+  if (fCDBSnapshotDir.Length()) {
+    TString snapshot = GetCDBSnapshotFileName(fRun);
+    if (!gSystem->AccessPathName(snapshot, kReadPermission)) {
+      AliInfo(Form("Using OCDB snapshot %s", snapshot.Data()));
+      fCDB->SetSnapshotMode(snapshot);
+    } else {
+      fCDB->UnsetSnapshotMode();
+      fSnapshotRun = fRun;
+    }
+  }
+  // Lock CDB
+  fCDBkey = fCDB->SetLock(kTRUE, fCDBkey);
+}
+
+//______________________________________________________________________________
+TString AliTender::GetCDBSnapshotFileName(Int_t run) const
+{
+// Name of the OCDB snapshot of the run.
+  return TString::Format("%s/OCDB_%09d.root", gSystem->ExpandPathName(fCDBSnapshotDir.Data()), run);
+}
+
+//______________________________________________________________________________
+void AliTender::WriteCDBSnapshot()
+{
+// Dump the entries retrieved for fSnapshotRun to its snapshot, under a
+// temporary name first so that concurrent jobs never read a partial file.
+  if (fSnapshotRun <= 0) return;
+  TString snapshot = GetCDBSnapshotFileName(fSnapshotRun);
+  fSnapshotRun = 0;
+  if (!gSystem->AccessPathName(snapshot, kFileExists)) return; // written by another job
+  TString dir = gSystem->DirName(snapshot);
+  if (gSystem->AccessPathName(dir, kFileExists)) gSystem->mkdir(dir, kTRUE);
+  TString tmpName = TString::Format("%s.%d.tmp", snapshot.Data(), gSystem->GetPid());
+  AliInfo(Form("Writing OCDB snapshot %s", snapshot.Data()));
+  AliCDBManager::Instance()->DumpToSnapshotFile(tmpName, kFALSE);
+  if (gSystem->Rename(tmpName, snapshot)) {
+    AliWarning(Form("Could not move the OCDB snapshot to %s", snapshot.Data()));
+    gSystem->Unlink(tmpName);
+  }
+}
+
 //______________________________________________________________________________
 void AliTender::SetDefaultCDBStorage(const char *dbString)
 {
@@ -43,10 +43,17 @@ private:
   AliESDEvent              *fESD;            //! Pointer to current ESD event
   TObjArray                *fSupplies;       // Array of tender supplies
   TObjArray                *fCDBSettings;    // Array with CDB configuration
+  UInt_t                    fRequiredFields; // Event fields read after the tender (AliTenderSupply::ETenderFields)
+  TObjArray                *fActiveSupplies; //! Supplies producing fields in use
+  TString                   fCDBSnapshotDir; // Directory with the per run OCDB snapshots (OCDB handled by the tender)
+  Int_t                     fSnapshotRun;    //! Run whose OCDB entries are to be written to a snapshot
   
   AliTender(const AliTender &other);
   AliTender& operator=(const AliTender &other);
 
+  void                      SetCDBRun();
+  void                      WriteCDBSnapshot();
+
 public:  
   AliTender();
   AliTender(const char *name);
@@ -58,6 +65,7 @@ public:
   AliESDInputHandler       *GetESDhandler() const {return fESDhandler;}
   AliESDEvent              *GetEvent() const {return fESD;}
   TObjArray                *GetSupplies() const {return fSupplies;}
+  TObjArray                *GetActiveSupplies() const {return fActiveSupplies;}
   void                      SetCheckEventSelection(Bool_t flag=kTRUE) {TObject::SetBit(kCheckEventSelection,flag);}
   Bool_t                    RunChanged() const {return fRunChanged;}
   // Configuration
@@ -68,13 +76,30 @@ public:
    */
   void 			    SetHandleOCDB(Bool_t doHandle) { fHandleCDB = doHandle; }
   void SetESDhandler(AliESDInputHandler*esdH) {fESDhandler = esdH;}
+  /**
+   * Directory of per run OCDB snapshots, used when the tender handles the OCDB.
+   * A run with a snapshot reads all its entries from it, otherwise the entries
+   * retrieved by the supplies are written to a new snapshot at the end of the run.
+   * @param[in] dir Local (site cache) directory
+   */
+  void                      SetCDBSnapshotDir(const char *dir) {fCDBSnapshotDir = dir;}
+  TString                   GetCDBSnapshotFileName(Int_t run) const;
+  /**
+   * Declare the event fields read by the wagons after the tender (default: all).
+   * Supplies producing only fields that nobody reads are not executed.
+   * @param[in] mask Combination of AliTenderSupply::ETenderFields
+   */
+  void                      SetRequiredFields(UInt_t mask) {fRequiredFields = mask;}
+  UInt_t                    GetRequiredFields() const {return fRequiredFields;}
 
   // Run control
   virtual void              ConnectInputData(Option_t *option = "");
   virtual void              UserCreateOutputObjects();
 //  virtual Bool_t            Notify() {return kTRUE;}
   virtual void              UserExec(Option_t *option);
+  virtual void              FinishTaskOutput();
+  void                      SelectSupplies();
     
-  ClassDef(AliTender,4)  // Class describing the tender car for ESD analysis
+  ClassDef(AliTender,6)  // Class describing the tender car for ESD analysis
 };
 #endif
@@ -22,6 +22,22 @@ protected:
   const AliTender          *fTender;         // Tender car
   
 public:  
+  // Event fields produced or read by a supply
+  enum ETenderFields {
+    kPrimaryVertex = BIT(0),  // primary vertices
+    kTrackParams   = BIT(1),  // track parameters and covariance
+    kTPCSignal     = BIT(2),  // TPC dE/dx of the tracks
+    kTOFSignal     = BIT(3),  // TOF signal and event time zero
+    kTRDSignal     = BIT(4),  // TRD signal and PID of the tracks
+    kHMPIDSignal   = BIT(5),  // HMPID signal of the tracks
+    kTrackPID      = BIT(6),  // PID response stored in the tracks
+    kVZERO         = BIT(7),  // VZERO data
+    kT0            = BIT(8),  // T0 data
+    kEMCAL         = BIT(9),  // EMCAL cells, clusters and matching
+    kPHOS          = BIT(10), // PHOS cells and clusters
+    kAllFields     = 0xFFFFFFFF
+  };
+
   AliTenderSupply();
   AliTenderSupply(const char *name, const AliTender *tender=NULL);
   AliTenderSupply(const AliTenderSupply &other);
@@ -31,6 +47,10 @@ public:
   // Run control
   virtual void              Init() = 0;
   virtual void              ProcessEvent() = 0;
+  // Fields written and read by ProcessEvent(), see ETenderFields. A supply
+  // not declaring its outputs (0) is always executed.
+  virtual UInt_t            GetOutputFields() const {return 0;}
+  virtual UInt_t            GetInputFields()  const {return 0;}
   
   void                      SetTender(const AliTender *tender) {fTender = tender;}
     
@@ -52,6 +52,8 @@ public:
 
   virtual void Init();
   virtual void ProcessEvent();
+  virtual UInt_t GetOutputFields() const {return kEMCAL;}
+  virtual UInt_t GetInputFields()  const {return kTrackParams|kPrimaryVertex;}
 
   void     SetTask(AliAnalysisTaskSE *task)               { fTask = task                     ;}
   void     SetDefaults();
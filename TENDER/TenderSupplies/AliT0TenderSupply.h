@@ -22,6 +22,8 @@ class AliT0TenderSupply: public AliTenderSupply {
 
   virtual void          Init();
   virtual void          ProcessEvent();
+  virtual UInt_t        GetOutputFields() const {return kT0;}
+  virtual UInt_t        GetInputFields()  const {return kPrimaryVertex;}
   void SetCorrectMeanTime (Bool_t flag=kFALSE){fCorrectMeanTime=flag;};
   void SetAmplutudeCorrection (Bool_t flag=kFALSE){fCorrectStartTimeOnAmplSatur=flag;};
   void SetPass4LHC11aCorrection (Bool_t flag=kFALSE){fPass4LHC11aCorrection=flag;};
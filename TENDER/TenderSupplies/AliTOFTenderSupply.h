@@ -29,6 +29,8 @@ public:
 
   virtual void              Init();
   virtual void              ProcessEvent();
+  virtual UInt_t            GetOutputFields() const {return kTOFSignal|kTrackPID;}
+  virtual UInt_t            GetInputFields()  const {return kTrackParams|kT0;}
 
   // TOF tender methods
   void SetIsMC(Bool_t flag=kFALSE){fIsMC=flag;}
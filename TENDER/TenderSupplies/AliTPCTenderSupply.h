@@ -42,6 +42,8 @@ public:
 
   virtual void              Init();
   virtual void              ProcessEvent();
+  virtual UInt_t            GetOutputFields() const {return kTPCSignal|kTrackPID;}
+  virtual UInt_t            GetInputFields()  const {return kPrimaryVertex;}
   
 private:
   AliESDpid          *fESDpid;         //! ESD pid object
@@ -45,6 +45,8 @@ public:
 
   virtual void              Init();
   virtual void              ProcessEvent();
+  virtual UInt_t            GetOutputFields() const {return kTRDSignal|kTrackPID;}
+  virtual UInt_t            GetInputFields()  const {return kTrackParams;}
   
   void SwitchOnGainCorrection() { fGainCorrection = kTRUE; }
   void SwitchOffGainCorrection() { fGainCorrection = kFALSE; }